@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+
+import argparse
+import sys
+
+try:
+    import heatshrink2
+except ImportError:
+    print('Failed to import heatshrink2, install it with: pip3 install heatshrink2')
+    sys.exit(1)
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description="""CLI tool to decompress an ulog file (.ulgz)\n""")
+    parser.add_argument("ulog_file", help=".ulgz file (decrypt .ulgzc files first with decrypt_ulog.py)")
+    parser.add_argument("-o", "--output", help="output file (default: .ulg next to the input file)", default=None)
+
+    args = parser.parse_args()
+
+    with open(args.ulog_file, 'rb') as f:
+        header = f.read(8)
+
+        # magic, version, window & lookahead bits (see src/modules/logger/log_compressor.h)
+        if len(header) != 8 or not header.startswith(bytearray("ULogZ".encode())) or header[5] != 1:
+            print("File format error")
+            sys.exit(1)
+
+        window_bits = header[6]
+        lookahead_bits = header[7]
+        data = heatshrink2.decompress(f.read(), window_sz2=window_bits, lookahead_sz2=lookahead_bits)
+
+    output = args.output
+
+    if not output:
+        output = args.ulog_file[:-1] if args.ulog_file.endswith('z') else args.ulog_file + '.ulg'
+
+    with open(output, 'wb') as out:
+        out.write(data)
@@ -0,0 +1,168 @@
+#! /usr/bin/env python3
+"""
+Runs the EKF2 replay (replay_mode=ekf2) on many .ulg files in parallel, optionally for every parameter set of a
+ parameter sweep. uORB and the parameters are global to a px4 process, therefore every replay session runs in its own
+ px4 instance (-i) and working directory. The ekf2 replay mode is not paced by the log timestamps, so the sessions run
+ as fast as the CPU allows.
+
+The px4 binary must be built with replay support, e.g.:
+    replay=<any .ulg file> make px4_sitl_default
+
+The parameter sweep file is a csv file with the parameter names as header and one parameter set per row, e.g.:
+    EKF2_GPS_DELAY,EKF2_MAG_NOISE
+    110,0.05
+    150,0.08
+
+A compact summary of all sessions is written to <output_dir>/results.csv, the replayed logs are in
+ <output_dir>/<log name>/<parameter set>/log/.
+"""
+# -*- coding: utf-8 -*-
+
+import argparse
+import csv
+import glob
+import os
+import queue
+import subprocess
+import time
+
+from concurrent.futures import ThreadPoolExecutor
+
+def get_arguments():
+    file_dir = os.path.dirname(os.path.realpath(__file__))
+    parser = argparse.ArgumentParser(description='Replay EKF2 on the specified .ulg files in parallel')
+    parser.add_argument('logs', nargs='+',
+                        help='.ulg files or directories (searched recursively for .ulg files)')
+    parser.add_argument('--build-dir', type=str,
+                        default=os.path.join(file_dir, '..', '..', 'build', 'px4_sitl_default_replay'),
+                        help='px4 build directory of the replay build.')
+    parser.add_argument('-o', '--output-dir', type=str, default='batch_replay',
+                        help='Directory for the replayed logs and the results.')
+    parser.add_argument('-p', '--params', type=str, default=None,
+                        help='csv file with one parameter set per row that each log is replayed with.')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(),
+                        help='Number of replay sessions running in parallel.')
+    parser.add_argument('--timeout', type=float, default=3600.0,
+                        help='Timeout of a single replay session in seconds.')
+    return parser.parse_args()
+
+
+def find_logs(paths):
+    ulog_files = []
+
+    for path in paths:
+        if os.path.isdir(path):
+            ulog_files += sorted(glob.glob(os.path.join(path, '**/*.ulg'), recursive=True))
+        else:
+            ulog_files.append(path)
+
+    return [os.path.abspath(ulog_file) for ulog_file in ulog_files]
+
+
+def read_parameter_sets(params_file):
+    if params_file is None:
+        return [{}]
+
+    with open(params_file, newline='') as f:
+        return [{name.strip(): value.strip() for name, value in row.items()} for row in csv.DictReader(f)]
+
+
+def run_session(session, build_dir, instances, timeout):
+    ulog_file, param_set_index, param_set, working_dir = session
+    os.makedirs(working_dir, exist_ok=True)
+
+    # the replay applies the parameters from the log first, these override single parameters
+    with open(os.path.join(working_dir, 'replay_params.txt'), 'w') as f:
+        for name, value in param_set.items():
+            f.write('{:s} {:s}\n'.format(name, value))
+
+    env = dict(os.environ)
+    env['replay'] = ulog_file
+    env['replay_mode'] = 'ekf2'
+
+    instance = instances.get()
+    start = time.monotonic()
+
+    try:
+        with open(os.path.join(working_dir, 'out.log'), 'w') as out:
+            result = subprocess.run([os.path.join(build_dir, 'bin', 'px4'), '-i', str(instance), '-d',
+                                     os.path.join(build_dir, 'etc')],
+                                    cwd=working_dir, env=env, stdin=subprocess.DEVNULL, stdout=out,
+                                    stderr=subprocess.STDOUT, timeout=timeout)
+            returncode = result.returncode
+
+    except subprocess.TimeoutExpired:
+        returncode = 'timeout'
+
+    finally:
+        instances.put(instance)
+
+    duration = time.monotonic() - start
+    replayed_logs = sorted(glob.glob(os.path.join(working_dir, 'log', '**', '*.ulg'), recursive=True))
+
+    return {'log': ulog_file, 'param_set': param_set_index, 'returncode': returncode,
+            'duration_s': '{:.2f}'.format(duration), 'replayed_log': replayed_logs[-1] if replayed_logs else ''}
+
+
+def main() -> None:
+
+    args = get_arguments()
+
+    build_dir = os.path.abspath(args.build_dir)
+    output_dir = os.path.abspath(args.output_dir)
+
+    if not os.path.isfile(os.path.join(build_dir, 'bin', 'px4')):
+        raise SystemExit('px4 binary not found in {:s}, build it with replay support first'.format(build_dir))
+
+    ulog_files = find_logs(args.logs)
+    param_sets = read_parameter_sets(args.params)
+
+    sessions = []
+
+    for ulog_file in ulog_files:
+        log_name = os.path.splitext(os.path.basename(ulog_file))[0]
+
+        for i, param_set in enumerate(param_sets):
+            sessions.append((ulog_file, i, param_set, os.path.join(output_dir, log_name, str(i))))
+
+    n_jobs = max(1, min(args.jobs, len(sessions)))
+    print('replaying {:d} .ulg files with {:d} parameter sets, {:d} sessions in parallel'.format(
+        len(ulog_files), len(param_sets), n_jobs))
+
+    # px4 instance ids of the sessions running at the same time need to be unique
+    instances = queue.Queue()
+
+    for i in range(n_jobs):
+        instances.put(i)
+
+    os.makedirs(output_dir, exist_ok=True)
+    n_failed = 0
+    start = time.monotonic()
+
+    with ThreadPoolExecutor(max_workers=n_jobs) as executor, \
+            open(os.path.join(output_dir, 'results.csv'), 'w', newline='') as results_file:
+        writer = csv.DictWriter(results_file, fieldnames=['log', 'param_set', 'returncode', 'duration_s',
+                                                          'replayed_log'])
+        writer.writeheader()
+
+        futures = [executor.submit(run_session, session, build_dir, instances, args.timeout)
+                   for session in sessions]
+
+        for n, future in enumerate(futures):
+            result = future.result()
+            writer.writerow(result)
+            results_file.flush()
+
+            if result['returncode'] != 0 or not result['replayed_log']:
+                n_failed = n_failed + 1
+
+            print('session {:d}/{:d}: {:s} (set {:d}) {:s}s{:s}'.format(
+                n + 1, len(sessions), result['log'], result['param_set'], result['duration_s'],
+                '' if result['replayed_log'] else ' FAILED'))
+
+    print('{:d}/{:d} sessions replayed in {:.1f}s, {:d} failed.'.format(
+        len(sessions) - n_failed, len(sessions), time.monotonic() - start, n_failed))
+
+
+if __name__ == '__main__':
+    main()
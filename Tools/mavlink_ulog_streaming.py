@@ -31,8 +31,12 @@ class LoggingCompleted(Exception):
 class MavlinkLogStreaming():
     '''Streams log data via MAVLink.
        Assumptions:
-       - the sender only sends one acked message at a time
+       - the sender keeps at most ack_window acked messages in flight and sends
+         all of them before switching back to unacked messages
        - the data is in the ULog format '''
+
+    ack_window = 8 # ulog_stream_ack.ACK_WINDOW
+
     def __init__(self, portname, baudrate, output_filename, debug=0):
         self.baudrate = 0
         self._debug = debug
@@ -49,6 +53,8 @@ class MavlinkLogStreaming():
         self.file = open(output_filename,'wb')
         self.start_time = timer()
         self.last_sequence = -1
+        self.reordered = {} # messages received ahead of a gap, by sequence
+        self.skip_gaps = False
         self.logging_started = False
         self.num_dropouts = 0
         self.target_component = 1
@@ -121,6 +127,17 @@ class MavlinkLogStreaming():
     def read_message(self):
         ''' read a single mavlink message, handle ACK & return a tuple of (data, first
         message start, num dropouts) '''
+        if self.reordered:
+            # continue with the messages received ahead of a gap, once the gap is
+            # filled (or it cannot be filled anymore)
+            seq = min(self.reordered, key=lambda s: (s - self.last_sequence) & 0xffff)
+            num_drops = ((seq - self.last_sequence) & 0xffff) - 1
+            if num_drops == 0 or self.skip_gaps:
+                m = self.reordered.pop(seq)
+                if not self.reordered:
+                    self.skip_gaps = False
+                return self.deliver_message(m, num_drops)
+
         m = self.mav.recv_match(type=['LOGGING_DATA_ACKED',
                             'LOGGING_DATA', 'COMMAND_ACK'], blocking=True,
                             timeout=0.05)
@@ -142,6 +159,8 @@ class MavlinkLogStreaming():
 
             # m is either 'LOGGING_DATA_ACKED' or 'LOGGING_DATA':
             is_newer, num_drops = self.check_sequence(m.sequence)
+            if m.sequence in self.reordered:
+                is_newer = False
 
             # return an ack, even we already sent it for the same sequence,
             # because the ack could have been dropped
@@ -151,16 +170,17 @@ class MavlinkLogStreaming():
 
             if is_newer:
                 if num_drops > 0:
-                    self.num_dropouts += num_drops
-
-                if m.get_type() == 'LOGGING_DATA':
-                    if not self.got_header_section:
-                        print('Header received in {:0.2f}s (size: {:.1f} KB)'.format(
-                              timer()-self.start_time, self.file.tell()/1024))
-                        self.logging_started = True
-                        self.got_header_section = True
-                self.last_sequence = m.sequence
-                return m.data[:m.length], m.first_message_offset, num_drops
+                    # acked messages can arrive out of order: the missing ones
+                    # might still be re-sent. Keep this one until the gap is
+                    # filled, unless it is beyond the window of acked messages.
+                    self.reordered[m.sequence] = m
+                    if m.get_type() != 'LOGGING_DATA_ACKED' or \
+                            num_drops >= self.ack_window:
+                        self.skip_gaps = True
+                    self.debug('out of order message '+str(m.sequence), 2)
+                    return None, 0, 0
+
+                return self.deliver_message(m, num_drops)
 
             else:
                 self.debug('dup/reordered message '+str(m.sequence))
@@ -168,6 +188,22 @@ class MavlinkLogStreaming():
         return None, 0, 0
 
 
+    def deliver_message(self, m, num_drops):
+        ''' account for a message in sequence & return a tuple of (data, first
+        message start, num dropouts) '''
+        if num_drops > 0:
+            self.num_dropouts += num_drops
+
+        if m.get_type() == 'LOGGING_DATA':
+            if not self.got_header_section:
+                print('Header received in {:0.2f}s (size: {:.1f} KB)'.format(
+                      timer()-self.start_time, self.file.tell()/1024))
+                self.logging_started = True
+                self.got_header_section = True
+        self.last_sequence = m.sequence
+        return m.data[:m.length], m.first_message_offset, num_drops
+
+
     def check_sequence(self, seq):
         ''' check if a sequence is newer than the previously received one & if
         there were dropped messages between the last and this '''
@@ -163,12 +163,79 @@ def sizeof_field_type(field):
     return 0  # this is for non-builtin types: sort them at the end
 
 
-def get_children_fields(base_type, search_path):
+def get_children_spec(base_type, search_path):
     (package, name) = genmsg.names.package_resource_name(base_type)
     tmp_msg_context = genmsg.msg_loader.MsgContext.create_default()
-    spec_temp = genmsg.msg_loader.load_msg_by_type(
+    return genmsg.msg_loader.load_msg_by_type(
         tmp_msg_context, '%s/%s' % (package, name), search_path)
-    return spec_temp.parsed_fields()
+
+
+def get_children_fields(base_type, search_path):
+    return get_children_spec(base_type, search_path).parsed_fields()
+
+
+HOT_TOKEN = '# HOT '
+
+
+def get_hot_fields(msg_text):
+    """
+    Get the names of the hot fields from "# HOT" lines of the msg file, e.g.
+    '# HOT arming_state nav_state'
+    """
+    hot_fields = []
+    for line in msg_text.split('\n'):
+        if line.startswith(HOT_TOKEN):
+            hot_fields += line.replace(HOT_TOKEN, '').split()
+    return hot_fields
+
+
+def get_sorted_fields(msg_fields, msg_text=''):
+    """
+    Get the fields in the order of the uORB struct: sorted by size (using a
+    stable sort) to avoid padding. If the message has hot fields, they are
+    grouped at the front together with the timestamp and padded to 8 bytes,
+    so that the hot prefix of a message can be copied on its own.
+    """
+    hot_fields = get_hot_fields(msg_text)
+    if not hot_fields:
+        return sorted(msg_fields, key=sizeof_field_type, reverse=True)
+
+    field_names = [field.name for field in msg_fields]
+    for name in hot_fields:
+        if name not in field_names:
+            raise Exception('hot field "%s" does not exist' % name)
+
+    hot = [field for field in msg_fields if field.name == 'timestamp' or field.name in hot_fields]
+    cold = [field for field in msg_fields if field.name != 'timestamp' and field.name not in hot_fields]
+
+    hot_size = 0
+    for field in hot:
+        if not field.is_builtin:
+            raise Exception('hot field "%s" is not a builtin type' % field.name)
+        hot_size += sizeof_field_type(field) * (field.array_len if field.is_array else 1)
+
+    sorted_fields = sorted(hot, key=sizeof_field_type, reverse=True)
+    num_padding_bytes = (8 - (hot_size % 8)) % 8
+    if num_padding_bytes > 0 and cold:
+        padding_field = genmsg.Field('_padding_hot', 'uint8[' + str(num_padding_bytes) + ']')
+        padding_field.sizeof_field_type = 1
+        sorted_fields.append(padding_field)
+    return sorted_fields + sorted(cold, key=sizeof_field_type, reverse=True)
+
+
+def get_hot_prefix_size(msg_fields, msg_text):
+    """
+    Get the size of the hot prefix of the uORB struct in bytes, or 0 if the
+    message has no hot fields
+    """
+    hot_fields = get_hot_fields(msg_text)
+    size = 0
+    if hot_fields:
+        for field in get_sorted_fields(msg_fields, msg_text):
+            if field.name not in hot_fields and field.name not in ('timestamp', '_padding_hot'):
+                break
+            size += sizeof_field_type(field) * (field.array_len if field.is_array else 1)
+    return size
 
 
 def get_message_fields_str_for_message_hash(msg_fields, search_path):
@@ -256,8 +323,8 @@ def add_padding_bytes(fields, search_path):
                     struct_size += num_padding_bytes
                     fields.insert(i, padding_field)
                     i += 1
-                children_fields = get_children_fields(
-                    field.base_type, search_path)
+                children_spec = get_children_spec(field.base_type, search_path)
+                children_fields = get_sorted_fields(children_spec.parsed_fields(), children_spec.text)
                 field.sizeof_field_type, unused = add_padding_bytes(children_fields,
                                                                     search_path)
             struct_size += field.sizeof_field_type * array_size
@@ -277,6 +344,43 @@ def add_padding_bytes(fields, search_path):
     return (struct_size, num_padding_bytes)
 
 
+def get_uorb_field_offsets(msg_fields, search_path, name_prefix='', offset=0, msg_text=''):
+    """
+    Get the offsets of all builtin fields inside the generated uORB struct (same
+    field order and padding as add_padding_bytes()). Nested types are flattened,
+    the names are of the form 'esc[0].esc_rpm'.
+    returns a tuple with a dict of the offsets and the struct size
+    """
+    offsets = {}
+    struct_size = 0
+    align_to = 8  # this is always 8, because of the 64bit timestamp
+    sorted_fields = get_sorted_fields(msg_fields, msg_text)
+    for field in sorted_fields:
+        if field.is_header:
+            continue
+        array_size = field.array_len if field.is_array else 1
+        if field.is_builtin:
+            offsets[name_prefix + field.name] = offset + struct_size
+            struct_size += sizeof_field_type(field) * array_size
+        else:
+            # embedded type: aligned to 8 bytes
+            struct_size += (align_to - (struct_size % align_to)) % align_to
+            children_spec = get_children_spec(field.base_type, search_path)
+            for i in range(array_size):
+                sub_name_prefix = name_prefix + field.name
+                if array_size > 1:
+                    sub_name_prefix += '[' + str(i) + ']'
+                sub_offsets, sub_size = get_uorb_field_offsets(children_spec.parsed_fields(), search_path,
+                                                               sub_name_prefix + '.', offset + struct_size,
+                                                               children_spec.text)
+                offsets.update(sub_offsets)
+                struct_size += sub_size
+
+    # padding at the end
+    struct_size += (align_to - (struct_size % align_to)) % align_to
+    return (offsets, struct_size)
+
+
 def convert_type(spec_type, use_short_type=False):
     """
     Convert from msg type to C type
@@ -96,6 +96,28 @@ def add_fields(msg_fields, name_prefix='', offset=0):
 
 fields, struct_size = add_fields(spec.parsed_fields())
 
+# group consecutive fields with the same layout in the uORB struct and CDR into
+# runs, which are (de)serialized with a single memcpy
+uorb_offsets, unused = get_uorb_field_offsets(spec.parsed_fields(), search_path, msg_text=spec.text)
+runs = []
+for field_type, field_name, field_size, padding in fields:
+	adjusted = field_type == 'uint64' and (field_name == 'timestamp' or field_name == 'timestamp_sample')
+	if runs and padding == 0 and not adjusted and not runs[-1]['adjusted'] and \
+			uorb_offsets[field_name] == uorb_offsets[runs[-1]['fields'][-1][1]] + runs[-1]['fields'][-1][2]:
+		runs[-1]['fields'].append((field_type, field_name, field_size, padding))
+		runs[-1]['size'] += field_size
+	else:
+		runs.append({'fields': [(field_type, field_name, field_size, padding)],
+			'size': field_size, 'adjusted': adjusted})
+
+def print_run_asserts(run):
+	first_name = run['fields'][0][1]
+	for field_type, field_name, field_size, padding in run['fields']:
+		print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
+		if field_name != first_name:
+			print('\tstatic_assert(offsetof({0}, {1}) - offsetof({0}, {2}) == {3}, "layout mismatch");'.format(
+				uorb_struct, field_name, first_name, uorb_offsets[field_name] - uorb_offsets[first_name]))
+
 }@
 
 // auto-generated file
@@ -103,6 +125,7 @@ fields, struct_size = add_fields(spec.parsed_fields())
 #pragma once
 
 #include <ucdr/microcdr.h>
+#include <stddef.h>
 #include <string.h>
 #include <uORB/topics/@(topic).h>
 
@@ -128,12 +151,19 @@ static inline bool ucdr_serialize_@(topic)(const void* data, ucdrBuffer& buf, in
 {
 	const @(uorb_struct)& topic = *static_cast<const @(uorb_struct)*>(data);
 @{
-for field_type, field_name, field_size, padding in fields:
+for run in runs:
+	field_type, field_name, field_size, padding = run['fields'][0]
 	if padding > 0:
 		print('\tbuf.iterator += {:}; // padding'.format(padding))
 		print('\tbuf.offset += {:}; // padding'.format(padding))
 
-	print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
+	print_run_asserts(run)
+
+	if len(run['fields']) > 1:
+		print('\tmemcpy(buf.iterator, &topic.{0}, {1}); // {0} .. {2}'.format(field_name, run['size'], run['fields'][-1][1]))
+		print('\tbuf.iterator += {:};'.format(run['size']))
+		print('\tbuf.offset += {:};'.format(run['size']))
+		continue
 
 	if field_type == 'uint64' and field_name == 'timestamp':
 		print('\tconst uint64_t timestamp_adjusted = topic.timestamp + time_offset;')
@@ -156,12 +186,20 @@ for field_type, field_name, field_size, padding in fields:
 static inline bool ucdr_deserialize_@(topic)(ucdrBuffer& buf, @(uorb_struct)& topic, int64_t time_offset = 0)
 {
 @{
-for field_type, field_name, field_size, padding in fields:
+for run in runs:
+	field_type, field_name, field_size, padding = run['fields'][0]
 	if padding > 0:
 		print('\tbuf.iterator += {:}; // padding'.format(padding))
 		print('\tbuf.offset += {:}; // padding'.format(padding))
 
-	print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
+	print_run_asserts(run)
+
+	if len(run['fields']) > 1:
+		print('\tmemcpy(&topic.{0}, buf.iterator, {1}); // {0} .. {2}'.format(field_name, run['size'], run['fields'][-1][1]))
+		print('\tbuf.iterator += {:};'.format(run['size']))
+		print('\tbuf.offset += {:};'.format(run['size']))
+		continue
+
 	print('\tmemcpy(&topic.{0}, buf.iterator, sizeof(topic.{0}));'.format(field_name))
 
 	if field_type == 'uint64' and (field_name == 'timestamp' or field_name == 'timestamp_sample'):
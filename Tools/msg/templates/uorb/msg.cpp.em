@@ -59,8 +59,13 @@ from px_generate_uorb_topic_helper import * # this is in Tools/
 uorb_struct = '%s_s'%name_snake_case
 
 message_hash = get_message_hash(spec.parsed_fields(), search_path)
-sorted_fields = sorted(spec.parsed_fields(), key=sizeof_field_type, reverse=True)
+sorted_fields = get_sorted_fields(spec.parsed_fields(), spec.text)
 struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
+
+orb_flags = []
+if any(constant.name == 'ORB_SINGLE_WRITER' and int(constant.val) for constant in spec.constants):
+    orb_flags.append('ORB_FLAG_SINGLE_WRITER')
+orb_flags = ' | '.join(orb_flags) or '0'
 }@
 
 #include <inttypes.h>
@@ -75,7 +80,7 @@ struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
 
 @[for topic in topics]@
 static_assert(static_cast<orb_id_size_t>(ORB_ID::@topic) == @(all_topics.index(topic)), "ORB_ID index mismatch");
-ORB_DEFINE(@topic, struct @uorb_struct, @(struct_size-padding_end_size), @(message_hash)u, static_cast<orb_id_size_t>(ORB_ID::@topic));
+ORB_DEFINE(@topic, struct @uorb_struct, @(struct_size-padding_end_size), @(message_hash)u, static_cast<orb_id_size_t>(ORB_ID::@topic), @(orb_flags));
 @[end for]
 
 void print_message(const orb_metadata *meta, const @uorb_struct& message)
@@ -96,7 +96,7 @@ for field in spec.parsed_fields():
 
 def print_parsed_fields():
     # sort fields (using a stable sort)
-    sorted_fields = sorted(spec.parsed_fields(), key=sizeof_field_type, reverse=True)
+    sorted_fields = get_sorted_fields(spec.parsed_fields(), spec.text)
     struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
     # loop over all fields and print the type and name
     for field in sorted_fields:
@@ -125,6 +125,11 @@ for constant in spec.constants:
         raise Exception("Type {0} not supported, add to to template file!".format(type_name))
 
     print('\tstatic constexpr %s %s = %s;'%(type_px4, constant.name, int(constant.val)))
+
+# size of the hot fields grouped at the front ("# HOT" msg annotation), see Subscription::copy_prefix()
+hot_prefix_size = get_hot_prefix_size(spec.parsed_fields(), spec.text)
+if hot_prefix_size > 0:
+    print('\tstatic constexpr uint16_t HOT_PREFIX_SIZE = %d;'%(hot_prefix_size))
 }
 #endif
 };
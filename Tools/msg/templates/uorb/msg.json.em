@@ -25,7 +25,7 @@ from px_generate_uorb_topic_helper import * # this is in Tools/
 
 uorb_struct = '%s_s'%name_snake_case
 
-sorted_fields = sorted(spec.parsed_fields(), key=sizeof_field_type, reverse=True)
+sorted_fields = get_sorted_fields(spec.parsed_fields(), spec.text)
 struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
 topic_fields = ["%s %s" % (convert_type(field.type, True), field.name) for field in sorted_fields]
 
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+Symbolize the profiler_samples of a ULog file (published by the sampling_profiler module) and print a flat
+profile: the functions with the most samples, as determined by addr2line on the ELF file of the same build.
+
+Install: pip install pyulog
+Run:
+  ./symbolize_profile.py log.ulg build/px4_sitl_default/bin/px4
+  ./symbolize_profile.py --addr2line arm-none-eabi-addr2line log.ulg build/px4_fmu-v5_default/px4_fmu-v5_default.elf
+"""
+
+import argparse
+import collections
+import subprocess
+import sys
+
+from pyulog import ULog
+
+
+def load_samples(ulog_file):
+    """ return a list of (pc, tid) tuples, the sampling interval and the number of dropped samples """
+    ulog = ULog(ulog_file, ['profiler_samples'])
+
+    if not ulog.data_list:
+        sys.exit('no profiler_samples in ' + ulog_file)
+
+    data = ulog.data_list[0].data
+    samples = []
+
+    for i in range(len(data['timestamp'])):
+        load_address = int(data['load_address'][i])
+
+        for j in range(int(data['count'][i])):
+            pc = int(data['pc[{:d}]'.format(j)][i])
+            # pc 0: the platform could not determine the interrupted program counter
+            samples.append((pc - load_address if pc != 0 else 0, int(data['tid[{:d}]'.format(j)][i])))
+
+    return samples, int(data['sample_interval_us'][0]), int(sum(data['dropped']))
+
+
+def symbolize(addresses, elf_file, addr2line):
+    """ return a dict mapping each address to its function name """
+    addresses = sorted(addresses)
+    cmd = [addr2line, '-f', '-C', '-e', elf_file]
+    result = subprocess.run(cmd, input='\n'.join('{:x}'.format(a) for a in addresses) + '\n',
+                            stdout=subprocess.PIPE, universal_newlines=True, check=True)
+    lines = result.stdout.splitlines()
+    # addr2line prints 2 lines per address: function and file:line
+    return {address: lines[2 * i] for i, address in enumerate(addresses)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Print the flat profile of the profiler_samples of a ULog file')
+    parser.add_argument('ulog', help='ULog file')
+    parser.add_argument('elf', help='ELF file of the same build (with symbols)')
+    parser.add_argument('--addr2line', default='addr2line', help='addr2line executable (default: %(default)s)')
+    parser.add_argument('-n', type=int, default=40, help='number of functions to print (default: %(default)s)')
+    parser.add_argument('--thread', action='store_true', help='split the profile by thread id')
+    args = parser.parse_args()
+
+    samples, interval_us, dropped = load_samples(args.ulog)
+    names = symbolize({pc for pc, _ in samples if pc != 0}, args.elf, args.addr2line)
+    names[0] = '[unknown]'
+
+    counts = collections.Counter()
+
+    for pc, tid in samples:
+        counts[(tid if args.thread else None, names[pc])] += 1
+
+    total = len(samples)
+    print('{:d} samples at {:.0f} Hz ({:.1f} s of CPU time), {:d} dropped'.format(
+        total, 1e6 / interval_us, total * interval_us * 1e-6, dropped))
+    print()
+    print('{:>8} {:>7}  {}'.format('samples', '%', 'thread function' if args.thread else 'function'))
+
+    for (tid, name), count in counts.most_common(args.n):
+        prefix = '{:>6} '.format(tid) if args.thread else ''
+        print('{:8d} {:6.2f}%  {}{}'.format(count, 100.0 * count / total, prefix, name))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+Python bindings of the C++ ULog reader (src/lib/ulog), for fast columnar topic extraction.
+
+Build the library first:
+    cmake -S src/lib/ulog -B build/ulog_reader -DCMAKE_BUILD_TYPE=Release && cmake --build build/ulog_reader
+
+Usage as module:
+    reader = ULogReader('log.ulg')
+    data = reader.extract('vehicle_attitude', ['timestamp', 'q[0]'])  # dict of numpy arrays
+"""
+
+import argparse
+import ctypes
+import os
+import sys
+
+try:
+    import numpy as np
+except ImportError:
+    print('Failed to import numpy, install it with: pip3 install numpy')
+    sys.exit(1)
+
+_DEFAULT_LIBRARY = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'build', 'ulog_reader',
+                                'libulog_reader.dylib' if sys.platform == 'darwin' else 'libulog_reader.so')
+
+_BASIC_TYPES = ('int8_t', 'uint8_t', 'int16_t', 'uint16_t', 'int32_t', 'uint32_t', 'int64_t', 'uint64_t',
+                'float', 'double', 'bool', 'char')
+
+
+def _load_library(path):
+    lib = ctypes.CDLL(path)
+    lib.ulog_reader_open.restype = ctypes.c_void_p
+    lib.ulog_reader_open.argtypes = [ctypes.c_char_p]
+    lib.ulog_reader_close.argtypes = [ctypes.c_void_p]
+    lib.ulog_reader_start_timestamp.restype = ctypes.c_uint64
+    lib.ulog_reader_start_timestamp.argtypes = [ctypes.c_void_p]
+    lib.ulog_reader_num_subscriptions.argtypes = [ctypes.c_void_p]
+    lib.ulog_reader_subscription_name.restype = ctypes.c_char_p
+    lib.ulog_reader_subscription_name.argtypes = [ctypes.c_void_p, ctypes.c_int]
+    lib.ulog_reader_subscription_multi_id.argtypes = [ctypes.c_void_p, ctypes.c_int]
+    lib.ulog_reader_subscription_num_samples.restype = ctypes.c_int64
+    lib.ulog_reader_subscription_num_samples.argtypes = [ctypes.c_void_p, ctypes.c_int]
+    lib.ulog_reader_find_subscription.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_int]
+    lib.ulog_reader_format.restype = ctypes.c_char_p
+    lib.ulog_reader_format.argtypes = [ctypes.c_void_p, ctypes.c_char_p]
+    lib.ulog_reader_extract.restype = ctypes.c_int64
+    lib.ulog_reader_extract.argtypes = [ctypes.c_void_p, ctypes.c_int, ctypes.POINTER(ctypes.c_char_p), ctypes.c_int,
+                                        ctypes.POINTER(ctypes.POINTER(ctypes.c_double)), ctypes.c_int]
+    return lib
+
+
+class ULogReader:
+    """ Memory-mapped ULog file, indexed on open """
+
+    def __init__(self, file_name, library=None):
+        self._lib = _load_library(library or os.environ.get('ULOG_READER_LIB', _DEFAULT_LIBRARY))
+        self._handle = self._lib.ulog_reader_open(file_name.encode())
+
+        if not self._handle:
+            raise IOError('failed to open ' + file_name)
+
+    def close(self):
+        if self._handle:
+            self._lib.ulog_reader_close(self._handle)
+            self._handle = None
+
+    def __del__(self):
+        self.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    @property
+    def start_timestamp(self):
+        return self._lib.ulog_reader_start_timestamp(self._handle)
+
+    def topics(self):
+        """ list of (name, multi_id, number of samples) """
+        return [(self._lib.ulog_reader_subscription_name(self._handle, i).decode(),
+                 self._lib.ulog_reader_subscription_multi_id(self._handle, i),
+                 self._lib.ulog_reader_subscription_num_samples(self._handle, i))
+                for i in range(self._lib.ulog_reader_num_subscriptions(self._handle))]
+
+    def fields(self, format_name, prefix=''):
+        """ all basic (flattened) fields of a format, padding excluded """
+        definition = self._lib.ulog_reader_format(self._handle, format_name.encode())
+
+        if definition is None:
+            raise KeyError(format_name)
+
+        result = []
+
+        for field in definition.decode().split(';'):
+            if ' ' not in field:
+                continue
+
+            type_name, name = field.split(' ', 1)
+
+            if name.startswith('_padding'):
+                continue
+
+            array_size = 1
+
+            if '[' in type_name:
+                type_name, array_size = type_name[:-1].split('[')
+                array_size = int(array_size)
+
+            names = [prefix + name] if array_size == 1 else \
+                ['{:}{:}[{:}]'.format(prefix, name, i) for i in range(array_size)]
+
+            for n in names:
+                if type_name in _BASIC_TYPES:
+                    result.append(n)
+                else:
+                    result.extend(self.fields(type_name, n + '.'))
+
+        return result
+
+    def extract(self, message_name, fields=None, multi_id=0, num_threads=0):
+        """ decode fields (default: all) of a topic into a dict of numpy float64 arrays """
+        index = self._lib.ulog_reader_find_subscription(self._handle, message_name.encode(), multi_id)
+
+        if index < 0:
+            raise KeyError('{:} (instance {:})'.format(message_name, multi_id))
+
+        if fields is None:
+            fields = self.fields(message_name)
+
+        num_samples = self._lib.ulog_reader_subscription_num_samples(self._handle, index)
+        columns = [np.empty(num_samples, dtype=np.float64) for _ in fields]
+
+        c_fields = (ctypes.c_char_p * len(fields))(*[f.encode() for f in fields])
+        c_columns = (ctypes.POINTER(ctypes.c_double) * len(fields))(
+            *[c.ctypes.data_as(ctypes.POINTER(ctypes.c_double)) for c in columns])
+
+        if self._lib.ulog_reader_extract(self._handle, index, c_fields, len(fields), c_columns, num_threads) < 0:
+            raise KeyError('unknown field in ' + ', '.join(fields))
+
+        return dict(zip(fields, columns))
+
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description="""List the topics of a ULog file or export one as CSV""")
+    parser.add_argument("ulog_file", help="ULog file")
+    parser.add_argument("-t", "--topic", help="topic to export", default=None)
+    parser.add_argument("-m", "--multi-id", help="topic instance", type=int, default=0)
+    parser.add_argument("-f", "--fields", help="comma separated fields to export (default: all)", default=None)
+    parser.add_argument("-o", "--output", help="output CSV file (default: stdout)", default=None)
+    parser.add_argument("-j", "--threads", help="number of decoding threads (default: all cores)", type=int, default=0)
+
+    args = parser.parse_args()
+
+    with ULogReader(args.ulog_file) as reader:
+        if not args.topic:
+            for name, multi_id, num_samples in reader.topics():
+                print('{:40s} {:3d} {:10d}'.format(name, multi_id, num_samples))
+            sys.exit(0)
+
+        fields = args.fields.split(',') if args.fields else None
+        data = reader.extract(args.topic, fields, args.multi_id, args.threads)
+
+        np.savetxt(args.output or sys.stdout, np.column_stack(list(data.values())), delimiter=',',
+                   header=','.join(data.keys()), comments='', fmt='%.17g')
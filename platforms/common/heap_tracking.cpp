@@ -0,0 +1,197 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file heap_tracking.cpp
+ *
+ * Replacement of the global operator new and delete charging every allocation to an owner.
+ */
+
+#include <px4_platform_common/defines.h>
+
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/heap_tracking.h>
+
+#include <new>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace px4
+{
+namespace heap_tracking
+{
+
+struct Owner {
+	px4::atomic<const char *> name{nullptr};
+	px4::atomic<int32_t> allocated{0};
+	px4::atomic<int32_t> peak{0};
+	px4::atomic<int32_t> count{0};
+};
+
+// stored in front of every allocation, keeps the alignment of malloc
+struct alignas(alignof(max_align_t)) AllocationHeader {
+	uint32_t size;
+	int32_t owner;
+};
+
+static Owner owners[MAX_OWNERS];
+
+static pthread_key_t owner_key;
+static pthread_once_t owner_key_once = PTHREAD_ONCE_INIT;
+static px4::atomic<bool> owner_key_valid{false};
+
+static void create_owner_key()
+{
+	// the thread value is the owner index + 1, so that the initial value (nullptr) is OWNER_OTHER
+	if (pthread_key_create(&owner_key, nullptr) == 0) {
+		owner_key_valid.store(true);
+	}
+}
+
+static int current_owner()
+{
+	if (!owner_key_valid.load()) {
+		return OWNER_OTHER;
+	}
+
+	const intptr_t value = (intptr_t)pthread_getspecific(owner_key);
+	return (value > 0) ? (int)(value - 1) : OWNER_OTHER;
+}
+
+int owner_index(const char *name)
+{
+	if (name == nullptr) {
+		return OWNER_OTHER;
+	}
+
+	for (int i = OWNER_OTHER + 1; i < MAX_OWNERS; i++) {
+		const char *owner_name = owners[i].name.load();
+
+		if ((owner_name == nullptr) && owners[i].name.compare_exchange(&owner_name, name)) {
+			return i;
+		}
+
+		// owner_name is set now, either by the load or by the failed exchange
+		if (strcmp(owner_name, name) == 0) {
+			return i;
+		}
+	}
+
+	return OWNER_OTHER;
+}
+
+int set_owner(int index)
+{
+	pthread_once(&owner_key_once, create_owner_key);
+
+	const int previous = current_owner();
+
+	if (owner_key_valid.load() && (index >= 0) && (index < MAX_OWNERS)) {
+		pthread_setspecific(owner_key, (void *)(intptr_t)(index + 1));
+	}
+
+	return previous;
+}
+
+bool get_usage(int index, OwnerUsage &usage)
+{
+	if ((index < 0) || (index >= MAX_OWNERS)) {
+		return false;
+	}
+
+	const Owner &owner = owners[index];
+	usage.name = (index == OWNER_OTHER) ? "other" : owner.name.load();
+	usage.allocated = owner.allocated.load();
+	usage.peak = owner.peak.load();
+	usage.count = owner.count.load();
+
+	return usage.name != nullptr;
+}
+
+static void *allocate(size_t size)
+{
+	AllocationHeader *header = static_cast<AllocationHeader *>(malloc(sizeof(AllocationHeader) + size));
+
+	if (header == nullptr) {
+		return nullptr;
+	}
+
+	header->size = size;
+	header->owner = current_owner();
+
+	Owner &owner = owners[header->owner];
+	owner.count.fetch_add(1);
+	const int32_t allocated = owner.allocated.fetch_add(size) + size;
+	int32_t peak = owner.peak.load();
+
+	while ((allocated > peak) && !owner.peak.compare_exchange(&peak, allocated)) {}
+
+	return header + 1;
+}
+
+static void deallocate(void *ptr)
+{
+	if (ptr == nullptr) {
+		return;
+	}
+
+	AllocationHeader *header = static_cast<AllocationHeader *>(ptr) - 1;
+
+	Owner &owner = owners[header->owner];
+	owner.count.fetch_sub(1);
+	owner.allocated.fetch_sub(header->size);
+
+	free(header);
+}
+
+} // namespace heap_tracking
+} // namespace px4
+
+// like the NuttX C++ library, return nullptr instead of throwing std::bad_alloc
+void *operator new(size_t size) { return px4::heap_tracking::allocate(size); }
+void *operator new[](size_t size) { return px4::heap_tracking::allocate(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return px4::heap_tracking::allocate(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return px4::heap_tracking::allocate(size); }
+
+void operator delete(void *ptr) noexcept { px4::heap_tracking::deallocate(ptr); }
+void operator delete[](void *ptr) noexcept { px4::heap_tracking::deallocate(ptr); }
+void operator delete(void *ptr, size_t) noexcept { px4::heap_tracking::deallocate(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { px4::heap_tracking::deallocate(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { px4::heap_tracking::deallocate(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { px4::heap_tracking::deallocate(ptr); }
+
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
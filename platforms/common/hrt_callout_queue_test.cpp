@@ -0,0 +1,158 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file hrt_callout_queue_test.cpp
+ *
+ * Unit test of the HRT callout queue (pairing heap), compared against a sorted list.
+ */
+
+#include <gtest/gtest.h>
+#include <px4_platform_common/hrt_callout_queue.h>
+
+#include <algorithm>
+#include <list>
+#include <random>
+
+namespace
+{
+
+// reference: sorted by deadline, calls of equal deadline in insertion order
+void reference_insert(std::list<hrt_call *> &list, hrt_call *entry)
+{
+	list.remove(entry);
+	auto it = std::find_if(list.begin(), list.end(), [entry](hrt_call * call) { return entry->deadline < call->deadline; });
+	list.insert(it, entry);
+}
+
+} // namespace
+
+TEST(HrtCalloutQueueTest, Empty)
+{
+	hrt_callout_queue queue;
+	hrt_callout_queue_init(&queue);
+
+	hrt_call call{};
+	EXPECT_EQ(hrt_callout_queue_peek(&queue), nullptr);
+	EXPECT_EQ(hrt_callout_queue_pop(&queue), nullptr);
+	EXPECT_FALSE(hrt_callout_queue_contains(&queue, &call));
+
+	// removing an entry that is not queued does nothing
+	hrt_callout_queue_remove(&queue, &call);
+	EXPECT_EQ(hrt_callout_queue_peek(&queue), nullptr);
+}
+
+TEST(HrtCalloutQueueTest, EqualDeadlinesInInsertionOrder)
+{
+	hrt_callout_queue queue;
+	hrt_callout_queue_init(&queue);
+
+	hrt_call calls[5] {};
+
+	for (hrt_call &call : calls) {
+		call.deadline = 100;
+		hrt_callout_queue_insert(&queue, &call);
+	}
+
+	for (hrt_call &call : calls) {
+		EXPECT_EQ(hrt_callout_queue_pop(&queue), &call);
+		EXPECT_FALSE(hrt_callout_queue_contains(&queue, &call));
+	}
+
+	EXPECT_EQ(hrt_callout_queue_pop(&queue), nullptr);
+}
+
+TEST(HrtCalloutQueueTest, RandomOperations)
+{
+	static constexpr int CALLS = 64;
+
+	hrt_callout_queue queue;
+	hrt_callout_queue_init(&queue);
+
+	hrt_call calls[CALLS] {};
+	std::list<hrt_call *> reference;
+
+	std::mt19937 generator(1);
+	std::uniform_int_distribution<int> operation(0, 9);
+	std::uniform_int_distribution<int> index(0, CALLS - 1);
+	std::uniform_int_distribution<int> deadline(0, 200); // small range for many equal deadlines
+
+	for (int i = 0; i < 20000; i++) {
+		hrt_call *call = &calls[index(generator)];
+
+		switch (operation(generator)) {
+		case 0:
+		case 1:
+		case 2:
+		case 3:
+		case 4: // insert or move
+			call->deadline = deadline(generator);
+			hrt_callout_queue_insert(&queue, call);
+			reference_insert(reference, call);
+			break;
+
+		case 5:
+		case 6: // remove (may be queued or not)
+			hrt_callout_queue_remove(&queue, call);
+			reference.remove(call);
+			break;
+
+		default: { // pop
+				hrt_call *first = hrt_callout_queue_pop(&queue);
+
+				if (reference.empty()) {
+					ASSERT_EQ(first, nullptr);
+
+				} else {
+					ASSERT_EQ(first, reference.front());
+					reference.pop_front();
+				}
+			}
+			break;
+		}
+
+		ASSERT_EQ(hrt_callout_queue_peek(&queue), reference.empty() ? nullptr : reference.front());
+
+		for (hrt_call &c : calls) {
+			ASSERT_EQ(hrt_callout_queue_contains(&queue, &c), std::find(reference.begin(), reference.end(), &c) != reference.end());
+		}
+	}
+
+	// drain in order
+	while (!reference.empty()) {
+		ASSERT_EQ(hrt_callout_queue_pop(&queue), reference.front());
+		reference.pop_front();
+	}
+
+	EXPECT_EQ(hrt_callout_queue_peek(&queue), nullptr);
+}
@@ -60,6 +60,69 @@ bool px4_i2c_device_external(const uint32_t device_id)
 }
 #endif // BOARD_OVERRIDE_I2C_DEVICE_EXTERNAL
 
+#if defined(CONFIG_I2C_BUS_STATISTICS)
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/log.h>
+
+// the transfers of a bus are serialized by its work queue, the counters are only used for diagnostics
+struct i2c_bus_statistics_s {
+	hrt_abstime time_first{0};
+	uint64_t busy_us{0};
+	uint64_t bytes{0};
+	uint32_t transfers{0};
+	uint32_t errors{0};
+	uint32_t duration_max_us{0};
+};
+
+static i2c_bus_statistics_s i2c_bus_statistics[PX4_NUMBER_I2C_BUSES] {};
+
+void px4_i2c_bus_statistics_update(int bus, uint32_t duration_us, unsigned bytes, bool failed)
+{
+	if ((bus < 1) || (bus > PX4_NUMBER_I2C_BUSES)) {
+		return;
+	}
+
+	i2c_bus_statistics_s &statistics = i2c_bus_statistics[bus - 1];
+
+	if (statistics.time_first == 0) {
+		statistics.time_first = hrt_absolute_time() - duration_us;
+	}
+
+	statistics.busy_us += duration_us;
+	statistics.bytes += bytes;
+	statistics.transfers++;
+
+	if (failed) {
+		statistics.errors++;
+	}
+
+	if (duration_us > statistics.duration_max_us) {
+		statistics.duration_max_us = duration_us;
+	}
+}
+
+void px4_i2c_bus_statistics_print(int bus)
+{
+	if ((bus < 1) || (bus > PX4_NUMBER_I2C_BUSES)) {
+		return;
+	}
+
+	const i2c_bus_statistics_s statistics = i2c_bus_statistics[bus - 1];
+
+	if (statistics.transfers == 0) {
+		PX4_INFO("I2C bus %d: no transfers", bus);
+		return;
+	}
+
+	const float elapsed_us = hrt_elapsed_time(&statistics.time_first);
+	const float busy_percent = (elapsed_us > 0.f) ? 100.f * statistics.busy_us / elapsed_us : 0.f;
+
+	PX4_INFO("I2C bus %d: %.1f%% busy, %" PRIu32 " transfers (%.1f/s), %" PRIu32 " errors, %" PRIu64 " bytes, transfer mean %.0f us, max %" PRIu32 " us",
+		 bus, (double)busy_percent, statistics.transfers, (double)(statistics.transfers / (elapsed_us * 1e-6f)),
+		 statistics.errors, statistics.bytes, (double)statistics.busy_us / statistics.transfers, statistics.duration_max_us);
+}
+#endif // CONFIG_I2C_BUS_STATISTICS
+
 bool I2CBusIterator::next()
 {
 	while (++_index < I2C_BUS_MAX_BUS_ITEMS && px4_i2c_buses[_index].bus != -1) {
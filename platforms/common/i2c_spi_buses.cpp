@@ -600,6 +600,104 @@ static void initializer_trampoline(void *argument)
 	data->instance = data->instantiate(data->config, data->runtime_instance);
 }
 
+/**
+ * Instantiation of a driver on one bus position: initializes the object and bus on the work queue
+ * thread of the bus, which will also probe for the device.
+ */
+struct I2CSPIDriverProbe {
+	I2CSPIDriverProbe(const BusCLIArguments &cli, const BusInstanceIterator &iterator, const px4::wq_config_t &wq_config,
+			  I2CSPIDriverBase::instantiate_method instantiate, int runtime_instance)
+		: config{cli, iterator, wq_config},
+		  initializer_data{config, instantiate, runtime_instance},
+		  initializer(wq_config, initializer_trampoline, &initializer_data),
+		  external(iterator.external()),
+		  external_bus_index(iterator.externalBusIndex()),
+		  devid(iterator.devid())
+	{
+		initializer.ScheduleNow();
+	}
+
+	I2CSPIDriverConfig config;
+	I2CSPIDriverInitializing initializer_data;
+	px4::WorkItemSingleShot initializer;
+	const bool external;
+	const int external_bus_index;
+	const uint32_t devid;
+};
+
+/**
+ * Wait for a probe to finish and register the instance if the device was found.
+ * @return true if an instance was started
+ */
+bool I2CSPIDriverBase::finish_probe(I2CSPIDriverProbe &probe, const BusCLIArguments &cli, BusInstanceIterator &iterator)
+{
+	probe.initializer.wait();
+	I2CSPIDriverBase *instance = probe.initializer_data.instance;
+
+	if (!instance) {
+		PX4_DEBUG("instantiate failed (no device on bus %i (devid 0x%" PRIx32 ")?)", probe.config.bus, probe.devid);
+		return false;
+	}
+
+#if defined(CONFIG_I2C)
+
+	if (cli.i2c_address != 0 && instance->_i2c_address == 0) {
+		PX4_ERR("Bug: driver %s does not pass the I2C address to I2CSPIDriverBase", instance->ItemName());
+	}
+
+#endif // CONFIG_I2C
+
+	const int runtime_instance = iterator.runningInstancesCount();
+	iterator.addInstance(instance);
+
+	// print some info that we are running
+	switch (probe.config.bus_type) {
+#if defined(CONFIG_I2C)
+
+	case BOARD_I2C_BUS:
+		PX4_INFO_RAW("%s #%i on I2C bus %d", instance->ItemName(), runtime_instance, probe.config.bus);
+
+		if (probe.external) {
+			PX4_INFO_RAW(" (external)");
+		}
+
+		if (cli.i2c_address != 0) {
+			PX4_INFO_RAW(" address 0x%X", cli.i2c_address);
+		}
+
+		if (cli.rotation != 0) {
+			PX4_INFO_RAW(" rotation %d", cli.rotation);
+		}
+
+		PX4_INFO_RAW("\n");
+
+		break;
+#endif // CONFIG_I2C
+#if defined(CONFIG_SPI)
+
+	case BOARD_SPI_BUS:
+		PX4_INFO_RAW("%s #%i on SPI bus %d", instance->ItemName(), runtime_instance, probe.config.bus);
+
+		if (probe.external) {
+			PX4_INFO_RAW(" (external, equal to '-b %i')", probe.external_bus_index);
+		}
+
+		if (cli.rotation != 0) {
+			PX4_INFO_RAW(" rotation %d", cli.rotation);
+		}
+
+		PX4_INFO_RAW("\n");
+
+		break;
+#endif // CONFIG_SPI
+
+	case BOARD_INVALID_BUS:
+		break;
+	}
+
+	return true;
+}
+
 int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterator &iterator,
 				   void(*print_usage)(), instantiate_method instantiate)
 {
@@ -611,6 +709,13 @@ int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterat
 
 	bool started = false;
 
+#if defined(CONFIG_I2CSPI_PARALLEL_PROBE)
+	// probe all matching bus positions at once, each on the work queue of its bus, so the probe
+	// timeouts and retries of the buses without a device overlap instead of adding up
+	I2CSPIDriverProbe *probes[CONFIG_I2CSPI_PARALLEL_PROBE_MAX] {};
+	int num_probes = 0;
+#endif // CONFIG_I2CSPI_PARALLEL_PROBE
+
 	while (iterator.next()) {
 		if (iterator.instance()) {
 			PX4_WARN("Already running on bus %i", iterator.bus());
@@ -637,77 +742,40 @@ int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterat
 
 
 		const px4::wq_config_t &wq_config = px4::device_bus_to_wq(device_id.devid);
-		I2CSPIDriverConfig driver_config{cli, iterator, wq_config};
-		const int runtime_instance = iterator.runningInstancesCount();
-		I2CSPIDriverInitializing initializer_data{driver_config, instantiate, runtime_instance};
-		// initialize the object and bus on the work queue thread - this will also probe for the device
-		px4::WorkItemSingleShot initializer(wq_config, initializer_trampoline, &initializer_data);
-		initializer.ScheduleNow();
-		initializer.wait();
-		I2CSPIDriverBase *instance = initializer_data.instance;
-
-		if (!instance) {
-			PX4_DEBUG("instantiate failed (no device on bus %i (devid 0x%x)?)", iterator.bus(), iterator.devid());
-			continue;
-		}
-
-#if defined(CONFIG_I2C)
-
-		if (cli.i2c_address != 0 && instance->_i2c_address == 0) {
-			PX4_ERR("Bug: driver %s does not pass the I2C address to I2CSPIDriverBase", instance->ItemName());
-		}
-
-#endif // CONFIG_I2C
-
-		iterator.addInstance(instance);
-		started = true;
-
-		// print some info that we are running
-		switch (iterator.busType()) {
-#if defined(CONFIG_I2C)
-
-		case BOARD_I2C_BUS:
-			PX4_INFO_RAW("%s #%i on I2C bus %d", instance->ItemName(), runtime_instance, iterator.bus());
 
-			if (iterator.external()) {
-				PX4_INFO_RAW(" (external)");
-			}
-
-			if (cli.i2c_address != 0) {
-				PX4_INFO_RAW(" address 0x%X", cli.i2c_address);
-			}
-
-			if (cli.rotation != 0) {
-				PX4_INFO_RAW(" rotation %d", cli.rotation);
-			}
-
-			PX4_INFO_RAW("\n");
+#if defined(CONFIG_I2CSPI_PARALLEL_PROBE)
+		const int runtime_instance = iterator.runningInstancesCount() + num_probes;
+		probes[num_probes] = new I2CSPIDriverProbe(cli, iterator, wq_config, instantiate, runtime_instance);
 
+		if (probes[num_probes] == nullptr) {
+			PX4_ERR("alloc failed");
 			break;
-#endif // CONFIG_I2C
-#if defined(CONFIG_SPI)
-
-		case BOARD_SPI_BUS:
-			PX4_INFO_RAW("%s #%i on SPI bus %d", instance->ItemName(), runtime_instance, iterator.bus());
+		}
 
-			if (iterator.external()) {
-				PX4_INFO_RAW(" (external, equal to '-b %i')", iterator.externalBusIndex());
+		if (++num_probes == CONFIG_I2CSPI_PARALLEL_PROBE_MAX) {
+			for (int i = 0; i < num_probes; i++) {
+				started |= finish_probe(*probes[i], cli, iterator);
+				delete probes[i];
 			}
 
-			if (cli.rotation != 0) {
-				PX4_INFO_RAW(" rotation %d", cli.rotation);
-			}
+			num_probes = 0;
+		}
 
-			PX4_INFO_RAW("\n");
+#else
+		I2CSPIDriverProbe probe{cli, iterator, wq_config, instantiate, iterator.runningInstancesCount()};
+		started |= finish_probe(probe, cli, iterator);
+#endif // CONFIG_I2CSPI_PARALLEL_PROBE
+	}
 
-			break;
-#endif // CONFIG_SPI
+#if defined(CONFIG_I2CSPI_PARALLEL_PROBE)
 
-		case BOARD_INVALID_BUS:
-			break;
-		}
+	for (int i = 0; i < num_probes; i++) {
+		started |= finish_probe(*probes[i], cli, iterator);
+		delete probes[i];
 	}
 
+#endif // CONFIG_I2CSPI_PARALLEL_PROBE
+
 	if (!started && !cli.quiet_start) {
 		static constexpr char no_instance_started[] {"no instance started (no device on bus?)"};
 
@@ -811,6 +879,9 @@ void I2CSPIDriverBase::print_status()
 
 	if (_bus_option == I2CSPIBusOption::I2CExternal || _bus_option == I2CSPIBusOption::I2CInternal) {
 		PX4_INFO("Running on I2C Bus %i, Address 0x%02X", _bus, get_i2c_address());
+#if defined(CONFIG_I2C_BUS_STATISTICS)
+		px4_i2c_bus_statistics_print(_bus);
+#endif // CONFIG_I2C_BUS_STATISTICS
 		return;
 	}
 
@@ -95,6 +95,32 @@ constexpr unsigned sizeofArguments(const T &t, const Args &... args)
  */
 void send(EventType &event);
 
+/**
+ * Length of the event uORB queue (rounded up to a power of 2 by uORB)
+ */
+#if defined(CONFIG_EVENTS_QUEUE_LENGTH)
+static constexpr uint8_t queue_length = CONFIG_EVENTS_QUEUE_LENGTH;
+#else
+static constexpr uint8_t queue_length = EventType::ORB_QUEUE_LENGTH;
+#endif
+
+/**
+ * Publish several events in a row, taking the publication lock only once.
+ * The events get consecutive sequence numbers. No other events::send() call is
+ * allowed from within the scope of a Batch.
+ */
+class Batch
+{
+public:
+	Batch();
+	~Batch();
+
+	Batch(const Batch &) = delete;
+	Batch &operator=(const Batch &) = delete;
+
+	void send(EventType &event);
+};
+
 /**
  * Generate event ID from an event name
  */
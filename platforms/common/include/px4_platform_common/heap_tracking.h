@@ -0,0 +1,99 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file heap_tracking.h
+ *
+ * Attribution of C++ heap allocations (operator new/delete) to owners, typically modules and WorkItems
+ * (requires CONFIG_SYSTEM_HEAP_TRACKING).
+ *
+ * Every allocation is charged to the current owner of the calling thread and the owner is stored with the
+ * allocation, so the memory is credited back correctly no matter which thread deletes it. Allocations
+ * without owner and those beyond MAX_OWNERS are charged to OWNER_OTHER. C allocations (malloc) are not tracked.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace px4
+{
+namespace heap_tracking
+{
+
+static constexpr int MAX_OWNERS = 48;
+static constexpr int OWNER_OTHER = 0;
+
+struct OwnerUsage {
+	const char *name;
+	int32_t allocated;	///< bytes currently allocated
+	int32_t peak;		///< maximum of allocated
+	int32_t count;		///< number of current allocations
+};
+
+/**
+ * Find or add the owner with the given name.
+ * @return owner index, OWNER_OTHER if the table is full
+ */
+int owner_index(const char *name);
+
+/**
+ * Set the owner of the following allocations of the calling thread.
+ * @return previous owner of the calling thread
+ */
+int set_owner(int index);
+
+/**
+ * Get the usage of an owner.
+ * @return false if index is out of range or not in use
+ */
+bool get_usage(int index, OwnerUsage &usage);
+
+/**
+ * Set the owner of the calling thread for the lifetime of the object.
+ */
+class ScopedOwner
+{
+public:
+	explicit ScopedOwner(int index) : _previous(set_owner(index)) {}
+	~ScopedOwner() { set_owner(_previous); }
+
+	ScopedOwner(const ScopedOwner &) = delete;
+	ScopedOwner &operator=(const ScopedOwner &) = delete;
+
+private:
+	const int _previous;
+};
+
+} // namespace heap_tracking
+} // namespace px4
@@ -0,0 +1,206 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file hrt_callout_queue.h
+ *
+ * Callout queue of the HRT drivers: a pairing heap ordered by deadline, with the calls of equal deadline in
+ * insertion order (the same order as the previous sorted list).
+ * Insert and peek are O(1), removing the first or any other entry is O(log n) amortized.
+ *
+ * Not thread-safe, the caller holds the HRT lock or has interrupts disabled.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct hrt_callout_queue {
+	struct hrt_call	*root;
+	uint32_t	seq;	/**< insertion counter, orders calls of equal deadline */
+};
+
+static inline void hrt_callout_queue_init(struct hrt_callout_queue *queue)
+{
+	queue->root = NULL;
+	queue->seq = 0;
+}
+
+static inline struct hrt_call *hrt_callout_queue_peek(const struct hrt_callout_queue *queue)
+{
+	return queue->root;
+}
+
+static inline bool hrt_callout_queue_contains(const struct hrt_callout_queue *queue, const struct hrt_call *entry)
+{
+	return (entry == queue->root) || (entry->heap_prev != NULL);
+}
+
+static inline bool hrt_callout_queue_before(const struct hrt_call *a, const struct hrt_call *b)
+{
+	return (a->deadline < b->deadline) || ((a->deadline == b->deadline) && ((int32_t)(a->heap_seq - b->heap_seq) < 0));
+}
+
+/* meld two heaps (roots without siblings) */
+static inline struct hrt_call *hrt_callout_queue_meld(struct hrt_call *a, struct hrt_call *b)
+{
+	if (a == NULL) {
+		return b;
+	}
+
+	if (b == NULL) {
+		return a;
+	}
+
+	if (hrt_callout_queue_before(b, a)) {
+		struct hrt_call *tmp = a;
+		a = b;
+		b = tmp;
+	}
+
+	/* b becomes the first child of a */
+	b->heap_sibling = a->heap_child;
+
+	if (a->heap_child != NULL) {
+		a->heap_child->heap_prev = b;
+	}
+
+	b->heap_prev = a;
+	a->heap_child = b;
+
+	return a;
+}
+
+/* combine a list of siblings into one heap (two pass pairing, without recursion) */
+static inline struct hrt_call *hrt_callout_queue_merge_pairs(struct hrt_call *first)
+{
+	struct hrt_call *pairs = NULL;
+
+	/* first pass: meld pairs left to right, collect them in reverse order */
+	while (first != NULL) {
+		struct hrt_call *a = first;
+		struct hrt_call *b = a->heap_sibling;
+		first = (b != NULL) ? b->heap_sibling : NULL;
+
+		a->heap_sibling = NULL;
+		a->heap_prev = NULL;
+
+		if (b != NULL) {
+			b->heap_sibling = NULL;
+			b->heap_prev = NULL;
+		}
+
+		a = hrt_callout_queue_meld(a, b);
+		a->heap_sibling = pairs;
+		pairs = a;
+	}
+
+	/* second pass: meld the pairs right to left */
+	struct hrt_call *result = NULL;
+
+	while (pairs != NULL) {
+		struct hrt_call *next = pairs->heap_sibling;
+		pairs->heap_sibling = NULL;
+		result = hrt_callout_queue_meld(result, pairs);
+		pairs = next;
+	}
+
+	return result;
+}
+
+/**
+ * Remove an entry, does nothing if it is not queued.
+ */
+static inline void hrt_callout_queue_remove(struct hrt_callout_queue *queue, struct hrt_call *entry)
+{
+	if (!hrt_callout_queue_contains(queue, entry)) {
+		return;
+	}
+
+	struct hrt_call *children = hrt_callout_queue_merge_pairs(entry->heap_child);
+
+	if (entry == queue->root) {
+		queue->root = children;
+
+	} else {
+		/* unlink from the parent (if first child) or the previous sibling */
+		if (entry->heap_prev->heap_child == entry) {
+			entry->heap_prev->heap_child = entry->heap_sibling;
+
+		} else {
+			entry->heap_prev->heap_sibling = entry->heap_sibling;
+		}
+
+		if (entry->heap_sibling != NULL) {
+			entry->heap_sibling->heap_prev = entry->heap_prev;
+		}
+
+		queue->root = hrt_callout_queue_meld(queue->root, children);
+	}
+
+	entry->heap_child = NULL;
+	entry->heap_sibling = NULL;
+	entry->heap_prev = NULL;
+}
+
+/**
+ * Insert an entry by its deadline, an entry already queued is moved.
+ */
+static inline void hrt_callout_queue_insert(struct hrt_callout_queue *queue, struct hrt_call *entry)
+{
+	hrt_callout_queue_remove(queue, entry);
+
+	entry->heap_seq = queue->seq++;
+	entry->heap_child = NULL;
+	entry->heap_sibling = NULL;
+	entry->heap_prev = NULL;
+
+	queue->root = hrt_callout_queue_meld(queue->root, entry);
+}
+
+/**
+ * Remove and return the entry with the earliest deadline, NULL if empty.
+ */
+static inline struct hrt_call *hrt_callout_queue_pop(struct hrt_callout_queue *queue)
+{
+	struct hrt_call *first = queue->root;
+
+	if (first != NULL) {
+		hrt_callout_queue_remove(queue, first);
+	}
+
+	return first;
+}
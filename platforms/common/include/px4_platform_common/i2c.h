@@ -58,6 +58,23 @@ __EXPORT bool px4_i2c_bus_external(int bus);
  */
 __EXPORT bool px4_i2c_device_external(const uint32_t device_id);
 
+#if defined(CONFIG_I2C_BUS_STATISTICS)
+/**
+ * Account a transfer to the statistics of a bus (used by device::I2C).
+ * @param bus physical bus number (1, ...)
+ * @param duration_us time the transfer occupied the bus, including retries
+ * @param bytes number of bytes sent and received
+ * @param failed true if the transfer failed after all retries
+ */
+__EXPORT void px4_i2c_bus_statistics_update(int bus, uint32_t duration_us, unsigned bytes, bool failed);
+
+/**
+ * Print the utilization, transfer times and errors of a bus since the first transfer.
+ * @param bus physical bus number (1, ...)
+ */
+__EXPORT void px4_i2c_bus_statistics_print(int bus);
+#endif // CONFIG_I2C_BUS_STATISTICS
+
 /**
  * @class I2CBusIterator
  * Iterate over configured I2C buses by the board
@@ -70,6 +70,7 @@ enum class I2CSPIBusOption : uint8_t {
 
 class BusCLIArguments;
 class BusInstanceIterator;
+struct I2CSPIDriverProbe;
 
 struct I2CSPIDriverConfig {
 	I2CSPIDriverConfig(const BusCLIArguments &cli, const BusInstanceIterator &iterator,
@@ -314,6 +315,8 @@ protected:
 private:
 	static void custom_method_trampoline(void *argument);
 
+	static bool finish_probe(I2CSPIDriverProbe &probe, const BusCLIArguments &cli, BusInstanceIterator &iterator);
+
 	void request_stop_and_wait();
 
 	px4::atomic_bool _task_should_exit{false};
@@ -42,6 +42,7 @@
 #include <stdbool.h>
 
 #include <px4_platform_common/atomic.h>
+#include <px4_platform_common/heap_tracking.h>
 #include <px4_platform_common/time.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/tasks.h>
@@ -127,6 +128,11 @@ public:
 	 */
 	static int main(int argc, char *argv[])
 	{
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+		// charge the allocations of the commands (e.g. the object created by start) to the module
+		px4::heap_tracking::ScopedOwner heap_owner{px4::heap_tracking::owner_index(MODULE_NAME)};
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
+
 		if (argc <= 1 ||
 		    strcmp(argv[1], "-h")    == 0 ||
 		    strcmp(argv[1], "help")  == 0 ||
@@ -173,6 +179,10 @@ public:
 		argc -= 1;
 		argv += 1;
 
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+		px4::heap_tracking::set_owner(px4::heap_tracking::owner_index(MODULE_NAME));
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
+
 		T *object = T::instantiate(argc, argv);
 		_object.store(object);
 
@@ -37,6 +37,7 @@
 #include "WorkQueue.hpp"
 
 #include <containers/IntrusiveQueue.hpp>
+#include <containers/IntrusiveMPSCQueue.hpp>
 #include <containers/IntrusiveSortedList.hpp>
 #include <px4_platform_common/defines.h>
 #include <drivers/drv_hrt.h>
@@ -49,6 +50,9 @@ namespace px4
 {
 
 class WorkItem : public IntrusiveSortedListNode<WorkItem *>, public IntrusiveQueueNode<WorkItem *>
+#if defined(WORK_QUEUE_LOCKFREE_ADD)
+	, public IntrusiveMPSCQueueNode<WorkItem *>
+#endif // WORK_QUEUE_LOCKFREE_ADD
 {
 public:
 
@@ -70,6 +74,23 @@ public:
 		}
 	}
 
+	/**
+	 * Schedule the WorkItem to run directly after the WorkItem currently running on the calling
+	 * thread, ahead of the queue and without waking the worker thread again. Intended for
+	 * publications from a WorkItem of the same WorkQueue (requires CONFIG_WORK_QUEUE_CHAINING),
+	 * falls back to ScheduleNow() otherwise.
+	 */
+	inline void ScheduleChained()
+	{
+		if (_wq != nullptr) {
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+			_wq->Chain(this);
+#else
+			_wq->Add(this);
+#endif // CONFIG_WORK_QUEUE_CHAINING
+		}
+	}
+
 	virtual void print_run_status();
 
 	/**
@@ -95,6 +116,19 @@ protected:
 	 * Remove work item from the runnable queue, if it's there
 	 */
 	void ScheduleClear();
+
+	/**
+	 * Set a deadline for the runs of this item: a run should finish within deadline_us after
+	 * it was scheduled. Items with a deadline run in earliest deadline first order within their
+	 * WorkQueue and late runs are counted (requires CONFIG_WORK_QUEUE_DEADLINE, ignored otherwise).
+	 *
+	 * @param deadline_us relative deadline in microseconds, 0 to disable
+	 */
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+	void SetDeadline(uint32_t deadline_us) { _relative_deadline = deadline_us; }
+#else
+	void SetDeadline(uint32_t deadline_us) {}
+#endif // CONFIG_WORK_QUEUE_DEADLINE
 protected:
 
 	void RunPreamble()
@@ -108,7 +142,7 @@ protected:
 		}
 	}
 
-	friend void WorkQueue::Run();
+	friend class WorkQueue;
 	virtual void Run() = 0;
 
 	/**
@@ -130,6 +164,55 @@ protected:
 	const char 	*_item_name;
 	uint32_t	_run_count{0};
 
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+	/**
+	 * Record a run, called by the WorkQueue with the work lock held.
+	 * @param latency time from ScheduleNow() to the start of Run()
+	 * @param duration time spent in Run()
+	 */
+	void RecordRunTime(hrt_abstime latency, hrt_abstime duration);
+
+	/**
+	 * Copy and reset the profile, called by the WorkQueue with the work lock held.
+	 */
+	void GetProfile(work_item_profile_s &profile);
+
+	hrt_abstime	_time_queued{0};	// time of the first ScheduleNow() since the last run
+
+	uint32_t	_profile_run_count{0};
+	uint32_t	_latency_max_us{0};
+	uint32_t	_duration_max_us{0};
+	uint32_t	_latency_histogram[work_item_profile_s::HISTOGRAM_BUCKETS] {};
+	uint32_t	_duration_histogram[work_item_profile_s::HISTOGRAM_BUCKETS] {};
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+	/**
+	 * Record a run with a deadline, called by the WorkQueue with the work lock held.
+	 */
+	void RecordDeadline(hrt_abstime finished, hrt_abstime deadline);
+
+	/**
+	 * Copy and reset the deadline statistics, called by the WorkQueue with the work lock held.
+	 */
+	void GetDeadlineStatus(work_item_deadline_s &status);
+
+	hrt_abstime	_deadline{0};		// absolute deadline of the pending run
+	uint32_t	_relative_deadline{0};
+
+	uint32_t	_deadline_run_count{0};
+	uint32_t	_deadline_miss_count{0};
+	uint32_t	_lateness_max_us{0};
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
+#if defined(WORK_QUEUE_LOCKFREE_ADD)
+	px4::atomic_bool _queued{false};	// in the pending queue or the run queue of the WorkQueue
+#endif // WORK_QUEUE_LOCKFREE_ADD
+
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+	int		_heap_owner{-1};	// px4::heap_tracking owner index, looked up on the first run
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
+
 private:
 
 	WorkQueue	*_wq{nullptr};
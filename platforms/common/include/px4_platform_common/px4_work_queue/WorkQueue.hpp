@@ -38,11 +38,33 @@
 #include <containers/BlockingList.hpp>
 #include <containers/List.hpp>
 #include <containers/IntrusiveQueue.hpp>
+#include <containers/IntrusiveMPSCQueue.hpp>
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/sem.h>
 #include <px4_platform_common/tasks.h>
 
+#include <pthread.h>
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+#include <uORB/topics/work_item_profile.h>
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+#include <uORB/topics/work_item_deadline.h>
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
+// track the WorkItem run by each worker thread (pool mode and per run measurements)
+#if defined(CONFIG_WORK_QUEUE_POOL) || defined(CONFIG_WORK_QUEUE_PROFILER) || defined(CONFIG_WORK_QUEUE_DEADLINE) \
+	|| defined(CONFIG_WORK_QUEUE_CHAINING)
+#define WORK_QUEUE_TRACK_RUNNING
+#endif
+
+// Add() without the work lock, the lockstep scheduler registers the queue in Add()
+#if defined(CONFIG_WORK_QUEUE_LOCKFREE) && !defined(ENABLE_LOCKSTEP_SCHEDULER)
+#define WORK_QUEUE_LOCKFREE_ADD
+#endif
+
 namespace px4
 {
 
@@ -65,6 +87,14 @@ public:
 	void Add(WorkItem *item);
 	void Remove(WorkItem *item);
 
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+	/**
+	 * Run a WorkItem directly after the WorkItem running on the calling thread.
+	 * Falls back to Add() if the caller is not a worker thread of this queue.
+	 */
+	void Chain(WorkItem *item);
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
 	void Clear();
 
 	void Run();
@@ -73,6 +103,24 @@ public:
 
 	void print_status(bool last = false);
 
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+	/**
+	 * Get the profile of a WorkItem of this queue and reset it.
+	 * @param index index of the WorkItem, reduced by the number of WorkItems if out of range
+	 * @return false if index is out of range
+	 */
+	bool get_profile(unsigned &index, work_item_profile_s &profile);
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+	/**
+	 * Get the deadline statistics of a WorkItem of this queue and reset them.
+	 * @param index index of the WorkItem, reduced by the number of WorkItems if out of range
+	 * @return false if index is out of range
+	 */
+	bool get_deadline_status(unsigned &index, work_item_deadline_s &status);
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
 	// WorkQueues sorted numerically by relative priority (-1 to -255)
 	bool operator<=(const WorkQueue &rhs) const { return _config.relative_priority >= rhs.get_config().relative_priority; }
 
@@ -82,6 +130,19 @@ private:
 
 	inline void SignalWorkerThread();
 
+	// record the time a WorkItem is scheduled (profiler and deadline)
+	inline void stamp(WorkItem *item);
+
+	// queue a WorkItem, in earliest deadline first order if it has a deadline
+	inline void push(WorkItem *item);
+
+	// move the WorkItems added lock-free into _q, called with the work lock held
+	inline void collect();
+
+#if defined(CONFIG_WORK_QUEUE_POOL)
+	bool workers_idle() const;
+#endif // CONFIG_WORK_QUEUE_POOL
+
 #ifdef __PX4_NUTTX
 	// In NuttX work can be enqueued from an ISR
 	void work_lock() { _flags = enter_critical_section(); }
@@ -95,12 +156,35 @@ private:
 #endif
 
 	IntrusiveQueue<WorkItem *>	_q;
+#if defined(WORK_QUEUE_LOCKFREE_ADD)
+	IntrusiveMPSCQueue<WorkItem *>	_pending;
+#endif // WORK_QUEUE_LOCKFREE_ADD
 	px4_sem_t			_process_lock;
 	px4_sem_t			_exit_lock;
 	const wq_config_t		&_config;
 	BlockingList<WorkItem *>	_work_items;
 	px4::atomic_bool		_should_exit{false};
 
+#if defined(WORK_QUEUE_TRACK_RUNNING)
+	// WorkItem currently run by each worker thread
+	struct RunningItem {
+		WorkItem *item{nullptr};
+		bool requeue{false};	// added while running, queue again afterwards
+		bool detached{false};	// detached while running, the item might be deleted already
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+		WorkItem *chained{nullptr};	// run next, scheduled by the running item
+		pthread_t thread{};	// worker thread, valid while item is set
+#endif // CONFIG_WORK_QUEUE_CHAINING
+	};
+
+#if defined(CONFIG_WORK_QUEUE_POOL)
+	RunningItem			_running[CONFIG_WORK_QUEUE_POOL_THREADS] {};
+#else
+	RunningItem			_running[1] {};
+#endif // CONFIG_WORK_QUEUE_POOL
+	px4::atomic<int>		_worker_count{0};
+#endif // WORK_QUEUE_TRACK_RUNNING
+
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
 	int _lockstep_component {-1};
 #endif // ENABLE_LOCKSTEP_SCHEDULER
@@ -35,28 +35,46 @@
 
 #include <stdint.h>
 
+#include <px4_boardconfig.h>
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+#include <uORB/topics/work_item_profile.h>
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+#include <uORB/topics/work_item_deadline.h>
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
 namespace px4
 {
 
 class WorkQueue; // forward declaration
 
+// CPU set a work queue thread is pinned to (CONFIG_WORK_QUEUE_AFFINITY)
+enum class wq_cpus : uint8_t {
+	DEFAULT,	// CONFIG_WORK_QUEUE_CPUS_DEFAULT
+	ISOLATED,	// CONFIG_WORK_QUEUE_CPUS_ISOLATED, CONFIG_WORK_QUEUE_ISOLATED_SCHED_RR
+};
+
 struct wq_config_t {
 	const char *name;
 	uint16_t stacksize;
 	int8_t relative_priority; // relative to max
+	bool pool{false}; // independent WorkItems may run on several threads (CONFIG_WORK_QUEUE_POOL)
+	wq_cpus cpus{wq_cpus::DEFAULT};
 };
 
 namespace wq_configurations
 {
-static constexpr wq_config_t rate_ctrl{"wq:rate_ctrl", 3150, 0}; // PX4 inner loop highest priority
+static constexpr wq_config_t rate_ctrl{"wq:rate_ctrl", 3150, 0, false, wq_cpus::ISOLATED}; // PX4 inner loop highest priority
 
-static constexpr wq_config_t SPI0{"wq:SPI0", 2392, -1};
-static constexpr wq_config_t SPI1{"wq:SPI1", 2392, -2};
-static constexpr wq_config_t SPI2{"wq:SPI2", 2392, -3};
-static constexpr wq_config_t SPI3{"wq:SPI3", 2392, -4};
-static constexpr wq_config_t SPI4{"wq:SPI4", 2392, -5};
-static constexpr wq_config_t SPI5{"wq:SPI5", 2392, -6};
-static constexpr wq_config_t SPI6{"wq:SPI6", 2392, -7};
+static constexpr wq_config_t SPI0{"wq:SPI0", 2392, -1, false, wq_cpus::ISOLATED};
+static constexpr wq_config_t SPI1{"wq:SPI1", 2392, -2, false, wq_cpus::ISOLATED};
+static constexpr wq_config_t SPI2{"wq:SPI2", 2392, -3, false, wq_cpus::ISOLATED};
+static constexpr wq_config_t SPI3{"wq:SPI3", 2392, -4, false, wq_cpus::ISOLATED};
+static constexpr wq_config_t SPI4{"wq:SPI4", 2392, -5, false, wq_cpus::ISOLATED};
+static constexpr wq_config_t SPI5{"wq:SPI5", 2392, -6, false, wq_cpus::ISOLATED};
+static constexpr wq_config_t SPI6{"wq:SPI6", 2392, -7, false, wq_cpus::ISOLATED};
 
 static constexpr wq_config_t I2C0{"wq:I2C0", 2336, -8};
 static constexpr wq_config_t I2C1{"wq:I2C1", 2336, -9};
@@ -65,12 +83,13 @@ static constexpr wq_config_t I2C3{"wq:I2C3", 2336, -11};
 static constexpr wq_config_t I2C4{"wq:I2C4", 2336, -12};
 
 // PX4 att/pos controllers, highest priority after sensors.
-static constexpr wq_config_t nav_and_controllers{"wq:nav_and_controllers", 2240, -13};
+static constexpr wq_config_t nav_and_controllers{"wq:nav_and_controllers", 2240, -13, true};
 
-static constexpr wq_config_t INS0{"wq:INS0", 6000, -14};
-static constexpr wq_config_t INS1{"wq:INS1", 6000, -15};
-static constexpr wq_config_t INS2{"wq:INS2", 6000, -16};
-static constexpr wq_config_t INS3{"wq:INS3", 6000, -17};
+// INSx: one per IMU, the ekf2 instances of an IMU (one per magnetometer) may run in parallel
+static constexpr wq_config_t INS0{"wq:INS0", 6000, -14, true, wq_cpus::ISOLATED};
+static constexpr wq_config_t INS1{"wq:INS1", 6000, -15, true, wq_cpus::ISOLATED};
+static constexpr wq_config_t INS2{"wq:INS2", 6000, -16, true, wq_cpus::ISOLATED};
+static constexpr wq_config_t INS3{"wq:INS3", 6000, -17, true, wq_cpus::ISOLATED};
 
 static constexpr wq_config_t hp_default{"wq:hp_default", 2392, -18};
 
@@ -89,11 +108,18 @@ static constexpr wq_config_t ttyS9{"wq:ttyS9", 1728, -30};
 static constexpr wq_config_t ttyACM0{"wq:ttyACM0", 1728, -31};
 static constexpr wq_config_t ttyUnknown{"wq:ttyUnknown", 1728, -32};
 
-static constexpr wq_config_t lp_default{"wq:lp_default", 1920, -50};
+static constexpr wq_config_t lp_default{"wq:lp_default", 1920, -50, true};
+
+#if defined(CONFIG_WORK_QUEUE_SINGLE_THREAD)
+// all work queues (CONFIG_WORK_QUEUE_SINGLE_THREAD), stack of the largest queue
+static constexpr wq_config_t single{"wq:single", 6000, 0};
+#endif // CONFIG_WORK_QUEUE_SINGLE_THREAD
 
 static constexpr wq_config_t test1{"wq:test1", 2000, 0};
 static constexpr wq_config_t test2{"wq:test2", 2000, 0};
 
+static_assert(!rate_ctrl.pool, "the inner loop must stay serialized");
+
 } // namespace wq_configurations
 
 /**
@@ -137,5 +163,27 @@ const wq_config_t &serial_port_to_wq(const char *serial);
 
 const wq_config_t &ins_instance_to_wq(uint8_t instance);
 
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+/**
+ * Get the profile of the next WorkItem (see CONFIG_WORK_QUEUE_PROFILER) and reset it.
+ *
+ * @param index		Index of the WorkItem over all work queues, start with 0, incremented on success.
+ * @param profile	The profile (timestamp not set).
+ * @return		false if there are no more WorkItems, index is reset to 0.
+ */
+bool WorkQueueManagerGetNextProfile(unsigned &index, work_item_profile_s &profile);
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+/**
+ * Get the deadline statistics of the next WorkItem (see CONFIG_WORK_QUEUE_DEADLINE) and reset them.
+ *
+ * @param index		Index of the WorkItem over all work queues, start with 0, incremented on success.
+ * @param status	The statistics (timestamp not set), deadline_us is 0 for WorkItems without a deadline.
+ * @return		false if there are no more WorkItems, index is reset to 0.
+ */
+bool WorkQueueManagerGetNextDeadlineStatus(unsigned &index, work_item_deadline_s &status);
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
 
 } // namespace px4
@@ -132,6 +132,74 @@ float WorkItem::average_interval() const
 	return 0.f;
 }
 
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+// bucket i counts times < 16us * 4^i, the last bucket all the rest
+static unsigned histogram_bucket(hrt_abstime time_us)
+{
+	unsigned bucket = 0;
+
+	for (hrt_abstime limit = 16; (time_us >= limit) && (bucket < work_item_profile_s::HISTOGRAM_BUCKETS - 1); limit *= 4) {
+		bucket++;
+	}
+
+	return bucket;
+}
+
+void WorkItem::RecordRunTime(hrt_abstime latency, hrt_abstime duration)
+{
+	_profile_run_count++;
+
+	_latency_histogram[histogram_bucket(latency)]++;
+	_duration_histogram[histogram_bucket(duration)]++;
+
+	_latency_max_us = math::max(_latency_max_us, (uint32_t)math::min(latency, (hrt_abstime)UINT32_MAX));
+	_duration_max_us = math::max(_duration_max_us, (uint32_t)math::min(duration, (hrt_abstime)UINT32_MAX));
+}
+
+void WorkItem::GetProfile(work_item_profile_s &profile)
+{
+	strncpy(profile.item_name, _item_name, sizeof(profile.item_name) - 1);
+
+	profile.run_count = _profile_run_count;
+	profile.latency_max_us = _latency_max_us;
+	profile.duration_max_us = _duration_max_us;
+	memcpy(profile.latency_histogram, _latency_histogram, sizeof(profile.latency_histogram));
+	memcpy(profile.duration_histogram, _duration_histogram, sizeof(profile.duration_histogram));
+
+	_profile_run_count = 0;
+	_latency_max_us = 0;
+	_duration_max_us = 0;
+	memset(_latency_histogram, 0, sizeof(_latency_histogram));
+	memset(_duration_histogram, 0, sizeof(_duration_histogram));
+}
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+void WorkItem::RecordDeadline(hrt_abstime finished, hrt_abstime deadline)
+{
+	_deadline_run_count++;
+
+	if (finished > deadline) {
+		_deadline_miss_count++;
+		_lateness_max_us = math::max(_lateness_max_us, (uint32_t)math::min(finished - deadline, (hrt_abstime)UINT32_MAX));
+	}
+}
+
+void WorkItem::GetDeadlineStatus(work_item_deadline_s &status)
+{
+	strncpy(status.item_name, _item_name, sizeof(status.item_name) - 1);
+
+	status.deadline_us = _relative_deadline;
+	status.run_count = _deadline_run_count;
+	status.miss_count = _deadline_miss_count;
+	status.lateness_max_us = _lateness_max_us;
+
+	_deadline_run_count = 0;
+	_deadline_miss_count = 0;
+	_lateness_max_us = 0;
+}
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
 void WorkItem::print_run_status()
 {
 	PX4_INFO_RAW("%-29s %8.1f Hz %12.0f us\n", _item_name, (double)average_rate(), (double)average_interval());
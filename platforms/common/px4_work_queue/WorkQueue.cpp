@@ -36,6 +36,7 @@
 
 #include <string.h>
 
+#include <px4_platform_common/heap_tracking.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/time.h>
@@ -105,6 +106,16 @@ void WorkQueue::Detach(WorkItem *item)
 
 	_work_items.remove(item);
 
+#if defined(WORK_QUEUE_TRACK_RUNNING)
+
+	for (int i = 0; i < _worker_count.load(); i++) {
+		if (_running[i].item == item) {
+			_running[i].detached = true;
+		}
+	}
+
+#endif // WORK_QUEUE_TRACK_RUNNING
+
 	if (_work_items.size() == 0) {
 		// shutdown, no active WorkItems
 		PX4_DEBUG("stopping: %s, last active WorkItem closing", _config.name);
@@ -128,6 +139,18 @@ void WorkQueue::Detach(WorkItem *item)
 
 void WorkQueue::Add(WorkItem *item)
 {
+#if defined(WORK_QUEUE_LOCKFREE_ADD)
+
+	// only the first Add() since the last run queues the item
+	bool queued = false;
+
+	if (item->_queued.compare_exchange(&queued, true)) {
+		stamp(item);
+		_pending.push(item);
+	}
+
+	SignalWorkerThread();
+#else
 	work_lock();
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
@@ -138,10 +161,114 @@ void WorkQueue::Add(WorkItem *item)
 
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
-	_q.push(item);
+	stamp(item);
+
+#if defined(CONFIG_WORK_QUEUE_POOL)
+
+	// never run a WorkItem on two workers at once, defer until the current run finished
+	for (int i = 0; i < _worker_count.load(); i++) {
+		if (_running[i].item == item) {
+			_running[i].requeue = true;
+			work_unlock();
+			return;
+		}
+	}
+
+#endif // CONFIG_WORK_QUEUE_POOL
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+
+	// runs next already
+	for (int i = 0; i < _worker_count.load(); i++) {
+		if (_running[i].chained == item) {
+			work_unlock();
+			return;
+		}
+	}
+
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
+	push(item);
 	work_unlock();
 
 	SignalWorkerThread();
+#endif // WORK_QUEUE_LOCKFREE_ADD
+}
+
+void WorkQueue::stamp(WorkItem *item)
+{
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+
+	if (item->_time_queued == 0) {
+		item->_time_queued = hrt_absolute_time();
+	}
+
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+
+	if ((item->_deadline == 0) && (item->_relative_deadline != 0)) {
+		item->_deadline = hrt_absolute_time() + item->_relative_deadline;
+	}
+
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+}
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+void WorkQueue::Chain(WorkItem *item)
+{
+	work_lock();
+
+	RunningItem *caller = nullptr;
+
+	for (int i = 0; i < _worker_count.load(); i++) {
+		if (_running[i].item == item) {
+			// running already (on another worker in pool mode), requeue as usual
+			caller = nullptr;
+			break;
+
+		} else if ((_running[i].item != nullptr) && pthread_equal(_running[i].thread, pthread_self())) {
+			caller = &_running[i];
+		}
+	}
+
+	if ((caller == nullptr) || ((caller->chained != nullptr) && (caller->chained != item))) {
+		work_unlock();
+		Add(item);
+		return;
+	}
+
+	if (caller->chained == nullptr) {
+		// the worker runs it next, no need to signal
+		_q.remove(item);
+		stamp(item);
+		caller->chained = item;
+	}
+
+	work_unlock();
+}
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
+void WorkQueue::push(WorkItem *item)
+{
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+
+	if (item->_deadline != 0) {
+		// after all items with an earlier or equal deadline, before all items without a deadline
+		_q.push_sorted(item, [](WorkItem * a, WorkItem * b) { return (b->_deadline == 0) || (a->_deadline < b->_deadline); });
+		return;
+	}
+
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
+	_q.push(item);
+}
+
+void WorkQueue::collect()
+{
+#if defined(WORK_QUEUE_LOCKFREE_ADD)
+	_pending.pop_all([this](WorkItem * item) { _q.push(item); });
+#endif // WORK_QUEUE_LOCKFREE_ADD
 }
 
 void WorkQueue::SignalWorkerThread()
@@ -156,43 +283,248 @@ void WorkQueue::SignalWorkerThread()
 void WorkQueue::Remove(WorkItem *item)
 {
 	work_lock();
+	collect();
+
+#if defined(WORK_QUEUE_LOCKFREE_ADD)
+
+	// an item not in _q yet is still being added, it will run once
+	if (_q.remove(item)) {
+		item->_queued.store(false);
+	}
+
+#else
 	_q.remove(item);
+#endif // WORK_QUEUE_LOCKFREE_ADD
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+	item->_time_queued = 0;
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+	item->_deadline = 0;
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
+#if defined(CONFIG_WORK_QUEUE_POOL)
+
+	// the item might be destroyed from within its own Run()
+	for (int i = 0; i < _worker_count.load(); i++) {
+		if (_running[i].item == item) {
+			_running[i].requeue = false;
+		}
+	}
+
+#endif // CONFIG_WORK_QUEUE_POOL
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+
+	for (int i = 0; i < _worker_count.load(); i++) {
+		if (_running[i].chained == item) {
+			_running[i].chained = nullptr;
+		}
+	}
+
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
 	work_unlock();
 }
 
 void WorkQueue::Clear()
 {
 	work_lock();
+	collect();
 
 	while (!_q.empty()) {
+#if defined(CONFIG_WORK_QUEUE_PROFILER) || defined(CONFIG_WORK_QUEUE_DEADLINE) || defined(WORK_QUEUE_LOCKFREE_ADD)
+		WorkItem *item = _q.pop();
+
+#if defined(WORK_QUEUE_LOCKFREE_ADD)
+		item->_queued.store(false);
+#endif // WORK_QUEUE_LOCKFREE_ADD
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+		item->_time_queued = 0;
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+		item->_deadline = 0;
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+#else
 		_q.pop();
+#endif // CONFIG_WORK_QUEUE_PROFILER || CONFIG_WORK_QUEUE_DEADLINE || WORK_QUEUE_LOCKFREE_ADD
 	}
 
+#if defined(CONFIG_WORK_QUEUE_POOL)
+
+	for (int i = 0; i < _worker_count.load(); i++) {
+		_running[i].requeue = false;
+	}
+
+#endif // CONFIG_WORK_QUEUE_POOL
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+
+	for (int i = 0; i < _worker_count.load(); i++) {
+		_running[i].chained = nullptr;
+	}
+
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
 	work_unlock();
 }
 
+#if defined(CONFIG_WORK_QUEUE_POOL)
+bool WorkQueue::workers_idle() const
+{
+	for (int i = 0; i < _worker_count.load(); i++) {
+		if (_running[i].item != nullptr) {
+			return false;
+		}
+	}
+
+	return true;
+}
+#endif // CONFIG_WORK_QUEUE_POOL
+
 void WorkQueue::Run()
 {
+#if defined(WORK_QUEUE_TRACK_RUNNING)
+	// every worker thread of the queue owns a slot to track the WorkItem it is running
+	const int worker = _worker_count.fetch_add(1);
+
+	if (worker >= (int)(sizeof(_running) / sizeof(_running[0]))) {
+		PX4_ERR("%s: too many worker threads", _config.name);
+		return;
+	}
+
+	RunningItem &running = _running[worker];
+#endif // WORK_QUEUE_TRACK_RUNNING
+
 	while (!should_exit()) {
 		// loop as the wait may be interrupted by a signal
 		do {} while (px4_sem_wait(&_process_lock) != 0);
 
 		work_lock();
 
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+		WorkItem *chained = nullptr;
+
+		// process queued work, a WorkItem chained by the previous one first
+		while ((chained != nullptr) || !_q.empty()) {
+			WorkItem *work = (chained != nullptr) ? chained : _q.pop();
+			chained = nullptr;
+
+			running.thread = pthread_self();
+#else
+
+		collect();
+
 		// process queued work
 		while (!_q.empty()) {
 			WorkItem *work = _q.pop();
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
+#if defined(WORK_QUEUE_TRACK_RUNNING)
+			running.item = work;
+#endif // WORK_QUEUE_TRACK_RUNNING
+
+#if defined(CONFIG_WORK_QUEUE_POOL)
+
+			// let another worker pick up the remaining items
+			if (!_q.empty()) {
+				SignalWorkerThread();
+			}
+
+#endif // CONFIG_WORK_QUEUE_POOL
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+			const hrt_abstime time_queued = work->_time_queued;
+			work->_time_queued = 0;
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+			const hrt_abstime deadline = work->_deadline;
+			work->_deadline = 0;
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
+#if defined(WORK_QUEUE_LOCKFREE_ADD)
+			// from here on the item can be added again (e.g. from its own Run())
+			work->_queued.store(false);
+#endif // WORK_QUEUE_LOCKFREE_ADD
 
 			work_unlock(); // unlock work queue to run (item may requeue itself)
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+			const hrt_abstime time_started = hrt_absolute_time();
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
 			work->RunPreamble();
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+
+			if (work->_heap_owner < 0) {
+				work->_heap_owner = px4::heap_tracking::owner_index(work->ItemName());
+			}
+
+			{
+				px4::heap_tracking::ScopedOwner heap_owner{work->_heap_owner};
+				work->Run();
+			}
+
+#else
 			work->Run();
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
 			// Note: after Run() we cannot access work anymore, as it might have been deleted
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER) || defined(CONFIG_WORK_QUEUE_DEADLINE)
+			const hrt_abstime time_finished = hrt_absolute_time();
+#endif // CONFIG_WORK_QUEUE_PROFILER || CONFIG_WORK_QUEUE_DEADLINE
+
 			work_lock(); // re-lock
+			collect();
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+
+			// still attached, so it wasn't deleted
+			if (!running.detached && (time_queued != 0)) {
+				work->RecordRunTime(time_started - time_queued, time_finished - time_started);
+			}
+
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+
+			if (!running.detached && (deadline != 0)) {
+				work->RecordDeadline(time_finished, deadline);
+			}
+
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
+#if defined(CONFIG_WORK_QUEUE_POOL)
+
+			// scheduled again while running (Remove() clears the flag if the item was deleted)
+			if (running.requeue) {
+				push(work);
+			}
+
+#endif // CONFIG_WORK_QUEUE_POOL
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+			chained = running.chained;
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
+#if defined(WORK_QUEUE_TRACK_RUNNING)
+			running = {};
+#endif // WORK_QUEUE_TRACK_RUNNING
 		}
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
 
+#if defined(CONFIG_WORK_QUEUE_POOL)
+
+		if (_q.empty() && workers_idle()) {
+#else
+
 		if (_q.empty()) {
+#endif // CONFIG_WORK_QUEUE_POOL
 			px4_lockstep_unregister_component(_lockstep_component);
 			_lockstep_component = -1;
 		}
@@ -202,13 +534,31 @@ void WorkQueue::Run()
 		work_unlock();
 	}
 
+#if defined(CONFIG_WORK_QUEUE_POOL)
+	// wake up the next worker so that all of them exit
+	SignalWorkerThread();
+#endif // CONFIG_WORK_QUEUE_POOL
+
 	PX4_DEBUG("%s: exiting", _config.name);
 }
 
 void WorkQueue::print_status(bool last)
 {
 	const size_t num_items = _work_items.size();
+
+#if defined(CONFIG_WORK_QUEUE_POOL)
+
+	if (_worker_count.load() > 1) {
+		PX4_INFO_RAW("%-16s (%d threads)\n", get_name(), _worker_count.load());
+
+	} else {
+		PX4_INFO_RAW("%-16s\n", get_name());
+	}
+
+#else
 	PX4_INFO_RAW("%-16s\n", get_name());
+#endif // CONFIG_WORK_QUEUE_POOL
+
 	unsigned i = 0;
 
 	for (WorkItem *item : _work_items) {
@@ -232,4 +582,54 @@ void WorkQueue::print_status(bool last)
 	}
 }
 
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+bool WorkQueue::get_profile(unsigned &index, work_item_profile_s &profile)
+{
+	// Attach() and Detach() modify the list with the work lock held
+	work_lock();
+
+	unsigned i = 0;
+
+	for (WorkItem *item : _work_items) {
+		if (i++ == index) {
+			item->GetProfile(profile);
+			work_unlock();
+
+			strncpy(profile.wq_name, get_name(), sizeof(profile.wq_name) - 1);
+			return true;
+		}
+	}
+
+	work_unlock();
+
+	index -= i;
+	return false;
+}
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+bool WorkQueue::get_deadline_status(unsigned &index, work_item_deadline_s &status)
+{
+	// Attach() and Detach() modify the list with the work lock held
+	work_lock();
+
+	unsigned i = 0;
+
+	for (WorkItem *item : _work_items) {
+		if (i++ == index) {
+			item->GetDeadlineStatus(status);
+			work_unlock();
+
+			strncpy(status.wq_name, get_name(), sizeof(status.wq_name) - 1);
+			return true;
+		}
+	}
+
+	work_unlock();
+
+	index -= i;
+	return false;
+}
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
 } // namespace px4
@@ -85,13 +85,20 @@ FindWorkQueueByName(const char *name)
 }
 
 WorkQueue *
-WorkQueueFindOrCreate(const wq_config_t &new_wq)
+WorkQueueFindOrCreate(const wq_config_t &config)
 {
 	if (!_wq_manager_running.load()) {
 		PX4_ERR("not running");
 		return nullptr;
 	}
 
+#if defined(CONFIG_WORK_QUEUE_SINGLE_THREAD)
+	(void)config;
+	const wq_config_t &new_wq = wq_configurations::single;
+#else
+	const wq_config_t &new_wq = config;
+#endif // CONFIG_WORK_QUEUE_SINGLE_THREAD
+
 	// search list for existing work queue
 	WorkQueue *wq = FindWorkQueueByName(new_wq.name);
 
@@ -226,17 +233,177 @@ const wq_config_t &ins_instance_to_wq(uint8_t instance)
 	return wq_configurations::INS0;
 }
 
+static size_t
+WorkQueueStackSize(const wq_config_t *wq)
+{
+#if defined(__PX4_NUTTX) || defined(__PX4_QURT)
+	return math::max(PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq->stacksize));
+#elif defined(__PX4_POSIX)
+	// On posix system , the desired stacksize round to the nearest multiplier of the system pagesize
+	// It is a requirement of the  pthread_attr_setstacksize* function
+	const unsigned int page_size = sysconf(_SC_PAGESIZE);
+	const size_t stacksize_adj = math::max((int)PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq->stacksize));
+	return (stacksize_adj + page_size - (stacksize_adj % page_size));
+#endif
+}
+
+#if defined(CONFIG_WORK_QUEUE_AFFINITY) && defined(__PX4_LINUX)
+// pin the thread to the CPU set configured for the work queue (board config)
+static void
+WorkQueueSetAffinity(pthread_attr_t *attr, const wq_config_t *wq)
+{
+	const uint64_t mask = (wq->cpus == wq_cpus::ISOLATED) ? CONFIG_WORK_QUEUE_CPUS_ISOLATED : CONFIG_WORK_QUEUE_CPUS_DEFAULT;
+
+	if (mask == 0) {
+		return;
+	}
+
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+
+	for (int cpu = 0; cpu < 64; cpu++) {
+		if (mask & (1ULL << cpu)) {
+			CPU_SET(cpu, &cpuset);
+		}
+	}
+
+	int ret_setaffinity = pthread_attr_setaffinity_np(attr, sizeof(cpuset), &cpuset);
+
+	if (ret_setaffinity != 0) {
+		PX4_ERR("setting affinity for %s failed (%i)", wq->name, ret_setaffinity);
+	}
+}
+#endif // CONFIG_WORK_QUEUE_AFFINITY && __PX4_LINUX
+
+#if defined(CONFIG_WORK_QUEUE_POOL)
+static void *
+WorkQueuePoolRunner(void *context)
+{
+	WorkQueue *wq = static_cast<WorkQueue *>(context);
+
+#ifdef __PX4_DARWIN
+	pthread_setname_np(wq->get_name());
+#else
+	pthread_setname_np(pthread_self(), wq->get_name());
+#endif
+
+	wq->Run();
+
+	return nullptr;
+}
+
+// start the additional worker threads of a pool work queue with the priority of the calling thread
+// (the CPU affinity is inherited)
+static int
+WorkQueuePoolStart(WorkQueue &wq, pthread_t *threads, int max_threads)
+{
+	sched_param param;
+	int policy;
+
+	if (pthread_getschedparam(pthread_self(), &policy, &param) != 0) {
+		return 0;
+	}
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, WorkQueueStackSize(&wq.get_config()));
+	pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+	pthread_attr_setschedpolicy(&attr, policy);
+	pthread_attr_setschedparam(&attr, &param);
+
+	int count = 0;
+
+	for (; count < max_threads; count++) {
+		int ret_create = pthread_create(&threads[count], &attr, WorkQueuePoolRunner, &wq);
+
+		if (ret_create != 0) {
+			PX4_ERR("failed to create pool thread for %s (%i): %s", wq.get_name(), ret_create, strerror(ret_create));
+			break;
+		}
+	}
+
+	pthread_attr_destroy(&attr);
+
+	return count;
+}
+#endif // CONFIG_WORK_QUEUE_POOL
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+bool
+WorkQueueManagerGetNextProfile(unsigned &index, work_item_profile_s &profile)
+{
+	if (!_wq_manager_running.load()) {
+		return false;
+	}
+
+	LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+	unsigned wq_index = index;
+
+	for (WorkQueue *wq : *_wq_manager_wqs_list) {
+		// reduces wq_index by the number of WorkItems of this queue if not found
+		if (wq->get_profile(wq_index, profile)) {
+			index++;
+			return true;
+		}
+	}
+
+	index = 0;
+	return false;
+}
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+bool
+WorkQueueManagerGetNextDeadlineStatus(unsigned &index, work_item_deadline_s &status)
+{
+	if (!_wq_manager_running.load()) {
+		return false;
+	}
+
+	LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+	unsigned wq_index = index;
+
+	for (WorkQueue *wq : *_wq_manager_wqs_list) {
+		// reduces wq_index by the number of WorkItems of this queue if not found
+		if (wq->get_deadline_status(wq_index, status)) {
+			index++;
+			return true;
+		}
+	}
+
+	index = 0;
+	return false;
+}
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
 static void *
 WorkQueueRunner(void *context)
 {
 	wq_config_t *config = static_cast<wq_config_t *>(context);
 	WorkQueue wq(*config);
 
+#if defined(CONFIG_WORK_QUEUE_POOL)
+	pthread_t pool_threads[CONFIG_WORK_QUEUE_POOL_THREADS - 1];
+	const int pool_thread_count = config->pool ? WorkQueuePoolStart(wq, pool_threads,
+				      CONFIG_WORK_QUEUE_POOL_THREADS - 1) : 0;
+#endif // CONFIG_WORK_QUEUE_POOL
+
 	// add to work queue list
 	_wq_manager_wqs_list->add(&wq);
 
 	wq.Run();
 
+#if defined(CONFIG_WORK_QUEUE_POOL)
+
+	// the WorkQueue lives on this stack, wait for all workers before leaving
+	for (int i = 0; i < pool_thread_count; i++) {
+		pthread_join(pool_threads[i], nullptr);
+	}
+
+#endif // CONFIG_WORK_QUEUE_POOL
+
 	// remove from work queue list
 	_wq_manager_wqs_list->remove(&wq);
 
@@ -269,15 +436,7 @@ WorkQueueManagerRun(int, char **)
 			// create new work queue
 
 			// stack size
-#if defined(__PX4_NUTTX) || defined(__PX4_QURT)
-			const size_t stacksize = math::max(PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq->stacksize));
-#elif defined(__PX4_POSIX)
-			// On posix system , the desired stacksize round to the nearest multiplier of the system pagesize
-			// It is a requirement of the  pthread_attr_setstacksize* function
-			const unsigned int page_size = sysconf(_SC_PAGESIZE);
-			const size_t stacksize_adj = math::max((int)PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq->stacksize));
-			const size_t stacksize = (stacksize_adj + page_size - (stacksize_adj % page_size));
-#endif
+			const size_t stacksize = WorkQueueStackSize(wq);
 
 			// priority
 			int sched_priority = sched_get_priority_max(SCHED_FIFO) + wq->relative_priority;
@@ -305,10 +464,20 @@ WorkQueueManagerRun(int, char **)
 			}
 
 			// schedule policy FIFO
-			int ret_setschedpolicy = pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+			int sched_policy = SCHED_FIFO;
+
+#if defined(CONFIG_WORK_QUEUE_ISOLATED_SCHED_RR)
+
+			if (wq->cpus == wq_cpus::ISOLATED) {
+				sched_policy = SCHED_RR;
+			}
+
+#endif // CONFIG_WORK_QUEUE_ISOLATED_SCHED_RR
+
+			int ret_setschedpolicy = pthread_attr_setschedpolicy(&attr, sched_policy);
 
 			if (ret_setschedpolicy != 0) {
-				PX4_ERR("failed to set sched policy SCHED_FIFO (%i)", ret_setschedpolicy);
+				PX4_ERR("failed to set sched policy %d (%i)", sched_policy, ret_setschedpolicy);
 			}
 
 			// priority
@@ -319,6 +488,10 @@ WorkQueueManagerRun(int, char **)
 				PX4_ERR("setting sched params for %s failed (%i)", wq->name, ret_setschedparam);
 			}
 
+#if defined(CONFIG_WORK_QUEUE_AFFINITY) && defined(__PX4_LINUX)
+			WorkQueueSetAffinity(&attr, wq);
+#endif // CONFIG_WORK_QUEUE_AFFINITY && __PX4_LINUX
+
 			// create thread
 			pthread_t thread;
 			int ret_create = pthread_create(&thread, &attr, WorkQueueRunner, (void *)wq);
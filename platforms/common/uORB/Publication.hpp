@@ -131,6 +131,31 @@ public:
 
 		return (Manager::orb_publish(get_topic(), _handle, &data) == PX4_OK);
 	}
+
+	/**
+	 * Loan the next queue slot to fill the message in place (zero-copy publish).
+	 * The slot must be published with publish_loaned() before any other publication.
+	 * Returns nullptr if a loan is not possible (eg. another publisher is active),
+	 * in which case the caller should fall back to publish().
+	 */
+	T *loan()
+	{
+		static_assert(ORB_QSIZE >= 2, "loaned publications require a queue size of at least 2");
+
+		if (!advertised()) {
+			advertise();
+		}
+
+		return static_cast<T *>(Manager::orb_loan(_handle));
+	}
+
+	/**
+	 * Publish the slot returned by loan()
+	 */
+	bool publish_loaned()
+	{
+		return (Manager::orb_publish_loan(get_topic(), _handle) == PX4_OK);
+	}
 };
 
 /**
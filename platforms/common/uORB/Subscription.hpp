@@ -171,6 +171,61 @@ public:
 		return valid() ? Manager::orb_data_copy(_node, dst, _last_generation, false) : false;
 	}
 
+	/**
+	 * Update only the first bytes of the struct, e.g. the hot fields of a topic
+	 * with "# HOT" annotations (<topic>_s::HOT_PREFIX_SIZE). The rest of dst is left untouched.
+	 * @param dst The uORB message struct we are updating.
+	 * @param size Number of bytes to copy from the start of the message.
+	 */
+	bool update_prefix(void *dst, size_t size)
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_copy(_node, dst, _last_generation, true, size) : false;
+	}
+
+	/**
+	 * Copy only the first bytes of the struct, see update_prefix().
+	 * @param dst The uORB message struct we are updating.
+	 * @param size Number of bytes to copy from the start of the message.
+	 */
+	bool copy_prefix(void *dst, size_t size)
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_copy(_node, dst, _last_generation, false, size) : false;
+	}
+
+	/**
+	 * Borrow the next message in place instead of copying it (zero-copy update).
+	 * The message can be overwritten by later publications at any time, so the caller
+	 * must check loan_valid() once it is done reading and discard the results otherwise.
+	 * Returns nullptr if nothing new is available or in place access is not supported,
+	 * in which case the caller should fall back to update().
+	 * @param loan_generation Returns the generation of the message, to be passed to loan_valid().
+	 */
+	const void *loan(unsigned &loan_generation)
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_loan(_node, _last_generation, true, loan_generation) : nullptr;
+	}
+
+	/**
+	 * Check if a message returned by loan() is still intact.
+	 * @param loan_generation The generation returned by loan().
+	 */
+	bool loan_valid(unsigned loan_generation) const
+	{
+		return valid() && Manager::orb_data_loan_valid(_node, loan_generation);
+	}
+
 	/**
 	 * Change subscription instance
 	 * @param instance The new multi-Subscription instance
@@ -166,7 +166,12 @@ public:
 		if ((_required_updates == 0)
 		    || (Manager::updates_available(_subscription.get_node(), _subscription.get_last_generation()) >= _required_updates)) {
 			if (updated()) {
-				_work_item->ScheduleNow();
+				if (_chained) {
+					_work_item->ScheduleChained();
+
+				} else {
+					_work_item->ScheduleNow();
+				}
 			}
 		}
 	}
@@ -182,10 +187,17 @@ public:
 		_required_updates = required_updates;
 	}
 
+	/**
+	 * Run the WorkItem directly after the publishing WorkItem if both are on the same WorkQueue,
+	 * see WorkItem::ScheduleChained().
+	 */
+	void set_chained(bool chained) { _chained = chained; }
+
 private:
 	px4::WorkItem *_work_item;
 
 	uint8_t _required_updates{0};
+	bool _chained{false};
 };
 
 } // namespace uORB
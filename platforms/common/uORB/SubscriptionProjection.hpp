@@ -0,0 +1,174 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file SubscriptionProjection.hpp
+ *
+ * Subscription that only copies selected fields of a topic, e.g.
+ *
+ *   uORB::SubscriptionProjection<vehicle_status_s, ORB_FIELD(vehicle_status_s, arming_state),
+ *         ORB_FIELD(vehicle_status_s, nav_state)> _vehicle_status_sub{ORB_ID(vehicle_status)};
+ *
+ *   if (_vehicle_status_sub.update()) {
+ *           const bool armed = _vehicle_status_sub.get().arming_state == vehicle_status_s::ARMING_STATE_ARMED;
+ *   }
+ *
+ * All other fields of get() keep their initial value.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include "Subscription.hpp"
+
+namespace uORB
+{
+
+template<uint16_t Offset, uint16_t Size>
+struct Field {
+	static constexpr uint16_t offset = Offset;
+	static constexpr uint16_t size = Size;
+};
+
+/**
+ * Field of a generated uORB message struct for SubscriptionProjection, with
+ * the offset and size of the layout from the message generator.
+ */
+#define ORB_FIELD(type, field) uORB::Field<offsetof(type, field), sizeof(type::field)>
+
+template<class T, class... Fields>
+class SubscriptionProjection : public Subscription
+{
+public:
+	static_assert(sizeof...(Fields) > 0, "no fields selected");
+	static_assert(sizeof...(Fields) <= UINT8_MAX, "too many fields");
+
+	/**
+	 * Constructor
+	 *
+	 * @param id The uORB ORB_ID enum for the topic.
+	 * @param instance The instance for multi sub.
+	 */
+	SubscriptionProjection(ORB_ID id, uint8_t instance = 0) :
+		Subscription(id, instance)
+	{
+		init_ranges();
+	}
+
+	/**
+	 * Constructor
+	 *
+	 * @param meta The uORB metadata (usually from the ORB_ID() macro) for the topic.
+	 * @param instance The instance for multi sub.
+	 */
+	SubscriptionProjection(const orb_metadata *meta, uint8_t instance = 0) :
+		Subscription(meta, instance)
+	{
+		init_ranges();
+	}
+
+	~SubscriptionProjection() = default;
+
+	// no copy, assignment, move, move assignment
+	SubscriptionProjection(const SubscriptionProjection &) = delete;
+	SubscriptionProjection &operator=(const SubscriptionProjection &) = delete;
+	SubscriptionProjection(SubscriptionProjection &&) = delete;
+	SubscriptionProjection &operator=(SubscriptionProjection &&) = delete;
+
+	// update the selected fields of the embedded struct
+	bool update()
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_copy_ranges(_node, &_data, _last_generation, true, _ranges, _num_ranges) : false;
+	}
+
+	// copy the selected fields of the latest message into the embedded struct
+	bool copy()
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_copy_ranges(_node, &_data, _last_generation, false, _ranges, _num_ranges) : false;
+	}
+
+	const T &get() const { return _data; }
+
+private:
+
+	void init_ranges()
+	{
+		const orb_data_range fields[] {{Fields::offset, Fields::size}...};
+
+		// sort by offset (insertion sort, few fields) and merge adjacent fields into one range
+		for (uint8_t i = 0; i < sizeof...(Fields); i++) {
+			orb_data_range range = fields[i];
+			uint8_t j = _num_ranges;
+
+			while ((j > 0) && (_ranges[j - 1].offset > range.offset)) {
+				_ranges[j] = _ranges[j - 1];
+				j--;
+			}
+
+			_ranges[j] = range;
+			_num_ranges++;
+		}
+
+		uint8_t num_merged = 0;
+
+		for (uint8_t i = 0; i < _num_ranges; i++) {
+			if ((num_merged > 0) && (_ranges[i].offset <= _ranges[num_merged - 1].offset + _ranges[num_merged - 1].size)) {
+				const uint16_t end = math::max(_ranges[num_merged - 1].offset + _ranges[num_merged - 1].size,
+							       _ranges[i].offset + _ranges[i].size);
+				_ranges[num_merged - 1].size = end - _ranges[num_merged - 1].offset;
+
+			} else {
+				_ranges[num_merged++] = _ranges[i];
+			}
+		}
+
+		_num_ranges = num_merged;
+	}
+
+	T _data{};
+
+	orb_data_range _ranges[sizeof...(Fields)] {};
+	uint8_t _num_ranges{0};
+};
+
+} // namespace uORB
@@ -0,0 +1,231 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SubscriptionSet.hpp
+ *
+ */
+
+#pragma once
+
+#include <uORB/SubscriptionCallback.hpp>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+
+namespace uORB
+{
+
+// Subscription that marks itself as updated in the bitmask of a SubscriptionSet on every publication
+class SubscriptionSetItem : public SubscriptionCallback
+{
+public:
+	SubscriptionSetItem() : SubscriptionCallback(nullptr) {}
+
+	virtual ~SubscriptionSetItem() = default;
+
+	// no copy, assignment, move, move assignment
+	SubscriptionSetItem(const SubscriptionSetItem &) = delete;
+	SubscriptionSetItem &operator=(const SubscriptionSetItem &) = delete;
+	SubscriptionSetItem(SubscriptionSetItem &&) = delete;
+	SubscriptionSetItem &operator=(SubscriptionSetItem &&) = delete;
+
+	void init(const orb_metadata *meta, uint8_t instance, px4::atomic<uint32_t> *updated_mask, uint32_t bit,
+		  px4::WorkItem *work_item)
+	{
+		_subscription = Subscription{meta, instance};
+		_subscription.subscribe();
+		_updated_mask = updated_mask;
+		_bit = bit;
+		_work_item = work_item;
+	}
+
+	// called by the DeviceNode on publication (with the node locked)
+	void call() override
+	{
+		_updated_mask->fetch_or(_bit);
+
+		if (_work_item != nullptr) {
+			_work_item->ScheduleNow();
+		}
+	}
+
+	// flag as updated without a new publication, eg. for data published before the registration
+	void mark_updated() { _updated_mask->fetch_or(_bit); }
+
+private:
+	px4::atomic<uint32_t> *_updated_mask{nullptr};
+	uint32_t _bit{0};
+	px4::WorkItem *_work_item{nullptr};
+};
+
+/**
+ * A set of subscriptions with a shared updated bitmask, set by the publishers.
+ *
+ * Instead of checking updated() of every subscription each cycle, a consumer
+ * fetches the bitmask once and only visits the subscriptions that got new data.
+ * Optionally every publication schedules a WorkItem.
+ */
+template<uint8_t SIZE>
+class SubscriptionSet
+{
+public:
+	static constexpr uint8_t capacity() { return SIZE; }
+
+	/**
+	 * Constructor
+	 *
+	 * @param work_item Optional WorkItem scheduled on every publication of a topic in the set.
+	 */
+	explicit SubscriptionSet(px4::WorkItem *work_item = nullptr) : _work_item(work_item) {}
+
+	~SubscriptionSet() = default;
+
+	// no copy, assignment, move, move assignment
+	SubscriptionSet(const SubscriptionSet &) = delete;
+	SubscriptionSet &operator=(const SubscriptionSet &) = delete;
+	SubscriptionSet(SubscriptionSet &&) = delete;
+	SubscriptionSet &operator=(SubscriptionSet &&) = delete;
+
+	/**
+	 * Add a topic to the set, must be done before registerCallbacks()
+	 *
+	 * @param meta The uORB metadata (usually from the ORB_ID() macro) for the topic.
+	 * @param instance The instance for multi sub.
+	 * @return index of the subscription in the set, -1 if the set is full
+	 */
+	int add(const orb_metadata *meta, uint8_t instance = 0)
+	{
+		if (_size >= SIZE || _registered) {
+			return -1;
+		}
+
+		const int index = _size;
+		_items[index].init(meta, instance, &_updated[index / 32], 1u << (index % 32), _work_item);
+		_size++;
+
+		return index;
+	}
+
+	/**
+	 * Register the publication callbacks of all topics in the set.
+	 * Topics that already have data are flagged as updated.
+	 */
+	bool registerCallbacks()
+	{
+		bool ret = true;
+
+		for (int i = 0; i < _size; i++) {
+			if (_items[i].registerCallback()) {
+				if (_items[i].updated()) {
+					_items[i].mark_updated();
+				}
+
+			} else {
+				ret = false;
+			}
+		}
+
+		_registered = true;
+
+		return ret;
+	}
+
+	void unregisterCallbacks()
+	{
+		for (int i = 0; i < _size; i++) {
+			_items[i].unregisterCallback();
+		}
+
+		_registered = false;
+	}
+
+	/**
+	 * Check if any topic of the set was published since the last call to update() (without clearing).
+	 */
+	bool updated() const
+	{
+		for (int i = 0; i < WORDS; i++) {
+			if (_updated[i].load() != 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Fetch and clear the updated bitmask, then call f(index, subscription) for every
+	 * subscription that was published in the meantime.
+	 * The subscription data itself still needs to be copied with update() or copy().
+	 *
+	 * @return number of updated subscriptions
+	 */
+	template<typename F>
+	int update(F f)
+	{
+		int count = 0;
+
+		for (int i = 0; i < WORDS; i++) {
+			uint32_t mask = _updated[i].fetch_and(0);
+
+			while (mask != 0) {
+				const int bit = __builtin_ctz(mask);
+				mask &= mask - 1;
+
+				const int index = i * 32 + bit;
+				f(index, _items[index]);
+				count++;
+			}
+		}
+
+		return count;
+	}
+
+	uint8_t size() const { return _size; }
+
+	SubscriptionSetItem &operator [](int i) { return _items[i]; }
+	const SubscriptionSetItem &operator [](int i) const { return _items[i]; }
+
+private:
+	static constexpr int WORDS = (SIZE + 31) / 32;
+
+	SubscriptionSetItem _items[SIZE] {};
+	px4::atomic<uint32_t> _updated[WORDS] {};
+
+	px4::WorkItem *_work_item{nullptr};
+
+	uint8_t _size{0};
+	bool _registered{false};
+};
+
+} // namespace uORB
@@ -113,6 +113,80 @@ int uorb_top(char **topic_filter, int num_filters)
 	return OK;
 }
 
+int uorb_stats(char **topic_filter, int num_filters)
+{
+#if defined(CONFIG_ORB_STATS)
+#if !defined(__PX4_NUTTX) || defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+
+	if (g_dev != nullptr) {
+		g_dev->printDetailedStatistics(topic_filter, num_filters);
+
+	} else {
+		PX4_INFO("uorb is not running");
+	}
+
+#else
+	boardctl(ORBIOCDEVMASTERCMD, ORB_DEVMASTER_STATS);
+#endif
+	return OK;
+#else
+	PX4_INFO("not available (CONFIG_ORB_STATS disabled)");
+	return PX4_ERROR;
+#endif // CONFIG_ORB_STATS
+}
+
+int uorb_queue(char **topic_filter, int num_filters)
+{
+#if defined(CONFIG_ORB_STATS)
+#if !defined(__PX4_NUTTX) || defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+
+	if (g_dev != nullptr) {
+		g_dev->printQueueAdvice(topic_filter, num_filters);
+
+	} else {
+		PX4_INFO("uorb is not running");
+	}
+
+#else
+	boardctl(ORBIOCDEVMASTERCMD, ORB_DEVMASTER_QUEUES);
+#endif
+	return OK;
+#else
+	PX4_INFO("not available (CONFIG_ORB_STATS disabled)");
+	return PX4_ERROR;
+#endif // CONFIG_ORB_STATS
+}
+
+int uorb_queue_set(const char *topic_name, unsigned queue_size)
+{
+#if defined(CONFIG_ORB_QUEUE_OVERRIDE) && (!defined(__PX4_NUTTX) || defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+
+	if (uORB::Manager::get_instance() == nullptr) {
+		PX4_INFO("uorb is not running");
+		return PX4_ERROR;
+	}
+
+	if (queue_size > 255) {
+		PX4_ERR("queue size %u out of range (max 255)", queue_size);
+		return PX4_ERROR;
+	}
+
+	const orb_metadata *const *topics = orb_get_topics();
+
+	for (size_t i = 0; i < orb_topics_count(); i++) {
+		if (strcmp(topics[i]->o_name, topic_name) == 0) {
+			return uORB::Manager::get_instance()->set_queue_size_override(topics[i], queue_size);
+		}
+	}
+
+	PX4_ERR("topic %s not found", topic_name);
+	return PX4_ERROR;
+#else
+	PX4_INFO("not available (CONFIG_ORB_QUEUE_OVERRIDE disabled)");
+	return PX4_ERROR;
+#endif // CONFIG_ORB_QUEUE_OVERRIDE
+}
+
 orb_advert_t orb_advertise(const struct orb_metadata *meta, const void *data)
 {
 	return uORB::Manager::get_instance()->orb_advertise(meta, data);
@@ -53,8 +53,16 @@ struct orb_metadata {
 	const uint16_t o_size_no_padding;   /**< object size w/o padding at the end (for logger) */
 	uint32_t message_hash;	/**< Hash over all fields for message compatibility checks */
 	orb_id_size_t  o_id;                /**< ORB_ID enum */
+	const uint8_t  o_flags;             /**< ORB_FLAG_* bitmask */
 };
 
+/**
+ * Every instance of the topic has at most one publisher (set by an
+ * ORB_SINGLE_WRITER constant in the .msg definition). Publications and copies
+ * then use a sequence counter instead of the node lock.
+ */
+#define ORB_FLAG_SINGLE_WRITER (1 << 0)
+
 typedef const struct orb_metadata *orb_id_t;
 
 /**
@@ -102,14 +110,16 @@ typedef const struct orb_metadata *orb_id_t;
  * @param _size_no_padding	Struct size w/o padding at the end
  * @param _message_hash	32 bit message hash over all fields
  * @param _orb_id_enum	ORB ID enum e.g.: ORB_ID::vehicle_status
+ * @param _flags	ORB_FLAG_* bitmask
  */
-#define ORB_DEFINE(_name, _struct, _size_no_padding, _message_hash, _orb_id_enum)		\
+#define ORB_DEFINE(_name, _struct, _size_no_padding, _message_hash, _orb_id_enum, _flags)		\
 	const struct orb_metadata __orb_##_name = {	\
 		#_name,					\
 		sizeof(_struct),		\
 		_size_no_padding,			\
 		_message_hash,				\
-		_orb_id_enum				\
+		_orb_id_enum,				\
+		_flags					\
 	}; struct hack
 
 __BEGIN_DECLS
@@ -117,6 +127,9 @@ __BEGIN_DECLS
 int uorb_start(void);
 int uorb_status(void);
 int uorb_top(char **topic_filter, int num_filters);
+int uorb_stats(char **topic_filter, int num_filters);
+int uorb_queue(char **topic_filter, int num_filters);
+int uorb_queue_set(const char *topic_name, unsigned queue_size);
 
 /**
  * ORB topic advertiser handle.
@@ -49,5 +49,11 @@ struct orb_advertdata {
 	int *instance;
 };
 
+// byte range of a message, for partial copies
+struct orb_data_range {
+	uint16_t offset;
+	uint16_t size;
+};
+
 }
 #endif // _uORBCommon_hpp_
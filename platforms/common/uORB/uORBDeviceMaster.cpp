@@ -150,6 +150,10 @@ int uORB::DeviceMaster::advertise(const struct orb_metadata *meta, bool is_adver
 
 			// add to the node map.
 			_node_list.add(node);
+#if defined(CONFIG_ORB_NODE_TABLE)
+			// must be set before _node_exists (atomic), which readers check first
+			_node_table[node->get_instance()][(orb_id_size_t)node->id()] = node;
+#endif // CONFIG_ORB_NODE_TABLE
 			_node_exists[node->get_instance()].set((orb_id_size_t)node->id(), true);
 		}
 
@@ -192,6 +196,83 @@ void uORB::DeviceMaster::printStatistics()
 		cur_node = cur_node->next;
 		delete prev;
 	}
+
+#if defined(CONFIG_ORB_STATIC_ARENA)
+	StaticArena::print_status();
+#endif // CONFIG_ORB_STATIC_ARENA
+}
+
+#if defined(CONFIG_ORB_STATS)
+void uORB::DeviceMaster::printDetailedStatistics(char **topic_filter, int num_filters)
+{
+	/* Add all nodes to a list while locked, and then print them in unlocked state, to avoid potential
+	 * dead-locks (where printing blocks) */
+	lock();
+	DeviceNodeStatisticsData *first_node = nullptr;
+	DeviceNodeStatisticsData *cur_node = nullptr;
+	size_t max_topic_name_length = 0;
+	int num_topics = 0;
+	int ret = addNewDeviceNodes(&first_node, num_topics, max_topic_name_length, topic_filter, num_filters);
+	unlock();
+
+	if (ret != 0) {
+		PX4_ERR("addNewDeviceNodes failed (%i)", ret);
+		return;
+	}
+
+	PX4_INFO_RAW("%-*s INST     #PUB    #COPY  #LOST #REJ  MAX[us]   <16us   <64us  <256us    <1ms    <4ms   <16ms   <66ms  >=66ms\n",
+		     (int)max_topic_name_length - 2, "TOPIC NAME");
+
+	cur_node = first_node;
+
+	while (cur_node) {
+		cur_node->node->print_detailed_statistics(max_topic_name_length);
+
+		DeviceNodeStatisticsData *prev = cur_node;
+		cur_node = cur_node->next;
+		delete prev;
+	}
+}
+
+void uORB::DeviceMaster::printQueueAdvice(char **topic_filter, int num_filters)
+{
+	lock();
+	DeviceNodeStatisticsData *first_node = nullptr;
+	DeviceNodeStatisticsData *cur_node = nullptr;
+	size_t max_topic_name_length = 0;
+	int num_topics = 0;
+	int ret = addNewDeviceNodes(&first_node, num_topics, max_topic_name_length, topic_filter, num_filters);
+	unlock();
+
+	if (ret != 0) {
+		PX4_ERR("addNewDeviceNodes failed (%i)", ret);
+		return;
+	}
+
+	PX4_INFO_RAW("%-*s INST QUEUE UNREAD    #LOST  REC\n", (int)max_topic_name_length - 2, "TOPIC NAME");
+
+	cur_node = first_node;
+
+	while (cur_node) {
+		cur_node->node->print_queue_advice(max_topic_name_length);
+
+		DeviceNodeStatisticsData *prev = cur_node;
+		cur_node = cur_node->next;
+		delete prev;
+	}
+
+	PX4_INFO_RAW("\nREC: queue length to not lose messages (* differs), topics only read for their latest value\n"
+		     "do not need it. Override at boot with 'uorb queue <topic> <length>' (CONFIG_ORB_QUEUE_OVERRIDE).\n");
+}
+#endif // CONFIG_ORB_STATS
+
+uORB::DeviceNode *uORB::DeviceMaster::getNextDeviceNode(const uORB::DeviceNode *node)
+{
+	lock();
+	uORB::DeviceNode *next = (node == nullptr) ? *_node_list.begin() : node->getSortedSibling();
+	unlock();
+
+	return next;
 }
 
 int uORB::DeviceMaster::addNewDeviceNodes(DeviceNodeStatisticsData **first_node, int &num_topics,
@@ -449,6 +530,15 @@ uORB::DeviceNode *uORB::DeviceMaster::getDeviceNode(const char *nodepath)
 
 uORB::DeviceNode *uORB::DeviceMaster::getDeviceNodeLocked(const struct orb_metadata *meta, const uint8_t instance)
 {
+#if defined(CONFIG_ORB_NODE_TABLE)
+
+	if (deviceNodeExists(static_cast<ORB_ID>(meta->o_id), instance)) {
+		return _node_table[instance][meta->o_id];
+	}
+
+	return nullptr;
+#endif // CONFIG_ORB_NODE_TABLE
+
 	for (uORB::DeviceNode *node : _node_list) {
 		if ((strcmp(node->get_name(), meta->o_name) == 0) && (node->get_instance() == instance)) {
 			return node;
@@ -82,6 +82,11 @@ public:
 			return nullptr;
 		}
 
+#if defined(CONFIG_ORB_NODE_TABLE)
+		// the table entry is written before _node_exists is set and never changes afterwards
+		return _node_table[instance][meta->o_id];
+#endif // CONFIG_ORB_NODE_TABLE
+
 		lock();
 		uORB::DeviceNode *node = getDeviceNodeLocked(meta, instance);
 		unlock();
@@ -115,6 +120,29 @@ public:
 	 */
 	void showTop(char **topic_filter, int num_filters);
 
+#if defined(CONFIG_ORB_STATS)
+	/**
+	 * Print the publication, copy, lost message and latency statistics of each existing topic.
+	 * @param topic_filter list of topic filters: if set, each string can be a substring for topics to match.
+	 * @param num_filters
+	 */
+	void printDetailedStatistics(char **topic_filter, int num_filters);
+
+	/**
+	 * Print the queue length of each existing topic and the one recommended from the subscriber lag.
+	 * @param topic_filter list of topic filters: if set, each string can be a substring for topics to match.
+	 * @param num_filters
+	 */
+	void printQueueAdvice(char **topic_filter, int num_filters);
+#endif // CONFIG_ORB_STATS
+
+	/**
+	 * Iterate over all nodes.
+	 * @param node the previous node, nullptr to get the first one
+	 * @return the node following node, nullptr at the end
+	 */
+	uORB::DeviceNode *getNextDeviceNode(const uORB::DeviceNode *node);
+
 private:
 	// Private constructor, uORB::Manager takes care of its creation
 	DeviceMaster();
@@ -142,6 +170,10 @@ private:
 	IntrusiveSortedList<uORB::DeviceNode *> _node_list;
 	AtomicBitset<ORB_TOPICS_COUNT> _node_exists[ORB_MULTI_MAX_INSTANCES];
 
+#if defined(CONFIG_ORB_NODE_TABLE)
+	uORB::DeviceNode *_node_table[ORB_MULTI_MAX_INSTANCES][ORB_TOPICS_COUNT] {};
+#endif // CONFIG_ORB_NODE_TABLE
+
 	px4_sem_t	_lock; /**< lock to protect access to all class members (also for derived classes) */
 
 	void		lock() { do {} while (px4_sem_wait(&_lock) != 0); }
@@ -78,13 +78,22 @@ uORB::DeviceNode::DeviceNode(const struct orb_metadata *meta, const uint8_t inst
 	CDev(strdup(path)), // success is checked in CDev::init
 	_meta(meta),
 	_instance(instance),
+	_single_writer(meta->o_flags & ORB_FLAG_SINGLE_WRITER),
 	_queue_size(round_pow_of_two_8(queue_size))
 {
 }
 
 uORB::DeviceNode::~DeviceNode()
 {
+#if defined(CONFIG_ORB_STATIC_ARENA)
+	StaticArena::release(_data, _meta->o_size * _queue_size);
+#else
 	free(_data);
+#endif // CONFIG_ORB_STATIC_ARENA
+
+#if defined(CONFIG_ORB_STATS)
+	free(_publish_timestamps);
+#endif // CONFIG_ORB_STATS
 
 	const char *devname = get_devname();
 
@@ -163,8 +172,8 @@ uORB::DeviceNode::read(cdev::file_t *filp, char *buffer, size_t buflen)
 	return filp_to_subscription(filp)->copy(buffer) ? _meta->o_size : 0;
 }
 
-ssize_t
-uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
+bool
+uORB::DeviceNode::allocate_data()
 {
 	/*
 	 * Writes are legal from interrupt context as long as the
@@ -172,8 +181,6 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 	 *
 	 * Writes outside interrupt context will allocate the object
 	 * if it has not yet been allocated.
-	 *
-	 * Note that filp will usually be NULL.
 	 */
 	if (nullptr == _data) {
 
@@ -187,11 +194,23 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 			/* re-check size */
 			if (nullptr == _data) {
 				const size_t data_size = _meta->o_size * _queue_size;
+#if defined(CONFIG_ORB_STATIC_ARENA)
+				_data = (uint8_t *) StaticArena::allocate(data_size);
+#else
 				_data = (uint8_t *) px4_cache_aligned_alloc(data_size);
+#endif // CONFIG_ORB_STATIC_ARENA
 
 				if (_data) {
 					memset(_data, 0, data_size);
 				}
+
+#if defined(CONFIG_ORB_STATS)
+
+				if (_data && (_publish_timestamps == nullptr)) {
+					_publish_timestamps = (hrt_abstime *)calloc(_queue_size, sizeof(hrt_abstime));
+				}
+
+#endif // CONFIG_ORB_STATS
 			}
 
 			unlock();
@@ -200,11 +219,45 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 		}
 
 #endif /* __PX4_NUTTX */
+	}
 
-		/* failed or could not allocate */
-		if (nullptr == _data) {
-			return -ENOMEM;
+	/* failed or could not allocate */
+	return (nullptr != _data);
+}
+
+void
+uORB::DeviceNode::notify_callbacks()
+{
+	hrt_abstime now = 0;
+
+	// callbacks
+	for (auto item : _callbacks) {
+		const uint32_t interval_us = item->get_interval_us();
+
+		// decimate interval subscriptions here instead of waking them up just to discard the update
+		if (interval_us != 0) {
+			if (now == 0) {
+				now = hrt_absolute_time();
+			}
+
+			if (now - item->get_last_update() < interval_us) {
+				continue;
+			}
 		}
+
+		item->call();
+	}
+
+	/* Mark at least one data has been published */
+	_data_valid = true;
+}
+
+ssize_t
+uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
+{
+	/* Note that filp will usually be NULL. */
+	if (!allocate_data()) {
+		return -ENOMEM;
 	}
 
 	/* If write size does not match, that is an error */
@@ -212,20 +265,154 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 		return -EIO;
 	}
 
+	if (_single_writer) {
+		/* wrap-around happens after ~49 days, assuming a publisher rate of 1 kHz */
+		const unsigned generation = _generation.load();
+		unsigned expected = generation;
+
+		/* claim the slot (seqlock), fails if another write or a loan is in progress */
+		if (!_write_generation.compare_exchange(&expected, generation + 1)) {
+#if defined(CONFIG_ORB_STATS)
+			_rejected_count.fetch_add(1);
+#endif // CONFIG_ORB_STATS
+			return -EBUSY;
+		}
+
+		memcpy(_data + (_meta->o_size * (generation % _queue_size)), buffer, _meta->o_size);
+
+#if defined(CONFIG_ORB_STATS)
+
+		if (_publish_timestamps) {
+			_publish_timestamps[generation % _queue_size] = hrt_absolute_time();
+		}
+
+#endif // CONFIG_ORB_STATS
+
+		_generation.store(generation + 1);
+
+		/* the callback list is only protected by the lock */
+		if (!_callbacks.empty()) {
+			ATOMIC_ENTER;
+			notify_callbacks();
+			ATOMIC_LEAVE;
+
+		} else {
+			_data_valid = true;
+		}
+
+		/* notify any poll waiters */
+		poll_notify(POLLIN);
+
+		return _meta->o_size;
+	}
+
 	/* Perform an atomic copy. */
 	ATOMIC_ENTER;
+
 	/* wrap-around happens after ~49 days, assuming a publisher rate of 1 kHz */
-	unsigned generation = _generation.fetch_add(1);
+	const unsigned generation = _generation.load();
+
+	if (_write_generation.load() != generation) {
+		/* the slot is loaned to another publisher */
+		ATOMIC_LEAVE;
+#if defined(CONFIG_ORB_STATS)
+		_rejected_count.fetch_add(1);
+#endif // CONFIG_ORB_STATS
+		return -EBUSY;
+	}
+
+	/* announce the write first, readers of loaned slots must see it before the data changes */
+	_write_generation.store(generation + 1);
+	_generation.store(generation + 1);
 
 	memcpy(_data + (_meta->o_size * (generation % _queue_size)), buffer, _meta->o_size);
 
-	// callbacks
-	for (auto item : _callbacks) {
-		item->call();
+#if defined(CONFIG_ORB_STATS)
+
+	if (_publish_timestamps) {
+		_publish_timestamps[generation % _queue_size] = hrt_absolute_time();
 	}
 
-	/* Mark at least one data has been published */
-	_data_valid = true;
+#endif // CONFIG_ORB_STATS
+
+	notify_callbacks();
+
+	ATOMIC_LEAVE;
+
+	/* notify any poll waiters */
+	poll_notify(POLLIN);
+
+	return _meta->o_size;
+}
+
+const void *
+uORB::DeviceNode::read_loan(unsigned &generation, unsigned &loan_generation)
+{
+	if (_data == nullptr) {
+		return nullptr;
+	}
+
+#if defined(CONFIG_ORB_STATS)
+	const unsigned last_generation = generation;
+#endif // CONFIG_ORB_STATS
+
+	ATOMIC_ENTER;
+	const void *slot = next_slot(generation, loan_generation);
+	ATOMIC_LEAVE;
+
+#if defined(CONFIG_ORB_STATS)
+	record_read(last_generation, loan_generation);
+#endif // CONFIG_ORB_STATS
+
+	return slot;
+}
+
+void *
+uORB::DeviceNode::write_loan()
+{
+	if ((_queue_size < 2) || !allocate_data()) {
+		return nullptr;
+	}
+
+	void *slot = nullptr;
+
+	ATOMIC_ENTER;
+	const unsigned generation = _generation.load();
+	unsigned expected = generation;
+
+	// from now on readers skip this slot, it is the oldest in the queue
+	if (_write_generation.compare_exchange(&expected, generation + 1)) {
+		slot = _data + (_meta->o_size * (generation % _queue_size));
+	}
+
+	ATOMIC_LEAVE;
+
+	return slot;
+}
+
+ssize_t
+uORB::DeviceNode::write_loan_commit()
+{
+	ATOMIC_ENTER;
+	const unsigned generation = _generation.load();
+
+	if (_write_generation.load() != generation + 1) {
+		/* no loan active */
+		ATOMIC_LEAVE;
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_ORB_STATS)
+
+	if (_publish_timestamps) {
+		_publish_timestamps[generation % _queue_size] = hrt_absolute_time();
+	}
+
+#endif // CONFIG_ORB_STATS
+
+	_generation.store(generation + 1);
+
+	notify_callbacks();
 
 	ATOMIC_LEAVE;
 
@@ -325,6 +512,51 @@ uORB::DeviceNode::publish(const orb_metadata *meta, orb_advert_t handle, const v
 	return PX4_OK;
 }
 
+ssize_t
+uORB::DeviceNode::publish_loan(const orb_metadata *meta, orb_advert_t handle)
+{
+	uORB::DeviceNode *devnode = (uORB::DeviceNode *)handle;
+
+	/* check if the device handle is initialized */
+	if ((devnode == nullptr) || (meta == nullptr)) {
+		errno = EFAULT;
+		return PX4_ERROR;
+	}
+
+	/* check if the orb meta data matches the publication */
+	if (devnode->_meta->o_id != meta->o_id) {
+		errno = EINVAL;
+		return PX4_ERROR;
+	}
+
+	int ret = devnode->write_loan_commit();
+
+	if (ret < 0) {
+		errno = -ret;
+		return PX4_ERROR;
+	}
+
+#ifdef CONFIG_ORB_COMMUNICATOR
+	/*
+	 * if the write is successful, send the data over the Multi-ORB link
+	 */
+	uORBCommunicator::IChannel *ch = uORB::Manager::get_instance()->get_uorb_communicator();
+
+	if (ch != nullptr) {
+		unsigned generation = devnode->_generation.load() - 1;
+		uint8_t *data = devnode->_data + (meta->o_size * (generation % devnode->_queue_size));
+
+		if (ch->send_message(meta->o_name, meta->o_size, data) != 0) {
+			PX4_ERR("Error Sending [%s] topic data over comm_channel", meta->o_name);
+			return PX4_ERROR;
+		}
+	}
+
+#endif /* CONFIG_ORB_COMMUNICATOR */
+
+	return PX4_OK;
+}
+
 int uORB::DeviceNode::unadvertise(orb_advert_t handle)
 {
 	if (handle == nullptr) {
@@ -399,6 +631,109 @@ uORB::DeviceNode::print_statistics(int max_topic_length)
 	return true;
 }
 
+#if defined(CONFIG_ORB_STATS)
+void
+uORB::DeviceNode::record_read(unsigned generation, unsigned read_generation)
+{
+	_copy_count.fetch_add(1);
+
+	// messages published since the last read of the subscriber, including the lost ones
+	const uint32_t unread = _generation.load() - generation;
+
+	if (unread > _unread_max.load()) {
+		_unread_max.store(unread);
+	}
+
+	// the subscriber is moved forward if it was too far behind
+	const int lost = (int)(read_generation - generation);
+
+	if (lost > 0) {
+		_lost_count.fetch_add(lost);
+	}
+
+	if (_publish_timestamps) {
+		const hrt_abstime published = _publish_timestamps[read_generation % _queue_size];
+
+		if (published != 0) {
+			const uint32_t latency_us = hrt_elapsed_time(&published);
+
+			// bucket i: latency < 16us * 4^i
+			int bucket = 0;
+
+			for (uint32_t limit = 16; (latency_us >= limit) && (bucket < orb_statistics_s::LATENCY_BUCKETS - 1); limit <<= 2) {
+				bucket++;
+			}
+
+			_latency_histogram[bucket].fetch_add(1);
+
+			if (latency_us > _latency_max_us.load()) {
+				_latency_max_us.store(latency_us);
+			}
+		}
+	}
+}
+
+void
+uORB::DeviceNode::get_statistics(orb_statistics_s &stats) const
+{
+	strncpy(stats.topic_name, _meta->o_name, sizeof(stats.topic_name) - 1);
+	stats.topic_name[sizeof(stats.topic_name) - 1] = '\0';
+
+	stats.instance = _instance;
+	stats.queue_size = _queue_size;
+	stats.subscriber_count = math::max(_subscriber_count, (int8_t)0);
+
+	stats.publish_count = _generation.load();
+	stats.rejected_count = _rejected_count.load();
+	stats.copy_count = _copy_count.load();
+	stats.lost_count = _lost_count.load();
+	stats.unread_max = math::min(_unread_max.load(), (uint32_t)UINT16_MAX);
+
+	stats.last_publish_timestamp = 0;
+
+	if (_publish_timestamps && (stats.publish_count > 0)) {
+		stats.last_publish_timestamp = _publish_timestamps[(stats.publish_count - 1) % _queue_size];
+	}
+
+	stats.latency_max_us = _latency_max_us.load();
+
+	for (int i = 0; i < orb_statistics_s::LATENCY_BUCKETS; i++) {
+		stats.latency_histogram[i] = _latency_histogram[i].load();
+	}
+}
+
+void
+uORB::DeviceNode::print_detailed_statistics(int max_topic_length) const
+{
+	orb_statistics_s stats{};
+	get_statistics(stats);
+
+	PX4_INFO_RAW("%-*s %2i %8" PRIu32 " %8" PRIu32 " %6" PRIu32 " %4" PRIu32 " %8" PRIu32,
+		     max_topic_length, stats.topic_name, (int)stats.instance, stats.publish_count, stats.copy_count,
+		     stats.lost_count, stats.rejected_count, stats.latency_max_us);
+
+	for (int i = 0; i < orb_statistics_s::LATENCY_BUCKETS; i++) {
+		PX4_INFO_RAW(" %7" PRIu32, stats.latency_histogram[i]);
+	}
+
+	PX4_INFO_RAW("\n");
+}
+
+void
+uORB::DeviceNode::print_queue_advice(int max_topic_length) const
+{
+	orb_statistics_s stats{};
+	get_statistics(stats);
+
+	// a subscriber never had more than unread_max messages pending
+	const uint8_t recommended = round_pow_of_two_8(math::constrain(stats.unread_max, (uint16_t)1, (uint16_t)UINT8_MAX));
+
+	PX4_INFO_RAW("%-*s %2i %5i %6i %8" PRIu32 " %5i%s\n", max_topic_length, stats.topic_name, (int)stats.instance,
+		     (int)stats.queue_size, (int)stats.unread_max, stats.lost_count, (int)recommended,
+		     (recommended != stats.queue_size) ? " *" : "");
+}
+#endif // CONFIG_ORB_STATS
+
 void uORB::DeviceNode::add_internal_subscriber()
 {
 	lock();
@@ -35,6 +35,7 @@
 
 #include "uORBCommon.hpp"
 #include "uORBDeviceMaster.hpp"
+#include "uORBStaticArena.hpp"
 
 #include <lib/cdev/CDev.hpp>
 
@@ -43,6 +44,10 @@
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/px4_config.h>
 
+#if defined(CONFIG_ORB_STATS)
+#include <uORB/topics/orb_statistics.h>
+#endif // CONFIG_ORB_STATS
+
 namespace uORB
 {
 class DeviceNode;
@@ -65,6 +70,12 @@ public:
 	DeviceNode(const struct orb_metadata *meta, const uint8_t instance, const char *path, uint8_t queue_size = 1);
 	virtual ~DeviceNode();
 
+#if defined(CONFIG_ORB_STATIC_ARENA)
+	// nodes are placed in the static arena, see uORBStaticArena.hpp
+	static void *operator new (size_t size) noexcept { return StaticArena::allocate(size); }
+	static void operator delete (void *ptr, size_t size) { StaticArena::release(ptr, size); }
+#endif // CONFIG_ORB_STATIC_ARENA
+
 	// no copy, assignment, move, move assignment
 	DeviceNode(const DeviceNode &) = delete;
 	DeviceNode &operator=(const DeviceNode &) = delete;
@@ -228,49 +239,137 @@ public:
 	 *   The buffer into which the data is copied.
 	 * @param generation
 	 *   The generation that was copied.
+	 * @param size
+	 *   Number of bytes to copy from the start of the message, at most the message size.
 	 * @return bool
 	 *   Returns true if the data was copied.
 	 */
-	bool copy(void *dst, unsigned &generation)
+	bool copy(void *dst, unsigned &generation, size_t size = SIZE_MAX)
+	{
+		const orb_data_range range{0, static_cast<uint16_t>((size < _meta->o_size) ? size : _meta->o_size)};
+		return copy_ranges(dst, generation, &range, 1);
+	}
+
+	/**
+	 * Copies only some byte ranges of the next message to the same offsets in
+	 * the buffer provided, with the same consistency as copy().
+	 *
+	 * @param dst
+	 *   The buffer into which the data is copied, of the size of the message.
+	 * @param generation
+	 *   The generation that was copied.
+	 * @param ranges
+	 *   The byte ranges to copy, within the message size.
+	 * @param num_ranges
+	 *   Number of ranges.
+	 * @return bool
+	 *   Returns true if the data was copied.
+	 */
+	bool copy_ranges(void *dst, unsigned &generation, const orb_data_range *ranges, uint8_t num_ranges)
 	{
 		if ((dst != nullptr) && (_data != nullptr)) {
-			if (_queue_size == 1) {
-				ATOMIC_ENTER;
-				memcpy(dst, _data, _meta->o_size);
-				generation = _generation.load();
-				ATOMIC_LEAVE;
-				return true;
+			unsigned read_generation;
+
+#if defined(CONFIG_ORB_STATS)
+			const unsigned last_generation = generation;
+#endif // CONFIG_ORB_STATS
+
+			if (_single_writer) {
+				// lock-free, copy again if the slot got overwritten in the meantime
+				unsigned next_generation;
+
+				do {
+					next_generation = generation;
+					copy_ranges_from(dst, next_slot(next_generation, read_generation), ranges, num_ranges);
+				} while (!loan_valid(read_generation));
+
+				generation = next_generation;
 
 			} else {
 				ATOMIC_ENTER;
-				const unsigned current_generation = _generation.load();
-
-				if (current_generation == generation) {
-					/* The subscriber already read the latest message, but nothing new was published yet.
-					* Return the previous message
-					*/
-					--generation;
-				}
-
-				// Compatible with normal and overflow conditions
-				if (!is_in_range(current_generation - _queue_size, generation, current_generation - 1)) {
-					// Reader is too far behind: some messages are lost
-					generation = current_generation - _queue_size;
-				}
-
-				memcpy(dst, _data + (_meta->o_size * (generation % _queue_size)), _meta->o_size);
+				copy_ranges_from(dst, next_slot(generation, read_generation), ranges, num_ranges);
 				ATOMIC_LEAVE;
+			}
 
-				++generation;
+#if defined(CONFIG_ORB_STATS)
+			record_read(last_generation, read_generation);
+#endif // CONFIG_ORB_STATS
 
-				return true;
-			}
+			return true;
 		}
 
 		return false;
+	}
+
+	/**
+	 * Returns a pointer to the next message in place, without copying it
+	 * out of the queue. Follows the same generation rules as copy().
+	 *
+	 * The slot can be overwritten by a later publication at any time, the
+	 * reader must confirm with loan_valid() after it is done with the data.
+	 *
+	 * @param generation
+	 *   The generation of the subscriber, advanced like in copy().
+	 * @param loan_generation
+	 *   Returns the generation of the loaned message, to be passed to loan_valid().
+	 * @return
+	 *   Pointer to the message, nullptr if no data is available.
+	 */
+	const void *read_loan(unsigned &generation, unsigned &loan_generation);
 
+	/**
+	 * Check if a message returned by read_loan() is still intact.
+	 * A slot stays valid until the publication _queue_size messages later starts writing into it.
+	 * @param loan_generation
+	 *   The generation returned by read_loan().
+	 */
+	bool loan_valid(unsigned loan_generation) const
+	{
+		// the reads of the slot must complete before the check
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		return (_write_generation.load() - loan_generation) <= _queue_size;
 	}
 
+	/**
+	 * Loan the next queue slot to a publisher, to be filled in place and
+	 * published with write_loan_commit(). Only a single loan can be active
+	 * at a time, and only for queues of at least 2 elements, so that readers
+	 * always have a complete message to fall back to. Other publishers are
+	 * rejected while a loan is active.
+	 * @return
+	 *   Pointer to the slot, nullptr if the queue is too short, allocation failed or a loan is already active.
+	 */
+	void *write_loan();
+
+	/**
+	 * Publish the slot handed out by write_loan().
+	 */
+	ssize_t write_loan_commit();
+
+	/**
+	 * Method to publish the data of a loaned slot of this node.
+	 */
+	static ssize_t    publish_loan(const orb_metadata *meta, orb_advert_t handle);
+
+#if defined(CONFIG_ORB_STATS)
+	/**
+	 * Fill the statistics of this node (topic name, counters and latency histogram)
+	 */
+	void get_statistics(orb_statistics_s &stats) const;
+
+	/**
+	 * Print the statistics of this node
+	 * @param max_topic_length max topic name length for printing
+	 */
+	void print_detailed_statistics(int max_topic_length) const;
+
+	/**
+	 * Print the queue length of this node and the one recommended from the observed subscriber lag
+	 * @param max_topic_length max topic name length for printing
+	 */
+	void print_queue_advice(int max_topic_length) const;
+#endif // CONFIG_ORB_STATS
+
 	// add item to list of work items to schedule on node update
 	bool register_callback(SubscriptionCallback *callback_sub);
 
@@ -286,14 +385,86 @@ protected:
 private:
 	friend uORBTest::UnitTest;
 
+	/**
+	 * Allocate the queue buffer if not done yet.
+	 * @return true if the buffer is available
+	 */
+	bool allocate_data();
+
+	/**
+	 * Run callbacks and mark data as valid after a publication, called with the node locked.
+	 * Callbacks of subscriptions with an interval are skipped until the interval has elapsed.
+	 */
+	void notify_callbacks();
+
+	/**
+	 * Get the slot of the next message for a subscriber, without locking.
+	 * @param generation The generation of the subscriber, advanced past the returned message.
+	 * @param read_generation Returns the generation of the returned message.
+	 */
+	uint8_t *next_slot(unsigned &generation, unsigned &read_generation) const
+	{
+		const unsigned current_generation = _generation.load();
+
+		if (_queue_size == 1) {
+			generation = current_generation;
+			read_generation = current_generation - 1;
+			return _data;
+		}
+
+		if (current_generation == generation) {
+			/* The subscriber already read the latest message, but nothing new was published yet.
+			* Return the previous message
+			*/
+			--generation;
+		}
+
+		// Compatible with normal and overflow conditions
+		// (lower bound excludes the slot of a write in progress)
+		const unsigned write_generation = _write_generation.load();
+
+		if (!is_in_range(write_generation - _queue_size, generation, current_generation - 1)) {
+			// Reader is too far behind: some messages are lost
+			generation = write_generation - _queue_size;
+		}
+
+		read_generation = generation++;
+
+		return _data + (_meta->o_size * (read_generation % _queue_size));
+	}
+
+	static void copy_ranges_from(void *dst, const uint8_t *src, const orb_data_range *ranges, uint8_t num_ranges)
+	{
+		for (uint8_t i = 0; i < num_ranges; i++) {
+			memcpy(static_cast<uint8_t *>(dst) + ranges[i].offset, src + ranges[i].offset, ranges[i].size);
+		}
+	}
+
 	const orb_metadata *_meta; /**< object metadata information */
 
 	uint8_t *_data{nullptr};   /**< allocated object buffer */
 	bool _data_valid{false}; /**< At least one valid data */
 	px4::atomic<unsigned>  _generation{0};  /**< object generation count */
+	px4::atomic<unsigned>  _write_generation{0};  /**< number of writes started, ahead of _generation during a write */
 	List<uORB::SubscriptionCallback *>	_callbacks;
 
+#if defined(CONFIG_ORB_STATS)
+	/**
+	 * Account a read of the message read_generation by a subscriber that was at generation.
+	 */
+	void record_read(unsigned generation, unsigned read_generation);
+
+	hrt_abstime *_publish_timestamps{nullptr}; /**< publication time of every queue slot */
+	px4::atomic<uint32_t> _copy_count{0};
+	px4::atomic<uint32_t> _lost_count{0};
+	px4::atomic<uint32_t> _unread_max{0};
+	px4::atomic<uint32_t> _rejected_count{0};
+	px4::atomic<uint32_t> _latency_max_us{0};
+	px4::atomic<uint32_t> _latency_histogram[orb_statistics_s::LATENCY_BUCKETS] {};
+#endif // CONFIG_ORB_STATS
+
 	const uint8_t _instance; /**< orb multi instance identifier */
+	const bool _single_writer; /**< lock-free publication and copy, see ORB_FLAG_SINGLE_WRITER */
 	bool _advertised{false};  /**< has ever been advertised (not necessarily published data yet) */
 	uint8_t _queue_size; /**< maximum number of elements in the queue */
 	int8_t _subscriber_count{0};
@@ -181,7 +181,8 @@ int	uORB::Manager::orb_ioctl(unsigned int cmd, unsigned long arg)
 
 	case ORBIOCDEVDATACOPY: {
 			orbiocdevdatacopy_t *data = (orbiocdevdatacopy_t *)arg;
-			data->ret = uORB::Manager::orb_data_copy(data->handle, data->dst, data->generation, data->only_if_updated);
+			data->ret = uORB::Manager::orb_data_copy(data->handle, data->dst, data->generation, data->only_if_updated,
+					    data->size);
 		}
 		break;
 
@@ -210,6 +211,15 @@ int	uORB::Manager::orb_ioctl(unsigned int cmd, unsigned long arg)
 				if (arg == ORB_DEVMASTER_TOP) {
 					dev->showTop(nullptr, 0);
 
+#if defined(CONFIG_ORB_STATS)
+
+				} else if (arg == ORB_DEVMASTER_STATS) {
+					dev->printDetailedStatistics(nullptr, 0);
+
+				} else if (arg == ORB_DEVMASTER_QUEUES) {
+					dev->printQueueAdvice(nullptr, 0);
+#endif // CONFIG_ORB_STATS
+
 				} else {
 					dev->printStatistics();
 				}
@@ -300,6 +310,14 @@ orb_advert_t uORB::Manager::orb_advertise_multi(const struct orb_metadata *meta,
 		return nullptr;
 	}
 
+#if defined(CONFIG_ORB_QUEUE_OVERRIDE)
+
+	if (_queue_size_overrides[meta->o_id] > 0) {
+		queue_size = _queue_size_overrides[meta->o_id];
+	}
+
+#endif // CONFIG_ORB_QUEUE_OVERRIDE
+
 	/* Set the queue size. This must be done before the first publication; thus it fails if
 	 * this is not the first advertiser.
 	 */
@@ -455,7 +473,22 @@ void uORB::Manager::orb_remove_internal_subscriber(void *node_handle)
 
 uint8_t uORB::Manager::orb_get_queue_size(const void *node_handle) { return static_cast<const DeviceNode *>(node_handle)->get_queue_size(); }
 
-bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated)
+bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated,
+				  size_t size)
+{
+	if (!is_advertised(node_handle)) {
+		return false;
+	}
+
+	if (only_if_updated && !static_cast<const uORB::DeviceNode *>(node_handle)->updates_available(generation)) {
+		return false;
+	}
+
+	return static_cast<DeviceNode *>(node_handle)->copy(dst, generation, size);
+}
+
+bool uORB::Manager::orb_data_copy_ranges(void *node_handle, void *dst, unsigned &generation, bool only_if_updated,
+		const orb_data_range *ranges, uint8_t num_ranges)
 {
 	if (!is_advertised(node_handle)) {
 		return false;
@@ -465,8 +498,99 @@ bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &genera
 		return false;
 	}
 
-	return static_cast<DeviceNode *>(node_handle)->copy(dst, generation);
+	return static_cast<DeviceNode *>(node_handle)->copy_ranges(dst, generation, ranges, num_ranges);
+}
+
+#if defined(CONFIG_ORB_QUEUE_OVERRIDE)
+int uORB::Manager::set_queue_size_override(const struct orb_metadata *meta, uint8_t queue_size)
+{
+	if (meta == nullptr) {
+		return PX4_ERROR;
+	}
+
+	_queue_size_overrides[meta->o_id] = queue_size;
+
+	if (queue_size == 0) {
+		return PX4_OK;
+	}
+
+	int ret = PX4_OK;
+	uORB::DeviceMaster *dev = get_device_master();
+
+	for (uint8_t instance = 0; dev && instance < ORB_MULTI_MAX_INSTANCES; instance++) {
+		uORB::DeviceNode *node = dev->getDeviceNode(meta, instance);
+
+		if (node != nullptr && node->update_queue_size(queue_size) != PX4_OK) {
+			PX4_WARN("%s %d: queue size unchanged (already published or shrinking)", meta->o_name, instance);
+			ret = PX4_ERROR;
+		}
+	}
+
+	return ret;
+}
+#endif // CONFIG_ORB_QUEUE_OVERRIDE
+
+const void *uORB::Manager::orb_data_loan(void *node_handle, unsigned &generation, bool only_if_updated,
+		unsigned &loan_generation)
+{
+	if (!is_advertised(node_handle)) {
+		return nullptr;
+	}
+
+	if (only_if_updated && !static_cast<const uORB::DeviceNode *>(node_handle)->updates_available(generation)) {
+		return nullptr;
+	}
+
+	return static_cast<DeviceNode *>(node_handle)->read_loan(generation, loan_generation);
+}
+
+bool uORB::Manager::orb_data_loan_valid(const void *node_handle, unsigned loan_generation)
+{
+	return static_cast<const DeviceNode *>(node_handle)->loan_valid(loan_generation);
+}
+
+void *uORB::Manager::orb_loan(orb_advert_t handle)
+{
+#ifdef ORB_USE_PUBLISHER_RULES
+
+	if (handle == _Instance) {
+		return nullptr;
+	}
+
+#endif /* ORB_USE_PUBLISHER_RULES */
+
+	if (handle == nullptr) {
+		return nullptr;
+	}
+
+	return static_cast<DeviceNode *>(handle)->write_loan();
+}
+
+int uORB::Manager::orb_publish_loan(const struct orb_metadata *meta, orb_advert_t handle)
+{
+	return uORB::DeviceNode::publish_loan(meta, handle);
+}
+
+#if defined(CONFIG_ORB_STATS)
+bool uORB::Manager::orb_get_next_statistics(void *&node_handle, orb_statistics_s &stats)
+{
+	DeviceMaster *dev = uORB::Manager::get_instance()->get_device_master();
+
+	if (dev == nullptr) {
+		return false;
+	}
+
+	DeviceNode *node = dev->getNextDeviceNode(static_cast<const DeviceNode *>(node_handle));
+	node_handle = node;
+
+	if (node == nullptr) {
+		return false;
+	}
+
+	node->get_statistics(stats);
+	return true;
 }
+#endif // CONFIG_ORB_STATS
 
 // add item to list of work items to schedule on node update
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
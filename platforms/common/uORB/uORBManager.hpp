@@ -111,6 +111,7 @@ typedef struct {
 	void *handle;
 	void *dst;
 	unsigned generation;
+	size_t size;
 	bool only_if_updated;
 	bool ret;
 } orbiocdevdatacopy_t;
@@ -149,7 +150,9 @@ typedef struct {
 
 typedef enum {
 	ORB_DEVMASTER_STATUS = 0,
-	ORB_DEVMASTER_TOP = 1
+	ORB_DEVMASTER_TOP = 1,
+	ORB_DEVMASTER_STATS = 2,
+	ORB_DEVMASTER_QUEUES = 3
 } orbiocdevmastercmd_t;
 #define ORBIOCDEVMASTERCMD	_ORBIOCDEV(45)
 
@@ -445,7 +448,72 @@ public:
 
 	static uint8_t orb_get_queue_size(const void *node_handle);
 
-	static bool orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated);
+	static bool orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated,
+				  size_t size = SIZE_MAX);
+
+	/**
+	 * Copy only some byte ranges of the next message of a subscription, to the same offsets in dst.
+	 * Across the kernel/user boundary of protected builds the whole message is copied.
+	 *
+	 * @param node_handle   The DeviceNode the subscription is attached to.
+	 * @param dst           Buffer of the size of the message.
+	 * @param generation    The last generation of the subscriber, advanced on success.
+	 * @param only_if_updated Only copy if there is a message newer than generation.
+	 * @param ranges        Byte ranges to copy.
+	 * @param num_ranges    Number of ranges.
+	 * @return true if the data was copied.
+	 */
+	static bool orb_data_copy_ranges(void *node_handle, void *dst, unsigned &generation, bool only_if_updated,
+					 const orb_data_range *ranges, uint8_t num_ranges);
+
+#if defined(CONFIG_ORB_QUEUE_OVERRIDE)
+	/**
+	 * Override the queue length of the msg definition for all instances of a topic advertised from now on.
+	 * Instances that exist already are resized if nothing was published yet.
+	 *
+	 * @param meta        The uORB metadata of the topic.
+	 * @param queue_size  Queue length (rounded up to a power of 2), 0 to remove the override.
+	 * @return PX4_OK on success, PX4_ERROR if an existing instance could not be resized.
+	 */
+	int set_queue_size_override(const struct orb_metadata *meta, uint8_t queue_size);
+#endif // CONFIG_ORB_QUEUE_OVERRIDE
+
+	/**
+	 * Get a pointer to the next message of a subscription in place (zero-copy read).
+	 * The message must be validated with orb_data_loan_valid() once the caller is done with it.
+	 * Not supported across the kernel/user boundary of protected builds (always returns nullptr).
+	 *
+	 * @param node_handle   The DeviceNode the subscription is attached to.
+	 * @param generation    The last generation of the subscriber, advanced on success.
+	 * @param only_if_updated Only return a message if it is newer than generation.
+	 * @param loan_generation Returns the generation to pass to orb_data_loan_valid().
+	 * @return pointer to the message or nullptr.
+	 */
+	static const void *orb_data_loan(void *node_handle, unsigned &generation, bool only_if_updated,
+					 unsigned &loan_generation);
+
+	/**
+	 * Check if a message returned by orb_data_loan() has not been overwritten in the meantime.
+	 */
+	static bool orb_data_loan_valid(const void *node_handle, unsigned loan_generation);
+
+	/**
+	 * Loan the next queue slot of a publication, to be filled in place and
+	 * published with orb_publish_loan(). Requires a queue size of at least 2.
+	 *
+	 * @param handle  The handle returned from orb_advertise.
+	 * @return pointer to the slot or nullptr if a loan is not possible.
+	 */
+	static void *orb_loan(orb_advert_t handle);
+
+	/**
+	 * Publish a slot previously loaned with orb_loan().
+	 *
+	 * @param meta    The uORB metadata (usually from the ORB_ID() macro) for the topic.
+	 * @param handle  The handle returned from orb_advertise.
+	 * @return    OK on success, PX4_ERROR otherwise with errno set accordingly.
+	 */
+	static int orb_publish_loan(const struct orb_metadata *meta, orb_advert_t handle);
 
 	static bool register_callback(void *node_handle, SubscriptionCallback *callback_sub);
 
@@ -453,6 +521,19 @@ public:
 
 	static uint8_t orb_get_instance(const void *node_handle);
 
+#if defined(CONFIG_ORB_STATS)
+	/**
+	 * Get the statistics of the topic instances one after the other.
+	 * Not supported across the kernel/user boundary of protected builds.
+	 *
+	 * @param node_handle The node of the previous call (nullptr to start with the first one),
+	 *                    updated to the node the statistics were filled for.
+	 * @param stats       Statistics to fill.
+	 * @return true if stats were filled, false at the end of the list.
+	 */
+	static bool orb_get_next_statistics(void *&node_handle, orb_statistics_s &stats);
+#endif // CONFIG_ORB_STATS
+
 #if defined(CONFIG_BUILD_FLAT)
 	/* These are optimized by inlining in NuttX Flat build */
 	static unsigned updates_available(const void *node_handle, unsigned last_generation) { return is_advertised(node_handle) ? static_cast<const DeviceNode *>(node_handle)->updates_available(last_generation) : 0; }
@@ -507,6 +588,10 @@ private: // data members
 
 	DeviceMaster *_device_master{nullptr};
 
+#if defined(CONFIG_ORB_QUEUE_OVERRIDE)
+	uint8_t _queue_size_overrides[ORB_TOPICS_COUNT] {}; ///< queue length per topic set with 'uorb queue', 0 = msg default
+#endif // CONFIG_ORB_QUEUE_OVERRIDE
+
 private: //class methods
 	Manager();
 	virtual ~Manager();
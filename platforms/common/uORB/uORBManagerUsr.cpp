@@ -303,15 +303,53 @@ uint8_t uORB::Manager::orb_get_queue_size(const void *node_handle)
 	return data.size;
 }
 
-bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated)
+bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated,
+				  size_t size)
 {
-	orbiocdevdatacopy_t data = {node_handle, dst, generation, only_if_updated, false};
+	orbiocdevdatacopy_t data = {node_handle, dst, generation, size, only_if_updated, false};
 	boardctl(ORBIOCDEVDATACOPY, reinterpret_cast<unsigned long>(&data));
 	generation = data.generation;
 
 	return data.ret;
 }
 
+// the message is copied as a whole, which is a superset of the ranges
+bool uORB::Manager::orb_data_copy_ranges(void *node_handle, void *dst, unsigned &generation, bool only_if_updated,
+		const orb_data_range *ranges, uint8_t num_ranges)
+{
+	return orb_data_copy(node_handle, dst, generation, only_if_updated);
+}
+
+// the nodes live in kernel memory, in place access is not possible from userspace
+const void *uORB::Manager::orb_data_loan(void *node_handle, unsigned &generation, bool only_if_updated,
+		unsigned &loan_generation)
+{
+	return nullptr;
+}
+
+bool uORB::Manager::orb_data_loan_valid(const void *node_handle, unsigned loan_generation)
+{
+	return false;
+}
+
+void *uORB::Manager::orb_loan(orb_advert_t handle)
+{
+	return nullptr;
+}
+
+int uORB::Manager::orb_publish_loan(const struct orb_metadata *meta, orb_advert_t handle)
+{
+	errno = ENOTSUP;
+	return PX4_ERROR;
+}
+
+#if defined(CONFIG_ORB_STATS)
+bool uORB::Manager::orb_get_next_statistics(void *&node_handle, orb_statistics_s &stats)
+{
+	return false;
+}
+#endif // CONFIG_ORB_STATS
+
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
 {
 	orbiocdevregcallback_t data = {node_handle, callback_sub, false};
@@ -0,0 +1,104 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "uORBStaticArena.hpp"
+
+#include <stdlib.h>
+
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/px4_config.h>
+
+#if defined(CONFIG_ORB_STATIC_ARENA)
+
+// sized by the board (CONFIG_ORB_STATIC_ARENA_SIZE), shows up as a single symbol in 'make <board> bloaty_ram'
+alignas(32) static uint8_t g_orb_arena[CONFIG_ORB_STATIC_ARENA_SIZE];
+
+px4::atomic<size_t> uORB::StaticArena::_used{0};
+px4::atomic<size_t> uORB::StaticArena::_heap_used{0};
+px4::atomic<uint32_t> uORB::StaticArena::_heap_allocations{0};
+
+constexpr size_t uORB::StaticArena::ALIGNMENT;
+
+bool uORB::StaticArena::contains(const void *ptr)
+{
+	return (ptr >= g_orb_arena) && (ptr < g_orb_arena + sizeof(g_orb_arena));
+}
+
+void *uORB::StaticArena::allocate(size_t size)
+{
+	const size_t length = aligned(size);
+	size_t used = _used.load();
+
+	while (used + length <= sizeof(g_orb_arena)) {
+		if (_used.compare_exchange(&used, used + length)) {
+			return &g_orb_arena[used];
+		}
+	}
+
+	// arena exhausted, the board should increase CONFIG_ORB_STATIC_ARENA_SIZE (see 'uorb status')
+	void *ptr = px4_cache_aligned_alloc(size);
+
+	if (ptr) {
+		_heap_used.fetch_add(size);
+		_heap_allocations.fetch_add(1);
+	}
+
+	return ptr;
+}
+
+void uORB::StaticArena::release(void *ptr, size_t size)
+{
+	if (ptr == nullptr) {
+		return;
+	}
+
+	if (contains(ptr)) {
+		// only the most recent allocation can be given back
+		size_t expected = ((uint8_t *)ptr - g_orb_arena) + aligned(size);
+		_used.compare_exchange(&expected, (uint8_t *)ptr - g_orb_arena);
+		return;
+	}
+
+	_heap_used.fetch_sub(size);
+	_heap_allocations.fetch_sub(1);
+	free(ptr);
+}
+
+void uORB::StaticArena::print_status()
+{
+	PX4_INFO_RAW("static arena: %zu of %zu bytes used, %zu bytes in %" PRIu32 " allocations from the heap\n",
+		     _used.load(), sizeof(g_orb_arena), _heap_used.load(), _heap_allocations.load());
+}
+
+#endif // CONFIG_ORB_STATIC_ARENA
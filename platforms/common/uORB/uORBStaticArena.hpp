@@ -0,0 +1,83 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file uORBStaticArena.hpp
+ *
+ * Statically allocated memory for the uORB DeviceNodes and their message buffers
+ * (CONFIG_ORB_STATIC_ARENA), so the RAM used by uORB is part of .bss instead of
+ * depending on the heap state and advertise order at boot.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <px4_platform_common/atomic.h>
+
+namespace uORB
+{
+
+class StaticArena
+{
+public:
+	/**
+	 * Allocate memory, from the arena if there is space left, otherwise from the heap.
+	 * Thread-safe, but not from interrupt context.
+	 * @return nullptr if both are exhausted
+	 */
+	static void *allocate(size_t size);
+
+	/**
+	 * Release memory returned by allocate(). Arena memory is only reused if it was the
+	 * last allocation (e.g. a DeviceNode discarded directly after construction).
+	 */
+	static void release(void *ptr, size_t size);
+
+	static void print_status();
+
+private:
+	static constexpr size_t ALIGNMENT = 32; ///< covers the data cache line size of the supported MCUs
+
+	static constexpr size_t aligned(size_t size) { return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+	static bool contains(const void *ptr);
+
+	static px4::atomic<size_t> _used;
+	static px4::atomic<size_t> _heap_used;
+	static px4::atomic<uint32_t> _heap_allocations;
+};
+
+} // namespace uORB
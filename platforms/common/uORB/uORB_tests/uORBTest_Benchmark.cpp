@@ -0,0 +1,353 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file uORBTest_Benchmark.cpp
+ *
+ * uORB publish/copy cost and callback latency benchmarks (uorb_tests benchmark).
+ * Results are printed as CSV, one line per case, with all times in nanoseconds:
+ * case,topic,bytes,queue,subscribers,publishers,samples,mean_ns,min_ns,max_ns
+ */
+
+#include "uORBTest_UnitTest.hpp"
+
+#include <inttypes.h>
+
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+
+using namespace time_literals;
+
+namespace
+{
+
+static constexpr int BATCH_SIZE = 1000; // operations per timed batch
+static constexpr int NUM_BATCHES = 20;
+static constexpr int LATENCY_SAMPLES = 1000;
+static constexpr uint8_t BENCH_QUEUE_SIZE = 16;
+static constexpr int MAX_CALLBACKS = 8;
+static constexpr int MAX_PUBLISHERS = 4;
+
+struct BenchStats {
+	uint64_t sum_ns{0};
+	uint64_t min_ns{UINT64_MAX};
+	uint64_t max_ns{0};
+	uint32_t samples{0};
+
+	void add(uint64_t ns)
+	{
+		sum_ns += ns;
+		min_ns = math::min(min_ns, ns);
+		max_ns = math::max(max_ns, ns);
+		samples++;
+	}
+};
+
+void print_header()
+{
+	PX4_INFO_RAW("case,topic,bytes,queue,subscribers,publishers,samples,mean_ns,min_ns,max_ns\n");
+}
+
+void print_result(const char *name, const orb_metadata *meta, unsigned queue, int subscribers, int publishers,
+		  const BenchStats &stats)
+{
+	const uint64_t mean_ns = (stats.samples > 0) ? stats.sum_ns / stats.samples : 0;
+	const uint64_t min_ns = (stats.samples > 0) ? stats.min_ns : 0;
+
+	PX4_INFO_RAW("%s,%s,%u,%u,%d,%d,%" PRIu32 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
+		     name, meta->o_name, (unsigned)meta->o_size, queue, subscribers, publishers,
+		     stats.samples, mean_ns, min_ns, stats.max_ns);
+}
+
+// time BATCH_SIZE calls of op per sample, the result is the average cost of a single call
+template<typename Op>
+BenchStats time_batches(Op op)
+{
+	BenchStats stats{};
+
+	for (int batch = 0; batch < NUM_BATCHES; batch++) {
+		const hrt_abstime start = hrt_absolute_time();
+
+		for (int i = 0; i < BATCH_SIZE; i++) {
+			op();
+		}
+
+		stats.add(hrt_elapsed_time(&start) * 1000 / BATCH_SIZE);
+	}
+
+	return stats;
+}
+
+// work item woken by a topic callback, optionally measuring the publish to Run() latency
+class BenchCallback : public px4::WorkItem
+{
+public:
+	BenchCallback(const orb_metadata *meta) :
+		WorkItem("uorb_bench", px4::wq_configurations::test1),
+		_sub{this, meta}
+	{}
+
+	bool start() { return _sub.registerCallback(); }
+	void stop() { _sub.unregisterCallback(); }
+
+	BenchStats latency{};
+
+private:
+	void Run() override
+	{
+		orb_test_medium_s msg;
+
+		if (_sub.update(&msg)) {
+			latency.add(hrt_elapsed_time(&msg.timestamp) * 1000);
+		}
+	}
+
+	uORB::SubscriptionCallbackWorkItem _sub;
+};
+
+// shared state of the contention publisher tasks
+px4::atomic_int publishers_ready{0};
+px4::atomic_int publishers_done{0};
+px4::atomic_bool publishers_go{false};
+orb_advert_t contention_handle{nullptr};
+BenchStats contention_stats[MAX_PUBLISHERS] {};
+
+int contention_publisher_main(int argc, char *argv[])
+{
+	const int index = publishers_ready.fetch_add(1);
+	orb_test_medium_s msg{};
+
+	while (!publishers_go.load()) {
+		px4_usleep(100);
+	}
+
+	contention_stats[index] = time_batches([&]() { orb_publish(ORB_ID(orb_test_medium_bench), contention_handle, &msg); });
+
+	publishers_done.fetch_add(1);
+	return 0;
+}
+
+template<typename T>
+int bench_publish_copy(const orb_metadata *meta, uint8_t queue_size)
+{
+	T msg{};
+	orb_advert_t handle = orb_advertise_queue(meta, &msg, queue_size);
+
+	if (handle == nullptr) {
+		PX4_ERR("advertise %s failed", meta->o_name);
+		return PX4_ERROR;
+	}
+
+	uORB::Subscription sub{meta};
+
+	print_result("publish", meta, queue_size, 0, 1, time_batches([&]() { orb_publish(meta, handle, &msg); }));
+	print_result("copy", meta, queue_size, 1, 1, time_batches([&]() { sub.copy(&msg); }));
+	print_result("publish_update", meta, queue_size, 1, 1, time_batches([&]() {
+		orb_publish(meta, handle, &msg);
+		sub.update(&msg);
+	}));
+
+	unsigned loan_generation = 0;
+	print_result("publish_loan", meta, queue_size, 1, 1, time_batches([&]() {
+		orb_publish(meta, handle, &msg);
+
+		if (sub.loan(loan_generation) == nullptr) {
+			sub.update(&msg);
+		}
+	}));
+
+	orb_unadvertise(handle);
+	return PX4_OK;
+}
+
+// publish cost with n work item callbacks registered, each publication wakes the work queue thread
+int bench_callbacks(int num_callbacks)
+{
+	orb_test_medium_s msg{};
+	orb_advert_t handle = orb_advertise(ORB_ID(orb_test_medium_bench), &msg);
+
+	if (handle == nullptr) {
+		return PX4_ERROR;
+	}
+
+	BenchCallback *callbacks[MAX_CALLBACKS] {};
+	int ret = PX4_OK;
+
+	for (int i = 0; i < num_callbacks; i++) {
+		callbacks[i] = new BenchCallback(ORB_ID(orb_test_medium_bench));
+
+		if ((callbacks[i] == nullptr) || !callbacks[i]->start()) {
+			PX4_ERR("callback %d registration failed", i);
+			ret = PX4_ERROR;
+		}
+	}
+
+	if (ret == PX4_OK) {
+		print_result("publish_callbacks", ORB_ID(orb_test_medium_bench), 1, num_callbacks, 1,
+			     time_batches([&]() { orb_publish(ORB_ID(orb_test_medium_bench), handle, &msg); }));
+	}
+
+	for (int i = 0; i < num_callbacks; i++) {
+		if (callbacks[i] != nullptr) {
+			callbacks[i]->stop();
+		}
+	}
+
+	// let the work queue drain before the work items go away
+	px4_usleep(10_ms);
+
+	for (int i = 0; i < num_callbacks; i++) {
+		delete callbacks[i];
+	}
+
+	orb_unadvertise(handle);
+	return ret;
+}
+
+// time from publication to the start of Run() of a work item on another thread
+int bench_callback_latency()
+{
+	orb_test_medium_s msg{};
+	orb_advert_t handle = orb_advertise(ORB_ID(orb_test_medium_bench_latency), &msg);
+
+	if (handle == nullptr) {
+		return PX4_ERROR;
+	}
+
+	BenchCallback callback{ORB_ID(orb_test_medium_bench_latency)};
+
+	if (!callback.start()) {
+		orb_unadvertise(handle);
+		return PX4_ERROR;
+	}
+
+	for (int i = 0; i < LATENCY_SAMPLES; i++) {
+		msg.timestamp = hrt_absolute_time();
+		orb_publish(ORB_ID(orb_test_medium_bench_latency), handle, &msg);
+
+		// publish at ~1 kHz so that every publication wakes an idle work queue
+		px4_usleep(1_ms);
+	}
+
+	callback.stop();
+	px4_usleep(10_ms);
+
+	print_result("callback_latency", ORB_ID(orb_test_medium_bench_latency), 1, 1, 1, callback.latency);
+
+	orb_unadvertise(handle);
+	return PX4_OK;
+}
+
+// publish cost with several tasks publishing the same topic concurrently
+int bench_contention(int num_publishers)
+{
+	orb_test_medium_s msg{};
+	contention_handle = orb_advertise(ORB_ID(orb_test_medium_bench), &msg);
+
+	if (contention_handle == nullptr) {
+		return PX4_ERROR;
+	}
+
+	publishers_ready.store(0);
+	publishers_done.store(0);
+	publishers_go.store(false);
+
+	char *const args[1] = { nullptr };
+	int spawned = 0;
+
+	for (int i = 0; i < num_publishers; i++) {
+		if (px4_task_spawn_cmd("uorb_bench_pub", SCHED_DEFAULT, SCHED_PRIORITY_DEFAULT, 2000,
+				       (px4_main_t)&contention_publisher_main, args) >= 0) {
+			spawned++;
+		}
+	}
+
+	while (publishers_ready.load() < spawned) {
+		px4_usleep(1_ms);
+	}
+
+	publishers_go.store(true);
+
+	while (publishers_done.load() < spawned) {
+		px4_usleep(1_ms);
+	}
+
+	BenchStats total{};
+
+	for (int i = 0; i < spawned; i++) {
+		total.sum_ns += contention_stats[i].sum_ns;
+		total.min_ns = math::min(total.min_ns, contention_stats[i].min_ns);
+		total.max_ns = math::max(total.max_ns, contention_stats[i].max_ns);
+		total.samples += contention_stats[i].samples;
+	}
+
+	print_result("publish_contention", ORB_ID(orb_test_medium_bench), 1, 0, spawned, total);
+
+	orb_unadvertise(contention_handle);
+	contention_handle = nullptr;
+
+	return (spawned == num_publishers) ? PX4_OK : PX4_ERROR;
+}
+
+} // namespace
+
+int uORBTest::UnitTest::benchmark()
+{
+	int ret = PX4_OK;
+
+	print_header();
+
+	// message size and queue length
+	ret |= bench_publish_copy<orb_test_s>(ORB_ID(orb_test_bench), 1);
+	ret |= bench_publish_copy<orb_test_medium_s>(ORB_ID(orb_test_medium_bench), 1);
+	ret |= bench_publish_copy<orb_test_large_s>(ORB_ID(orb_test_large_bench), 1);
+	ret |= bench_publish_copy<orb_test_medium_s>(ORB_ID(orb_test_medium_bench_queue), BENCH_QUEUE_SIZE);
+
+	// subscriber count (cross-thread wake-ups)
+	for (int num_callbacks = 0; num_callbacks <= MAX_CALLBACKS; num_callbacks = (num_callbacks == 0) ? 1 : 2 * num_callbacks) {
+		ret |= bench_callbacks(num_callbacks);
+	}
+
+	ret |= bench_callback_latency();
+
+	// contention
+	for (int num_publishers = 1; num_publishers <= MAX_PUBLISHERS; num_publishers *= 2) {
+		ret |= bench_contention(num_publishers);
+	}
+
+	return (ret == PX4_OK) ? PX4_OK : PX4_ERROR;
+}
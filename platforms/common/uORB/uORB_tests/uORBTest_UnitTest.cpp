@@ -39,8 +39,12 @@
 #include <errno.h>
 #include <math.h>
 #include <lib/cdev/CDev.hpp>
+#include <uORB/Publication.hpp>
 #include <uORB/PublicationMulti.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionSet.hpp>
 #include <uORB/SubscriptionMultiArray.hpp>
+#include <uORB/SubscriptionProjection.hpp>
 
 uORBTest::UnitTest &uORBTest::UnitTest::instance()
 {
@@ -206,7 +210,25 @@ int uORBTest::UnitTest::test()
 		return ret;
 	}
 
-	return test_queue_poll_notify();
+	ret = test_queue_poll_notify();
+
+	if (ret != OK) {
+		return ret;
+	}
+
+	ret = test_loan();
+
+	if (ret != OK) {
+		return ret;
+	}
+
+	ret = test_projection();
+
+	if (ret != OK) {
+		return ret;
+	}
+
+	return test_subscription_set();
 }
 
 int uORBTest::UnitTest::test_unadvertise()
@@ -1117,3 +1139,195 @@ int uORBTest::UnitTest::pubsubtest_threadEntry(int argc, char *argv[])
 	uORBTest::UnitTest &t = uORBTest::UnitTest::instance();
 	return t.pubsublatency_main();
 }
+
+int uORBTest::UnitTest::test_loan()
+{
+	test_note("Testing zero-copy loans");
+
+	static constexpr uint8_t queue_size = 4;
+	uORB::Publication<orb_test_medium_s, queue_size> pub{ORB_ID(orb_test_medium_loan)};
+	uORB::Subscription sub{ORB_ID(orb_test_medium_loan)};
+
+	orb_test_medium_s *slot = pub.loan();
+
+	if (slot == nullptr) {
+		return test_fail("loan failed");
+	}
+
+	if (pub.loan() != nullptr) {
+		return test_fail("second loan succeeded");
+	}
+
+	orb_test_medium_s t{};
+
+	if (pub.publish(t)) {
+		return test_fail("publish succeeded during loan");
+	}
+
+	slot->timestamp = hrt_absolute_time();
+	slot->val = 1;
+
+	if (!pub.publish_loaned()) {
+		return test_fail("publish_loaned failed");
+	}
+
+	unsigned loan_generation = 0;
+	const orb_test_medium_s *msg = static_cast<const orb_test_medium_s *>(sub.loan(loan_generation));
+
+	if ((msg == nullptr) || (msg->val != 1)) {
+		return test_fail("read loan mismatch");
+	}
+
+	if (!sub.loan_valid(loan_generation)) {
+		return test_fail("read loan invalid");
+	}
+
+	if (sub.loan(loan_generation) != nullptr) {
+		return test_fail("spurious read loan");
+	}
+
+	// fill up the queue, the first message stays valid until its slot gets reused
+	for (int i = 2; i <= queue_size; i++) {
+		t.val = i;
+		pub.publish(t);
+	}
+
+	if (!sub.loan_valid(loan_generation)) {
+		return test_fail("read loan invalidated too early");
+	}
+
+	// the new loan takes over the slot of the first message
+	slot = pub.loan();
+
+	if ((slot == nullptr) || sub.loan_valid(loan_generation)) {
+		return test_fail("read loan not invalidated");
+	}
+
+	// copies skip the slot being written
+	orb_test_medium_s u{};
+
+	if (!sub.update(&u) || (u.val != 2)) {
+		return test_fail("update during loan mismatch: %d", u.val);
+	}
+
+	slot->val = queue_size + 1;
+	pub.publish_loaned();
+
+	for (int i = 3; i <= queue_size + 1; i++) {
+		msg = static_cast<const orb_test_medium_s *>(sub.loan(loan_generation));
+
+		if ((msg == nullptr) || (msg->val != i) || !sub.loan_valid(loan_generation)) {
+			return test_fail("read loan %d mismatch", i);
+		}
+	}
+
+	return test_note("PASS zero-copy loans");
+}
+
+int uORBTest::UnitTest::test_projection()
+{
+	test_note("Testing partial copies");
+
+	uORB::Publication<orb_test_medium_s> pub{ORB_ID(orb_test_medium_projection)};
+	uORB::SubscriptionProjection<orb_test_medium_s, ORB_FIELD(orb_test_medium_s, val),
+	     ORB_FIELD(orb_test_medium_s, timestamp)> projection{ORB_ID(orb_test_medium_projection)};
+	uORB::Subscription sub{ORB_ID(orb_test_medium_projection)};
+
+	orb_test_medium_s t{};
+	t.timestamp = hrt_absolute_time();
+	t.val = 42;
+	t.junk[0] = 1;
+	t.junk[63] = 2;
+	pub.publish(t);
+
+	if (!projection.update()) {
+		return test_fail("projection update failed");
+	}
+
+	const orb_test_medium_s &p = projection.get();
+
+	if ((p.timestamp != t.timestamp) || (p.val != 42) || (p.junk[0] != 0) || (p.junk[63] != 0)) {
+		return test_fail("projection mismatch");
+	}
+
+	if (projection.update()) {
+		return test_fail("spurious projection update");
+	}
+
+	orb_test_medium_s u{};
+	u.junk[63] = 3;
+
+	if (!sub.update_prefix(&u, offsetof(orb_test_medium_s, junk) + 1)) {
+		return test_fail("prefix update failed");
+	}
+
+	if ((u.val != 42) || (u.junk[0] != 1) || (u.junk[63] != 3)) {
+		return test_fail("prefix mismatch");
+	}
+
+	return test_note("PASS partial copies");
+}
+
+int uORBTest::UnitTest::test_subscription_set()
+{
+	test_note("Testing SubscriptionSet");
+
+	uORB::Publication<orb_test_s> pub_test{ORB_ID(orb_test)};
+	uORB::Publication<orb_test_medium_s> pub_medium{ORB_ID(orb_test_medium)};
+
+	// make sure both topics have data before the set is created
+	orb_test_s t{};
+	orb_test_medium_s m{};
+	pub_test.publish(t);
+	pub_medium.publish(m);
+
+	uORB::SubscriptionSet<2> set;
+	const int index_test = set.add(ORB_ID(orb_test));
+	const int index_medium = set.add(ORB_ID(orb_test_medium));
+
+	if ((index_test != 0) || (index_medium != 1) || (set.add(ORB_ID(orb_multitest)) != -1)) {
+		return test_fail("add failed");
+	}
+
+	if (!set.registerCallbacks()) {
+		return test_fail("registerCallbacks failed");
+	}
+
+	// data published before the registration is flagged
+	int updated_mask = 0;
+	auto collect = [&updated_mask](int index, uORB::SubscriptionSetItem & sub) { updated_mask |= 1 << index; };
+
+	if ((set.update(collect) != 2) || (updated_mask != 0b11)) {
+		return test_fail("initial update mismatch: %d", updated_mask);
+	}
+
+	if (set.updated()) {
+		return test_fail("spurious update");
+	}
+
+	for (int i = 0; i < 3; i++) {
+		m.val = i;
+		pub_medium.publish(m);
+	}
+
+	updated_mask = 0;
+
+	if ((set.update(collect) != 1) || (updated_mask != (1 << index_medium))) {
+		return test_fail("update mismatch: %d", updated_mask);
+	}
+
+	orb_test_medium_s u{};
+
+	if (!set[index_medium].update(&u) || (u.val != 2)) {
+		return test_fail("copy mismatch: %d", u.val);
+	}
+
+	set.unregisterCallbacks();
+	pub_test.publish(t);
+
+	if (set.updated()) {
+		return test_fail("update after unregister");
+	}
+
+	return test_note("PASS SubscriptionSet");
+}
@@ -67,6 +67,7 @@ public:
 
 	int test();
 	int latency_test(bool print);
+	int benchmark();
 	int info();
 
 	// Disallow copy
@@ -115,6 +116,12 @@ private:
 	int test_queue_poll_notify();
 	volatile int _num_messages_sent = 0;
 
+	/* zero-copy loan test */
+	int test_loan();
+	int test_projection();
+
+	int test_subscription_set();
+
 	int test_fail(const char *fmt, ...);
 	int test_note(const char *fmt, ...);
 };
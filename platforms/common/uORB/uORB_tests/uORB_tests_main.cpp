@@ -39,7 +39,7 @@ extern "C" { __EXPORT int uorb_tests_main(int argc, char *argv[]); }
 
 static void usage()
 {
-	PX4_INFO("Usage: uorb_tests [latency_test]");
+	PX4_INFO("Usage: uorb_tests [latency_test|benchmark]");
 }
 
 int
@@ -70,6 +70,14 @@ uorb_tests_main(int argc, char *argv[])
 		return t.latency_test(true);
 	}
 
+	/*
+	 * Benchmark publish/copy cost and callback latency, output is CSV.
+	 */
+	if (argc > 1 && !strcmp(argv[1], "benchmark")) {
+		uORBTest::UnitTest &t = uORBTest::UnitTest::instance();
+		return t.benchmark();
+	}
+
 	usage();
 	return -EINVAL;
 }
@@ -0,0 +1,151 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file board_dma_lease.c
+ *
+ * Pool of leased DMA capable transfer buffers, see board_dma_lease.h.
+ */
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform/board_dma_lease.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+struct dma_lease_slot_s {
+	void *buffer;
+	size_t size;
+	bool leased;
+};
+
+static struct dma_lease_slot_s g_lease_slots[BOARD_DMA_LEASE_SLOTS];
+static unsigned g_lease_failures;
+
+static size_t dma_lease_round_up(size_t size)
+{
+#if defined(ARMV7M_DCACHE_LINESIZE)
+	return (size + ARMV7M_DCACHE_LINESIZE - 1) & ~(size_t)(ARMV7M_DCACHE_LINESIZE - 1);
+#else
+	return size;
+#endif
+}
+
+__EXPORT void *
+board_dma_lease(size_t size)
+{
+	struct dma_lease_slot_s *slot = NULL;
+
+	/* claim a free slot, preferring one that is allocated and large enough */
+	irqstate_t flags = px4_enter_critical_section();
+
+	for (int i = 0; i < BOARD_DMA_LEASE_SLOTS; i++) {
+		struct dma_lease_slot_s *candidate = &g_lease_slots[i];
+
+		if (candidate->leased) {
+			continue;
+		}
+
+		if (candidate->size >= size) {
+			slot = candidate;
+			break;
+
+		} else if (slot == NULL || candidate->size > slot->size) {
+			slot = candidate;
+		}
+	}
+
+	if (slot != NULL) {
+		slot->leased = true;
+	}
+
+	px4_leave_critical_section(flags);
+
+	if (slot == NULL) {
+		g_lease_failures++;
+		return NULL;
+	}
+
+	if (slot->size < size) {
+		/* the slot is exclusively ours now, (re)allocate outside of the critical section */
+		free(slot->buffer);
+		slot->size = dma_lease_round_up(size);
+		slot->buffer = px4_cache_aligned_alloc(slot->size);
+
+		if (slot->buffer == NULL) {
+			slot->size = 0;
+			slot->leased = false;
+			g_lease_failures++;
+			return NULL;
+		}
+	}
+
+	return slot->buffer;
+}
+
+__EXPORT void
+board_dma_release(void *buffer)
+{
+	if (buffer == NULL) {
+		return;
+	}
+
+	irqstate_t flags = px4_enter_critical_section();
+
+	for (int i = 0; i < BOARD_DMA_LEASE_SLOTS; i++) {
+		if (g_lease_slots[i].buffer == buffer) {
+			g_lease_slots[i].leased = false;
+			break;
+		}
+	}
+
+	px4_leave_critical_section(flags);
+}
+
+__EXPORT void
+board_get_dma_lease_usage(unsigned *slots_allocated, size_t *bytes_allocated, unsigned *lease_failures)
+{
+	*slots_allocated = 0;
+	*bytes_allocated = 0;
+
+	for (int i = 0; i < BOARD_DMA_LEASE_SLOTS; i++) {
+		if (g_lease_slots[i].buffer != NULL) {
+			(*slots_allocated)++;
+			*bytes_allocated += g_lease_slots[i].size;
+		}
+	}
+
+	*lease_failures = g_lease_failures;
+}
@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file board_dma_lease.h
+ *
+ * Pool of DMA capable transfer buffers that are leased for the duration of a
+ * transfer and its processing, so drivers running one after the other (e.g.
+ * all the sensors on one SPI bus, which share a work queue) share a buffer
+ * instead of each keeping its own.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include <board_config.h>
+
+/* number of buffers, which limits the number of concurrent leases (one per bus work queue) */
+#if !defined(BOARD_DMA_LEASE_SLOTS)
+#  define BOARD_DMA_LEASE_SLOTS 4
+#endif
+
+__BEGIN_DECLS
+
+/************************************************************************************
+ * Name: board_dma_lease
+ *
+ * Description:
+ *   Lease a cache line aligned, DMA capable buffer of at least size bytes. The
+ *   buffers are allocated on first use and then kept, a buffer is resized if a
+ *   larger lease comes along while it is free. Not usable from interrupt context.
+ *
+ * Input Parameters:
+ *   size - minimum size of the buffer in bytes
+ *
+ * Returned Value:
+ *   The buffer, NULL if all buffers are leased or out of memory.
+ *
+ ************************************************************************************/
+__EXPORT void *board_dma_lease(size_t size);
+
+/************************************************************************************
+ * Name: board_dma_release
+ *
+ * Description:
+ *   Return a buffer obtained from board_dma_lease() to the pool.
+ *
+ * Input Parameters:
+ *   buffer - the leased buffer, NULL is ignored
+ *
+ ************************************************************************************/
+__EXPORT void board_dma_release(void *buffer);
+
+/************************************************************************************
+ * Name: board_get_dma_lease_usage
+ *
+ * Description:
+ *   Instrumentation of the lease pool.
+ *
+ * Input Parameters:
+ *   slots_allocated - A pointer to receive the number of buffers allocated so far.
+ *   bytes_allocated - A pointer to receive the total size of those buffers.
+ *   lease_failures  - A pointer to receive the number of failed leases.
+ *
+ ************************************************************************************/
+__EXPORT void board_get_dma_lease_usage(unsigned *slots_allocated, size_t *bytes_allocated, unsigned *lease_failures);
+
+__END_DECLS
+
+#ifdef __cplusplus
+
+namespace px4
+{
+
+/**
+ * Lease of a DMA buffer for an object of type T, released when going out of scope.
+ * Leases are short (one transfer and its processing), check get() for nullptr.
+ */
+template<typename T>
+class DMALease
+{
+public:
+	DMALease() : _buffer(static_cast<T *>(board_dma_lease(sizeof(T)))) {}
+	~DMALease() { board_dma_release(_buffer); }
+
+	DMALease(const DMALease &) = delete;
+	DMALease &operator=(const DMALease &) = delete;
+
+	T *get() const { return _buffer; }
+
+private:
+	T *_buffer;
+};
+
+} // namespace px4
+
+#endif // __cplusplus
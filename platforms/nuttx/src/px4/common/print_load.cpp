@@ -49,6 +49,7 @@
 
 #if defined(BOARD_DMA_ALLOC_POOL_SIZE)
 #include <px4_platform/board_dma_alloc.h>
+#include <px4_platform/board_dma_lease.h>
 #endif /* BOARD_DMA_ALLOC_POOL_SIZE */
 
 #if defined(CONFIG_SCHED_INSTRUMENTATION)
@@ -357,6 +358,17 @@ void print_load_buffer(char *buffer, int buffer_length, print_load_callback_f cb
 	}
 
 #endif
+	unsigned lease_slots;
+	size_t lease_bytes;
+	unsigned lease_failures;
+	board_get_dma_lease_usage(&lease_slots, &lease_bytes, &lease_failures);
+
+	if (lease_slots > 0) {
+		snprintf(buffer, buffer_length, "DMA leases: %u buffers, %zu bytes, %u failed",
+			 lease_slots, lease_bytes, lease_failures);
+		cb(user);
+	}
+
 	snprintf(buffer, buffer_length, "Uptime: %.3fs total, %.3fs idle",
 		 (double)print_state->new_time / 1e6, (double)total_runtime[0] / 1e6);
 
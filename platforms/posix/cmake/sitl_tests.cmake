@@ -149,6 +149,33 @@ foreach(cmd_name ${test_cmds})
 endforeach()
 
 
+# benchmarks, not part of the test suite (make benchmarks)
+# JSON report with one object per measurement in ${SITL_WORKING_DIR}/benchmarks.json
+set(benchmark_reports ${SITL_WORKING_DIR}/benchmarks_microbench.json)
+set(benchmark_depends px4)
+
+if(CONFIG_MODULES_EKF2)
+	list(APPEND benchmark_reports ${SITL_WORKING_DIR}/benchmarks_ekf2_replay.json)
+	list(APPEND benchmark_depends ekf2_replay_benchmark)
+	set(ekf2_benchmark_command COMMAND $<TARGET_FILE:ekf2_replay_benchmark> > ${SITL_WORKING_DIR}/benchmarks_ekf2_replay.json)
+endif()
+
+add_custom_target(benchmark_results
+	COMMAND $<TARGET_FILE:px4>
+		-s ${PX4_SOURCE_DIR}/posix-configs/SITL/init/test/test_benchmarks
+		-t ${PX4_SOURCE_DIR}/test_data
+		${PX4_SOURCE_DIR}/ROMFS/px4fmu_test
+	${ekf2_benchmark_command}
+	COMMAND ${CMAKE_COMMAND} -E cat ${benchmark_reports} > ${SITL_WORKING_DIR}/benchmarks.json
+	COMMAND ${CMAKE_COMMAND} -E echo "benchmark report: ${SITL_WORKING_DIR}/benchmarks.json"
+	DEPENDS ${benchmark_depends}
+	WORKING_DIRECTORY ${SITL_WORKING_DIR}
+	COMMENT "Running benchmarks"
+	USES_TERMINAL
+)
+set_target_properties(benchmark_results PROPERTIES EXCLUDE_FROM_ALL TRUE)
+
+
 if(CMAKE_BUILD_TYPE STREQUAL Coverage)
 	setup_target_for_coverage(test_coverage "${CMAKE_CTEST_COMMAND} --output-on-failure -T Test" tests)
 	setup_target_for_coverage(generate_coverage "${CMAKE_COMMAND} -E echo" generic)
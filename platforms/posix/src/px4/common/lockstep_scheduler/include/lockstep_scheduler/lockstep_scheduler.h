@@ -50,7 +50,7 @@ public:
 	~LockstepScheduler();
 
 	void set_absolute_time(uint64_t time_us);
-	inline uint64_t get_absolute_time() const { return _time_us; }
+	inline uint64_t get_absolute_time() const { return _time_us.load(std::memory_order_acquire); }
 	int cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *lock, uint64_t time_us);
 	int usleep_until(uint64_t timed_us);
 
@@ -95,9 +95,14 @@ private:
 
 	LockstepComponents _components;
 
-	std::atomic<uint64_t> _time_us{0};
+	// read by every hrt_absolute_time() call, keep it on its own cache line so the writes to the
+	// members below (wait list, flags) from other threads don't keep invalidating it
+	alignas(64) std::atomic<uint64_t> _time_us{0};
+	char _time_us_padding[64 - sizeof(std::atomic<uint64_t>)] {};
 
 	TimedWait *_timed_waits{nullptr}; ///< head of linked list
+	uint64_t _next_timeout_us{0}; ///< earliest time a pending wait times out, protected by _timed_waits_mutex
+	std::atomic<bool> _cleanup_pending{false}; ///< a wait is done and can be removed from the list
 	std::mutex _timed_waits_mutex;
 	std::atomic<bool> _setting_time{false}; ///< true if set_absolute_time() is currently being executed
 };
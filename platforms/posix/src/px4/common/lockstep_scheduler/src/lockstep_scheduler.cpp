@@ -57,7 +57,16 @@ void LockstepScheduler::set_absolute_time(uint64_t time_us)
 
 	{
 		std::unique_lock<std::mutex> lock_timed_waits(_timed_waits_mutex);
+
+		// Nothing is due and there is nothing to clean up: skip walking the list.
+		// This is the common case for most of the (simulation) time steps.
+		if (time_us < _next_timeout_us && !_cleanup_pending) {
+			return;
+		}
+
 		_setting_time = true;
+		_cleanup_pending = false;
+		_next_timeout_us = UINT64_MAX;
 
 		TimedWait *timed_wait = _timed_waits;
 		TimedWait *timed_wait_prev = nullptr;
@@ -87,6 +96,12 @@ void LockstepScheduler::set_absolute_time(uint64_t time_us)
 				timed_wait->timeout = true;
 				pthread_cond_broadcast(timed_wait->passed_cond);
 				pthread_mutex_unlock(timed_wait->passed_lock);
+
+				// it will be done and can be removed the next time
+				_cleanup_pending = true;
+
+			} else if (!timed_wait->timeout && timed_wait->time_us < _next_timeout_us) {
+				_next_timeout_us = timed_wait->time_us;
 			}
 
 			timed_wait_prev = timed_wait;
@@ -122,6 +137,10 @@ int LockstepScheduler::cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *loc
 			timed_wait.next = _timed_waits;
 			_timed_waits = &timed_wait;
 		}
+
+		if (time_us < _next_timeout_us) {
+			_next_timeout_us = time_us;
+		}
 	}
 
 	int result = pthread_cond_wait(cond, lock);
@@ -134,6 +153,11 @@ int LockstepScheduler::cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *loc
 
 	timed_wait.done = true;
 
+	if (!timeout) {
+		// woken up before the timeout, remove it from the list on the next time update
+		_cleanup_pending = true;
+	}
+
 	if (!timeout && _setting_time) {
 		// This is where it gets tricky: the timeout has not been triggered yet,
 		// and another thread is in set_absolute_time().
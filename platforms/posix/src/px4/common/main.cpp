@@ -175,10 +175,16 @@ int main(int argc, char **argv)
 			return PX4_ERROR;
 		}
 
+		px4_daemon::Client client(instance);
+
+		/* px4-<cmd> --batch: run the commands read from stdin over a single connection */
+		if (argc == 2 && strcmp(argv[1], "--batch") == 0) {
+			return client.process_batch();
+		}
+
 		/* Remove the path and prefix. */
 		argv[0] += path_length + strlen(prefix);
 
-		px4_daemon::Client client(instance);
 		return client.process_args(argc, (const char **)argv);
 
 	} else {
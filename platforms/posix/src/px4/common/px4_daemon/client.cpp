@@ -63,6 +63,52 @@ Client::Client(int instance_id) :
 
 int
 Client::process_args(const int argc, const char **argv)
+{
+	int ret = _connect();
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = _send_cmds(argc, argv);
+
+	if (ret != 0) {
+		PX4_ERR("Could not send commands");
+		return -3;
+	}
+
+	return _listen();
+}
+
+int
+Client::process_batch()
+{
+	std::string cmd_buf;
+	char buffer[1024];
+	size_t n_read;
+
+	while ((n_read = fread(buffer, 1, sizeof(buffer), stdin)) > 0) {
+		cmd_buf.append(buffer, n_read);
+	}
+
+	int ret = _connect();
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = _send(cmd_buf, CMD_FLAG_BATCH);
+
+	if (ret != 0) {
+		PX4_ERR("Could not send commands");
+		return -3;
+	}
+
+	return _listen();
+}
+
+int
+Client::_connect()
 {
 	std::string sock_path = get_socket_path(_instance_id);
 
@@ -82,14 +128,7 @@ Client::process_args(const int argc, const char **argv)
 		return -1;
 	}
 
-	int ret = _send_cmds(argc, argv);
-
-	if (ret != 0) {
-		PX4_ERR("Could not send commands");
-		return -3;
-	}
-
-	return _listen();
+	return 0;
 }
 
 int
@@ -107,8 +146,18 @@ Client::_send_cmds(const int argc, const char **argv)
 		}
 	}
 
-	// Last byte is 'isatty'.
-	cmd_buf.push_back(isatty(STDOUT_FILENO));
+	return _send(cmd_buf, 0);
+}
+
+int
+Client::_send(std::string &cmd_buf, uint8_t flags)
+{
+	// Last byte holds the flags and terminates the request.
+	if (isatty(STDOUT_FILENO)) {
+		flags |= CMD_FLAG_ISATTY;
+	}
+
+	cmd_buf.push_back(flags);
 
 	size_t n = cmd_buf.size();
 	const char *buf = cmd_buf.data();
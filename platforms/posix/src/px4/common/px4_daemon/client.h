@@ -40,6 +40,9 @@
  * It the client dies, the connection gets closed automatically and the corresponding
  * thread in the server gets cancelled.
  *
+ * In batch mode all commands read from stdin (one per line) are sent as a single
+ * request, which saves the connection setup and process start for every command.
+ *
  * @author Julian Oes <julian@oes.ch>
  * @author Beat Küng <beat-kueng@gmx.net>
  * @author Mara Bos <m-ou.se@m-ou.se>
@@ -47,6 +50,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <string>
 
 #include "sock_protocol.h"
 
@@ -76,8 +80,18 @@ public:
 	 */
 	int process_args(const int argc, const char **argv);
 
+	/**
+	 * Read commands from stdin until EOF (one per line) and send them to the server
+	 * as a single batch request. The commands are run in order.
+	 *
+	 * @return 0 if all commands succeeded, otherwise the return value of the first failing one
+	 */
+	int process_batch();
+
 private:
+	int _connect();
 	int _send_cmds(const int argc, const char **argv);
+	int _send(std::string &cmd_buf, uint8_t flags);
 	int _listen();
 
 	int _fd;
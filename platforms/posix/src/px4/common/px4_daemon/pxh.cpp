@@ -48,8 +48,12 @@
 #include <stdio.h>
 #include <poll.h>
 #include <fcntl.h>
+#include <stdlib.h>
+#include <time.h>
 #include <unistd.h>
 
+#include <px4_platform_common/log.h>
+
 #include "pxh.h"
 
 namespace px4_daemon
@@ -110,8 +114,23 @@ int Pxh::process_line(const std::string &line, bool silently_fail)
 		// Explicitly set this nullptr.
 		arg[words.size()] = nullptr;
 
+		// PX4_STARTUP_PROFILE=1: report the (wall) time of every command, e.g. of the rcS lines
+		static const bool profile = (getenv("PX4_STARTUP_PROFILE") != nullptr);
+		struct timespec start;
+
+		if (profile) {
+			clock_gettime(CLOCK_MONOTONIC, &start);
+		}
+
 		int retval = _apps[command](words.size(), (char **)arg);
 
+		if (profile) {
+			struct timespec end;
+			clock_gettime(CLOCK_MONOTONIC, &end);
+			const double elapsed_ms = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) * 1e-6;
+			PX4_INFO("startup profile: %.3f ms: %s", elapsed_ms, line.c_str());
+		}
+
 		if (retval) {
 			if (!silently_fail) {
 				printf("Command '%s' failed, returned %d.\n", command.c_str(), retval);
@@ -181,9 +181,26 @@ Server::_server_main()
 				// Set stream to line buffered.
 				setvbuf(thread_stdout, nullptr, _IOLBF, BUFSIZ);
 
-				// Start a new thread to handle the client.
-				pthread_t *thread = &_fd_to_thread[client];
-				ret = pthread_create(thread, nullptr, Server::_handle_client, thread_stdout);
+				if (!_idle_workers.empty()) {
+					// Hand the client over to an idle thread.
+					Worker *worker = _idle_workers.back();
+					_idle_workers.pop_back();
+
+					worker->out = thread_stdout;
+					_fd_to_thread[client] = worker->thread;
+					pthread_cond_signal(&worker->cond);
+					ret = 0;
+
+				} else {
+					// Start a new thread to handle the client.
+					pthread_t *thread = &_fd_to_thread[client];
+					ret = pthread_create(thread, nullptr, Server::_worker_main, thread_stdout);
+
+					if (ret == 0) {
+						// We won't join the thread, so detach to automatically release resources at its end
+						pthread_detach(*thread);
+					}
+				}
 
 				if (ret != 0) {
 					PX4_ERR("could not start pthread (%i)", ret);
@@ -191,9 +208,6 @@ Server::_server_main()
 					fclose(thread_stdout);
 
 				} else {
-					// We won't join the thread, so detach to automatically release resources at its end
-					pthread_detach(*thread);
-
 					// Start listening for the client hanging up.
 					poll_fds.push_back(pollfd {client, POLLHUP, 0});
 
@@ -234,9 +248,51 @@ Server::_server_main()
 }
 
 void
-*Server::_handle_client(void *arg)
+*Server::_worker_main(void *arg)
 {
+	Worker worker{};
+	worker.thread = pthread_self();
+	pthread_cond_init(&worker.cond, nullptr);
+
 	FILE *out = (FILE *)arg;
+
+	while (out != nullptr) {
+		_handle_client(out);
+
+		// A client hanging up during the command cancels this thread; _cleanup() removed it
+		// from _fd_to_thread, so no new cancellation can come in after this point.
+		pthread_testcancel();
+
+		// Park the thread until the server hands over the next client.
+		pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, nullptr);
+		_instance->_lock();
+		out = nullptr;
+
+		if (_instance->_idle_workers.size() < MAX_IDLE_WORKERS) {
+			worker.out = nullptr;
+			_instance->_idle_workers.push_back(&worker);
+
+			while (worker.out == nullptr) {
+				pthread_cond_wait(&worker.cond, &_instance->_mutex);
+			}
+
+			out = worker.out;
+		}
+
+		_instance->_unlock();
+		pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, nullptr);
+
+		// The client may have hung up again before we woke up, don't touch it in that case.
+		pthread_testcancel();
+	}
+
+	pthread_cond_destroy(&worker.cond);
+	return nullptr;
+}
+
+void
+Server::_handle_client(FILE *out)
+{
 	int fd = fileno(out);
 
 	// Read until the end of the incoming stream.
@@ -249,24 +305,24 @@ void
 
 		if (n_read <= 0) {
 			_cleanup(fd);
-			return nullptr;
+			return;
 		}
 
 		cmd.resize(n + n_read);
 
-		// Command ends in 0x00 (no tty) or 0x01 (tty).
-		if (!cmd.empty() && cmd.back() < 2) {
+		// Command ends in the request flags (CMD_FLAG_*).
+		if (!cmd.empty() && (uint8_t)cmd.back() <= CMD_FLAGS_MAX) {
 			break;
 		}
 	}
 
 	if (cmd.size() < 2) {
 		_cleanup(fd);
-		return nullptr;
+		return;
 	}
 
-	// Last byte is 'isatty'.
-	uint8_t isatty = cmd.back();
+	// Last byte holds the flags.
+	const uint8_t flags = cmd.back();
 	cmd.pop_back();
 
 	// We register thread specific data. This is used for PX4_INFO (etc.) log calls.
@@ -274,14 +330,44 @@ void
 
 	if ((thread_data_ptr = (CmdThreadSpecificData *)pthread_getspecific(_instance->_key)) == nullptr) {
 		thread_data_ptr = new CmdThreadSpecificData;
-		thread_data_ptr->thread_stdout = out;
-		thread_data_ptr->is_atty = isatty;
-
 		(void)pthread_setspecific(_instance->_key, (void *)thread_data_ptr);
 	}
 
-	// Run the actual command.
-	int retval = Pxh::process_line(cmd, true);
+	// Threads are reused, so update the stream for every client.
+	thread_data_ptr->thread_stdout = out;
+	thread_data_ptr->is_atty = flags & CMD_FLAG_ISATTY;
+
+	// Run the actual command(s).
+	int retval = 0;
+
+	if (flags & CMD_FLAG_BATCH) {
+		// Run all lines, the first failure is reported (like a script that doesn't stop on errors).
+		size_t start = 0;
+
+		while (start < cmd.size()) {
+			size_t end = cmd.find('\n', start);
+
+			if (end == std::string::npos) {
+				end = cmd.size();
+			}
+
+			const std::string line = cmd.substr(start, end - start);
+			const size_t first = line.find_first_not_of(" \t");
+
+			if ((first != std::string::npos) && (line[first] != '#')) {
+				const int line_retval = Pxh::process_line(line, true);
+
+				if (retval == 0) {
+					retval = line_retval;
+				}
+			}
+
+			start = end + 1;
+		}
+
+	} else {
+		retval = Pxh::process_line(cmd, true);
+	}
 
 	// Report return value.
 	char buf[2] = {0, (char)retval};
@@ -293,8 +379,10 @@ void
 	// Flush the FILE*'s buffer before we shut down the connection.
 	fflush(out);
 
+	// Log output of this thread goes to the server stdout until the next client.
+	thread_data_ptr->thread_stdout = nullptr;
+
 	_cleanup(fd);
-	return nullptr;
 }
 
 void
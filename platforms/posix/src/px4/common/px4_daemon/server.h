@@ -37,7 +37,11 @@
  *
  * Once a client connects it will send a command and close its side of the connection.
  * The server will return the stdout of the executing command, as well as the return
- * value to the client.
+ * value to the client. A batch request carries several commands, which are run in order
+ * on the same connection.
+ *
+ * Commands run on a pool of handler threads, idle threads are kept around to
+ * avoid creating a new thread for every command.
  *
  * There should only every be one server running, therefore the static instance.
  * The Singleton implementation is not complete, but it should be obvious not
@@ -54,6 +58,7 @@
 #include <stdbool.h>
 #include <pthread.h>
 #include <map>
+#include <vector>
 
 #include "sock_protocol.h"
 
@@ -103,13 +108,23 @@ private:
 		pthread_mutex_unlock(&_mutex);
 	}
 
-	static void *_handle_client(void *arg);
+	struct Worker {
+		pthread_t thread;
+		pthread_cond_t cond;
+		FILE *out; ///< client handed over by the server thread, nullptr while idle
+	};
+
+	static constexpr size_t MAX_IDLE_WORKERS = 4;
+
+	static void *_worker_main(void *arg);
+	static void _handle_client(FILE *out);
 	static void _cleanup(int fd);
 
 	pthread_t _server_main_pthread;
 
 	std::map<int, pthread_t> _fd_to_thread;
-	pthread_mutex_t _mutex; ///< Protects _fd_to_thread.
+	std::vector<Worker *> _idle_workers;
+	pthread_mutex_t _mutex; ///< Protects _fd_to_thread and _idle_workers.
 
 	pthread_key_t _key;
 
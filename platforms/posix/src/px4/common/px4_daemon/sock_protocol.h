@@ -37,11 +37,17 @@
  */
 #pragma once
 
+#include <stdint.h>
 #include <string>
 
 namespace px4_daemon
 {
 
+// The last byte of a client request holds these flags and marks the end of the request.
+static constexpr uint8_t CMD_FLAG_ISATTY = 1 << 0; ///< client stdout is a terminal
+static constexpr uint8_t CMD_FLAG_BATCH = 1 << 1;  ///< request holds several newline separated commands
+static constexpr uint8_t CMD_FLAGS_MAX = CMD_FLAG_ISATTY | CMD_FLAG_BATCH;
+
 std::string get_socket_path(int instance_id);
 
 } // namespace px4_daemon
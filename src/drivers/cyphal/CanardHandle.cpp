@@ -35,6 +35,7 @@
 
 #include <net/if.h>
 #include <sys/ioctl.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <px4_platform_common/log.h>
@@ -56,8 +57,69 @@
 
 O1HeapInstance *cyphal_allocator{nullptr};
 
+#if defined(CONFIG_CYPHAL_TX_POOL)
+/*
+ * Fixed size blocks for the TX queue items: canardTxPush() allocates one item of at most
+ * sizeof(CanardTxQueueItem) + MTU bytes per frame, which is freed again after transmission.
+ * Any request up to the block size is served from the pool, larger ones (RX payloads) and
+ * requests while the pool is exhausted go to the O1Heap.
+ */
+struct CyphalTxPool {
+	uint8_t *storage{nullptr};
+	size_t block_size{0};
+	size_t block_count{0};
+	void *free_list{nullptr};
+	size_t used{0};
+	size_t peak_used{0};
+	uint64_t heap_fallback_count{0};
+
+	bool owns(const void *pointer) const
+	{
+		return (pointer >= storage) && (pointer < storage + block_size * block_count);
+	}
+};
+
+static CyphalTxPool cyphal_tx_pool;
+
+static void *memAllocate(CanardInstance *const ins, const size_t amount)
+{
+	CyphalTxPool &pool = cyphal_tx_pool;
+
+	if ((amount <= pool.block_size) && (pool.free_list != nullptr)) {
+		void *block = pool.free_list;
+		pool.free_list = *static_cast<void **>(block);
+
+		if (++pool.used > pool.peak_used) {
+			pool.peak_used = pool.used;
+		}
+
+		return block;
+	}
+
+	if (amount <= pool.block_size) {
+		pool.heap_fallback_count++;
+	}
+
+	return o1heapAllocate(cyphal_allocator, amount);
+}
+
+static void memFree(CanardInstance *const ins, void *const pointer)
+{
+	CyphalTxPool &pool = cyphal_tx_pool;
+
+	if (pool.owns(pointer)) {
+		*static_cast<void **>(pointer) = pool.free_list;
+		pool.free_list = pointer;
+		pool.used--;
+		return;
+	}
+
+	o1heapFree(cyphal_allocator, pointer);
+}
+#else
 static void *memAllocate(CanardInstance *const ins, const size_t amount) { return o1heapAllocate(cyphal_allocator, amount); }
 static void memFree(CanardInstance *const ins, void *const pointer) { o1heapFree(cyphal_allocator, pointer); }
+#endif // CONFIG_CYPHAL_TX_POOL
 
 
 CanardHandle::CanardHandle(uint32_t node_id, const size_t capacity, const size_t mtu_bytes)
@@ -75,6 +137,27 @@ CanardHandle::CanardHandle(uint32_t node_id, const size_t capacity, const size_t
 
 	_queue = canardTxInit(capacity, mtu_bytes);
 
+#if defined(CONFIG_CYPHAL_TX_POOL)
+	// one block per queue item, rounded up to the O1Heap alignment
+	const size_t block_size = (sizeof(CanardTxQueueItem) + mtu_bytes + O1HEAP_ALIGNMENT - 1) & ~(O1HEAP_ALIGNMENT - 1);
+	cyphal_tx_pool.storage = static_cast<uint8_t *>(memalign(O1HEAP_ALIGNMENT, block_size * capacity));
+
+	if (cyphal_tx_pool.storage != nullptr) {
+		cyphal_tx_pool.block_size = block_size;
+		cyphal_tx_pool.block_count = capacity;
+
+		for (size_t i = 0; i < capacity; i++) {
+			void *block = cyphal_tx_pool.storage + i * block_size;
+			*static_cast<void **>(block) = cyphal_tx_pool.free_list;
+			cyphal_tx_pool.free_list = block;
+		}
+
+	} else {
+		PX4_ERR("TX pool allocation failed");
+	}
+
+#endif // CONFIG_CYPHAL_TX_POOL
+
 #if defined(__PX4_NUTTX)
 # if defined(CONFIG_NET_CAN)
 	_can_interface = new CanardSocketCAN();
@@ -94,6 +177,11 @@ CanardHandle::~CanardHandle()
 	delete static_cast<uint8_t *>(_cyphal_heap);
 	_cyphal_heap = nullptr;
 
+#if defined(CONFIG_CYPHAL_TX_POOL)
+	free(cyphal_tx_pool.storage);
+	cyphal_tx_pool = CyphalTxPool{};
+#endif // CONFIG_CYPHAL_TX_POOL
+
 }
 
 
@@ -207,6 +295,14 @@ O1HeapDiagnostics CanardHandle::getO1HeapDiagnostics()
 	return o1heapGetDiagnostics(cyphal_allocator);
 }
 
+#if defined(CONFIG_CYPHAL_TX_POOL)
+CanardHandle::TxPoolDiagnostics CanardHandle::getTxPoolDiagnostics()
+{
+	return TxPoolDiagnostics{cyphal_tx_pool.block_size, cyphal_tx_pool.block_count, cyphal_tx_pool.used,
+				 cyphal_tx_pool.peak_used, cyphal_tx_pool.heap_fallback_count};
+}
+#endif // CONFIG_CYPHAL_TX_POOL
+
 int32_t CanardHandle::mtu()
 {
 	return _queue.mtu_bytes;
@@ -71,6 +71,18 @@ public:
 	CanardTreeNode *getRxSubscriptions(CanardTransferKind kind);
 	O1HeapDiagnostics getO1HeapDiagnostics();
 
+#if defined(CONFIG_CYPHAL_TX_POOL)
+	struct TxPoolDiagnostics {
+		size_t block_size;
+		size_t capacity;
+		size_t used;
+		size_t peak_used;
+		uint64_t heap_fallback_count; ///< TX allocations served by the O1Heap (pool exhausted or request too large)
+	};
+
+	TxPoolDiagnostics getTxPoolDiagnostics();
+#endif // CONFIG_CYPHAL_TX_POOL
+
 	int32_t mtu();
 	CanardNodeID node_id();
 	void set_node_id(CanardNodeID id);
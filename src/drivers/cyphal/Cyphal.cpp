@@ -255,6 +255,13 @@ void CyphalNode::print_info()
 		 heap_diagnostics.peak_allocated, heap_diagnostics.peak_request_size,
 		 heap_diagnostics.oom_count);
 
+#if defined(CONFIG_CYPHAL_TX_POOL)
+	const CanardHandle::TxPoolDiagnostics tx_pool = _canard_handle.getTxPoolDiagnostics();
+
+	PX4_INFO("TX pool %zu/%zu blocks of %zu B, peak %zu, heap fallbacks %" PRIu64,
+		 tx_pool.used, tx_pool.capacity, tx_pool.block_size, tx_pool.peak_used, tx_pool.heap_fallback_count);
+#endif // CONFIG_CYPHAL_TX_POOL
+
 	_pub_manager.printInfo();
 
 	PX4_INFO("Message subscriptions:");
@@ -76,6 +76,12 @@ typedef void	(* hrt_callout)(void *arg);
 typedef struct hrt_call {
 	struct sq_entry_s	link;
 
+	/* callout queue linkage of the drivers using hrt_callout_queue.h */
+	struct hrt_call		*heap_child;
+	struct hrt_call		*heap_sibling;
+	struct hrt_call		*heap_prev;	/* parent if first child, previous sibling otherwise */
+	uint32_t		heap_seq;
+
 	hrt_abstime		deadline;
 	hrt_abstime		period;
 	hrt_callout		callout;
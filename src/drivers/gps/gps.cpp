@@ -259,8 +259,9 @@ private:
 	 * send data to the device, such as an RTCM stream
 	 * @param data
 	 * @param len
+	 * @param flush wait for the data to be written out (fsync)
 	 */
-	inline bool injectData(uint8_t *data, size_t len);
+	inline bool injectData(const uint8_t *data, size_t len, bool flush = true);
 
 	/**
 	 * set the Baudrate
@@ -281,7 +282,7 @@ private:
 	 * @param mode calling source
 	 * @param msg_to_gps_device if true, this is a message sent to the gps device, otherwise it's from the device
 	 */
-	void dumpGpsData(uint8_t *data, size_t len, gps_dump_comm_mode_t mode, bool msg_to_gps_device);
+	void dumpGpsData(const uint8_t *data, size_t len, gps_dump_comm_mode_t mode, bool msg_to_gps_device);
 
 	void initializeCommunicationDump();
 
@@ -483,7 +484,7 @@ int GPS::pollOrRead(uint8_t *buf, size_t buf_length, int timeout)
 			unsigned baudrate = _baudrate == 0 ? 115200 : _baudrate;
 			const unsigned sleeptime = character_count * 1000000 / (baudrate / 10);
 
-#ifdef __PX4_NUTTX
+			// FIONREAD is also supported by Linux ttys, only devices without it (eg. spidev) always wait
 			int err = 0;
 			int bytes_available = 0;
 			err = ::ioctl(_serial_fd, FIONREAD, (unsigned long)&bytes_available);
@@ -492,10 +493,6 @@ int GPS::pollOrRead(uint8_t *buf, size_t buf_length, int timeout)
 				px4_usleep(sleeptime);
 			}
 
-#else
-			px4_usleep(sleeptime);
-#endif
-
 			ret = ::read(_serial_fd, buf, buf_length);
 
 			if (ret > 0) {
@@ -548,6 +545,7 @@ void GPS::handleInjectDataTopic()
 	}
 
 	bool updated = already_copied;
+	bool injected = false;
 
 	// Limit maximum number of GPS injections to 8 since usually
 	// GPS injections should consist of 1-4 packets (GPS, Glonass, BeiDou, Galileo).
@@ -557,34 +555,62 @@ void GPS::handleInjectDataTopic()
 	const size_t max_num_injections = gps_inject_data_s::ORB_QUEUE_LENGTH;
 	size_t num_injections = 0;
 
-	do {
-		if (updated) {
-			num_injections++;
+	while (num_injections < max_num_injections) {
+		uORB::Subscription &sub = _orb_inject_data_sub[_selected_rtcm_instance];
+
+		// write the fragments directly out of the queue, fall back to a copy if in place reading is not possible
+		const gps_inject_data_s *data = &msg;
+		unsigned loan_generation = 0;
 
-			// Prevent injection of data from self
-			if (msg.device_id != get_device_id()) {
-				/* Write the message to the gps device. Note that the message could be fragmented.
-				* But as we don't write anywhere else to the device during operation, we don't
-				* need to assemble the message first.
-				*/
-				injectData(msg.data, msg.len);
+		if (!updated) {
+			data = static_cast<const gps_inject_data_s *>(sub.loan(loan_generation));
 
-				++_last_rate_rtcm_injection_count;
-				_last_rtcm_injection_time = hrt_absolute_time();
+			if (data == nullptr) {
+				if (!sub.update(&msg)) {
+					break;
+				}
+
+				data = &msg;
 			}
 		}
 
-		updated = _orb_inject_data_sub[_selected_rtcm_instance].update(&msg);
+		updated = false;
+		num_injections++;
+
+		// Prevent injection of data from self
+		if (data->device_id != get_device_id()) {
+			/* Write the message to the gps device. Note that the message could be fragmented.
+			* But as we don't write anywhere else to the device during operation, we don't
+			* need to assemble the message first.
+			*/
+			injected |= injectData(data->data, math::min((size_t)data->len, sizeof(data->data)), false);
+
+			if ((data != &msg) && !sub.loan_valid(loan_generation)) {
+				// overwritten by a publisher while writing, the receiver drops the fragment on the RTCM CRC
+				PX4_DEBUG("RTCM fragment overwritten during injection");
+			}
+
+			++_last_rate_rtcm_injection_count;
+			_last_rtcm_injection_time = hrt_absolute_time();
+		}
+	}
 
-	} while (updated && num_injections < max_num_injections);
+	if (injected) {
+		// flush once per batch instead of after every fragment
+		::fsync(_serial_fd);
+	}
 }
 
-bool GPS::injectData(uint8_t *data, size_t len)
+bool GPS::injectData(const uint8_t *data, size_t len, bool flush)
 {
 	dumpGpsData(data, len, gps_dump_comm_mode_t::Full, true);
 
 	size_t written = ::write(_serial_fd, data, len);
-	::fsync(_serial_fd);
+
+	if (flush) {
+		::fsync(_serial_fd);
+	}
+
 	return written == len;
 }
 
@@ -715,7 +741,7 @@ void GPS::initializeCommunicationDump()
 	_dump_communication_mode = (gps_dump_comm_mode_t)param_dump_comm;
 }
 
-void GPS::dumpGpsData(uint8_t *data, size_t len, gps_dump_comm_mode_t mode, bool msg_to_gps_device)
+void GPS::dumpGpsData(const uint8_t *data, size_t len, gps_dump_comm_mode_t mode, bool msg_to_gps_device)
 {
 	gps_dump_s *dump_data  = msg_to_gps_device ? _dump_to_device : _dump_from_device;
 
@@ -1287,9 +1313,21 @@ GPS::publishRTCMCorrections(uint8_t *data, size_t len)
 			gps_inject_data.len = capacity;
 		}
 
-		memcpy(gps_inject_data.data, &data[written], gps_inject_data.len);
+		// fill the queue slot in place if possible, saving the copy of the whole message
+		gps_inject_data_s *loaned = _gps_inject_data_pub.loan();
+
+		if (loaned != nullptr) {
+			loaned->timestamp = gps_inject_data.timestamp;
+			loaned->device_id = gps_inject_data.device_id;
+			loaned->len = gps_inject_data.len;
+			loaned->flags = gps_inject_data.flags;
+			memcpy(loaned->data, &data[written], gps_inject_data.len);
+			_gps_inject_data_pub.publish_loaned();
 
-		_gps_inject_data_pub.publish(gps_inject_data);
+		} else {
+			memcpy(gps_inject_data.data, &data[written], gps_inject_data.len);
+			_gps_inject_data_pub.publish(gps_inject_data);
+		}
 
 		written = written + gps_inject_data.len;
 	}
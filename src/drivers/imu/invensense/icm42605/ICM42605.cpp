@@ -56,6 +56,8 @@ ICM42605::ICM42605(const I2CSPIDriverConfig &config) :
 
 ICM42605::~ICM42605()
 {
+	free(_fifo_buffer);
+
 	perf_free(_bad_register_perf);
 	perf_free(_bad_transfer_perf);
 	perf_free(_fifo_empty_perf);
@@ -66,6 +68,14 @@ ICM42605::~ICM42605()
 
 int ICM42605::init()
 {
+	if (_fifo_buffer == nullptr) {
+		_fifo_buffer = static_cast<FIFOTransferBuffer *>(px4_cache_aligned_alloc(sizeof(FIFOTransferBuffer)));
+
+		if (_fifo_buffer == nullptr) {
+			return -ENOMEM;
+		}
+	}
+
 	int ret = SPI::init();
 
 	if (ret != PX4_OK) {
@@ -523,7 +533,8 @@ uint16_t ICM42605::FIFOReadCount()
 
 bool ICM42605::FIFORead(const hrt_abstime &timestamp_sample, uint8_t samples)
 {
-	FIFOTransferBuffer buffer{};
+	FIFOTransferBuffer &buffer = *_fifo_buffer;
+	buffer.cmd = static_cast<uint8_t>(Register::BANK_0::INT_STATUS) | DIR_READ;
 	const size_t transfer_size = math::min(samples * sizeof(FIFO::DATA) + 4, FIFO::SIZE);
 	SelectRegisterBank(REG_BANK_SEL_BIT::USER_BANK_0);
 
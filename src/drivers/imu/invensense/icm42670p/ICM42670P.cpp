@@ -56,6 +56,8 @@ ICM42670P::ICM42670P(const I2CSPIDriverConfig &config):
 
 ICM42670P::~ICM42670P()
 {
+	free(_fifo_buffer);
+
 	perf_free(_bad_register_perf);
 	perf_free(_bad_transfer_perf);
 	perf_free(_fifo_empty_perf);
@@ -66,6 +68,14 @@ ICM42670P::~ICM42670P()
 
 int ICM42670P::init()
 {
+	if (_fifo_buffer == nullptr) {
+		_fifo_buffer = static_cast<FIFOTransferBuffer *>(px4_cache_aligned_alloc(sizeof(FIFOTransferBuffer)));
+
+		if (_fifo_buffer == nullptr) {
+			return -ENOMEM;
+		}
+	}
+
 	int ret = SPI::init();
 
 	if (ret != PX4_OK) {
@@ -486,7 +496,8 @@ uint16_t ICM42670P::FIFOReadCount()
 
 bool ICM42670P::FIFORead(const hrt_abstime &timestamp_sample, uint8_t samples)
 {
-	FIFOTransferBuffer buffer{};
+	FIFOTransferBuffer &buffer = *_fifo_buffer;
+	buffer.cmd = static_cast<uint8_t>(Register::BANK_0::INT_STATUS) | DIR_READ;
 	const size_t transfer_size = math::min(samples * sizeof(FIFO::DATA) + 6, FIFO::SIZE);
 
 	if (transfer((uint8_t *)&buffer, (uint8_t *)&buffer, transfer_size) != PX4_OK) {
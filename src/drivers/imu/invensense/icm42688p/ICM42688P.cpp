@@ -532,7 +532,16 @@ uint16_t ICM42688P::FIFOReadCount()
 
 bool ICM42688P::FIFORead(const hrt_abstime &timestamp_sample, uint8_t samples)
 {
-	FIFOTransferBuffer buffer{};
+	// DMA capable buffer shared with the other sensors on the bus (they run on the same work queue)
+	px4::DMALease<FIFOTransferBuffer> lease{};
+
+	if (lease.get() == nullptr) {
+		perf_count(_bad_transfer_perf);
+		return false;
+	}
+
+	FIFOTransferBuffer &buffer = *lease.get();
+	buffer.cmd = static_cast<uint8_t>(Register::BANK_0::INT_STATUS) | DIR_READ;
 	const size_t transfer_size = math::min(samples * sizeof(FIFO::DATA) + 4, FIFO::SIZE);
 	SelectRegisterBank(REG_BANK_SEL_BIT::BANK_SEL_0);
 
@@ -84,6 +84,8 @@ ICM45686::ICM45686(const I2CSPIDriverConfig &config) :
 
 ICM45686::~ICM45686()
 {
+	free(_fifo_buffer);
+
 	perf_free(_bad_register_perf);
 	perf_free(_bad_transfer_perf);
 	perf_free(_fifo_empty_perf);
@@ -93,6 +95,14 @@ ICM45686::~ICM45686()
 
 int ICM45686::init()
 {
+	if (_fifo_buffer == nullptr) {
+		_fifo_buffer = static_cast<FIFOTransferBuffer *>(px4_cache_aligned_alloc(sizeof(FIFOTransferBuffer)));
+
+		if (_fifo_buffer == nullptr) {
+			return -ENOMEM;
+		}
+	}
+
 	int ret = SPI::init();
 
 	if (ret != PX4_OK) {
@@ -405,7 +415,8 @@ bool ICM45686::FIFORead(const hrt_abstime &timestamp_sample)
 		return false;
 	}
 
-	FIFOTransferBuffer buffer{};
+	FIFOTransferBuffer &buffer = *_fifo_buffer;
+	buffer.cmd = static_cast<uint8_t>(Register::BANK_0::FIFO_DATA) | DIR_READ;
 	const size_t transfer_size = math::min(sizeof(FIFOTransferBuffer), fifo_packets * sizeof(FIFO::DATA) + 1);
 
 	if (transfer((uint8_t *)&buffer, (uint8_t *)&buffer, transfer_size) != PX4_OK) {
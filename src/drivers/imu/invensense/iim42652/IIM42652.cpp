@@ -70,6 +70,8 @@ IIM42652::IIM42652(const I2CSPIDriverConfig &config) :
 
 IIM42652::~IIM42652()
 {
+	free(_fifo_buffer);
+
 	perf_free(_bad_register_perf);
 	perf_free(_bad_transfer_perf);
 	perf_free(_fifo_empty_perf);
@@ -80,6 +82,14 @@ IIM42652::~IIM42652()
 
 int IIM42652::init()
 {
+	if (_fifo_buffer == nullptr) {
+		_fifo_buffer = static_cast<FIFOTransferBuffer *>(px4_cache_aligned_alloc(sizeof(FIFOTransferBuffer)));
+
+		if (_fifo_buffer == nullptr) {
+			return -ENOMEM;
+		}
+	}
+
 	int ret = SPI::init();
 
 	if (ret != PX4_OK) {
@@ -520,7 +530,8 @@ uint16_t IIM42652::FIFOReadCount()
 
 bool IIM42652::FIFORead(const hrt_abstime &timestamp_sample, uint8_t samples)
 {
-	FIFOTransferBuffer buffer{};
+	FIFOTransferBuffer &buffer = *_fifo_buffer;
+	buffer.cmd = static_cast<uint8_t>(Register::BANK_0::INT_STATUS) | DIR_READ;
 	const size_t transfer_size = math::min(samples * sizeof(FIFO::DATA) + 4, FIFO::SIZE);
 	SelectRegisterBank(REG_BANK_SEL_BIT::BANK_SEL_0);
 
@@ -70,6 +70,26 @@ VectorNav::VectorNav(const char *port) :
 		v = 0;
 		param_set(param_find("SENS_IMU_MODE"), &v);
 
+		// SENS_MAG_MODE (VN handles sensor selection)
+		v = 0;
+		param_set(param_find("SENS_MAG_MODE"), &v);
+
+	} else if (_param_vn_mode.get() == 2) {
+		// VN_MODE 2 INS with EKF2 monitor
+		int32_t v = 0;
+
+		// SYS_MC_EST_GROUP 2 (EKF2)
+		v = 2;
+		param_set(param_find("SYS_MC_EST_GROUP"), &v);
+
+		// EKF2_MONITOR 1 (EKF2 publishes the estimator topics only)
+		v = 1;
+		param_set(param_find("EKF2_MONITOR"), &v);
+
+		// SENS_IMU_MODE (VN handles sensor selection)
+		v = 0;
+		param_set(param_find("SENS_IMU_MODE"), &v);
+
 		// SENS_MAG_MODE (VN handles sensor selection)
 		v = 0;
 		param_set(param_find("SENS_MAG_MODE"), &v);
@@ -356,7 +376,7 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 			perf_count(_global_position_pub_interval_perf);
 		}
 
-		// publish estimator_status (VN_MODE 1 only)
+		// publish estimator_status (VN_MODE 1 only, the EKF2 monitor publishes it in VN_MODE 2)
 		if (_param_vn_mode.get() == 1) {
 
 			estimator_status_s estimator_status{};
@@ -716,7 +736,7 @@ void VectorNav::Run()
 		const hrt_abstime time_configured_us = _time_configured_us.load();
 		const hrt_abstime time_last_valid_imu_us = _time_last_valid_imu_us.load();
 
-		if (_param_vn_mode.get() == 1) {
+		if (_param_vn_mode.get() != 0) {
 			if ((time_last_valid_imu_us != 0) && (hrt_elapsed_time(&time_last_valid_imu_us) < 3_s))
 
 				// update sensor_selection if configured in INS mode
@@ -62,6 +62,7 @@ CrsfRc::~CrsfRc()
 {
 	perf_free(_cycle_interval_perf);
 	perf_free(_publish_interval_perf);
+	perf_free(_telemetry_sent_perf);
 }
 
 int CrsfRc::task_spawn(int argc, char *argv[])
@@ -223,116 +224,29 @@ void CrsfRc::Run()
 
 		if (_param_rc_crsf_tel_en.get() && !_is_singlewire
 		    && (_input_rc.timestamp > _telemetry_update_last + 100_ms)) {
-			switch (_next_type) {
-			case 0:
-				battery_status_s battery_status;
-
-				if (_battery_status_sub.update(&battery_status)) {
-					uint16_t voltage = battery_status.voltage_filtered_v * 10;
-					uint16_t current = battery_status.current_filtered_a * 10;
-					int fuel = battery_status.discharged_mah;
-					uint8_t remaining = battery_status.remaining * 100;
-					this->SendTelemetryBattery(voltage, current, fuel, remaining);
-				}
+			// Each slot goes to the data type that was sent the longest time ago and has new data,
+			// so a type without updates (e.g. no GPS) does not waste the slot.
+			bool tried[num_data_types] {};
 
-				break;
+			for (int attempt = 0; attempt < num_data_types; attempt++) {
+				int type = -1;
 
-			case 1:
-				sensor_gps_s sensor_gps;
-
-				if (_vehicle_gps_position_sub.update(&sensor_gps)) {
-					int32_t latitude = static_cast<int32_t>(round(sensor_gps.latitude_deg * 1e7));
-					int32_t longitude = static_cast<int32_t>(round(sensor_gps.longitude_deg * 1e7));
-					uint16_t groundspeed = sensor_gps.vel_d_m_s / 3.6f * 10.f;
-					uint16_t gps_heading = math::degrees(sensor_gps.cog_rad) * 100.f;
-					uint16_t altitude = static_cast<int16_t>(sensor_gps.altitude_msl_m * 1e3) + 1000;
-					uint8_t num_satellites = sensor_gps.satellites_used;
-					this->SendTelemetryGps(latitude, longitude, groundspeed, gps_heading, altitude, num_satellites);
+				for (int i = 0; i < num_data_types; i++) {
+					if (!tried[i] && ((type < 0) || (_telemetry_last_sent[i] < _telemetry_last_sent[type]))) {
+						type = i;
+					}
 				}
 
-				break;
-
-			case 2:
-				vehicle_attitude_s vehicle_attitude;
+				tried[type] = true;
 
-				if (_vehicle_attitude_sub.update(&vehicle_attitude)) {
-					matrix::Eulerf attitude = matrix::Quatf(vehicle_attitude.q);
-					int16_t pitch = attitude(1) * 1e4f;
-					int16_t roll = attitude(0) * 1e4f;
-					int16_t yaw = attitude(2) * 1e4f;
-					this->SendTelemetryAttitude(pitch, roll, yaw);
+				if (SendTelemetry(type)) {
+					_telemetry_last_sent[type] = time_now_us;
+					perf_count(_telemetry_sent_perf);
+					break;
 				}
-
-				break;
-
-			case 3:
-				vehicle_status_s vehicle_status;
-
-				if (_vehicle_status_sub.update(&vehicle_status)) {
-					const char *flight_mode = "(unknown)";
-
-					switch (vehicle_status.nav_state) {
-					case vehicle_status_s::NAVIGATION_STATE_MANUAL:
-						flight_mode = "Manual";
-						break;
-
-					case vehicle_status_s::NAVIGATION_STATE_ALTCTL:
-						flight_mode = "Altitude";
-						break;
-
-					case vehicle_status_s::NAVIGATION_STATE_POSCTL:
-						flight_mode = "Position";
-						break;
-
-					case vehicle_status_s::NAVIGATION_STATE_AUTO_RTL:
-						flight_mode = "Return";
-						break;
-
-					case vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION:
-						flight_mode = "Mission";
-						break;
-
-					case vehicle_status_s::NAVIGATION_STATE_AUTO_LOITER:
-					case vehicle_status_s::NAVIGATION_STATE_DESCEND:
-					case vehicle_status_s::NAVIGATION_STATE_AUTO_TAKEOFF:
-					case vehicle_status_s::NAVIGATION_STATE_AUTO_LAND:
-					case vehicle_status_s::NAVIGATION_STATE_AUTO_FOLLOW_TARGET:
-					case vehicle_status_s::NAVIGATION_STATE_AUTO_PRECLAND:
-						flight_mode = "Auto";
-						break;
-
-					/*case vehicle_status_s::NAVIGATION_STATE_AUTO_LANDENGFAIL:
-						flight_mode = "Failure";
-						break;*/
-
-					case vehicle_status_s::NAVIGATION_STATE_ACRO:
-						flight_mode = "Acro";
-						break;
-
-					case vehicle_status_s::NAVIGATION_STATE_TERMINATION:
-						flight_mode = "Terminate";
-						break;
-
-					case vehicle_status_s::NAVIGATION_STATE_OFFBOARD:
-						flight_mode = "Offboard";
-						break;
-
-					case vehicle_status_s::NAVIGATION_STATE_STAB:
-						flight_mode = "Stabilized";
-						break;
-
-					default:
-						flight_mode = "Unknown";
-					}
-
-					this->SendTelemetryFlightMode(flight_mode);
-				}
-
-				break;
 			}
 
 			_telemetry_update_last = _input_rc.timestamp;
-			_next_type = (_next_type + 1) % num_data_types;
 		}
 	}
 
@@ -422,6 +336,119 @@ void CrsfRc::WriteFrameCrc(uint8_t *buf, int &offset, const int buf_size)
 	write_uint8_t(buf, offset, Crc8Calc(buf + 2, buf_size - 3));
 }
 
+bool CrsfRc::SendTelemetry(int type)
+{
+	switch (type) {
+	case 0:
+		battery_status_s battery_status;
+
+		if (_battery_status_sub.update(&battery_status)) {
+			uint16_t voltage = battery_status.voltage_filtered_v * 10;
+			uint16_t current = battery_status.current_filtered_a * 10;
+			int fuel = battery_status.discharged_mah;
+			uint8_t remaining = battery_status.remaining * 100;
+			return this->SendTelemetryBattery(voltage, current, fuel, remaining);
+		}
+
+		break;
+
+	case 1:
+		sensor_gps_s sensor_gps;
+
+		if (_vehicle_gps_position_sub.update(&sensor_gps)) {
+			int32_t latitude = static_cast<int32_t>(round(sensor_gps.latitude_deg * 1e7));
+			int32_t longitude = static_cast<int32_t>(round(sensor_gps.longitude_deg * 1e7));
+			uint16_t groundspeed = sensor_gps.vel_d_m_s / 3.6f * 10.f;
+			uint16_t gps_heading = math::degrees(sensor_gps.cog_rad) * 100.f;
+			uint16_t altitude = static_cast<int16_t>(sensor_gps.altitude_msl_m * 1e3) + 1000;
+			uint8_t num_satellites = sensor_gps.satellites_used;
+			return this->SendTelemetryGps(latitude, longitude, groundspeed, gps_heading, altitude, num_satellites);
+		}
+
+		break;
+
+	case 2:
+		vehicle_attitude_s vehicle_attitude;
+
+		if (_vehicle_attitude_sub.update(&vehicle_attitude)) {
+			matrix::Eulerf attitude = matrix::Quatf(vehicle_attitude.q);
+			int16_t pitch = attitude(1) * 1e4f;
+			int16_t roll = attitude(0) * 1e4f;
+			int16_t yaw = attitude(2) * 1e4f;
+			return this->SendTelemetryAttitude(pitch, roll, yaw);
+		}
+
+		break;
+
+	case 3:
+		vehicle_status_s vehicle_status;
+
+		if (_vehicle_status_sub.update(&vehicle_status)) {
+			const char *flight_mode = "(unknown)";
+
+			switch (vehicle_status.nav_state) {
+			case vehicle_status_s::NAVIGATION_STATE_MANUAL:
+				flight_mode = "Manual";
+				break;
+
+			case vehicle_status_s::NAVIGATION_STATE_ALTCTL:
+				flight_mode = "Altitude";
+				break;
+
+			case vehicle_status_s::NAVIGATION_STATE_POSCTL:
+				flight_mode = "Position";
+				break;
+
+			case vehicle_status_s::NAVIGATION_STATE_AUTO_RTL:
+				flight_mode = "Return";
+				break;
+
+			case vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION:
+				flight_mode = "Mission";
+				break;
+
+			case vehicle_status_s::NAVIGATION_STATE_AUTO_LOITER:
+			case vehicle_status_s::NAVIGATION_STATE_DESCEND:
+			case vehicle_status_s::NAVIGATION_STATE_AUTO_TAKEOFF:
+			case vehicle_status_s::NAVIGATION_STATE_AUTO_LAND:
+			case vehicle_status_s::NAVIGATION_STATE_AUTO_FOLLOW_TARGET:
+			case vehicle_status_s::NAVIGATION_STATE_AUTO_PRECLAND:
+				flight_mode = "Auto";
+				break;
+
+			/*case vehicle_status_s::NAVIGATION_STATE_AUTO_LANDENGFAIL:
+				flight_mode = "Failure";
+				break;*/
+
+			case vehicle_status_s::NAVIGATION_STATE_ACRO:
+				flight_mode = "Acro";
+				break;
+
+			case vehicle_status_s::NAVIGATION_STATE_TERMINATION:
+				flight_mode = "Terminate";
+				break;
+
+			case vehicle_status_s::NAVIGATION_STATE_OFFBOARD:
+				flight_mode = "Offboard";
+				break;
+
+			case vehicle_status_s::NAVIGATION_STATE_STAB:
+				flight_mode = "Stabilized";
+				break;
+
+			default:
+				flight_mode = "Unknown";
+			}
+
+			return this->SendTelemetryFlightMode(flight_mode);
+		}
+
+		break;
+	}
+
+	return false;
+}
+
 bool CrsfRc::SendTelemetryBattery(const uint16_t voltage, const uint16_t current, const int fuel,
 				  const uint8_t remaining)
 {
@@ -499,6 +526,7 @@ int CrsfRc::print_status()
 
 	perf_print_counter(_cycle_interval_perf);
 	perf_print_counter(_publish_interval_perf);
+	perf_print_counter(_telemetry_sent_perf);
 
 	PX4_INFO_RAW("Disposed bytes: %" PRIu32 "\n", _packet_parser_statistics.disposed_bytes);
 	PX4_INFO_RAW("Valid known packet CRCs: %" PRIu32 "\n", _packet_parser_statistics.crcs_valid_known_packets);
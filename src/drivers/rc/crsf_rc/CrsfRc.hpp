@@ -78,6 +78,12 @@ private:
 
 	input_rc_s _input_rc{};
 
+	/**
+	 * Send one telemetry frame of the given data type if there is new data for it.
+	 * @return true if a frame was sent
+	 */
+	bool SendTelemetry(int type);
+
 	bool SendTelemetryBattery(const uint16_t voltage, const uint16_t current, const int fuel, const uint8_t remaining);
 
 	bool SendTelemetryGps(const int32_t latitude, const int32_t longitude, const uint16_t groundspeed,
@@ -102,7 +108,7 @@ private:
 	// telemetry
 	hrt_abstime _telemetry_update_last{0};
 	static constexpr int num_data_types{4}; ///< number of different telemetry data types
-	int _next_type{0};
+	hrt_abstime _telemetry_last_sent[num_data_types] {}; ///< last time each data type was sent, to pick the most stale one
 	uORB::Subscription _battery_status_sub{ORB_ID(battery_status)};
 	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
 	uORB::Subscription _vehicle_gps_position_sub{ORB_ID(vehicle_gps_position)};
@@ -138,6 +144,7 @@ private:
 
 	perf_counter_t	_cycle_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": cycle interval")};
 	perf_counter_t	_publish_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": publish interval")};
+	perf_counter_t	_telemetry_sent_perf{perf_alloc(PC_COUNT, MODULE_NAME": telemetry sent")};
 
 	DEFINE_PARAMETERS(
 		(ParamBool<px4::params::RC_CRSF_TEL_EN>) _param_rc_crsf_tel_en
@@ -67,6 +67,22 @@ struct BitTimingSettings {
 	bool isValid() const { return canbtr != 0; }
 };
 
+#if defined(UAVCAN_SUPPORT_CANFD) && UAVCAN_SUPPORT_CANFD
+// CAN FD data length codes 9..15 map to 12, 16, 20, 24, 32, 48 and 64 bytes
+constexpr uint8_t dlc_to_len[16] {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+uint8_t dataLengthToDlc(uint8_t len)
+{
+	uint8_t dlc = 0;
+
+	while ((dlc < 15) && (dlc_to_len[dlc] < len)) {
+		dlc++;
+	}
+
+	return dlc;
+}
+#endif // UAVCAN_SUPPORT_CANFD
+
 } // namespace
 
 uavcan::uint32_t CanIface::socketInit(uint32_t index)
@@ -75,8 +91,12 @@ uavcan::uint32_t CanIface::socketInit(uint32_t index)
 	struct sockaddr_can addr;
 	struct ifreq ifr;
 
-	//FIXME Change this when we update to DroneCAN with CAN FD support
-	bool can_fd = 0;
+#if defined(UAVCAN_SUPPORT_CANFD) && UAVCAN_SUPPORT_CANFD
+	// FD sockets also send and receive classic frames, selected by the frame size
+	const bool can_fd = true;
+#else
+	const bool can_fd = false;
+#endif // UAVCAN_SUPPORT_CANFD
 
 	_can_fd = can_fd;
 
@@ -177,17 +197,25 @@ uavcan::int16_t CanIface::send(const uavcan::CanFrame &frame, uavcan::MonotonicT
 {
 	int res = -1;
 
-	/* Copy CanardFrame to can_frame/canfd_frame */
-	if (_can_fd) {
+	/* Copy uavcan::CanFrame to can_frame/canfd_frame */
+#if defined(UAVCAN_SUPPORT_CANFD) && UAVCAN_SUPPORT_CANFD
+
+	if (_can_fd && frame.canfd) {
+		const uint8_t len = dlc_to_len[frame.dlc & 0xF];
 		_send_frame.can_id = frame.id | CAN_EFF_FLAG;
-		_send_frame.len = frame.dlc;
-		memcpy(&_send_frame.data, frame.data, frame.dlc);
+		_send_frame.len = len;
+		_send_frame.flags = CANFD_BRS;
+		memcpy(&_send_frame.data, frame.data, len);
+		_send_iov.iov_len = sizeof(struct canfd_frame);
 
-	} else {
+	} else
+#endif // UAVCAN_SUPPORT_CANFD
+	{
 		struct can_frame *net_frame = (struct can_frame *)&_send_frame;
 		net_frame->can_id = frame.id | CAN_EFF_FLAG;
 		net_frame->can_dlc = frame.dlc;
 		memcpy(&net_frame->data, frame.data, frame.dlc);
+		_send_iov.iov_len = sizeof(struct can_frame);
 	}
 
 	/* Set CAN_RAW_TX_DEADLINE timestamp  */
@@ -213,15 +241,20 @@ uavcan::int16_t CanIface::receive(uavcan::CanFrame &out_frame, uavcan::Monotonic
 		return result;
 	}
 
-	/* Copy SocketCAN frame to CanardFrame */
+	/* Copy SocketCAN frame to uavcan::CanFrame, an FD socket tells the frame type by its size */
+#if defined(UAVCAN_SUPPORT_CANFD) && UAVCAN_SUPPORT_CANFD
 
-	if (_can_fd) {
+	if (_can_fd && ((size_t)result == sizeof(struct canfd_frame))) {
 		struct canfd_frame *recv_frame = (struct canfd_frame *)&_recv_frame;
+		const uint8_t dlc = dataLengthToDlc(recv_frame->len);
 		out_frame.id = recv_frame->can_id;
-		out_frame.dlc = recv_frame->len;
-		memcpy(out_frame.data, &recv_frame->data, recv_frame->len);
+		out_frame.dlc = dlc;
+		out_frame.canfd = true;
+		memcpy(out_frame.data, &recv_frame->data, dlc_to_len[dlc]);
 
-	} else {
+	} else
+#endif // UAVCAN_SUPPORT_CANFD
+	{
 		struct can_frame *recv_frame = (struct can_frame *)&_recv_frame;
 		out_frame.id = recv_frame->can_id;
 		out_frame.dlc = recv_frame->can_dlc;
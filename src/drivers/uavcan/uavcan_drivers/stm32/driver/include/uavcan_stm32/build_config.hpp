@@ -26,3 +26,21 @@
 // In this case the clock driver should be implemented by the application
 # define UAVCAN_STM32_TIMER_NUMBER 0
 #endif
+
+/**
+ * Number of TX mailboxes (0..2) reserved for frames with a transfer priority of
+ * UAVCAN_STM32_TX_RESERVED_PRIORITY or higher (numerically lower), e.g. actuator commands.
+ * Other frames can only use the remaining mailboxes, so that high priority frames never
+ * wait for a free mailbox behind them. 0 disables the reservation.
+ */
+#ifndef UAVCAN_STM32_TX_RESERVED_MAILBOXES
+# define UAVCAN_STM32_TX_RESERVED_MAILBOXES 0
+#endif
+
+#ifndef UAVCAN_STM32_TX_RESERVED_PRIORITY
+# define UAVCAN_STM32_TX_RESERVED_PRIORITY 6
+#endif
+
+#if (UAVCAN_STM32_TX_RESERVED_MAILBOXES < 0) || (UAVCAN_STM32_TX_RESERVED_MAILBOXES > 2)
+# error "UAVCAN_STM32_TX_RESERVED_MAILBOXES must be in the range 0..2"
+#endif
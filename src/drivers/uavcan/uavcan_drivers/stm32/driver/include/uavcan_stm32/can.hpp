@@ -96,11 +96,19 @@ class CanIface : public uavcan::ICanIface, uavcan::Noncopyable
 		bool pending;
 		bool loopback;
 		bool abort_on_error;
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+		bool reserved;
+		uavcan::uint64_t load_usec;
+#endif
 
 		TxItem()
 			: pending(false)
 			, loopback(false)
 			, abort_on_error(false)
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+			, reserved(false)
+			, load_usec(0)
+#endif
 		{ }
 	};
 
@@ -119,6 +127,27 @@ class CanIface : public uavcan::ICanIface, uavcan::Noncopyable
 	const uavcan::uint8_t self_index_;
 	bool had_activity_;
 
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+	uavcan::uint32_t reserved_tx_count_;
+	uavcan::uint32_t reserved_tx_latency_max_usec_;
+	uavcan::uint64_t reserved_tx_latency_sum_usec_;
+
+	/**
+	 * Whether the frame may use the reserved TX mailboxes.
+	 */
+	static bool isReservedPriority(const uavcan::CanFrame &frame)
+	{
+		// transfer priority in the 5 most significant bits of the 29 bit identifier
+		return frame.isExtended() &&
+		       (((frame.id & uavcan::CanFrame::MaskExtID) >> 24) <= UAVCAN_STM32_TX_RESERVED_PRIORITY);
+	}
+#endif
+
+	/**
+	 * TSR_TMEx bits of the mailboxes the frame may be loaded into.
+	 */
+	static uavcan::uint32_t usableTxMailboxes(const uavcan::CanFrame &frame);
+
 	int computeTimings(uavcan::uint32_t target_bitrate, Timings &out_timings);
 
 	virtual uavcan::int16_t send(const uavcan::CanFrame &frame, uavcan::MonotonicTime tx_deadline,
@@ -154,6 +183,11 @@ public:
 		, peak_tx_mailbox_index_(0)
 		, self_index_(self_index)
 		, had_activity_(false)
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+		, reserved_tx_count_(0)
+		, reserved_tx_latency_max_usec_(0)
+		, reserved_tx_latency_sum_usec_(0)
+#endif
 	{
 		UAVCAN_ASSERT(self_index_ < UAVCAN_STM32_NUM_IFACES);
 	}
@@ -221,6 +255,16 @@ public:
 	 * Value of 3 suggests that priority inversion could be taking place.
 	 */
 	uavcan::uint8_t getPeakNumTxMailboxesUsed() const { return uavcan::uint8_t(peak_tx_mailbox_index_ + 1); }
+
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+	/**
+	 * Frames sent with a reserved priority and the time from loading them into a mailbox
+	 * until the transmission completed (bus arbitration and transmission).
+	 */
+	uavcan::uint32_t getReservedTxCount() const { return reserved_tx_count_; }
+	uavcan::uint32_t getReservedTxLatencyMaxUSec() const { return reserved_tx_latency_max_usec_; }
+	uavcan::uint32_t getReservedTxLatencyMeanUSec() const;
+#endif
 };
 
 /**
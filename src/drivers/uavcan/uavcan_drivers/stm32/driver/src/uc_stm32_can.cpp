@@ -322,14 +322,15 @@ uavcan::int16_t CanIface::send(const uavcan::CanFrame &frame, uavcan::MonotonicT
 	 * Seeking for an empty slot
 	 */
 	uavcan::uint8_t txmailbox = 0xFF;
+	const uavcan::uint32_t tme = can_->TSR & usableTxMailboxes(frame);
 
-	if ((can_->TSR & bxcan::TSR_TME0) == bxcan::TSR_TME0) {
+	if ((tme & bxcan::TSR_TME0) == bxcan::TSR_TME0) {
 		txmailbox = 0;
 
-	} else if ((can_->TSR & bxcan::TSR_TME1) == bxcan::TSR_TME1) {
+	} else if ((tme & bxcan::TSR_TME1) == bxcan::TSR_TME1) {
 		txmailbox = 1;
 
-	} else if ((can_->TSR & bxcan::TSR_TME2) == bxcan::TSR_TME2) {
+	} else if ((tme & bxcan::TSR_TME2) == bxcan::TSR_TME2) {
 		txmailbox = 2;
 
 	} else {
@@ -375,10 +376,46 @@ uavcan::int16_t CanIface::send(const uavcan::CanFrame &frame, uavcan::MonotonicT
 	txi.frame          = frame;
 	txi.loopback       = (flags & uavcan::CanIOFlagLoopback) != 0;
 	txi.abort_on_error = (flags & uavcan::CanIOFlagAbortOnError) != 0;
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+	txi.reserved       = isReservedPriority(frame);
+
+	if (txi.reserved) {
+		txi.load_usec = clock::getMonotonic().toUSec();
+	}
+
+#endif
 	txi.pending        = true;
 	return 1;
 }
 
+uavcan::uint32_t CanIface::usableTxMailboxes(const uavcan::CanFrame &frame)
+{
+	static const uavcan::uint32_t TME = bxcan::TSR_TME0 | bxcan::TSR_TME1 | bxcan::TSR_TME2;
+
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+
+	if (!isReservedPriority(frame)) {
+		// the reserved mailboxes are the last ones
+		static const uavcan::uint32_t TME_UNRESERVED = (UAVCAN_STM32_TX_RESERVED_MAILBOXES == 1) ?
+				(bxcan::TSR_TME0 | bxcan::TSR_TME1) : bxcan::TSR_TME0;
+		return TME_UNRESERVED;
+	}
+
+#else
+	(void)frame;
+#endif
+
+	return TME;
+}
+
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+uavcan::uint32_t CanIface::getReservedTxLatencyMeanUSec() const
+{
+	CriticalSectionLocker lock;
+	return (reserved_tx_count_ > 0) ? uavcan::uint32_t(reserved_tx_latency_sum_usec_ / reserved_tx_count_) : 0;
+}
+#endif
+
 uavcan::int16_t CanIface::receive(uavcan::CanFrame &out_frame, uavcan::MonotonicTime &out_ts_monotonic,
 				  uavcan::UtcTime &out_ts_utc, uavcan::CanIOFlags &out_flags)
 {
@@ -604,6 +641,20 @@ void CanIface::handleTxMailboxInterrupt(uavcan::uint8_t mailbox_index, bool txok
 		rx_queue_.push(txi.frame, utc_usec, uavcan::CanIOFlagLoopback);
 	}
 
+#if UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0
+
+	if (txi.reserved && txok && txi.pending) {
+		const uavcan::uint64_t latency_usec = clock::getMonotonic().toUSec() - txi.load_usec;
+		reserved_tx_count_++;
+		reserved_tx_latency_sum_usec_ += latency_usec;
+
+		if (latency_usec > reserved_tx_latency_max_usec_) {
+			reserved_tx_latency_max_usec_ = uavcan::uint32_t(latency_usec);
+		}
+	}
+
+#endif
+
 	txi.pending = false;
 }
 
@@ -745,7 +796,7 @@ bool CanIface::canAcceptNewTxFrame(const uavcan::CanFrame &frame) const
 			return true;
 		}
 
-		if (tme == 0) {     // All TX mailboxes are busy transmitting.
+		if ((tme & usableTxMailboxes(frame)) == 0) {     // All TX mailboxes usable by this frame are busy transmitting.
 			return false;
 		}
 	}
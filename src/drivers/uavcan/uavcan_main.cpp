@@ -1057,6 +1057,17 @@ UavcanNode::print_info()
 			printf("\tIO errors: %" PRIu64 "\n", iface_perf_cnt.errors);
 			printf("\tRX frames: %" PRIu64 "\n", iface_perf_cnt.frames_rx);
 			printf("\tTX frames: %" PRIu64 "\n", iface_perf_cnt.frames_tx);
+
+#if defined(UAVCAN_STM32_NUTTX) && (UAVCAN_STM32_TX_RESERVED_MAILBOXES > 0)
+			auto stm32_iface = (can != nullptr) ? can->driver.getIface(i) : nullptr;
+
+			if (stm32_iface) {
+				printf("\tTX reserved: %" PRIu32 " frames, latency mean %" PRIu32 " us, max %" PRIu32 " us, peak mailboxes %u\n",
+				       stm32_iface->getReservedTxCount(), stm32_iface->getReservedTxLatencyMeanUSec(),
+				       stm32_iface->getReservedTxLatencyMaxUSec(), stm32_iface->getPeakNumTxMailboxesUsed());
+			}
+
+#endif
 		}
 	}
 
@@ -0,0 +1,112 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file IntrusiveMPSCQueue.hpp
+ *
+ * Intrusive lock-free multiple producer, single consumer queue.
+ *
+ * Producers push nodes with a single compare-and-swap, from any thread or interrupt.
+ * The consumer takes all pending nodes at once (in push order). A node must not be
+ * pushed again before the consumer has taken it, callers that can schedule the same
+ * node from several contexts need their own "queued" flag.
+ */
+
+#pragma once
+
+#include <stdlib.h>
+
+template<class T>
+class IntrusiveMPSCQueue
+{
+public:
+
+	bool empty() const { return __atomic_load_n(&_head, __ATOMIC_RELAXED) == nullptr; }
+
+	/**
+	 * Add a node, can be called concurrently by any number of producers.
+	 */
+	void push(T newNode)
+	{
+		T head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+
+		do {
+			newNode->set_next_intrusive_mpsc_queue_node(head);
+		} while (!__atomic_compare_exchange_n(&_head, &head, newNode, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+	}
+
+	/**
+	 * Take all pending nodes and call func(node) for each of them in push order.
+	 * Must only be called by one consumer at a time. The node link is cleared
+	 * before func is called, so the node can be pushed again from within func.
+	 */
+	template<typename Func>
+	void pop_all(Func func)
+	{
+		T node = __atomic_exchange_n(&_head, nullptr, __ATOMIC_ACQUIRE);
+
+		// nodes are linked newest first, reverse to get push order
+		T reversed = nullptr;
+
+		while (node != nullptr) {
+			T next = node->next_intrusive_mpsc_queue_node();
+			node->set_next_intrusive_mpsc_queue_node(reversed);
+			reversed = node;
+			node = next;
+		}
+
+		while (reversed != nullptr) {
+			T next = reversed->next_intrusive_mpsc_queue_node();
+			reversed->set_next_intrusive_mpsc_queue_node(nullptr);
+			func(reversed);
+			reversed = next;
+		}
+	}
+
+private:
+
+	T _head{nullptr};
+};
+
+template<class T>
+class IntrusiveMPSCQueueNode
+{
+private:
+	friend IntrusiveMPSCQueue<T>;
+
+	T next_intrusive_mpsc_queue_node() const { return _next_intrusive_mpsc_queue_node; }
+	void set_next_intrusive_mpsc_queue_node(T new_next) { _next_intrusive_mpsc_queue_node = new_next; }
+
+	T _next_intrusive_mpsc_queue_node{nullptr};
+};
@@ -74,6 +74,45 @@ public:
 		_tail = newNode;
 	}
 
+	/**
+	 * Insert a node before the first node it should run before, or at the end (stable).
+	 * @param before comparison before(newNode, node), true if newNode goes before node
+	 */
+	template<typename Compare>
+	void push_sorted(T newNode, Compare before)
+	{
+		// error, node already queued or already inserted
+		if ((newNode->next_intrusive_queue_node() != nullptr) || (newNode == _tail)) {
+			return;
+		}
+
+		if ((_head == nullptr) || before(newNode, _head)) {
+			newNode->set_next_intrusive_queue_node(_head);
+			_head = newNode;
+
+			if (_tail == nullptr) {
+				_tail = newNode;
+			}
+
+			return;
+		}
+
+		for (T node = _head; node != nullptr; node = node->next_intrusive_queue_node()) {
+			T next = node->next_intrusive_queue_node();
+
+			if ((next == nullptr) || before(newNode, next)) {
+				newNode->set_next_intrusive_queue_node(next);
+				node->set_next_intrusive_queue_node(newNode);
+
+				if (next == nullptr) {
+					_tail = newNode;
+				}
+
+				return;
+			}
+		}
+	}
+
 	T pop()
 	{
 		T ret = _head;
@@ -92,6 +92,161 @@ void AdsbConflict::detect_traffic_conflict(double lat_now, double lon_now, float
 			      && collision_time_check);
 }
 
+bool AdsbConflict::detect_traffic_conflict_horizon(const transponder_report_s &traffic, float age, double lat_now,
+		double lon_now, float alt_now, float vx_now, float vy_now, float vz_now, float &distance)
+{
+	// relative position of the traffic (north, east, up)
+	float north, east;
+	get_vector_to_next_waypoint(lat_now, lon_now, traffic.lat, traffic.lon, &north, &east);
+	float up = traffic.altitude - alt_now;
+
+	const float traffic_vn = traffic.hor_velocity * cosf(traffic.heading);
+	const float traffic_ve = traffic.hor_velocity * sinf(traffic.heading);
+
+	north += traffic_vn * age;
+	east += traffic_ve * age;
+	up += traffic.ver_velocity * age;
+
+	distance = sqrtf(north * north + east * east);
+
+	// relative velocity, the vehicle velocity is NED
+	const float vn = traffic_vn - vx_now;
+	const float ve = traffic_ve - vy_now;
+	const float vu = traffic.ver_velocity + vz_now;
+
+	const float v_hor_sq = vn * vn + ve * ve;
+
+	float t_cpa = 0.f;
+
+	if (v_hor_sq > FLT_EPSILON) {
+		t_cpa = math::constrain(-(north * vn + east * ve) / v_hor_sq, 0.f,
+					(float)_conflict_detection_params.collision_time_threshold);
+	}
+
+	const float north_cpa = north + vn * t_cpa;
+	const float east_cpa = east + ve * t_cpa;
+	const float up_cpa = up + vu * t_cpa;
+
+	return (sqrtf(north_cpa * north_cpa + east_cpa * east_cpa) < _conflict_detection_params.crosstrack_separation)
+	       && (fabsf(up_cpa) < _conflict_detection_params.vertical_separation);
+}
+
+#if defined(CONFIG_ADSB_TRAFFIC_TABLE)
+void AdsbConflict::update_traffic(const transponder_report_s &report)
+{
+	_traffic_table.update(report, hrt_absolute_time());
+}
+
+bool AdsbConflict::process_traffic(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now,
+				   float vz_now)
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	bool take_action = false;
+
+	float max_traffic_speed = 0.f;
+
+	for (int i = 0; i < AdsbTrafficTable::CAPACITY; i++) {
+		AdsbTrafficTable::Entry &entry = _traffic_table.entry(i);
+
+		if (!entry.used) {
+			continue;
+		}
+
+		if (now > entry.last_update + TRAFFIC_TABLE_TIMEOUT) {
+			// lost traffic, clear its conflict
+			if (entry.in_conflict) {
+				_transponder_report = entry.report;
+				_traffic_state = TRAFFIC_STATE::REMOVE_OLD_CONFLICT;
+				report_traffic_state(0.f);
+			}
+
+			_traffic_table.remove(i);
+			continue;
+		}
+
+		max_traffic_speed = math::max(max_traffic_speed, entry.report.hor_velocity);
+	}
+
+	// traffic further away can not violate the horizontal separation within the prediction horizon
+	const float radius = _conflict_detection_params.crosstrack_separation
+			     + (max_traffic_speed + sqrtf(vx_now * vx_now + vy_now * vy_now))
+			     * (_conflict_detection_params.collision_time_threshold + TRAFFIC_TABLE_TIMEOUT * 1e-6f);
+
+	int num_candidates = _traffic_table.query(lat_now, lon_now, radius, _traffic_candidates, AdsbTrafficTable::CAPACITY);
+
+	// keep evaluating the traffic in conflict until it is resolved, even if it jumped out of the search area
+	for (int i = 0; i < AdsbTrafficTable::CAPACITY; i++) {
+		if (_traffic_table.entry(i).used && _traffic_table.entry(i).in_conflict) {
+			bool found = false;
+
+			for (int j = 0; j < num_candidates && !found; j++) {
+				found = (_traffic_candidates[j] == i);
+			}
+
+			if (!found && (num_candidates < AdsbTrafficTable::CAPACITY)) {
+				_traffic_candidates[num_candidates++] = i;
+			}
+		}
+	}
+
+	for (int n = 0; n < TRAFFIC_EVALUATIONS_PER_CYCLE; n++) {
+		int next = -1;
+
+		for (int j = 0; j < num_candidates; j++) {
+			const AdsbTrafficTable::Entry &entry = _traffic_table.entry(_traffic_candidates[j]);
+
+			const bool due = entry.updated || (now > entry.last_evaluation + TRAFFIC_REEVALUATION_INTERVAL);
+
+			if (due && ((next < 0) || (entry.last_evaluation < _traffic_table.entry(next).last_evaluation))) {
+				next = _traffic_candidates[j];
+			}
+		}
+
+		if (next < 0) {
+			break;
+		}
+
+		AdsbTrafficTable::Entry &entry = _traffic_table.entry(next);
+		entry.updated = false;
+		entry.last_evaluation = now;
+
+		float distance = 0.f;
+		_conflict_detected = detect_traffic_conflict_horizon(entry.report, (now - entry.last_update) * 1e-6f,
+				     lat_now, lon_now, alt_now, vx_now, vy_now, vz_now, distance);
+
+		_transponder_report = entry.report;
+		get_traffic_state(entry, now);
+
+		if (report_traffic_state(distance)) {
+			take_action = true;
+		}
+	}
+
+	return take_action;
+}
+
+void AdsbConflict::get_traffic_state(AdsbTrafficTable::Entry &entry, hrt_abstime now)
+{
+	if (_conflict_detected && !entry.in_conflict) {
+		entry.in_conflict = true;
+		entry.warning_time = now;
+		_traffic_state = TRAFFIC_STATE::ADD_CONFLICT;
+
+	} else if (_conflict_detected && (now > entry.warning_time + CONFLICT_WARNING_TIMEOUT)) {
+		entry.warning_time = now;
+		_traffic_state = TRAFFIC_STATE::REMIND_CONFLICT;
+
+	} else if (!_conflict_detected && entry.in_conflict) {
+		entry.in_conflict = false;
+		_traffic_state = TRAFFIC_STATE::REMOVE_OLD_CONFLICT;
+
+	} else {
+		_traffic_state = TRAFFIC_STATE::NO_CONFLICT;
+	}
+}
+#endif // CONFIG_ADSB_TRAFFIC_TABLE
+
 int AdsbConflict::find_icao_address_in_conflict_list(uint32_t icao_address)
 {
 
@@ -160,6 +315,11 @@ bool AdsbConflict::handle_traffic_conflict()
 
 	get_traffic_state();
 
+	return report_traffic_state(_crosstrack_error.distance);
+}
+
+bool AdsbConflict::report_traffic_state(float separation)
+{
 	char uas_id[UTM_GUID_MSG_LENGTH]; //GUID of incoming UTM messages
 
 	//convert UAS_id byte array to char array for User Warning
@@ -182,7 +342,7 @@ bool AdsbConflict::handle_traffic_conflict()
 	case TRAFFIC_STATE::REMIND_CONFLICT: {
 
 			take_action = send_traffic_warning(math::degrees(_transponder_report.heading) + 180,
-							   (int)fabsf(_crosstrack_error.distance), _transponder_report.flags, uas_id,
+							   (int)fabsf(separation), _transponder_report.flags, uas_id,
 							   _transponder_report.callsign,
 							   uas_id_int);
 
@@ -209,7 +369,7 @@ bool AdsbConflict::handle_traffic_conflict()
 
 			//stop buffering incoming conflicts
 			take_action = send_traffic_warning(math::degrees(_transponder_report.heading) + 180,
-							   (int)fabsf(_crosstrack_error.distance), _transponder_report.flags, uas_id,
+							   (int)fabsf(separation), _transponder_report.flags, uas_id,
 							   _transponder_report.callsign,
 							   uas_id_int);
 
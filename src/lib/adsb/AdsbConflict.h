@@ -53,6 +53,8 @@
 
 #include <containers/Array.hpp>
 
+#include "AdsbTrafficTable.h"
+
 using namespace time_literals;
 
 static constexpr uint8_t NAVIGATOR_MAX_TRAFFIC{10};
@@ -65,6 +67,16 @@ static constexpr uint64_t CONFLICT_WARNING_TIMEOUT{60_s};
 
 static constexpr float TRAFFIC_TO_UAV_DISTANCE_EXTENSION{1000.0f};
 
+static constexpr uint64_t TRAFFIC_TABLE_TIMEOUT{20_s};
+
+static constexpr uint64_t TRAFFIC_REEVALUATION_INTERVAL{1_s};
+
+#if defined(CONFIG_ADSB_TRAFFIC_EVALUATIONS_PER_CYCLE)
+static constexpr int TRAFFIC_EVALUATIONS_PER_CYCLE {CONFIG_ADSB_TRAFFIC_EVALUATIONS_PER_CYCLE};
+#else
+static constexpr int TRAFFIC_EVALUATIONS_PER_CYCLE {8};
+#endif // CONFIG_ADSB_TRAFFIC_EVALUATIONS_PER_CYCLE
+
 
 struct traffic_data_s {
 	double lat_traffic;
@@ -105,6 +117,33 @@ public:
 
 	void detect_traffic_conflict(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now, float vz_now);
 
+	/**
+	 * Detect a conflict at the closest point of approach within the collision time threshold,
+	 * assuming constant velocities of the traffic and the vehicle.
+	 *
+	 * @param traffic transponder report of the traffic
+	 * @param age time since the report was received in seconds, the traffic position is propagated by it
+	 * @param distance returns the current horizontal distance to the traffic in meters
+	 * @return true if the horizontal and vertical separation are both violated at the closest point of approach
+	 */
+	bool detect_traffic_conflict_horizon(const transponder_report_s &traffic, float age, double lat_now, double lon_now,
+					     float alt_now, float vx_now, float vy_now, float vz_now, float &distance);
+
+#if defined(CONFIG_ADSB_TRAFFIC_TABLE)
+	/**
+	 * Insert a transponder report into the traffic table, conflicts are evaluated in process_traffic().
+	 */
+	void update_traffic(const transponder_report_s &report);
+
+	/**
+	 * Expire old traffic and evaluate the conflicts of at most TRAFFIC_EVALUATIONS_PER_CYCLE traffic
+	 * around the vehicle, the ones evaluated least recently first.
+	 *
+	 * @return true if a conflict requires an action
+	 */
+	bool process_traffic(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now, float vz_now);
+#endif // CONFIG_ADSB_TRAFFIC_TABLE
+
 	int find_icao_address_in_conflict_list(uint32_t icao_address);
 
 	void remove_icao_address_from_conflict_list(int traffic_index);
@@ -142,8 +181,18 @@ public:
 protected:
 	traffic_buffer_s _traffic_buffer;
 
+#if defined(CONFIG_ADSB_TRAFFIC_TABLE)
+	void get_traffic_state(AdsbTrafficTable::Entry &entry, hrt_abstime now);
+
+	AdsbTrafficTable _traffic_table;
+
+	int16_t _traffic_candidates[AdsbTrafficTable::CAPACITY];
+#endif // CONFIG_ADSB_TRAFFIC_TABLE
+
 private:
 
+	bool report_traffic_state(float separation);
+
 	orb_advert_t _mavlink_log_pub{nullptr};
 
 	crosstrack_error_s _crosstrack_error{};
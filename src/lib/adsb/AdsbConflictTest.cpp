@@ -75,6 +75,54 @@ TEST_F(AdsbConflictTest, detectTrafficConflict)
 }
 
 
+TEST_F(AdsbConflictTest, detectTrafficConflictHorizon)
+{
+	TestAdsbConflict adsb_conflict;
+	adsb_conflict.set_conflict_detection_params(500.0f, 500.0f, 60, 1);
+
+	const double lat_now = 32.617013;
+	const double lon_now = -96.490564;
+	const float alt_now = 1000.0f;
+
+	transponder_report_s traffic{};
+	waypoint_from_heading_and_distance(lat_now, lon_now, 0.0f, 5000.0f, &traffic.lat, &traffic.lon);
+	traffic.altitude = alt_now;
+	traffic.hor_velocity = 100.0f;
+
+	float distance = 0.0f;
+
+	// head-on, closest point of approach after 50 s
+	traffic.heading = M_PI_F;
+	EXPECT_TRUE(adsb_conflict.detect_traffic_conflict_horizon(traffic, 0.0f, lat_now, lon_now, alt_now, 0.0f, 0.0f, 0.0f,
+			distance));
+	EXPECT_NEAR(distance, 5000.0f, 1.0f);
+
+	// the report is 20 s old, the traffic is closer already
+	EXPECT_TRUE(adsb_conflict.detect_traffic_conflict_horizon(traffic, 20.0f, lat_now, lon_now, alt_now, 0.0f, 0.0f, 0.0f,
+			distance));
+	EXPECT_NEAR(distance, 3000.0f, 1.0f);
+
+	// vehicle flying away as fast as the traffic
+	EXPECT_FALSE(adsb_conflict.detect_traffic_conflict_horizon(traffic, 0.0f, lat_now, lon_now, alt_now, -100.0f, 0.0f,
+			0.0f, distance));
+
+	// vertically separated
+	EXPECT_FALSE(adsb_conflict.detect_traffic_conflict_horizon(traffic, 0.0f, lat_now, lon_now, alt_now + 600.0f, 0.0f,
+			0.0f, 0.0f, distance));
+
+	// flying away from the vehicle
+	traffic.heading = 0.0f;
+	EXPECT_FALSE(adsb_conflict.detect_traffic_conflict_horizon(traffic, 0.0f, lat_now, lon_now, alt_now, 0.0f, 0.0f, 0.0f,
+			distance));
+
+	// head-on but too far away for the horizon
+	waypoint_from_heading_and_distance(lat_now, lon_now, 0.0f, 20000.0f, &traffic.lat, &traffic.lon);
+	traffic.heading = M_PI_F;
+	EXPECT_FALSE(adsb_conflict.detect_traffic_conflict_horizon(traffic, 0.0f, lat_now, lon_now, alt_now, 0.0f, 0.0f, 0.0f,
+			distance));
+}
+
+
 TEST_F(AdsbConflictTest, trafficAlerts)
 {
 
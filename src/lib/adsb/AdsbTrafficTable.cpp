@@ -0,0 +1,290 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "AdsbTrafficTable.h"
+
+#include <lib/geo/geo.h>
+#include <mathlib/mathlib.h>
+
+#include <math.h>
+
+constexpr int AdsbTrafficTable::CAPACITY;
+
+void AdsbTrafficTable::clear()
+{
+	for (int i = 0; i < ICAO_SLOTS; i++) {
+		_icao_index[i] = -1;
+	}
+
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		_buckets[i] = -1;
+	}
+
+	// pop the low indices first
+	for (int i = 0; i < CAPACITY; i++) {
+		_entries[i].used = false;
+		_free[i] = CAPACITY - 1 - i;
+	}
+
+	_num_free = CAPACITY;
+	_size = 0;
+}
+
+int32_t AdsbTrafficTable::cell_lat(double lat)
+{
+	return static_cast<int32_t>(floor((lat + 90.0) / CELL_SIZE_DEG));
+}
+
+int32_t AdsbTrafficTable::cell_lon(double lon)
+{
+	return static_cast<int32_t>(floor((lon + 180.0) / CELL_SIZE_DEG));
+}
+
+int AdsbTrafficTable::bucket(int32_t cell_lat, int32_t cell_lon)
+{
+	const uint32_t hash = (static_cast<uint32_t>(cell_lat) * 73856093u) ^ (static_cast<uint32_t>(cell_lon) * 19349663u);
+	return hash % NUM_BUCKETS;
+}
+
+int AdsbTrafficTable::icao_slot(uint32_t icao_address)
+{
+	// ICAO addresses are allocated in blocks per country, mix the bits
+	return (icao_address * 2654435761u) % ICAO_SLOTS;
+}
+
+int AdsbTrafficTable::find(uint32_t icao_address) const
+{
+	int slot = icao_slot(icao_address);
+
+	// the table is at most half full, there is always a free slot ending the probe sequence
+	while (_icao_index[slot] >= 0) {
+		if (_entries[_icao_index[slot]].report.icao_address == icao_address) {
+			return _icao_index[slot];
+		}
+
+		slot = (slot + 1) % ICAO_SLOTS;
+	}
+
+	return -1;
+}
+
+void AdsbTrafficTable::link_bucket(int index)
+{
+	Entry &e = _entries[index];
+	const int b = bucket(e.cell_lat, e.cell_lon);
+	e.next_in_bucket = _buckets[b];
+	_buckets[b] = index;
+}
+
+void AdsbTrafficTable::unlink_bucket(int index)
+{
+	Entry &e = _entries[index];
+	int16_t *link = &_buckets[bucket(e.cell_lat, e.cell_lon)];
+
+	while (*link >= 0) {
+		if (*link == index) {
+			*link = e.next_in_bucket;
+			break;
+		}
+
+		link = &_entries[*link].next_in_bucket;
+	}
+
+	e.next_in_bucket = -1;
+}
+
+void AdsbTrafficTable::remove_icao(int index)
+{
+	int slot = icao_slot(_entries[index].report.icao_address);
+
+	while (_icao_index[slot] != index) {
+		if (_icao_index[slot] < 0) {
+			return;
+		}
+
+		slot = (slot + 1) % ICAO_SLOTS;
+	}
+
+	// backward shift deletion, move entries up that would not be found behind the free slot anymore
+	int next = slot;
+
+	for (;;) {
+		_icao_index[slot] = -1;
+
+		int home;
+
+		do {
+			next = (next + 1) % ICAO_SLOTS;
+
+			if (_icao_index[next] < 0) {
+				return;
+			}
+
+			home = icao_slot(_entries[_icao_index[next]].report.icao_address);
+
+		} while ((slot <= next) ? ((slot < home) && (home <= next)) : ((slot < home) || (home <= next)));
+
+		_icao_index[slot] = _icao_index[next];
+		slot = next;
+	}
+}
+
+int AdsbTrafficTable::update(const transponder_report_s &report, hrt_abstime now)
+{
+	int index = find(report.icao_address);
+
+	const int32_t new_cell_lat = cell_lat(report.lat);
+	const int32_t new_cell_lon = cell_lon(report.lon);
+
+	if (index >= 0) {
+		Entry &e = _entries[index];
+
+		if ((e.cell_lat != new_cell_lat) || (e.cell_lon != new_cell_lon)) {
+			unlink_bucket(index);
+			e.cell_lat = new_cell_lat;
+			e.cell_lon = new_cell_lon;
+			link_bucket(index);
+		}
+
+	} else {
+		if (_num_free == 0) {
+			int oldest = 0;
+
+			for (int i = 1; i < CAPACITY; i++) {
+				const Entry &candidate = _entries[i];
+				const Entry &current = _entries[oldest];
+
+				if ((candidate.in_conflict == current.in_conflict) ? (candidate.last_update < current.last_update)
+				    : current.in_conflict) {
+					oldest = i;
+				}
+			}
+
+			remove(oldest);
+		}
+
+		index = _free[--_num_free];
+		_size++;
+
+		Entry &e = _entries[index];
+		e.used = true;
+		e.in_conflict = false;
+		e.last_evaluation = 0;
+		e.warning_time = 0;
+		e.cell_lat = new_cell_lat;
+		e.cell_lon = new_cell_lon;
+		link_bucket(index);
+
+		int slot = icao_slot(report.icao_address);
+
+		while (_icao_index[slot] >= 0) {
+			slot = (slot + 1) % ICAO_SLOTS;
+		}
+
+		_icao_index[slot] = index;
+	}
+
+	Entry &e = _entries[index];
+	e.report = report;
+	e.last_update = now;
+	e.updated = true;
+
+	return index;
+}
+
+void AdsbTrafficTable::remove(int index)
+{
+	if ((index < 0) || (index >= CAPACITY) || !_entries[index].used) {
+		return;
+	}
+
+	remove_icao(index);
+	unlink_bucket(index);
+
+	_entries[index].used = false;
+	_free[_num_free++] = index;
+	_size--;
+}
+
+int AdsbTrafficTable::query(double lat, double lon, float radius, int16_t *indices, int max_count) const
+{
+	const double dlat = math::degrees(static_cast<double>(radius) / CONSTANTS_RADIUS_OF_EARTH);
+	const double dlon = dlat / math::max(cos(math::radians(lat)), 0.01);
+
+	const int32_t lat_min = cell_lat(lat - dlat);
+	const int32_t lat_max = cell_lat(lat + dlat);
+	const int32_t lon_min = cell_lon(lon - dlon);
+	const int32_t lon_max = cell_lon(lon + dlon);
+
+	const int64_t num_cells = static_cast<int64_t>(lat_max - lat_min + 1) * (lon_max - lon_min + 1);
+
+	// be conservative around the poles and the antimeridian, and scan everything if the
+	// search area covers more cells than there are buckets
+	const bool full_scan = (num_cells > NUM_BUCKETS) || (lat - dlat < -90.0) || (lat + dlat > 90.0)
+			       || (lon - dlon < -180.0) || (lon + dlon >= 180.0);
+
+	int count = 0;
+
+	auto add = [&](int index) {
+		const Entry &e = _entries[index];
+
+		if ((count < max_count)
+		    && (get_distance_to_next_waypoint(lat, lon, e.report.lat, e.report.lon) <= radius)) {
+			indices[count++] = index;
+		}
+	};
+
+	if (full_scan) {
+		for (int i = 0; (i < CAPACITY) && (count < max_count); i++) {
+			if (_entries[i].used) {
+				add(i);
+			}
+		}
+
+		return count;
+	}
+
+	for (int32_t clat = lat_min; clat <= lat_max; clat++) {
+		for (int32_t clon = lon_min; clon <= lon_max; clon++) {
+			for (int index = _buckets[bucket(clat, clon)]; index >= 0; index = _entries[index].next_in_bucket) {
+				// buckets are shared by several cells
+				if ((_entries[index].cell_lat == clat) && (_entries[index].cell_lon == clon)) {
+					add(index);
+				}
+			}
+		}
+	}
+
+	return count;
+}
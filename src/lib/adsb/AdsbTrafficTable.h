@@ -0,0 +1,137 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file AdsbTrafficTable.h
+ *
+ * Fixed size table of the traffic in the vicinity, looked up by ICAO address
+ * and indexed by position on a grid of cells to select the traffic that
+ * needs to be evaluated for conflicts.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <drivers/drv_hrt.h>
+#include <uORB/topics/transponder_report.h>
+
+#if defined(CONFIG_ADSB_TRAFFIC_TABLE_SIZE)
+static constexpr int ADSB_TRAFFIC_TABLE_SIZE {CONFIG_ADSB_TRAFFIC_TABLE_SIZE};
+#else
+static constexpr int ADSB_TRAFFIC_TABLE_SIZE {64};
+#endif // CONFIG_ADSB_TRAFFIC_TABLE_SIZE
+
+class AdsbTrafficTable
+{
+public:
+	static constexpr int CAPACITY{ADSB_TRAFFIC_TABLE_SIZE};
+
+	// grid cell size of the spatial index, about 5.5 km in latitude
+	static constexpr double CELL_SIZE_DEG{0.05};
+
+	struct Entry {
+		transponder_report_s report;
+		hrt_abstime last_update;	///< time the last report was received
+		hrt_abstime last_evaluation;	///< time of the last conflict evaluation, 0 if never
+		hrt_abstime warning_time;	///< time of the last conflict warning
+		int32_t cell_lat;		///< grid cell of the last reported position
+		int32_t cell_lon;
+		int16_t next_in_bucket;		///< next entry in the same spatial bucket, -1 if last
+		bool used;
+		bool updated;			///< updated since the last conflict evaluation
+		bool in_conflict;
+	};
+
+	AdsbTrafficTable() { clear(); }
+	~AdsbTrafficTable() = default;
+
+	void clear();
+
+	/**
+	 * Insert or update the traffic with the ICAO address of the report.
+	 * If the table is full the traffic that was not updated for the longest time is replaced,
+	 * traffic that is not in conflict first.
+	 *
+	 * @param report the transponder report
+	 * @param now current time
+	 * @return index of the entry
+	 */
+	int update(const transponder_report_s &report, hrt_abstime now);
+
+	/**
+	 * @return index of the traffic with the given ICAO address, -1 if not in the table
+	 */
+	int find(uint32_t icao_address) const;
+
+	void remove(int index);
+
+	/**
+	 * Collect the traffic within a radius around a position.
+	 *
+	 * @param lat latitude in degrees
+	 * @param lon longitude in degrees
+	 * @param radius search radius in meters
+	 * @param indices output buffer for the entry indices
+	 * @param max_count size of the output buffer
+	 * @return number of entries written to indices
+	 */
+	int query(double lat, double lon, float radius, int16_t *indices, int max_count) const;
+
+	Entry &entry(int index) { return _entries[index]; }
+	const Entry &entry(int index) const { return _entries[index]; }
+
+	int size() const { return _size; }
+
+private:
+	static constexpr int ICAO_SLOTS{2 * CAPACITY};
+	static constexpr int NUM_BUCKETS{CAPACITY};
+
+	static int32_t cell_lat(double lat);
+	static int32_t cell_lon(double lon);
+	static int bucket(int32_t cell_lat, int32_t cell_lon);
+	static int icao_slot(uint32_t icao_address);
+
+	void link_bucket(int index);
+	void unlink_bucket(int index);
+	void remove_icao(int index);
+
+	Entry _entries[CAPACITY] {};
+
+	int16_t _icao_index[ICAO_SLOTS];	///< open addressing ICAO address -> entry, -1 if free
+	int16_t _buckets[NUM_BUCKETS];		///< spatial hash of the grid cells -> first entry, -1 if empty
+	int16_t _free[CAPACITY];		///< stack of the free entries
+	int _num_free{0};
+	int _size{0};
+};
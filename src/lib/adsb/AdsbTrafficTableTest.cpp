@@ -0,0 +1,153 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "AdsbTrafficTable.h"
+
+#include <lib/geo/geo.h>
+
+using namespace time_literals;
+
+static transponder_report_s make_report(uint32_t icao_address, double lat, double lon)
+{
+	transponder_report_s report{};
+	report.icao_address = icao_address;
+	report.lat = lat;
+	report.lon = lon;
+	return report;
+}
+
+TEST(AdsbTrafficTableTest, insertFindRemove)
+{
+	AdsbTrafficTable table;
+
+	for (uint32_t i = 0; i < AdsbTrafficTable::CAPACITY; i++) {
+		table.update(make_report(1000 + i * 64, 47.0, 8.0), 1_s);
+	}
+
+	EXPECT_EQ(table.size(), AdsbTrafficTable::CAPACITY);
+
+	for (uint32_t i = 0; i < AdsbTrafficTable::CAPACITY; i++) {
+		const int index = table.find(1000 + i * 64);
+		ASSERT_GE(index, 0);
+		EXPECT_EQ(table.entry(index).report.icao_address, 1000 + i * 64);
+	}
+
+	EXPECT_EQ(table.find(999), -1);
+
+	// remove every other traffic, the others must still be found
+	for (uint32_t i = 0; i < AdsbTrafficTable::CAPACITY; i += 2) {
+		table.remove(table.find(1000 + i * 64));
+	}
+
+	EXPECT_EQ(table.size(), AdsbTrafficTable::CAPACITY / 2);
+
+	for (uint32_t i = 0; i < AdsbTrafficTable::CAPACITY; i++) {
+		EXPECT_EQ(table.find(1000 + i * 64) >= 0, (i % 2) == 1);
+	}
+}
+
+TEST(AdsbTrafficTableTest, updateExisting)
+{
+	AdsbTrafficTable table;
+
+	const int index = table.update(make_report(42, 47.0, 8.0), 1_s);
+	table.entry(index).updated = false;
+
+	// moving to another cell keeps the entry
+	EXPECT_EQ(table.update(make_report(42, 47.3, 8.3), 2_s), index);
+	EXPECT_EQ(table.size(), 1);
+	EXPECT_TRUE(table.entry(index).updated);
+	EXPECT_EQ(table.entry(index).last_update, 2_s);
+
+	int16_t indices[AdsbTrafficTable::CAPACITY];
+	EXPECT_EQ(table.query(47.0, 8.0, 1000.f, indices, AdsbTrafficTable::CAPACITY), 0);
+	ASSERT_EQ(table.query(47.3, 8.3, 1000.f, indices, AdsbTrafficTable::CAPACITY), 1);
+	EXPECT_EQ(indices[0], index);
+}
+
+TEST(AdsbTrafficTableTest, evictOldest)
+{
+	AdsbTrafficTable table;
+
+	for (uint32_t i = 0; i < AdsbTrafficTable::CAPACITY; i++) {
+		table.update(make_report(i + 1, 47.0, 8.0), (i + 1) * 1_s);
+	}
+
+	// the oldest traffic is in conflict and has to be kept
+	table.entry(table.find(1)).in_conflict = true;
+
+	table.update(make_report(5000, 47.0, 8.0), 1000_s);
+
+	EXPECT_EQ(table.size(), AdsbTrafficTable::CAPACITY);
+	EXPECT_GE(table.find(5000), 0);
+	EXPECT_GE(table.find(1), 0);
+	EXPECT_EQ(table.find(2), -1);
+}
+
+TEST(AdsbTrafficTableTest, query)
+{
+	AdsbTrafficTable table;
+
+	const double lat = 32.617013;
+	const double lon = -96.490564;
+
+	// traffic on a ring every 1 km up to 20 km
+	uint32_t icao_address = 1;
+
+	for (int distance = 1000; distance <= 20000; distance += 1000) {
+		for (int direction = 0; direction < 3; direction++) {
+			double lat_traffic, lon_traffic;
+			waypoint_from_heading_and_distance(lat, lon, direction * 2.1f, distance, &lat_traffic, &lon_traffic);
+			table.update(make_report(icao_address++, lat_traffic, lon_traffic), 1_s);
+		}
+	}
+
+	int16_t indices[AdsbTrafficTable::CAPACITY];
+
+	const int count = table.query(lat, lon, 5500.f, indices, AdsbTrafficTable::CAPACITY);
+	EXPECT_EQ(count, 15);
+
+	for (int i = 0; i < count; i++) {
+		const AdsbTrafficTable::Entry &entry = table.entry(indices[i]);
+		EXPECT_LE(get_distance_to_next_waypoint(lat, lon, entry.report.lat, entry.report.lon), 5500.f);
+	}
+
+	// a search area bigger than the index scans all traffic
+	EXPECT_EQ(table.query(lat, lon, 500000.f, indices, AdsbTrafficTable::CAPACITY), table.size());
+
+	// bounded by the output buffer
+	EXPECT_EQ(table.query(lat, lon, 500000.f, indices, 4), 4);
+}
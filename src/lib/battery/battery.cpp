@@ -96,6 +96,9 @@ Battery::Battery(int index, ModuleParams *parent, const int sample_interval_us,
 
 	_param_handles.bat_avrg_current = param_find("BAT_AVRG_CURRENT");
 
+	snprintf(param_name, sizeof(param_name), "BAT%d_MODEL", _index);
+	_param_handles.model = param_find(param_name);
+
 	updateParams();
 }
 
@@ -131,6 +134,11 @@ void Battery::updateBatteryStatus(const hrt_abstime &timestamp)
 	_battery_initialized = _connected && (timestamp > _last_unconnected_timestamp + 2_s);
 
 	sumDischarged(timestamp, _current_a);
+
+	if (_params.model & MODEL_ESTIMATE_R_INTERNAL) {
+		estimateInternalResistance(_voltage_v, _current_a);
+	}
+
 	_state_of_charge_volt_based =
 		calculateStateOfChargeVoltageBased(_voltage_filter_v.getState(), _current_filter_a.getState());
 
@@ -213,9 +221,11 @@ float Battery::calculateStateOfChargeVoltageBased(const float voltage_v, const f
 	// remaining battery capacity based on voltage
 	float cell_voltage = voltage_v / _params.n_cells;
 
+	const float r_internal = (_params.model & MODEL_ESTIMATE_R_INTERNAL) ? _r_internal_estimate : _params.r_internal;
+
 	// correct battery voltage locally for load drop to avoid estimation fluctuations
-	if (_params.r_internal >= 0.f && current_a > FLT_EPSILON) {
-		cell_voltage += _params.r_internal * current_a;
+	if (r_internal >= 0.f && current_a > FLT_EPSILON) {
+		cell_voltage += r_internal * current_a;
 
 	} else {
 		vehicle_thrust_setpoint_s vehicle_thrust_setpoint{};
@@ -233,9 +243,47 @@ float Battery::calculateStateOfChargeVoltageBased(const float voltage_v, const f
 		cell_voltage += throttle * _params.v_load_drop;
 	}
 
+	_cell_voltage_no_load = cell_voltage;
+
+	if (_params.model & MODEL_DISCHARGE_CURVE) {
+		return dischargeCurveStateOfCharge(math::interpolate(cell_voltage, _params.v_empty, _params.v_charged, 0.f, 1.f));
+	}
+
 	return math::interpolate(cell_voltage, _params.v_empty, _params.v_charged, 0.f, 1.f);
 }
 
+float Battery::dischargeCurveStateOfCharge(float normalized_cell_voltage)
+{
+	// State of charge over the normalized no-load cell voltage (0: V_EMPTY, 1: V_CHARGED) of a typical
+	// lithium polymer cell. The voltage is flat over most of the capacity and drops steeply close to empty.
+	static constexpr float state_of_charge[] {0.f, 0.028f, 0.080f, 0.212f, 0.369f, 0.527f, 0.619f, 0.685f, 0.764f, 0.816f, 0.877f, 0.947f, 1.f};
+
+	return math::interpolateN(math::constrain(normalized_cell_voltage, 0.f, 1.f), state_of_charge);
+}
+
+void Battery::estimateInternalResistance(float voltage_v, float current_a)
+{
+	// use the voltage change on current steps, the open circuit voltage barely changes between two samples
+	static constexpr float CURRENT_STEP_MIN_A = 2.f;
+	static constexpr float R_INTERNAL_MAX = 0.2f; // maximum of BATn_R_INTERNAL
+	static constexpr float FILTER_ALPHA = 0.05f;
+
+	if (_params.n_cells > 0 && current_a >= 0.f && _r_estimate_current_prev >= 0.f) {
+		const float current_step_a = current_a - _r_estimate_current_prev;
+
+		if (fabsf(current_step_a) > CURRENT_STEP_MIN_A) {
+			const float r_internal = -(voltage_v - _r_estimate_voltage_prev) / current_step_a / _params.n_cells;
+
+			if (PX4_ISFINITE(r_internal) && (r_internal >= 0.f) && (r_internal <= R_INTERNAL_MAX)) {
+				_r_internal_estimate += FILTER_ALPHA * (r_internal - _r_internal_estimate);
+			}
+		}
+	}
+
+	_r_estimate_voltage_prev = voltage_v;
+	_r_estimate_current_prev = current_a;
+}
+
 void Battery::estimateStateOfCharge()
 {
 	// choose which quantity we're using for final reporting
@@ -290,7 +338,12 @@ void Battery::computeScale()
 	const float voltage_range = (_params.v_charged - _params.v_empty);
 
 	// reusing capacity calculation to get single cell voltage before drop
-	const float bat_v = _params.v_empty + (voltage_range * _state_of_charge_volt_based);
+	float bat_v = _params.v_empty + (voltage_range * _state_of_charge_volt_based);
+
+	if (_params.model & MODEL_DISCHARGE_CURVE) {
+		// the state of charge is not linear in the voltage with the discharge curve
+		bat_v = math::constrain(_cell_voltage_no_load, _params.v_empty, _params.v_charged);
+	}
 
 	_scale = _params.v_charged / bat_v;
 
@@ -347,6 +400,14 @@ void Battery::updateParams()
 	param_get(_param_handles.emergen_thr, &_params.emergen_thr);
 	param_get(_param_handles.bat_avrg_current, &_params.bat_avrg_current);
 
+	if (_param_handles.model == PARAM_INVALID || param_get(_param_handles.model, &_params.model) != PX4_OK) {
+		_params.model = 0;
+	}
+
+	if (_r_internal_estimate < 0.f) {
+		_r_internal_estimate = (_params.r_internal >= 0.f) ? _params.r_internal : 0.005f;
+	}
+
 	ModuleParams::updateParams();
 
 	_first_parameter_update = false;
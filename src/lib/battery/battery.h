@@ -112,6 +112,10 @@ public:
 protected:
 	static constexpr float LITHIUM_BATTERY_RECOGNITION_VOLTAGE = 2.1f;
 
+	// BAT${i}_MODEL bits
+	static constexpr int32_t MODEL_DISCHARGE_CURVE = (1 << 0);
+	static constexpr int32_t MODEL_ESTIMATE_R_INTERNAL = (1 << 1);
+
 	struct {
 		param_t v_empty;
 		param_t v_charged;
@@ -124,6 +128,7 @@ protected:
 		param_t emergen_thr;
 		param_t source;
 		param_t bat_avrg_current;
+		param_t model;
 	} _param_handles{};
 
 	struct {
@@ -138,6 +143,7 @@ protected:
 		float emergen_thr;
 		int32_t source;
 		float bat_avrg_current;
+		int32_t model;
 	} _params{};
 
 	const int _index;
@@ -153,6 +159,8 @@ private:
 	uint16_t determineFaults();
 	void computeScale();
 	float computeRemainingTime(float current_a);
+	void estimateInternalResistance(float voltage_v, float current_a);
+	static float dischargeCurveStateOfCharge(float normalized_cell_voltage);
 
 	uORB::Subscription _vehicle_thrust_setpoint_0_sub{ORB_ID(vehicle_thrust_setpoint)};
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
@@ -179,4 +187,9 @@ private:
 	hrt_abstime _last_timestamp{0};
 	bool _armed{false};
 	hrt_abstime _last_unconnected_timestamp{0};
+
+	float _cell_voltage_no_load{0.f}; ///< load compensated cell voltage of the last state of charge update
+	float _r_internal_estimate{-1.f}; ///< online per cell internal resistance estimate [Ohm], negative if unavailable
+	float _r_estimate_voltage_prev{0.f};
+	float _r_estimate_current_prev{-1.f};
 };
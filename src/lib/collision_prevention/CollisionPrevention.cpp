@@ -90,6 +90,11 @@ CollisionPrevention::CollisionPrevention(ModuleParams *parent) :
 	}
 }
 
+CollisionPrevention::~CollisionPrevention()
+{
+	delete _voxel_grid;
+}
+
 hrt_abstime CollisionPrevention::getTime()
 {
 	return hrt_absolute_time();
@@ -201,6 +206,7 @@ void
 CollisionPrevention::_updateObstacleMap()
 {
 	_sub_vehicle_attitude.update();
+	_updateVoxelGrid();
 
 	// add distance sensor data
 	for (auto &dist_sens_sub : _distance_sensor_subs) {
@@ -220,6 +226,10 @@ CollisionPrevention::_updateObstacleMap()
 									(uint16_t)(distance_sensor.min_distance * 100.0f));
 
 				_addDistanceSensorData(distance_sensor, Quatf(_sub_vehicle_attitude.get().q));
+
+				if (_voxel_grid_valid) {
+					_addDistanceSensorDataToVoxelGrid(distance_sensor, Quatf(_sub_vehicle_attitude.get().q));
+				}
 			}
 		}
 	}
@@ -237,6 +247,10 @@ CollisionPrevention::_updateObstacleMap()
 			_obstacle_map_body_frame.min_distance = math::min(_obstacle_map_body_frame.min_distance,
 								obstacle_distance.min_distance);
 			_addObstacleSensorData(obstacle_distance, Quatf(_sub_vehicle_attitude.get().q));
+
+			if (_voxel_grid_valid) {
+				_addObstacleSensorDataToVoxelGrid(obstacle_distance, Quatf(_sub_vehicle_attitude.get().q));
+			}
 		}
 	}
 
@@ -291,6 +305,111 @@ CollisionPrevention::_addDistanceSensorData(distance_sensor_s &distance_sensor,
 	}
 }
 
+void
+CollisionPrevention::_updateVoxelGrid()
+{
+	_voxel_grid_valid = false;
+
+	if (!_param_cp_map_3d.get()) {
+		return;
+	}
+
+	if (_voxel_grid == nullptr) {
+		_voxel_grid = new ObstacleVoxelGrid();
+
+		if (_voxel_grid == nullptr) {
+			return;
+		}
+	}
+
+	_sub_vehicle_local_position.update();
+	const vehicle_local_position_s &local_position = _sub_vehicle_local_position.get();
+
+	if (!local_position.xy_valid || !local_position.z_valid
+	    || getElapsedTime(&local_position.timestamp) > RANGE_STREAM_TIMEOUT_US) {
+		// without a position the grid can't follow the vehicle, fall back to the 2D map
+		_voxel_grid->reset();
+		return;
+	}
+
+	_voxel_grid_position = Vector3f(local_position.x, local_position.y, local_position.z);
+	_voxel_grid->recenter(_voxel_grid_position);
+
+	if (getElapsedTime(&_voxel_epoch_start) > VOXEL_EPOCH_US) {
+		_voxel_grid->age();
+		_voxel_epoch_start = getTime();
+	}
+
+	_voxel_grid_valid = true;
+}
+
+void
+CollisionPrevention::_addDistanceSensorDataToVoxelGrid(const distance_sensor_s &distance_sensor,
+		const matrix::Quatf &vehicle_attitude)
+{
+	const float distance_reading = math::min(distance_sensor.current_distance, distance_sensor.max_distance);
+
+	if (!(distance_reading > distance_sensor.min_distance)) {
+		return;
+	}
+
+	const bool hit = distance_reading < distance_sensor.max_distance;
+
+	// sensor orientation in the local frame, the 2D map only uses its yaw
+	const Quatf sensor_orientation = (distance_sensor.orientation == distance_sensor_s::ROTATION_CUSTOM) ?
+					 Quatf(distance_sensor.q) : Quatf(Eulerf(0.f, 0.f, _sensorOrientationToYawOffset(distance_sensor, 0.f)));
+	const Quatf sensor_attitude = vehicle_attitude * sensor_orientation;
+
+	// one ray per voxel the field of view covers at the measured distance
+	static constexpr int MAX_RAYS_H = 9;
+	static constexpr int MAX_RAYS_V = 3;
+	const float voxels_per_rad = distance_reading / ObstacleVoxelGrid::RESOLUTION;
+	const int rays_h = math::constrain((int)ceilf(distance_sensor.h_fov * voxels_per_rad) + 1, 1, MAX_RAYS_H);
+	const int rays_v = math::constrain((int)ceilf(distance_sensor.v_fov * voxels_per_rad) + 1, 1, MAX_RAYS_V);
+
+	for (int v = 0; v < rays_v; v++) {
+		const float elevation = (rays_v > 1) ? distance_sensor.v_fov * ((float)v / (rays_v - 1) - 0.5f) : 0.f;
+
+		for (int h = 0; h < rays_h; h++) {
+			const float azimuth = (rays_h > 1) ? distance_sensor.h_fov * ((float)h / (rays_h - 1) - 0.5f) : 0.f;
+			const Vector3f ray_sensor_frame(cosf(elevation) * cosf(azimuth), cosf(elevation) * sinf(azimuth), -sinf(elevation));
+
+			_voxel_grid->insertRay(_voxel_grid_position, sensor_attitude.rotateVector(ray_sensor_frame), distance_reading, hit);
+		}
+	}
+}
+
+void
+CollisionPrevention::_addObstacleSensorDataToVoxelGrid(const obstacle_distance_s &obstacle,
+		const matrix::Quatf &vehicle_attitude)
+{
+	float yaw_offset_rad = 0.f;
+
+	if (obstacle.frame == obstacle.MAV_FRAME_BODY_FRD) {
+		yaw_offset_rad = Eulerf(vehicle_attitude).psi();
+
+	} else if (obstacle.frame != obstacle.MAV_FRAME_GLOBAL && obstacle.frame != obstacle.MAV_FRAME_LOCAL_NED) {
+		// reported by _addObstacleSensorData()
+		return;
+	}
+
+	const int num_bins = math::min((int)(sizeof(obstacle.distances) / sizeof(obstacle.distances[0])),
+				       (int)roundf(360.f / obstacle.increment));
+
+	// every message bin is fused, the 2D map only keeps one per INTERNAL_MAP_INCREMENT_DEG
+	for (int i = 0; i < num_bins; i++) {
+		if (obstacle.distances[i] == UINT16_MAX || obstacle.distances[i] <= obstacle.min_distance) {
+			continue;
+		}
+
+		const float angle = yaw_offset_rad + math::radians(obstacle.angle_offset + i * obstacle.increment);
+		const uint16_t distance = math::min(obstacle.distances[i], obstacle.max_distance);
+		const bool hit = distance < obstacle.max_distance;
+
+		_voxel_grid->insertRay(_voxel_grid_position, Vector3f(cosf(angle), sinf(angle), 0.f), distance * 0.01f, hit);
+	}
+}
+
 void
 CollisionPrevention::_adaptSetpointDirection(Vector2f &setpoint_dir, int &setpoint_index, float vehicle_yaw_angle_rad)
 {
@@ -393,9 +512,6 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 	const float col_prev_d = _param_cp_dist.get();
 	const float col_prev_dly = _param_cp_delay.get();
 	const bool move_no_data = _param_cp_go_nodata.get();
-	const float xy_p = _param_mpc_xy_p.get();
-	const float max_jerk = _param_mpc_jerk_max.get();
-	const float max_accel = _param_mpc_acc_hor.get();
 	const matrix::Quatf attitude = Quatf(_sub_vehicle_attitude.get().q);
 	const float vehicle_yaw_angle_rad = Eulerf(attitude).psi();
 
@@ -419,6 +535,31 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 			// change setpoint direction slightly (max by _param_cp_guide_ang degrees) to help guide through narrow gaps
 			_adaptSetpointDirection(setpoint_dir, sp_index, vehicle_yaw_angle_rad);
 
+			if (_voxel_grid_valid) {
+				// delete stale values of the published 2D map, the voxel grid ages by itself
+				for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) {
+					if (constrain_time - _data_timestamps[i] > RANGE_STREAM_TIMEOUT_US) {
+						_obstacle_map_body_frame.distances[i] = UINT16_MAX;
+					}
+				}
+
+				vel_max = _constrainSpeedVoxelGrid(setpoint_dir, vel_max, min_dist_to_keep, curr_vel);
+
+				// no data in the setpoint direction up to the minimum distance
+				bool observed = false;
+
+				for (float s = 0.f; s <= min_dist_to_keep && !observed; s += ObstacleVoxelGrid::RESOLUTION) {
+					observed = _voxel_grid->isObserved(_voxel_grid_position + Vector3f(setpoint_dir(0), setpoint_dir(1), 0.f) * s);
+				}
+
+				if ((!observed && !move_no_data) || !_voxel_grid->hasObservations()) {
+					vel_max = 0.f;
+				}
+
+				setpoint = setpoint_dir * vel_max;
+				return;
+			}
+
 			// limit speed for safe flight
 			for (int i = 0; i < INTERNAL_MAP_USED_BINS; i++) { // disregard unused bins at the end of the message
 
@@ -457,20 +598,7 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 						}
 
 						const float stop_distance = math::max(0.f, distance - min_dist_to_keep - delay_distance);
-						const float vel_max_posctrl = xy_p * stop_distance;
-
-						const float vel_max_smooth = math::trajectory::computeMaxSpeedFromDistance(max_jerk, max_accel, stop_distance, 0.f);
-						const float projection = bin_direction.dot(setpoint_dir);
-						float vel_max_bin = vel_max;
-
-						if (projection > 0.01f) {
-							vel_max_bin = math::min(vel_max_posctrl, vel_max_smooth) / projection;
-						}
-
-						// constrain the velocity
-						if (vel_max_bin >= 0) {
-							vel_max = math::min(vel_max, vel_max_bin);
-						}
+						vel_max = _constrainSpeed(setpoint_dir, bin_direction, stop_distance, vel_max);
 					}
 
 				} else if (_obstacle_map_body_frame.distances[i] == UINT16_MAX && i == sp_index) {
@@ -508,6 +636,60 @@ CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint, const Vec
 	}
 }
 
+float
+CollisionPrevention::_constrainSpeed(const Vector2f &setpoint_dir, const Vector2f &obstacle_dir, float stop_distance,
+				     float vel_max) const
+{
+	// calculate max allowed velocity with a P-controller (same gain as in the position controller)
+	const float vel_max_posctrl = _param_mpc_xy_p.get() * stop_distance;
+
+	const float vel_max_smooth = math::trajectory::computeMaxSpeedFromDistance(_param_mpc_jerk_max.get(),
+				     _param_mpc_acc_hor.get(), stop_distance, 0.f);
+	const float projection = obstacle_dir.dot(setpoint_dir);
+	float vel_max_bin = vel_max;
+
+	if (projection > 0.01f) {
+		vel_max_bin = math::min(vel_max_posctrl, vel_max_smooth) / projection;
+	}
+
+	// constrain the velocity
+	if (vel_max_bin >= 0) {
+		vel_max = math::min(vel_max, vel_max_bin);
+	}
+
+	return vel_max;
+}
+
+float
+CollisionPrevention::_constrainSpeedVoxelGrid(const Vector2f &setpoint_dir, float vel_max, float min_dist_to_keep,
+		const Vector2f &curr_vel) const
+{
+	const float col_prev_dly = _param_cp_delay.get();
+	const float range = ObstacleVoxelGrid::RESOLUTION * ObstacleVoxelGrid::SIZE_XY / 2;
+
+	// every occupied voxel in the height band of the vehicle acts like an obstacle bin of the 2D map
+	_voxel_grid->forEachOccupied(_voxel_grid_position, range, VOXEL_HEIGHT_BAND, [&](const Vector3f & voxel) {
+		const Vector2f offset(voxel(0) - _voxel_grid_position(0), voxel(1) - _voxel_grid_position(1));
+		const float center_distance = offset.norm();
+
+		if (center_distance < FLT_EPSILON) {
+			return;
+		}
+
+		const Vector2f obstacle_dir = offset / center_distance;
+
+		if (setpoint_dir.dot(obstacle_dir) > 0) {
+			// distance to the voxel surface
+			const float distance = math::max(0.f, center_distance - 0.5f * ObstacleVoxelGrid::RESOLUTION);
+			const float curr_vel_parallel = math::max(0.f, curr_vel.dot(obstacle_dir));
+			const float stop_distance = math::max(0.f, distance - min_dist_to_keep - curr_vel_parallel * col_prev_dly);
+			vel_max = _constrainSpeed(setpoint_dir, obstacle_dir, stop_distance, vel_max);
+		}
+	});
+
+	return vel_max;
+}
+
 void
 CollisionPrevention::modifySetpoint(Vector2f &original_setpoint, const float max_speed, const Vector2f &curr_pos,
 				    const Vector2f &curr_vel)
@@ -43,6 +43,8 @@
 
 #include <float.h>
 
+#include "ObstacleVoxelGrid.hpp"
+
 #include <commander/px4_custom_mode.h>
 #include <drivers/drv_hrt.h>
 #include <mathlib/mathlib.h>
@@ -58,6 +60,7 @@
 #include <uORB/topics/obstacle_distance.h>
 #include <uORB/topics/vehicle_attitude.h>
 #include <uORB/topics/vehicle_command.h>
+#include <uORB/topics/vehicle_local_position.h>
 
 using namespace time_literals;
 
@@ -65,7 +68,7 @@ class CollisionPrevention : public ModuleParams
 {
 public:
 	CollisionPrevention(ModuleParams *parent);
-	~CollisionPrevention() override = default;
+	~CollisionPrevention() override;
 
 	/**
 	 * Returns true if Collision Prevention is running
@@ -114,6 +117,24 @@ protected:
 	 */
 	bool _enterData(int map_index, float sensor_range, float sensor_reading);
 
+	/**
+	 * Fuses a distance sensor measurement into the voxel grid, one ray per voxel across the field of view
+	 * @param distance_sensor, distance sensor message
+	 * @param vehicle_attitude, vehicle attitude
+	 */
+	void _addDistanceSensorDataToVoxelGrid(const distance_sensor_s &distance_sensor, const matrix::Quatf &vehicle_attitude);
+
+	/**
+	 * Fuses all bins of an obstacle distance message into the voxel grid as horizontal rays
+	 * @param obstacle, obstacle_distance message
+	 * @param vehicle_attitude, vehicle attitude
+	 */
+	void _addObstacleSensorDataToVoxelGrid(const obstacle_distance_s &obstacle, const matrix::Quatf &vehicle_attitude);
+
+	ObstacleVoxelGrid *_voxel_grid{nullptr};	/**< 3D obstacle map, allocated if CP_MAP_3D is set */
+	matrix::Vector3f _voxel_grid_position{};	/**< vehicle position the voxel grid is centered on */
+	bool _voxel_grid_valid{false};			/**< voxel grid is used, it needs a valid local position */
+
 
 	//Timing functions. Necessary to mock time in the tests
 	virtual hrt_abstime getTime();
@@ -133,19 +154,24 @@ private:
 
 	uORB::SubscriptionData<obstacle_distance_s> _sub_obstacle_distance{ORB_ID(obstacle_distance)}; /**< obstacle distances received form a range sensor */
 	uORB::SubscriptionData<vehicle_attitude_s> _sub_vehicle_attitude{ORB_ID(vehicle_attitude)};
+	uORB::SubscriptionData<vehicle_local_position_s> _sub_vehicle_local_position{ORB_ID(vehicle_local_position)};
 	uORB::SubscriptionMultiArray<distance_sensor_s> _distance_sensor_subs{ORB_ID::distance_sensor};
 
 	static constexpr uint64_t RANGE_STREAM_TIMEOUT_US{500_ms};
 	static constexpr uint64_t TIMEOUT_HOLD_US{5_s};
+	static constexpr uint64_t VOXEL_EPOCH_US{RANGE_STREAM_TIMEOUT_US / 2}; /**< voxels expire after two epochs */
+	static constexpr float VOXEL_HEIGHT_BAND{1.f}; /**< obstacles within +- this height constrain the setpoint [m] */
 
 	hrt_abstime	_last_timeout_warning{0};
 	hrt_abstime	_time_activated{0};
+	hrt_abstime	_voxel_epoch_start{0};
 
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::CP_DIST>) _param_cp_dist, /**< collision prevention keep minimum distance */
 		(ParamFloat<px4::params::CP_DELAY>) _param_cp_delay, /**< delay of the range measurement data*/
 		(ParamFloat<px4::params::CP_GUIDE_ANG>) _param_cp_guide_ang, /**< collision prevention change setpoint angle */
 		(ParamBool<px4::params::CP_GO_NO_DATA>) _param_cp_go_nodata, /**< movement allowed where no data*/
+		(ParamBool<px4::params::CP_MAP_3D>) _param_cp_map_3d, /**< use the 3D voxel map for the constraints*/
 		(ParamFloat<px4::params::MPC_XY_P>) _param_mpc_xy_p, /**< p gain from position controller*/
 		(ParamFloat<px4::params::MPC_JERK_MAX>) _param_mpc_jerk_max, /**< vehicle maximum jerk*/
 		(ParamFloat<px4::params::MPC_ACC_HOR>) _param_mpc_acc_hor /**< vehicle maximum horizontal acceleration*/
@@ -167,6 +193,32 @@ private:
 	void _calculateConstrainedSetpoint(matrix::Vector2f &setpoint, const matrix::Vector2f &curr_pos,
 					   const matrix::Vector2f &curr_vel);
 
+	/**
+	 * Limits the speed along the setpoint direction to stop in front of an obstacle
+	 * @param setpoint_dir, unit setpoint direction
+	 * @param obstacle_dir, unit direction to the obstacle
+	 * @param stop_distance, distance left until the minimum distance to the obstacle is reached
+	 * @param vel_max, speed limit so far
+	 * @return new speed limit
+	 */
+	float _constrainSpeed(const matrix::Vector2f &setpoint_dir, const matrix::Vector2f &obstacle_dir,
+			      float stop_distance, float vel_max) const;
+
+	/**
+	 * Speed limit along the setpoint direction from the occupied voxels around the vehicle
+	 * @param setpoint_dir, unit setpoint direction
+	 * @param vel_max, speed limit so far
+	 * @param min_dist_to_keep, minimum distance to all obstacles
+	 * @param curr_vel, current vehicle velocity
+	 */
+	float _constrainSpeedVoxelGrid(const matrix::Vector2f &setpoint_dir, float vel_max, float min_dist_to_keep,
+				       const matrix::Vector2f &curr_vel) const;
+
+	/**
+	 * Moves the voxel grid with the vehicle and ages it, sets _voxel_grid_valid
+	 */
+	void _updateVoxelGrid();
+
 	/**
 	 * Publishes collision_constraints message
 	 * @param original_setpoint, setpoint before collision prevention intervention
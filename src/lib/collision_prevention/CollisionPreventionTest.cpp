@@ -1206,3 +1206,61 @@ TEST_F(CollisionPreventionTest, enterData)
 	EXPECT_TRUE(cp.test_enterData(8, 30.f, 1.5f)); //longer range, reading in range
 	EXPECT_TRUE(cp.test_enterData(8, 30.f, 31.f)); //longer range, reading out of range
 }
+
+TEST_F(CollisionPreventionTest, voxelMapIgnoresObstacleAbove)
+{
+	// GIVEN: a simple setup condition with a valid local position
+	TestCollisionPrevention cp;
+	matrix::Vector2f original_setpoint(10, 0);
+	float max_speed = 3;
+	matrix::Vector2f curr_pos(0, 0);
+	matrix::Vector2f curr_vel(2, 0);
+	vehicle_attitude_s attitude{};
+	attitude.timestamp = hrt_absolute_time();
+	attitude.q[0] = 1.0f;
+	vehicle_local_position_s local_position{};
+	local_position.timestamp = hrt_absolute_time();
+	local_position.xy_valid = true;
+	local_position.z_valid = true;
+	local_position.z = -3.f;
+
+	// AND: collision prevention with the 3D map, moving outside the field of view is allowed
+	param_t param = param_handle(px4::params::CP_DIST);
+	float value = 3;
+	param_set(param, &value);
+	param = param_handle(px4::params::CP_GO_NO_DATA);
+	int32_t go_no_data = 1;
+	param_set(param, &go_no_data);
+	param = param_handle(px4::params::CP_MAP_3D);
+	int32_t map_3d = 1;
+	param_set(param, &map_3d);
+	cp.paramsChanged();
+
+	// AND: a sensor pitched up by 45 degrees sees an obstacle about 1.4 m above the vehicle
+	distance_sensor_s message{};
+	message.timestamp = hrt_absolute_time();
+	message.min_distance = 0.2f;
+	message.max_distance = 20.f;
+	message.current_distance = 2.f;
+	message.signal_quality = 100;
+	message.orientation = distance_sensor_s::ROTATION_CUSTOM;
+	matrix::Quatf(matrix::Eulerf(0.f, math::radians(45.f), 0.f)).copyTo(message.q);
+
+	orb_advert_t distance_sensor_pub = orb_advertise(ORB_ID(distance_sensor), &message);
+	orb_advert_t vehicle_attitude_pub = orb_advertise(ORB_ID(vehicle_attitude), &attitude);
+	orb_advert_t vehicle_local_position_pub = orb_advertise(ORB_ID(vehicle_local_position), &local_position);
+
+	// WHEN: we run the setpoint modification
+	matrix::Vector2f modified_setpoint = original_setpoint;
+	cp.modifySetpoint(modified_setpoint, max_speed, curr_pos, curr_vel);
+	orb_unadvertise(distance_sensor_pub);
+	orb_unadvertise(vehicle_attitude_pub);
+	orb_unadvertise(vehicle_local_position_pub);
+
+	// THEN: the 2D map projects the obstacle into the front bin
+	EXPECT_EQ(cp.getObstacleMap().distances[0], 200);
+
+	// AND: the obstacle is above the height band of the vehicle and does not constrain the setpoint
+	EXPECT_FLOAT_EQ(modified_setpoint(0), original_setpoint(0));
+	EXPECT_FLOAT_EQ(modified_setpoint(1), original_setpoint(1));
+}
@@ -0,0 +1,276 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ObstacleVoxelGrid.cpp
+ */
+
+#include "ObstacleVoxelGrid.hpp"
+
+#include <mathlib/mathlib.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace matrix;
+
+void ObstacleVoxelGrid::reset()
+{
+	memset(_occupied, 0, sizeof(_occupied));
+	memset(_observed, 0, sizeof(_observed));
+	_placed = false;
+}
+
+void ObstacleVoxelGrid::recenter(const Vector3f &position)
+{
+	const int origin[3] {
+		toIndex(position(0)) - SIZE_XY / 2,
+		toIndex(position(1)) - SIZE_XY / 2,
+		toIndex(position(2)) - SIZE_Z / 2
+	};
+
+	const int size[3] {SIZE_XY, SIZE_XY, SIZE_Z};
+	bool clear_all = !_placed;
+
+	for (int axis = 0; axis < 3; axis++) {
+		if (abs(origin[axis] - _origin[axis]) >= size[axis]) {
+			clear_all = true;
+		}
+	}
+
+	if (clear_all) {
+		reset();
+		memcpy(_origin, origin, sizeof(_origin));
+		_placed = true;
+		return;
+	}
+
+	// clear the slabs that enter the window, they still hold voxels of the opposite side
+	for (int x = _origin[0] + SIZE_XY; x < origin[0] + SIZE_XY; x++) { clearSlabX(x); }
+
+	for (int x = origin[0]; x < _origin[0]; x++) { clearSlabX(x); }
+
+	for (int y = _origin[1] + SIZE_XY; y < origin[1] + SIZE_XY; y++) { clearSlabY(y); }
+
+	for (int y = origin[1]; y < _origin[1]; y++) { clearSlabY(y); }
+
+	for (int z = _origin[2] + SIZE_Z; z < origin[2] + SIZE_Z; z++) { clearLayer(z); }
+
+	for (int z = origin[2]; z < _origin[2]; z++) { clearLayer(z); }
+
+	memcpy(_origin, origin, sizeof(_origin));
+}
+
+void ObstacleVoxelGrid::age()
+{
+	_epoch ^= 1;
+	memset(_occupied[_epoch], 0, sizeof(_occupied[_epoch]));
+	memset(_observed[_epoch], 0, sizeof(_observed[_epoch]));
+}
+
+void ObstacleVoxelGrid::insertRay(const Vector3f &origin, const Vector3f &direction, float distance, bool hit)
+{
+	if (!_placed || !(distance > 0.f)) {
+		return;
+	}
+
+	// sample at half the resolution so that no voxel along the ray is skipped entirely
+	static constexpr float STEP = RESOLUTION * 0.5f;
+	int last_cell = -1;
+	int last_z = 0;
+
+	for (float s = 0.f; s < distance - STEP; s += STEP) {
+		int x;
+		int y;
+		int z;
+
+		if (!toVoxel(origin + direction * s, x, y, z)) {
+			// the window is convex, the ray does not enter it again
+			break;
+		}
+
+		const int cell = index(x, y);
+
+		if ((cell == last_cell) && (z == last_z)) {
+			continue;
+		}
+
+		// free space overrides older hits of both epochs
+		_occupied[0][cell] &= ~bit(z);
+		_occupied[1][cell] &= ~bit(z);
+		_observed[_epoch][cell] |= bit(z);
+		last_cell = cell;
+		last_z = z;
+	}
+
+	int x;
+	int y;
+	int z;
+
+	if (hit && toVoxel(origin + direction * distance, x, y, z)) {
+		const int cell = index(x, y);
+		_occupied[_epoch][cell] |= bit(z);
+		_observed[_epoch][cell] |= bit(z);
+	}
+}
+
+bool ObstacleVoxelGrid::isOccupied(const Vector3f &point) const
+{
+	int x;
+	int y;
+	int z;
+
+	if (!toVoxel(point, x, y, z)) {
+		return false;
+	}
+
+	const int cell = index(x, y);
+	return (_occupied[0][cell] | _occupied[1][cell]) & bit(z);
+}
+
+bool ObstacleVoxelGrid::isObserved(const Vector3f &point) const
+{
+	int x;
+	int y;
+	int z;
+
+	if (!toVoxel(point, x, y, z)) {
+		return false;
+	}
+
+	const int cell = index(x, y);
+	return (_observed[0][cell] | _observed[1][cell]) & bit(z);
+}
+
+bool ObstacleVoxelGrid::hasObservations() const
+{
+	for (int cell = 0; cell < SIZE_XY * SIZE_XY; cell++) {
+		if (_observed[0][cell] | _observed[1][cell]) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ObstacleVoxelGrid::occupiedInSphere(const Vector3f &center, float radius) const
+{
+	bool occupied = false;
+	forEachOccupied(center, radius, radius, [&occupied](const Vector3f &) { occupied = true; });
+	return occupied;
+}
+
+float ObstacleVoxelGrid::nearestInCone(const Vector3f &apex, const Vector3f &axis, float cos_half_angle,
+				       float range) const
+{
+	float nearest = INFINITY;
+
+	forEachOccupied(apex, range, range, [&](const Vector3f & voxel) {
+		const Vector3f offset = voxel - apex;
+		const float distance = offset.norm();
+
+		if ((distance < nearest) && (offset.dot(axis) >= cos_half_angle * distance)) {
+			nearest = distance;
+		}
+	});
+
+	return nearest;
+}
+
+bool ObstacleVoxelGrid::toVoxel(const Vector3f &point, int &x, int &y, int &z) const
+{
+	if (!_placed || !point.isAllFinite()) {
+		return false;
+	}
+
+	x = toIndex(point(0));
+	y = toIndex(point(1));
+	z = toIndex(point(2));
+
+	return (x >= _origin[0]) && (x < _origin[0] + SIZE_XY)
+	       && (y >= _origin[1]) && (y < _origin[1] + SIZE_XY)
+	       && (z >= _origin[2]) && (z < _origin[2] + SIZE_Z);
+}
+
+bool ObstacleVoxelGrid::bounds(const Vector3f &center, float half_xy, float half_z, int min[3], int max[3]) const
+{
+	if (!_placed || !center.isAllFinite()) {
+		return false;
+	}
+
+	const float half[3] {half_xy, half_xy, half_z};
+	const int size[3] {SIZE_XY, SIZE_XY, SIZE_Z};
+
+	for (int axis = 0; axis < 3; axis++) {
+		min[axis] = math::max(toIndex(center(axis) - half[axis]), _origin[axis]);
+		max[axis] = math::min(toIndex(center(axis) + half[axis]), _origin[axis] + size[axis] - 1);
+
+		if (min[axis] > max[axis]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void ObstacleVoxelGrid::clearSlabX(int x)
+{
+	for (int y = 0; y < SIZE_XY; y++) {
+		const int cell = index(x, y);
+		_occupied[0][cell] = _occupied[1][cell] = 0;
+		_observed[0][cell] = _observed[1][cell] = 0;
+	}
+}
+
+void ObstacleVoxelGrid::clearSlabY(int y)
+{
+	for (int x = 0; x < SIZE_XY; x++) {
+		const int cell = index(x, y);
+		_occupied[0][cell] = _occupied[1][cell] = 0;
+		_observed[0][cell] = _observed[1][cell] = 0;
+	}
+}
+
+void ObstacleVoxelGrid::clearLayer(int z)
+{
+	const uint8_t mask = ~bit(z);
+
+	for (int cell = 0; cell < SIZE_XY * SIZE_XY; cell++) {
+		_occupied[0][cell] &= mask;
+		_occupied[1][cell] &= mask;
+		_observed[0][cell] &= mask;
+		_observed[1][cell] &= mask;
+	}
+}
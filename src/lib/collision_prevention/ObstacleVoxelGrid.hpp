@@ -0,0 +1,191 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ObstacleVoxelGrid.hpp
+ *
+ * Rolling 3D occupancy grid around the vehicle for collision prevention.
+ *
+ * The grid covers SIZE_XY x SIZE_XY x SIZE_Z voxels in the local NED frame and moves with the
+ * vehicle. Voxels are addressed by their world index modulo the grid size, so moving the window
+ * only clears the slabs that enter it. Every horizontal cell stores its vertical voxels as the
+ * bits of one byte, which keeps the grid compact and makes height band queries a mask operation.
+ *
+ * Occupancy ages in two epochs: age() drops everything that was not observed again during the
+ * last two epochs, which replaces the per bin timestamps of the 2D obstacle map.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <matrix/matrix/math.hpp>
+
+class ObstacleVoxelGrid
+{
+public:
+	static constexpr int SIZE_XY = 32;		///< voxels per horizontal axis, power of 2
+	static constexpr int SIZE_Z = 8;		///< voxels on the vertical axis, one bit each
+	static constexpr float RESOLUTION = 0.5f;	///< voxel edge length [m]
+
+	ObstacleVoxelGrid() { reset(); }
+	~ObstacleVoxelGrid() = default;
+
+	/**
+	 * Clear all voxels, the next recenter() places the window
+	 */
+	void reset();
+
+	/**
+	 * Move the window so that it is centered on the vehicle, voxels that enter the window are cleared
+	 * @param position, vehicle position in the local NED frame
+	 */
+	void recenter(const matrix::Vector3f &position);
+
+	/**
+	 * Start a new epoch, occupied voxels that were not hit during the last two epochs are removed
+	 */
+	void age();
+
+	/**
+	 * Fuse a range measurement: the voxels along the ray are free, the end point is occupied if it was a hit
+	 * @param origin, sensor position in the local NED frame
+	 * @param direction, unit ray direction in the local NED frame
+	 * @param distance, measured distance or the maximum range if nothing was hit [m]
+	 * @param hit, true if the measurement ended on an obstacle
+	 */
+	void insertRay(const matrix::Vector3f &origin, const matrix::Vector3f &direction, float distance, bool hit);
+
+	bool isOccupied(const matrix::Vector3f &point) const;
+
+	/**
+	 * @return true if a ray passed or ended in the voxel of the point during the last two epochs
+	 */
+	bool isObserved(const matrix::Vector3f &point) const;
+
+	/**
+	 * @return true if any voxel was observed during the last two epochs
+	 */
+	bool hasObservations() const;
+
+	/**
+	 * Sphere test
+	 * @return true if the center of an occupied voxel is closer than radius to center
+	 */
+	bool occupiedInSphere(const matrix::Vector3f &center, float radius) const;
+
+	/**
+	 * Cone test
+	 * @param apex, cone apex in the local NED frame
+	 * @param axis, unit cone axis
+	 * @param cos_half_angle, cosine of the half opening angle
+	 * @param range, cone length [m]
+	 * @return distance to the closest occupied voxel center inside the cone, INFINITY if there is none
+	 */
+	float nearestInCone(const matrix::Vector3f &apex, const matrix::Vector3f &axis, float cos_half_angle,
+			    float range) const;
+
+	/**
+	 * Call callback(const matrix::Vector3f &voxel_center) for all occupied voxels closer than radius to center
+	 * and inside the height band center(2) +- max_dz
+	 */
+	template <typename Callback>
+	void forEachOccupied(const matrix::Vector3f &center, float radius, float max_dz, Callback callback) const
+	{
+		int min[3];
+		int max[3];
+
+		if (!bounds(center, radius, max_dz, min, max)) {
+			return;
+		}
+
+		const float radius_sq = radius * radius;
+
+		for (int y = min[1]; y <= max[1]; y++) {
+			for (int x = min[0]; x <= max[0]; x++) {
+				const int cell = index(x, y);
+				const uint8_t occupied = _occupied[0][cell] | _occupied[1][cell];
+
+				if (occupied == 0) {
+					continue;
+				}
+
+				for (int z = min[2]; z <= max[2]; z++) {
+					if (occupied & bit(z)) {
+						const matrix::Vector3f voxel = voxelCenter(x, y, z);
+
+						if ((voxel - center).norm_squared() <= radius_sq) {
+							callback(voxel);
+						}
+					}
+				}
+			}
+		}
+	}
+
+private:
+	static_assert((SIZE_XY & (SIZE_XY - 1)) == 0, "SIZE_XY must be a power of 2");
+	static_assert(SIZE_Z == 8, "a cell stores its vertical voxels in one byte");
+
+	static int index(int x, int y) { return (x & (SIZE_XY - 1)) + (y & (SIZE_XY - 1)) * SIZE_XY; }
+	static uint8_t bit(int z) { return 1u << (z & (SIZE_Z - 1)); }
+	static int toIndex(float coordinate) { return static_cast<int>(floorf(coordinate / RESOLUTION)); }
+
+	matrix::Vector3f voxelCenter(int x, int y, int z) const
+	{
+		return matrix::Vector3f((x + 0.5f) * RESOLUTION, (y + 0.5f) * RESOLUTION, (z + 0.5f) * RESOLUTION);
+	}
+
+	/**
+	 * @return false if the point is outside the window
+	 */
+	bool toVoxel(const matrix::Vector3f &point, int &x, int &y, int &z) const;
+
+	/**
+	 * Voxel index range of a box around center clipped to the window
+	 * @return false if the box is outside the window
+	 */
+	bool bounds(const matrix::Vector3f &center, float half_xy, float half_z, int min[3], int max[3]) const;
+
+	void clearSlabX(int x);
+	void clearSlabY(int y);
+	void clearLayer(int z);
+
+	uint8_t _occupied[2][SIZE_XY * SIZE_XY];	///< per epoch, bit z of a cell is the voxel at height z
+	uint8_t _observed[2][SIZE_XY * SIZE_XY];
+	int _epoch{0};					///< index of the current epoch
+
+	int _origin[3] {};				///< world voxel index of the lowest window corner
+	bool _placed{false};
+};
@@ -0,0 +1,166 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "ObstacleVoxelGrid.hpp"
+
+using namespace matrix;
+
+class ObstacleVoxelGridTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		_grid.recenter(Vector3f(0.1f, 0.1f, -1.9f));
+	}
+
+	ObstacleVoxelGrid _grid;
+	const Vector3f _forward{1.f, 0.f, 0.f};
+};
+
+TEST_F(ObstacleVoxelGridTest, empty)
+{
+	EXPECT_FALSE(_grid.hasObservations());
+	EXPECT_FALSE(_grid.isOccupied(Vector3f(0.1f, 0.1f, -1.9f)));
+	EXPECT_FALSE(_grid.occupiedInSphere(Vector3f(0.1f, 0.1f, -1.9f), 10.f));
+}
+
+TEST_F(ObstacleVoxelGridTest, rayHit)
+{
+	// WHEN: a sensor sees an obstacle 3 m ahead
+	const Vector3f origin(0.1f, 0.1f, -1.9f);
+	_grid.insertRay(origin, _forward, 3.f, true);
+
+	// THEN: the end point is occupied and the voxels in between are free but observed
+	EXPECT_TRUE(_grid.isOccupied(origin + _forward * 3.f));
+	EXPECT_FALSE(_grid.isOccupied(origin + _forward * 1.5f));
+	EXPECT_TRUE(_grid.isObserved(origin + _forward * 1.5f));
+	EXPECT_FALSE(_grid.isObserved(origin - _forward * 1.5f));
+	EXPECT_TRUE(_grid.hasObservations());
+}
+
+TEST_F(ObstacleVoxelGridTest, freeRayClearsHit)
+{
+	const Vector3f origin(0.1f, 0.1f, -1.9f);
+	_grid.insertRay(origin, _forward, 3.f, true);
+
+	// WHEN: the obstacle moved away and a later measurement sees further
+	_grid.insertRay(origin, _forward, 6.f, false);
+
+	// THEN: the voxel is free again and nothing was hit at the maximum range
+	EXPECT_FALSE(_grid.isOccupied(origin + _forward * 3.f));
+	EXPECT_FALSE(_grid.isOccupied(origin + _forward * 6.f));
+}
+
+TEST_F(ObstacleVoxelGridTest, aging)
+{
+	const Vector3f origin(0.1f, 0.1f, -1.9f);
+	const Vector3f obstacle = origin + _forward * 3.f;
+	_grid.insertRay(origin, _forward, 3.f, true);
+
+	// THEN: a hit survives one epoch
+	_grid.age();
+	EXPECT_TRUE(_grid.isOccupied(obstacle));
+
+	// AND: expires after the second one
+	_grid.age();
+	EXPECT_FALSE(_grid.isOccupied(obstacle));
+	EXPECT_FALSE(_grid.hasObservations());
+}
+
+TEST_F(ObstacleVoxelGridTest, rollingWindow)
+{
+	const Vector3f origin(0.1f, 0.1f, -1.9f);
+	const Vector3f obstacle = origin + _forward * 3.f;
+	_grid.insertRay(origin, _forward, 3.f, true);
+
+	// WHEN: the vehicle moves a few voxels
+	_grid.recenter(Vector3f(-2.1f, 1.6f, -2.4f));
+
+	// THEN: the obstacle stays at its world position
+	EXPECT_TRUE(_grid.isOccupied(obstacle));
+
+	// WHEN: the vehicle moves until the obstacle left the window and returns
+	_grid.recenter(Vector3f(-10.1f, 0.1f, -1.9f));
+	EXPECT_FALSE(_grid.isOccupied(obstacle));
+	_grid.recenter(origin);
+
+	// THEN: the obstacle is gone, its storage was reused for the other side
+	EXPECT_FALSE(_grid.isOccupied(obstacle));
+}
+
+TEST_F(ObstacleVoxelGridTest, outsideWindow)
+{
+	// WHEN: a measurement ends outside of the window
+	const Vector3f origin(0.1f, 0.1f, -1.9f);
+	const float range = ObstacleVoxelGrid::RESOLUTION * ObstacleVoxelGrid::SIZE_XY;
+	_grid.insertRay(origin, _forward, range, true);
+
+	// THEN: nothing is marked occupied and the ray is still observed inside the window
+	EXPECT_FALSE(_grid.occupiedInSphere(origin, range));
+	EXPECT_TRUE(_grid.isObserved(origin + _forward * 5.f));
+}
+
+TEST_F(ObstacleVoxelGridTest, coneQuery)
+{
+	const Vector3f origin(0.1f, 0.1f, -1.9f);
+	_grid.insertRay(origin, _forward, 3.f, true);
+
+	// THEN: the obstacle is found ahead at about 3 m
+	const float cos_half_angle = cosf(0.5f);
+	EXPECT_NEAR(_grid.nearestInCone(origin, _forward, cos_half_angle, 8.f), 3.f, ObstacleVoxelGrid::RESOLUTION);
+
+	// AND: not behind or sideways, nor outside the cone length
+	EXPECT_FALSE(std::isfinite(_grid.nearestInCone(origin, -_forward, cos_half_angle, 8.f)));
+	EXPECT_FALSE(std::isfinite(_grid.nearestInCone(origin, Vector3f(0.f, 1.f, 0.f), cos_half_angle, 8.f)));
+	EXPECT_FALSE(std::isfinite(_grid.nearestInCone(origin, _forward, cos_half_angle, 2.f)));
+}
+
+TEST_F(ObstacleVoxelGridTest, heightBand)
+{
+	// WHEN: an obstacle is seen 1.5 m above the vehicle
+	const Vector3f origin(0.1f, 0.1f, -1.9f);
+	const Vector3f up(0.f, 0.f, -1.f);
+	_grid.insertRay(origin, up, 1.5f, true);
+
+	// THEN: it is inside the sphere but not within a 1 m height band
+	EXPECT_TRUE(_grid.occupiedInSphere(origin, 2.f));
+
+	int count = 0;
+	_grid.forEachOccupied(origin, 2.f, 1.f, [&count](const Vector3f &) { count++; });
+	EXPECT_EQ(count, 0);
+
+	_grid.forEachOccupied(origin, 2.f, 2.f, [&count](const Vector3f &) { count++; });
+	EXPECT_EQ(count, 1);
+}
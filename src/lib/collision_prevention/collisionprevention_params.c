@@ -84,3 +84,16 @@ PARAM_DEFINE_FLOAT(CP_GUIDE_ANG, 30.f);
  * @group Multicopter Position Control
  */
 PARAM_DEFINE_INT32(CP_GO_NO_DATA, 0);
+
+/**
+ * Use a 3D obstacle map for collision prevention
+ *
+ * Range sensor and obstacle distance data is fused into a voxel grid of 16 x 16 x 4 m around
+ * the vehicle, and only obstacles within 1 m of the vehicle altitude constrain the setpoint.
+ * Requires a valid local position, falls back to the 2D obstacle map otherwise.
+ * Only used in Position mode.
+ *
+ * @boolean
+ * @group Multicopter Position Control
+ */
+PARAM_DEFINE_INT32(CP_MAP_3D, 0);
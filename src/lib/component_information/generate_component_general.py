@@ -11,11 +11,14 @@ parser.add_argument('--compress', action='store_true', help='Add a compressed ou
 parser.add_argument('--type', metavar='type', action="append", default=[],
         help='Metadata type (<type>,<metadata file>,<uri>,<fallback uri>,[translation uri])')
 parser.add_argument('--version-file', metavar='build_git_version.h', help='Git version file')
+parser.add_argument('--chunk-size', type=int, default=0,
+        help='Add an index with the CRC of every chunk of this size of the metadata files (0: disabled)')
 
 args = parser.parse_args()
 filename = args.filename
 compress = args.compress
 version_file = args.version_file
+chunk_size = args.chunk_size
 
 version_dir = ''
 if version_file is not None:
@@ -58,14 +61,20 @@ crc_table = create_table()
 metadata_types = []
 for metadata_type_tuple in args.type:
     type_id, metadata_file, uri, fallback_uri, translation_uri = metadata_type_tuple.split(',')
-    file_crc = 0
-    for line in open(metadata_file, "rb"):
-        file_crc = crc_update(line, crc_table, file_crc)
+    with open(metadata_file, "rb") as f:
+        file_content = f.read()
+    file_crc = crc_update(file_content, crc_table, 0)
     json_type = {
             'type': int(type_id),
             'uri': uri.replace('{version}', version_dir),
             'fileCrc': file_crc,
             }
+    if chunk_size > 0:
+        # CRC of each chunk of the file as served (compressed), so the GCS can validate the
+        # file while it is read in chunks over MAVLink FTP and only refetch the failed ones
+        json_type['chunkSize'] = chunk_size
+        json_type['chunkCrcs'] = [crc_update(file_content[i:i + chunk_size], crc_table, 0)
+                for i in range(0, len(file_content), chunk_size)]
     if len(fallback_uri) > 0:
         json_type['uriFallback'] = fallback_uri.replace('{version}', version_dir)
     if len(translation_uri) > 0:
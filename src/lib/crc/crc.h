@@ -55,6 +55,8 @@
  * Global Variables
  ****************************************************************************/
 
+extern const uint16_t crc16_mcrf4xx_table[256];
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -135,3 +137,44 @@ uint32_t crc32_signature(uint32_t acc, size_t length,
  ****************************************************************************/
 
 uint64_t crc64_add_word(uint64_t crc, uint32_t value);
+
+/****************************************************************************
+ * Name: crc16_mcrf4xx_add
+ *
+ * Description:
+ *   Adds a byte to a CRC-16/MCRF4XX (MAVLink X.25 checksum, initial value
+ *   0xFFFF, no output XOR) using the lookup table. Gives the same result as
+ *   the bit wise crc_accumulate() of the MAVLink library.
+ *
+ * Input Parameters:
+ *    crc   - The running total of the crc 16
+ *    value - The value to add
+ *
+ * Returned Value:
+ *   The current crc16 with the value processed.
+ *
+ ****************************************************************************/
+
+static inline uint16_t crc16_mcrf4xx_add(uint16_t crc, uint8_t value)
+{
+	return (uint16_t)((crc >> 8) ^ crc16_mcrf4xx_table[(crc ^ value) & 0xffu]);
+}
+
+/****************************************************************************
+ * Name: crc16_mcrf4xx_signature
+ *
+ * Description:
+ *   Calculates a CRC-16/MCRF4XX using the crc16_mcrf4xx_add function
+ *
+ * Input Parameters:
+ *    initial - The Initial value to uses as the crc's starting point
+ *    length  - The number of bytes to add to the crc
+ *    bytes   - A pointer to any array of length bytes
+ *
+ * Returned Value:
+ *   The crc16 of the array of bytes
+ *
+ ****************************************************************************/
+
+uint16_t crc16_mcrf4xx_signature(uint16_t initial, size_t length,
+				 const uint8_t *bytes);
@@ -36,6 +36,7 @@
  */
 
 #include <dataman_client/DatamanClient.hpp>
+#include <lib/mathlib/mathlib.h>
 
 DatamanClient::DatamanClient()
 {
@@ -176,6 +177,91 @@ bool DatamanClient::readSync(dm_item_t item, uint32_t index, uint8_t *buffer, ui
 	return success;
 }
 
+bool DatamanClient::rangeHandler(const dataman_request_s &request, uint8_t *buffer, bool received[],
+				 const hrt_abstime &start_time, hrt_abstime timeout)
+{
+	uint32_t num_received = 0;
+	hrt_abstime time_elapsed = hrt_elapsed_time(&start_time);
+	_dataman_request_pub.publish(request);
+
+	while ((num_received < request.count) && (time_elapsed < timeout)) {
+
+		int32_t ret = px4_poll(&_fds, 1, 100);
+
+		if (ret <= 0) {
+			// missing items are read individually
+			break;
+		}
+
+		bool updated = false;
+		orb_check(_dataman_response_sub, &updated);
+
+		if (updated) {
+			dataman_response_s response;
+			orb_copy(ORB_ID(dataman_response), _dataman_response_sub, &response);
+
+			const uint32_t i = response.index - request.index;
+
+			if ((response.client_id == request.client_id) &&
+			    (response.request_type == request.request_type) &&
+			    (response.item == request.item) &&
+			    (response.index >= request.index) && (i < request.count) && !received[i]) {
+
+				if (response.status != dataman_response_s::STATUS_SUCCESS) {
+					PX4_ERR("readRangeSync failed! status=%" PRIu8 ", item=%" PRIu8 ", index=%" PRIu32,
+						response.status, request.item, response.index);
+					return false;
+				}
+
+				memcpy(buffer + i * request.data_length, response.data, request.data_length);
+				received[i] = true;
+				num_received++;
+			}
+		}
+
+		time_elapsed = hrt_elapsed_time(&start_time);
+	}
+
+	return true;
+}
+
+bool DatamanClient::readRangeSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, uint32_t count,
+				  hrt_abstime timeout)
+{
+	if (length > g_per_item_size[item]) {
+		PX4_ERR("Length  %" PRIu32 " can't fit in data size for item  %" PRIi8, length, static_cast<uint8_t>(item));
+		return false;
+	}
+
+	hrt_abstime timestamp = hrt_absolute_time();
+
+	for (uint32_t first = 0; first < count; first += READ_RANGE_MAX_ITEMS) {
+
+		dataman_request_s request;
+		request.timestamp = hrt_absolute_time();
+		request.index = index + first;
+		request.data_length = length;
+		request.count = math::min(count - first, READ_RANGE_MAX_ITEMS);
+		request.client_id = _client_id;
+		request.request_type = DM_READ_RANGE;
+		request.item = static_cast<uint8_t>(item);
+
+		bool received[READ_RANGE_MAX_ITEMS] {};
+
+		if (!rangeHandler(request, buffer + first * length, received, timestamp, timeout)) {
+			return false;
+		}
+
+		for (uint32_t i = 0; i < request.count; i++) {
+			if (!received[i] && !readSync(item, request.index + i, buffer + (first + i) * length, length, timeout)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
 bool DatamanClient::writeSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, hrt_abstime timeout)
 {
 	if (length > g_per_item_size[item]) {
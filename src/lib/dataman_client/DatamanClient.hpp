@@ -64,6 +64,26 @@ public:
 	 */
 	bool readSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, hrt_abstime timeout = 1000_ms);
 
+	/**
+	 * @brief Reads consecutive items synchronously from the dataman.
+	 *
+	 * Up to READ_RANGE_MAX_ITEMS items are transferred with a single request, items that are not
+	 * received are read individually.
+	 *
+	 * @param[in] item The item to read data from.
+	 * @param[in] index The index of the first item to read data from.
+	 * @param[out] buffer Pointer to the buffer to store the read data, count * length bytes.
+	 * @param[in] length The length of the data to read per item.
+	 * @param[in] count The number of items to read.
+	 * @param[in] timeout The timeout in microseconds for waiting for the responses.
+	 *
+	 * @return true if all data was read successfully within the timeout, false otherwise.
+	 */
+	bool readRangeSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, uint32_t count,
+			   hrt_abstime timeout = 1000_ms);
+
+	static constexpr uint32_t READ_RANGE_MAX_ITEMS{dataman_response_s::ORB_QUEUE_LENGTH};
+
 	/**
 	 * @brief Write data to the dataman synchronously.
 	 *
@@ -174,6 +194,10 @@ private:
 	bool syncHandler(const dataman_request_s &request, dataman_response_s &response,
 			 const hrt_abstime &start_time, hrt_abstime timeout);
 
+	/* Range read response handler, marks the items that were received */
+	bool rangeHandler(const dataman_request_s &request, uint8_t *buffer, bool received[],
+			  const hrt_abstime &start_time, hrt_abstime timeout);
+
 	State _state{State::Idle};
 	Request _active_request{};
 	uint8_t _response_status{};
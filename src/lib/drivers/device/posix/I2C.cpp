@@ -49,6 +49,7 @@
 #include <linux/i2c.h>
 #include <linux/i2c-dev.h>
 
+#include <drivers/drv_hrt.h>
 #include <px4_platform_common/i2c_spi_buses.h>
 
 namespace device
@@ -133,6 +134,10 @@ I2C::transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const
 		return PX4_ERROR;
 	}
 
+#if defined(CONFIG_I2C_BUS_STATISTICS)
+	const hrt_abstime time_start = hrt_absolute_time();
+#endif // CONFIG_I2C_BUS_STATISTICS
+
 	do {
 		DEVICE_DEBUG("transfer out %p/%u  in %p/%u", send, send_len, recv, recv_len);
 
@@ -177,6 +182,10 @@ I2C::transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const
 
 	} while (retry_count++ < _retries);
 
+#if defined(CONFIG_I2C_BUS_STATISTICS)
+	px4_i2c_bus_statistics_update(get_device_bus(), hrt_elapsed_time(&time_start), send_len + recv_len, ret != PX4_OK);
+#endif // CONFIG_I2C_BUS_STATISTICS
+
 	return ret;
 }
 
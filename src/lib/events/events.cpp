@@ -45,26 +45,44 @@ static uint16_t event_sequence{events::initial_event_sequence};
 namespace events
 {
 
-void send(EventType &event)
+static void publish(EventType &event)
 {
 	event.timestamp = hrt_absolute_time();
+	event.event_sequence = ++event_sequence; // Set the sequence here so we're able to detect uORB queue overflows
 
+	if (orb_event_pub != nullptr) {
+		orb_publish(ORB_ID(event), orb_event_pub, &event);
+
+	} else {
+		orb_event_pub = orb_advertise_queue(ORB_ID(event), &event, queue_length);
+	}
+}
+
+void send(EventType &event)
+{
 	// We need some synchronization here because:
 	// - modifying orb_event_pub
 	// - the update of event_sequence needs to be atomic
 	// - we need to ensure ordering of the sequence numbers: the sequence we set here
 	//   has to be the one published next.
 	pthread_mutex_lock(&publish_event_mutex);
-	event.event_sequence = ++event_sequence; // Set the sequence here so we're able to detect uORB queue overflows
-
-	if (orb_event_pub != nullptr) {
-		orb_publish(ORB_ID(event), orb_event_pub, &event);
+	publish(event);
+	pthread_mutex_unlock(&publish_event_mutex);
+}
 
-	} else {
-		orb_event_pub = orb_advertise_queue(ORB_ID(event), &event, event_s::ORB_QUEUE_LENGTH);
-	}
+Batch::Batch()
+{
+	pthread_mutex_lock(&publish_event_mutex);
+}
 
+Batch::~Batch()
+{
 	pthread_mutex_unlock(&publish_event_mutex);
 }
 
+void Batch::send(EventType &event)
+{
+	publish(event);
+}
+
 } /* namespace events */
@@ -50,4 +50,14 @@ void send(EventType &event)
 	boardctl(EVENTSIOCSEND, reinterpret_cast<unsigned long>(&data));
 }
 
+// the lock is in the kernel, each event is sent on its own
+Batch::Batch() = default;
+
+Batch::~Batch() = default;
+
+void Batch::send(EventType &event)
+{
+	events::send(event);
+}
+
 } /* namespace events */
@@ -87,6 +87,30 @@ void MapProjection::project(double lat, double lon, float &x, float &y) const
 	y = static_cast<float>(k * cos_lat * sin(lon_rad - _ref_lon) * CONSTANTS_RADIUS_OF_EARTH);
 }
 
+void MapProjection::project(const double lat[], const double lon[], float x[], float y[], size_t count) const
+{
+	const float ref_sin_lat = static_cast<float>(_ref_sin_lat);
+	const float ref_cos_lat = static_cast<float>(_ref_cos_lat);
+	const float radius_sq = _fast_radius * _fast_radius;
+	const float earth_radius = CONSTANTS_RADIUS_OF_EARTH_F;
+
+	// the offsets to the reference are small, they are taken in double and evaluated in float
+	for (size_t i = 0; i < count; i++) {
+		const float d_lat = static_cast<float>(math::radians(lat[i]) - _ref_lat);
+		const float d_lon = static_cast<float>(math::radians(lon[i]) - _ref_lon);
+
+		x[i] = earth_radius * (d_lat + 0.5f * ref_sin_lat * ref_cos_lat * d_lon * d_lon);
+		y[i] = earth_radius * d_lon * (ref_cos_lat - ref_sin_lat * d_lat);
+	}
+
+	// points outside of the radius of the approximation
+	for (size_t i = 0; i < count; i++) {
+		if (!(x[i] * x[i] + y[i] * y[i] <= radius_sq)) {
+			project(lat[i], lon[i], x[i], y[i]);
+		}
+	}
+}
+
 void MapProjection::reproject(float x, float y, double &lat, double &lon) const
 {
 	const double x_rad = (double)x / CONSTANTS_RADIUS_OF_EARTH;
@@ -125,6 +149,44 @@ float get_distance_to_next_waypoint(double lat_now, double lon_now, double lat_n
 	return static_cast<float>(CONSTANTS_RADIUS_OF_EARTH * 2.0 * c);
 }
 
+void get_distances_to_waypoints(double lat_now, double lon_now, const double lat_next[], const double lon_next[],
+				float dist[], size_t count, float fast_radius)
+{
+	const double lat_now_rad = math::radians(lat_now);
+	const double lon_now_rad = math::radians(lon_now);
+	const float sin_lat_now = static_cast<float>(sin(lat_now_rad));
+	const float cos_lat_now = static_cast<float>(cos(lat_now_rad));
+	const float radius_sq = fast_radius * fast_radius;
+
+	// equirectangular approximation at the mean latitude, the offsets are taken in double and evaluated in float
+	for (size_t i = 0; i < count; i++) {
+		const float d_lat = static_cast<float>(math::radians(lat_next[i]) - lat_now_rad);
+		const float d_lon = static_cast<float>(math::radians(lon_next[i]) - lon_now_rad);
+		const float cos_lat_mean = cos_lat_now - 0.5f * sin_lat_now * d_lat;
+		const float d_east = d_lon * cos_lat_mean;
+
+		dist[i] = CONSTANTS_RADIUS_OF_EARTH_F * sqrtf(d_lat * d_lat + d_east * d_east);
+	}
+
+	// haversine for waypoints outside of the radius of the approximation, cos(lat_now) is shared
+	const double cos_lat_now_d = cos(lat_now_rad);
+
+	for (size_t i = 0; i < count; i++) {
+		if (!(dist[i] * dist[i] <= radius_sq)) {
+			const double lat_next_rad = math::radians(lat_next[i]);
+			const double d_lat = lat_next_rad - lat_now_rad;
+			const double d_lon = math::radians(lon_next[i]) - lon_now_rad;
+			const double sin_d_lat = sin(d_lat / 2.0);
+			const double sin_d_lon = sin(d_lon / 2.0);
+
+			const double a = sin_d_lat * sin_d_lat + sin_d_lon * sin_d_lon * cos_lat_now_d * cos(lat_next_rad);
+			const double c = atan2(sqrt(a), sqrt(1.0 - a));
+
+			dist[i] = static_cast<float>(CONSTANTS_RADIUS_OF_EARTH * 2.0 * c);
+		}
+	}
+}
+
 void create_waypoint_from_line_and_dist(double lat_A, double lon_A, double lat_B, double lon_B, float dist,
 					double *lat_target, double *lon_target)
 {
@@ -77,6 +77,22 @@ struct crosstrack_error_s {
  */
 float get_distance_to_next_waypoint(double lat_now, double lon_now, double lat_next, double lon_next);
 
+/**
+ * Returns the distances from one position to multiple waypoints in meters, see get_distance_to_next_waypoint().
+ * Waypoints closer than fast_radius use a float equirectangular approximation without trigonometric calls
+ * (error below 1 mm per km up to 10 km).
+ *
+ * @param lat_now current position in degrees (47.1234567°, not 471234567°)
+ * @param lon_now current position in degrees (8.1234567°, not 81234567°)
+ * @param lat_next waypoint latitudes in degrees
+ * @param lon_next waypoint longitudes in degrees
+ * @param dist resulting distances in meters
+ * @param count number of waypoints
+ * @param fast_radius radius of the approximation in meters, 0 to always compute the exact distance
+ */
+void get_distances_to_waypoints(double lat_now, double lon_now, const double lat_next[], const double lon_next[],
+				float dist[], size_t count, float fast_radius = 0.f);
+
 /**
  * Creates a new waypoint C on the line of two given waypoints (A, B) at certain distance
  * from waypoint A
@@ -158,6 +174,7 @@ private:
 	double _ref_lon{0.0};
 	double _ref_sin_lat{0.0};
 	double _ref_cos_lat{0.0};
+	float _fast_radius{0.f};
 	bool _ref_init_done{false};
 
 public:
@@ -237,6 +254,26 @@ public:
 	 */
 	void project(double lat, double lon, float &x, float &y) const;
 
+	/**
+	 * Transform multiple points in the geographic coordinate system to the local
+	 * azimuthal equidistant plane using the projection, see project(). Points closer
+	 * than the fast projection radius to the reference use a second order local tangent
+	 * plane approximation in float without trigonometric calls.
+	 * @param lat array of count latitudes in degrees (47.1234567°, not 471234567°)
+	 * @param lon array of count longitudes in degrees (8.1234567°, not 81234567°)
+	 * @param x array of count results north
+	 * @param y array of count results east
+	 * @param count number of points
+	 */
+	void project(const double lat[], const double lon[], float x[], float y[], size_t count) const;
+
+	/**
+	 * Radius around the reference within which the batch project() uses the local tangent
+	 * plane approximation, the error stays below 2 cm up to 10 km.
+	 * @param radius in meters, 0 (default) to always use the exact projection
+	 */
+	void setFastProjectionRadius(float radius) { _fast_radius = radius; }
+
 	/**
 	 * Transform a point in the geographic coordinate system to the local
 	 * azimuthal equidistant plane using the projection
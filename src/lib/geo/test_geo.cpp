@@ -214,3 +214,79 @@ TEST_F(GeoTest, waypoint_from_line_and_negative_distance)
 	EXPECT_FLOAT_EQ(lat_start - lat_offset, lat_target);
 	EXPECT_DOUBLE_EQ(lon_start, lon_target);
 }
+
+TEST_F(GeoTest, projectBatch)
+{
+	// GIVEN: a reference and points on circles of 100 m to 30 km around it
+	MapProjection projection(47.3566094, 8.5190237);
+	static constexpr size_t COUNT = 4 * 36;
+	double lat[COUNT];
+	double lon[COUNT];
+
+	for (size_t i = 0; i < COUNT; i++) {
+		const float radius[4] {100.f, 1000.f, 10000.f, 30000.f};
+		waypoint_from_heading_and_distance(47.3566094, 8.5190237, math::radians(10.f * (i % 36)), radius[i / 36],
+						   &lat[i], &lon[i]);
+	}
+
+	// WHEN: the points are projected as a batch without the fast approximation
+	float x[COUNT];
+	float y[COUNT];
+	projection.project(lat, lon, x, y, COUNT);
+
+	// THEN: the result is identical to single point projections
+	for (size_t i = 0; i < COUNT; i++) {
+		float x_single;
+		float y_single;
+		projection.project(lat[i], lon[i], x_single, y_single);
+		EXPECT_EQ(x[i], x_single);
+		EXPECT_EQ(y[i], y_single);
+	}
+
+	// WHEN: the points within 10 km use the local tangent plane approximation
+	projection.setFastProjectionRadius(10010.f);
+	projection.project(lat, lon, x, y, COUNT);
+
+	// THEN: the error stays below 2 cm, points further away are still exact
+	for (size_t i = 0; i < COUNT; i++) {
+		float x_single;
+		float y_single;
+		projection.project(lat[i], lon[i], x_single, y_single);
+
+		if (i < 3 * 36) {
+			EXPECT_NEAR(x[i], x_single, 0.02f) << i;
+			EXPECT_NEAR(y[i], y_single, 0.02f) << i;
+
+		} else {
+			EXPECT_EQ(x[i], x_single);
+			EXPECT_EQ(y[i], y_single);
+		}
+	}
+}
+
+TEST_F(GeoTest, distancesToWaypoints)
+{
+	// GIVEN: waypoints at 1 m to 30 km from the current position
+	static constexpr size_t COUNT = 5 * 36;
+	const float radius[5] {1.f, 100.f, 1000.f, 10000.f, 30000.f};
+	double lat[COUNT];
+	double lon[COUNT];
+
+	for (size_t i = 0; i < COUNT; i++) {
+		waypoint_from_heading_and_distance(-33.8688197, 151.2092955, math::radians(10.f * (i % 36)), radius[i / 36],
+						   &lat[i], &lon[i]);
+	}
+
+	// WHEN: the distances are computed exactly and with the approximation up to 10 km
+	float dist[COUNT];
+	float dist_fast[COUNT];
+	get_distances_to_waypoints(-33.8688197, 151.2092955, lat, lon, dist, COUNT);
+	get_distances_to_waypoints(-33.8688197, 151.2092955, lat, lon, dist_fast, COUNT, 10010.f);
+
+	// THEN: both match the single waypoint distance, the approximation within 1 mm per km
+	for (size_t i = 0; i < COUNT; i++) {
+		const float expected = get_distance_to_next_waypoint(-33.8688197, 151.2092955, lat[i], lon[i]);
+		EXPECT_FLOAT_EQ(dist[i], expected);
+		EXPECT_NEAR(dist_fast[i], expected, 1e-6f * expected + 1e-3f) << i;
+	}
+}
@@ -116,6 +116,46 @@ public:
 		}
 	}
 
+	/**
+	 * Filter the sample arrays of several independent filters (e.g. one per axis) in place.
+	 * Same as applyArray() on each filter, with the recursions interleaved sample by sample.
+	 */
+	template<int M>
+	static void applyArrays(LowPassFilter2p<T> *const (&filters)[M], T *const (&samples)[M], int num_samples)
+	{
+		T d1[M], d2[M];
+		float a1[M], a2[M], b0[M], b1[M], b2[M];
+
+		for (int m = 0; m < M; m++) {
+			const LowPassFilter2p<T> &f = *filters[m];
+
+			d1[m] = f._delay_element_1;
+			d2[m] = f._delay_element_2;
+
+			a1[m] = f._a1;
+			a2[m] = f._a2;
+			b0[m] = f._b0;
+			b1[m] = f._b1;
+			b2[m] = f._b2;
+		}
+
+		for (int n = 0; n < num_samples; n++) {
+			for (int m = 0; m < M; m++) {
+				const T delay_element_0{samples[m][n] - d1[m] * a1[m] - d2[m] * a2[m]};
+
+				samples[m][n] = delay_element_0 * b0[m] + d1[m] * b1[m] + d2[m] * b2[m];
+
+				d2[m] = d1[m];
+				d1[m] = delay_element_0;
+			}
+		}
+
+		for (int m = 0; m < M; m++) {
+			filters[m]->_delay_element_1 = d1[m];
+			filters[m]->_delay_element_2 = d2[m];
+		}
+	}
+
 	// Return the cutoff frequency
 	float get_cutoff_freq() const { return _cutoff_freq; }
 
@@ -294,6 +294,45 @@ TEST_F(NotchFilterTest, filterVector3fDF1)
 	}
 }
 
+TEST_F(NotchFilterTest, applyArraysEqualsApplyArray)
+{
+	// GIVEN: three pairs of identical filters with different notch frequencies
+	NotchFilter<float> reference[3];
+	NotchFilter<float> interleaved[3];
+	const float notch_freq[3] {50.f, 120.f, 333.f};
+
+	for (int axis = 0; axis < 3; axis++) {
+		reference[axis].setParameters(_sample_freq, notch_freq[axis], _bandwidth);
+		interleaved[axis].setParameters(_sample_freq, notch_freq[axis], _bandwidth);
+	}
+
+	static constexpr int N = 8;
+	float data_reference[3][N];
+	float data_interleaved[3][N];
+
+	for (int block = 0; block < 50; block++) {
+		for (int axis = 0; axis < 3; axis++) {
+			for (int n = 0; n < N; n++) {
+				const float t = (block * N + n) / _sample_freq;
+				data_reference[axis][n] = data_interleaved[axis][n] = sinf(2.f * M_PI_F * (10.f + 40.f * axis) * t) + 0.1f * axis;
+			}
+
+			reference[axis].applyArray(data_reference[axis], N);
+		}
+
+		// WHEN: the interleaved filters process all axes at once
+		NotchFilter<float>::applyArrays({&interleaved[0], &interleaved[1], &interleaved[2]},
+		{data_interleaved[0], data_interleaved[1], data_interleaved[2]}, N);
+
+		// THEN: the output is identical to filtering each axis separately
+		for (int axis = 0; axis < 3; axis++) {
+			for (int n = 0; n < N; n++) {
+				EXPECT_FLOAT_EQ(data_reference[axis][n], data_interleaved[axis][n]);
+			}
+		}
+	}
+}
+
 TEST_F(NotchFilterTest, disabled)
 {
 	const float zero_notch_freq = 0.f;
@@ -145,13 +145,18 @@ public:
 	Matrix<Type, M, P> operator*(const Matrix<Type, N, P> &other) const
 	{
 		const Matrix<Type, M, N> &self = *this;
-		Matrix<Type, M, P> res{};
+		Matrix<Type, M, P> res;
 
 		for (size_t i = 0; i < M; i++) {
 			for (size_t k = 0; k < P; k++) {
+				// accumulate in a local to keep the sum in a register (same summation order as before)
+				Type sum{};
+
 				for (size_t j = 0; j < N; j++) {
-					res(i, k) += self(i, j) * other(j, k);
+					sum += self(i, j) * other(j, k);
 				}
+
+				res(i, k) = sum;
 			}
 		}
 
@@ -191,9 +191,15 @@ matrix::Vector<Type, Q> operator*(const matrix::Matrix<Type, Q, M> &mat,
 {
 	matrix::Vector<Type, Q> res;
 
+	// only read the columns of the non-zero elements
 	for (size_t i = 0; i < Q; i++) {
-		const Vector<Type, M> row = mat.row(i);
-		res(i) = vec.dot(row);
+		Type accum(0);
+
+		for (size_t j = 0; j < vec.non_zeros(); j++) {
+			accum += mat(i, vec.index(j)) * vec.atCompressedIndex(j);
+		}
+
+		res(i) = accum;
 	}
 
 	return res;
@@ -0,0 +1,221 @@
+/**
+ * @file SymmetricMatrix.hpp
+ *
+ * A symmetric square matrix only storing the upper right triangle
+ * (row-major, same layout as SquareMatrix::upper_right_triangle()).
+ *
+ * Both (i, j) and (j, i) refer to the same element, so the matrix is
+ * symmetric by construction and needs about half the memory of a SquareMatrix.
+ */
+
+#pragma once
+
+#include "math.hpp"
+
+namespace matrix
+{
+
+template <typename Type, size_t M>
+class SquareMatrix;
+
+template <typename Type, size_t M>
+class Vector;
+
+template <typename Type, size_t M>
+class SymmetricMatrix
+{
+public:
+	static constexpr size_t SIZE = M * (M + 1) / 2;
+
+	SymmetricMatrix() = default;
+
+	// copies the upper right triangle, the lower left triangle is ignored
+	explicit SymmetricMatrix(const SquareMatrix<Type, M> &other)
+	{
+		size_t idx = 0;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = i; j < M; j++) {
+				_data[idx++] = other(i, j);
+			}
+		}
+	}
+
+	inline Type operator()(size_t i, size_t j) const
+	{
+		return _data[index(i, j)];
+	}
+
+	inline Type &operator()(size_t i, size_t j)
+	{
+		return _data[index(i, j)];
+	}
+
+	// packed upper right triangle, SIZE elements
+	const Type *data() const
+	{
+		return _data;
+	}
+
+	SquareMatrix<Type, M> full() const
+	{
+		SquareMatrix<Type, M> res;
+		size_t idx = 0;
+
+		for (size_t i = 0; i < M; i++) {
+			res(i, i) = _data[idx++];
+
+			for (size_t j = i + 1; j < M; j++) {
+				res(i, j) = _data[idx];
+				res(j, i) = _data[idx];
+				idx++;
+			}
+		}
+
+		return res;
+	}
+
+	void zero()
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			_data[i] = Type(0);
+		}
+	}
+
+	Vector<Type, M> diag() const
+	{
+		Vector<Type, M> res;
+
+		for (size_t i = 0; i < M; i++) {
+			res(i) = _data[index(i, i)];
+		}
+
+		return res;
+	}
+
+	template <size_t Width>
+	Type trace(size_t first) const
+	{
+		static_assert(Width <= M, "Width bigger than matrix");
+		assert(first + Width <= M);
+
+		Type res = 0;
+
+		for (size_t i = first; i < first + Width; i++) {
+			res += _data[index(i, i)];
+		}
+
+		return res;
+	}
+
+	template <size_t Width>
+	SquareMatrix<Type, Width> block(size_t first) const
+	{
+		static_assert(Width <= M, "Width bigger than matrix");
+		assert(first + Width <= M);
+
+		SquareMatrix<Type, Width> res;
+
+		for (size_t i = 0; i < Width; i++) {
+			for (size_t j = 0; j < Width; j++) {
+				res(i, j) = (*this)(first + i, first + j);
+			}
+		}
+
+		return res;
+	}
+
+	// zero all covariance elements of the rows/columns and set the diagonal
+	template <size_t Width>
+	void uncorrelateCovarianceSetVariance(size_t first, Type val)
+	{
+		static_assert(Width <= M, "Width bigger than matrix");
+		assert(first + Width <= M);
+
+		for (size_t i = first; i < first + Width; i++) {
+			for (size_t j = 0; j < M; j++) {
+				(*this)(i, j) = Type(0);
+			}
+
+			(*this)(i, i) = val;
+		}
+	}
+
+	// this = this - a * b^T for a symmetric update (a * b^T == b * a^T)
+	void subtractOuterProduct(const Vector<Type, M> &a, const Vector<Type, M> &b)
+	{
+		size_t idx = 0;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t j = i; j < M; j++) {
+				_data[idx++] -= a(i) * b(j);
+			}
+		}
+	}
+
+	SymmetricMatrix<Type, M> &operator+=(const SymmetricMatrix<Type, M> &other)
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			_data[i] += other._data[i];
+		}
+
+		return *this;
+	}
+
+	SymmetricMatrix<Type, M> &operator-=(const SymmetricMatrix<Type, M> &other)
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			_data[i] -= other._data[i];
+		}
+
+		return *this;
+	}
+
+	static constexpr size_t index(size_t i, size_t j)
+	{
+		// row i of the upper triangle starts after i * M - i * (i - 1) / 2 elements
+		return (i <= j) ? (i * M - (i * (i - 1)) / 2 + (j - i)) : index(j, i);
+	}
+
+private:
+	Type _data[SIZE] {};
+};
+
+template<typename Type, size_t M>
+constexpr size_t SymmetricMatrix<Type, M>::SIZE;
+
+template<typename Type, size_t M>
+SymmetricMatrix<Type, M> operator*(const SymmetricMatrix<Type, M> &A, Type scalar)
+{
+	SymmetricMatrix<Type, M> res;
+
+	for (size_t i = 0; i < M; i++) {
+		for (size_t j = i; j < M; j++) {
+			res(i, j) = A(i, j) * scalar;
+		}
+	}
+
+	return res;
+}
+
+template<typename Type, size_t M>
+Vector<Type, M> operator*(const SymmetricMatrix<Type, M> &A, const Vector<Type, M> &x)
+{
+	Vector<Type, M> res;
+
+	for (size_t i = 0; i < M; i++) {
+		Type sum(0);
+
+		for (size_t j = 0; j < M; j++) {
+			sum += A(i, j) * x(j);
+		}
+
+		res(i) = sum;
+	}
+
+	return res;
+}
+
+using SymmetricMatrix3f = SymmetricMatrix<float, 3>;
+
+} // namespace matrix
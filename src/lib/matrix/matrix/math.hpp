@@ -22,3 +22,4 @@
 #include "Dual.hpp"
 #include "PseudoInverse.hpp"
 #include "SparseVector.hpp"
+#include "SymmetricMatrix.hpp"
@@ -0,0 +1,112 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <matrix/math.hpp>
+
+using namespace matrix;
+
+TEST(MatrixSymmetricTest, PackedLayout)
+{
+	float data[9] = {1, 2, 3,
+			 2, 5, 6,
+			 3, 6, 10
+			};
+	SquareMatrix<float, 3> A(data);
+	SymmetricMatrix<float, 3> S(A);
+
+	// same layout as SquareMatrix::upper_right_triangle()
+	const Vector<float, 6> urt = A.upper_right_triangle();
+
+	for (size_t i = 0; i < SymmetricMatrix<float, 3>::SIZE; i++) {
+		EXPECT_FLOAT_EQ(urt(i), S.data()[i]);
+	}
+
+	EXPECT_TRUE(isEqual(S.full(), A));
+	EXPECT_TRUE(isEqual(S.diag(), A.diag()));
+	EXPECT_FLOAT_EQ(S.trace<2>(1), A.trace<2>(1));
+	EXPECT_EQ(sizeof(SymmetricMatrix<float, 23>), 23 * 24 / 2 * sizeof(float));
+}
+
+TEST(MatrixSymmetricTest, SymmetricAccess)
+{
+	SymmetricMatrix<float, 4> S;
+
+	S(3, 1) = 7.f;
+	EXPECT_FLOAT_EQ(S(1, 3), 7.f);
+
+	S(1, 3) += 1.f;
+	EXPECT_FLOAT_EQ(S(3, 1), 8.f);
+
+	using SymmetricMatrix4f = SymmetricMatrix<float, 4>;
+
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < 4; j++) {
+			EXPECT_EQ(SymmetricMatrix4f::index(i, j), SymmetricMatrix4f::index(j, i));
+			EXPECT_LT(SymmetricMatrix4f::index(i, j), SymmetricMatrix4f::SIZE);
+		}
+	}
+}
+
+TEST(MatrixSymmetricTest, Operations)
+{
+	float data[9] = {4, 1, 2,
+			 1, 5, 3,
+			 2, 3, 6
+			};
+	SquareMatrix<float, 3> A(data);
+	SymmetricMatrix<float, 3> S(A);
+
+	const Vector3f x(1.f, -2.f, 3.f);
+	EXPECT_TRUE(isEqual(Vector3f(S * x), Vector3f(A * x)));
+
+	EXPECT_TRUE(isEqual((S * 2.f).full(), SquareMatrix<float, 3>(A * 2.f)));
+
+	// rank one update K * S * K^T
+	const Vector3f K(0.1f, 0.2f, 0.3f);
+	const Vector3f KS = K * 2.f;
+	S.subtractOuterProduct(KS, K);
+
+	SquareMatrix<float, 3> A_updated = A - Matrix<float, 3, 1>(KS) * K.transpose();
+	EXPECT_TRUE(isEqual(S.full(), A_updated));
+
+	SymmetricMatrix<float, 3> S2(A);
+	S2 += S;
+	S2 -= S;
+	EXPECT_TRUE(isEqual(S2.full(), A));
+
+	S2.uncorrelateCovarianceSetVariance<1>(1, 9.f);
+	A.uncorrelateCovarianceSetVariance<1>(1, 9.f);
+	EXPECT_TRUE(isEqual(S2.full(), A));
+	EXPECT_TRUE(isEqual(S2.block<2>(1), SquareMatrix<float, 2>(A.slice<2, 2>(1, 1))));
+}
@@ -211,6 +211,9 @@ void MixingOutput::cleanupFunctions()
 		_function_allocated[i] = nullptr;
 		_functions[i] = nullptr;
 	}
+
+	_function_mask = 0;
+	_prearm_control_mask = 0;
 }
 
 bool MixingOutput::updateSubscriptions(bool allow_wq_switch)
@@ -312,6 +315,15 @@ bool MixingOutput::updateSubscriptions(bool allow_wq_switch)
 				break;
 			}
 		}
+
+		// the function properties are fixed per provider, so they are only evaluated once here
+		if (_functions[i]) {
+			_function_mask |= 1u << i;
+
+			if (_functions[i]->allowPrearmControl()) {
+				_prearm_control_mask |= 1u << i;
+			}
+		}
 	}
 
 	hrt_abstime fixed_rate_scheduling_interval = 4_ms; // schedule at 250Hz
@@ -434,28 +446,23 @@ bool MixingOutput::update()
 
 	// get output values
 	float outputs[MAX_ACTUATORS];
-	bool all_disabled = true;
+	const uint32_t control_mask = _armed.armed ? _function_mask : (_armed.prearmed ? _prearm_control_mask : 0);
 	_reversible_mask = 0;
 
 	for (int i = 0; i < _max_num_outputs; ++i) {
-		if (_functions[i]) {
-			all_disabled = false;
-
-			if (_armed.armed || (_armed.prearmed && _functions[i]->allowPrearmControl())) {
-				outputs[i] = _functions[i]->value(_function_assignment[i]);
-
-			} else {
-				outputs[i] = NAN;
-			}
-
-			_reversible_mask |= (uint32_t)_functions[i]->reversible(_function_assignment[i]) << i;
+		if (control_mask & (1u << i)) {
+			outputs[i] = _functions[i]->value(_function_assignment[i]);
 
 		} else {
 			outputs[i] = NAN;
 		}
+
+		if (_function_mask & (1u << i)) {
+			_reversible_mask |= (uint32_t)_functions[i]->reversible(_function_assignment[i]) << i;
+		}
 	}
 
-	if (!all_disabled) {
+	if (_function_mask != 0) {
 		if (!_armed.armed && !_armed.manual_lockdown) {
 			_actuator_test.overrideValues(outputs, _max_num_outputs);
 		}
@@ -632,6 +639,13 @@ MixingOutput::setAndPublishActuatorOutputs(unsigned num_outputs, actuator_output
 		actuator_outputs.output[i] = _current_output_value[i];
 	}
 
+	// Just check the first function. It means we only get the latency if motors are assigned first, which is the default
+	hrt_abstime timestamp_sample = 0;
+
+	if (_function_allocated[0] && _function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)) {
+		actuator_outputs.timestamp_sample = timestamp_sample;
+	}
+
 	actuator_outputs.timestamp = hrt_absolute_time();
 	_outputs_pub.publish(actuator_outputs);
 }
@@ -639,13 +653,8 @@ MixingOutput::setAndPublishActuatorOutputs(unsigned num_outputs, actuator_output
 void
 MixingOutput::updateLatencyPerfCounter(const actuator_outputs_s &actuator_outputs)
 {
-	// Just check the first function. It means we only get the latency if motors are assigned first, which is the default
-	if (_function_allocated[0]) {
-		hrt_abstime timestamp_sample;
-
-		if (_function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)) {
-			perf_set_elapsed(_control_latency_perf, actuator_outputs.timestamp - timestamp_sample);
-		}
+	if (actuator_outputs.timestamp_sample != 0) {
+		perf_set_elapsed(_control_latency_perf, actuator_outputs.timestamp - actuator_outputs.timestamp_sample);
 	}
 }
 
@@ -280,6 +280,8 @@ private:
 	FunctionProviderBase *_function_allocated[MAX_ACTUATORS] {}; ///< unique allocated functions
 	FunctionProviderBase *_functions[MAX_ACTUATORS] {}; ///< currently assigned functions
 	OutputFunction _function_assignment[MAX_ACTUATORS] {};
+	uint32_t _function_mask{0}; ///< per-output bits. If set, a function is assigned to the output
+	uint32_t _prearm_control_mask{0}; ///< per-output bits. If set, the assigned function is controlled while prearmed
 	bool _need_function_update{true};
 	bool _has_backup_schedule{false};
 	const char *const _param_prefix;
@@ -237,29 +237,43 @@ Trajectory VelocitySmoothing::evaluatePoly(float j, float a0, float v0, float x0
 	return traj;
 }
 
-void VelocitySmoothing::updateTraj(float dt, float time_stretch)
+Trajectory VelocitySmoothing::evaluateTrajAtLocalTime(float local_time) const
 {
-	_local_time += dt * time_stretch;
-	float t_remain = _local_time;
+	float t_remain = local_time;
 
 	float t1 = math::min(t_remain, _T1);
-	_state = evaluatePoly(_max_jerk, _state_init.a, _state_init.v, _state_init.x, t1, _direction);
+	Trajectory traj = evaluatePoly(_max_jerk, _state_init.a, _state_init.v, _state_init.x, t1, _direction);
 	t_remain -= t1;
 
 	if (t_remain > 0.f) {
 		float t2 = math::min(t_remain, _T2);
-		_state = evaluatePoly(0.f, _state.a, _state.v, _state.x, t2, 0.f);
+		traj = evaluatePoly(0.f, traj.a, traj.v, traj.x, t2, 0.f);
 		t_remain -= t2;
 	}
 
 	if (t_remain > 0.f) {
 		float t3 = math::min(t_remain, _T3);
-		_state = evaluatePoly(_max_jerk, _state.a, _state.v, _state.x, t3, -_direction);
+		traj = evaluatePoly(_max_jerk, traj.a, traj.v, traj.x, t3, -_direction);
 		t_remain -= t3;
 	}
 
 	if (t_remain > 0.f) {
-		_state = evaluatePoly(0.f, 0.f, _state.v, _state.x, t_remain, 0.f);
+		traj = evaluatePoly(0.f, 0.f, traj.v, traj.x, t_remain, 0.f);
+	}
+
+	return traj;
+}
+
+void VelocitySmoothing::updateTraj(float dt, float time_stretch)
+{
+	_local_time += dt * time_stretch;
+	_state = evaluateTrajAtLocalTime(_local_time);
+}
+
+void VelocitySmoothing::evaluateTraj(const float t[], Trajectory traj[], int n) const
+{
+	for (int i = 0; i < n; i++) {
+		traj[i] = evaluateTrajAtLocalTime(_local_time + t[i]);
 	}
 }
 
@@ -87,6 +87,21 @@ public:
 	 */
 	void updateTraj(float dt, float time_stretch = 1.f);
 
+	/**
+	 * Evaluate the current trajectory in the future without changing its state
+	 * @param t time from now [s]
+	 * @return jerk, acceleration, velocity and position at that time
+	 */
+	Trajectory evaluateTraj(float t) const { return evaluateTrajAtLocalTime(_local_time + t); }
+
+	/**
+	 * Evaluate the current trajectory at several future times in one call
+	 * @param t times from now [s]
+	 * @param traj output, one trajectory sample per time
+	 * @param n number of samples
+	 */
+	void evaluateTraj(const float t[], Trajectory traj[], int n) const;
+
 	/**
 	 * Getters and setters
 	 */
@@ -189,6 +204,12 @@ private:
 	 */
 	inline Trajectory evaluatePoly(float j, float a0, float v0, float x0, float t, int d) const;
 
+	/**
+	 * Closed-form evaluation of the trajectory starting at _state_init
+	 * @param local_time time since the start of the trajectory
+	 */
+	Trajectory evaluateTrajAtLocalTime(float local_time) const;
+
 	/* Input */
 	float _vel_sp{0.f};
 
@@ -267,3 +267,40 @@ TEST_F(VelocitySmoothingTest, testZeroSetpoint)
 		EXPECT_FLOAT_EQ(_trajectories[i].getCurrentPosition(), 0.f);
 	}
 }
+
+TEST(VelocitySmoothingBasicTest, EvaluateFutureTrajectory)
+{
+	// GIVEN: A trajectory from rest to a velocity setpoint
+	VelocitySmoothing trajectory;
+	trajectory.setMaxJerk(10.f);
+	trajectory.setMaxAccel(3.f);
+	trajectory.setMaxVel(5.f);
+	trajectory.updateDurations(4.f);
+	trajectory.updateTraj(0.1f);
+
+	// WHEN: We sample the future of the trajectory in one call
+	const float t[4] {0.f, 0.5f, 1.f, 3.f};
+	Trajectory samples[4];
+	trajectory.evaluateTraj(t, samples, 4);
+
+	// THEN: The current state is not changed
+	EXPECT_FLOAT_EQ(samples[0].a, trajectory.getCurrentAcceleration());
+	EXPECT_FLOAT_EQ(samples[0].v, trajectory.getCurrentVelocity());
+	EXPECT_FLOAT_EQ(samples[0].x, trajectory.getCurrentPosition());
+	EXPECT_FLOAT_EQ(trajectory.evaluateTraj(0.f).x, trajectory.getCurrentPosition());
+
+	// AND: The samples match the trajectory once propagated to the same times
+	float time = 0.f;
+
+	for (int i = 1; i < 4; i++) {
+		trajectory.updateTraj(t[i] - time);
+		time = t[i];
+		EXPECT_FLOAT_EQ(samples[i].j, trajectory.getCurrentJerk());
+		EXPECT_FLOAT_EQ(samples[i].a, trajectory.getCurrentAcceleration());
+		EXPECT_FLOAT_EQ(samples[i].v, trajectory.getCurrentVelocity());
+		EXPECT_FLOAT_EQ(samples[i].x, trajectory.getCurrentPosition());
+	}
+
+	// AND: The setpoint is reached at the end
+	EXPECT_FLOAT_EQ(samples[3].v, 4.f);
+}
@@ -0,0 +1,202 @@
+/****************************************************************************
+ *
+ * Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file PathSegment.hpp
+ * Line or circle path for NPFG with the geometry precomputed once per segment.
+ *
+ * The constant parts of a path (unit tangent, length, curvature) only change with the
+ * position setpoint triplet, so they are computed when the segment is built instead of
+ * on every guidance update.
+ */
+
+#pragma once
+
+#include <float.h>
+#include <matrix/math.hpp>
+#include <px4_platform_common/defines.h>
+
+class PathSegment
+{
+public:
+	enum class Type : uint8_t {
+		NONE,
+		LINE,	///< infinite line through a point in the direction of the unit tangent
+		CIRCLE,	///< circle around a center point
+	};
+
+	PathSegment() = default;
+
+	/**
+	 * Line through two points, directed from start to end.
+	 * Returns an invalid segment if the points coincide.
+	 */
+	static PathSegment line(const matrix::Vector2f &start, const matrix::Vector2f &end)
+	{
+		PathSegment segment;
+		const matrix::Vector2f start_to_end = end - start;
+		const float length = start_to_end.norm();
+
+		if (length > FLT_EPSILON) {
+			segment._type = Type::LINE;
+			segment._point = start;
+			segment._end = end;
+			segment._unit_tangent = start_to_end / length;
+			segment._length = length;
+		}
+
+		return segment;
+	}
+
+	/**
+	 * Line through a point in the direction of a bearing.
+	 */
+	static PathSegment line(const matrix::Vector2f &point, float bearing)
+	{
+		PathSegment segment;
+		segment._type = Type::LINE;
+		segment._point = point;
+		segment._bearing = bearing;
+		segment._unit_tangent = matrix::Vector2f{cosf(bearing), sinf(bearing)};
+		segment._end = point + segment._unit_tangent;
+		segment._length = INFINITY;
+		return segment;
+	}
+
+	/**
+	 * Circle around a center, clockwise or counter-clockwise seen from above.
+	 */
+	static PathSegment circle(const matrix::Vector2f &center, float radius, bool counter_clockwise)
+	{
+		PathSegment segment;
+
+		if (radius > FLT_EPSILON) {
+			segment._type = Type::CIRCLE;
+			segment._point = center;
+			segment._radius = radius;
+			segment._direction = counter_clockwise ? -1.f : 1.f;
+			segment._curvature = segment._direction / radius;
+			segment._length = 2.f * M_PI_F * radius;
+		}
+
+		return segment;
+	}
+
+	/** @return true if this is the line through start and end (within 1e-4 m) */
+	bool isLine(const matrix::Vector2f &start, const matrix::Vector2f &end) const
+	{
+		return (_type == Type::LINE) && !PX4_ISFINITE(_bearing) && (_point == start) && (_end == end);
+	}
+
+	/** @return true if this is the line through point along bearing */
+	bool isLine(const matrix::Vector2f &point, float bearing) const
+	{
+		return (_type == Type::LINE) && PX4_ISFINITE(_bearing) && (_point == point)
+		       && (fabsf(_bearing - bearing) < FLT_EPSILON);
+	}
+
+	/** @return true if this is the circle with the given center, radius and direction */
+	bool isCircle(const matrix::Vector2f &center, float radius, bool counter_clockwise) const
+	{
+		return (_type == Type::CIRCLE) && (_point == center) && (fabsf(_radius - radius) < FLT_EPSILON)
+		       && ((_direction < 0.f) == counter_clockwise);
+	}
+
+	bool valid() const { return _type != Type::NONE; }
+	Type type() const { return _type; }
+
+	/** signed path curvature, positive for clockwise circles [1/m] */
+	float curvature() const { return _curvature; }
+
+	/** length of the segment, the circumference for circles and infinite for lines along a bearing [m] */
+	float length() const { return _length; }
+
+	/**
+	 * Closest point on the path to the vehicle and the path tangent at that point.
+	 *
+	 * @param[in] vehicle_pos vehicle position [m]
+	 * @param[in] ground_vel vehicle ground velocity, sets the point close to the center of a circle [m/s]
+	 * @param[out] closest_point closest point on the path [m]
+	 * @param[out] unit_path_tangent unit tangent of the path at the closest point
+	 */
+	void closestPoint(const matrix::Vector2f &vehicle_pos, const matrix::Vector2f &ground_vel,
+			  matrix::Vector2f &closest_point, matrix::Vector2f &unit_path_tangent) const
+	{
+		if (_type == Type::CIRCLE) {
+			const matrix::Vector2f center_to_vehicle = vehicle_pos - _point;
+			const float dist_to_center_squared = center_to_vehicle.norm_squared();
+
+			// direction from the circle center to the closest point on its perimeter
+			matrix::Vector2f unit_vec_center_to_closest_pt;
+
+			if (dist_to_center_squared < 0.1f * 0.1f) {
+				// the logic breaks down at the circle center, employ some mitigation strategies
+				// until we exit this region
+				if (ground_vel.norm_squared() < 0.1f * 0.1f) {
+					// arbitrarily set the point in the northern top of the circle
+					unit_vec_center_to_closest_pt = matrix::Vector2f{1.f, 0.f};
+
+				} else {
+					// set the point in the direction we are moving
+					unit_vec_center_to_closest_pt = ground_vel.normalized();
+				}
+
+			} else {
+				unit_vec_center_to_closest_pt = center_to_vehicle / sqrtf(dist_to_center_squared);
+			}
+
+			// 90 deg clockwise rotation * direction
+			unit_path_tangent = _direction * matrix::Vector2f{-unit_vec_center_to_closest_pt(1), unit_vec_center_to_closest_pt(0)};
+			closest_point = _point + unit_vec_center_to_closest_pt * _radius;
+
+		} else {
+			const matrix::Vector2f point_to_vehicle = vehicle_pos - _point;
+			unit_path_tangent = _unit_tangent;
+			closest_point = _point + point_to_vehicle.dot(_unit_tangent) * _unit_tangent;
+		}
+	}
+
+private:
+	Type _type{Type::NONE};
+
+	matrix::Vector2f _point{};		///< start point of a line or center of a circle [m]
+	matrix::Vector2f _end{};		///< end point of a line [m]
+	matrix::Vector2f _unit_tangent{};	///< unit tangent of a line
+
+	float _bearing{NAN};			///< bearing of a line built from a bearing [rad]
+	float _radius{0.f};			///< radius of a circle [m]
+	float _direction{1.f};			///< 1 for clockwise, -1 for counter-clockwise circles
+	float _curvature{0.f};			///< signed path curvature [1/m]
+	float _length{0.f};			///< [m]
+};
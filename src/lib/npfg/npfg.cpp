@@ -109,10 +109,13 @@ void NPFG::guideToPath(const matrix::Vector2f &curr_pos_local, const Vector2f &g
 
 	// look ahead angle based solely on track proximity
 	const float look_ahead_ang = lookAheadAngle(normalized_track_error);
+	const float cos_look_ahead_ang = cosf(look_ahead_ang);
+	const float sin_look_ahead_ang = sinf(look_ahead_ang);
 
-	track_proximity_ = trackProximity(look_ahead_ang);
+	// same as trackProximity(look_ahead_ang)
+	track_proximity_ = sin_look_ahead_ang * sin_look_ahead_ang;
 
-	bearing_vec_ = bearingVec(unit_path_tangent, look_ahead_ang, signed_track_error_);
+	bearing_vec_ = bearingVec(unit_path_tangent, cos_look_ahead_ang, sin_look_ahead_ang, signed_track_error_);
 
 	// wind triangle projections
 	const float wind_cross_bearing = wind_vel.cross(bearing_vec_);
@@ -149,6 +152,13 @@ void NPFG::guideToPath(const matrix::Vector2f &curr_pos_local, const Vector2f &g
 	updateRollSetpoint();
 } // guideToPath
 
+void NPFG::guideToPath(const Vector2f &curr_pos_local, const Vector2f &ground_vel, const Vector2f &wind_vel,
+		       const PathSegment &segment, Vector2f &closest_point, Vector2f &unit_path_tangent)
+{
+	segment.closestPoint(curr_pos_local, ground_vel, closest_point, unit_path_tangent);
+	guideToPath(curr_pos_local, ground_vel, wind_vel, unit_path_tangent, closest_point, segment.curvature());
+} // guideToPath
+
 float NPFG::adaptPeriod(const float ground_speed, const float airspeed, const float wind_speed,
 			const float track_error, const float path_curvature, const Vector2f &wind_vel,
 			const Vector2f &unit_path_tangent, const float feas_on_track) const
@@ -290,12 +300,9 @@ float NPFG::lookAheadAngle(const float normalized_track_error) const
 	return M_PI_2_F * (normalized_track_error - 1.0f) * (normalized_track_error - 1.0f);
 } // lookAheadAngle
 
-Vector2f NPFG::bearingVec(const Vector2f &unit_path_tangent, const float look_ahead_ang,
-			  const float signed_track_error) const
+Vector2f NPFG::bearingVec(const Vector2f &unit_path_tangent, const float cos_look_ahead_ang,
+			  const float sin_look_ahead_ang, const float signed_track_error) const
 {
-	const float cos_look_ahead_ang = cosf(look_ahead_ang);
-	const float sin_look_ahead_ang = sinf(look_ahead_ang);
-
 	Vector2f unit_path_normal(-unit_path_tangent(1), unit_path_tangent(0)); // right handed 90 deg (clockwise) turn
 	Vector2f unit_track_error = -((signed_track_error < 0.0f) ? -1.0f : 1.0f) * unit_path_normal;
 
@@ -63,6 +63,8 @@
 #include <matrix/math.hpp>
 #include <lib/mathlib/mathlib.h>
 
+#include "PathSegment.hpp"
+
 #include <uORB/topics/vehicle_local_position.h>
 
 /*
@@ -101,6 +103,21 @@ public:
 			 const matrix::Vector2f &unit_path_tangent, const matrix::Vector2f &position_on_path,
 			 const float path_curvature);
 
+	/*
+	 * Computes the lateral acceleration and airspeed references necessary to track
+	 * a precomputed path segment (see PathSegment).
+	 *
+	 * @param[in] curr_pos_local Current horizontal vehicle position in local coordinates [m]
+	 * @param[in] ground_vel Vehicle ground velocity vector [m/s]
+	 * @param[in] wind_vel Wind velocity vector [m/s]
+	 * @param[in] segment Path segment to follow, must be valid
+	 * @param[out] closest_point Closest point on the path [m]
+	 * @param[out] unit_path_tangent Unit path tangent at the closest point
+	 */
+	void guideToPath(const matrix::Vector2f &curr_pos_local, const matrix::Vector2f &ground_vel,
+			 const matrix::Vector2f &wind_vel, const PathSegment &segment,
+			 matrix::Vector2f &closest_point, matrix::Vector2f &unit_path_tangent);
+
 	/*
 	 * Set the nominal controller period [s].
 	 */
@@ -472,14 +489,14 @@ private:
 	 *
 	 * @param[in] unit_path_tangent Unit vector tangent to path at closest point
 	 *            in direction of path
-	 * @param[in] look_ahead_ang The bearing vector lies at this angle from
-	 *            the path normal vector [rad]
+	 * @param[in] cos_look_ahead_ang, sin_look_ahead_ang Cosine and sine of the angle
+	 *            of the bearing vector from the path normal vector
 	 * @param[in] signed_track_error Signed error to track at closest point (sign
 	 *            determined by path normal direction) [m]
 	 * @return Unit bearing vector
 	 */
-	matrix::Vector2f bearingVec(const matrix::Vector2f &unit_path_tangent, const float look_ahead_ang,
-				    const float signed_track_error) const;
+	matrix::Vector2f bearingVec(const matrix::Vector2f &unit_path_tangent, const float cos_look_ahead_ang,
+				    const float sin_look_ahead_ang, const float signed_track_error) const;
 
 	/*
 	 * Calculates the minimum forward ground speed demand for minimum forward
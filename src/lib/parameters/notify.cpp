@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "notify.h"
+
+#include "param.h"
+#include "atomic_transaction.h"
+
+using namespace time_literals;
+
+// a bulk upload sets many parameters in a row, so that every module only updates its parameters
+// once per interval instead of once per parameter
+static constexpr hrt_abstime rate_limit = 100_ms;
+
+ParamNotify::ParamNotify()
+	: ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::lp_default)
+{
+}
+
+void ParamNotify::request()
+{
+	bool notify = false;
+
+	{
+		const AtomicTransaction transaction;
+
+		if (_scheduled.load()) {
+			// the change is included in the pending notification
+			return;
+		}
+
+		const hrt_abstime now = hrt_absolute_time();
+		const hrt_abstime last_notify_elapsed = now - _last_timestamp;
+
+		if ((_last_timestamp == 0) || (last_notify_elapsed >= rate_limit)) {
+			_last_timestamp = now;
+			notify = true;
+
+		} else {
+			_scheduled.store(true);
+			ScheduleDelayed(rate_limit - last_notify_elapsed);
+		}
+	}
+
+	if (notify) {
+		param_notify_changes();
+	}
+}
+
+void ParamNotify::Run()
+{
+	{
+		const AtomicTransaction transaction;
+		_last_timestamp = hrt_absolute_time();
+		// clear _scheduled first, changes during the notification need another one
+		_scheduled.store(false);
+	}
+
+	param_notify_changes();
+}
@@ -45,6 +45,7 @@
 #include "param.h"
 #include "param_translation.h"
 #include <parameters/px4_parameters.hpp>
+#include <parameters/px4_parameters_hash.hpp>
 #include <lib/tinybson/tinybson.h>
 
 #include <crc32.h>
@@ -97,6 +98,9 @@ static char *param_backup_file = nullptr;
 #include "autosave.h"
 static ParamAutosave *autosave_instance {nullptr};
 
+#include "notify.h"
+static ParamNotify *notify_instance {nullptr};
+
 static px4::AtomicBitset<param_info_count> params_active;  // params found
 static px4::AtomicBitset<param_info_count> params_unsaved;
 
@@ -129,6 +133,7 @@ param_init()
 #endif
 
 	autosave_instance = new ParamAutosave();
+	notify_instance = new ParamNotify();
 }
 
 
@@ -158,33 +163,15 @@ static param_t param_find_internal(const char *name, bool notification)
 {
 	perf_count(param_find_perf);
 
-	param_t middle;
-	param_t front = 0;
-	param_t last = param_info_count;
-
-	/* perform a binary search of the known parameters */
-
-	while (front <= last) {
-		middle = front + (last - front) / 2;
-		int ret = strcmp(name, param_name(middle));
-
-		if (ret == 0) {
-			if (notification) {
-				param_set_used(middle);
-			}
-
-			return middle;
+	/* perfect hash of the known parameter names, only the name in the slot can match */
+	const param_t param = px4::parameters_hash_lookup(name);
 
-		} else if (middle == front) {
-			/* An end point has been hit, but there has been no match */
-			break;
-
-		} else if (ret < 0) {
-			last = middle;
-
-		} else {
-			front = middle;
+	if (handle_in_range(param) && (strcmp(name, param_name(param)) == 0)) {
+		if (notification) {
+			param_set_used(param);
 		}
+
+		return param;
 	}
 
 	/* not found */
@@ -355,6 +342,18 @@ bool param_value_is_default(param_t param)
 	return true;
 }
 
+/* notify about a single parameter change, rate-limited */
+static void
+param_notify_change()
+{
+	if (notify_instance) {
+		notify_instance->request();
+
+	} else {
+		param_notify_changes();
+	}
+}
+
 static void
 param_autosave()
 {
@@ -428,7 +427,7 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 	 * a thing has been set.
 	 */
 	if ((result == PX4_OK) && param_changed && notify_changes) {
-		param_notify_changes();
+		param_notify_change();
 	}
 
 	return result;
@@ -536,7 +535,7 @@ int param_set_default_value(param_t param, const void *val)
 
 	if ((result == PX4_OK) && param_used(param)) {
 		// send notification if param is already in use
-		param_notify_changes();
+		param_notify_change();
 	}
 
 	return result;
@@ -555,7 +554,7 @@ static int param_reset_internal(param_t param, bool notify = true, bool autosave
 	}
 
 	if (param_found && notify) {
-		param_notify_changes();
+		param_notify_change();
 	}
 
 	return param_found;
@@ -19,6 +19,64 @@ except ImportError as e:
 
 import os
 
+def param_name_hash(seed, name):
+    """
+    32 bit FNV-1a hash of a parameter name, the same as px4::param_name_hash()
+    in the generated px4_parameters_hash.hpp
+    """
+    h = (2166136261 ^ seed) & 0xffffffff
+    for c in name.encode('ascii'):
+        h ^= c
+        h = (h * 16777619) & 0xffffffff
+    return h
+
+def generate_hash(names):
+    """
+    Find a perfect hash for the parameter names (hash and displace):
+    each name is sorted into a bucket with seed 0, then for every bucket a seed
+    (displacement) is searched that maps all of its names to free slots of the table.
+
+    @return (displacements, table), table holds the parameter index of each slot, 0xffff if empty
+    """
+    if len(set(names)) != len(names):
+        raise ValueError("duplicate parameter names")
+
+    num_buckets = max(1, (len(names) + 3) // 4)
+    table_size = max(1, len(names) + len(names) // 4)
+
+    while True:
+        buckets = [[] for _ in range(num_buckets)]
+        for index, name in enumerate(names):
+            buckets[param_name_hash(0, name) % num_buckets].append(index)
+
+        displacements = [0] * num_buckets
+        table = [0xffff] * table_size
+        success = True
+
+        # place the largest buckets first while the table is still empty
+        for bucket_index in sorted(range(num_buckets), key=lambda b: -len(buckets[b])):
+            bucket = buckets[bucket_index]
+            if not bucket:
+                continue
+
+            for seed in range(1, 0xffff):
+                slots = [param_name_hash(seed, names[i]) % table_size for i in bucket]
+                if len(set(slots)) == len(slots) and all(table[slot] == 0xffff for slot in slots):
+                    break
+            else:
+                success = False
+                break
+
+            displacements[bucket_index] = seed
+            for i, slot in zip(bucket, slots):
+                table[slot] = i
+
+        if success:
+            return displacements, table
+
+        # retry with a sparser table
+        table_size += max(1, table_size // 8)
+
 def generate(xml_file, dest='.'):
     """
     Generate px4 param source from xml.
@@ -48,14 +106,18 @@ def generate(xml_file, dest='.'):
     if not os.path.isdir(dest):
         os.path.mkdir(dest)
 
+    hash_displacements, hash_table = generate_hash([param.attrib["name"] for param in params])
+
     template_files = [
         'px4_parameters.hpp.jinja',
+        'px4_parameters_hash.hpp.jinja',
     ]
     for template_file in template_files:
         template = env.get_template(template_file)
         with open(os.path.join(
                 dest, template_file.replace('.jinja','')), 'w') as fid:
-            fid.write(template.render(params=params))
+            fid.write(template.render(params=params, hash_displacements=hash_displacements,
+                                      hash_table=hash_table))
 
 if __name__ == "__main__":
     arg_parser = argparse.ArgumentParser()
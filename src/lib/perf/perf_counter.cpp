@@ -43,11 +43,60 @@
 #include <string.h>
 #include <drivers/drv_hrt.h>
 #include <math.h>
+#include <new>
 #include <pthread.h>
 #include <systemlib/err.h>
+#include <px4_platform_common/atomic.h>
+
+#if defined(CONFIG_PERF_DWT_TIME_SOURCE)
+#include <arch/board/board.h>
+#endif // CONFIG_PERF_DWT_TIME_SOURCE
 
 #include "perf_counter.h"
 
+#if defined(CONFIG_PERF_ELAPSED_FAST_SLOTS)
+static constexpr int PERF_FAST_SLOTS = CONFIG_PERF_ELAPSED_FAST_SLOTS;
+#else
+static constexpr int PERF_FAST_SLOTS = 4;
+#endif // CONFIG_PERF_ELAPSED_FAST_SLOTS
+
+#if defined(__PX4_NUTTX)
+static constexpr size_t PERF_CACHE_LINE_SIZE = 32;
+#else
+static constexpr size_t PERF_CACHE_LINE_SIZE = 64;
+#endif // __PX4_NUTTX
+
+#if defined(CONFIG_PERF_DWT_TIME_SOURCE)
+# if defined(STM32_SYSCLK_FREQUENCY)
+static constexpr uint32_t perf_ticks_per_us = STM32_SYSCLK_FREQUENCY / 1000000;
+# elif defined(BOARD_CPU_FREQUENCY)
+static constexpr uint32_t perf_ticks_per_us = BOARD_CPU_FREQUENCY / 1000000;
+# else
+#  error "CONFIG_PERF_DWT_TIME_SOURCE requires the CPU frequency of the board"
+# endif
+
+// ARMv7-M Data Watchpoint and Trace unit
+#define PERF_DEMCR		(*(volatile uint32_t *)0xe000edfc)
+#define PERF_DEMCR_TRCENA	(1 << 24)
+#define PERF_DWT_CTRL		(*(volatile uint32_t *)0xe0001000)
+#define PERF_DWT_CTRL_CYCCNTENA	(1 << 0)
+#define PERF_DWT_CYCCNT		(*(volatile uint32_t *)0xe0001004)
+
+static void perf_fast_time_init()
+{
+	PERF_DEMCR |= PERF_DEMCR_TRCENA;
+	PERF_DWT_CTRL |= PERF_DWT_CTRL_CYCCNTENA;
+}
+
+static inline uint32_t perf_fast_time() { return PERF_DWT_CYCCNT; }
+#else
+static constexpr uint32_t perf_ticks_per_us = 1;
+
+static void perf_fast_time_init() {}
+
+static inline uint32_t perf_fast_time() { return (uint32_t)hrt_absolute_time(); }
+#endif // CONFIG_PERF_DWT_TIME_SOURCE
+
 /**
  * Header common to all counters.
  */
@@ -91,6 +140,117 @@ struct perf_ctr_interval : public perf_ctr_header {
 	float			M2{0.0f};
 };
 
+/**
+ * PC_ELAPSED_FAST accumulation slot, only written by the thread owning it.
+ * Times are in ticks of perf_fast_time() and wrap around (32 bit).
+ */
+struct alignas(PERF_CACHE_LINE_SIZE) perf_fast_slot {
+	px4::atomic<uintptr_t>	owner{0};
+	uint32_t		time_start{0};
+	bool			started{false};
+	uint32_t		event_count{0};
+	uint64_t		time_total{0};
+	uint32_t		time_most{0};
+	uint32_t		histogram[PERF_HISTOGRAM_BUCKETS] {};
+};
+
+/**
+ * PC_ELAPSED_FAST counter.
+ */
+struct perf_ctr_elapsed_fast : public perf_ctr_header {
+	perf_fast_slot		slots[PERF_FAST_SLOTS];
+};
+
+/**
+ * Folded state of a PC_ELAPSED_FAST counter.
+ */
+struct perf_fast_sum {
+	uint64_t		event_count{0};
+	uint64_t		time_total{0};	/**< us */
+	uint32_t		time_most{0};	/**< us */
+	uint64_t		histogram[PERF_HISTOGRAM_BUCKETS] {};
+};
+
+/**
+ * Slot of the calling thread, claimed on first use. Threads beyond PERF_FAST_SLOTS share the
+ * last slot (without synchronization, like all other counter types).
+ */
+static perf_fast_slot *perf_fast_get_slot(perf_ctr_elapsed_fast *pcf)
+{
+	const uintptr_t self = (uintptr_t)pthread_self() + 1;
+
+	for (int i = 0; i < PERF_FAST_SLOTS; i++) {
+		uintptr_t owner = pcf->slots[i].owner.load();
+
+		if (owner == self) {
+			return &pcf->slots[i];
+		}
+
+		if (owner == 0) {
+			if (pcf->slots[i].owner.compare_exchange(&owner, self)) {
+				return &pcf->slots[i];
+			}
+
+			if (owner == self) {
+				return &pcf->slots[i];
+			}
+		}
+	}
+
+	return &pcf->slots[PERF_FAST_SLOTS - 1];
+}
+
+static inline void perf_fast_record(perf_fast_slot *slot, uint32_t elapsed)
+{
+	slot->event_count++;
+	slot->time_total += elapsed;
+
+	if (elapsed > slot->time_most) {
+		slot->time_most = elapsed;
+	}
+
+	// bucket floor(log4(elapsed us))
+	const uint32_t elapsed_us = elapsed / perf_ticks_per_us;
+	const int bucket = (31 - __builtin_clz(elapsed_us | 1)) / 2;
+	slot->histogram[(bucket < PERF_HISTOGRAM_BUCKETS) ? bucket : PERF_HISTOGRAM_BUCKETS - 1]++;
+}
+
+static void perf_fast_fold(const perf_ctr_elapsed_fast *pcf, perf_fast_sum &sum)
+{
+	uint32_t time_most = 0;
+
+	for (int i = 0; i < PERF_FAST_SLOTS; i++) {
+		const perf_fast_slot &slot = pcf->slots[i];
+		sum.event_count += slot.event_count;
+		sum.time_total += slot.time_total;
+
+		if (slot.time_most > time_most) {
+			time_most = slot.time_most;
+		}
+
+		for (int b = 0; b < PERF_HISTOGRAM_BUCKETS; b++) {
+			sum.histogram[b] += slot.histogram[b];
+		}
+	}
+
+	sum.time_total /= perf_ticks_per_us;
+	sum.time_most = time_most / perf_ticks_per_us;
+}
+
+static int perf_fast_print_histogram(char *buffer, int length, const perf_fast_sum &sum)
+{
+	int num_written = snprintf(buffer, length, "hist [us]");
+
+	for (int b = 0; b < PERF_HISTOGRAM_BUCKETS && num_written < length; b++) {
+		num_written += snprintf(buffer + num_written, length - num_written, " %s%u: %" PRIu64,
+					(b == PERF_HISTOGRAM_BUCKETS - 1) ? ">=" : "<",
+					(b == PERF_HISTOGRAM_BUCKETS - 1) ? 1u << (2 * b) : 1u << (2 * (b + 1)),
+					sum.histogram[b]);
+	}
+
+	return num_written;
+}
+
 /**
  * List of all known counters.
  */
@@ -126,6 +286,17 @@ perf_alloc(enum perf_counter_type type, const char *name)
 		ctr = new perf_ctr_interval();
 		break;
 
+	case PC_ELAPSED_FAST: {
+			// over-aligned, plain new does not guarantee the alignment before C++17
+			void *mem = nullptr;
+
+			if (posix_memalign(&mem, alignof(perf_ctr_elapsed_fast), sizeof(perf_ctr_elapsed_fast)) == 0) {
+				perf_fast_time_init();
+				ctr = new (mem) perf_ctr_elapsed_fast();
+			}
+		}
+		break;
+
 	default:
 		break;
 	}
@@ -194,6 +365,11 @@ perf_free(perf_counter_t handle)
 		delete (struct perf_ctr_interval *)handle;
 		break;
 
+	case PC_ELAPSED_FAST:
+		((struct perf_ctr_elapsed_fast *)handle)->~perf_ctr_elapsed_fast();
+		free(handle);
+		break;
+
 	default:
 		break;
 	}
@@ -232,6 +408,13 @@ perf_begin(perf_counter_t handle)
 		((struct perf_ctr_elapsed *)handle)->time_start = hrt_absolute_time();
 		break;
 
+	case PC_ELAPSED_FAST: {
+			perf_fast_slot *slot = perf_fast_get_slot((struct perf_ctr_elapsed_fast *)handle);
+			slot->time_start = perf_fast_time();
+			slot->started = true;
+		}
+		break;
+
 	default:
 		break;
 	}
@@ -254,6 +437,17 @@ perf_end(perf_counter_t handle)
 		}
 		break;
 
+	case PC_ELAPSED_FAST: {
+			const uint32_t now = perf_fast_time();
+			perf_fast_slot *slot = perf_fast_get_slot((struct perf_ctr_elapsed_fast *)handle);
+
+			if (slot->started) {
+				perf_fast_record(slot, now - slot->time_start);
+				slot->started = false;
+			}
+		}
+		break;
+
 	default:
 		break;
 	}
@@ -294,6 +488,15 @@ perf_set_elapsed(perf_counter_t handle, int64_t elapsed)
 		}
 		break;
 
+	case PC_ELAPSED_FAST:
+		if (elapsed >= 0) {
+			perf_fast_slot *slot = perf_fast_get_slot((struct perf_ctr_elapsed_fast *)handle);
+			perf_fast_record(slot, (uint32_t)elapsed * perf_ticks_per_us);
+			slot->started = false;
+		}
+
+		break;
+
 	default:
 		break;
 	}
@@ -387,6 +590,10 @@ perf_cancel(perf_counter_t handle)
 		}
 		break;
 
+	case PC_ELAPSED_FAST:
+		perf_fast_get_slot((struct perf_ctr_elapsed_fast *)handle)->started = false;
+		break;
+
 	default:
 		break;
 	}
@@ -424,6 +631,21 @@ perf_reset(perf_counter_t handle)
 			pci->time_most = 0;
 			break;
 		}
+
+	case PC_ELAPSED_FAST: {
+			struct perf_ctr_elapsed_fast *pcf = (struct perf_ctr_elapsed_fast *)handle;
+
+			for (int i = 0; i < PERF_FAST_SLOTS; i++) {
+				perf_fast_slot &slot = pcf->slots[i];
+				slot.started = false;
+				slot.event_count = 0;
+				slot.time_total = 0;
+				slot.time_most = 0;
+				memset(slot.histogram, 0, sizeof(slot.histogram));
+			}
+
+			break;
+		}
 	}
 }
 
@@ -470,6 +692,21 @@ perf_print_counter(perf_counter_t handle)
 			break;
 		}
 
+	case PC_ELAPSED_FAST: {
+			perf_fast_sum sum;
+			perf_fast_fold((struct perf_ctr_elapsed_fast *)handle, sum);
+			char histogram[160];
+			perf_fast_print_histogram(histogram, sizeof(histogram), sum);
+			PX4_INFO_RAW("%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, max %" PRIu32 "us %s\n",
+				     handle->name,
+				     sum.event_count,
+				     sum.time_total,
+				     (sum.event_count == 0) ? 0 : (double)sum.time_total / (double)sum.event_count,
+				     sum.time_most,
+				     histogram);
+			break;
+		}
+
 	default:
 		break;
 	}
@@ -522,6 +759,24 @@ perf_print_counter_buffer(char *buffer, int length, perf_counter_t handle)
 			break;
 		}
 
+	case PC_ELAPSED_FAST: {
+			perf_fast_sum sum;
+			perf_fast_fold((struct perf_ctr_elapsed_fast *)handle, sum);
+			num_written = snprintf(buffer, length,
+					       "%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, max %" PRIu32 "us ",
+					       handle->name,
+					       sum.event_count,
+					       sum.time_total,
+					       (sum.event_count == 0) ? 0 : (double)sum.time_total / (double)sum.event_count,
+					       sum.time_most);
+
+			if (num_written >= 0 && num_written < length) {
+				num_written += perf_fast_print_histogram(buffer + num_written, length - num_written, sum);
+			}
+
+			break;
+		}
+
 	default:
 		break;
 	}
@@ -551,6 +806,12 @@ perf_event_count(perf_counter_t handle)
 			return pci->event_count;
 		}
 
+	case PC_ELAPSED_FAST: {
+			perf_fast_sum sum;
+			perf_fast_fold((struct perf_ctr_elapsed_fast *)handle, sum);
+			return sum.event_count;
+		}
+
 	default:
 		break;
 	}
@@ -576,6 +837,12 @@ perf_mean(perf_counter_t handle)
 			return pci->mean;
 		}
 
+	case PC_ELAPSED_FAST: {
+			perf_fast_sum sum;
+			perf_fast_fold((struct perf_ctr_elapsed_fast *)handle, sum);
+			return (sum.event_count == 0) ? 0.f : (float)sum.time_total / sum.event_count / 1e6f;
+		}
+
 	default:
 		break;
 	}
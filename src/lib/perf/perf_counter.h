@@ -48,9 +48,17 @@
 enum perf_counter_type {
 	PC_COUNT,		/**< count the number of times an event occurs */
 	PC_ELAPSED,		/**< measure the time elapsed performing an event */
-	PC_INTERVAL		/**< measure the interval between instances of an event */
+	PC_INTERVAL,		/**< measure the interval between instances of an event */
+	PC_ELAPSED_FAST		/**< like PC_ELAPSED, but lock-free per-thread accumulation with a histogram
+				     instead of the variance, cheap enough for high rate paths */
 };
 
+/**
+ * Number of histogram buckets of a PC_ELAPSED_FAST counter. Bucket i counts the events
+ * with 4^i <= elapsed < 4^(i+1) us, the first and last bucket are open ended.
+ */
+#define PERF_HISTOGRAM_BUCKETS 8
+
 struct perf_ctr_header;
 typedef struct perf_ctr_header	*perf_counter_t;
 
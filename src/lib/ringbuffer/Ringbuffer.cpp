@@ -178,3 +178,75 @@ size_t Ringbuffer::pop_front(uint8_t *buf, size_t buf_max_len)
 		return to_copy_len;
 	}
 }
+
+uint8_t *Ringbuffer::write_pointer(size_t &len)
+{
+	if (_start == _end) {
+		// Empty, start over at the beginning to get the most contiguous space.
+		_start = 0;
+		_end = 0;
+	}
+
+	// The end can be left at _size by push_back(), which is the same as 0.
+	if (_end == _size && _start > 0) {
+		_end = 0;
+	}
+
+	if (_start > _end) {
+		// Leave one byte free so that start and end don't end up the same.
+		len = _start - _end - 1;
+
+	} else {
+		// Up to the end of the buffer, leaving one byte if start is at the beginning.
+		len = _size - _end - (_start == 0 ? 1 : 0);
+	}
+
+	if (_ringbuffer == nullptr || len == 0) {
+		len = 0;
+		return nullptr;
+	}
+
+	return &_ringbuffer[_end];
+}
+
+void Ringbuffer::commit(size_t len)
+{
+	_end += len;
+
+	// Like push_back() and pop_front(), this can end up at _size, which is the same as 0.
+	if (_end > _size) {
+		_end -= _size;
+	}
+}
+
+const uint8_t *Ringbuffer::read_pointer(size_t &len) const
+{
+	if (_start == _end) {
+		// Empty
+		len = 0;
+		return nullptr;
+	}
+
+	// The start can be left at _size by pop_front(), which is the same as 0.
+	const size_t start = (_start == _size) ? 0 : _start;
+
+	if (start <= _end) {
+		len = _end - start;
+
+	} else {
+		// Only up to the end of the buffer, the rest is at the beginning.
+		len = _size - start;
+	}
+
+	return &_ringbuffer[start];
+}
+
+void Ringbuffer::release(size_t len)
+{
+	_start += len;
+
+	// Like push_back() and pop_front(), this can end up at _size, which is the same as 0.
+	if (_start > _size) {
+		_start -= _size;
+	}
+}
@@ -112,6 +112,43 @@ public:
 	 */
 	size_t pop_front(uint8_t *buf, size_t max_buf_len);
 
+	/*
+	 * @brief Get contiguous free space to write into directly
+	 *
+	 * @note The data only becomes visible after calling commit().
+	 * An empty buffer is reset to the start to maximize the space.
+	 *
+	 * @param len Returns number of contiguous free bytes.
+	 *
+	 * @returns pointer to write to, nullptr if the buffer is full.
+	 */
+	uint8_t *write_pointer(size_t &len);
+
+	/*
+	 * @brief Add bytes written through write_pointer()
+	 *
+	 * @param len Number of bytes written, at most the len returned by write_pointer().
+	 */
+	void commit(size_t len);
+
+	/*
+	 * @brief Get contiguous used space to read from directly
+	 *
+	 * @note The data is only removed after calling release().
+	 *
+	 * @param len Returns number of contiguous bytes to read.
+	 *
+	 * @returns pointer to read from, nullptr if the buffer is empty.
+	 */
+	const uint8_t *read_pointer(size_t &len) const;
+
+	/*
+	 * @brief Remove bytes from the front
+	 *
+	 * @param len Number of bytes to drop, at most space_used().
+	 */
+	void release(size_t len);
+
 private:
 	size_t _size {0};
 	uint8_t *_ringbuffer {nullptr};
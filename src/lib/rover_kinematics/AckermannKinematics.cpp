@@ -0,0 +1,62 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "AckermannKinematics.hpp"
+
+#include <mathlib/mathlib.h>
+
+using namespace matrix;
+
+matrix::Vector2f AckermannKinematics::computeInverseKinematics(float linear_velocity_x, float yaw_rate)
+{
+	if (_max_speed < FLT_EPSILON) {
+		return Vector2f();
+	}
+
+	// a yaw rate at a speed is a lateral acceleration, which also covers driving backwards
+	return Vector2f(math::constrain(linear_velocity_x / _max_speed, -1.f, 1.f),
+			computeSteering(linear_velocity_x, linear_velocity_x * yaw_rate));
+}
+
+float AckermannKinematics::computeSteering(float speed, float lateral_acceleration) const
+{
+	if (_max_steering_angle < FLT_EPSILON) {
+		return 0.f;
+	}
+
+	// turn radius r = v^2 / a, steering angle = atan(wheel_base / r)
+	const float steering_angle = atan2f(_wheel_base * fabsf(lateral_acceleration), speed * speed);
+
+	return math::constrain(matrix::sign(lateral_acceleration) * steering_angle / _max_steering_angle, -1.f, 1.f);
+}
@@ -0,0 +1,93 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include "RoverKinematics.hpp"
+
+/**
+ * @brief Ackermann Kinematics class for computing the kinematics of a car-like rover (bicycle model).
+ *
+ * The steering angle is normalized by the maximum steering angle, the speed by the maximum speed.
+ */
+class AckermannKinematics : public RoverKinematics
+{
+public:
+	AckermannKinematics() = default;
+	~AckermannKinematics() override = default;
+
+	/**
+	 * @brief Sets the wheel base of the rover.
+	 *
+	 * @param wheel_base The distance between the front and the rear axle.
+	 */
+	void setWheelBase(const float wheel_base) { _wheel_base = wheel_base; };
+
+	/**
+	 * @brief Sets the maximum speed of the rover.
+	 *
+	 * @param max_speed The speed that corresponds to full throttle.
+	 */
+	void setMaxSpeed(const float max_speed) { _max_speed = max_speed; };
+
+	/**
+	 * @brief Sets the maximum steering angle of the rover.
+	 *
+	 * @param max_steering_angle The steering angle that corresponds to full steering [rad].
+	 */
+	void setMaxSteeringAngle(const float max_steering_angle) { _max_steering_angle = max_steering_angle; };
+
+	/**
+	 * @brief Computes the inverse kinematics for Ackermann steering.
+	 *
+	 * @param linear_velocity_x Linear velocity along the x-axis.
+	 * @param yaw_rate Yaw rate of the rover.
+	 * @return matrix::Vector2f Normalized throttle and steering.
+	 */
+	matrix::Vector2f computeInverseKinematics(float linear_velocity_x, float yaw_rate) override;
+
+	/**
+	 * @brief Computes the normalized steering to follow a path with a given lateral acceleration.
+	 *
+	 * @param speed Current speed of the rover.
+	 * @param lateral_acceleration Lateral acceleration demand, positive to the right.
+	 * @return float Normalized steering [-1, 1].
+	 */
+	float computeSteering(float speed, float lateral_acceleration) const;
+
+private:
+	float _wheel_base{0.f};
+	float _max_speed{0.f};
+	float _max_steering_angle{0.f};
+};
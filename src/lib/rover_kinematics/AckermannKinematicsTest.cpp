@@ -0,0 +1,119 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "AckermannKinematics.hpp"
+#include <mathlib/math/Functions.hpp>
+
+using namespace matrix;
+
+TEST(AckermannKinematicsTest, AllZeroInputCase)
+{
+	AckermannKinematics kinematics;
+	kinematics.setWheelBase(1.f);
+	kinematics.setMaxSpeed(10.f);
+	kinematics.setMaxSteeringAngle(0.5f);
+
+	// Test with zero linear velocity and zero yaw rate (stationary vehicle)
+	EXPECT_EQ(kinematics.computeInverseKinematics(0.f, 0.f), Vector2f());
+}
+
+TEST(AckermannKinematicsTest, InvalidParameterCase)
+{
+	AckermannKinematics kinematics;
+	kinematics.setWheelBase(1.f);
+	kinematics.setMaxSpeed(0.f);
+	kinematics.setMaxSteeringAngle(0.5f);
+
+	// Test with invalid parameters (zero max speed)
+	EXPECT_EQ(kinematics.computeInverseKinematics(1.f, 1.f), Vector2f());
+}
+
+TEST(AckermannKinematicsTest, StraightMovementCase)
+{
+	AckermannKinematics kinematics;
+	kinematics.setWheelBase(1.f);
+	kinematics.setMaxSpeed(2.f);
+	kinematics.setMaxSteeringAngle(0.5f);
+
+	// Test moving straight (non-zero linear velocity, zero yaw rate)
+	EXPECT_EQ(kinematics.computeInverseKinematics(1.f, 0.f), Vector2f(0.5f, 0.f));
+}
+
+TEST(AckermannKinematicsTest, TurnCase)
+{
+	AckermannKinematics kinematics;
+	kinematics.setWheelBase(1.f);
+	kinematics.setMaxSpeed(2.f);
+	kinematics.setMaxSteeringAngle(1.f);
+
+	// yaw rate = speed * tan(steering angle) / wheel base
+	const Vector2f forward = kinematics.computeInverseKinematics(1.f, 0.5f);
+	EXPECT_FLOAT_EQ(forward(0), 0.5f);
+	EXPECT_FLOAT_EQ(forward(1), atanf(0.5f));
+
+	// driving backwards the steering is reversed for the same yaw rate
+	const Vector2f backward = kinematics.computeInverseKinematics(-1.f, 0.5f);
+	EXPECT_FLOAT_EQ(backward(0), -0.5f);
+	EXPECT_FLOAT_EQ(backward(1), -atanf(0.5f));
+}
+
+TEST(AckermannKinematicsTest, SteeringSaturationCase)
+{
+	AckermannKinematics kinematics;
+	kinematics.setWheelBase(1.f);
+	kinematics.setMaxSpeed(1.f);
+	kinematics.setMaxSteeringAngle(0.5f);
+
+	// Test with high speed and yaw rate, expecting saturated throttle and steering
+	EXPECT_EQ(kinematics.computeInverseKinematics(10.f, 10.f), Vector2f(1.f, 1.f));
+}
+
+TEST(AckermannKinematicsTest, LateralAccelerationCase)
+{
+	AckermannKinematics kinematics;
+	kinematics.setWheelBase(2.f);
+	kinematics.setMaxSpeed(1.f);
+	kinematics.setMaxSteeringAngle(1.f);
+
+	// turn radius of 4 m at 2 m/s
+	EXPECT_FLOAT_EQ(kinematics.computeSteering(2.f, -1.f), -atanf(0.5f));
+
+	// no lateral acceleration, no steering, also when stationary
+	EXPECT_FLOAT_EQ(kinematics.computeSteering(2.f, 0.f), 0.f);
+	EXPECT_FLOAT_EQ(kinematics.computeSteering(0.f, 0.f), 0.f);
+
+	// stationary with a lateral acceleration demand steers fully
+	EXPECT_FLOAT_EQ(kinematics.computeSteering(0.f, 1.f), 1.f);
+}
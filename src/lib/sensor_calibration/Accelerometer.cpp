@@ -50,6 +50,7 @@ Accelerometer::Accelerometer()
 
 Accelerometer::Accelerometer(uint32_t device_id)
 {
+	UpdateCorrection();
 	set_device_id(device_id);
 }
 
@@ -80,6 +81,7 @@ void Accelerometer::SensorCorrectionsUpdate(bool force)
 		}
 
 		sensor_correction_s corrections;
+		Vector3f thermal_offset{};
 
 		if (_sensor_correction_sub.copy(&corrections)) {
 			// find sensor_corrections index
@@ -87,24 +89,27 @@ void Accelerometer::SensorCorrectionsUpdate(bool force)
 				if (corrections.accel_device_ids[i] == _device_id) {
 					switch (i) {
 					case 0:
-						_thermal_offset = Vector3f{corrections.accel_offset_0};
-						return;
+						thermal_offset = Vector3f{corrections.accel_offset_0};
+						break;
 					case 1:
-						_thermal_offset = Vector3f{corrections.accel_offset_1};
-						return;
+						thermal_offset = Vector3f{corrections.accel_offset_1};
+						break;
 					case 2:
-						_thermal_offset = Vector3f{corrections.accel_offset_2};
-						return;
+						thermal_offset = Vector3f{corrections.accel_offset_2};
+						break;
 					case 3:
-						_thermal_offset = Vector3f{corrections.accel_offset_3};
-						return;
+						thermal_offset = Vector3f{corrections.accel_offset_3};
+						break;
 					}
+
+					break;
 				}
 			}
 		}
 
 		// zero thermal offset if not found
-		_thermal_offset.zero();
+		_thermal_offset = thermal_offset;
+		UpdateCorrection();
 	}
 }
 
@@ -114,6 +119,7 @@ bool Accelerometer::set_offset(const Vector3f &offset)
 		if (offset.isAllFinite()) {
 			_offset = offset;
 			_calibration_count++;
+			UpdateCorrection();
 			return true;
 		}
 	}
@@ -127,6 +133,7 @@ bool Accelerometer::set_scale(const Vector3f &scale)
 		if (scale.isAllFinite() && (scale(0) > 0.f) && (scale(1) > 0.f) && (scale(2) > 0.f)) {
 			_scale = scale;
 			_calibration_count++;
+			UpdateCorrection();
 			return true;
 		}
 	}
@@ -140,6 +147,8 @@ void Accelerometer::set_rotation(Rotation rotation)
 
 	// always apply board level adjustments
 	_rotation = Dcmf(GetSensorLevelAdjustment()) * get_rot_matrix(rotation);
+
+	UpdateCorrection();
 }
 
 bool Accelerometer::set_calibration_index(int calibration_index)
@@ -232,6 +241,8 @@ void Accelerometer::Reset()
 
 	_thermal_offset.zero();
 
+	UpdateCorrection();
+
 	_priority = _external ? DEFAULT_EXTERNAL_PRIORITY : DEFAULT_PRIORITY;
 
 	_calibration_index = -1;
@@ -278,6 +289,12 @@ bool Accelerometer::ParametersSave(int desired_calibration_index, bool force)
 	return false;
 }
 
+void Accelerometer::UpdateCorrection()
+{
+	_correction = _rotation * diag(_scale);
+	_correction_offset = _correction * (_offset + _thermal_offset);
+}
+
 void Accelerometer::PrintStatus()
 {
 	if (external()) {
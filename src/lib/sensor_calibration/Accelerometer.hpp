@@ -81,7 +81,8 @@ public:
 	// rotate corrected measurements from sensor to body frame
 	inline matrix::Vector3f Correct(const matrix::Vector3f &data) const
 	{
-		return _rotation * matrix::Vector3f{(data - _thermal_offset - _offset).emult(_scale)};
+		// rotation * (data - thermal offset - offset).emult(scale), folded into one transform
+		return _correction * data - _correction_offset;
 	}
 
 	// Compute sensor offset from bias (board frame)
@@ -100,6 +101,8 @@ public:
 	void SensorCorrectionsUpdate(bool force = false);
 
 private:
+	void UpdateCorrection();
+
 	uORB::Subscription _sensor_correction_sub{ORB_ID(sensor_correction)};
 
 	Rotation _rotation_enum{ROTATION_NONE};
@@ -109,6 +112,10 @@ private:
 	matrix::Vector3f _scale;
 	matrix::Vector3f _thermal_offset;
 
+	// cached Correct() transform, updated whenever the calibration or thermal offset changes
+	matrix::Matrix3f _correction;		// rotation * diag(scale)
+	matrix::Vector3f _correction_offset;	// _correction * (offset + thermal offset)
+
 	int8_t _calibration_index{-1};
 	uint32_t _device_id{0};
 	int32_t _priority{-1};
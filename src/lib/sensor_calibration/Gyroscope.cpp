@@ -50,6 +50,7 @@ Gyroscope::Gyroscope()
 
 Gyroscope::Gyroscope(uint32_t device_id)
 {
+	UpdateCorrection();
 	set_device_id(device_id);
 }
 
@@ -80,6 +81,7 @@ void Gyroscope::SensorCorrectionsUpdate(bool force)
 		}
 
 		sensor_correction_s corrections;
+		Vector3f thermal_offset{};
 
 		if (_sensor_correction_sub.copy(&corrections)) {
 			// find sensor_corrections index
@@ -87,24 +89,27 @@ void Gyroscope::SensorCorrectionsUpdate(bool force)
 				if (corrections.gyro_device_ids[i] == _device_id) {
 					switch (i) {
 					case 0:
-						_thermal_offset = Vector3f{corrections.gyro_offset_0};
-						return;
+						thermal_offset = Vector3f{corrections.gyro_offset_0};
+						break;
 					case 1:
-						_thermal_offset = Vector3f{corrections.gyro_offset_1};
-						return;
+						thermal_offset = Vector3f{corrections.gyro_offset_1};
+						break;
 					case 2:
-						_thermal_offset = Vector3f{corrections.gyro_offset_2};
-						return;
+						thermal_offset = Vector3f{corrections.gyro_offset_2};
+						break;
 					case 3:
-						_thermal_offset = Vector3f{corrections.gyro_offset_3};
-						return;
+						thermal_offset = Vector3f{corrections.gyro_offset_3};
+						break;
 					}
+
+					break;
 				}
 			}
 		}
 
 		// zero thermal offset if not found
-		_thermal_offset.zero();
+		_thermal_offset = thermal_offset;
+		UpdateCorrection();
 	}
 }
 
@@ -114,6 +119,7 @@ bool Gyroscope::set_offset(const Vector3f &offset)
 		if (offset.isAllFinite()) {
 			_offset = offset;
 			_calibration_count++;
+			UpdateCorrection();
 			return true;
 		}
 	}
@@ -127,6 +133,16 @@ void Gyroscope::set_rotation(Rotation rotation)
 
 	// always apply board level adjustments
 	_rotation = Dcmf(GetSensorLevelAdjustment()) * get_rot_matrix(rotation);
+
+	UpdateCorrection();
+}
+
+void Gyroscope::set_online_bias(const Vector3f &bias)
+{
+	if (bias.isAllFinite()) {
+		_online_bias = bias;
+		UpdateCorrection();
+	}
 }
 
 bool Gyroscope::set_calibration_index(int calibration_index)
@@ -215,6 +231,10 @@ void Gyroscope::Reset()
 
 	_thermal_offset.zero();
 
+	_online_bias.zero();
+
+	UpdateCorrection();
+
 	_priority = _external ? DEFAULT_EXTERNAL_PRIORITY : DEFAULT_PRIORITY;
 
 	_calibration_index = -1;
@@ -260,6 +280,12 @@ bool Gyroscope::ParametersSave(int desired_calibration_index, bool force)
 	return false;
 }
 
+void Gyroscope::UpdateCorrection()
+{
+	_correction = _rotation;
+	_correction_offset = _correction * (_offset + _thermal_offset) + _online_bias;
+}
+
 void Gyroscope::PrintStatus()
 {
 	if (external()) {
@@ -279,6 +305,11 @@ void Gyroscope::PrintStatus()
 		PX4_INFO_RAW("%s %" PRIu32 " temperature offset: [%.4f %.4f %.4f]\n", SensorString(), _device_id,
 			     (double)_thermal_offset(0), (double)_thermal_offset(1), (double)_thermal_offset(2));
 	}
+
+	if (_online_bias.norm() > 0.f) {
+		PX4_INFO_RAW("%s %" PRIu32 " online bias: [%.4f %.4f %.4f]\n", SensorString(), _device_id,
+			     (double)_online_bias(0), (double)_online_bias(1), (double)_online_bias(2));
+	}
 }
 
 } // namespace calibration
@@ -39,6 +39,7 @@
 #include <px4_platform_common/log.h>
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/sensor_correction.h>
+#include <uORB/topics/sensor_gyro_fifo.h>
 
 namespace calibration
 {
@@ -50,6 +51,8 @@ public:
 	static constexpr uint8_t DEFAULT_PRIORITY = 50;
 	static constexpr uint8_t DEFAULT_EXTERNAL_PRIORITY = 75;
 
+	static constexpr int FIFO_SIZE_MAX = sizeof(sensor_gyro_fifo_s::x) / sizeof(sensor_gyro_fifo_s::x[0]);
+
 	static constexpr const char *SensorString() { return "GYRO"; }
 
 	Gyroscope();
@@ -62,6 +65,7 @@ public:
 	bool set_calibration_index(int calibration_index);
 	void set_device_id(uint32_t device_id);
 	bool set_offset(const matrix::Vector3f &offset);
+	void set_online_bias(const matrix::Vector3f &bias);
 	void set_rotation(Rotation rotation);
 
 	bool calibrated() const { return (_device_id != 0) && (_calibration_index >= 0); }
@@ -71,6 +75,7 @@ public:
 	bool enabled() const { return (_priority > 0); }
 	bool external() const { return _external; }
 	const matrix::Vector3f &offset() const { return _offset; }
+	const matrix::Vector3f &online_bias() const { return _online_bias; }
 	const int32_t &priority() const { return _priority; }
 	const matrix::Dcmf &rotation() const { return _rotation; }
 	const Rotation &rotation_enum() const { return _rotation_enum; }
@@ -80,19 +85,36 @@ public:
 	// rotate corrected measurements from sensor to body frame
 	inline matrix::Vector3f Correct(const matrix::Vector3f &data) const
 	{
-		return _rotation * matrix::Vector3f{data - _thermal_offset - _offset};
+		// rotation * (data - thermal offset - offset) - online bias, folded into one transform
+		return _correction * data - _correction_offset;
+	}
+
+	// scale a sensor_gyro_fifo block to float arrays per axis (sensor frame, rad/s)
+	// returns the number of samples converted
+	static inline int ScaleFifo(const sensor_gyro_fifo_s &fifo, float (&data)[3][FIFO_SIZE_MAX])
+	{
+		const int N = (fifo.samples <= FIFO_SIZE_MAX) ? fifo.samples : FIFO_SIZE_MAX;
+		const int16_t *const raw[3] {fifo.x, fifo.y, fifo.z};
+
+		for (int axis = 0; axis < 3; axis++) {
+			for (int n = 0; n < N; n++) {
+				data[axis][n] = fifo.scale * raw[axis][n];
+			}
+		}
+
+		return N;
 	}
 
 	inline matrix::Vector3f Uncorrect(const matrix::Vector3f &corrected_data) const
 	{
-		return (_rotation.I() * corrected_data) + _thermal_offset + _offset;
+		return (_rotation.I() * (corrected_data + _online_bias)) + _thermal_offset + _offset;
 	}
 
 	// Compute sensor offset from bias (board frame)
 	matrix::Vector3f BiasCorrectedSensorOffset(const matrix::Vector3f &bias) const
 	{
-		// updated calibration offset = existing offset + bias rotated to sensor frame
-		return _offset + (_rotation.I() * bias);
+		// updated calibration offset = existing offset + (online bias + bias) rotated to sensor frame
+		return _offset + (_rotation.I() * (_online_bias + bias));
 	}
 
 	bool ParametersLoad();
@@ -104,6 +126,8 @@ public:
 	void SensorCorrectionsUpdate(bool force = false);
 
 private:
+	void UpdateCorrection();
+
 	uORB::Subscription _sensor_correction_sub{ORB_ID(sensor_correction)};
 
 	Rotation _rotation_enum{ROTATION_NONE};
@@ -111,6 +135,11 @@ private:
 	matrix::Dcmf _rotation;
 	matrix::Vector3f _offset;
 	matrix::Vector3f _thermal_offset;
+	matrix::Vector3f _online_bias;		// in-flight bias correction (body frame), not saved
+
+	// cached Correct() transform, updated whenever the calibration or thermal offset changes
+	matrix::Matrix3f _correction;		// rotation
+	matrix::Vector3f _correction_offset;	// _correction * (offset + thermal offset) + online bias
 
 	int8_t _calibration_index{-1};
 	uint32_t _device_id{0};
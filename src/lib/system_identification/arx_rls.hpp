@@ -122,11 +122,29 @@ public:
 		}
 
 		const matrix::Vector < float, N + M + 1 > phi = constructDesignVector();
-		const matrix::Matrix < float, 1, N + M + 1 > phi_t = phi.transpose();
 
-		_P = (_P - _P * phi * phi_t * _P / (_lambda + (phi_t * _P * phi)(0, 0))) / _lambda;
-		_innovation = _y[N] - (phi_t * _theta_hat)(0, 0);
-		_theta_hat = _theta_hat + _P * phi * _innovation;
+		// Rank-1 covariance update in O(n^2): with P*phi computed once, the gain K = P*phi / (lambda + phi'*P*phi)
+		// gives P+ = (P - K*(P*phi)') / lambda and P+ * phi = K, so no matrix-matrix product is needed.
+		// Only the upper triangle is computed and then mirrored to keep P exactly symmetric.
+		const matrix::Vector < float, N + M + 1 > P_phi = _P * phi;
+		const float denominator = _lambda + phi.dot(P_phi);
+
+		if (!(denominator > FLT_EPSILON)) {
+			return;
+		}
+
+		const matrix::Vector < float, N + M + 1 > gain = P_phi / denominator;
+		const float lambda_inv = 1.f / _lambda;
+
+		for (size_t i = 0; i < N + M + 1; i++) {
+			for (size_t j = i; j < N + M + 1; j++) {
+				_P(i, j) = (_P(i, j) - gain(i) * P_phi(j)) * lambda_inv;
+				_P(j, i) = _P(i, j);
+			}
+		}
+
+		_innovation = _y[N] - phi.dot(_theta_hat);
+		_theta_hat = _theta_hat + gain * _innovation;
 
 		for (size_t i = 0; i < N + M + 1; i++) {
 			_diff_theta_hat(i) = fabsf(_theta_hat(i) - theta_prev(i));
@@ -51,6 +51,7 @@ using math::min;
 using namespace time_literals;
 
 static inline constexpr bool TIMESTAMP_VALID(float dt) { return (PX4_ISFINITE(dt) && dt > FLT_EPSILON);}
+static inline bool PARAM_CHANGED(float value, float cached_value) { return !(fabsf(value - cached_value) <= FLT_EPSILON); }
 
 void TECSAirspeedFilter::initialize(const float equivalent_airspeed, const float equivalent_airspeed_trim,
 				    const bool airspeed_sensor_available)
@@ -103,17 +104,8 @@ void TECSAirspeedFilter::update(const float dt, const Input &input, const Param
 	new_state_predicted(0) = _airspeed_state.speed + dt * _airspeed_state.speed_rate;
 	new_state_predicted(1) = _airspeed_state.speed_rate;
 
-	const float airspeed_noise_inv{1.0f / param.airspeed_measurement_std_dev};
-	const float airspeed_rate_noise_inv{1.0f / param.airspeed_rate_measurement_std_dev};
-	const float airspeed_rate_noise_inv_squared_process_noise{airspeed_rate_noise_inv *airspeed_rate_noise_inv * param.airspeed_rate_noise_std_dev};
-	const float denom{airspeed_noise_inv + airspeed_rate_noise_inv_squared_process_noise};
-	const float common_nom{std::sqrt(param.airspeed_rate_noise_std_dev * (2.0f * airspeed_noise_inv + airspeed_rate_noise_inv_squared_process_noise))};
-
-	matrix::Matrix<float, 2, 2> kalman_gain;
-	kalman_gain(0, 0) = airspeed_noise_inv * common_nom / denom;
-	kalman_gain(0, 1) = airspeed_rate_noise_inv_squared_process_noise / denom;
-	kalman_gain(1, 0) = airspeed_noise_inv * airspeed_noise_inv * param.airspeed_rate_noise_std_dev / denom;
-	kalman_gain(1, 1) = airspeed_rate_noise_inv_squared_process_noise * common_nom / denom;
+	_updateKalmanGain(param);
+	const matrix::Matrix<float, 2, 2> &kalman_gain = _kalman_gain;
 
 	const matrix::Vector2f innovation{(airspeed - new_state_predicted(0)), (airspeed_derivative - new_state_predicted(1))};
 	matrix::Vector2f new_state;
@@ -135,6 +127,29 @@ void TECSAirspeedFilter::update(const float dt, const Input &input, const Param
 	_airspeed_state.speed_rate = new_state(1);
 }
 
+void TECSAirspeedFilter::_updateKalmanGain(const Param &param)
+{
+	// the gain only depends on the noise parameters, recalculate it only if they changed
+	if (!PARAM_CHANGED(param.airspeed_measurement_std_dev, _kalman_gain_param.airspeed_measurement_std_dev)
+	    && !PARAM_CHANGED(param.airspeed_rate_measurement_std_dev, _kalman_gain_param.airspeed_rate_measurement_std_dev)
+	    && !PARAM_CHANGED(param.airspeed_rate_noise_std_dev, _kalman_gain_param.airspeed_rate_noise_std_dev)) {
+		return;
+	}
+
+	_kalman_gain_param = param;
+
+	const float airspeed_noise_inv{1.0f / param.airspeed_measurement_std_dev};
+	const float airspeed_rate_noise_inv{1.0f / param.airspeed_rate_measurement_std_dev};
+	const float airspeed_rate_noise_inv_squared_process_noise{airspeed_rate_noise_inv *airspeed_rate_noise_inv * param.airspeed_rate_noise_std_dev};
+	const float denom{airspeed_noise_inv + airspeed_rate_noise_inv_squared_process_noise};
+	const float common_nom{std::sqrt(param.airspeed_rate_noise_std_dev * (2.0f * airspeed_noise_inv + airspeed_rate_noise_inv_squared_process_noise))};
+
+	_kalman_gain(0, 0) = airspeed_noise_inv * common_nom / denom;
+	_kalman_gain(0, 1) = airspeed_rate_noise_inv_squared_process_noise / denom;
+	_kalman_gain(1, 0) = airspeed_noise_inv * airspeed_noise_inv * param.airspeed_rate_noise_std_dev / denom;
+	_kalman_gain(1, 1) = airspeed_rate_noise_inv_squared_process_noise * common_nom / denom;
+}
+
 TECSAirspeedFilter::AirspeedFilterState TECSAirspeedFilter::getState() const
 {
 	return _airspeed_state;
@@ -227,6 +242,8 @@ void TECSAltitudeReferenceModel::initialize(const AltitudeReferenceState &state)
 
 void TECSControl::initialize(const Setpoint &setpoint, const Input &input, Param &param, const Flag &flag)
 {
+	_updateDerivedParam(param);
+
 	resetIntegrals();
 
 	AltitudePitchControl control_setpoint;
@@ -244,13 +261,11 @@ void TECSControl::initialize(const Setpoint &setpoint, const Input &input, Param
 
 	_pitch_setpoint = _calcPitchControlOutput(input, seb_rate, param, flag);
 
-	const STERateLimit limit{_calculateTotalEnergyRateLimit(param)};
-
 	_ste_rate_estimate_filter.reset(specific_energy_rate.spe_rate.estimate + specific_energy_rate.ske_rate.estimate);
 
-	ControlValues ste_rate{_calcThrottleControlSteRate(limit, specific_energy_rate, param)};
+	ControlValues ste_rate{_calcThrottleControlSteRate(specific_energy_rate, param)};
 
-	_throttle_setpoint = _calcThrottleControlOutput(limit, ste_rate, param, flag);
+	_throttle_setpoint = _calcThrottleControlOutput(ste_rate, param, flag);
 
 	// Debug output
 	_debug_output.total_energy_rate_estimate = ste_rate.estimate;
@@ -272,6 +287,8 @@ void TECSControl::update(const float dt, const Setpoint &setpoint, const Input &
 		return;
 	}
 
+	_updateDerivedParam(param);
+
 	AltitudePitchControl control_setpoint;
 
 	control_setpoint.tas_rate_setpoint = _calcAirspeedControlOutput(setpoint, input, param, flag);
@@ -299,14 +316,34 @@ void TECSControl::update(const float dt, const Setpoint &setpoint, const Input &
 	_debug_output.throttle_integrator = _throttle_integ_state;
 }
 
-TECSControl::STERateLimit TECSControl::_calculateTotalEnergyRateLimit(const Param &param) const
+void TECSControl::_updateDerivedParam(const Param &param)
 {
-	TECSControl::STERateLimit limit;
+	if (!PARAM_CHANGED(param.max_climb_rate, _derived_param.max_climb_rate)
+	    && !PARAM_CHANGED(param.min_sink_rate, _derived_param.min_sink_rate)
+	    && !PARAM_CHANGED(param.throttle_trim, _derived_param.throttle_trim)
+	    && !PARAM_CHANGED(param.throttle_max, _derived_param.throttle_max)
+	    && !PARAM_CHANGED(param.throttle_min, _derived_param.throttle_min)) {
+		return;
+	}
+
+	_derived_param.max_climb_rate = param.max_climb_rate;
+	_derived_param.min_sink_rate = param.min_sink_rate;
+	_derived_param.throttle_trim = param.throttle_trim;
+	_derived_param.throttle_max = param.throttle_max;
+	_derived_param.throttle_min = param.throttle_min;
+
 	// Calculate the specific total energy rate limits from the max throttle limits
+	STERateLimit &limit = _derived_param.limit;
 	limit.STE_rate_max = math::max(param.max_climb_rate, FLT_EPSILON) * CONSTANTS_ONE_G;
 	limit.STE_rate_min = - math::max(param.min_sink_rate, FLT_EPSILON) * CONSTANTS_ONE_G;
 
-	return limit;
+	// Calculate gain scaler from specific energy rate error to throttle
+	_derived_param.ste_rate_to_throttle = 1.0f / (limit.STE_rate_max - limit.STE_rate_min);
+
+	// assume airspeed and density-independent delta_throttle to sink/climb rate mapping
+	// TODO: include air density for thrust mappings
+	_derived_param.throttle_above_trim_per_ste_rate = (param.throttle_max - param.throttle_trim) / limit.STE_rate_max;
+	_derived_param.throttle_below_trim_per_ste_rate = (param.throttle_trim - param.throttle_min) / limit.STE_rate_min;
 }
 
 float TECSControl::_calcAirspeedControlOutput(const Setpoint &setpoint, const Input &input, const Param &param,
@@ -314,7 +351,7 @@ float TECSControl::_calcAirspeedControlOutput(const Setpoint &setpoint, const In
 {
 	float airspeed_rate_output{0.0f};
 
-	const STERateLimit limit{_calculateTotalEnergyRateLimit(param)};
+	const STERateLimit &limit = _derived_param.limit;
 
 	// calculate the demanded true airspeed rate of change based on first order response of true airspeed error
 	// if airspeed measurement is not enabled then always set the rate setpoint to zero in order to avoid constant rate setpoints
@@ -508,16 +545,14 @@ float TECSControl::_calcPitchControlOutput(const Input &input, const ControlValu
 void TECSControl::_calcThrottleControl(float dt, const SpecificEnergyRates &specific_energy_rates, const Param &param,
 				       const Flag &flag)
 {
-	const STERateLimit limit{_calculateTotalEnergyRateLimit(param)};
-
 	// Update STE rate estimate LP filter
 	const float STE_rate_estimate_raw = specific_energy_rates.spe_rate.estimate + specific_energy_rates.ske_rate.estimate;
 	_ste_rate_estimate_filter.setParameters(dt, param.ste_rate_time_const);
 	_ste_rate_estimate_filter.update(STE_rate_estimate_raw);
 
-	ControlValues ste_rate{_calcThrottleControlSteRate(limit, specific_energy_rates, param)};
-	_calcThrottleControlUpdate(dt, limit, ste_rate, param, flag);
-	float throttle_setpoint{_calcThrottleControlOutput(limit, ste_rate, param, flag)};
+	ControlValues ste_rate{_calcThrottleControlSteRate(specific_energy_rates, param)};
+	_calcThrottleControlUpdate(dt, ste_rate, param, flag);
+	float throttle_setpoint{_calcThrottleControlOutput(ste_rate, param, flag)};
 
 	// Rate limit the throttle demand
 	if (fabsf(param.throttle_slewrate) > FLT_EPSILON) {
@@ -534,8 +569,7 @@ void TECSControl::_calcThrottleControl(float dt, const SpecificEnergyRates &spec
 	_debug_output.throttle_integrator = _throttle_integ_state;
 }
 
-TECSControl::ControlValues TECSControl::_calcThrottleControlSteRate(const STERateLimit &limit,
-		const SpecificEnergyRates &specific_energy_rates,
+TECSControl::ControlValues TECSControl::_calcThrottleControlSteRate(const SpecificEnergyRates &specific_energy_rates,
 		const Param &param) const
 {
 	// Output ste rate values
@@ -547,17 +581,16 @@ TECSControl::ControlValues TECSControl::_calcThrottleControlSteRate(const STERat
 	// The additional normal load factor is given by (1/cos(bank angle) - 1)
 	ste_rate.setpoint += param.load_factor_correction * (param.load_factor - 1.f);
 
-	ste_rate.setpoint = constrain(ste_rate.setpoint, limit.STE_rate_min, limit.STE_rate_max);
+	ste_rate.setpoint = constrain(ste_rate.setpoint, _derived_param.limit.STE_rate_min, _derived_param.limit.STE_rate_max);
 	ste_rate.estimate = _ste_rate_estimate_filter.getState();
 
 	return ste_rate;
 }
 
-void TECSControl::_calcThrottleControlUpdate(float dt, const STERateLimit &limit, const ControlValues &ste_rate,
-		const Param &param, const Flag &flag)
+void TECSControl::_calcThrottleControlUpdate(float dt, const ControlValues &ste_rate, const Param &param,
+		const Flag &flag)
 {
-	// Calculate gain scaler from specific energy rate error to throttle
-	const float STE_rate_to_throttle = 1.0f / (limit.STE_rate_max - limit.STE_rate_min);
+	const float STE_rate_to_throttle = _derived_param.ste_rate_to_throttle;
 
 	// Integral handling
 	if (flag.airspeed_enabled) {
@@ -585,12 +618,9 @@ void TECSControl::_calcThrottleControlUpdate(float dt, const STERateLimit &limit
 	}
 }
 
-float TECSControl::_calcThrottleControlOutput(const STERateLimit &limit, const ControlValues &ste_rate,
-		const Param &param,
-		const Flag &flag) const
+float TECSControl::_calcThrottleControlOutput(const ControlValues &ste_rate, const Param &param, const Flag &flag) const
 {
-	// Calculate gain scaler from specific energy rate error to throttle
-	const float STE_rate_to_throttle = 1.0f / (limit.STE_rate_max - limit.STE_rate_min);
+	const float STE_rate_to_throttle = _derived_param.ste_rate_to_throttle;
 
 	// Calculate a predicted throttle from the demanded rate of change of energy, using the cruise throttle
 	// as the starting point. Assume:
@@ -598,10 +628,8 @@ float TECSControl::_calcThrottleControlOutput(const STERateLimit &limit, const C
 	// Specific total energy rate = 0 at cruise throttle
 	// Specific total energy rate = _STE_rate_min is achieved when throttle is set to _throttle_setpoint_min
 
-	// assume airspeed and density-independent delta_throttle to sink/climb rate mapping
-	// TODO: include air density for thrust mappings
-	const float throttle_above_trim_per_ste_rate = (param.throttle_max - param.throttle_trim) / limit.STE_rate_max;
-	const float throttle_below_trim_per_ste_rate = (param.throttle_trim - param.throttle_min) / limit.STE_rate_min;
+	const float throttle_above_trim_per_ste_rate = _derived_param.throttle_above_trim_per_ste_rate;
+	const float throttle_below_trim_per_ste_rate = _derived_param.throttle_below_trim_per_ste_rate;
 
 	float throttle_predicted = 0.0f;
 
@@ -112,8 +112,19 @@ public:
 	AirspeedFilterState getState() const;
 
 private:
+	/**
+	 * @brief Update the steady state Kalman gain if the noise parameters changed.
+	 *
+	 * @param[in] param are the filter parameters.
+	 */
+	void _updateKalmanGain(const Param &param);
+
 	// States
 	AirspeedFilterState _airspeed_state{.speed = 0.0f, .speed_rate = 0.0f};	///< Complimentary filter state
+
+	// Parameter derived
+	Param _kalman_gain_param{NAN, NAN, NAN, NAN};		///< Parameters the Kalman gain was calculated with.
+	matrix::Matrix<float, 2, 2> _kalman_gain{};		///< Steady state Kalman gain of the continuous filter.
 };
 
 class TECSAltitudeReferenceModel
@@ -337,6 +348,25 @@ private:
 		float STE_rate_min;	///< Minimal specific total energy rate limit [m²/s³].
 	};
 
+	/**
+	 * @brief Constants derived from the control parameters.
+	 * Only recalculated if one of the parameters they depend on changed.
+	 *
+	 */
+	struct DerivedParam {
+		// Parameters the constants were calculated with
+		float max_climb_rate;			///< Climb rate produced by max allowed throttle [m/s].
+		float min_sink_rate;			///< Minimum sink rate (with min throttle and trim speed) [m/s].
+		float throttle_trim;			///< Normalized throttle required to fly level at trim airspeed [0,1].
+		float throttle_max;			///< Normalized throttle upper limit.
+		float throttle_min;			///< Normalized throttle lower limit.
+
+		STERateLimit limit;			///< Specific total energy rate limits [m²/s³].
+		float ste_rate_to_throttle;		///< Gain from specific total energy rate error to throttle [s³/m²].
+		float throttle_above_trim_per_ste_rate;	///< Throttle above trim per specific total energy rate [s³/m²].
+		float throttle_below_trim_per_ste_rate;	///< Throttle below trim per specific total energy rate [s³/m²].
+	};
+
 	/**
 	 * @brief Control values.
 	 * setpoint and current state estimate value as input to a controller.
@@ -383,12 +413,12 @@ private:
 	 */
 	static inline constexpr float _getControlError(TECSControl::ControlValues val) {return (val.setpoint - val.estimate);};
 	/**
-	 * @brief Calculate specific total energy rate limits.
+	 * @brief Update the constants derived from the control parameters if the parameters changed.
+	 * Includes the specific total energy rate limits and the throttle mapping.
 	 *
 	 * @param[in] param are the control parametes.
-	 * @return Specific total energy rate limits in [m²/s³].
 	 */
-	STERateLimit _calculateTotalEnergyRateLimit(const Param &param) const;
+	void _updateDerivedParam(const Param &param);
 	/**
 	 * @brief calculate airspeed control proportional output.
 	 *
@@ -492,40 +522,37 @@ private:
 	/**
 	 * @brief Calculate throttle control specific total energy
 	 *
-	 * @param limit is the specific total energy rate limits in [m²/s³].
 	 * @param specific_energy_rate is the specific energy rates in [m²/s³].
 	 * @param param is the control parameters.
 	 * @return specific total energy rate values in [m²/s³]
 	 */
-	ControlValues _calcThrottleControlSteRate(const STERateLimit &limit, const SpecificEnergyRates &specific_energy_rate,
-			const Param &param) const;
+	ControlValues _calcThrottleControlSteRate(const SpecificEnergyRates &specific_energy_rate, const Param &param) const;
 
 	/**
 	 * @brief Calculate the throttle control update function.
 	 * Update the throttle control states (throttle integrator).
 	 *
 	 * @param dt is the update time intervall in [s].
-	 * @param limit is the specific total energy rate limits in [m²/s³].
 	 * @param ste_rate is the specific total energy rates in [m²/s³].
 	 * @param param is the control parameters.
 	 * @param flag is the control flags.
 	 */
-	void _calcThrottleControlUpdate(float dt, const STERateLimit &limit, const ControlValues &ste_rate, const Param &param,
-					const Flag &flag);
+	void _calcThrottleControlUpdate(float dt, const ControlValues &ste_rate, const Param &param, const Flag &flag);
 
 	/**
 	 * @brief Calculate the throttle control output function.
 	 *
-	 * @param limit is the specific total energy rate limits in [m²/s³].
 	 * @param ste_rate is the specific total energy rates in [m²/s³].
 	 * @param param is the control parameters.
 	 * @param flag is the control flags.
 	 * @return throttle setpoin in [0,1].
 	 */
-	float _calcThrottleControlOutput(const STERateLimit &limit, const ControlValues &ste_rate, const Param &param,
-					 const Flag &flag) const;
+	float _calcThrottleControlOutput(const ControlValues &ste_rate, const Param &param, const Flag &flag) const;
 
 private:
+	// Parameter derived
+	DerivedParam _derived_param{NAN, NAN, NAN, NAN, NAN, {NAN, NAN}, NAN, NAN, NAN};
+
 	// State
 	AlphaFilter<float> _ste_rate_estimate_filter;		///< Low pass filter for the specific total energy rate.
 	float _pitch_integ_state{0.0f};				///< Pitch integrator state [rad].
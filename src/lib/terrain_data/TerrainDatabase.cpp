@@ -0,0 +1,360 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TerrainDatabase.cpp
+ */
+
+#include "TerrainDatabase.hpp"
+
+#include <containers/LockGuard.hpp>
+#include <px4_platform_common/defines.h>
+
+#include <math.h>
+#include <string.h>
+
+namespace terrain
+{
+
+TerrainDatabase TerrainDatabase::_instance;
+
+TerrainDatabase::TerrainDatabase()
+{
+	pthread_mutex_init(&_mutex, nullptr);
+}
+
+TerrainDatabase::~TerrainDatabase()
+{
+	delete[] _cache;
+	delete _store;
+	delete _io_grid;
+	pthread_mutex_destroy(&_mutex);
+}
+
+bool TerrainDatabase::init(uint8_t num_grids, uint16_t spacing, const char *storage_root)
+{
+	if (_initialized.load() || (num_grids == 0) || (spacing == 0)) {
+		return false;
+	}
+
+	LockGuard lg{_mutex};
+
+	_cache = new CacheEntry[num_grids];
+	_io_grid = new TerrainGridData;
+
+	if ((_cache == nullptr) || (_io_grid == nullptr)) {
+		delete[] _cache;
+		delete _io_grid;
+		_cache = nullptr;
+		_io_grid = nullptr;
+		return false;
+	}
+
+	memset(_cache, 0, num_grids * sizeof(CacheEntry));
+
+	if (storage_root != nullptr) {
+		_store = new TerrainStore(storage_root);
+	}
+
+	_num_grids = num_grids;
+	_spacing = spacing;
+	_status.num_grids = num_grids;
+	_initialized.store(true);
+	return true;
+}
+
+TerrainDatabase::CacheEntry *TerrainDatabase::findOrQueue(const GridInfo &info)
+{
+	CacheEntry *oldest = nullptr;
+
+	for (uint8_t i = 0; i < _num_grids; i++) {
+		CacheEntry &entry = _cache[i];
+
+		if (entry.state == State::Empty) {
+			if ((oldest == nullptr) || (oldest->state != State::Empty)) {
+				oldest = &entry;
+			}
+
+		} else if (info.sameGrid(entry.grid, _spacing)) {
+			entry.last_access = ++_access_count;
+			return &entry;
+
+		} else if ((entry.state != State::Loading) && !entry.dirty
+			   && ((oldest == nullptr) || ((oldest->state != State::Empty) && (entry.last_access < oldest->last_access)))) {
+			// least recently used, grids queued for loading or not stored yet are kept
+			oldest = &entry;
+		}
+	}
+
+	if (oldest != nullptr) {
+		initGrid(info, _spacing, oldest->grid);
+		oldest->last_request = 0;
+		oldest->last_access = ++_access_count;
+		oldest->state = State::Loading;
+		oldest->dirty = false;
+	}
+
+	return nullptr;
+}
+
+bool TerrainDatabase::lookup(const GridInfo &info, float &height)
+{
+	_status.lookups++;
+
+	const CacheEntry *entry = findOrQueue(info);
+
+	if (entry != nullptr) {
+		const uint64_t needed = info.blocksNeeded();
+
+		if ((entry->state != State::Loading) && ((entry->grid.bitmap & needed) == needed)) {
+			height = interpolate(entry->grid, info);
+			return true;
+		}
+	}
+
+	_status.misses++;
+	return false;
+}
+
+bool TerrainDatabase::heightAmsl(double lat, double lon, float &height)
+{
+	GridInfo info;
+
+	if (!_initialized.load() || !calculateGridInfo(lat, lon, _spacing, info)) {
+		return false;
+	}
+
+	LockGuard lg{_mutex};
+	return lookup(info, height);
+}
+
+int TerrainDatabase::heightsAlongPath(double lat_start, double lon_start, double lat_end, double lon_end,
+				      float heights[], int count)
+{
+	if (count < 2) {
+		return 0;
+	}
+
+	for (int i = 0; i < count; i++) {
+		heights[i] = NAN;
+	}
+
+	if (!_initialized.load()) {
+		return 0;
+	}
+
+	const double d_lat = (lat_end - lat_start) / (count - 1);
+	const double d_lon = (lon_end - lon_start) / (count - 1);
+
+	int valid = 0;
+
+	LockGuard lg{_mutex};
+
+	for (int i = 0; i < count; i++) {
+		GridInfo info;
+
+		if (calculateGridInfo(lat_start + i * d_lat, lon_start + i * d_lon, _spacing, info) && lookup(info, heights[i])) {
+			valid++;
+		}
+	}
+
+	return valid;
+}
+
+void TerrainDatabase::prefetch(double lat, double lon)
+{
+	GridInfo info;
+
+	if (_initialized.load() && calculateGridInfo(lat, lon, _spacing, info)) {
+		LockGuard lg{_mutex};
+		findOrQueue(info);
+	}
+}
+
+bool TerrainDatabase::handleBlock(int32_t lat, int32_t lon, uint16_t spacing, uint8_t gridbit, const int16_t data[16])
+{
+	if (!_initialized.load() || (spacing != _spacing) || (gridbit >= GRID_BLOCKS)) {
+		return false;
+	}
+
+	LockGuard lg{_mutex};
+
+	for (uint8_t i = 0; i < _num_grids; i++) {
+		CacheEntry &entry = _cache[i];
+
+		if ((entry.state == State::Waiting) && (entry.grid.lat == lat) && (entry.grid.lon == lon)) {
+			const uint8_t x0 = (gridbit / GRID_BLOCK_MUL_Y) * GRID_MAVLINK_SIZE;
+			const uint8_t y0 = (gridbit % GRID_BLOCK_MUL_Y) * GRID_MAVLINK_SIZE;
+
+			for (uint8_t x = 0; x < GRID_MAVLINK_SIZE; x++) {
+				for (uint8_t y = 0; y < GRID_MAVLINK_SIZE; y++) {
+					entry.grid.height[x0 + x][y0 + y] = data[x * GRID_MAVLINK_SIZE + y];
+				}
+			}
+
+			entry.grid.bitmap |= 1ULL << gridbit;
+			_status.blocks_received++;
+
+			if (entry.grid.complete()) {
+				entry.state = State::Valid;
+				entry.dirty = (_store != nullptr);
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void TerrainDatabase::update()
+{
+	if (!_initialized.load()) {
+		return;
+	}
+
+	// load one queued grid
+	int loading = -1;
+
+	{
+		LockGuard lg{_mutex};
+
+		for (uint8_t i = 0; i < _num_grids; i++) {
+			if (_cache[i].state == State::Loading) {
+				if (_store == nullptr) {
+					_cache[i].state = State::Waiting;
+
+				} else if (loading < 0) {
+					loading = i;
+					*_io_grid = _cache[i].grid;
+				}
+			}
+		}
+	}
+
+	if (loading >= 0) {
+		const bool loaded = _store->read(*_io_grid);
+
+		LockGuard lg{_mutex};
+		CacheEntry &entry = _cache[loading];
+
+		// the entry can't be reused while it's loading
+		if (loaded) {
+			entry.grid = *_io_grid;
+			_status.grids_loaded++;
+		}
+
+		entry.state = entry.grid.complete() ? State::Valid : State::Waiting;
+	}
+
+	// store one completed grid
+	bool store = false;
+
+	{
+		LockGuard lg{_mutex};
+
+		for (uint8_t i = 0; i < _num_grids; i++) {
+			if (_cache[i].dirty) {
+				*_io_grid = _cache[i].grid;
+				_cache[i].dirty = false;
+				store = true;
+				break;
+			}
+		}
+	}
+
+	if (store && _store->write(*_io_grid)) {
+		LockGuard lg{_mutex};
+		_status.grids_stored++;
+	}
+}
+
+bool TerrainDatabase::nextRequest(uint64_t now, int32_t &lat, int32_t &lon, uint16_t &spacing, uint64_t &mask)
+{
+	if (!_initialized.load()) {
+		return false;
+	}
+
+	LockGuard lg{_mutex};
+
+	// most recently used grid first
+	CacheEntry *next = nullptr;
+
+	for (uint8_t i = 0; i < _num_grids; i++) {
+		CacheEntry &entry = _cache[i];
+
+		if ((entry.state == State::Waiting)
+		    && ((entry.last_request == 0) || (now >= entry.last_request + REQUEST_INTERVAL_US))
+		    && ((next == nullptr) || (entry.last_access > next->last_access))) {
+			next = &entry;
+		}
+	}
+
+	if (next == nullptr) {
+		return false;
+	}
+
+	next->last_request = now;
+
+	lat = next->grid.lat;
+	lon = next->grid.lon;
+	spacing = next->grid.spacing;
+	mask = ~next->grid.bitmap & GRID_BITMAP_FULL;
+	return true;
+}
+
+void TerrainDatabase::getStatus(Status &status)
+{
+	LockGuard lg{_mutex};
+
+	_status.grids_valid = 0;
+	_status.grids_loading = 0;
+	_status.grids_waiting = 0;
+
+	for (uint8_t i = 0; i < _num_grids; i++) {
+		switch (_cache[i].state) {
+		case State::Valid: _status.grids_valid++; break;
+
+		case State::Loading: _status.grids_loading++; break;
+
+		case State::Waiting: _status.grids_waiting++; break;
+
+		case State::Empty: break;
+		}
+	}
+
+	status = _status;
+}
+
+} // namespace terrain
@@ -0,0 +1,190 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TerrainDatabase.hpp
+ *
+ * Onboard terrain height database: an LRU cache of terrain grids in RAM, backed by the grids stored on
+ * the SD card (TerrainStore) and filled from the ground station through MAVLink TERRAIN_REQUEST and
+ * TERRAIN_DATA.
+ *
+ * Lookups never block on I/O and can be done from any thread: a grid missing in the cache makes the
+ * lookup fail and is queued for loading, which is done by the owner of the database (the terrain
+ * module) in update().
+ */
+
+#pragma once
+
+#include "TerrainGrid.hpp"
+#include "TerrainStore.hpp"
+
+#include <px4_platform_common/atomic.h>
+
+#include <pthread.h>
+
+namespace terrain
+{
+
+class TerrainDatabase
+{
+public:
+	TerrainDatabase();
+	~TerrainDatabase();
+
+	TerrainDatabase(const TerrainDatabase &) = delete;
+	TerrainDatabase &operator=(const TerrainDatabase &) = delete;
+
+	/**
+	 * The database shared by the terrain module and its users.
+	 */
+	static TerrainDatabase &instance() { return _instance; }
+
+	/**
+	 * Allocate the cache, only once.
+	 *
+	 * @param num_grids number of grids kept in RAM (sizeof(TerrainGridData) each)
+	 * @param spacing distance between the height samples [m]
+	 * @param storage_root directory of the grids on the SD card, nullptr to only use the ground station
+	 * @return true on success
+	 */
+	bool init(uint8_t num_grids, uint16_t spacing, const char *storage_root);
+
+	bool initialized() const { return _initialized.load(); }
+
+	uint16_t spacing() const { return _spacing; }
+
+	/**
+	 * Terrain height at a position, non-blocking.
+	 *
+	 * @param lat latitude [deg]
+	 * @param lon longitude [deg]
+	 * @param height terrain height AMSL [m]
+	 * @return false if the terrain is not known (yet)
+	 */
+	bool heightAmsl(double lat, double lon, float &height);
+
+	/**
+	 * Terrain heights along a straight path, non-blocking.
+	 *
+	 * @param heights count heights AMSL [m] equally spaced from start to end (included), NAN if unknown
+	 * @param count number of samples, >= 2
+	 * @return number of known heights
+	 */
+	int heightsAlongPath(double lat_start, double lon_start, double lat_end, double lon_end, float heights[], int count);
+
+	/**
+	 * Make sure the grid of a position gets loaded, without waiting for it.
+	 */
+	void prefetch(double lat, double lon);
+
+	/**
+	 * Add a 4x4 block of heights received from the ground station (TERRAIN_DATA).
+	 *
+	 * @param lat latitude of the south west corner of the grid [1e-7 deg]
+	 * @param lon longitude of the south west corner of the grid [1e-7 deg]
+	 * @param gridbit block index, bit of the request mask
+	 * @param data heights AMSL [m], row major (north, east)
+	 * @return true if the block belongs to a requested grid
+	 */
+	bool handleBlock(int32_t lat, int32_t lon, uint16_t spacing, uint8_t gridbit, const int16_t data[16]);
+
+	/**
+	 * Load the queued grids from the SD card and store the completed ones, blocking. Owner thread only.
+	 */
+	void update();
+
+	/**
+	 * Next grid to request from the ground station (TERRAIN_REQUEST).
+	 *
+	 * @param now current time [us]
+	 * @param mask bitmap of the missing blocks
+	 * @return true if a request is due
+	 */
+	bool nextRequest(uint64_t now, int32_t &lat, int32_t &lon, uint16_t &spacing, uint64_t &mask);
+
+	struct Status {
+		uint32_t lookups;
+		uint32_t misses;
+		uint32_t grids_loaded;		///< from the SD card
+		uint32_t grids_stored;		///< to the SD card
+		uint32_t blocks_received;	///< from the ground station
+		uint8_t num_grids;
+		uint8_t grids_valid;
+		uint8_t grids_loading;
+		uint8_t grids_waiting;		///< for the ground station
+	};
+
+	void getStatus(Status &status);
+
+	static constexpr uint64_t REQUEST_INTERVAL_US = 1000000;	///< resend period of a request for a grid
+
+private:
+	enum class State : uint8_t {
+		Empty,
+		Loading,	///< queued for the SD card
+		Waiting,	///< waiting for blocks from the ground station
+		Valid,		///< complete
+	};
+
+	struct CacheEntry {
+		TerrainGridData grid;
+		uint64_t last_request;
+		uint32_t last_access;
+		State state;
+		bool dirty;		///< complete but not stored yet
+	};
+
+	/** Find the grid of a position, queues it for loading if it's missing. Lock held. */
+	CacheEntry *findOrQueue(const GridInfo &info);
+
+	bool lookup(const GridInfo &info, float &height);
+
+	static TerrainDatabase _instance;
+
+	pthread_mutex_t _mutex;
+
+	px4::atomic<bool> _initialized{false};
+
+	CacheEntry *_cache{nullptr};
+	uint8_t _num_grids{0};
+	uint16_t _spacing{0};
+	uint32_t _access_count{0};
+
+	TerrainStore *_store{nullptr};
+	TerrainGridData *_io_grid{nullptr};	///< owner thread buffer for the SD card I/O
+
+	Status _status{};
+};
+
+} // namespace terrain
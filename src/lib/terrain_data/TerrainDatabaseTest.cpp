@@ -0,0 +1,281 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "TerrainDatabase.hpp"
+
+#include <math.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+using namespace terrain;
+
+static constexpr uint16_t SPACING = 100;
+
+// planar terrain in the samples of a grid
+static int16_t planeHeight(int x, int y)
+{
+	return 400 + 3 * x - 2 * y;
+}
+
+class TerrainDatabaseTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		ASSERT_TRUE(_database.init(4, SPACING, nullptr));
+	}
+
+	// answer a request of the database like a ground station
+	int sendGrid(uint64_t mask_allowed = GRID_BITMAP_FULL)
+	{
+		int32_t lat;
+		int32_t lon;
+		uint16_t spacing;
+		uint64_t mask;
+
+		if (!_database.nextRequest(_now, lat, lon, spacing, mask)) {
+			return -1;
+		}
+
+		_now += TerrainDatabase::REQUEST_INTERVAL_US;
+		int sent = 0;
+
+		for (uint8_t gridbit = 0; gridbit < GRID_BLOCKS; gridbit++) {
+			if (mask & mask_allowed & (1ULL << gridbit)) {
+				const int x0 = (gridbit / GRID_BLOCK_MUL_Y) * GRID_MAVLINK_SIZE;
+				const int y0 = (gridbit % GRID_BLOCK_MUL_Y) * GRID_MAVLINK_SIZE;
+				int16_t data[16];
+
+				for (int i = 0; i < 16; i++) {
+					data[i] = planeHeight(x0 + i / 4, y0 + i % 4);
+				}
+
+				EXPECT_TRUE(_database.handleBlock(lat, lon, spacing, gridbit, data));
+				sent++;
+			}
+		}
+
+		return sent;
+	}
+
+	TerrainDatabase _database;
+	uint64_t _now{1000000};
+
+	const double _lat{47.3977};
+	const double _lon{8.5456};
+};
+
+TEST(TerrainGridTest, gridInfo)
+{
+	GridInfo info;
+	ASSERT_TRUE(calculateGridInfo(47.3977, 8.5456, SPACING, info));
+	EXPECT_EQ(info.lat_degrees, 47);
+	EXPECT_EQ(info.lon_degrees, 8);
+	EXPECT_LT(info.idx_x, GRID_SPACING_X);
+	EXPECT_LT(info.idx_y, GRID_SPACING_Y);
+	EXPECT_GE(info.frac_x, 0.f);
+	EXPECT_LT(info.frac_x, 1.f);
+
+	// the south west corner of the grid is its first sample
+	GridInfo corner;
+	ASSERT_TRUE(calculateGridInfo(info.grid_lat * 1e-7 + 1e-7, info.grid_lon * 1e-7 + 1e-7, SPACING, corner));
+	EXPECT_EQ(corner.grid_idx_x, info.grid_idx_x);
+	EXPECT_EQ(corner.grid_idx_y, info.grid_idx_y);
+	EXPECT_EQ(corner.idx_x, 0);
+	EXPECT_EQ(corner.idx_y, 0);
+
+	// southern and western hemispheres
+	ASSERT_TRUE(calculateGridInfo(-33.86, -70.5, SPACING, info));
+	EXPECT_EQ(info.lat_degrees, -34);
+	EXPECT_EQ(info.lon_degrees, -71);
+
+	EXPECT_FALSE(calculateGridInfo(NAN, 8.5, SPACING, info));
+	EXPECT_FALSE(calculateGridInfo(91.0, 8.5, SPACING, info));
+}
+
+TEST_F(TerrainDatabaseTest, missThenRequest)
+{
+	// WHEN: the terrain is not known
+	float height;
+	EXPECT_FALSE(_database.heightAmsl(_lat, _lon, height));
+
+	// THEN: without storage the grid is requested from the ground station after the next update
+	int32_t lat;
+	int32_t lon;
+	uint16_t spacing;
+	uint64_t mask;
+	EXPECT_FALSE(_database.nextRequest(_now, lat, lon, spacing, mask));
+	_database.update();
+	ASSERT_TRUE(_database.nextRequest(_now, lat, lon, spacing, mask));
+	EXPECT_EQ(mask, GRID_BITMAP_FULL);
+	EXPECT_EQ(spacing, SPACING);
+
+	// and the request is resent only after a while
+	EXPECT_FALSE(_database.nextRequest(_now + 1, lat, lon, spacing, mask));
+	EXPECT_TRUE(_database.nextRequest(_now + TerrainDatabase::REQUEST_INTERVAL_US, lat, lon, spacing, mask));
+}
+
+TEST_F(TerrainDatabaseTest, bilinear)
+{
+	float height;
+	EXPECT_FALSE(_database.heightAmsl(_lat, _lon, height));
+	_database.update();
+	EXPECT_EQ(sendGrid(), GRID_BLOCKS);
+
+	// WHEN: the grid is complete
+	GridInfo info;
+	ASSERT_TRUE(calculateGridInfo(_lat, _lon, SPACING, info));
+	ASSERT_TRUE(_database.heightAmsl(_lat, _lon, height));
+
+	// THEN: a planar terrain is exactly interpolated
+	const float expected = planeHeight(info.idx_x, info.idx_y) + 3.f * info.frac_x - 2.f * info.frac_y;
+	EXPECT_NEAR(height, expected, 1e-3f);
+
+	// and there are no more requests
+	int32_t lat;
+	int32_t lon;
+	uint16_t spacing;
+	uint64_t mask;
+	EXPECT_FALSE(_database.nextRequest(_now + 10 * TerrainDatabase::REQUEST_INTERVAL_US, lat, lon, spacing, mask));
+
+	TerrainDatabase::Status status;
+	_database.getStatus(status);
+	EXPECT_EQ(status.grids_valid, 1);
+	EXPECT_EQ(status.blocks_received, GRID_BLOCKS);
+}
+
+TEST_F(TerrainDatabaseTest, partialGrid)
+{
+	GridInfo info;
+	ASSERT_TRUE(calculateGridInfo(_lat, _lon, SPACING, info));
+
+	float height;
+	EXPECT_FALSE(_database.heightAmsl(_lat, _lon, height));
+	_database.update();
+
+	// WHEN: only the blocks around the position are received
+	EXPECT_GT(sendGrid(info.blocksNeeded()), 0);
+
+	// THEN: the height is known, and the missing blocks are requested again
+	EXPECT_TRUE(_database.heightAmsl(_lat, _lon, height));
+
+	int32_t lat;
+	int32_t lon;
+	uint16_t spacing;
+	uint64_t mask;
+	ASSERT_TRUE(_database.nextRequest(_now, lat, lon, spacing, mask));
+	EXPECT_EQ(mask, GRID_BITMAP_FULL & ~info.blocksNeeded());
+}
+
+TEST_F(TerrainDatabaseTest, leastRecentlyUsed)
+{
+	// WHEN: more grids than the cache holds are used, about 2.4 km apart to the north
+	float height;
+	const double grid_step = GRID_SPACING_X * SPACING / 111318.8;
+
+	for (int i = 0; i < 5; i++) {
+		EXPECT_FALSE(_database.heightAmsl(_lat + i * grid_step, _lon, height));
+		_database.update();
+		EXPECT_EQ(sendGrid(), GRID_BLOCKS);
+		EXPECT_TRUE(_database.heightAmsl(_lat + i * grid_step, _lon, height));
+	}
+
+	// THEN: the first one was evicted, the most recent ones are kept
+	EXPECT_FALSE(_database.heightAmsl(_lat, _lon, height));
+	EXPECT_TRUE(_database.heightAmsl(_lat + 4 * grid_step, _lon, height));
+}
+
+TEST_F(TerrainDatabaseTest, path)
+{
+	const double lat_end = _lat + 0.005;
+	float heights[10];
+
+	EXPECT_EQ(_database.heightsAlongPath(_lat, _lon, lat_end, _lon, heights, 10), 0);
+	EXPECT_TRUE(isnan(heights[0]));
+
+	// load all the grids needed by the path
+	for (int i = 0; i < 4; i++) {
+		_database.update();
+		sendGrid();
+	}
+
+	EXPECT_EQ(_database.heightsAlongPath(_lat, _lon, lat_end, _lon, heights, 10), 10);
+
+	float height;
+	ASSERT_TRUE(_database.heightAmsl(lat_end, _lon, height));
+	EXPECT_FLOAT_EQ(heights[9], height);
+}
+
+TEST(TerrainStoreTest, roundTrip)
+{
+	mkdir("terrain_store_test", S_IRWXU);
+	TerrainStore store("terrain_store_test");
+
+	GridInfo info;
+	ASSERT_TRUE(calculateGridInfo(-12.5, 130.8, SPACING, info));
+
+	TerrainGridData *grid = new TerrainGridData;
+	initGrid(info, SPACING, *grid);
+	EXPECT_FALSE(store.read(*grid));
+
+	for (int x = 0; x < GRID_SIZE_X; x++) {
+		for (int y = 0; y < GRID_SIZE_Y; y++) {
+			grid->height[x][y] = planeHeight(x, y);
+		}
+	}
+
+	grid->bitmap = GRID_BITMAP_FULL;
+	ASSERT_TRUE(store.write(*grid));
+
+	// WHEN: reading the grid back
+	TerrainGridData *read = new TerrainGridData;
+	initGrid(info, SPACING, *read);
+	ASSERT_TRUE(store.read(*read));
+
+	// THEN: it's the same
+	EXPECT_TRUE(read->complete());
+	EXPECT_EQ(read->height[GRID_SIZE_X - 1][GRID_SIZE_Y - 1], planeHeight(GRID_SIZE_X - 1, GRID_SIZE_Y - 1));
+
+	// and the neighbouring grid is still missing
+	GridInfo neighbour = info;
+	neighbour.grid_idx_y++;
+	initGrid(neighbour, SPACING, *read);
+	EXPECT_FALSE(store.read(*read));
+
+	delete grid;
+	delete read;
+
+	remove("terrain_store_test/terrain/100/S13E130.DAT");
+}
@@ -0,0 +1,122 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TerrainGrid.cpp
+ */
+
+#include "TerrainGrid.hpp"
+
+#include <px4_platform_common/defines.h>
+
+#include <math.h>
+#include <string.h>
+
+namespace terrain
+{
+
+// meters per degree of latitude
+static constexpr double METERS_PER_DEGREE = 111318.84502145034;
+
+static double longitudeScale(int16_t lat_degrees)
+{
+	return cos((double)lat_degrees * M_PI / 180.0);
+}
+
+bool calculateGridInfo(double lat, double lon, uint16_t spacing, GridInfo &info)
+{
+	if (!PX4_ISFINITE(lat) || !PX4_ISFINITE(lon) || (fabs(lat) >= 90.0) || (fabs(lon) > 180.0) || (spacing == 0)) {
+		return false;
+	}
+
+	const double lat_degrees = floor(lat);
+	const double lon_degrees = floor(lon);
+
+	info.lat_degrees = (int16_t)lat_degrees;
+	info.lon_degrees = (int16_t)lon_degrees;
+
+	const double scale_east = METERS_PER_DEGREE * longitudeScale(info.lat_degrees);
+
+	// position in samples from the south west corner of the degree square
+	const double samples_x = (lat - lat_degrees) * METERS_PER_DEGREE / spacing;
+	const double samples_y = (lon - lon_degrees) * scale_east / spacing;
+
+	const uint32_t sample_x = (uint32_t)samples_x;
+	const uint32_t sample_y = (uint32_t)samples_y;
+
+	info.grid_idx_x = sample_x / GRID_SPACING_X;
+	info.grid_idx_y = sample_y / GRID_SPACING_Y;
+
+	info.idx_x = sample_x % GRID_SPACING_X;
+	info.idx_y = sample_y % GRID_SPACING_Y;
+
+	info.frac_x = (float)(samples_x - sample_x);
+	info.frac_y = (float)(samples_y - sample_y);
+
+	// south west corner of the grid
+	const double north = (double)info.grid_idx_x * GRID_SPACING_X * spacing;
+	const double east = (double)info.grid_idx_y * GRID_SPACING_Y * spacing;
+
+	info.grid_lat = (int32_t)(lat_degrees * 1e7) + (int32_t)round(north / METERS_PER_DEGREE * 1e7);
+	info.grid_lon = (int32_t)(lon_degrees * 1e7) + (int32_t)round(east / scale_east * 1e7);
+
+	return true;
+}
+
+void initGrid(const GridInfo &info, uint16_t spacing, TerrainGridData &grid)
+{
+	memset(&grid, 0, sizeof(grid));
+
+	grid.lat = info.grid_lat;
+	grid.lon = info.grid_lon;
+	grid.lat_degrees = info.lat_degrees;
+	grid.lon_degrees = info.lon_degrees;
+	grid.grid_idx_x = info.grid_idx_x;
+	grid.grid_idx_y = info.grid_idx_y;
+	grid.spacing = spacing;
+	grid.magic = GRID_MAGIC;
+}
+
+uint16_t gridsPerDegreeEast(uint16_t spacing)
+{
+	// the equator is the widest degree square
+	return (uint16_t)(METERS_PER_DEGREE / (GRID_SPACING_Y * spacing)) + 1;
+}
+
+uint16_t gridsPerDegreeNorth(uint16_t spacing)
+{
+	return (uint16_t)(METERS_PER_DEGREE / (GRID_SPACING_X * spacing)) + 1;
+}
+
+} // namespace terrain
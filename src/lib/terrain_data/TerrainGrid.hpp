@@ -0,0 +1,175 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TerrainGrid.hpp
+ *
+ * Geometry of the terrain height grids.
+ *
+ * The earth is split into 1x1 degree squares, each covered by grids of GRID_SIZE_X x GRID_SIZE_Y
+ * height samples (north x east) with a spacing of a few tens to hundreds of meters. A grid is made of
+ * GRID_BLOCK_MUL_X x GRID_BLOCK_MUL_Y blocks of 4x4 samples, the unit of the MAVLink TERRAIN_DATA
+ * message. Neighbouring grids overlap by one block so that the four samples around any position are
+ * always found in a single grid.
+ *
+ * Positions inside a degree square are projected with an equirectangular projection at the latitude
+ * of its south west corner.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace terrain
+{
+
+static constexpr uint8_t GRID_MAVLINK_SIZE = 4;		///< samples per side of a TERRAIN_DATA block
+static constexpr uint8_t GRID_BLOCK_MUL_X = 7;		///< blocks per grid, north
+static constexpr uint8_t GRID_BLOCK_MUL_Y = 8;		///< blocks per grid, east
+static constexpr uint8_t GRID_BLOCKS = GRID_BLOCK_MUL_X * GRID_BLOCK_MUL_Y;
+
+static constexpr uint8_t GRID_SIZE_X = GRID_BLOCK_MUL_X * GRID_MAVLINK_SIZE;		///< samples per grid, north
+static constexpr uint8_t GRID_SIZE_Y = GRID_BLOCK_MUL_Y * GRID_MAVLINK_SIZE;		///< samples per grid, east
+static constexpr uint8_t GRID_SPACING_X = (GRID_BLOCK_MUL_X - 1) * GRID_MAVLINK_SIZE;	///< samples between grids, north
+static constexpr uint8_t GRID_SPACING_Y = (GRID_BLOCK_MUL_Y - 1) * GRID_MAVLINK_SIZE;	///< samples between grids, east
+
+static constexpr uint64_t GRID_BITMAP_FULL = (1ULL << GRID_BLOCKS) - 1;
+
+static constexpr uint16_t GRID_MAGIC = 0x5458; // "TX"
+
+/**
+ * A grid of terrain heights, in RAM and on the SD card.
+ */
+struct TerrainGridData {
+	uint64_t bitmap;		///< received blocks, bit (block_x * GRID_BLOCK_MUL_Y + block_y)
+	int32_t lat;			///< latitude of the south west corner [1e-7 deg]
+	int32_t lon;			///< longitude of the south west corner [1e-7 deg]
+	int16_t lat_degrees;		///< south west corner of the degree square [deg]
+	int16_t lon_degrees;		///< south west corner of the degree square [deg]
+	uint16_t grid_idx_x;		///< grid index inside the degree square, north
+	uint16_t grid_idx_y;		///< grid index inside the degree square, east
+	uint16_t spacing;		///< distance between samples [m]
+	uint16_t magic;
+	uint32_t crc;			///< CRC32 of the grid with crc = 0, only valid on the SD card
+	int16_t height[GRID_SIZE_X][GRID_SIZE_Y];	///< terrain height AMSL [m]
+
+	bool complete() const { return bitmap == GRID_BITMAP_FULL; }
+
+	bool sameGrid(const TerrainGridData &other) const
+	{
+		return (lat_degrees == other.lat_degrees) && (lon_degrees == other.lon_degrees)
+		       && (grid_idx_x == other.grid_idx_x) && (grid_idx_y == other.grid_idx_y)
+		       && (spacing == other.spacing);
+	}
+};
+
+/**
+ * Location of a position in the grids.
+ */
+struct GridInfo {
+	int32_t grid_lat;		///< latitude of the south west corner of the grid [1e-7 deg]
+	int32_t grid_lon;		///< longitude of the south west corner of the grid [1e-7 deg]
+	int16_t lat_degrees;
+	int16_t lon_degrees;
+	uint16_t grid_idx_x;
+	uint16_t grid_idx_y;
+	uint8_t idx_x;			///< sample south of the position inside the grid
+	uint8_t idx_y;			///< sample west of the position inside the grid
+	float frac_x;			///< position between sample idx_x and idx_x + 1 [0, 1)
+	float frac_y;			///< position between sample idx_y and idx_y + 1 [0, 1)
+
+	/** Bitmap of the blocks containing the four samples around the position */
+	uint64_t blocksNeeded() const
+	{
+		const uint8_t bx0 = idx_x / GRID_MAVLINK_SIZE;
+		const uint8_t bx1 = (idx_x + 1) / GRID_MAVLINK_SIZE;
+		const uint8_t by0 = idx_y / GRID_MAVLINK_SIZE;
+		const uint8_t by1 = (idx_y + 1) / GRID_MAVLINK_SIZE;
+
+		return (1ULL << (bx0 * GRID_BLOCK_MUL_Y + by0)) | (1ULL << (bx0 * GRID_BLOCK_MUL_Y + by1))
+		       | (1ULL << (bx1 * GRID_BLOCK_MUL_Y + by0)) | (1ULL << (bx1 * GRID_BLOCK_MUL_Y + by1));
+	}
+
+	bool sameGrid(const TerrainGridData &grid, uint16_t spacing) const
+	{
+		return (lat_degrees == grid.lat_degrees) && (lon_degrees == grid.lon_degrees)
+		       && (grid_idx_x == grid.grid_idx_x) && (grid_idx_y == grid.grid_idx_y)
+		       && (spacing == grid.spacing);
+	}
+};
+
+/**
+ * Find the grid and the samples around a position.
+ *
+ * @param lat latitude [deg]
+ * @param lon longitude [deg]
+ * @param spacing distance between samples [m], > 0
+ * @param info result
+ * @return false if the position is invalid
+ */
+bool calculateGridInfo(double lat, double lon, uint16_t spacing, GridInfo &info);
+
+/**
+ * Initialize an empty grid (no blocks received) for the grid of a position.
+ */
+void initGrid(const GridInfo &info, uint16_t spacing, TerrainGridData &grid);
+
+/**
+ * Number of grids covering a degree square to the east, used to index the grids on the SD card.
+ */
+uint16_t gridsPerDegreeEast(uint16_t spacing);
+
+/**
+ * Number of grids covering a degree square to the north.
+ */
+uint16_t gridsPerDegreeNorth(uint16_t spacing);
+
+/**
+ * Bilinear interpolation of the terrain height at a position of the grid, the blocks
+ * of GridInfo::blocksNeeded() must be present.
+ */
+inline float interpolate(const TerrainGridData &grid, const GridInfo &info)
+{
+	const float h00 = grid.height[info.idx_x][info.idx_y];
+	const float h01 = grid.height[info.idx_x][info.idx_y + 1];
+	const float h10 = grid.height[info.idx_x + 1][info.idx_y];
+	const float h11 = grid.height[info.idx_x + 1][info.idx_y + 1];
+
+	const float h0 = h00 + (h01 - h00) * info.frac_y;
+	const float h1 = h10 + (h11 - h10) * info.frac_y;
+
+	return h0 + (h1 - h0) * info.frac_x;
+}
+
+} // namespace terrain
@@ -0,0 +1,185 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TerrainStore.cpp
+ */
+
+#include "TerrainStore.hpp"
+
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/log.h>
+
+#include <crc32.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace terrain
+{
+
+TerrainStore::TerrainStore(const char *root)
+{
+	strncpy(_root, root, sizeof(_root) - 1);
+}
+
+TerrainStore::~TerrainStore()
+{
+	closeFile();
+}
+
+uint32_t TerrainStore::crc(const TerrainGridData &grid)
+{
+	// CRC of the grid with the crc field zeroed, without copying it
+	static constexpr uint32_t zero = 0;
+	static constexpr size_t crc_offset = offsetof(TerrainGridData, crc);
+	static constexpr size_t tail_offset = crc_offset + sizeof(zero);
+
+	const uint8_t *data = (const uint8_t *)&grid;
+	uint32_t sum = crc32part(data, crc_offset, 0);
+	sum = crc32part((const uint8_t *)&zero, sizeof(zero), sum);
+	return crc32part(data + tail_offset, sizeof(grid) - tail_offset, sum);
+}
+
+void TerrainStore::closeFile()
+{
+	if (_fd >= 0) {
+		close(_fd);
+		_fd = -1;
+	}
+}
+
+bool TerrainStore::openFile(const TerrainGridData &grid, bool create)
+{
+	if ((_fd >= 0) && (grid.lat_degrees == _lat_degrees) && (grid.lon_degrees == _lon_degrees)
+	    && (grid.spacing == _spacing) && (_fd_writable || !create)) {
+		return true;
+	}
+
+	closeFile();
+
+	char path[PATH_MAX];
+	int len = snprintf(path, sizeof(path), "%s/terrain", _root);
+
+	if (create) {
+		mkdir(path, S_IRWXU | S_IRWXG | S_IRWXO);
+	}
+
+	len += snprintf(path + len, sizeof(path) - len, "/%u", grid.spacing);
+
+	if (create) {
+		mkdir(path, S_IRWXU | S_IRWXG | S_IRWXO);
+	}
+
+	snprintf(path + len, sizeof(path) - len, "/%c%02u%c%03u.DAT",
+		 grid.lat_degrees < 0 ? 'S' : 'N', (unsigned)abs(grid.lat_degrees),
+		 grid.lon_degrees < 0 ? 'W' : 'E', (unsigned)abs(grid.lon_degrees));
+
+	_fd = create ? open(path, O_RDWR | O_CREAT, PX4_O_MODE_666) : open(path, O_RDONLY);
+
+	if (_fd < 0) {
+		if (create || (errno != ENOENT)) {
+			PX4_ERR("open %s failed (%i)", path, errno);
+		}
+
+		return false;
+	}
+
+	_fd_writable = create;
+	_lat_degrees = grid.lat_degrees;
+	_lon_degrees = grid.lon_degrees;
+	_spacing = grid.spacing;
+	return true;
+}
+
+static off_t gridOffset(const TerrainGridData &grid)
+{
+	const uint32_t slot = grid.grid_idx_x * gridsPerDegreeEast(grid.spacing) + grid.grid_idx_y;
+	return (off_t)slot * sizeof(TerrainGridData);
+}
+
+bool TerrainStore::read(TerrainGridData &grid)
+{
+	if (!openFile(grid, false)) {
+		return false;
+	}
+
+	// read in place (grids are too large for the stack), the key is restored on failure
+	const off_t offset = gridOffset(grid);
+	GridInfo key{};
+	key.grid_lat = grid.lat;
+	key.grid_lon = grid.lon;
+	key.lat_degrees = grid.lat_degrees;
+	key.lon_degrees = grid.lon_degrees;
+	key.grid_idx_x = grid.grid_idx_x;
+	key.grid_idx_y = grid.grid_idx_y;
+	const uint16_t spacing = grid.spacing;
+
+	if ((lseek(_fd, offset, SEEK_SET) >= 0)
+	    && (::read(_fd, &grid, sizeof(grid)) == (ssize_t)sizeof(grid))
+	    && (grid.magic == GRID_MAGIC) && key.sameGrid(grid, spacing) && (grid.crc == crc(grid))) {
+		return true;
+	}
+
+	// not written yet or invalid
+	initGrid(key, spacing, grid);
+	return false;
+}
+
+bool TerrainStore::write(TerrainGridData &grid)
+{
+	if (!openFile(grid, true)) {
+		return false;
+	}
+
+	grid.magic = GRID_MAGIC;
+	grid.crc = crc(grid);
+
+	if ((lseek(_fd, gridOffset(grid), SEEK_SET) < 0)
+	    || (::write(_fd, &grid, sizeof(grid)) != (ssize_t)sizeof(grid))) {
+		PX4_ERR("grid write failed (%i)", errno);
+		closeFile();
+		return false;
+	}
+
+	fsync(_fd);
+	return true;
+}
+
+} // namespace terrain
@@ -0,0 +1,94 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TerrainStore.hpp
+ *
+ * Terrain grids on the SD card.
+ *
+ * There is one file per degree square and grid spacing (e.g. terrain/100/N47E008.DAT) holding the
+ * grids at a fixed offset given by their index in the degree square, so a grid is read or written
+ * with a single seek without any index. Unused slots are zero (holes in the file).
+ *
+ * All methods do blocking file I/O and must only be used from the thread owning the store.
+ */
+
+#pragma once
+
+#include "TerrainGrid.hpp"
+
+#include <limits.h>
+
+namespace terrain
+{
+
+class TerrainStore
+{
+public:
+	/**
+	 * @param root directory containing the terrain directory, usually PX4_STORAGEDIR
+	 */
+	explicit TerrainStore(const char *root);
+	~TerrainStore();
+
+	/**
+	 * Read a grid.
+	 * @param grid empty grid of the requested position (see initGrid())
+	 * @return true if the grid was found and valid, otherwise grid is left empty
+	 */
+	bool read(TerrainGridData &grid);
+
+	/**
+	 * Write a grid, the crc field is updated.
+	 * @return true on success
+	 */
+	bool write(TerrainGridData &grid);
+
+private:
+	bool openFile(const TerrainGridData &grid, bool create);
+	void closeFile();
+
+	static uint32_t crc(const TerrainGridData &grid);
+
+	char _root[PATH_MAX / 2] {};
+
+	// the file of the last accessed degree square is kept open
+	int _fd{-1};
+	bool _fd_writable{false};
+	int16_t _lat_degrees{0};
+	int16_t _lon_degrees{0};
+	uint16_t _spacing{0};
+};
+
+} // namespace terrain
@@ -53,10 +53,28 @@ void Timesync::update(const uint64_t now_us, const int64_t remote_timestamp_ns,
 		// Calculate the round trip time (RTT) it took the timesync packet to bounce back to us from remote system
 		uint64_t rtt_us = now_us - (originate_timestamp_ns / 1000ULL);
 
+		// Keep the RTT of the recent packets
+		_rtt[_rtt_next] = rtt_us < UINT32_MAX ? (uint32_t)rtt_us : UINT32_MAX;
+		_rtt_next = (_rtt_next + 1) % RTT_WINDOW;
+
+		if (_rtt_count < RTT_WINDOW) {
+			_rtt_count++;
+		}
+
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+		// Calculate the difference of this sample from the current estimate
+		uint64_t deviation = llabs((int64_t)offset_at(now_us) - offset_us);
+
+		// Only use samples with a low RTT, or at least not far slower than usual on this link
+		const bool rtt_ok = (rtt_us < MAX_RTT_SAMPLE) || (rtt_us <= (uint64_t)RTT_GATE_FACTOR * rtt_percentile(50));
+#else
 		// Calculate the difference of this sample from the current estimate
 		uint64_t deviation = llabs((int64_t)_time_offset - offset_us);
 
-		if (rtt_us < MAX_RTT_SAMPLE) {	// Only use samples with low RTT
+		const bool rtt_ok = rtt_us < MAX_RTT_SAMPLE;
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
+
+		if (rtt_ok) {	// Only use samples with low RTT
 
 			if (sync_converged() && (deviation > MAX_DEVIATION_SAMPLE)) {
 
@@ -72,6 +90,20 @@ void Timesync::update(const uint64_t now_us, const int64_t remote_timestamp_ns,
 				}
 
 			} else {
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+
+				if (add_sample(now_us, offset_us, rtt_us)) {
+					_sequence++;
+					_high_deviation_count = 0;
+					_high_rtt_count = 0;
+
+				} else if (++_high_deviation_count > MAX_CONSECUTIVE_HIGH_DEVIATION) {
+					// consistently far from the estimate, but below the time jump threshold
+					PX4_WARN("timesync estimate inconsistent. Resetting time synchroniser.");
+					reset_filter();
+				}
+
+#else
 
 				// Filter gain scheduling
 				if (!sync_converged()) {
@@ -97,6 +129,7 @@ void Timesync::update(const uint64_t now_us, const int64_t remote_timestamp_ns,
 
 				// Reset high RTT count after filter update
 				_high_rtt_count = 0;
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
 			}
 
 		} else {
@@ -113,8 +146,19 @@ void Timesync::update(const uint64_t now_us, const int64_t remote_timestamp_ns,
 		tsync_status.source_protocol = _source;
 		tsync_status.remote_timestamp = remote_timestamp_ns / 1000ULL;
 		tsync_status.observed_offset = offset_us;
-		tsync_status.estimated_offset = (int64_t)_time_offset;
 		tsync_status.round_trip_time = rtt_us;
+		tsync_status.rtt_p50 = rtt_percentile(50);
+		tsync_status.rtt_p95 = rtt_percentile(95);
+		tsync_status.converged = sync_converged();
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+		tsync_status.estimated_offset = (int64_t)offset_at(now_us);
+		tsync_status.offset_std = sqrt(_P[0][0]);
+		tsync_status.drift_rate = _drift_rate * 1e6;
+#else
+		tsync_status.estimated_offset = (int64_t)_time_offset;
+		tsync_status.offset_std = NAN;
+		tsync_status.drift_rate = NAN;
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
 		tsync_status.timestamp = hrt_absolute_time();
 
 		_timesync_status_pub.publish(tsync_status);
@@ -125,13 +169,64 @@ uint64_t Timesync::sync_stamp(uint64_t usec)
 {
 	// Only return synchronised stamp if we have converged to a good value
 	if (sync_converged()) {
-		return usec + (int64_t)_time_offset;
+		return usec + offset();
 
 	} else {
 		return hrt_absolute_time();
 	}
 }
 
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+bool Timesync::add_sample(uint64_t now_us, int64_t offset_us, uint64_t rtt_us)
+{
+	// The observed offset is off by at most half the RTT (fully asymmetric delays)
+	const double measurement_std = fmax(rtt_us / 2.0, MEASUREMENT_STD_MIN);
+	const double measurement_var = measurement_std * measurement_std;
+
+	if (_sequence == 0) {
+		// First offset sample
+		_time_offset = offset_us;
+		_time_offset_stamp = now_us;
+		_drift_rate = 0.0;
+		_P[0][0] = measurement_var;
+		_P[0][1] = _P[1][0] = 0.0;
+		_P[1][1] = DRIFT_INITIAL_STD * DRIFT_INITIAL_STD;
+		return true;
+	}
+
+	// Predict the offset at the time of the sample, state x = [offset, drift rate]
+	const double dt = (double)(int64_t)(now_us - _time_offset_stamp); // [us]
+	const double dt_s = dt * 1e-6;
+	const double cov = _P[0][1] + dt * _P[1][1];
+
+	_time_offset += _drift_rate * dt;
+	_time_offset_stamp = now_us;
+	_P[0][0] += dt * (_P[0][1] + cov) + OFFSET_PROCESS_NOISE * dt_s;
+	_P[0][1] = _P[1][0] = cov;
+	_P[1][1] += DRIFT_PROCESS_NOISE * dt_s;
+
+	// Measurement update with the observed offset (H = [1, 0])
+	const double innovation = offset_us - _time_offset;
+	const double innovation_var = _P[0][0] + measurement_var;
+
+	if (sync_converged() && innovation * innovation > OUTLIER_GATE * OUTLIER_GATE * innovation_var) {
+		return false;
+	}
+
+	const double k0 = _P[0][0] / innovation_var;
+	const double k1 = _P[1][0] / innovation_var;
+
+	_time_offset += k0 * innovation;
+	_drift_rate += k1 * innovation;
+
+	_P[1][1] -= k1 * _P[0][1];
+	_P[0][1] = _P[1][0] = (1.0 - k0) * _P[0][1];
+	_P[0][0] *= (1.0 - k0);
+
+	return true;
+}
+
+#else
 void Timesync::add_sample(int64_t offset_us)
 {
 	// Online exponential smoothing filter. The derivative of the estimate is also
@@ -151,15 +246,44 @@ void Timesync::add_sample(int64_t offset_us)
 		_time_skew = _filter_beta * (_time_offset - time_offset_prev) + (1.0 - _filter_beta) * _time_skew;
 	}
 }
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
+
+uint32_t Timesync::rtt_percentile(uint32_t percentile) const
+{
+	if (_rtt_count == 0) {
+		return 0;
+	}
+
+	uint32_t sorted[RTT_WINDOW];
+
+	// insertion sort, the window is small
+	for (uint32_t i = 0; i < _rtt_count; i++) {
+		uint32_t j = i;
+
+		for (; j > 0 && sorted[j - 1] > _rtt[i]; j--) {
+			sorted[j] = sorted[j - 1];
+		}
+
+		sorted[j] = _rtt[i];
+	}
+
+	return sorted[(_rtt_count - 1) * percentile / 100];
+}
 
 void Timesync::reset_filter()
 {
 	// Do a full reset of all statistics and parameters
 	_sequence = 0;
 	_time_offset = 0.0;
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+	_time_offset_stamp = 0;
+	_drift_rate = 0.0;
+	_P[0][0] = _P[0][1] = _P[1][0] = _P[1][1] = 0.0;
+#else
 	_time_skew = 0.0;
 	_filter_alpha = ALPHA_GAIN_INITIAL;
 	_filter_beta = BETA_GAIN_INITIAL;
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
 	_high_deviation_count = 0;
 	_high_rtt_count = 0;
 }
@@ -90,6 +90,31 @@ static constexpr uint64_t MAX_DEVIATION_SAMPLE = 100_ms;
 static constexpr uint32_t MAX_CONSECUTIVE_HIGH_RTT = 10;
 static constexpr uint32_t MAX_CONSECUTIVE_HIGH_DEVIATION = 10;
 
+// RTT statistics
+//
+// The round-trip times of the last RTT_WINDOW packets are kept for the published percentiles.
+static constexpr uint32_t RTT_WINDOW = 32;
+
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+// Kalman filter on the clock offset and drift rate (CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+//
+// The offset observed from a packet is off by at most half its asymmetric RTT, so the measurement
+// noise is derived from the RTT of the packet: fast packets get a high weight, slow ones a low weight.
+// Samples with an innovation beyond OUTLIER_GATE standard deviations, or with an RTT more than
+// RTT_GATE_FACTOR times the median RTT of the link are not used. This replaces the fixed MAX_RTT_SAMPLE
+// threshold, so links with a high but steady latency (telemetry radios) still get synchronised.
+// The filter is converged after MIN_CONVERGENCE_SAMPLES once the offset standard deviation is
+// below MAX_CONVERGED_OFFSET_STD.
+static constexpr double OFFSET_PROCESS_NOISE = 100.0;		///< offset random walk [us^2/s]
+static constexpr double DRIFT_PROCESS_NOISE = 1e-14;		///< drift rate random walk [1/s] (0.1 ppm/sqrt(s))
+static constexpr double DRIFT_INITIAL_STD = 1e-4;		///< initial drift rate uncertainty (100 ppm)
+static constexpr double MEASUREMENT_STD_MIN = 50.0;		///< timestamp resolution and jitter [us]
+static constexpr double OUTLIER_GATE = 4.0;			///< innovation gate [standard deviations]
+static constexpr uint32_t RTT_GATE_FACTOR = 3;
+static constexpr uint32_t MIN_CONVERGENCE_SAMPLES = 20;
+static constexpr double MAX_CONVERGED_OFFSET_STD = 1000.0;	///< [us]
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
+
 class Timesync
 {
 public:
@@ -104,6 +129,14 @@ public:
 	 */
 	uint64_t sync_stamp(uint64_t usec);
 
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+	/**
+	 * Offset extrapolated to the current time with the estimated drift rate
+	 */
+	int64_t offset() const { return (int64_t)offset_at(hrt_absolute_time()); }
+
+	bool sync_converged() const { return _sequence >= MIN_CONVERGENCE_SAMPLES && sqrt(_P[0][0]) < MAX_CONVERGED_OFFSET_STD; }
+#else
 	int64_t offset() const { return (int64_t)_time_offset; }
 
 	/**
@@ -111,6 +144,7 @@ public:
 	 * return false otherwise
 	 */
 	bool sync_converged() const { return _sequence >= CONVERGENCE_WINDOW; }
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
 
 	/**
 	 * Reset the exponential filter and its states
@@ -120,21 +154,48 @@ public:
 
 private:
 
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+	/**
+	 * Kalman filter update of the offset and drift rate
+	 * @return false if the sample was rejected as outlier
+	 */
+	bool add_sample(uint64_t now_us, int64_t offset_us, uint64_t rtt_us);
+
+	double offset_at(uint64_t now_us) const { return _time_offset + _drift_rate * (double)(int64_t)(now_us - _time_offset_stamp); }
+#else
 	/**
 	 * Online exponential filter to smooth time offset
 	 */
 	void add_sample(int64_t offset_us);
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
+
+	/**
+	 * Percentile of the RTT of the recent packets
+	 * @param percentile [0, 100]
+	 */
+	uint32_t rtt_percentile(uint32_t percentile) const;
+
 	uORB::PublicationMulti<timesync_status_s>  _timesync_status_pub{ORB_ID(timesync_status)};
 
 	uint32_t _sequence{0};
 
 	// Timesync statistics
 	double _time_offset{0};
+#if defined(CONFIG_TIMESYNC_DRIFT_ESTIMATOR)
+	uint64_t _time_offset_stamp{0};	///< local time of _time_offset [us]
+	double _drift_rate{0};		///< rate of change of the offset [us/us]
+	double _P[2][2] {};		///< covariance of offset and drift rate
+#else
 	double _time_skew{0};
 
 	// Filter parameters
 	double _filter_alpha{ALPHA_GAIN_INITIAL};
 	double _filter_beta{BETA_GAIN_INITIAL};
+#endif // CONFIG_TIMESYNC_DRIFT_ESTIMATOR
+
+	uint32_t _rtt[RTT_WINDOW] {};
+	uint32_t _rtt_count{0};
+	uint32_t _rtt_next{0};
 
 	// Outlier rejection and filter reset
 	uint32_t _high_deviation_count{0};
@@ -0,0 +1,146 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file MappedFile.hpp
+ *
+ * Read-only memory mapping of a (log) file, usable as std::streambuf.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <streambuf>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace px4
+{
+namespace ulog
+{
+
+class MappedFileBuffer : public std::streambuf
+{
+public:
+	MappedFileBuffer() = default;
+	~MappedFileBuffer() { close(); }
+
+	MappedFileBuffer(const MappedFileBuffer &) = delete;
+	MappedFileBuffer &operator=(const MappedFileBuffer &) = delete;
+
+	/**
+	 * @param advice madvise() access pattern, by default the file is expected to be read front to back (with small jumps)
+	 */
+	bool open(const char *file_name, int advice = MADV_SEQUENTIAL)
+	{
+		close();
+
+		int fd = ::open(file_name, O_RDONLY);
+
+		if (fd < 0) {
+			return false;
+		}
+
+		struct stat st;
+
+		if (fstat(fd, &st) == 0 && st.st_size > 0) {
+			void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+			if (data != MAP_FAILED) {
+				madvise(data, st.st_size, advice);
+				_data = static_cast<char *>(data);
+				_size = st.st_size;
+				setg(_data, _data, _data + _size);
+			}
+		}
+
+		// the mapping stays valid after closing the file descriptor
+		::close(fd);
+
+		return _data != nullptr;
+	}
+
+	const char *data() const { return _data; }
+	size_t size() const { return _size; }
+
+	void close()
+	{
+		if (_data) {
+			munmap(_data, _size);
+			_data = nullptr;
+			_size = 0;
+			setg(nullptr, nullptr, nullptr);
+		}
+	}
+
+protected:
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+	{
+		off_type pos = off;
+
+		if (dir == std::ios_base::cur) {
+			pos += gptr() - eback();
+
+		} else if (dir == std::ios_base::end) {
+			pos += _size;
+		}
+
+		return seekpos(pos, which);
+	}
+
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+	{
+		if (!(which & std::ios_base::in) || pos < 0 || (size_t)pos > _size) {
+			return pos_type(off_type(-1));
+		}
+
+		setg(_data, _data + (size_t)pos, _data + _size);
+		return pos;
+	}
+
+	std::streamsize showmanyc() override
+	{
+		return egptr() - gptr();
+	}
+
+private:
+	char *_data{nullptr};
+	size_t _size{0};
+};
+
+} // namespace ulog
+} // namespace px4
@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ULogFormat.hpp
+ *
+ * Helpers to parse the field definitions of ULog format messages ("type name;type name;..."),
+ * shared by the replay module and the ULog reader.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+
+namespace px4
+{
+namespace ulog
+{
+
+/**
+ * Split a field type into the element type and the array size, e.g. "float[3]" -> "float", 3.
+ * @param array_size set to 1 if the type is not an array
+ */
+static inline std::string extractArraySize(const std::string &type_name_full, int &array_size)
+{
+	const size_t start_pos = type_name_full.find('[');
+	const size_t end_pos = type_name_full.find(']');
+
+	if (start_pos == std::string::npos || end_pos == std::string::npos) {
+		array_size = 1;
+		return type_name_full;
+	}
+
+	array_size = atoi(type_name_full.substr(start_pos + 1, end_pos - start_pos - 1).c_str());
+	return type_name_full.substr(0, start_pos);
+}
+
+/**
+ * Size of a basic ULog type [bytes], 0 for nested types (another format).
+ */
+static inline size_t sizeOfBasicType(const std::string &type_name)
+{
+	if (type_name == "int8_t" || type_name == "uint8_t") {
+		return 1;
+
+	} else if (type_name == "int16_t" || type_name == "uint16_t") {
+		return 2;
+
+	} else if (type_name == "int32_t" || type_name == "uint32_t") {
+		return 4;
+
+	} else if (type_name == "int64_t" || type_name == "uint64_t") {
+		return 8;
+
+	} else if (type_name == "float") {
+		return 4;
+
+	} else if (type_name == "double") {
+		return 8;
+
+	} else if (type_name == "char" || type_name == "bool") {
+		return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * Iterate the fields of a format definition.
+ * @param fields field definitions (the part after the ':' of a format message)
+ * @param callback bool callback(const std::string &type_name_full, const std::string &field_name),
+ *                 return false to stop the iteration
+ */
+template<typename Callback>
+static inline void forEachField(const std::string &fields, Callback &&callback)
+{
+	size_t prev_field_end = 0;
+	size_t field_end = fields.find(';');
+
+	while (field_end != std::string::npos) {
+		const size_t space_pos = fields.find(' ', prev_field_end);
+
+		if (space_pos != std::string::npos && space_pos < field_end) {
+			if (!callback(fields.substr(prev_field_end, space_pos - prev_field_end),
+				      fields.substr(space_pos + 1, field_end - space_pos - 1))) {
+				return;
+			}
+		}
+
+		prev_field_end = field_end + 1;
+		field_end = fields.find(';', prev_field_end);
+	}
+}
+
+} // namespace ulog
+} // namespace px4
@@ -0,0 +1,440 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "ULogReader.hpp"
+#include "ULogFormat.hpp"
+
+#include <logger/messages.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+namespace px4
+{
+namespace ulog
+{
+
+static constexpr uint8_t ULOG_MAGIC[] = {'U', 'L', 'o', 'g', 0x01, 0x12, 0x35};
+static constexpr size_t ULOG_FILE_HEADER_LEN = 16;
+static constexpr size_t ULOG_DATA_HEADER_LEN = ULOG_MSG_HEADER_LEN + sizeof(uint16_t); // msg_id
+static constexpr int MAX_NESTING_DEPTH = 10;
+static constexpr size_t MIN_SAMPLES_PER_THREAD = 10000;
+static constexpr uint16_t MSG_ID_UNUSED = UINT16_MAX;
+
+template<typename T>
+static inline T readValue(const char *data)
+{
+	T value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+bool ULogReader::open(const char *file_name)
+{
+	close();
+
+	// subscriptions are decoded with a stride through the whole file, possibly by multiple threads
+	if (!_file.open(file_name, MADV_WILLNEED)) {
+		return false;
+	}
+
+	if (!readHeader()) {
+		close();
+		return false;
+	}
+
+	buildIndex();
+	return true;
+}
+
+void ULogReader::close()
+{
+	_file.close();
+	_start_timestamp = 0;
+	_formats.clear();
+	_subscriptions.clear();
+}
+
+bool ULogReader::readHeader()
+{
+	if (_file.size() < ULOG_FILE_HEADER_LEN || memcmp(_file.data(), ULOG_MAGIC, sizeof(ULOG_MAGIC)) != 0) {
+		return false;
+	}
+
+	_start_timestamp = readValue<uint64_t>(_file.data() + 8);
+	return true;
+}
+
+void ULogReader::buildIndex()
+{
+	const char *data = _file.data();
+	const size_t size = _file.size();
+
+	// msg_id -> index into _subscriptions
+	std::vector<uint16_t> subscription_index;
+
+	size_t pos = ULOG_FILE_HEADER_LEN;
+
+	while (pos + ULOG_MSG_HEADER_LEN <= size) {
+		const uint16_t msg_size = readValue<uint16_t>(data + pos);
+		const uint8_t msg_type = data[pos + 2];
+		const char *msg = data + pos + ULOG_MSG_HEADER_LEN;
+
+		if (pos + ULOG_MSG_HEADER_LEN + msg_size > size) {
+			break; // truncated
+		}
+
+		switch (msg_type) {
+		case (uint8_t)ULogMessageType::DATA:
+			if (msg_size >= sizeof(uint16_t)) {
+				const uint16_t msg_id = readValue<uint16_t>(msg);
+
+				if (msg_id < subscription_index.size() && subscription_index[msg_id] != MSG_ID_UNUSED) {
+					_subscriptions[subscription_index[msg_id]].samples.push_back(pos);
+				}
+			}
+
+			break;
+
+		case (uint8_t)ULogMessageType::FORMAT: {
+				const std::string format(msg, msg_size);
+				const size_t colon = format.find(':');
+
+				if (colon != std::string::npos && !findFormat(format.substr(0, colon))) {
+					Format f;
+					f.name = format.substr(0, colon);
+					f.definition = format.substr(colon + 1);
+					_formats.push_back(f);
+				}
+			}
+			break;
+
+		case (uint8_t)ULogMessageType::ADD_LOGGED_MSG:
+			if (msg_size > 3) {
+				Subscription subscription;
+				subscription.multi_id = msg[0];
+				subscription.msg_id = readValue<uint16_t>(msg + 1);
+				subscription.message_name.assign(msg + 3, msg_size - 3);
+
+				const Subscription *existing = findSubscription(subscription.message_name, subscription.multi_id);
+				uint16_t index = existing ? (uint16_t)(existing - _subscriptions.data()) : (uint16_t)_subscriptions.size();
+
+				if (!existing) {
+					_subscriptions.push_back(subscription);
+				}
+
+				if (subscription.msg_id >= subscription_index.size()) {
+					subscription_index.resize(subscription.msg_id + 1, MSG_ID_UNUSED);
+				}
+
+				subscription_index[subscription.msg_id] = index;
+			}
+
+			break;
+
+		case (uint8_t)ULogMessageType::REMOVE_LOGGED_MSG:
+			if (msg_size >= sizeof(uint16_t)) {
+				const uint16_t msg_id = readValue<uint16_t>(msg);
+
+				if (msg_id < subscription_index.size()) {
+					subscription_index[msg_id] = MSG_ID_UNUSED;
+				}
+			}
+
+			break;
+
+		default: // parameters, info, logging, sync, dropouts, flag bits (appended data is parsed as regular messages)
+			break;
+		}
+
+		pos += ULOG_MSG_HEADER_LEN + msg_size;
+	}
+
+	for (Format &format : _formats) {
+		resolveFormat(format);
+	}
+}
+
+size_t ULogReader::resolveFormat(Format &format, int depth)
+{
+	if (format.size > 0 || depth > MAX_NESTING_DEPTH) {
+		return format.size;
+	}
+
+	std::vector<Field> fields;
+	size_t offset = 0;
+	bool valid = true;
+
+	forEachField(format.definition, [&](const std::string & type_name_full, const std::string & field_name) {
+		Field field;
+		field.name = field_name;
+		field.type_name = extractArraySize(type_name_full, field.array_size);
+		field.offset = offset;
+		field.element_size = sizeOfBasicType(field.type_name);
+
+		if (field.element_size == 0) {
+			Format *nested = findMutableFormat(field.type_name);
+			field.element_size = nested ? resolveFormat(*nested, depth + 1) : 0;
+		}
+
+		if (field.element_size == 0) {
+			valid = false;
+			return false;
+		}
+
+		offset += field.element_size * field.array_size;
+		fields.push_back(field);
+		return true;
+	});
+
+	if (valid) {
+		format.fields = std::move(fields);
+		format.size = offset;
+	}
+
+	return format.size;
+}
+
+const ULogReader::Subscription *ULogReader::findSubscription(const std::string &message_name, uint8_t multi_id) const
+{
+	for (const Subscription &subscription : _subscriptions) {
+		if (subscription.multi_id == multi_id && subscription.message_name == message_name) {
+			return &subscription;
+		}
+	}
+
+	return nullptr;
+}
+
+const ULogReader::Format *ULogReader::findFormat(const std::string &name) const
+{
+	for (const Format &format : _formats) {
+		if (format.name == name) {
+			return &format;
+		}
+	}
+
+	return nullptr;
+}
+
+ULogReader::Format *ULogReader::findMutableFormat(const std::string &name)
+{
+	return const_cast<Format *>(findFormat(name));
+}
+
+bool ULogReader::resolveField(const std::string &format_name, const std::string &field_path, Column &column) const
+{
+	const Format *format = findFormat(format_name);
+	size_t offset = 0;
+	size_t token_start = 0;
+
+	while (format && format->size > 0) {
+		const size_t token_end = std::min(field_path.find('.', token_start), field_path.size());
+		int array_size = 1;
+		const std::string token = field_path.substr(token_start, token_end - token_start);
+		const std::string name = extractArraySize(token, array_size);
+		const bool indexed = (token.find('[') != std::string::npos);
+		const int index = indexed ? array_size : 0;
+
+		auto field = std::find_if(format->fields.begin(), format->fields.end(), [&name](const Field & f) { return f.name == name; });
+
+		if (field == format->fields.end() || index < 0 || index >= field->array_size || (!indexed && field->array_size > 1)) {
+			return false;
+		}
+
+		offset += field->offset + index * field->element_size;
+
+		const FieldType type = fieldType(field->type_name);
+
+		if (token_end == field_path.size()) {
+			if (type == FieldType::Invalid) {
+				return false; // nested type
+			}
+
+			column.type = type;
+			column.offset = offset;
+			return true;
+		}
+
+		if (type != FieldType::Invalid) {
+			return false; // basic type with a sub field
+		}
+
+		format = findFormat(field->type_name);
+		token_start = token_end + 1;
+	}
+
+	return false;
+}
+
+void ULogReader::extract(const Subscription &subscription, const Column *columns, int num_columns,
+			 double *const *output, int num_threads) const
+{
+	const size_t num_samples = subscription.samples.size();
+
+	if (num_threads <= 0) {
+		num_threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	num_threads = (int)std::min<size_t>(num_threads, std::max<size_t>(1, num_samples / MIN_SAMPLES_PER_THREAD));
+
+	if (num_threads <= 1) {
+		extractRange(subscription, columns, num_columns, output, 0, num_samples);
+		return;
+	}
+
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads - 1);
+	const size_t chunk = (num_samples + num_threads - 1) / num_threads;
+
+	for (int i = 1; i < num_threads; ++i) {
+		const size_t start = std::min(num_samples, i * chunk);
+		const size_t end = std::min(num_samples, start + chunk);
+		threads.emplace_back(&ULogReader::extractRange, this, std::cref(subscription), columns, num_columns, output, start, end);
+	}
+
+	extractRange(subscription, columns, num_columns, output, 0, std::min(num_samples, chunk));
+
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+}
+
+void ULogReader::extractRange(const Subscription &subscription, const Column *columns, int num_columns,
+			      double *const *output, size_t start, size_t end) const
+{
+	const char *file_data = _file.data();
+
+	for (size_t i = start; i < end; ++i) {
+		const char *msg = file_data + subscription.samples[i];
+		const size_t data_size = readValue<uint16_t>(msg) - sizeof(uint16_t);
+		const char *data = msg + ULOG_DATA_HEADER_LEN;
+
+		for (int c = 0; c < num_columns; ++c) {
+			const Column &column = columns[c];
+			const char *value = data + column.offset;
+			const size_t value_size = sizeOfFieldType(column.type);
+			double result = NAN;
+
+			if (value_size > 0 && column.offset + value_size <= data_size) {
+				switch (column.type) {
+				case FieldType::Int8: result = readValue<int8_t>(value); break;
+
+				case FieldType::UInt8:
+				case FieldType::Bool:
+				case FieldType::Char: result = readValue<uint8_t>(value); break;
+
+				case FieldType::Int16: result = readValue<int16_t>(value); break;
+
+				case FieldType::UInt16: result = readValue<uint16_t>(value); break;
+
+				case FieldType::Int32: result = readValue<int32_t>(value); break;
+
+				case FieldType::UInt32: result = readValue<uint32_t>(value); break;
+
+				case FieldType::Int64: result = (double)readValue<int64_t>(value); break;
+
+				case FieldType::UInt64: result = (double)readValue<uint64_t>(value); break;
+
+				case FieldType::Float: result = readValue<float>(value); break;
+
+				case FieldType::Double: result = readValue<double>(value); break;
+
+				case FieldType::Invalid: break;
+				}
+			}
+
+			output[c][i] = result;
+		}
+	}
+}
+
+ULogReader::FieldType ULogReader::fieldType(const std::string &type_name)
+{
+	if (type_name == "int8_t") { return FieldType::Int8; }
+
+	if (type_name == "uint8_t") { return FieldType::UInt8; }
+
+	if (type_name == "int16_t") { return FieldType::Int16; }
+
+	if (type_name == "uint16_t") { return FieldType::UInt16; }
+
+	if (type_name == "int32_t") { return FieldType::Int32; }
+
+	if (type_name == "uint32_t") { return FieldType::UInt32; }
+
+	if (type_name == "int64_t") { return FieldType::Int64; }
+
+	if (type_name == "uint64_t") { return FieldType::UInt64; }
+
+	if (type_name == "float") { return FieldType::Float; }
+
+	if (type_name == "double") { return FieldType::Double; }
+
+	if (type_name == "bool") { return FieldType::Bool; }
+
+	if (type_name == "char") { return FieldType::Char; }
+
+	return FieldType::Invalid;
+}
+
+size_t ULogReader::sizeOfFieldType(FieldType type)
+{
+	switch (type) {
+	case FieldType::Int8:
+	case FieldType::UInt8:
+	case FieldType::Bool:
+	case FieldType::Char: return 1;
+
+	case FieldType::Int16:
+	case FieldType::UInt16: return 2;
+
+	case FieldType::Int32:
+	case FieldType::UInt32:
+	case FieldType::Float: return 4;
+
+	case FieldType::Int64:
+	case FieldType::UInt64:
+	case FieldType::Double: return 8;
+
+	case FieldType::Invalid: break;
+	}
+
+	return 0;
+}
+
+} // namespace ulog
+} // namespace px4
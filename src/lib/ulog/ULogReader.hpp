@@ -0,0 +1,165 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ULogReader.hpp
+ *
+ * Standalone ULog reader (no dependency on the PX4 runtime, so it can also be built as host library).
+ * The file is memory-mapped and indexed once, after which single fields of a topic can be extracted
+ * into columns (one array per field), decoded by multiple threads.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "MappedFile.hpp"
+
+namespace px4
+{
+namespace ulog
+{
+
+class ULogReader
+{
+public:
+	enum class FieldType : uint8_t {
+		Invalid,
+		Int8,
+		UInt8,
+		Int16,
+		UInt16,
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Float,
+		Double,
+		Bool,
+		Char,
+	};
+
+	struct Field {
+		std::string type_name; ///< element type, without array size
+		std::string name;
+		int array_size{1};
+		size_t offset{0};       ///< offset from the start of the message data [bytes]
+		size_t element_size{0}; ///< [bytes]
+	};
+
+	struct Format {
+		std::string name;
+		std::string definition; ///< fields as in the log ("type name;type name;...")
+		std::vector<Field> fields;
+		size_t size{0}; ///< [bytes], 0 if not (yet) resolved
+	};
+
+	struct Subscription {
+		std::string message_name;
+		uint16_t msg_id{0};
+		uint8_t multi_id{0};
+		std::vector<size_t> samples; ///< file offsets of the data messages (message header)
+	};
+
+	/** resolved field of a topic, see resolveField() */
+	struct Column {
+		FieldType type{FieldType::Invalid};
+		size_t offset{0};
+	};
+
+	ULogReader() = default;
+	~ULogReader() = default;
+
+	ULogReader(const ULogReader &) = delete;
+	ULogReader &operator=(const ULogReader &) = delete;
+
+	/**
+	 * Map and index a log file.
+	 * @return false if the file cannot be mapped or is not a ULog file (truncated files are indexed up to the end of
+	 *         the last complete message)
+	 */
+	bool open(const char *file_name);
+
+	void close();
+
+	uint64_t startTimestamp() const { return _start_timestamp; }
+
+	const std::vector<Subscription> &subscriptions() const { return _subscriptions; }
+	const Subscription *findSubscription(const std::string &message_name, uint8_t multi_id = 0) const;
+
+	const std::vector<Format> &formats() const { return _formats; }
+	const Format *findFormat(const std::string &name) const;
+
+	/**
+	 * Resolve a (nested) field of a format, e.g. "timestamp", "q[2]" or "esc[3].esc_rpm".
+	 * @return false if the field does not exist or is not a basic type
+	 */
+	bool resolveField(const std::string &format_name, const std::string &field_path, Column &column) const;
+
+	/**
+	 * Decode fields of all samples of a subscription into columns.
+	 * Samples that are too short for a field (e.g. after a format change) get NAN.
+	 * @param columns resolved fields
+	 * @param output one array per column, with space for subscription.samples.size() values
+	 * @param num_threads number of decoding threads, 0 to use all cores
+	 */
+	void extract(const Subscription &subscription, const Column *columns, int num_columns, double *const *output,
+		     int num_threads = 0) const;
+
+private:
+	bool readHeader();
+	void buildIndex();
+	size_t resolveFormat(Format &format, int depth = 0);
+
+	Format *findMutableFormat(const std::string &name);
+
+	void extractRange(const Subscription &subscription, const Column *columns, int num_columns, double *const *output,
+			  size_t start, size_t end) const;
+
+	static FieldType fieldType(const std::string &type_name);
+	static size_t sizeOfFieldType(FieldType type);
+
+	MappedFileBuffer _file;
+
+	uint64_t _start_timestamp{0};
+
+	std::vector<Format> _formats;
+	std::vector<Subscription> _subscriptions;
+};
+
+} // namespace ulog
+} // namespace px4
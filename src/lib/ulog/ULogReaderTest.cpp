@@ -0,0 +1,203 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "ULogReader.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace px4::ulog;
+
+class ULogReaderTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		static const char magic[] = {'U', 'L', 'o', 'g', 0x01, 0x12, 0x35, 0x01};
+		append(magic, sizeof(magic));
+		const uint64_t start_timestamp = 1234;
+		append(&start_timestamp, sizeof(start_timestamp));
+
+		addMessage('F', "topic_a:uint64_t timestamp;float[3] xyz;uint8_t[4] _padding0;inner[2] in;");
+		addMessage('F', "inner:int16_t a;double b;");
+		addMessage('A', std::string("\x00\x05\x00topic_a", 10));
+		addMessage('A', std::string("\x01\x06\x00topic_a", 10));
+
+		for (int i = 0; i < NUM_SAMPLES; ++i) {
+			std::string data("\x05\x00", 2);
+			appendValue(data, (uint64_t)i);
+			appendValue(data, 0.5f * i);
+			appendValue(data, -1.f * i);
+			appendValue(data, 2.f);
+			data.append(4, '\0');
+			appendValue(data, (int16_t)(i % 1000));
+			appendValue(data, 0.25 * i);
+			appendValue(data, (int16_t)7);
+			appendValue(data, 1.5);
+			addMessage('D', data);
+
+			// second instance with only the timestamp (e.g. logged with an older format)
+			data[0] = 6;
+			addMessage('D', data.substr(0, 2 + 8));
+		}
+
+		// truncated message at the end of the file
+		_file.append("\x20\x00\x44\x05", 4);
+
+		snprintf(_file_name, sizeof(_file_name), "%s", "ulog_reader_test_XXXXXX");
+		const int fd = mkstemp(_file_name);
+		ASSERT_GE(fd, 0);
+		ASSERT_EQ(write(fd, _file.data(), _file.size()), (ssize_t)_file.size());
+		::close(fd);
+	}
+
+	void TearDown() override
+	{
+		unlink(_file_name);
+	}
+
+	static constexpr int NUM_SAMPLES = 25000;
+
+	char _file_name[64] {};
+
+private:
+	void append(const void *data, size_t size) { _file.append((const char *)data, size); }
+
+	template<typename T>
+	static void appendValue(std::string &data, T value) { data.append((const char *)&value, sizeof(value)); }
+
+	void addMessage(char type, const std::string &msg)
+	{
+		const uint16_t msg_size = msg.size();
+		append(&msg_size, sizeof(msg_size));
+		append(&type, 1);
+		_file.append(msg);
+	}
+
+	std::string _file;
+};
+
+TEST_F(ULogReaderTest, Index)
+{
+	ULogReader reader;
+	ASSERT_TRUE(reader.open(_file_name));
+	EXPECT_EQ(reader.startTimestamp(), 1234u);
+
+	ASSERT_EQ(reader.subscriptions().size(), 2u);
+
+	const ULogReader::Subscription *sub0 = reader.findSubscription("topic_a", 0);
+	const ULogReader::Subscription *sub1 = reader.findSubscription("topic_a", 1);
+	ASSERT_NE(sub0, nullptr);
+	ASSERT_NE(sub1, nullptr);
+	EXPECT_EQ(sub0->samples.size(), (size_t)NUM_SAMPLES);
+	EXPECT_EQ(sub1->samples.size(), (size_t)NUM_SAMPLES);
+	EXPECT_EQ(reader.findSubscription("topic_b"), nullptr);
+
+	const ULogReader::Format *format = reader.findFormat("topic_a");
+	ASSERT_NE(format, nullptr);
+	EXPECT_EQ(format->size, 8u + 12u + 4u + 2u * 10u);
+}
+
+TEST_F(ULogReaderTest, ResolveField)
+{
+	ULogReader reader;
+	ASSERT_TRUE(reader.open(_file_name));
+
+	ULogReader::Column column;
+	EXPECT_TRUE(reader.resolveField("topic_a", "in[1].b", column));
+	EXPECT_EQ(column.type, ULogReader::FieldType::Double);
+	EXPECT_EQ(column.offset, 8u + 12u + 4u + 10u + 2u);
+
+	EXPECT_FALSE(reader.resolveField("topic_a", "xyz", column)); // array without index
+	EXPECT_FALSE(reader.resolveField("topic_a", "xyz[3]", column));
+	EXPECT_FALSE(reader.resolveField("topic_a", "in[0]", column)); // nested type
+	EXPECT_FALSE(reader.resolveField("topic_a", "timestamp.a", column));
+	EXPECT_FALSE(reader.resolveField("topic_a", "unknown", column));
+	EXPECT_FALSE(reader.resolveField("topic_b", "timestamp", column));
+}
+
+TEST_F(ULogReaderTest, Extract)
+{
+	ULogReader reader;
+	ASSERT_TRUE(reader.open(_file_name));
+
+	const ULogReader::Subscription *sub0 = reader.findSubscription("topic_a", 0);
+	ASSERT_NE(sub0, nullptr);
+
+	ULogReader::Column columns[3];
+	ASSERT_TRUE(reader.resolveField("topic_a", "timestamp", columns[0]));
+	ASSERT_TRUE(reader.resolveField("topic_a", "xyz[1]", columns[1]));
+	ASSERT_TRUE(reader.resolveField("topic_a", "in[0].a", columns[2]));
+
+	for (int num_threads : {1, 0}) {
+		std::vector<double> data[3];
+		double *output[3];
+
+		for (int i = 0; i < 3; ++i) {
+			data[i].resize(sub0->samples.size());
+			output[i] = data[i].data();
+		}
+
+		reader.extract(*sub0, columns, 3, output, num_threads);
+
+		for (int i = 0; i < NUM_SAMPLES; ++i) {
+			ASSERT_EQ(data[0][i], i);
+			ASSERT_EQ(data[1][i], -i);
+			ASSERT_EQ(data[2][i], i % 1000);
+		}
+	}
+
+	// the samples of the second instance are too short for xyz
+	const ULogReader::Subscription *sub1 = reader.findSubscription("topic_a", 1);
+	ASSERT_NE(sub1, nullptr);
+	std::vector<double> data[2] {std::vector<double>(NUM_SAMPLES), std::vector<double>(NUM_SAMPLES)};
+	double *output[2] {data[0].data(), data[1].data()};
+	reader.extract(*sub1, columns, 2, output);
+	EXPECT_EQ(data[0][10], 10);
+	EXPECT_TRUE(std::isnan(data[1][10]));
+}
+
+TEST_F(ULogReaderTest, InvalidFile)
+{
+	ULogReader reader;
+	EXPECT_FALSE(reader.open("/nonexistent.ulg"));
+}
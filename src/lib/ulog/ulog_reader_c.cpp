@@ -0,0 +1,128 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "ulog_reader_c.h"
+#include "ULogReader.hpp"
+
+#include <new>
+
+using px4::ulog::ULogReader;
+
+struct ulog_reader_s {
+	ULogReader reader;
+};
+
+ulog_reader_t *ulog_reader_open(const char *file_name)
+{
+	ulog_reader_t *handle = new (std::nothrow) ulog_reader_t;
+
+	if (handle && !handle->reader.open(file_name)) {
+		delete handle;
+		handle = nullptr;
+	}
+
+	return handle;
+}
+
+void ulog_reader_close(ulog_reader_t *reader)
+{
+	delete reader;
+}
+
+uint64_t ulog_reader_start_timestamp(const ulog_reader_t *reader)
+{
+	return reader->reader.startTimestamp();
+}
+
+int ulog_reader_num_subscriptions(const ulog_reader_t *reader)
+{
+	return (int)reader->reader.subscriptions().size();
+}
+
+static const ULogReader::Subscription *subscription(const ulog_reader_t *reader, int index)
+{
+	const auto &subscriptions = reader->reader.subscriptions();
+	return (index >= 0 && index < (int)subscriptions.size()) ? &subscriptions[index] : nullptr;
+}
+
+const char *ulog_reader_subscription_name(const ulog_reader_t *reader, int index)
+{
+	const ULogReader::Subscription *sub = subscription(reader, index);
+	return sub ? sub->message_name.c_str() : nullptr;
+}
+
+int ulog_reader_subscription_multi_id(const ulog_reader_t *reader, int index)
+{
+	const ULogReader::Subscription *sub = subscription(reader, index);
+	return sub ? sub->multi_id : -1;
+}
+
+int64_t ulog_reader_subscription_num_samples(const ulog_reader_t *reader, int index)
+{
+	const ULogReader::Subscription *sub = subscription(reader, index);
+	return sub ? (int64_t)sub->samples.size() : -1;
+}
+
+int ulog_reader_find_subscription(const ulog_reader_t *reader, const char *message_name, int multi_id)
+{
+	const ULogReader::Subscription *sub = reader->reader.findSubscription(message_name, (uint8_t)multi_id);
+	return sub ? (int)(sub - reader->reader.subscriptions().data()) : -1;
+}
+
+const char *ulog_reader_format(const ulog_reader_t *reader, const char *format_name)
+{
+	const ULogReader::Format *format = reader->reader.findFormat(format_name);
+	return format ? format->definition.c_str() : nullptr;
+}
+
+int64_t ulog_reader_extract(const ulog_reader_t *reader, int index, const char *const *fields, int num_fields,
+			    double *const *columns, int num_threads)
+{
+	const ULogReader::Subscription *sub = subscription(reader, index);
+
+	if (!sub || num_fields < 0) {
+		return -1;
+	}
+
+	std::vector<ULogReader::Column> resolved(num_fields);
+
+	for (int i = 0; i < num_fields; ++i) {
+		if (!reader->reader.resolveField(sub->message_name, fields[i], resolved[i])) {
+			return -1;
+		}
+	}
+
+	reader->reader.extract(*sub, resolved.data(), num_fields, columns, num_threads);
+	return (int64_t)sub->samples.size();
+}
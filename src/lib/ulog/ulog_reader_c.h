@@ -0,0 +1,79 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ulog_reader_c.h
+ *
+ * C interface of the ULog reader, used by the Python bindings (Tools/ulog_reader.py).
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ulog_reader_s ulog_reader_t;
+
+/** @return nullptr on failure */
+ulog_reader_t *ulog_reader_open(const char *file_name);
+void ulog_reader_close(ulog_reader_t *reader);
+
+uint64_t ulog_reader_start_timestamp(const ulog_reader_t *reader);
+
+int ulog_reader_num_subscriptions(const ulog_reader_t *reader);
+const char *ulog_reader_subscription_name(const ulog_reader_t *reader, int index);
+int ulog_reader_subscription_multi_id(const ulog_reader_t *reader, int index);
+int64_t ulog_reader_subscription_num_samples(const ulog_reader_t *reader, int index);
+
+/** @return subscription index, -1 if not found */
+int ulog_reader_find_subscription(const ulog_reader_t *reader, const char *message_name, int multi_id);
+
+/** @return field definitions of a format ("type name;type name;..."), nullptr if not found */
+const char *ulog_reader_format(const ulog_reader_t *reader, const char *format_name);
+
+/**
+ * Decode fields of a subscription into columns (see px4::ulog::ULogReader::extract()).
+ * @param fields field paths, e.g. "timestamp", "q[0]" or "esc[1].esc_rpm"
+ * @param columns one array per field, each with ulog_reader_subscription_num_samples() values
+ * @return number of samples, -1 if the subscription or a field does not exist
+ */
+int64_t ulog_reader_extract(const ulog_reader_t *reader, int index, const char *const *fields, int num_fields,
+			    double *const *columns, int num_threads);
+
+#ifdef __cplusplus
+}
+#endif
@@ -102,5 +102,120 @@ size_t VariableLengthRingbuffer::pop_front(uint8_t *buf, size_t buf_max_len)
 	size_t bytes_read = _ringbuffer.pop_front(buf, header.len);
 	assert(bytes_read == header.len);
 
+	skip_padding();
+
 	return bytes_read;
 }
+
+uint8_t *VariableLengthRingbuffer::reserve(size_t max_packet_len)
+{
+	if (max_packet_len == 0 || max_packet_len >= PADDING_LEN) {
+		return nullptr;
+	}
+
+	const size_t space_required = max_packet_len + sizeof(Header);
+
+	size_t contiguous_len = 0;
+	uint8_t *ptr = _ringbuffer.write_pointer(contiguous_len);
+
+	if (ptr == nullptr) {
+		return nullptr;
+	}
+
+	if (contiguous_len < space_required) {
+		// The rest of the free space is at the beginning of the buffer.
+		// If the packet fits there, mark the end as unused and continue at the beginning.
+		if (contiguous_len < sizeof(Header)
+		    || _ringbuffer.space_available() - contiguous_len < space_required) {
+			return nullptr;
+		}
+
+		const Header padding{PADDING_LEN};
+		memcpy(ptr, &padding, sizeof(padding));
+		_ringbuffer.commit(contiguous_len);
+
+		ptr = _ringbuffer.write_pointer(contiguous_len);
+
+		if (ptr == nullptr || contiguous_len < space_required) {
+			return nullptr;
+		}
+	}
+
+	_reserved = ptr;
+	_reserved_len = max_packet_len;
+
+	return ptr + sizeof(Header);
+}
+
+bool VariableLengthRingbuffer::commit(size_t packet_len)
+{
+	if (_reserved == nullptr || packet_len > _reserved_len) {
+		return false;
+	}
+
+	uint8_t *ptr = _reserved;
+	_reserved = nullptr;
+	_reserved_len = 0;
+
+	if (packet_len == 0) {
+		return false;
+	}
+
+	const Header header{static_cast<uint32_t>(packet_len)};
+	memcpy(ptr, &header, sizeof(header));
+	_ringbuffer.commit(sizeof(header) + packet_len);
+
+	return true;
+}
+
+const uint8_t *VariableLengthRingbuffer::peek(size_t &packet_len)
+{
+	size_t contiguous_len = 0;
+	const uint8_t *ptr = _ringbuffer.read_pointer(contiguous_len);
+
+	_peeked_len = 0;
+	packet_len = 0;
+
+	if (ptr == nullptr || contiguous_len < sizeof(Header)) {
+		return nullptr;
+	}
+
+	Header header;
+	memcpy(&header, ptr, sizeof(header));
+
+	if (contiguous_len < sizeof(header) + header.len) {
+		// Wraps around, needs to be copied out.
+		return nullptr;
+	}
+
+	_peeked_len = header.len;
+	packet_len = header.len;
+
+	return ptr + sizeof(header);
+}
+
+void VariableLengthRingbuffer::release()
+{
+	if (_peeked_len > 0) {
+		_ringbuffer.release(sizeof(Header) + _peeked_len);
+		_peeked_len = 0;
+
+		skip_padding();
+	}
+}
+
+void VariableLengthRingbuffer::skip_padding()
+{
+	size_t contiguous_len = 0;
+	const uint8_t *ptr = _ringbuffer.read_pointer(contiguous_len);
+
+	if (ptr != nullptr && contiguous_len >= sizeof(Header)) {
+		Header header;
+		memcpy(&header, ptr, sizeof(header));
+
+		if (header.len == PADDING_LEN) {
+			// Padding always covers the rest up to the end of the buffer.
+			_ringbuffer.release(contiguous_len);
+		}
+	}
+}
@@ -102,10 +102,70 @@ public:
 	 */
 	size_t pop_front(uint8_t *buf, size_t max_buf_len);
 
+	/*
+	 * @brief Reserve space for a packet to write into directly
+	 *
+	 * The packet is only added once commit() is called, nothing
+	 * else must be pushed in between.
+	 *
+	 * @note The space has to be contiguous, so this can fail even if
+	 * push_back() of the same length would succeed.
+	 *
+	 * @param max_packet_len Max length of the packet to be written.
+	 *
+	 * @returns pointer to write the packet to, nullptr if there is no space.
+	 */
+	uint8_t *reserve(size_t max_packet_len);
+
+	/*
+	 * @brief Add the packet written into the space returned by reserve()
+	 *
+	 * @param packet_len Length of the packet, at most max_packet_len
+	 * given to reserve(). 0 to drop the reservation.
+	 *
+	 * @returns true if the packet was added.
+	 */
+	bool commit(size_t packet_len);
+
+	/*
+	 * @brief Access next packet in place without removing it
+	 *
+	 * @note Packets added with push_back() can wrap around the end of the
+	 * buffer, in which case they can only be read using pop_front().
+	 * Packets added with reserve() and commit() can always be peeked at.
+	 *
+	 * @param packet_len Returns the length of the packet.
+	 *
+	 * @returns pointer to the packet, nullptr if the buffer is empty
+	 * or the packet is not contiguous.
+	 */
+	const uint8_t *peek(size_t &packet_len);
+
+	/*
+	 * @brief Remove the packet returned by peek()
+	 */
+	void release();
+
+	/*
+	 * @brief Check if there are no packets left
+	 */
+	bool empty() const { return _ringbuffer.space_used() == 0; }
+
 private:
 	struct Header {
 		uint32_t len;
 	};
 
+	// Header length marking the rest up to the end of the buffer as unused,
+	// written by reserve() to keep packets contiguous. It is skipped as soon as
+	// it gets to the front, so the front is always a packet.
+	static constexpr uint32_t PADDING_LEN = UINT32_MAX;
+
+	void skip_padding();
+
 	Ringbuffer _ringbuffer {};
+
+	uint8_t *_reserved{nullptr};
+	size_t _reserved_len{0};
+	size_t _peeked_len{0};
 };
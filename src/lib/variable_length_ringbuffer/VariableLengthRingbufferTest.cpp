@@ -255,3 +255,126 @@ TEST(VariableLengthRingbuffer, EmptyAndNoSpaceForHeader)
 		EXPECT_EQ(data, out);
 	}
 }
+
+TEST(VariableLengthRingbuffer, ReserveAndPeek)
+{
+	VariableLengthRingbuffer buf;
+	ASSERT_TRUE(buf.allocate(100));
+
+	TempData data{20};
+	data.paint();
+
+	// Reserve more than needed and only commit what was written.
+	uint8_t *ptr = buf.reserve(40);
+	ASSERT_NE(ptr, nullptr);
+	memcpy(ptr, data.buf(), data.size());
+	EXPECT_TRUE(buf.commit(data.size()));
+
+	// Nothing to commit anymore.
+	EXPECT_FALSE(buf.commit(data.size()));
+
+	size_t len = 0;
+	const uint8_t *out = buf.peek(len);
+	ASSERT_NE(out, nullptr);
+	EXPECT_EQ(len, data.size());
+	EXPECT_EQ(memcmp(out, data.buf(), len), 0);
+
+	// Peeking again returns the same packet.
+	EXPECT_EQ(buf.peek(len), out);
+	buf.release();
+
+	EXPECT_TRUE(buf.empty());
+	EXPECT_EQ(buf.peek(len), nullptr);
+	EXPECT_EQ(len, 0);
+}
+
+TEST(VariableLengthRingbuffer, ReserveDropped)
+{
+	VariableLengthRingbuffer buf;
+	ASSERT_TRUE(buf.allocate(100));
+
+	ASSERT_NE(buf.reserve(20), nullptr);
+	EXPECT_FALSE(buf.commit(0));
+	EXPECT_TRUE(buf.empty());
+
+	// Can't commit more than reserved.
+	ASSERT_NE(buf.reserve(20), nullptr);
+	EXPECT_FALSE(buf.commit(21));
+	EXPECT_TRUE(buf.empty());
+
+	EXPECT_EQ(buf.reserve(200), nullptr);
+}
+
+TEST(VariableLengthRingbuffer, ReserveWrapsAround)
+{
+	VariableLengthRingbuffer buf;
+	ASSERT_TRUE(buf.allocate(100));
+
+	TempData data1{50};
+	data1.paint();
+	EXPECT_TRUE(buf.push_back(data1.buf(), data1.size()));
+
+	TempData data2{30};
+	data2.paint(42);
+	EXPECT_TRUE(buf.push_back(data2.buf(), data2.size()));
+
+	TempData out1{50};
+	EXPECT_EQ(buf.pop_front(out1.buf(), out1.size()), data1.size());
+
+	// Only 12 bytes left at the end, so this needs to start over at the beginning.
+	TempData data3{40};
+	data3.paint(33);
+	uint8_t *ptr = buf.reserve(data3.size());
+	ASSERT_NE(ptr, nullptr);
+	memcpy(ptr, data3.buf(), data3.size());
+	EXPECT_TRUE(buf.commit(data3.size()));
+
+	// Too big for the space left.
+	EXPECT_EQ(buf.reserve(20), nullptr);
+
+	size_t len = 0;
+	const uint8_t *out = buf.peek(len);
+	ASSERT_NE(out, nullptr);
+	EXPECT_EQ(len, data2.size());
+	EXPECT_EQ(memcmp(out, data2.buf(), len), 0);
+	buf.release();
+
+	// The padding at the end is skipped, also when copying out.
+	TempData out3{40};
+	EXPECT_EQ(buf.pop_front(out3.buf(), out3.size()), data3.size());
+	EXPECT_EQ(data3, out3);
+
+	EXPECT_TRUE(buf.empty());
+}
+
+TEST(VariableLengthRingbuffer, PeekWrappedPacket)
+{
+	VariableLengthRingbuffer buf;
+	ASSERT_TRUE(buf.allocate(100));
+
+	TempData data1{50};
+	data1.paint();
+	EXPECT_TRUE(buf.push_back(data1.buf(), data1.size()));
+
+	TempData data2{30};
+	data2.paint(42);
+	EXPECT_TRUE(buf.push_back(data2.buf(), data2.size()));
+
+	TempData out1{50};
+	EXPECT_EQ(buf.pop_front(out1.buf(), out1.size()), data1.size());
+	TempData out2{30};
+	EXPECT_EQ(buf.pop_front(out2.buf(), out2.size()), data2.size());
+
+	// Pushed across the end of the buffer
+	TempData data3{50};
+	data3.paint(33);
+	EXPECT_TRUE(buf.push_back(data3.buf(), data3.size()));
+
+	size_t len = 0;
+	EXPECT_EQ(buf.peek(len), nullptr);
+	EXPECT_FALSE(buf.empty());
+
+	TempData out3{50};
+	EXPECT_EQ(buf.pop_front(out3.buf(), out3.size()), data3.size());
+	EXPECT_EQ(data3, out3);
+}
@@ -47,6 +47,7 @@
 #include "geo_magnetic_tables.hpp"
 
 #include <mathlib/mathlib.h>
+#include <px4_platform_common/atomic.h>
 
 #include <math.h>
 #include <stdint.h>
@@ -130,3 +131,101 @@ float get_mag_strength_tesla(float lat, float lon)
 {
 	return get_mag_strength_gauss(lat, lon) * 1e-4f; // 1 Gauss == 0.0001 Tesla
 }
+
+namespace
+{
+
+/* bilinear interpolation coefficients of one table cell for declination, inclination and strength */
+struct MagFieldCell {
+	int lat_index{-1};
+	int lon_index{-1};
+	float min_lat{0.f};
+	float min_lon{0.f};
+
+	/* scaled value at the south west corner, change across the cell to the east and north and the cross term */
+	float sw[3] {};
+	float d_lon[3] {};
+	float d_lat[3] {};
+	float d_cross[3] {};
+};
+
+/* shared by all callers (EKF2 instances, calibration), guarded by a sequence count:
+ * odd while a writer updates the cell, readers retry with a local copy if it changed */
+MagFieldCell shared_cell{};
+px4::atomic<uint32_t> shared_cell_sequence{0};
+
+void compute_cell(int lat_index, int lon_index, MagFieldCell &cell)
+{
+	const int16_t (*const tables[3])[LON_DIM] {declination_table, inclination_table, strength_table};
+	static constexpr float scale = 1e-4f; // all tables are stored as 10^-4 radians or Gauss
+
+	cell.lat_index = lat_index;
+	cell.lon_index = lon_index;
+	cell.min_lat = SAMPLING_MIN_LAT + lat_index * SAMPLING_RES;
+	cell.min_lon = SAMPLING_MIN_LON + lon_index * SAMPLING_RES;
+
+	for (int i = 0; i < 3; i++) {
+		const float data_sw = tables[i][lat_index][lon_index] * scale;
+		const float data_se = tables[i][lat_index][lon_index + 1] * scale;
+		const float data_ne = tables[i][lat_index + 1][lon_index + 1] * scale;
+		const float data_nw = tables[i][lat_index + 1][lon_index] * scale;
+
+		cell.sw[i] = data_sw;
+		cell.d_lon[i] = data_se - data_sw;
+		cell.d_lat[i] = data_nw - data_sw;
+		cell.d_cross[i] = data_ne - data_nw - data_se + data_sw;
+	}
+}
+
+} // namespace
+
+void get_mag_field(float lat, float lon, float &declination_rad, float &inclination_rad, float &strength_gauss)
+{
+	lat = math::constrain(lat, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
+
+	if (lon > SAMPLING_MAX_LON) {
+		lon -= 360;
+	}
+
+	if (lon < SAMPLING_MIN_LON) {
+		lon += 360;
+	}
+
+	/* same cell selection as get_table_data() */
+	float min_lat = floorf(lat / SAMPLING_RES) * SAMPLING_RES;
+	float min_lon = floorf(lon / SAMPLING_RES) * SAMPLING_RES;
+	const int lat_index = get_lookup_table_index(&min_lat, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
+	const int lon_index = get_lookup_table_index(&min_lon, SAMPLING_MIN_LON, SAMPLING_MAX_LON);
+
+	MagFieldCell cell;
+	uint32_t sequence = shared_cell_sequence.load();
+	bool valid = false;
+
+	if ((sequence & 1) == 0) {
+		cell = shared_cell;
+		valid = (shared_cell_sequence.load() == sequence);
+	}
+
+	if (!valid || (cell.lat_index != lat_index) || (cell.lon_index != lon_index)) {
+		compute_cell(lat_index, lon_index, cell);
+
+		/* publish the new cell unless another caller is updating it */
+		if (((sequence & 1) == 0) && shared_cell_sequence.compare_exchange(&sequence, sequence + 1)) {
+			shared_cell = cell;
+			shared_cell_sequence.store(sequence + 2);
+		}
+	}
+
+	const float lat_scale = constrain((lat - cell.min_lat) / SAMPLING_RES, 0.f, 1.f);
+	const float lon_scale = constrain((lon - cell.min_lon) / SAMPLING_RES, 0.f, 1.f);
+
+	float value[3];
+
+	for (int i = 0; i < 3; i++) {
+		value[i] = cell.sw[i] + lon_scale * cell.d_lon[i] + lat_scale * (cell.d_lat[i] + lon_scale * cell.d_cross[i]);
+	}
+
+	declination_rad = value[0];
+	inclination_rad = value[1];
+	strength_gauss = value[2];
+}
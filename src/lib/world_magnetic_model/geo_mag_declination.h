@@ -52,3 +52,8 @@ float get_mag_inclination_radians(float lat, float lon);
 // return magnetic field strength in Gauss or Tesla
 float get_mag_strength_gauss(float lat, float lon);
 float get_mag_strength_tesla(float lat, float lon);
+
+// Return declination and inclination in radians and strength in Gauss from one lookup.
+// The interpolation coefficients of the table cell are cached and shared by all callers,
+// they are only recomputed when the position moves into another cell.
+void get_mag_field(float lat, float lon, float &declination_rad, float &inclination_rad, float &strength_gauss);
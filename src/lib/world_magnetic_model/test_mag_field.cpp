@@ -0,0 +1,76 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "geo_mag_declination.h"
+
+TEST(MagFieldTest, matchesSingleLookups)
+{
+	// WHEN: walking across several table cells, the poles and the date line
+	for (float lat = -90.f; lat <= 90.f; lat += 3.7f) {
+		for (float lon = -185.f; lon <= 185.f; lon += 4.3f) {
+			float declination;
+			float inclination;
+			float strength;
+			get_mag_field(lat, lon, declination, inclination, strength);
+
+			// THEN: the cached evaluation gives the same values as the single lookups
+			EXPECT_NEAR(declination, get_mag_declination_radians(lat, lon), 1e-5f) << lat << ", " << lon;
+			EXPECT_NEAR(inclination, get_mag_inclination_radians(lat, lon), 1e-5f) << lat << ", " << lon;
+			EXPECT_NEAR(strength, get_mag_strength_gauss(lat, lon), 1e-5f) << lat << ", " << lon;
+		}
+	}
+}
+
+TEST(MagFieldTest, sameCell)
+{
+	// GIVEN: the field in Zurich
+	float declination;
+	float inclination;
+	float strength;
+	get_mag_field(47.3977f, 8.5456f, declination, inclination, strength);
+
+	// WHEN: moving within the cell and back
+	float declination_moved;
+	float inclination_moved;
+	float strength_moved;
+	get_mag_field(47.40f, 8.55f, declination_moved, inclination_moved, strength_moved);
+	get_mag_field(47.3977f, 8.5456f, declination_moved, inclination_moved, strength_moved);
+
+	// THEN: the result is reproduced exactly
+	EXPECT_EQ(declination, declination_moved);
+	EXPECT_EQ(inclination, inclination_moved);
+	EXPECT_EQ(strength, strength_moved);
+}
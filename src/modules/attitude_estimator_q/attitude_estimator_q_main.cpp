@@ -48,6 +48,7 @@
 #include <lib/parameters/param.h>
 #include <matrix/math.hpp>
 #include <px4_platform_common/defines.h>
+#include <px4_platform_common/getopt.h>
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/posix.h>
@@ -74,7 +75,7 @@ class AttitudeEstimatorQ : public ModuleBase<AttitudeEstimatorQ>, public ModuleP
 {
 public:
 
-	AttitudeEstimatorQ();
+	AttitudeEstimatorQ(bool backup);
 	~AttitudeEstimatorQ() override = default;
 
 	/** @see ModuleBase */
@@ -130,7 +131,7 @@ private:
 	uORB::Subscription _vehicle_mocap_odometry_sub{ORB_ID(vehicle_mocap_odometry)};
 	uORB::Subscription _vehicle_visual_odometry_sub{ORB_ID(vehicle_visual_odometry)};
 
-	uORB::Publication<vehicle_attitude_s> _vehicle_attitude_pub{ORB_ID(vehicle_attitude)};
+	uORB::Publication<vehicle_attitude_s> _vehicle_attitude_pub;
 
 	Vector3f    _accel{};
 	Vector3f    _gyro{};
@@ -157,6 +158,8 @@ private:
 	bool        _ext_hdg_good{false};
 	bool        _initialized{false};
 
+	const bool  _backup;        /**< running next to the main estimator, publishing vehicle_attitude_backup */
+
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::ATT_W_ACC>)       _param_att_w_acc,
 		(ParamFloat<px4::params::ATT_W_MAG>)       _param_att_w_mag,
@@ -171,9 +174,11 @@ private:
 	)
 };
 
-AttitudeEstimatorQ::AttitudeEstimatorQ() :
+AttitudeEstimatorQ::AttitudeEstimatorQ(bool backup) :
 	ModuleParams(nullptr),
-	WorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers)
+	WorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers),
+	_vehicle_attitude_pub(backup ? ORB_ID(vehicle_attitude_backup) : ORB_ID(vehicle_attitude)),
+	_backup(backup)
 {
 	update_parameters(true);
 }
@@ -206,7 +211,12 @@ void AttitudeEstimatorQ::Run()
 		update_visual_odometry();
 		update_motion_capture_odometry();
 		update_gps_position();
-		update_vehicle_local_position();
+
+		// the backup must not depend on the main estimator's outputs
+		if (!_backup) {
+			update_vehicle_local_position();
+		}
+
 		update_vehicle_attitude();
 	}
 }
@@ -465,6 +475,17 @@ bool AttitudeEstimatorQ::update(float dt)
 
 	Quatf q_last = _q;
 
+	// Project 'k' unit vector of earth frame to body frame
+	// Vector3f k = _q.rotateVectorInverse(Vector3f(0.0f, 0.0f, 1.0f));
+	// Optimized version with dropped zeros
+	// _q is kept normalized at the end of every update, the heading corrections below
+	// are about the earth Z axis and reuse k instead of rotating them into the body frame.
+	const Vector3f k(
+		2.0f * (_q(1) * _q(3) - _q(0) * _q(2)),
+		2.0f * (_q(2) * _q(3) + _q(0) * _q(1)),
+		(_q(0) * _q(0) - _q(1) * _q(1) - _q(2) * _q(2) + _q(3) * _q(3))
+	);
+
 	// Angular rate of correction
 	Vector3f corr;
 	float spinRate = _gyro.length();
@@ -476,7 +497,7 @@ bool AttitudeEstimatorQ::update(float dt)
 			Vector3f vision_hdg_earth = _q.rotateVector(_vision_hdg);
 			float vision_hdg_err = wrap_pi(atan2f(vision_hdg_earth(1), vision_hdg_earth(0)));
 			// Project correction to body frame
-			corr += _q.rotateVectorInverse(Vector3f(0.0f, 0.0f, -vision_hdg_err)) * _param_att_w_ext_hdg.get();
+			corr -= k * (vision_hdg_err * _param_att_w_ext_hdg.get());
 		}
 
 		if (_param_att_ext_hdg_m.get() == 2) {
@@ -485,7 +506,7 @@ bool AttitudeEstimatorQ::update(float dt)
 			Vector3f mocap_hdg_earth = _q.rotateVector(_mocap_hdg);
 			float mocap_hdg_err = wrap_pi(atan2f(mocap_hdg_earth(1), mocap_hdg_earth(0)));
 			// Project correction to body frame
-			corr += _q.rotateVectorInverse(Vector3f(0.0f, 0.0f, -mocap_hdg_err)) * _param_att_w_ext_hdg.get();
+			corr -= k * (mocap_hdg_err * _param_att_w_ext_hdg.get());
 		}
 	}
 
@@ -502,29 +523,19 @@ bool AttitudeEstimatorQ::update(float dt)
 		}
 
 		// Project magnetometer correction to body frame
-		corr += _q.rotateVectorInverse(Vector3f(0.0f, 0.0f, -mag_err)) * _param_att_w_mag.get() * gainMult;
+		corr -= k * (mag_err * _param_att_w_mag.get() * gainMult);
 	}
 
-	_q.normalize();
-
-
 	// Accelerometer correction
-	// Project 'k' unit vector of earth frame to body frame
-	// Vector3f k = _q.rotateVectorInverse(Vector3f(0.0f, 0.0f, 1.0f));
-	// Optimized version with dropped zeros
-	Vector3f k(
-		2.0f * (_q(1) * _q(3) - _q(0) * _q(2)),
-		2.0f * (_q(2) * _q(3) + _q(0) * _q(1)),
-		(_q(0) * _q(0) - _q(1) * _q(1) - _q(2) * _q(2) + _q(3) * _q(3))
-	);
-
 	// If we are not using acceleration compensation based on GPS velocity,
 	// fuse accel data only if its norm is close to 1 g (reduces drift).
 	const float accel_norm_sq = _accel.norm_squared();
 	const float upper_accel_limit = CONSTANTS_ONE_G * 1.1f;
 	const float lower_accel_limit = CONSTANTS_ONE_G * 0.9f;
 
-	if (_param_att_acc_comp.get() || ((accel_norm_sq > lower_accel_limit * lower_accel_limit) &&
+	const bool acc_comp = _param_att_acc_comp.get() && !_backup;
+
+	if (acc_comp || ((accel_norm_sq > lower_accel_limit * lower_accel_limit) &&
 					  (accel_norm_sq < upper_accel_limit * upper_accel_limit))) {
 
 		corr += (k % (_accel - _pos_acc).normalized()) * _param_att_w_acc.get();
@@ -583,7 +594,24 @@ int AttitudeEstimatorQ::custom_command(int argc, char *argv[])
 
 int AttitudeEstimatorQ::task_spawn(int argc, char *argv[])
 {
-	AttitudeEstimatorQ *instance = new AttitudeEstimatorQ();
+	bool backup = false;
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "b", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'b':
+			backup = true;
+			break;
+
+		default:
+			print_usage("unrecognized flag");
+			return PX4_ERROR;
+		}
+	}
+
+	AttitudeEstimatorQ *instance = new AttitudeEstimatorQ(backup);
 
 	if (instance) {
 		_object.store(instance);
@@ -615,10 +643,15 @@ int AttitudeEstimatorQ::print_usage(const char *reason)
 ### Description
 Attitude estimator q.
 
+In backup mode it runs next to the main estimator at the same IMU rate (sensor_combined)
+and publishes to vehicle_attitude_backup instead, so a converged attitude is readily available
+if the main estimator has to be switched away from.
+
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("AttitudeEstimatorQ", "estimator");
 	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_PARAM_FLAG('b', "Backup mode, publish vehicle_attitude_backup", true);
 	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
 
 	return 0;
@@ -33,8 +33,6 @@
 
 #include "CameraFeedback.hpp"
 
-using namespace time_literals;
-
 CameraFeedback::CameraFeedback() :
 	ModuleParams(nullptr),
 	WorkItem(MODULE_NAME, px4::wq_configurations::hp_default)
@@ -44,6 +42,15 @@ CameraFeedback::CameraFeedback() :
 	if (_p_cam_cap_fback != PARAM_INVALID) {
 		param_get(_p_cam_cap_fback, (int32_t *)&_cam_cap_fback);
 	}
+
+	param_t p_cam_cap_interp = param_find("CAM_CAP_INTERP");
+	int32_t cam_cap_interp = 0;
+
+	if (p_cam_cap_interp != PARAM_INVALID) {
+		param_get(p_cam_cap_interp, &cam_cap_interp);
+	}
+
+	_interpolate = (cam_cap_interp == 1);
 }
 
 bool
@@ -54,6 +61,12 @@ CameraFeedback::init()
 		return false;
 	}
 
+	// keep the history at the estimator rate
+	if (_interpolate && !_gpos_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
 	_capture_pub.advertise();
 
 	return true;
@@ -64,14 +77,37 @@ CameraFeedback::Run()
 {
 	if (should_exit()) {
 		_trigger_sub.unregisterCallback();
+		_gpos_sub.unregisterCallback();
 		exit_and_cleanup();
 		return;
 	}
 
+	if (_interpolate) {
+		update_history();
+	}
+
 	camera_trigger_s trig{};
 
 	while (_trigger_sub.update(&trig)) {
 
+		if ((_cam_cap_fback >= 1) && !trig.feedback) {
+			// Ignore triggers that are not feedback when camera capture feedback is enabled
+			continue;
+		}
+
+		if (_interpolate) {
+			if (_num_pending_triggers == MAX_PENDING_TRIGGERS) {
+				// too many captures in flight, geotag them now with whatever is available
+				process_pending_triggers(true);
+			}
+
+			if (trig.timestamp != 0) {
+				_pending_triggers[_num_pending_triggers++] = trig;
+			}
+
+			continue;
+		}
+
 		// update geotagging subscriptions
 		vehicle_global_position_s gpos{};
 		_gpos_sub.copy(&gpos);
@@ -87,70 +123,234 @@ CameraFeedback::Run()
 			continue;
 		}
 
-		if ((_cam_cap_fback >= 1) && !trig.feedback) {
-			// Ignore triggers that are not feedback when camera capture feedback is enabled
-			continue;
+		publish_capture(trig, gpos, att, 0);
+	}
+
+	if (_interpolate) {
+		process_pending_triggers();
+	}
+}
+
+void
+CameraFeedback::update_history()
+{
+	vehicle_global_position_s gpos;
+
+	while (_gpos_sub.update(&gpos)) {
+		PositionSample sample{};
+		sample.timestamp_sample = (gpos.timestamp_sample != 0) ? gpos.timestamp_sample : gpos.timestamp;
+		sample.lat = gpos.lat;
+		sample.lon = gpos.lon;
+		sample.alt = gpos.alt;
+		sample.terrain_alt = gpos.terrain_alt;
+		sample.terrain_alt_valid = gpos.terrain_alt_valid;
+		sample.lat_lon_reset_counter = gpos.lat_lon_reset_counter;
+		sample.alt_reset_counter = gpos.alt_reset_counter;
+		_position_history.push(sample);
+	}
+
+	// attitude is published at least as fast as the global position, only the latest is available
+	vehicle_attitude_s att;
+
+	if (_att_sub.update(&att)) {
+		AttitudeSample sample{};
+		sample.timestamp_sample = (att.timestamp_sample != 0) ? att.timestamp_sample : att.timestamp;
+
+		for (int i = 0; i < 4; i++) {
+			sample.q[i] = att.q[i];
 		}
 
-		camera_capture_s capture{};
+		sample.quat_reset_counter = att.quat_reset_counter;
+		_attitude_history.push(sample);
+	}
+}
 
-		// Fill timestamps
-		capture.timestamp = trig.timestamp;
-		capture.timestamp_utc = trig.timestamp_utc;
+void
+CameraFeedback::process_pending_triggers(bool force)
+{
+	const hrt_abstime now = hrt_absolute_time();
 
-		// Fill image sequence
-		capture.seq = trig.seq;
+	while (_num_pending_triggers > 0) {
+		const camera_trigger_s &trig = _pending_triggers[0];
 
-		// Fill position data
-		capture.lat = gpos.lat;
-		capture.lon = gpos.lon;
-		capture.alt = gpos.alt;
+		const bool samples_after_capture = !_position_history.empty() && !_attitude_history.empty()
+						   && (_position_history.newest().timestamp_sample >= trig.timestamp)
+						   && (_attitude_history.newest().timestamp_sample >= trig.timestamp);
 
-		if (gpos.terrain_alt_valid) {
-			capture.ground_distance = gpos.alt - gpos.terrain_alt;
+		if (!force && !samples_after_capture && (now < trig.timestamp + MAX_INTERPOLATION_WAIT)) {
+			// wait for the estimator to catch up with the capture
+			break;
+		}
+
+		vehicle_global_position_s gpos{};
+		vehicle_attitude_s att{};
+		uint32_t interpolation_gap_us = 0;
+
+		if (interpolate(trig.timestamp, gpos, att, interpolation_gap_us)) {
+			_interpolated_count++;
+			_interpolation_gap_sum_us += interpolation_gap_us;
+			_interpolation_gap_max_us = math::max(_interpolation_gap_max_us, interpolation_gap_us);
 
 		} else {
-			capture.ground_distance = -1.0f;
+			// fall back to the latest estimate
+			_gpos_sub.copy(&gpos);
+			_att_sub.copy(&att);
+			_not_interpolated_count++;
 		}
 
-		// Fill attitude data
-		gimbal_device_attitude_status_s gimbal{};
-
-		if (_gimbal_sub.copy(&gimbal) && (hrt_elapsed_time(&gimbal.timestamp) < 1_s)) {
-			if (gimbal.device_flags & gimbal_device_attitude_status_s::DEVICE_FLAGS_YAW_LOCK) {
-				// Gimbal yaw angle is absolute angle relative to North
-				capture.q[0] = gimbal.q[0];
-				capture.q[1] = gimbal.q[1];
-				capture.q[2] = gimbal.q[2];
-				capture.q[3] = gimbal.q[3];
-
-			} else {
-				// Gimbal quaternion frame is in the Earth frame rotated so that the x-axis is pointing
-				// forward (yaw relative to vehicle). Get heading from the vehicle attitude and combine it
-				// with the gimbal orientation.
-				const matrix::Eulerf euler_vehicle(matrix::Quatf(att.q));
-				const matrix::Quatf q_heading(matrix::Eulerf(0.0f, 0.0f, euler_vehicle(2)));
-				matrix::Quatf q_gimbal(gimbal.q);
-				q_gimbal = q_heading * q_gimbal;
-
-				capture.q[0] = q_gimbal(0);
-				capture.q[1] = q_gimbal(1);
-				capture.q[2] = q_gimbal(2);
-				capture.q[3] = q_gimbal(3);
-			}
+		if (gpos.timestamp != 0 && att.timestamp != 0) {
+			publish_capture(trig, gpos, att, interpolation_gap_us);
+		}
 
-		} else {
-			// No gimbal orientation, use vehicle attitude
-			capture.q[0] = att.q[0];
-			capture.q[1] = att.q[1];
-			capture.q[2] = att.q[2];
-			capture.q[3] = att.q[3];
+		_num_pending_triggers--;
+
+		for (int i = 0; i < _num_pending_triggers; i++) {
+			_pending_triggers[i] = _pending_triggers[i + 1];
 		}
+	}
+}
 
-		capture.result = 1;
+bool
+CameraFeedback::interpolate(hrt_abstime timestamp, vehicle_global_position_s &gpos, vehicle_attitude_s &att,
+			    uint32_t &gap_us) const
+{
+	const PositionSample *pos_before = nullptr;
+	const PositionSample *pos_after = nullptr;
+	const AttitudeSample *att_before = nullptr;
+	const AttitudeSample *att_after = nullptr;
+
+	if ((timestamp == 0)
+	    || !_position_history.find(timestamp, pos_before, pos_after)
+	    || !_attitude_history.find(timestamp, att_before, att_after)) {
+		return false;
+	}
+
+	// position, linear in latitude/longitude is accurate enough over a few estimator samples
+	const hrt_abstime pos_dt = pos_after->timestamp_sample - pos_before->timestamp_sample;
+	const float pos_alpha = (float)(timestamp - pos_before->timestamp_sample) / (float)pos_dt;
+
+	// never interpolate across an estimator reset, take the closest sample instead
+	const PositionSample &pos_nearest = (pos_alpha < 0.5f) ? *pos_before : *pos_after;
+	const bool lat_lon_reset = (pos_before->lat_lon_reset_counter != pos_after->lat_lon_reset_counter);
+	const bool alt_reset = (pos_before->alt_reset_counter != pos_after->alt_reset_counter);
+
+	gpos.timestamp = timestamp;
+	gpos.timestamp_sample = timestamp;
+
+	if (lat_lon_reset) {
+		gpos.lat = pos_nearest.lat;
+		gpos.lon = pos_nearest.lon;
+
+	} else {
+		gpos.lat = pos_before->lat + (double)pos_alpha * (pos_after->lat - pos_before->lat);
+		gpos.lon = pos_before->lon + (double)pos_alpha * (pos_after->lon - pos_before->lon);
+	}
+
+	if (alt_reset) {
+		gpos.alt = pos_nearest.alt;
+		gpos.terrain_alt = pos_nearest.terrain_alt;
+		gpos.terrain_alt_valid = pos_nearest.terrain_alt_valid;
+
+	} else {
+		gpos.alt = math::lerp(pos_before->alt, pos_after->alt, pos_alpha);
+		gpos.terrain_alt = math::lerp(pos_before->terrain_alt, pos_after->terrain_alt, pos_alpha);
+		gpos.terrain_alt_valid = pos_before->terrain_alt_valid && pos_after->terrain_alt_valid;
+	}
+
+	// attitude, normalized linear quaternion interpolation (the samples are only a few ms apart)
+	const hrt_abstime att_dt = att_after->timestamp_sample - att_before->timestamp_sample;
+	const float att_alpha = (float)(timestamp - att_before->timestamp_sample) / (float)att_dt;
+
+	const matrix::Quatf q_before(att_before->q);
+	matrix::Quatf q_after(att_after->q);
+	matrix::Quatf q;
+
+	if (att_before->quat_reset_counter != att_after->quat_reset_counter) {
+		q = (att_alpha < 0.5f) ? q_before : q_after;
+
+	} else {
+		// take the shortest path
+		if (q_before.dot(q_after) < 0.f) {
+			q_after = -q_after;
+		}
+
+		q = q_before * (1.f - att_alpha) + q_after * att_alpha;
+		q.normalize();
+	}
+
+	att.timestamp = timestamp;
+	att.timestamp_sample = timestamp;
+	q.copyTo(att.q);
+
+	gap_us = (uint32_t)math::max(pos_dt, att_dt);
+
+	return true;
+}
+
+void
+CameraFeedback::publish_capture(const camera_trigger_s &trig, const vehicle_global_position_s &gpos,
+				const vehicle_attitude_s &att, uint32_t interpolation_gap_us)
+{
+	camera_capture_s capture{};
+
+	// Fill timestamps
+	capture.timestamp = trig.timestamp;
+	capture.timestamp_utc = trig.timestamp_utc;
+
+	// Fill image sequence
+	capture.seq = trig.seq;
+
+	// Fill position data
+	capture.lat = gpos.lat;
+	capture.lon = gpos.lon;
+	capture.alt = gpos.alt;
+
+	if (gpos.terrain_alt_valid) {
+		capture.ground_distance = gpos.alt - gpos.terrain_alt;
+
+	} else {
+		capture.ground_distance = -1.0f;
+	}
+
+	// Fill attitude data
+	gimbal_device_attitude_status_s gimbal{};
 
-		_capture_pub.publish(capture);
+	if (_gimbal_sub.copy(&gimbal) && (hrt_elapsed_time(&gimbal.timestamp) < 1_s)) {
+		if (gimbal.device_flags & gimbal_device_attitude_status_s::DEVICE_FLAGS_YAW_LOCK) {
+			// Gimbal yaw angle is absolute angle relative to North
+			capture.q[0] = gimbal.q[0];
+			capture.q[1] = gimbal.q[1];
+			capture.q[2] = gimbal.q[2];
+			capture.q[3] = gimbal.q[3];
+
+		} else {
+			// Gimbal quaternion frame is in the Earth frame rotated so that the x-axis is pointing
+			// forward (yaw relative to vehicle). Get heading from the vehicle attitude and combine it
+			// with the gimbal orientation.
+			const matrix::Eulerf euler_vehicle(matrix::Quatf(att.q));
+			const matrix::Quatf q_heading(matrix::Eulerf(0.0f, 0.0f, euler_vehicle(2)));
+			matrix::Quatf q_gimbal(gimbal.q);
+			q_gimbal = q_heading * q_gimbal;
+
+			capture.q[0] = q_gimbal(0);
+			capture.q[1] = q_gimbal(1);
+			capture.q[2] = q_gimbal(2);
+			capture.q[3] = q_gimbal(3);
+		}
+
+	} else {
+		// No gimbal orientation, use vehicle attitude
+		capture.q[0] = att.q[0];
+		capture.q[1] = att.q[1];
+		capture.q[2] = att.q[2];
+		capture.q[3] = att.q[3];
 	}
+
+	capture.interpolation_gap_us = interpolation_gap_us;
+
+	capture.result = 1;
+
+	_capture_pub.publish(capture);
 }
 
 int
@@ -177,6 +377,23 @@ CameraFeedback::task_spawn(int argc, char *argv[])
 	return PX4_ERROR;
 }
 
+int
+CameraFeedback::print_status()
+{
+	PX4_INFO("geotag interpolation: %s", _interpolate ? "enabled" : "disabled");
+
+	if (_interpolate) {
+		PX4_INFO("interpolated: %" PRIu32 ", latest estimate: %" PRIu32, _interpolated_count, _not_interpolated_count);
+
+		if (_interpolated_count > 0) {
+			PX4_INFO("sample gap mean: %" PRIu64 " us, max: %" PRIu32 " us",
+				 _interpolation_gap_sum_us / _interpolated_count, _interpolation_gap_max_us);
+		}
+	}
+
+	return 0;
+}
+
 int
 CameraFeedback::custom_command(int argc, char *argv[])
 {
@@ -57,6 +57,10 @@
 #include <uORB/topics/vehicle_global_position.h>
 #include <uORB/topics/gimbal_device_attitude_status.h>
 
+#include "PoseHistory.hpp"
+
+using namespace time_literals;
+
 class CameraFeedback : public ModuleBase<CameraFeedback>, public ModuleParams, public px4::WorkItem
 {
 public:
@@ -74,13 +78,60 @@ public:
 
 	bool init();
 
+	/** @see ModuleBase::print_status() */
+	int print_status() override;
+
 private:
 
+	struct PositionSample {
+		hrt_abstime timestamp_sample;
+		double lat;
+		double lon;
+		float alt;
+		float terrain_alt;
+		bool terrain_alt_valid;
+		uint8_t lat_lon_reset_counter;
+		uint8_t alt_reset_counter;
+	};
+
+	struct AttitudeSample {
+		hrt_abstime timestamp_sample;
+		float q[4];
+		uint8_t quat_reset_counter;
+	};
+
 	void Run() override;
 
+	void update_history();
+
+	/**
+	 * Publish the captures once the estimator history covers them
+	 * @param force don't wait for newer estimator samples
+	 */
+	void process_pending_triggers(bool force = false);
+
+	/**
+	 * Interpolate the estimator samples to the capture time
+	 * @return false if the capture time is not covered by the history
+	 */
+	bool interpolate(hrt_abstime timestamp, vehicle_global_position_s &gpos, vehicle_attitude_s &att,
+			 uint32_t &gap_us) const;
+
+	void publish_capture(const camera_trigger_s &trig, const vehicle_global_position_s &gpos,
+			     const vehicle_attitude_s &att, uint32_t interpolation_gap_us);
+
+	// estimator samples at full rate, enough to cover the trigger processing delay
+	static constexpr size_t HISTORY_SIZE = 32;
+
+	// maximum time to wait for estimator samples newer than the capture
+	static constexpr hrt_abstime MAX_INTERPOLATION_WAIT = 100_ms;
+
+	static constexpr int MAX_PENDING_TRIGGERS = 4;
+
 	uORB::SubscriptionCallbackWorkItem _trigger_sub{this, ORB_ID(camera_trigger)};
 
-	uORB::Subscription	_gpos_sub{ORB_ID(vehicle_global_position)};
+	// only used to schedule if the geotag is interpolated (CAM_CAP_INTERP)
+	uORB::SubscriptionCallbackWorkItem _gpos_sub{this, ORB_ID(vehicle_global_position)};
 	uORB::Subscription	_att_sub{ORB_ID(vehicle_attitude)};
 	uORB::Subscription	_gimbal_sub{ORB_ID(gimbal_device_attitude_status)};
 
@@ -88,4 +139,18 @@ private:
 
 	param_t _p_cam_cap_fback;
 	int32_t _cam_cap_fback{0};
+
+	bool _interpolate{false};
+
+	camera_feedback::PoseHistory<PositionSample, HISTORY_SIZE> _position_history{};
+	camera_feedback::PoseHistory<AttitudeSample, HISTORY_SIZE> _attitude_history{};
+
+	camera_trigger_s _pending_triggers[MAX_PENDING_TRIGGERS] {};
+	int _num_pending_triggers{0};
+
+	// interpolation gap statistics
+	uint32_t _interpolated_count{0};
+	uint32_t _not_interpolated_count{0};
+	uint64_t _interpolation_gap_sum_us{0};
+	uint32_t _interpolation_gap_max_us{0};
 };
@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file PoseHistory.hpp
+ *
+ * Short history of estimator samples to interpolate the geotag to the exact capture time.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <stddef.h>
+
+namespace camera_feedback
+{
+
+template<typename T, size_t SIZE>
+class PoseHistory
+{
+public:
+	void push(const T &sample)
+	{
+		if ((_count > 0) && (sample.timestamp_sample <= newest().timestamp_sample)) {
+			// samples have to be in order, drop duplicates
+			return;
+		}
+
+		_buffer[_head] = sample;
+		_head = (_head + 1) % SIZE;
+
+		if (_count < SIZE) {
+			_count++;
+		}
+	}
+
+	void reset() { _count = 0; }
+
+	bool empty() const { return _count == 0; }
+
+	const T &newest() const { return _buffer[(_head + SIZE - 1) % SIZE]; }
+
+	/**
+	 * Find the samples right before and after a timestamp.
+	 * @return false if the timestamp is outside the history
+	 */
+	bool find(hrt_abstime timestamp, const T *&before, const T *&after) const
+	{
+		// start looking from the newest sample
+		for (size_t i = 1; i < _count; i++) {
+			const T &newer = _buffer[(_head + SIZE - i) % SIZE];
+			const T &older = _buffer[(_head + SIZE - i - 1) % SIZE];
+
+			if (older.timestamp_sample <= timestamp && timestamp <= newer.timestamp_sample) {
+				before = &older;
+				after = &newer;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+private:
+	T _buffer[SIZE] {};
+	size_t _head{0};
+	size_t _count{0};
+};
+
+} // namespace camera_feedback
@@ -1386,7 +1386,29 @@ Commander::handle_command(const vehicle_command_s &cmd)
 
 	case vehicle_command_s::VEHICLE_CMD_PREFLIGHT_STORAGE: {
 
-			if (isArmed() || _worker_thread.isBusy()) {
+#if defined(CONFIG_COMMANDER_STORAGE_WORKER)
+
+			if (!isArmed() && (((int)(cmd.param1)) == 1)) {
+				// saves don't conflict with a running calibration, queue one more if a save is already running
+				answer_command(cmd, vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED);
+
+				if (_storage_worker_thread.isBusy()) {
+					_param_save_pending = true;
+
+				} else {
+					_storage_worker_thread.startTask(WorkerThread::Request::ParamSaveDefault);
+				}
+
+				break;
+			}
+
+			// loads and resets overwrite the parameters of a running calibration or save
+			const bool worker_busy = _worker_thread.isBusy() || _storage_worker_thread.isBusy();
+#else
+			const bool worker_busy = _worker_thread.isBusy();
+#endif // CONFIG_COMMANDER_STORAGE_WORKER
+
+			if (isArmed() || worker_busy) {
 
 				// reject if armed or shutting down
 				answer_command(cmd, vehicle_command_ack_s::VEHICLE_CMD_RESULT_TEMPORARILY_REJECTED);
@@ -2206,6 +2228,19 @@ void Commander::updateTunes()
 
 void Commander::checkWorkerThread()
 {
+#if defined(CONFIG_COMMANDER_STORAGE_WORKER)
+
+	if (_storage_worker_thread.hasResult()) {
+		_storage_worker_thread.getResultAndReset();
+
+		if (_param_save_pending) {
+			_param_save_pending = false;
+			_storage_worker_thread.startTask(WorkerThread::Request::ParamSaveDefault);
+		}
+	}
+
+#endif // CONFIG_COMMANDER_STORAGE_WORKER
+
 	// check if the worker has finished
 	if (_worker_thread.hasResult()) {
 		int ret = _worker_thread.getResultAndReset();
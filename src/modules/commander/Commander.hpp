@@ -223,6 +223,10 @@ private:
 	MulticopterThrowLaunch  _multicopter_throw_launch{this};
 	Safety			_safety{};
 	WorkerThread 		_worker_thread{};
+#if defined(CONFIG_COMMANDER_STORAGE_WORKER)
+	WorkerThread 		_storage_worker_thread{}; ///< parameter saves, concurrently to the calibrations
+	bool			_param_save_pending{false};
+#endif // CONFIG_COMMANDER_STORAGE_WORKER
 	ModeManagement  	_mode_management{
 #ifndef CONSTRAINED_FLASH
 		_health_and_arming_checks.externalChecks()
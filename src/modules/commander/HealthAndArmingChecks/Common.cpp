@@ -283,22 +283,25 @@ bool Report::report(bool is_armed, bool force)
 		       (navigation_mode_group_t)current_results.arming_checks.can_run);
 
 	// send all events
-	int offset = 0;
-	events::EventType event;
-
-	for (int i = 0; i < max_num_events && offset < _next_buffer_idx; ++i) {
-		EventBufferHeader *header = (EventBufferHeader *)(_event_buffer + offset);
-		memcpy(&event.id, &header->id, sizeof(event.id));
-		event.log_levels = header->log_levels;
-		memcpy(event.arguments, _event_buffer + offset + sizeof(EventBufferHeader), header->size);
-		memset(event.arguments + header->size, 0, sizeof(event.arguments) - header->size);
-		events::send(event);
-		offset += sizeof(EventBufferHeader) + header->size;
+	{
+		int offset = 0;
+		events::EventType event;
+		events::Batch batch;
+
+		for (int i = 0; i < max_num_events && offset < _next_buffer_idx; ++i) {
+			EventBufferHeader *header = (EventBufferHeader *)(_event_buffer + offset);
+			memcpy(&event.id, &header->id, sizeof(event.id));
+			event.log_levels = header->log_levels;
+			memcpy(event.arguments, _event_buffer + offset + sizeof(EventBufferHeader), header->size);
+			memset(event.arguments + header->size, 0, sizeof(event.arguments) - header->size);
+			batch.send(event);
+			offset += sizeof(EventBufferHeader) + header->size;
 #ifdef CONSOLE_PRINT_ARMING_CHECK_EVENT
-		const char *message;
-		memcpy(&message, &header->message, sizeof(header->message));
-		PX4_INFO_RAW("   Event 0x%08" PRIx32 ": %s\n", event.id, message);
+			const char *message;
+			memcpy(&message, &header->message, sizeof(header->message));
+			PX4_INFO_RAW("   Event 0x%08" PRIx32 ": %s\n", event.id, message);
 #endif
+		}
 	}
 
 	// send health summary
@@ -203,9 +203,41 @@ bool FailureDetector::update(const vehicle_status_s &vehicle_status, const vehic
 		updateImbalancedPropStatus();
 	}
 
+	updateRateResidualStatus(vehicle_status, vehicle_control_mode);
+
 	return _status.value != status_prev.value;
 }
 
+void FailureDetector::updateRateResidualStatus(const vehicle_status_s &vehicle_status,
+		const vehicle_control_mode_s &vehicle_control_mode)
+{
+	if (_param_fd_rate_en.get() != _rate_residual_detector_running) {
+		if (_param_fd_rate_en.get()) {
+			_rate_residual_detector_running = _rate_residual_detector.start();
+
+		} else {
+			_rate_residual_detector.stop();
+			_rate_residual_detector_running = false;
+		}
+	}
+
+	_rate_residual_detector.setActive(vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED
+					  && vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING
+					  && vehicle_control_mode.flag_control_rates_enabled);
+
+	// latched in the detector until disarm, combined with the ESC based motor failure detection
+	const bool rate_residual_failure = _rate_residual_detector_running && _rate_residual_detector.anomalyDetected();
+
+	if (rate_residual_failure) {
+		_status.flags.motor = true;
+
+	} else if (_rate_residual_failure) {
+		_status.flags.motor = (_motor_failure_esc_timed_out_mask != 0 || _motor_failure_esc_under_current_mask != 0);
+	}
+
+	_rate_residual_failure = rate_residual_failure;
+}
+
 void FailureDetector::updateAttitudeStatus(const vehicle_status_s &vehicle_status)
 {
 	vehicle_attitude_s attitude;
@@ -46,6 +46,7 @@
 #include <lib/hysteresis/hysteresis.h>
 #include <lib/mathlib/mathlib.h>
 #include <lib/mathlib/math/filter/AlphaFilter.hpp>
+#include "RateResidualDetector.hpp"
 #include <matrix/matrix/math.hpp>
 #include <px4_platform_common/module_params.h>
 
@@ -112,6 +113,7 @@ private:
 	void updateEscsStatus(const vehicle_status_s &vehicle_status, const esc_status_s &esc_status);
 	void updateMotorStatus(const vehicle_status_s &vehicle_status, const esc_status_s &esc_status);
 	void updateImbalancedPropStatus();
+	void updateRateResidualStatus(const vehicle_status_s &vehicle_status, const vehicle_control_mode_s &vehicle_control_mode);
 
 	failure_detector_status_u _status{};
 
@@ -141,6 +143,10 @@ private:
 
 	FailureInjector _failure_injector;
 
+	RateResidualDetector _rate_residual_detector{this};
+	bool _rate_residual_detector_running{false};
+	bool _rate_residual_failure{false};
+
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::FD_FAIL_P>) _param_fd_fail_p,
 		(ParamInt<px4::params::FD_FAIL_R>) _param_fd_fail_r,
@@ -155,6 +161,9 @@ private:
 		(ParamBool<px4::params::FD_ACT_EN>) _param_fd_actuator_en,
 		(ParamFloat<px4::params::FD_ACT_MOT_THR>) _param_fd_motor_throttle_thres,
 		(ParamFloat<px4::params::FD_ACT_MOT_C2T>) _param_fd_motor_current2throttle_thres,
-		(ParamInt<px4::params::FD_ACT_MOT_TOUT>) _param_fd_motor_time_thres
+		(ParamInt<px4::params::FD_ACT_MOT_TOUT>) _param_fd_motor_time_thres,
+
+		// Rate tracking residual
+		(ParamBool<px4::params::FD_RATE_EN>) _param_fd_rate_en
 	)
 };
@@ -0,0 +1,151 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "RateResidualDetector.hpp"
+
+using namespace time_literals;
+
+RateResidualDetector::RateResidualDetector(ModuleParams *parent) :
+	ModuleParams(parent),
+	WorkItem(MODULE_NAME"_rate_residual", px4::wq_configurations::nav_and_controllers)
+{
+}
+
+RateResidualDetector::~RateResidualDetector()
+{
+	stop();
+	perf_free(_cycle_perf);
+}
+
+bool RateResidualDetector::start()
+{
+	// 200 Hz is plenty for a detection latency of tens of ms
+	_vehicle_angular_velocity_sub.set_interval_us(5_ms);
+	return _vehicle_angular_velocity_sub.registerCallback();
+}
+
+void RateResidualDetector::stop()
+{
+	_vehicle_angular_velocity_sub.unregisterCallback();
+	reset();
+}
+
+void RateResidualDetector::reset()
+{
+	_cusum = 0.f;
+	_last_sample = 0;
+	_anomaly.store(false);
+}
+
+void RateResidualDetector::Run()
+{
+	perf_begin(_cycle_perf);
+
+	if (_parameter_update_sub.updated()) {
+		parameter_update_s param_update;
+		_parameter_update_sub.copy(&param_update);
+		updateParams();
+	}
+
+	vehicle_angular_velocity_s angular_velocity;
+
+	if (!_vehicle_angular_velocity_sub.update(&angular_velocity)) {
+		perf_end(_cycle_perf);
+		return;
+	}
+
+	if (!_active.load()) {
+		reset();
+		perf_end(_cycle_perf);
+		return;
+	}
+
+	vehicle_rates_setpoint_s rates_setpoint;
+
+	if (!_vehicle_rates_setpoint_sub.copy(&rates_setpoint)
+	    || (angular_velocity.timestamp_sample > rates_setpoint.timestamp + 50_ms)) {
+		// no rate controller output to compare against
+		_cusum = 0.f;
+		_last_sample = 0;
+		perf_end(_cycle_perf);
+		return;
+	}
+
+	const float dt = (_last_sample > 0) ? math::constrain((angular_velocity.timestamp_sample - _last_sample) * 1e-6f, 0.f,
+			 0.02f) : 0.f;
+	_last_sample = angular_velocity.timestamp_sample;
+
+	const float residual = matrix::Vector2f(rates_setpoint.roll - angular_velocity.xyz[0],
+						rates_setpoint.pitch - angular_velocity.xyz[1]).norm();
+
+	// a lost motor drives the remaining ones into saturation while the controller fails to track the setpoint
+	bool motors_saturated = false;
+	actuator_motors_s actuator_motors;
+
+	if (_actuator_motors_sub.copy(&actuator_motors)) {
+		for (int i = 0; i < actuator_motors_s::NUM_CONTROLS; i++) {
+			if (PX4_ISFINITE(actuator_motors.control[i]) && (actuator_motors.control[i] >= MOTOR_SATURATION)) {
+				motors_saturated = true;
+				break;
+			}
+		}
+	}
+
+	// learn the nominal tracking error only outside of excursions
+	if (_cusum <= 0.f) {
+		_residual_stats.update(residual);
+	}
+
+	float baseline = 0.f;
+
+	if (_residual_stats.valid()) {
+		baseline = _residual_stats.mean() + BASELINE_SIGMA * _residual_stats.standard_deviation();
+	}
+
+	float excess = residual - baseline - _param_fd_rate_slack.get();
+
+	if (!motors_saturated) {
+		// without saturation the controller still has authority, only let the statistic decay
+		excess = math::min(excess, 0.f);
+	}
+
+	_cusum = math::max(_cusum + excess * dt, 0.f);
+
+	if ((_cusum > _param_fd_rate_thr.get()) && !_anomaly.load()) {
+		_anomaly.store(true);
+		PX4_WARN("rate tracking lost with saturated motors (residual %.2f rad/s)", (double)residual);
+	}
+
+	perf_end(_cycle_perf);
+}
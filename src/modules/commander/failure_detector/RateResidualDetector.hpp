@@ -0,0 +1,106 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file RateResidualDetector.hpp
+ *
+ * High-rate actuator failure detection from the residual between the commanded
+ * and the achieved roll/pitch rate. Runs on its own work item so that a motor
+ * failure is flagged within tens of milliseconds instead of at the commander rate.
+ *
+ * The residual baseline (mean and spread) is learned online with a Welford
+ * estimator, and a one-sided CUSUM integrates the excess over the baseline
+ * while the motors are saturated.
+ */
+
+#pragma once
+
+#include <lib/mathlib/math/WelfordMean.hpp>
+#include <lib/perf/perf_counter.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/module_params.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/actuator_motors.h>
+#include <uORB/topics/parameter_update.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_rates_setpoint.h>
+
+class RateResidualDetector : public ModuleParams, public px4::WorkItem
+{
+public:
+	RateResidualDetector(ModuleParams *parent);
+	~RateResidualDetector() override;
+
+	bool start();
+	void stop();
+
+	/**
+	 * Enable the detection (armed multicopter in rate controlled flight),
+	 * deactivating it clears the detected anomaly.
+	 */
+	void setActive(bool active) { _active.store(active); }
+
+	bool anomalyDetected() const { return _anomaly.load(); }
+
+private:
+	void Run() override;
+
+	void reset();
+
+	static constexpr float MOTOR_SATURATION = 0.95f; ///< normalized motor command considered saturated
+	static constexpr float BASELINE_SIGMA = 3.f;     ///< residual spread accepted on top of the mean
+
+	uORB::SubscriptionCallbackWorkItem _vehicle_angular_velocity_sub{this, ORB_ID(vehicle_angular_velocity)};
+
+	uORB::Subscription _actuator_motors_sub{ORB_ID(actuator_motors)};
+	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
+	uORB::Subscription _vehicle_rates_setpoint_sub{ORB_ID(vehicle_rates_setpoint)};
+
+	math::WelfordMean<float> _residual_stats{};
+
+	float _cusum{0.f};                ///< integrated residual excess (rad)
+	hrt_abstime _last_sample{0};
+
+	px4::atomic_bool _active{false};
+	px4::atomic_bool _anomaly{false};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": rate residual")};
+
+	DEFINE_PARAMETERS(
+		(ParamFloat<px4::params::FD_RATE_SLACK>) _param_fd_rate_slack,
+		(ParamFloat<px4::params::FD_RATE_THR>) _param_fd_rate_thr
+	)
+};
@@ -212,3 +212,46 @@ PARAM_DEFINE_FLOAT(FD_ACT_MOT_C2T, 2.0f);
  * @increment 100
  */
 PARAM_DEFINE_INT32(FD_ACT_MOT_TOUT, 100);
+
+/**
+ * Enable rate tracking failure detection
+ *
+ * Runs at up to 200 Hz and compares the roll/pitch rate setpoint with the
+ * measured rate. A motor failure is flagged when the residual exceeds its learned
+ * baseline by more than FD_RATE_SLACK while the motors are saturated, integrated
+ * over time up to FD_RATE_THR. Multicopter only.
+ *
+ * @group Failure Detector
+ * @boolean
+ */
+PARAM_DEFINE_INT32(FD_RATE_EN, 0);
+
+/**
+ * Rate tracking failure slack
+ *
+ * Rate residual on top of the learned baseline that is tolerated without
+ * accumulating towards a failure.
+ *
+ * @group Failure Detector
+ * @unit rad/s
+ * @min 0.0
+ * @max 5.0
+ * @decimal 2
+ * @increment 0.1
+ */
+PARAM_DEFINE_FLOAT(FD_RATE_SLACK, 0.5f);
+
+/**
+ * Rate tracking failure threshold
+ *
+ * Integrated rate residual excess at which a motor failure is flagged.
+ * E.g. with a residual excess of 2 rad/s the default triggers after 50 ms.
+ *
+ * @group Failure Detector
+ * @unit rad
+ * @min 0.01
+ * @max 1.0
+ * @decimal 2
+ * @increment 0.01
+ */
+PARAM_DEFINE_FLOAT(FD_RATE_THR, 0.1f);
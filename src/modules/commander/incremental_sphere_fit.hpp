@@ -0,0 +1,167 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file incremental_sphere_fit.hpp
+ *
+ * Streaming linear sphere fit used to give live feedback during the magnetometer calibration.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <matrix/matrix/math.hpp>
+#include <px4_platform_common/defines.h>
+
+/**
+ * Linear least-squares sphere fit that is updated one sample at a time.
+ *
+ * The sphere |p - c|^2 = r^2 is rewritten as the linear model
+ * x^2 + y^2 + z^2 = 2 c_x x + 2 c_y y + 2 c_z z + (r^2 - |c|^2),
+ * so only the 4x4 normal equations have to be accumulated and the memory
+ * use does not depend on the number of samples.
+ *
+ * It also records which directions (relative to the current center estimate)
+ * have been seen, split into 24 bins: 6 cube faces with 4 quadrants each.
+ */
+class IncrementalSphereFit
+{
+public:
+	static constexpr uint8_t COVERAGE_BINS = 24;
+
+	void reset()
+	{
+		_ata.setZero();
+		_atb.setZero();
+		_samples = 0;
+		_coverage = 0;
+		_valid = false;
+	}
+
+	void update(const matrix::Vector3f &sample)
+	{
+		const double phi[4] {(double)sample(0), (double)sample(1), (double)sample(2), 1.0};
+		const double t = (double)sample.norm_squared();
+
+		for (int i = 0; i < 4; i++) {
+			for (int j = i; j < 4; j++) {
+				_ata(i, j) += phi[i] * phi[j];
+				_ata(j, i) = _ata(i, j);
+			}
+
+			_atb(i) += phi[i] * t;
+		}
+
+		_samples++;
+
+		// the system is underdetermined until at least 4 non coplanar samples are in
+		if (_samples >= 4) {
+			solve();
+		}
+
+		if (_valid) {
+			_coverage |= (uint32_t)1 << bin(sample - _center);
+		}
+	}
+
+	bool valid() const { return _valid; }
+	uint32_t samples() const { return _samples; }
+
+	const matrix::Vector3f &center() const { return _center; }
+	float radius() const { return _radius; }
+
+	/**
+	 * @return percentage of the direction bins that contain at least one sample
+	 */
+	uint8_t coverage_percentage() const
+	{
+		unsigned bins = 0;
+
+		for (uint32_t c = _coverage; c != 0; c &= c - 1) {
+			bins++;
+		}
+
+		return (uint8_t)(100 * bins / COVERAGE_BINS);
+	}
+
+private:
+	void solve()
+	{
+		matrix::SquareMatrix<double, 4> ata_inv;
+
+		if (!matrix::inv(_ata, ata_inv)) {
+			_valid = false;
+			return;
+		}
+
+		const matrix::Vector<double, 4> p = ata_inv * _atb;
+		const matrix::Vector3f center{(float)(p(0) / 2.0), (float)(p(1) / 2.0), (float)(p(2) / 2.0)};
+		const float radius_squared = (float)p(3) + center.norm_squared();
+
+		if (!center.isAllFinite() || !PX4_ISFINITE(radius_squared) || (radius_squared <= 0.f)) {
+			_valid = false;
+			return;
+		}
+
+		_center = center;
+		_radius = sqrtf(radius_squared);
+		_valid = true;
+	}
+
+	static uint8_t bin(const matrix::Vector3f &v)
+	{
+		// dominant axis and its sign select the cube face, the signs of the other two axes the quadrant
+		int axis = 0;
+
+		if (fabsf(v(1)) > fabsf(v(axis))) { axis = 1; }
+
+		if (fabsf(v(2)) > fabsf(v(axis))) { axis = 2; }
+
+		const int u = (axis + 1) % 3;
+		const int w = (axis + 2) % 3;
+
+		return (uint8_t)(axis * 8 + (v(axis) < 0.f ? 4 : 0) + (v(u) < 0.f ? 2 : 0) + (v(w) < 0.f ? 1 : 0));
+	}
+
+	matrix::SquareMatrix<double, 4> _ata{};
+	matrix::Vector<double, 4> _atb{};
+
+	matrix::Vector3f _center{};
+	float _radius{0.f};
+
+	uint32_t _samples{0};
+	uint32_t _coverage{0};
+	bool _valid{false};
+};
@@ -33,6 +33,10 @@
 
 #include "lm_fit.hpp"
 
+#if defined(__PX4_POSIX)
+#include <pthread.h>
+#endif
+
 struct iteration_result {
 	float gradient_damping;
 	float cost;
@@ -41,6 +45,36 @@ struct iteration_result {
 	} result = STATUS::SUCCESS;
 };
 
+/**
+ * Add the contribution of one sample to the normal equations.
+ * JTJ is symmetric, so only its upper triangle is accumulated here (see mirror_upper_triangle()),
+ * which almost halves the multiply-adds per sample for the 9 parameter ellipsoid fit.
+ */
+template<size_t N>
+static inline void accumulate_normal_equations(const float jacob[N], float residual, matrix::SquareMatrix<float, N> &JTJ,
+		float JTFI[N])
+{
+	for (size_t i = 0; i < N; i++) {
+		const float ji = jacob[i];
+
+		for (size_t j = i; j < N; j++) {
+			JTJ(i, j) += ji * jacob[j];
+		}
+
+		JTFI[i] += ji * residual;
+	}
+}
+
+template<size_t N>
+static inline void mirror_upper_triangle(matrix::SquareMatrix<float, N> &JTJ)
+{
+	for (size_t i = 1; i < N; i++) {
+		for (size_t j = 0; j < i; j++) {
+			JTJ(i, j) = JTJ(j, i);
+		}
+	}
+}
+
 void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 			     unsigned int samples_collected, sphere_params &params, iteration_result &result)
 {
@@ -54,37 +88,38 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 	float JTFI[4] {};
 	float residual = 0.0f;
 
+	// loop invariants kept in locals so the accumulation below only touches the sample arrays
+	const float d0 = params.diag(0), d1 = params.diag(1), d2 = params.diag(2);
+	const float o0 = params.offdiag(0), o1 = params.offdiag(1), o2 = params.offdiag(2);
+	const float c0 = params.offset(0), c1 = params.offset(1), c2 = params.offset(2);
+
 	// Gauss Newton Part common for all kind of extensions including LM
 	for (uint16_t k = 0; k < samples_collected; k++) {
 
 		float sphere_jacob[4];
 		//Calculate Jacobian
-		float A = (params.diag(0)    * (x[k] - params.offset(0))) + (params.offdiag(0) * (y[k] - params.offset(1))) +
-			  (params.offdiag(1) * (z[k] - params.offset(2)));
-		float B = (params.offdiag(0) * (x[k] - params.offset(0))) + (params.diag(1)    * (y[k] - params.offset(1))) +
-			  (params.offdiag(2) * (z[k] - params.offset(2)));
-		float C = (params.offdiag(1) * (x[k] - params.offset(0))) + (params.offdiag(2) * (y[k] - params.offset(1))) +
-			  (params.diag(2)    * (z[k] - params.offset(2)));
+		const float dx = x[k] - c0;
+		const float dy = y[k] - c1;
+		const float dz = z[k] - c2;
+		float A = (d0 * dx) + (o0 * dy) + (o1 * dz);
+		float B = (o0 * dx) + (d1 * dy) + (o2 * dz);
+		float C = (o1 * dx) + (o2 * dy) + (d2 * dz);
 		float length = sqrtf(A * A + B * B + C * C);
+		const float length_inv = 1.0f / length;
 
 		// 0: partial derivative (radius wrt fitness fn) fn operated on sample
 		sphere_jacob[0] = 1.0f;
 		// 1-3: partial derivative (offsets wrt fitness fn) fn operated on sample
-		sphere_jacob[1] = 1.0f * (((params.diag(0)    * A) + (params.offdiag(0) * B) + (params.offdiag(1) * C)) / length);
-		sphere_jacob[2] = 1.0f * (((params.offdiag(0) * A) + (params.diag(1)    * B) + (params.offdiag(2) * C)) / length);
-		sphere_jacob[3] = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
+		sphere_jacob[1] = ((d0 * A) + (o0 * B) + (o1 * C)) * length_inv;
+		sphere_jacob[2] = ((o0 * A) + (d1 * B) + (o2 * C)) * length_inv;
+		sphere_jacob[3] = ((o1 * A) + (o2 * B) + (d2 * C)) * length_inv;
 		residual = params.radius - length;
 
-		for (uint8_t i = 0; i < 4; i++) {
-			// compute JTJ
-			for (uint8_t j = 0; j < 4; j++) {
-				JTJ(i, j) += sphere_jacob[i] * sphere_jacob[j];
-			}
-
-			JTFI[i] += sphere_jacob[i] * residual;
-		}
+		accumulate_normal_equations<4>(sphere_jacob, residual, JTJ, JTFI);
 	}
 
+	mirror_upper_triangle(JTJ);
+
 
 	//------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
 	// refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
@@ -187,42 +222,43 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 	float residual = 0.0f;
 	float ellipsoid_jacob[9];
 
+	// loop invariants kept in locals so the accumulation below only touches the sample arrays
+	const float d0 = params.diag(0), d1 = params.diag(1), d2 = params.diag(2);
+	const float o0 = params.offdiag(0), o1 = params.offdiag(1), o2 = params.offdiag(2);
+	const float c0 = params.offset(0), c1 = params.offset(1), c2 = params.offset(2);
+
 	// Gauss Newton Part common for all kind of extensions including LM
 	for (uint16_t k = 0; k < samples_collected; k++) {
 
 		// Calculate Jacobian
-		float A = (params.diag(0)    * (x[k] - params.offset(0))) + (params.offdiag(0) * (y[k] - params.offset(1))) +
-			  (params.offdiag(1) * (z[k] - params.offset(2)));
-		float B = (params.offdiag(0) * (x[k] - params.offset(0))) + (params.diag(1)    * (y[k] - params.offset(1))) +
-			  (params.offdiag(2) * (z[k] - params.offset(2)));
-		float C = (params.offdiag(1) * (x[k] - params.offset(0))) + (params.offdiag(2) * (y[k] - params.offset(1))) +
-			  (params.diag(2)    * (z[k] - params.offset(2)));
+		const float dx = x[k] - c0;
+		const float dy = y[k] - c1;
+		const float dz = z[k] - c2;
+		float A = (d0 * dx) + (o0 * dy) + (o1 * dz);
+		float B = (o0 * dx) + (d1 * dy) + (o2 * dz);
+		float C = (o1 * dx) + (o2 * dy) + (d2 * dz);
 		float length = sqrtf(A * A + B * B + C * C);
+		const float length_inv = 1.0f / length;
 		residual = params.radius - length;
 		fit1 += residual * residual;
 		// 0-2: partial derivative (offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[0] = 1.0f * (((params.diag(0)    * A) + (params.offdiag(0) * B) + (params.offdiag(1) * C)) / length);
-		ellipsoid_jacob[1] = 1.0f * (((params.offdiag(0) * A) + (params.diag(1)    * B) + (params.offdiag(2) * C)) / length);
-		ellipsoid_jacob[2] = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
+		ellipsoid_jacob[0] = ((d0 * A) + (o0 * B) + (o1 * C)) * length_inv;
+		ellipsoid_jacob[1] = ((o0 * A) + (d1 * B) + (o2 * C)) * length_inv;
+		ellipsoid_jacob[2] = ((o1 * A) + (o2 * B) + (d2 * C)) * length_inv;
 		// 3-5: partial derivative (diag offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[3] = -1.0f * ((x[k] - params.offset(0)) * A) / length;
-		ellipsoid_jacob[4] = -1.0f * ((y[k] - params.offset(1)) * B) / length;
-		ellipsoid_jacob[5] = -1.0f * ((z[k] - params.offset(2)) * C) / length;
+		ellipsoid_jacob[3] = -(dx * A) * length_inv;
+		ellipsoid_jacob[4] = -(dy * B) * length_inv;
+		ellipsoid_jacob[5] = -(dz * C) * length_inv;
 		// 6-8: partial derivative (off-diag offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[6] = -1.0f * (((y[k] - params.offset(1)) * A) + ((x[k] - params.offset(0)) * B)) / length;
-		ellipsoid_jacob[7] = -1.0f * (((z[k] - params.offset(2)) * A) + ((x[k] - params.offset(0)) * C)) / length;
-		ellipsoid_jacob[8] = -1.0f * (((z[k] - params.offset(2)) * B) + ((y[k] - params.offset(1)) * C)) / length;
-
-		for (uint8_t i = 0; i < 9; i++) {
-			// compute JTJ
-			for (uint8_t j = 0; j < 9; j++) {
-				JTJ(i, j) += ellipsoid_jacob[i] * ellipsoid_jacob[j];
-			}
+		ellipsoid_jacob[6] = -((dy * A) + (dx * B)) * length_inv;
+		ellipsoid_jacob[7] = -((dz * A) + (dx * C)) * length_inv;
+		ellipsoid_jacob[8] = -((dz * B) + (dy * C)) * length_inv;
 
-			JTFI[i] += ellipsoid_jacob[i] * residual;
-		}
+		accumulate_normal_equations<9>(ellipsoid_jacob, residual, JTJ, JTFI);
 	}
 
+	mirror_upper_triangle(JTJ);
+
 
 	//------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
 	// refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
@@ -354,3 +390,53 @@ int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int s
 	return 1;
 }
 
+static void run_mag_fit_job(mag_fit_job &job)
+{
+	job.sphere_fit_success = (lm_mag_fit(job.x, job.y, job.z, job.samples_collected, job.params, false) == PX4_OK);
+	job.ellipsoid_fit_success = false;
+
+	if (job.sphere_fit_success && job.full_ellipsoid) {
+		job.ellipsoid_fit_success = (lm_mag_fit(job.x, job.y, job.z, job.samples_collected, job.params, true) == PX4_OK);
+	}
+}
+
+#if defined(__PX4_POSIX)
+static void *mag_fit_thread(void *arg)
+{
+	run_mag_fit_job(*static_cast<mag_fit_job *>(arg));
+	return nullptr;
+}
+#endif
+
+void lm_mag_fit_all(mag_fit_job jobs[], unsigned int count)
+{
+#if defined(__PX4_POSIX)
+	static constexpr unsigned int MAX_THREADS = 8;
+	pthread_t threads[MAX_THREADS];
+	bool started[MAX_THREADS] {};
+
+	// the first job runs in the calling thread, the others get one thread each
+	for (unsigned int i = 1; i < count && i < MAX_THREADS; i++) {
+		started[i] = (pthread_create(&threads[i], nullptr, mag_fit_thread, &jobs[i]) == 0);
+	}
+
+	for (unsigned int i = 0; i < count; i++) {
+		if (i == 0 || i >= MAX_THREADS || !started[i]) {
+			run_mag_fit_job(jobs[i]);
+		}
+	}
+
+	for (unsigned int i = 1; i < count && i < MAX_THREADS; i++) {
+		if (started[i]) {
+			pthread_join(threads[i], nullptr);
+		}
+	}
+
+#else
+
+	for (unsigned int i = 0; i < count; i++) {
+		run_mag_fit_job(jobs[i]);
+	}
+
+#endif
+}
@@ -63,3 +63,29 @@ struct sphere_params {
  */
 int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int samples_collected, sphere_params &params,
 	       bool full_ellipsoid);
+
+/**
+ * Sphere fit of one magnetometer, optionally refined by an ellipsoid fit, see lm_mag_fit_all().
+ */
+struct mag_fit_job {
+	const float *x{nullptr};
+	const float *y{nullptr};
+	const float *z{nullptr};
+	unsigned int samples_collected{0};
+	sphere_params params{};                ///< initial guess, replaced by the fit result
+	bool full_ellipsoid{false};            ///< run the ellipsoid fit after a successful sphere fit
+	bool sphere_fit_success{false};
+	bool ellipsoid_fit_success{false};
+};
+
+/**
+ * Run the fits of several magnetometers.
+ *
+ * The jobs are independent. On POSIX each job runs in its own thread, so the wall time
+ * is the one of the slowest fit. Elsewhere (and if a thread cannot be created) the jobs
+ * run one after another in the calling thread.
+ *
+ * @param jobs the fits to run
+ * @param count number of jobs
+ */
+void lm_mag_fit_all(mag_fit_job jobs[], unsigned int count);
@@ -41,6 +41,7 @@
 #include "commander_helper.h"
 #include "calibration_routines.h"
 #include "lm_fit.hpp"
+#include "incremental_sphere_fit.hpp"
 #include "calibration_messages.h"
 #include "factory_calibration_storage.h"
 
@@ -94,6 +95,8 @@ struct mag_worker_data_t {
 	float		*y[MAX_MAGS];
 	float		*z[MAX_MAGS];
 
+	IncrementalSphereFit *live_fit[MAX_MAGS];			///< Streaming fit for live feedback and the initial guess
+
 	calibration::Magnetometer calibration[MAX_MAGS] {};
 };
 
@@ -389,6 +392,8 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 						worker_data->z[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](2);
 
 						worker_data->calibration_counter_total[cur_mag]++;
+
+						worker_data->live_fit[cur_mag]->update(new_samples[cur_mag]);
 					}
 				}
 
@@ -458,6 +463,17 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 		calibration_log_info(worker_data->mavlink_log_pub, "[cal] %s side done, rotate to a different side",
 				     detect_orientation_str(orientation));
 
+		// live feedback of the direction coverage so far, to show which mag still lacks data
+		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
+			const IncrementalSphereFit *live_fit = worker_data->live_fit[cur_mag];
+
+			if ((worker_data->calibration[cur_mag].device_id() != 0) && live_fit->valid()) {
+				PX4_INFO("Mag %" PRIu8 " coverage: %" PRIu8 "%%, radius: %.3f, offset: [%.3f, %.3f, %.3f]", cur_mag,
+					 live_fit->coverage_percentage(), (double)live_fit->radius(),
+					 (double)live_fit->center()(0), (double)live_fit->center()(1), (double)live_fit->center()(2));
+			}
+		}
+
 		worker_data->done_count++;
 		px4_usleep(20000);
 		calibration_log_info(worker_data->mavlink_log_pub, CAL_QGC_PROGRESS_MSG, progress_percentage(worker_data));
@@ -518,6 +534,7 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 		worker_data.x[cur_mag] = nullptr;
 		worker_data.y[cur_mag] = nullptr;
 		worker_data.z[cur_mag] = nullptr;
+		worker_data.live_fit[cur_mag] = nullptr;
 		worker_data.calibration_counter_total[cur_mag] = 0;
 	}
 
@@ -538,8 +555,10 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 			worker_data.x[cur_mag] = static_cast<float *>(malloc(sizeof(float) * calibration_points_maxcount));
 			worker_data.y[cur_mag] = static_cast<float *>(malloc(sizeof(float) * calibration_points_maxcount));
 			worker_data.z[cur_mag] = static_cast<float *>(malloc(sizeof(float) * calibration_points_maxcount));
+			worker_data.live_fit[cur_mag] = new IncrementalSphereFit();
 
-			if (worker_data.x[cur_mag] == nullptr || worker_data.y[cur_mag] == nullptr || worker_data.z[cur_mag] == nullptr) {
+			if (worker_data.x[cur_mag] == nullptr || worker_data.y[cur_mag] == nullptr || worker_data.z[cur_mag] == nullptr
+			    || worker_data.live_fit[cur_mag] == nullptr) {
 				calibration_log_critical(mavlink_log_pub, "ERROR: out of memory");
 				result = calibrate_return_error;
 				break;
@@ -574,39 +593,54 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 	}
 
 	if (result == calibrate_return_ok) {
-		// Sphere fit the data to get calibration values
+		// Sphere fit the data to get calibration values, all mags at once as the fits are independent
+		mag_fit_job fit_jobs[MAX_MAGS] {};
+		unsigned int fit_job_index[MAX_MAGS] {};
+		unsigned int fit_job_count = 0;
+
 		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
 			if (worker_data.calibration[cur_mag].device_id() != 0) {
-				// Mag in this slot is available and we should have values for it to calibrate
+				mag_fit_job &job = fit_jobs[fit_job_count];
+				job.x = worker_data.x[cur_mag];
+				job.y = worker_data.y[cur_mag];
+				job.z = worker_data.z[cur_mag];
+				job.samples_collected = worker_data.calibration_counter_total[cur_mag];
 
 				// Estimate only the offsets if two-sided calibration is selected, as the problem is not constrained
 				// enough to reliably estimate both scales and offsets with 2 sides only (even if the existing calibration
 				// is already close)
-				bool sphere_fit_only = worker_data.calibration_sides <= 2;
+				job.full_ellipsoid = worker_data.calibration_sides > 2;
 
-				sphere_params sphere_data;
-				sphere_data.radius = sphere_radius[cur_mag];
-				sphere_data.offset = matrix::Vector3f(sphere[cur_mag](0), sphere[cur_mag](1), sphere[cur_mag](2));
-				sphere_data.diag = matrix::Vector3f(diag[cur_mag](0), diag[cur_mag](1), diag[cur_mag](2));
-				sphere_data.offdiag = matrix::Vector3f(offdiag[cur_mag](0), offdiag[cur_mag](1), offdiag[cur_mag](2));
+				job.params.radius = sphere_radius[cur_mag];
+				job.params.offset = sphere[cur_mag];
+				job.params.diag = diag[cur_mag];
+				job.params.offdiag = offdiag[cur_mag];
 
-				bool sphere_fit_success = false;
-				bool ellipsoid_fit_success = false;
-				int ret = lm_mag_fit(worker_data.x[cur_mag], worker_data.y[cur_mag], worker_data.z[cur_mag],
-						     worker_data.calibration_counter_total[cur_mag], sphere_data, false);
+				// start from the streaming fit, which usually takes the LM sphere fit most of the way already
+				const IncrementalSphereFit *live_fit = worker_data.live_fit[cur_mag];
 
-				if (ret == PX4_OK) {
-					sphere_fit_success = true;
-					PX4_INFO("Mag: %" PRIu8 " sphere radius: %.4f", cur_mag, (double)sphere_data.radius);
+				if (live_fit->valid() && (live_fit->radius() > 0.f)) {
+					job.params.radius = live_fit->radius();
+					job.params.offset = live_fit->center();
+				}
 
-					if (!sphere_fit_only) {
-						int ellipsoid_ret = lm_mag_fit(worker_data.x[cur_mag], worker_data.y[cur_mag], worker_data.z[cur_mag],
-									       worker_data.calibration_counter_total[cur_mag], sphere_data, true);
+				fit_job_index[cur_mag] = fit_job_count++;
+			}
+		}
 
-						if (ellipsoid_ret == PX4_OK) {
-							ellipsoid_fit_success = true;
-						}
-					}
+		lm_mag_fit_all(fit_jobs, fit_job_count);
+
+		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
+			if (worker_data.calibration[cur_mag].device_id() != 0) {
+				// Mag in this slot is available and we should have values for it to calibrate
+				const mag_fit_job &job = fit_jobs[fit_job_index[cur_mag]];
+				const sphere_params &sphere_data = job.params;
+
+				const bool sphere_fit_success = job.sphere_fit_success;
+				const bool ellipsoid_fit_success = job.ellipsoid_fit_success;
+
+				if (sphere_fit_success) {
+					PX4_INFO("Mag: %" PRIu8 " sphere radius: %.4f", cur_mag, (double)sphere_data.radius);
 				}
 
 				if (!sphere_fit_success && !ellipsoid_fit_success) {
@@ -893,6 +927,7 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 		free(worker_data.x[cur_mag]);
 		free(worker_data.y[cur_mag]);
 		free(worker_data.z[cur_mag]);
+		delete worker_data.live_fit[cur_mag];
 	}
 
 	FactoryCalibrationStorage factory_storage;
@@ -983,9 +1018,10 @@ int do_mag_calibration_quick(orb_advert_t *mavlink_log_pub, float heading_radian
 	} else {
 
 		// magnetic field data returned by the geo library using the current GPS position
-		const float mag_declination_gps = get_mag_declination_radians(latitude, longitude);
-		const float mag_inclination_gps = get_mag_inclination_radians(latitude, longitude);
-		const float mag_strength_gps = get_mag_strength_gauss(latitude, longitude);
+		float mag_declination_gps;
+		float mag_inclination_gps;
+		float mag_strength_gps;
+		get_mag_field(latitude, longitude, mag_declination_gps, mag_inclination_gps, mag_strength_gps);
 
 		const Vector3f mag_earth_pred = Dcmf(Eulerf(0, -mag_inclination_gps, mag_declination_gps)) * Vector3f(mag_strength_gps,
 						0, 0);
@@ -42,6 +42,7 @@
 #include <matrix/matrix/math.hpp>
 #include <px4_platform_common/defines.h>
 
+#include "incremental_sphere_fit.hpp"
 #include "lm_fit.hpp"
 #include "mag_calibration_test_data.h"
 
@@ -195,6 +196,87 @@ TEST_F(MagCalTest, sphereRegularlySpaced)
 	EXPECT_NEAR(sphere.diag(2), scale_true(2), 0.001f) << "scale Z: " << scale_true(2);
 }
 
+TEST_F(MagCalTest, incrementalSphereRegularlySpaced)
+{
+	// GIVEN: a dataset of regularly spaced points
+	// on a perfect sphere but not centered on the origin
+	static constexpr unsigned int N_SAMPLES = 240;
+
+	const float mag_str_true = 0.4f;
+	const Vector3f offset_true = {-1.07f, 0.35f, -0.78f};
+	const Vector3f scale_true = {1.f, 1.f, 1.f};
+
+	float x[N_SAMPLES];
+	float y[N_SAMPLES];
+	float z[N_SAMPLES];
+	generateRegularData(x, y, z, N_SAMPLES, mag_str_true);
+	modifyOffsetScale(x, y, z, N_SAMPLES, offset_true, scale_true);
+
+	// WHEN: streaming the samples one by one into the incremental fit
+	IncrementalSphereFit fit;
+
+	for (unsigned int k = 0; k < N_SAMPLES; k++) {
+		fit.update(Vector3f{x[k], y[k], z[k]});
+	}
+
+	// THEN: the linear fit should find the exact sphere and all directions should be covered
+	EXPECT_TRUE(fit.valid());
+	EXPECT_EQ(fit.samples(), N_SAMPLES);
+	EXPECT_NEAR(fit.radius(), mag_str_true, 0.001f) << "radius: " << fit.radius();
+	EXPECT_NEAR(fit.center()(0), offset_true(0), 0.001f) << "offset X: " << fit.center()(0);
+	EXPECT_NEAR(fit.center()(1), offset_true(1), 0.001f) << "offset Y: " << fit.center()(1);
+	EXPECT_NEAR(fit.center()(2), offset_true(2), 0.001f) << "offset Z: " << fit.center()(2);
+}
+
+TEST_F(MagCalTest, incrementalSphere2SidesCoverage)
+{
+	// GIVEN: a dataset of points located on two orthogonal circles
+	static constexpr unsigned int N_SAMPLES = 240;
+
+	const float mag_str_true = 0.4f;
+
+	float x[N_SAMPLES];
+	float y[N_SAMPLES];
+	float z[N_SAMPLES];
+	generate2SidesMagData(x, y, z, N_SAMPLES, mag_str_true);
+
+	// WHEN: streaming the samples into the incremental fit
+	IncrementalSphereFit fit;
+
+	for (unsigned int k = 0; k < N_SAMPLES; k++) {
+		fit.update(Vector3f{x[k], y[k], z[k]});
+	}
+
+	// THEN: the sphere is still found, but only part of the directions are covered
+	EXPECT_TRUE(fit.valid());
+	EXPECT_NEAR(fit.radius(), mag_str_true, 0.001f) << "radius: " << fit.radius();
+	EXPECT_GT(fit.coverage_percentage(), 0);
+	EXPECT_LT(fit.coverage_percentage(), 100);
+
+	// WHEN: adding one point per direction bin (dominant axis, its sign and the quadrant of the other two),
+	// twice as the first samples are only binned once the fit is valid
+	for (int pass = 0; pass < 2; pass++) {
+		for (int axis = 0; axis < 3; axis++) {
+			for (int signs = 0; signs < 8; signs++) {
+				Vector3f p;
+				p(axis) = (signs & 4) ? -mag_str_true : mag_str_true;
+				p((axis + 1) % 3) = (signs & 2) ? -0.5f * mag_str_true : 0.5f * mag_str_true;
+				p((axis + 2) % 3) = (signs & 1) ? -0.5f * mag_str_true : 0.5f * mag_str_true;
+				fit.update(p);
+			}
+		}
+	}
+
+	// THEN: all directions are covered
+	EXPECT_EQ(fit.coverage_percentage(), 100);
+
+	// AND: a reset clears everything
+	fit.reset();
+	EXPECT_FALSE(fit.valid());
+	EXPECT_EQ(fit.samples(), 0u);
+	EXPECT_EQ(fit.coverage_percentage(), 0);
+}
+
 TEST_F(MagCalTest, replayTestData)
 {
 	// GIVEN: a real test dataset with large offsets
@@ -236,3 +318,46 @@ TEST_F(MagCalTest, replayTestData)
 	EXPECT_NEAR(ellipsoid.diag(1), scale_true(1), 0.01f) << "scale Y: " << ellipsoid.diag(1);
 	EXPECT_NEAR(ellipsoid.diag(2), scale_true(2), 0.01f) << "scale Z: " << ellipsoid.diag(2);
 }
+
+TEST_F(MagCalTest, multiMagFit)
+{
+	// GIVEN: the real test dataset for 4 magnetometers
+	constexpr unsigned int N_SAMPLES = 231;
+	constexpr unsigned int N_MAGS = 4;
+
+	// WHEN: fitting all of them at once
+	mag_fit_job jobs[N_MAGS] {};
+
+	for (unsigned int i = 0; i < N_MAGS; i++) {
+		jobs[i].x = mag_data1_x;
+		jobs[i].y = mag_data1_y;
+		jobs[i].z = mag_data1_z;
+		jobs[i].samples_collected = N_SAMPLES;
+		jobs[i].params.radius = 0.2f;
+		jobs[i].full_ellipsoid = (i % 2) == 0;
+	}
+
+	lm_mag_fit_all(jobs, N_MAGS);
+
+	// THEN: each job should give the same result as running the fits sequentially
+	for (unsigned int i = 0; i < N_MAGS; i++) {
+		sphere_params expected;
+		expected.radius = 0.2f;
+		const bool sphere_success = (lm_mag_fit(mag_data1_x, mag_data1_y, mag_data1_z, N_SAMPLES, expected, false) == PX4_OK);
+		bool ellipsoid_success = false;
+
+		if (sphere_success && jobs[i].full_ellipsoid) {
+			ellipsoid_success = (lm_mag_fit(mag_data1_x, mag_data1_y, mag_data1_z, N_SAMPLES, expected, true) == PX4_OK);
+		}
+
+		EXPECT_EQ(jobs[i].sphere_fit_success, sphere_success) << "mag " << i;
+		EXPECT_EQ(jobs[i].ellipsoid_fit_success, ellipsoid_success) << "mag " << i;
+		EXPECT_FLOAT_EQ(jobs[i].params.radius, expected.radius) << "mag " << i;
+
+		for (int k = 0; k < 3; k++) {
+			EXPECT_FLOAT_EQ(jobs[i].params.offset(k), expected.offset(k)) << "mag " << i;
+			EXPECT_FLOAT_EQ(jobs[i].params.diag(k), expected.diag(k)) << "mag " << i;
+			EXPECT_FLOAT_EQ(jobs[i].params.offdiag(k), expected.offdiag(k)) << "mag " << i;
+		}
+	}
+}
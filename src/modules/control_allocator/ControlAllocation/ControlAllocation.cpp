@@ -61,6 +61,29 @@ ControlAllocation::setEffectivenessMatrix(
 	clipActuatorSetpoint(_actuator_trim);
 	_num_actuators = num_actuators;
 	_control_trim = _effectiveness * linearization_point_clipped;
+	_allocation_valid = false;
+}
+
+void
+ControlAllocation::allocateIfChanged()
+{
+	bool changed = !_allocation_valid;
+
+	for (int i = 0; (i < NUM_AXES) && !changed; i++) {
+		changed = (_control_sp(i) != _allocation_control_sp(i));
+	}
+
+	if (changed) {
+		allocate();
+		_allocation_sp = _actuator_sp;
+		_allocation_control_sp = _control_sp;
+		_allocation_valid = true;
+
+	} else {
+		// the setpoint was modified after the allocation (slew rate, clipping, auxiliary controls)
+		_prev_actuator_sp = _actuator_sp;
+		_actuator_sp = _allocation_sp;
+	}
 }
 
 void
@@ -69,6 +92,7 @@ ControlAllocation::setActuatorSetpoint(
 {
 	// Set actuator setpoint
 	_actuator_sp = actuator_sp;
+	_allocation_valid = false;
 
 	// Clip
 	clipActuatorSetpoint(_actuator_sp);
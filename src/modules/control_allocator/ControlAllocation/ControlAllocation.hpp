@@ -98,6 +98,17 @@ public:
 	 */
 	virtual void allocate() = 0;
 
+	/**
+	 * Allocate control setpoint to actuators, or reuse the result of the previous allocation if
+	 * neither the control setpoint nor the allocation configuration changed since then.
+	 */
+	void allocateIfChanged();
+
+	/**
+	 * Force the next allocateIfChanged() to run the allocation (e.g. after a parameter update)
+	 */
+	void invalidateAllocation() { _allocation_valid = false; }
+
 	/**
 	 * Set actuator failure flag
 	 * This prevents a change of the scaling in the matrix normalization step
@@ -105,7 +116,7 @@ public:
 	 *
 	 * @param failure  Motor failure flag
 	 */
-	void setHadActuatorFailure(bool failure) { _had_actuator_failure = failure; }
+	void setHadActuatorFailure(bool failure) { _had_actuator_failure = failure; _allocation_valid = false; }
 
 	/**
 	 * Set the control effectiveness matrix
@@ -157,7 +168,11 @@ public:
 	 *
 	 * @param actuator_min Minimum actuator values
 	 */
-	void setActuatorMin(const matrix::Vector<float, NUM_ACTUATORS> &actuator_min) { _actuator_min = actuator_min; }
+	void setActuatorMin(const matrix::Vector<float, NUM_ACTUATORS> &actuator_min)
+	{
+		_actuator_min = actuator_min;
+		_allocation_valid = false;
+	}
 
 	/**
 	 * Get the minimum actuator values
@@ -171,7 +186,11 @@ public:
 	 *
 	 * @param actuator_max Maximum actuator values
 	 */
-	void setActuatorMax(const matrix::Vector<float, NUM_ACTUATORS> &actuator_max) { _actuator_max = actuator_max; }
+	void setActuatorMax(const matrix::Vector<float, NUM_ACTUATORS> &actuator_max)
+	{
+		_actuator_max = actuator_max;
+		_allocation_valid = false;
+	}
 
 	/**
 	 * Get the maximum actuator values
@@ -226,7 +245,7 @@ public:
 
 	int numConfiguredActuators() const { return _num_actuators; }
 
-	void setNormalizeRPY(bool normalize_rpy) { _normalize_rpy = normalize_rpy; }
+	void setNormalizeRPY(bool normalize_rpy) { _normalize_rpy = normalize_rpy; _allocation_valid = false; }
 
 protected:
 	friend class ControlAllocator; // for _actuator_sp
@@ -244,4 +263,9 @@ protected:
 	int _num_actuators{0};
 	bool _normalize_rpy{false};				///< if true, normalize roll, pitch and yaw columns
 	bool _had_actuator_failure{false};
+
+private:
+	matrix::Vector<float, NUM_ACTUATORS> _allocation_sp;	///< Result of the last allocate()
+	matrix::Vector<float, NUM_AXES> _allocation_control_sp;	///< Control setpoint of the last allocate()
+	bool _allocation_valid{false};
 };
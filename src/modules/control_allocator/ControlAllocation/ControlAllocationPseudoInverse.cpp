@@ -47,10 +47,25 @@ ControlAllocationPseudoInverse::setEffectivenessMatrix(
 	const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
 	bool update_normalization_scale)
 {
+	// all matrices are updated together (e.g. while tilting), only recompute the inverse of the ones that changed
+	bool effectiveness_changed = update_normalization_scale || (num_actuators != _num_actuators);
+
+	for (int i = 0; (i < NUM_AXES) && !effectiveness_changed; i++) {
+		for (int j = 0; j < NUM_ACTUATORS; j++) {
+			if (effectiveness(i, j) != _effectiveness(i, j)) {
+				effectiveness_changed = true;
+				break;
+			}
+		}
+	}
+
 	ControlAllocation::setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, num_actuators,
 			update_normalization_scale);
-	_mix_update_needed = true;
-	_normalization_needs_update = update_normalization_scale;
+
+	if (effectiveness_changed) {
+		_mix_update_needed = true;
+		_normalization_needs_update = update_normalization_scale;
+	}
 }
 
 void
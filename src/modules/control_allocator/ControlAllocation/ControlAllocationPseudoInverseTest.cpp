@@ -67,3 +67,49 @@ TEST(ControlAllocationTest, AllZeroCase)
 	EXPECT_EQ(actuator_sp, actuator_sp_expected);
 	EXPECT_EQ(control_allocated, control_allocated_expected);
 }
+
+TEST(ControlAllocationTest, AllocateIfChanged)
+{
+	ControlAllocationPseudoInverse method;
+
+	matrix::Matrix<float, 6, 16> effectiveness;
+	matrix::Vector<float, 16> actuator_trim;
+	matrix::Vector<float, 16> linearization_point;
+	matrix::Vector<float, 6> control_sp;
+
+	for (int i = 0; i < 4; i++) {
+		effectiveness(5, i) = -1.f;
+	}
+
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 4, false);
+
+	control_sp(5) = -0.5f;
+	method.setControlSetpoint(control_sp);
+	method.allocateIfChanged();
+	const matrix::Vector<float, 16> actuator_sp = method.getActuatorSetpoint();
+	EXPECT_FLOAT_EQ(actuator_sp(0), 0.125f);
+
+	// an output modified after the allocation (here by slew rate limiting) is restored for an unchanged setpoint
+	matrix::Vector<float, 16> slew_rate;
+	slew_rate.setAll(1.f);
+	method.setSlewRateLimit(slew_rate);
+	method.applySlewRateLimit(0.05f);
+	EXPECT_FLOAT_EQ(method.getActuatorSetpoint()(0), 0.05f);
+	method.allocateIfChanged();
+	EXPECT_EQ(method.getActuatorSetpoint(), actuator_sp);
+
+	// a new setpoint is allocated
+	control_sp(5) = -1.f;
+	method.setControlSetpoint(control_sp);
+	method.allocateIfChanged();
+	EXPECT_FLOAT_EQ(method.getActuatorSetpoint()(0), 0.25f);
+
+	// an effectiveness change is allocated with the same setpoint
+	for (int i = 0; i < 4; i++) {
+		effectiveness(5, i) = -2.f;
+	}
+
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 4, false);
+	method.allocateIfChanged();
+	EXPECT_FLOAT_EQ(method.getActuatorSetpoint()(0), 0.125f);
+}
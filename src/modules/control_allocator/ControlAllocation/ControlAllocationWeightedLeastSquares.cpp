@@ -0,0 +1,316 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ControlAllocationWeightedLeastSquares.cpp
+ *
+ * Bounded weighted least squares control allocation with an active set method
+ */
+
+#include "ControlAllocationWeightedLeastSquares.hpp"
+
+constexpr int ControlAllocationWeightedLeastSquares::MAX_ITERATIONS;
+constexpr float ControlAllocationWeightedLeastSquares::AXIS_WEIGHTS[];
+
+namespace
+{
+
+/**
+ * Solve M x = b in place for a symmetric positive definite M (n x n, row stride NUM_ACTUATORS)
+ * @return false if M is not positive definite
+ */
+bool choleskySolve(float M[][ControlAllocation::NUM_ACTUATORS], float b[], int n)
+{
+	// M = L L^T, L stored in the lower triangle
+	for (int j = 0; j < n; j++) {
+		float d = M[j][j];
+
+		for (int k = 0; k < j; k++) {
+			d -= M[j][k] * M[j][k];
+		}
+
+		if (d <= FLT_EPSILON) {
+			return false;
+		}
+
+		M[j][j] = sqrtf(d);
+
+		for (int i = j + 1; i < n; i++) {
+			float s = M[i][j];
+
+			for (int k = 0; k < j; k++) {
+				s -= M[i][k] * M[j][k];
+			}
+
+			M[i][j] = s / M[j][j];
+		}
+	}
+
+	// forward substitution L y = b
+	for (int i = 0; i < n; i++) {
+		for (int k = 0; k < i; k++) {
+			b[i] -= M[i][k] * b[k];
+		}
+
+		b[i] /= M[i][i];
+	}
+
+	// back substitution L^T x = y
+	for (int i = n - 1; i >= 0; i--) {
+		for (int k = i + 1; k < n; k++) {
+			b[i] -= M[k][i] * b[k];
+		}
+
+		b[i] /= M[i][i];
+	}
+
+	return true;
+}
+
+} // namespace
+
+void
+ControlAllocationWeightedLeastSquares::updateWeightedEffectiveness()
+{
+	// same normalization of the control setpoint as the pseudo-inverse mix
+	_axis_scale.setAll(1.f);
+
+	if (_control_allocation_scale(0) > FLT_EPSILON) {
+		_axis_scale(0) = _control_allocation_scale(0);
+		_axis_scale(1) = _control_allocation_scale(1);
+	}
+
+	if (_control_allocation_scale(2) > FLT_EPSILON) {
+		_axis_scale(2) = _control_allocation_scale(2);
+	}
+
+	if (_control_allocation_scale(3) > FLT_EPSILON) {
+		_axis_scale(3) = _control_allocation_scale(3);
+		_axis_scale(4) = _control_allocation_scale(4);
+		_axis_scale(5) = _control_allocation_scale(5);
+	}
+
+	// weight the residual in normalized control units: Wv * diag(scale) * (B u - v / scale)
+	for (int i = 0; i < _num_actuators; i++) {
+		for (int axis = 0; axis < NUM_AXES; axis++) {
+			const float weight = AXIS_WEIGHTS[axis] * _axis_scale(axis);
+			_weighted_effectiveness_t(i, axis) = _effectiveness(axis, i) * weight * weight;
+		}
+	}
+
+	_hessian.setZero();
+
+	for (int i = 0; i < _num_actuators; i++) {
+		for (int j = i; j < _num_actuators; j++) {
+			float h = 0.f;
+
+			for (int axis = 0; axis < NUM_AXES; axis++) {
+				h += _weighted_effectiveness_t(i, axis) * _effectiveness(axis, j);
+			}
+
+			_hessian(i, j) = h;
+			_hessian(j, i) = h;
+		}
+
+		_hessian(i, i) += ACTUATOR_WEIGHT * ACTUATOR_WEIGHT;
+	}
+}
+
+void
+ControlAllocationWeightedLeastSquares::allocate()
+{
+	//Compute new gains if needed
+	const bool effectiveness_updated = _mix_update_needed;
+	updatePseudoInverse();
+
+	if (effectiveness_updated) {
+		updateWeightedEffectiveness();
+	}
+
+	_prev_actuator_sp = _actuator_sp;
+
+	const int n = _num_actuators;
+
+	// control setpoint in the effectiveness space
+	matrix::Vector<float, NUM_AXES> control;
+
+	for (int axis = 0; axis < NUM_AXES; axis++) {
+		control(axis) = (_control_sp(axis) - _control_trim(axis)) / _axis_scale(axis);
+	}
+
+	const ActuatorVector gradient_offset = _weighted_effectiveness_t * control;
+
+	// work relative to trim, warm start from the previous setpoint and active set
+	float u[NUM_ACTUATORS] {};
+	float u_min[NUM_ACTUATORS] {};
+	float u_max[NUM_ACTUATORS] {};
+
+	for (int i = 0; i < n; i++) {
+		if (_actuator_max(i) < _actuator_min(i)) {
+			// fixed at trim
+			u_min[i] = 0.f;
+			u_max[i] = 0.f;
+
+		} else {
+			u_min[i] = _actuator_min(i) - _actuator_trim(i);
+			u_max[i] = _actuator_max(i) - _actuator_trim(i);
+		}
+
+		u[i] = _actuator_sp(i) - _actuator_trim(i);
+
+		if ((_active_set[i] < 0) || (u[i] <= u_min[i])) {
+			u[i] = u_min[i];
+			_active_set[i] = -1;
+
+		} else if ((_active_set[i] > 0) || (u[i] >= u_max[i])) {
+			u[i] = u_max[i];
+			_active_set[i] = 1;
+		}
+	}
+
+	for (_iterations = 1; _iterations <= MAX_ITERATIONS; _iterations++) {
+		// optimum with the current active set, over the free actuators
+		int free_index[NUM_ACTUATORS];
+		int num_free = 0;
+
+		for (int i = 0; i < n; i++) {
+			if (_active_set[i] == 0) {
+				free_index[num_free++] = i;
+			}
+		}
+
+		float M[NUM_ACTUATORS][NUM_ACTUATORS];
+		float u_opt[NUM_ACTUATORS];
+
+		for (int a = 0; a < num_free; a++) {
+			const int i = free_index[a];
+			u_opt[a] = gradient_offset(i);
+
+			for (int j = 0; j < n; j++) {
+				if (_active_set[j] != 0) {
+					u_opt[a] -= _hessian(i, j) * u[j];
+				}
+			}
+
+			for (int b = 0; b < num_free; b++) {
+				M[a][b] = _hessian(i, free_index[b]);
+			}
+		}
+
+		if ((num_free > 0) && !choleskySolve(M, u_opt, num_free)) {
+			break;
+		}
+
+		// step towards the optimum until the first bound is hit
+		float alpha = 1.f;
+		int blocking = -1;
+		bool blocking_at_min = false;
+
+		for (int a = 0; a < num_free; a++) {
+			const int i = free_index[a];
+			const float step = u_opt[a] - u[i];
+
+			if ((u_opt[a] < u_min[i]) && (step < 0.f)) {
+				const float alpha_i = (u_min[i] - u[i]) / step;
+
+				if (alpha_i < alpha) {
+					alpha = alpha_i;
+					blocking = i;
+					blocking_at_min = true;
+				}
+
+			} else if ((u_opt[a] > u_max[i]) && (step > 0.f)) {
+				const float alpha_i = (u_max[i] - u[i]) / step;
+
+				if (alpha_i < alpha) {
+					alpha = alpha_i;
+					blocking = i;
+					blocking_at_min = false;
+				}
+			}
+		}
+
+		if (blocking >= 0) {
+			for (int a = 0; a < num_free; a++) {
+				const int i = free_index[a];
+				u[i] += alpha * (u_opt[a] - u[i]);
+			}
+
+			// activate the blocking bound
+			u[blocking] = blocking_at_min ? u_min[blocking] : u_max[blocking];
+			_active_set[blocking] = blocking_at_min ? -1 : 1;
+			continue;
+		}
+
+		for (int a = 0; a < num_free; a++) {
+			u[free_index[a]] = u_opt[a];
+		}
+
+		// optimal if no active bound pulls the solution back into the feasible set
+		int release = -1;
+		float lambda_min = -1e-6f;
+
+		for (int i = 0; i < n; i++) {
+			if ((_active_set[i] != 0) && (u_max[i] - u_min[i] > FLT_EPSILON)) {
+				float gradient = -gradient_offset(i);
+
+				for (int j = 0; j < n; j++) {
+					gradient += _hessian(i, j) * u[j];
+				}
+
+				// Lagrange multiplier of the bound, negative if the cost decreases when moving away from it
+				const float lambda = -_active_set[i] * gradient;
+
+				if (lambda < lambda_min) {
+					lambda_min = lambda;
+					release = i;
+				}
+			}
+		}
+
+		if (release < 0) {
+			break;
+		}
+
+		_active_set[release] = 0;
+	}
+
+	if (_iterations > MAX_ITERATIONS) {
+		// iteration limit reached, the setpoint is feasible but not optimal yet
+		_iterations = MAX_ITERATIONS;
+	}
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		_actuator_sp(i) = _actuator_trim(i) + ((i < n) ? u[i] : 0.f);
+	}
+}
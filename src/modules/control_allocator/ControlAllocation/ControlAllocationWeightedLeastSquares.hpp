@@ -0,0 +1,84 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ControlAllocationWeightedLeastSquares.hpp
+ *
+ * Control Allocation Algorithm solving the bounded weighted least squares problem
+ *
+ *   min ||Wv (B u - v)||^2 + ||Wu (u - u_trim)||^2,  u_min <= u <= u_max
+ *
+ * with an active set method. The active set of the previous cycle is used as warm start,
+ * so that a constant saturation pattern is typically solved in a single iteration.
+ * The number of iterations is limited, every iteration keeps the setpoint feasible
+ * and does not increase the cost, so the run time is bounded.
+ */
+
+#pragma once
+
+#include "ControlAllocationPseudoInverse.hpp"
+
+class ControlAllocationWeightedLeastSquares: public ControlAllocationPseudoInverse
+{
+public:
+	ControlAllocationWeightedLeastSquares() { _axis_scale.setAll(1.f); }
+	virtual ~ControlAllocationWeightedLeastSquares() = default;
+
+	static constexpr int MAX_ITERATIONS = 16;
+
+	void allocate() override;
+
+	/**
+	 * Number of active set iterations of the last allocation
+	 */
+	int iterations() const { return _iterations; }
+
+private:
+	/**
+	 * Update the Hessian and the weighted effectiveness after a change of the effectiveness matrix
+	 */
+	void updateWeightedEffectiveness();
+
+	// control axis weights (roll, pitch, yaw, thrust x, y, z) of the normalized control setpoint
+	static constexpr float AXIS_WEIGHTS[NUM_AXES] {10.f, 10.f, 1.f, 3.f, 3.f, 3.f};
+
+	// weight of the actuator deviation from trim, small to recover the exact solution if unsaturated
+	static constexpr float ACTUATOR_WEIGHT = 0.01f;
+
+	matrix::SquareMatrix<float, NUM_ACTUATORS> _hessian;		///< B^T Wv^2 B + Wu^2 I
+	matrix::Matrix<float, NUM_ACTUATORS, NUM_AXES> _weighted_effectiveness_t;	///< B^T Wv^2
+	matrix::Vector<float, NUM_AXES> _axis_scale;			///< normalization of each control axis
+
+	int8_t _active_set[NUM_ACTUATORS] {};	///< -1: at minimum, 1: at maximum, 0: free
+	int _iterations{0};
+};
@@ -0,0 +1,146 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <ControlAllocationPseudoInverse.hpp>
+#include <ControlAllocationWeightedLeastSquares.hpp>
+
+using namespace matrix;
+
+namespace
+{
+
+// quadrotor in X configuration, roll, pitch, yaw and thrust z
+Matrix<float, 6, 16> quadEffectiveness()
+{
+	Matrix<float, 6, 16> effectiveness;
+	const float roll[4] {-0.5f, 0.5f, 0.5f, -0.5f};
+	const float pitch[4] {0.5f, -0.5f, 0.5f, -0.5f};
+	const float yaw[4] {0.1f, 0.1f, -0.1f, -0.1f};
+
+	for (int i = 0; i < 4; i++) {
+		effectiveness(0, i) = roll[i];
+		effectiveness(1, i) = pitch[i];
+		effectiveness(2, i) = yaw[i];
+		effectiveness(5, i) = -0.25f;
+	}
+
+	return effectiveness;
+}
+
+template<typename T>
+void setup(T &method)
+{
+	Vector<float, 16> actuator_trim;
+	Vector<float, 16> linearization_point;
+	method.setEffectivenessMatrix(quadEffectiveness(), actuator_trim, linearization_point, 4, true);
+}
+
+} // namespace
+
+TEST(ControlAllocationWeightedLeastSquaresTest, UnsaturatedMatchesPseudoInverse)
+{
+	ControlAllocationPseudoInverse pseudo_inverse;
+	ControlAllocationWeightedLeastSquares wls;
+	setup(pseudo_inverse);
+	setup(wls);
+
+	Vector<float, 6> control_sp;
+	control_sp(0) = 0.05f;
+	control_sp(1) = -0.03f;
+	control_sp(2) = 0.02f;
+	control_sp(5) = -0.5f;
+
+	pseudo_inverse.setControlSetpoint(control_sp);
+	pseudo_inverse.allocate();
+	wls.setControlSetpoint(control_sp);
+	wls.allocate();
+
+	for (int i = 0; i < 4; i++) {
+		EXPECT_NEAR(wls.getActuatorSetpoint()(i), pseudo_inverse.getActuatorSetpoint()(i), 1e-3f);
+	}
+}
+
+TEST(ControlAllocationWeightedLeastSquaresTest, SaturatedStaysFeasible)
+{
+	ControlAllocationWeightedLeastSquares wls;
+	ControlAllocationPseudoInverse pseudo_inverse;
+	setup(wls);
+	setup(pseudo_inverse);
+
+	// full roll at high thrust saturates two motors at the top
+	Vector<float, 6> control_sp;
+	control_sp(0) = 0.4f;
+	control_sp(5) = -0.9f;
+
+	wls.setControlSetpoint(control_sp);
+	wls.allocate();
+	pseudo_inverse.setControlSetpoint(control_sp);
+	pseudo_inverse.allocate();
+	pseudo_inverse.clipActuatorSetpoint();
+
+	for (int i = 0; i < 4; i++) {
+		EXPECT_GE(wls.getActuatorSetpoint()(i), -1e-6f);
+		EXPECT_LE(wls.getActuatorSetpoint()(i), 1.f + 1e-6f);
+	}
+
+	// roll has priority over thrust, clipping loses roll instead
+	const float roll_error_wls = fabsf(wls.getAllocatedControl()(0) - control_sp(0));
+	const float roll_error_clipped = fabsf(pseudo_inverse.getAllocatedControl()(0) - control_sp(0));
+	EXPECT_LT(roll_error_wls, roll_error_clipped);
+	EXPECT_LE(wls.iterations(), ControlAllocationWeightedLeastSquares::MAX_ITERATIONS);
+}
+
+TEST(ControlAllocationWeightedLeastSquaresTest, WarmStart)
+{
+	ControlAllocationWeightedLeastSquares wls;
+	setup(wls);
+
+	Vector<float, 6> control_sp;
+	control_sp(0) = 0.4f;
+	control_sp(2) = 0.1f;
+	control_sp(5) = -0.9f;
+
+	wls.setControlSetpoint(control_sp);
+	wls.allocate();
+	const Vector<float, 16> actuator_sp = wls.getActuatorSetpoint();
+
+	// same saturation pattern, the previous active set is optimal right away
+	wls.setControlSetpoint(control_sp);
+	wls.allocate();
+	EXPECT_EQ(wls.iterations(), 1);
+
+	for (int i = 0; i < 4; i++) {
+		EXPECT_NEAR(wls.getActuatorSetpoint()(i), actuator_sp(i), 1e-5f);
+	}
+}
@@ -133,6 +133,7 @@ ControlAllocator::parameters_updated()
 
 	for (int i = 0; i < _num_control_allocation; ++i) {
 		_control_allocation[i]->updateParameters();
+		_control_allocation[i]->invalidateAllocation();
 	}
 
 	update_effectiveness_matrix_if_needed(EffectivenessUpdateReason::CONFIGURATION_UPDATE);
@@ -187,6 +188,10 @@ ControlAllocator::update_allocation_method(bool force)
 				_control_allocation[i] = new ControlAllocationSequentialDesaturation();
 				break;
 
+			case AllocationMethod::WEIGHTED_LEAST_SQUARES:
+				_control_allocation[i] = new ControlAllocationWeightedLeastSquares();
+				break;
+
 			default:
 				PX4_ERR("Unknown allocation method");
 				break;
@@ -433,8 +438,8 @@ ControlAllocator::Run()
 
 			_control_allocation[i]->setControlSetpoint(c[i]);
 
-			// Do allocation
-			_control_allocation[i]->allocate();
+			// Do allocation, skipped for matrices with an unchanged setpoint (e.g. the inactive one of a VTOL)
+			_control_allocation[i]->allocateIfChanged();
 			_actuator_effectiveness->allocateAuxilaryControls(dt, i, _control_allocation[i]->_actuator_sp); //flaps and spoilers
 			_actuator_effectiveness->updateSetpoint(c[i], i, _control_allocation[i]->_actuator_sp,
 								_control_allocation[i]->getActuatorMin(), _control_allocation[i]->getActuatorMax());
@@ -805,6 +810,10 @@ int ControlAllocator::print_status()
 		PX4_INFO("Method: Sequential desaturation");
 		break;
 
+	case AllocationMethod::WEIGHTED_LEAST_SQUARES:
+		PX4_INFO("Method: Weighted least squares");
+		break;
+
 	case AllocationMethod::AUTO:
 		PX4_INFO("Method: Auto");
 		break;
@@ -0,0 +1,251 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "ControlLatency.hpp"
+
+ControlLatency::ControlLatency() :
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::lp_default)
+{
+}
+
+ControlLatency::~ControlLatency()
+{
+	perf_free(_traced_perf);
+	perf_free(_incomplete_perf);
+}
+
+bool ControlLatency::init()
+{
+	if (!_actuator_outputs_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
+	return true;
+}
+
+void ControlLatency::Run()
+{
+	if (should_exit()) {
+		_actuator_outputs_sub.unregisterCallback();
+		exit_and_cleanup();
+		return;
+	}
+
+	// the driver publishes ahead of the chain, keep the queued samples of all gyros
+	for (int i = 0; i < _sensor_gyro_fifo_subs.size(); i++) {
+		sensor_gyro_fifo_s sensor_gyro_fifo;
+
+		while (_sensor_gyro_fifo_subs[i].update(&sensor_gyro_fifo)) {
+			_sensor_history[_sensor_history_index] = {sensor_gyro_fifo.timestamp_sample, sensor_gyro_fifo.timestamp};
+			_sensor_history_index = (_sensor_history_index + 1) % SENSOR_HISTORY;
+		}
+	}
+
+	actuator_outputs_s actuator_outputs;
+
+	if (!_actuator_outputs_sub.update(&actuator_outputs) || (actuator_outputs.timestamp_sample == 0)) {
+		return;
+	}
+
+	const hrt_abstime timestamp_sample = actuator_outputs.timestamp_sample;
+
+	control_latency_s control_latency{};
+	control_latency.timestamp_sample = timestamp_sample;
+
+	for (const SampleTimestamp &sample : _sensor_history) {
+		if (sample.timestamp_sample == timestamp_sample) {
+			control_latency.latency[control_latency_s::STAGE_SENSOR] = sample.timestamp - timestamp_sample;
+		}
+	}
+
+	// the chain runs at higher priority, so the latest messages normally belong to the same sample
+	vehicle_angular_velocity_s vehicle_angular_velocity;
+
+	if (_vehicle_angular_velocity_sub.copy(&vehicle_angular_velocity)
+	    && (vehicle_angular_velocity.timestamp_sample == timestamp_sample)) {
+		control_latency.latency[control_latency_s::STAGE_FILTER] = vehicle_angular_velocity.timestamp - timestamp_sample;
+	}
+
+	vehicle_torque_setpoint_s vehicle_torque_setpoint;
+
+	if (_vehicle_torque_setpoint_sub.copy(&vehicle_torque_setpoint)
+	    && (vehicle_torque_setpoint.timestamp_sample == timestamp_sample)) {
+		control_latency.latency[control_latency_s::STAGE_RATE_CONTROL] = vehicle_torque_setpoint.timestamp - timestamp_sample;
+	}
+
+	actuator_motors_s actuator_motors;
+
+	if (_actuator_motors_sub.copy(&actuator_motors) && (actuator_motors.timestamp_sample == timestamp_sample)) {
+		control_latency.latency[control_latency_s::STAGE_ALLOCATION] = actuator_motors.timestamp - timestamp_sample;
+	}
+
+	control_latency.latency[control_latency_s::STAGE_OUTPUT] = actuator_outputs.timestamp - timestamp_sample;
+
+	// the driver stage is only available for gyros publishing sensor_gyro_fifo
+	if ((control_latency.latency[control_latency_s::STAGE_FILTER] == 0)
+	    || (control_latency.latency[control_latency_s::STAGE_RATE_CONTROL] == 0)
+	    || (control_latency.latency[control_latency_s::STAGE_ALLOCATION] == 0)) {
+
+		perf_count(_incomplete_perf);
+		return;
+	}
+
+	perf_count(_traced_perf);
+	UpdateStatistics(control_latency);
+
+	control_latency.timestamp = hrt_absolute_time();
+	_control_latency_pub.publish(control_latency);
+}
+
+void ControlLatency::UpdateStatistics(const control_latency_s &control_latency)
+{
+	uint32_t latency_prev = 0;
+
+	for (int stage = 0; stage <= STAGES; stage++) {
+		uint32_t latency = 0;
+
+		if (stage == STAGES) {
+			latency = control_latency.latency[control_latency_s::STAGE_OUTPUT];
+
+		} else if (control_latency.latency[stage] != 0) {
+			latency = (control_latency.latency[stage] > latency_prev) ? control_latency.latency[stage] - latency_prev : 0;
+			latency_prev = control_latency.latency[stage];
+
+		} else {
+			// stage not traced
+			continue;
+		}
+
+		int bin = 0;
+
+		while ((bin < HISTOGRAM_BINS - 1) && (latency >> (bin + 1))) {
+			bin++;
+		}
+
+		StageStatistics &statistics = _statistics[stage];
+		statistics.histogram[bin]++;
+		statistics.sum += latency;
+		statistics.max = math::max(statistics.max, latency);
+	}
+
+	_traced_count++;
+}
+
+int ControlLatency::task_spawn(int argc, char *argv[])
+{
+	ControlLatency *instance = new ControlLatency();
+
+	if (instance) {
+		_object.store(instance);
+		_task_id = task_id_is_work_queue;
+
+		if (instance->init()) {
+			return PX4_OK;
+		}
+
+	} else {
+		PX4_ERR("alloc failed");
+	}
+
+	delete instance;
+	_object.store(nullptr);
+	_task_id = -1;
+
+	return PX4_ERROR;
+}
+
+int ControlLatency::print_status()
+{
+	perf_print_counter(_traced_perf);
+	perf_print_counter(_incomplete_perf);
+
+	static constexpr const char *stage_names[STAGES + 1] {"sensor", "filter", "rate control", "allocation", "output", "total"};
+
+	PX4_INFO_RAW("\n%-14s %8s %8s   histogram [2^i us, 2^(i+1) us), i = 0..%d\n", "stage", "mean us", "max us",
+		     HISTOGRAM_BINS - 1);
+
+	for (int stage = 0; stage <= STAGES; stage++) {
+		const StageStatistics &statistics = _statistics[stage];
+		uint32_t count = 0;
+
+		for (int bin = 0; bin < HISTOGRAM_BINS; bin++) {
+			count += statistics.histogram[bin];
+		}
+
+		PX4_INFO_RAW("%-14s %8.1f %8" PRIu32 "  ", stage_names[stage],
+			     (count > 0) ? (double)statistics.sum / count : 0.0, statistics.max);
+
+		for (int bin = 0; bin < HISTOGRAM_BINS; bin++) {
+			PX4_INFO_RAW(" %" PRIu32, statistics.histogram[bin]);
+		}
+
+		PX4_INFO_RAW("\n");
+	}
+
+	return 0;
+}
+
+int ControlLatency::custom_command(int argc, char *argv[])
+{
+	return print_usage("unknown command");
+}
+
+int ControlLatency::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_WARN("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Traces gyro samples through the rate control chain using the timestamp_sample carried along by
+sensor_gyro_fifo, vehicle_angular_velocity, vehicle_torque_setpoint, actuator_motors and actuator_outputs.
+
+For every actuator_outputs update the latency at the end of each stage is published as control_latency,
+`status` prints the mean, maximum and a log2 histogram of the time spent in each stage.
+
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("control_latency", "system");
+	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+
+	return 0;
+}
+
+extern "C" __EXPORT int control_latency_main(int argc, char *argv[])
+{
+	return ControlLatency::main(argc, argv);
+}
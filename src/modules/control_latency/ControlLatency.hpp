@@ -0,0 +1,118 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ControlLatency.hpp
+ *
+ * Traces gyro samples through the rate control chain by their timestamp_sample and reports the latency
+ * at the end of each stage (driver, filtering, rate control, control allocation, actuator outputs).
+ */
+
+#pragma once
+
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <drivers/drv_hrt.h>
+#include <lib/perf/perf_counter.h>
+#include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/SubscriptionMultiArray.hpp>
+#include <uORB/topics/actuator_motors.h>
+#include <uORB/topics/actuator_outputs.h>
+#include <uORB/topics/control_latency.h>
+#include <uORB/topics/sensor_gyro_fifo.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_torque_setpoint.h>
+
+class ControlLatency : public ModuleBase<ControlLatency>, public px4::ScheduledWorkItem
+{
+public:
+	ControlLatency();
+	~ControlLatency() override;
+
+	/** @see ModuleBase */
+	static int task_spawn(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int custom_command(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int print_usage(const char *reason = nullptr);
+
+	bool init();
+
+	int print_status() override;
+
+private:
+	static constexpr int MAX_SENSORS = 4;
+	static constexpr int SENSOR_HISTORY = 8;
+	static constexpr int STAGES = control_latency_s::STAGE_COUNT;
+	static constexpr int HISTOGRAM_BINS = 16; // bin i counts latencies in [2^i, 2^(i+1)) us, bin 0 also < 1 us
+
+	void Run() override;
+
+	void UpdateStatistics(const control_latency_s &control_latency);
+
+	struct SampleTimestamp {
+		hrt_abstime timestamp_sample;
+		hrt_abstime timestamp;
+	};
+
+	struct StageStatistics {
+		uint32_t histogram[HISTOGRAM_BINS];
+		uint64_t sum;
+		uint32_t max;
+	};
+
+	uORB::SubscriptionCallbackWorkItem _actuator_outputs_sub{this, ORB_ID(actuator_outputs)};
+
+	uORB::Subscription _actuator_motors_sub{ORB_ID(actuator_motors)};
+	uORB::Subscription _vehicle_angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};
+	uORB::Subscription _vehicle_torque_setpoint_sub{ORB_ID(vehicle_torque_setpoint)};
+	uORB::SubscriptionMultiArray<sensor_gyro_fifo_s, MAX_SENSORS> _sensor_gyro_fifo_subs{ORB_ID::sensor_gyro_fifo};
+
+	uORB::Publication<control_latency_s> _control_latency_pub{ORB_ID(control_latency)};
+
+	// publication times of the recent sensor_gyro_fifo samples of all gyros
+	SampleTimestamp _sensor_history[SENSOR_HISTORY] {};
+	int _sensor_history_index{0};
+
+	// per stage latency (difference to the previous stage) and total latency in the last row
+	StageStatistics _statistics[STAGES + 1] {};
+	uint32_t _traced_count{0};
+
+	perf_counter_t _traced_perf{perf_alloc(PC_COUNT, MODULE_NAME": traced")};
+	perf_counter_t _incomplete_perf{perf_alloc(PC_COUNT, MODULE_NAME": incomplete")};
+};
@@ -48,10 +48,16 @@
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/getopt.h>
 #include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
 #include <lib/parameters/param.h>
 #include <lib/perf/perf_counter.h>
 #include <stdlib.h>
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif // CONFIG_DATAMAN_FILE_MMAP
+
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/dataman_request.h>
@@ -65,12 +71,18 @@ __END_DECLS
 
 static constexpr int TASK_STACK_SIZE = 1420;
 
+/* Writes to the file are synced once no request arrived for DM_SYNC_IDLE_MS,
+ * or at the latest DM_SYNC_MAX_DELAY_US after the first unsynced write */
+static constexpr int DM_SYNC_IDLE_MS = 50;
+static constexpr hrt_abstime DM_SYNC_MAX_DELAY_US = 500 * 1000;
+
 /* Private File based Operations */
 static ssize_t _file_write(dm_item_t item, unsigned index, const void *buf, size_t count);
 static ssize_t _file_read(dm_item_t item, unsigned index, void *buf, size_t count);
 static int  _file_clear(dm_item_t item);
 static int _file_initialize(unsigned max_offset);
 static void _file_shutdown();
+static void _file_sync();
 
 /* Private Ram based Operations */
 static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_t count);
@@ -86,6 +98,7 @@ typedef struct dm_operations_t {
 	int (*initialize)(unsigned max_offset);
 	void (*shutdown)();
 	int (*wait)(px4_sem_t *sem);
+	void (*sync)();
 } dm_operations_t;
 
 static constexpr dm_operations_t dm_file_operations = {
@@ -95,6 +108,7 @@ static constexpr dm_operations_t dm_file_operations = {
 	.initialize = _file_initialize,
 	.shutdown = _file_shutdown,
 	.wait = px4_sem_wait,
+	.sync = _file_sync,
 };
 
 static constexpr dm_operations_t dm_ram_operations = {
@@ -104,6 +118,7 @@ static constexpr dm_operations_t dm_ram_operations = {
 	.initialize = _ram_initialize,
 	.shutdown = _ram_shutdown,
 	.wait = px4_sem_wait,
+	.sync = nullptr,
 };
 
 static const dm_operations_t *g_dm_ops;
@@ -112,6 +127,9 @@ static struct {
 	union {
 		struct {
 			int fd;
+			uint8_t *map;		/* file mapped into memory, nullptr if not mapped */
+			unsigned map_size;
+			hrt_abstime dirty_since;	/* time of the first unsynced write, 0 if in sync */
 		} file;
 		struct {
 			uint8_t *data;
@@ -272,6 +290,19 @@ _file_write(dm_item_t item, unsigned index, const void *buf, size_t count)
 
 	count += DM_SECTOR_HDR_SIZE;
 
+	if (dm_operations_data.file.dirty_since == 0) {
+		dm_operations_data.file.dirty_since = hrt_absolute_time();
+	}
+
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		memcpy(&dm_operations_data.file.map[offset], buffer, count);
+		return count - DM_SECTOR_HDR_SIZE;
+	}
+
+#endif // CONFIG_DATAMAN_FILE_MMAP
+
 	bool write_success = false;
 
 	for (int i = 0; i < 2; i++) {
@@ -308,8 +339,7 @@ _file_write(dm_item_t item, unsigned index, const void *buf, size_t count)
 		return -1;
 	}
 
-	/* Make sure data is written to physical media */
-	fsync(dm_operations_data.file.fd);
+	/* The data is written to physical media by _file_sync() */
 
 	/* All is well... return the number of user data written */
 	return count - DM_SECTOR_HDR_SIZE;
@@ -381,6 +411,27 @@ _file_read(dm_item_t item, unsigned index, void *buf, size_t count)
 		return -E2BIG;
 	}
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		const uint8_t *item_buffer = &dm_operations_data.file.map[offset];
+
+		if (item_buffer[0] > count) {
+			return -1;
+		}
+
+		if (item_buffer[0] > 0) {
+			memcpy(buf, item_buffer + DM_SECTOR_HDR_SIZE, item_buffer[0]);
+
+		} else {
+			memset(buf, 0, count);
+		}
+
+		return item_buffer[0];
+	}
+
+#endif // CONFIG_DATAMAN_FILE_MMAP
+
 	int len = -1;
 	bool read_success = false;
 
@@ -489,6 +540,27 @@ _file_clear(dm_item_t item)
 		return -1;
 	}
 
+	if (dm_operations_data.file.dirty_since == 0) {
+		dm_operations_data.file.dirty_since = hrt_absolute_time();
+	}
+
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		for (i = 0; (unsigned)i < g_per_item_max_index[item]; i++) {
+			/* Only touch the pages of items that are set */
+			if (dm_operations_data.file.map[offset] != 0) {
+				dm_operations_data.file.map[offset] = 0;
+			}
+
+			offset += g_per_item_size_with_hdr[item];
+		}
+
+		return result;
+	}
+
+#endif // CONFIG_DATAMAN_FILE_MMAP
+
 	/* Clear all items of this type */
 	for (i = 0; (unsigned)i < g_per_item_max_index[item]; i++) {
 		char buf[1];
@@ -521,8 +593,6 @@ _file_clear(dm_item_t item)
 		offset += g_per_item_size_with_hdr[item];
 	}
 
-	/* Make sure data is actually written to physical media */
-	fsync(dm_operations_data.file.fd);
 	return result;
 }
 
@@ -547,6 +617,30 @@ _file_initialize(unsigned max_offset)
 		return -1;
 	}
 
+	dm_operations_data.file.map = nullptr;
+	dm_operations_data.file.dirty_since = 0;
+
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+	struct stat file_stat;
+
+	/* The mapping can only cover the existing file, extend it to the full size first */
+	if ((fstat(dm_operations_data.file.fd, &file_stat) == 0)
+	    && ((file_stat.st_size >= (off_t)max_offset) || (ftruncate(dm_operations_data.file.fd, max_offset) == 0))) {
+
+		void *map = mmap(nullptr, max_offset, PROT_READ | PROT_WRITE, MAP_SHARED, dm_operations_data.file.fd, 0);
+
+		if (map != MAP_FAILED) {
+			dm_operations_data.file.map = static_cast<uint8_t *>(map);
+			dm_operations_data.file.map_size = max_offset;
+		}
+	}
+
+	if (dm_operations_data.file.map == nullptr) {
+		PX4_WARN("Could not map data manager file, using file IO");
+	}
+
+#endif // CONFIG_DATAMAN_FILE_MMAP
+
 	dataman_compat_s compat_state{};
 
 	dm_operations_data.silence = true;
@@ -585,6 +679,8 @@ _file_initialize(unsigned max_offset)
 		g_dm_ops->write(DM_KEY_MISSION_STATE, 0, reinterpret_cast<uint8_t *>(&mission), sizeof(mission_s));
 		g_dm_ops->write(DM_KEY_FENCE_POINTS, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
 		g_dm_ops->write(DM_KEY_SAFE_POINTS, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
+
+		_file_sync();
 	}
 
 	dm_operations_data.running = true;
@@ -611,9 +707,40 @@ _ram_initialize(unsigned max_offset)
 	return 0;
 }
 
+static void
+_file_sync()
+{
+	if (dm_operations_data.file.dirty_since == 0) {
+		return;
+	}
+
+	/* Make sure data is written to physical media */
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		msync(dm_operations_data.file.map, dm_operations_data.file.map_size, MS_SYNC);
+	}
+
+#endif // CONFIG_DATAMAN_FILE_MMAP
+
+	fsync(dm_operations_data.file.fd);
+	dm_operations_data.file.dirty_since = 0;
+}
+
 static void
 _file_shutdown()
 {
+	_file_sync();
+
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		munmap(dm_operations_data.file.map, dm_operations_data.file.map_size);
+		dm_operations_data.file.map = nullptr;
+	}
+
+#endif // CONFIG_DATAMAN_FILE_MMAP
+
 	close(dm_operations_data.file.fd);
 	dm_operations_data.running = false;
 }
@@ -700,7 +827,14 @@ task_main(int argc, char *argv[])
 	/* Start the endless loop, waiting for then processing work requests */
 	while (true) {
 
-		ret = px4_poll(&fds, 1, 1000);
+		const bool sync_pending = (g_dm_ops->sync != nullptr) && (dm_operations_data.file.dirty_since != 0);
+
+		ret = px4_poll(&fds, 1, sync_pending ? DM_SYNC_IDLE_MS : 1000);
+
+		if (ret == 0 && sync_pending) {
+			/* no more requests, write everything out in one go */
+			g_dm_ops->sync();
+		}
 
 		if (ret > 0) {
 
@@ -771,6 +905,37 @@ task_main(int argc, char *argv[])
 
 					break;
 
+				case DM_READ_RANGE: {
+
+						g_func_counts[DM_READ_RANGE]++;
+						perf_begin(_dm_read_perf);
+
+						const uint8_t count = math::min(request.count, dataman_response_s::ORB_QUEUE_LENGTH);
+
+						for (uint8_t i = 0; i < count; i++) {
+							if (i > 0) {
+								// the last response is published below
+								response.timestamp = hrt_absolute_time();
+								dataman_response_pub.publish(response);
+							}
+
+							response.index = request.index + i;
+							result = g_dm_ops->read(static_cast<dm_item_t>(request.item), response.index,
+										&(response.data), request.data_length);
+
+							if (result >= 0) {
+								response.status = dataman_response_s::STATUS_SUCCESS;
+
+							} else {
+								response.status = dataman_response_s::STATUS_FAILURE_READ_FAILED;
+							}
+						}
+
+						perf_end(_dm_read_perf);
+					}
+
+					break;
+
 				case DM_CLEAR:
 
 					g_func_counts[DM_CLEAR]++;
@@ -792,6 +957,12 @@ task_main(int argc, char *argv[])
 
 				response.timestamp = hrt_absolute_time();
 				dataman_response_pub.publish(response);
+
+				/* don't defer syncing forever during a long upload */
+				if ((g_dm_ops->sync != nullptr) && (dm_operations_data.file.dirty_since != 0)
+				    && (hrt_elapsed_time(&dm_operations_data.file.dirty_since) > DM_SYNC_MAX_DELAY_US)) {
+					g_dm_ops->sync();
+				}
 			}
 		}
 
@@ -850,6 +1021,7 @@ status()
 	/* display usage statistics */
 	PX4_INFO("Writes   %u", g_func_counts[DM_WRITE]);
 	PX4_INFO("Reads    %u", g_func_counts[DM_READ]);
+	PX4_INFO("Range reads %u", g_func_counts[DM_READ_RANGE]);
 	PX4_INFO("Clears   %u", g_func_counts[DM_CLEAR]);
 
 	perf_print_counter(_dm_read_perf);
@@ -880,6 +1052,10 @@ Each type has a specific type and a fixed maximum amount of storage items, so th
 ### Implementation
 Reading and writing a single item is always atomic.
 
+Writes to the file backend are synced to the storage once no further request arrives within 50 ms (at the latest
+after 500 ms), so that uploads of many items don't wait for the storage after every item.
+With `DATAMAN_FILE_MMAP` the file is mapped into memory and items are accessed without any file IO.
+
 **DM_KEY_FENCE_POINTS** and **DM_KEY_SAFE_POINTS** items: the first data element is a `mission_stats_entry_s` struct,
 which stores the number of items for these types. These items are always updated atomically in one transaction (from
 the mavlink mission manager).
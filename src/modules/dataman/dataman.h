@@ -59,6 +59,7 @@ typedef enum {
 	DM_WRITE,			///< Write index for given item
 	DM_READ,			///< Read index for given item
 	DM_CLEAR,			///< Clear all index for given item
+	DM_READ_RANGE,		///< Read consecutive indices for given item, one response per index
 	DM_NUMBER_OF_FUNCS
 } dm_function_t;
 
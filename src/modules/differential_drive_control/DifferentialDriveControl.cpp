@@ -47,7 +47,12 @@ DifferentialDriveControl::DifferentialDriveControl() :
 
 bool DifferentialDriveControl::init()
 {
-	ScheduleOnInterval(10_ms); // 100 Hz
+	if (!_differential_drive_setpoint_sub.registerCallback() || !_manual_control_setpoint_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
+	ScheduleNow();
 	return true;
 }
 
@@ -65,12 +70,18 @@ void DifferentialDriveControl::updateParams()
 void DifferentialDriveControl::Run()
 {
 	if (should_exit()) {
+		_differential_drive_setpoint_sub.unregisterCallback();
+		_manual_control_setpoint_sub.unregisterCallback();
 		ScheduleClear();
 		exit_and_cleanup();
+		return;
 	}
 
 	hrt_abstime now = hrt_absolute_time();
 
+	// fallback if no setpoints arrive, at least 100 Hz to stop on timeouts
+	ScheduleDelayed(10_ms);
+
 	if (_parameter_update_sub.updated()) {
 		parameter_update_s pupdate;
 		_parameter_update_sub.copy(&pupdate);
@@ -103,7 +114,12 @@ void DifferentialDriveControl::Run()
 		}
 	}
 
-	_differential_drive_setpoint_sub.update(&_differential_drive_setpoint);
+	const bool setpoint_updated = _differential_drive_setpoint_sub.update(&_differential_drive_setpoint);
+
+	if (!setpoint_updated && (now < _last_actuator_motors_publish + 10_ms)) {
+		// scheduled by our own setpoint publication, already handled
+		return;
+	}
 
 	// publish data to actuator_motors (output module)
 	// get the wheel speeds from the inverse kinematics class (DifferentialDriveKinematics)
@@ -126,6 +142,7 @@ void DifferentialDriveControl::Run()
 	wheel_speeds.copyTo(actuator_motors.control);
 	actuator_motors.timestamp = now;
 	_actuator_motors_pub.publish(actuator_motors);
+	_last_actuator_motors_publish = now;
 }
 
 int DifferentialDriveControl::task_spawn(int argc, char *argv[])
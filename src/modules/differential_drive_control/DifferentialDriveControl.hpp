@@ -50,6 +50,7 @@
 #include <uORB/topics/vehicle_control_mode.h>
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 #include <uORB/SubscriptionMultiArray.hpp>
 #include <uORB/topics/differential_drive_setpoint.h>
 
@@ -86,8 +87,9 @@ protected:
 private:
 	void Run() override;
 
-	uORB::Subscription _differential_drive_setpoint_sub{ORB_ID(differential_drive_setpoint)};
-	uORB::Subscription _manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};
+	// run on new setpoints, with a fallback rate for timeouts and disarming
+	uORB::SubscriptionCallbackWorkItem _differential_drive_setpoint_sub{this, ORB_ID(differential_drive_setpoint)};
+	uORB::SubscriptionCallbackWorkItem _manual_control_setpoint_sub{this, ORB_ID(manual_control_setpoint)};
 	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
 	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
@@ -98,6 +100,8 @@ private:
 	differential_drive_setpoint_s _differential_drive_setpoint{};
 	DifferentialDriveKinematics _differential_drive_kinematics{};
 
+	hrt_abstime _last_actuator_motors_publish{0};
+
 	bool _armed = false;
 	bool _manual_driving = false;
 	float _max_speed{0.f};
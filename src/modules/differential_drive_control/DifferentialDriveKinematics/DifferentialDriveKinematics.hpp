@@ -34,6 +34,7 @@
 #pragma once
 
 #include <matrix/matrix/math.hpp>
+#include <lib/rover_kinematics/RoverKinematics.hpp>
 
 /**
  * @brief Differential Drive Kinematics class for computing the kinematics of a differential drive robot.
@@ -41,11 +42,11 @@
  * This class provides functions to set the wheel base and radius, and to compute the inverse kinematics
  * given linear velocity and yaw rate.
  */
-class DifferentialDriveKinematics
+class DifferentialDriveKinematics : public RoverKinematics
 {
 public:
 	DifferentialDriveKinematics() = default;
-	~DifferentialDriveKinematics() = default;
+	~DifferentialDriveKinematics() override = default;
 
 	/**
 	 * @brief Sets the wheel base of the robot.
@@ -75,7 +76,7 @@ public:
 	 * @param yaw_rate Yaw rate of the robot.
 	 * @return matrix::Vector2f Motor velocities for the right and left motors.
 	 */
-	matrix::Vector2f computeInverseKinematics(float linear_velocity_x, float yaw_rate);
+	matrix::Vector2f computeInverseKinematics(float linear_velocity_x, float yaw_rate) override;
 
 private:
 	float _wheel_base{0.f};
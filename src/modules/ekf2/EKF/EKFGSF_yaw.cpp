@@ -84,6 +84,10 @@ void EKFGSF_yaw::predict(const imuSample &imu_sample, bool in_air)
 		}
 	}
 
+	// terms shared by all AHRS models, only depend on the filtered accel and airspeed
+	_ahrs_accel_norm = _ahrs_accel.norm();
+	_ahrs_accel_fusion_gain = ahrsCalcAccelGain();
+
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index ++) {
 		predictEKF(model_index, imu_sample.delta_ang, imu_sample.delta_ang_dt,
 			   imu_sample.delta_vel, imu_sample.delta_vel_dt, in_air);
@@ -172,16 +176,11 @@ void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_an
 	const Dcmf R_to_body = _ahrs_ekf_gsf[model_index].R.transpose();
 	const Vector3f gravity_direction_bf = R_to_body.col(2);
 
-	const float ahrs_accel_norm = _ahrs_accel.norm();
-
-	// gain from accel vector tilt error to rate gyro correction used by AHRS calculation
-	const float ahrs_accel_fusion_gain = ahrsCalcAccelGain();
-
 	// Perform angular rate correction using accel data and reduce correction as accel magnitude moves away from 1 g (reduces drift when vehicle picked up and moved).
 	// During fixed wing flight, compensate for centripetal acceleration assuming coordinated turns and X axis forward
 	Vector3f tilt_correction{};
 
-	if (ahrs_accel_fusion_gain > 0.f) {
+	if (_ahrs_accel_fusion_gain > 0.f) {
 
 		Vector3f accel = _ahrs_accel;
 
@@ -194,7 +193,7 @@ void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_an
 			accel -= centripetal_accel_bf;
 		}
 
-		tilt_correction = (gravity_direction_bf % accel) * ahrs_accel_fusion_gain / ahrs_accel_norm;
+		tilt_correction = (gravity_direction_bf % accel) * _ahrs_accel_fusion_gain / _ahrs_accel_norm;
 	}
 
 	// Gyro bias estimation
@@ -440,13 +439,11 @@ float EKFGSF_yaw::ahrsCalcAccelGain() const
 	float attenuation = 2.f;
 	const bool centripetal_accel_compensation_enabled = PX4_ISFINITE(_true_airspeed) && (_true_airspeed > FLT_EPSILON);
 
-	const float ahrs_accel_norm = _ahrs_accel.norm();
-
-	if (centripetal_accel_compensation_enabled && (ahrs_accel_norm > CONSTANTS_ONE_G)) {
+	if (centripetal_accel_compensation_enabled && (_ahrs_accel_norm > CONSTANTS_ONE_G)) {
 		attenuation = 1.f;
 	}
 
-	const float delta_accel_g = (ahrs_accel_norm - CONSTANTS_ONE_G) / CONSTANTS_ONE_G;
+	const float delta_accel_g = (_ahrs_accel_norm - CONSTANTS_ONE_G) / CONSTANTS_ONE_G;
 	return _tilt_gain * sq(1.f - math::min(attenuation * fabsf(delta_accel_g), 1.f));
 }
 
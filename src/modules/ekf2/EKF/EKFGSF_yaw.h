@@ -112,8 +112,11 @@ private:
 
 	bool _ahrs_ekf_gsf_tilt_aligned{false};  // true the initial tilt alignment has been calculated
 	Vector3f _ahrs_accel{0.f, 0.f, 0.f};     // low pass filtered body frame specific force vector used by AHRS calculation (m/s/s)
+	float _ahrs_accel_norm{0.f};             // length of _ahrs_accel, computed once per prediction for all models (m/s/s)
+	float _ahrs_accel_fusion_gain{0.f};      // gain from accel vector tilt error to rate gyro correction, shared by all models (1/sec)
 
 	// calculate the gain from gravity vector misalingment to tilt correction to be used by all AHRS filters
+	// requires _ahrs_accel_norm to be up to date
 	float ahrsCalcAccelGain() const;
 
 	// update specified AHRS rotation matrix using IMU and optionally true airspeed data
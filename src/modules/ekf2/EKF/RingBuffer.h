@@ -43,6 +43,11 @@
 #include <inttypes.h>
 #include <cstdio>
 #include <cstring>
+#include <new>
+
+#if defined(CONFIG_EKF2_BUFFER_POOL)
+# include "ring_buffer_pool.hpp"
+#endif // CONFIG_EKF2_BUFFER_POOL
 
 template <typename data_type>
 class RingBuffer
@@ -50,7 +55,7 @@ class RingBuffer
 public:
 	explicit RingBuffer(size_t size) { allocate(size); }
 	RingBuffer() = delete;
-	~RingBuffer() { delete[] _buffer; }
+	~RingBuffer() { releaseStorage(_buffer, _size); }
 
 	// no copy, assignment, move, move assignment
 	RingBuffer(const RingBuffer &) = delete;
@@ -70,12 +75,13 @@ public:
 		}
 
 		if (_buffer != nullptr) {
-			delete[] _buffer;
+			releaseStorage(_buffer, _size);
 		}
 
-		_buffer = new data_type[size] {};
+		_buffer = allocateStorage(size);
 
 		if (_buffer == nullptr) {
+			_size = 0;
 			return false;
 		}
 
@@ -183,6 +189,42 @@ public:
 	}
 
 private:
+	static data_type *allocateStorage(uint8_t size)
+	{
+#if defined(CONFIG_EKF2_BUFFER_POOL)
+		static_assert(alignof(data_type) <= RingBufferPool::kAlignment, "pool alignment insufficient");
+
+		data_type *buffer = static_cast<data_type *>(RingBufferPool::allocate(sizeof(data_type) * size));
+
+		if (buffer != nullptr) {
+			for (uint8_t i = 0; i < size; i++) {
+				new (&buffer[i]) data_type{};
+			}
+		}
+
+		return buffer;
+#else
+		return new data_type[size] {};
+#endif // CONFIG_EKF2_BUFFER_POOL
+	}
+
+	static void releaseStorage(data_type *buffer, uint8_t size)
+	{
+#if defined(CONFIG_EKF2_BUFFER_POOL)
+
+		if (buffer != nullptr) {
+			for (uint8_t i = 0; i < size; i++) {
+				buffer[i].~data_type();
+			}
+
+			RingBufferPool::release(buffer, sizeof(data_type) * size);
+		}
+
+#else
+		delete[] buffer;
+#endif // CONFIG_EKF2_BUFFER_POOL
+	}
+
 	data_type *_buffer{nullptr};
 
 	uint8_t _head{0};
@@ -44,6 +44,10 @@
 #include "ekf.h"
 #include <ekf_derivation/generated/predict_covariance.h>
 
+#if defined(CONFIG_EKF2_VECTORIZED_COVARIANCE_PREDICTION)
+# include "covariance_prediction.hpp"
+#endif // CONFIG_EKF2_VECTORIZED_COVARIANCE_PREDICTION
+
 #include <math.h>
 #include <mathlib/mathlib.h>
 
@@ -126,7 +130,11 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 
 	// predict the covariance
 	// calculate variances and upper diagonal covariances for quaternion, velocity, position and gyro bias states
+#if defined(CONFIG_EKF2_VECTORIZED_COVARIANCE_PREDICTION)
+	P = predictCovarianceVectorized(_state, P,
+#else
 	P = sym::PredictCovariance(_state.vector(), P,
+#endif // CONFIG_EKF2_VECTORIZED_COVARIANCE_PREDICTION
 		imu_delayed.delta_vel / math::max(imu_delayed.delta_vel_dt, FLT_EPSILON), accel_var,
 		imu_delayed.delta_ang / math::max(imu_delayed.delta_ang_dt, FLT_EPSILON), gyro_var,
 		0.5f * (imu_delayed.delta_vel_dt + imu_delayed.delta_ang_dt));
@@ -338,12 +346,12 @@ void Ekf::constrainStateVar(const IdxDof &state, float min, float max)
 
 // if the covariance correction will result in a negative variance, then
 // the covariance matrix is unhealthy and must be corrected
-bool Ekf::checkAndFixCovarianceUpdate(const SquareMatrixState &KHP)
+bool Ekf::checkAndFixCovarianceUpdate(const VectorState &KHP_diag)
 {
 	bool healthy = true;
 
 	for (int i = 0; i < State::size; i++) {
-		if (P(i, i) < KHP(i, i)) {
+		if (P(i, i) < KHP_diag(i)) {
 			P.uncorrelateCovarianceSetVariance<1>(i, 0.0f);
 			healthy = false;
 		}
@@ -0,0 +1,175 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file covariance_prediction.hpp
+ * @brief Row oriented covariance prediction
+ *
+ * Alternative to the generated sym::PredictCovariance() computing
+ * P_new = A * P * A^T + G * var_u * G^T from the block structure of the
+ * error state transition matrix A. Only the attitude, velocity and position
+ * rows of A differ from identity and each of them is a short linear
+ * combination of full rows of P. The inner loops therefore run over
+ * contiguous memory and are mapped by the compiler onto the SIMD unit of the
+ * target (SSE/AVX, NEON, Helium), which the scalar generated expressions are not.
+ *
+ * A and G are identical to the ones of the derivation (dt^2 terms dropped in
+ * the attitude error propagation), so both variants are equivalent to
+ * floating point rounding.
+ */
+
+#ifndef EKF_COVARIANCE_PREDICTION_HPP
+#define EKF_COVARIANCE_PREDICTION_HPP
+
+#include <cstdint>
+#include <matrix/math.hpp>
+#include <ekf_derivation/generated/state.h>
+
+namespace estimator
+{
+
+namespace covariance_prediction
+{
+
+// attitude, velocity and position errors are the only states with a non identity transition
+static constexpr unsigned KINEMATIC_SIZE = State::quat_nominal.dof + State::vel.dof + State::pos.dof;
+
+static_assert(State::quat_nominal.idx == 0 && State::vel.idx == 3 && State::pos.idx == 6,
+	      "kinematic states must be the first states");
+
+// out = A(kinematic rows, :) * in
+template <size_t N>
+inline void propagateKinematicRows(const matrix::Matrix<float, State::size, N> &in,
+				   matrix::Matrix<float, KINEMATIC_SIZE, N> &out,
+				   const matrix::Matrix3f &A_theta_theta, const matrix::Matrix3f &A_vel_theta,
+				   const matrix::Matrix3f &A_vel_accel_bias, const float dt)
+{
+	for (unsigned i = 0; i < 3; i++) {
+		const unsigned theta = State::quat_nominal.idx + i;
+		const unsigned vel = State::vel.idx + i;
+		const unsigned pos = State::pos.idx + i;
+
+		for (unsigned col = 0; col < N; col++) {
+			out(theta, col) = A_theta_theta(i, 0) * in(State::quat_nominal.idx, col)
+					  + A_theta_theta(i, 1) * in(State::quat_nominal.idx + 1, col)
+					  + A_theta_theta(i, 2) * in(State::quat_nominal.idx + 2, col)
+					  - dt * in(State::gyro_bias.idx + i, col);
+		}
+
+		for (unsigned col = 0; col < N; col++) {
+			out(vel, col) = in(vel, col)
+					+ A_vel_theta(i, 0) * in(State::quat_nominal.idx, col)
+					+ A_vel_theta(i, 1) * in(State::quat_nominal.idx + 1, col)
+					+ A_vel_theta(i, 2) * in(State::quat_nominal.idx + 2, col)
+					+ A_vel_accel_bias(i, 0) * in(State::accel_bias.idx, col)
+					+ A_vel_accel_bias(i, 1) * in(State::accel_bias.idx + 1, col)
+					+ A_vel_accel_bias(i, 2) * in(State::accel_bias.idx + 2, col);
+		}
+
+		for (unsigned col = 0; col < N; col++) {
+			out(pos, col) = in(pos, col) + dt * in(vel, col);
+		}
+	}
+}
+
+} // namespace covariance_prediction
+
+/**
+ * Same interface and result as sym::PredictCovariance(), see derivation.py
+ *
+ * @param state nominal state
+ * @param P covariance matrix before the prediction
+ * @param accel body frame specific force (m/s^2)
+ * @param accel_var accelerometer noise variance ((m/s^2)^2)
+ * @param gyro body frame angular rate (rad/s)
+ * @param gyro_var gyro noise variance ((rad/s)^2)
+ * @param dt prediction time step (s)
+ * @return predicted covariance matrix, only the upper triangle and the diagonal are valid
+ */
+inline matrix::SquareMatrix<float, State::size> predictCovarianceVectorized(const StateSample &state,
+		const matrix::SquareMatrix<float, State::size> &P,
+		const matrix::Vector3f &accel, const matrix::Vector3f &accel_var,
+		const matrix::Vector3f &gyro, const float gyro_var, const float dt)
+{
+	using namespace covariance_prediction;
+
+	const matrix::Dcmf R(state.quat_nominal);
+	const matrix::Vector3f delta_ang = (gyro - state.gyro_bias) * dt;
+	const matrix::Vector3f delta_vel = (accel - state.accel_bias) * dt;
+
+	// attitude error: I - [delta_ang]x, velocity error: -R [delta_vel]x and -R dt
+	const matrix::Matrix3f A_theta_theta = matrix::eye<float, 3>() - delta_ang.hat();
+	const matrix::Matrix3f A_vel_theta = -(R * delta_vel.hat());
+	const matrix::Matrix3f A_vel_accel_bias = -R * dt;
+
+	// the rows and columns of the stationary states are left unchanged by A
+	matrix::SquareMatrix<float, State::size> P_new = P;
+
+	// kinematic rows of A * P
+	matrix::Matrix<float, KINEMATIC_SIZE, State::size> AP;
+	propagateKinematicRows(P, AP, A_theta_theta, A_vel_theta, A_vel_accel_bias, dt);
+
+	for (unsigned row = 0; row < KINEMATIC_SIZE; row++) {
+		for (unsigned col = KINEMATIC_SIZE; col < State::size; col++) {
+			P_new(row, col) = AP(row, col);
+		}
+	}
+
+	// kinematic block of A * P * A^T, computed as (A * (A * P)^T)^T
+	matrix::Matrix<float, KINEMATIC_SIZE, KINEMATIC_SIZE> APAT;
+	propagateKinematicRows(AP.transpose(), APAT, A_theta_theta, A_vel_theta, A_vel_accel_bias, dt);
+
+	// process noise G * var_u * G^T, G being -I dt (gyro) and -R dt (accel)
+	const float dt2 = dt * dt;
+	const matrix::Matrix3f vel_noise = R * matrix::diag(accel_var) * R.T() * dt2;
+
+	for (unsigned row = 0; row < KINEMATIC_SIZE; row++) {
+		for (unsigned col = row; col < KINEMATIC_SIZE; col++) {
+			P_new(row, col) = APAT(col, row);
+		}
+	}
+
+	for (unsigned i = 0; i < 3; i++) {
+		P_new(State::quat_nominal.idx + i, State::quat_nominal.idx + i) += gyro_var * dt2;
+
+		for (unsigned j = i; j < 3; j++) {
+			P_new(State::vel.idx + i, State::vel.idx + j) += vel_noise(i, j);
+		}
+	}
+
+	return P_new;
+}
+
+} // namespace estimator
+
+#endif // !EKF_COVARIANCE_PREDICTION_HPP
@@ -478,6 +478,13 @@ void Ekf::print_status()
 	printRingBuffer("range buffer", _range_buffer);
 #endif // CONFIG_EKF2_RANGE_FINDER
 
+#if defined(CONFIG_EKF2_BUFFER_POOL)
+	RingBufferPool::print_status();
+#endif // CONFIG_EKF2_BUFFER_POOL
+
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+	SharedImuDownSampler::print_status();
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
 
 	_output_predictor.print_status();
 }
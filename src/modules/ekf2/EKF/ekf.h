@@ -480,21 +480,32 @@ public:
 		clearInhibitedStateKalmanGains(K);
 
 		const VectorState KS = K * innovation_variance;
-		SquareMatrixState KHP;
 
-		for (unsigned row = 0; row < State::size; row++) {
-			for (unsigned col = 0; col < State::size; col++) {
-				// Instad of literally computing KHP, use an equvalent
-				// equation involving less mathematical operations
-				KHP(row, col) = KS(row) * K(col);
-			}
+		// KHP = KS * K^T is only non-zero in the rows and columns of the non-zero gains,
+		// so the update only needs to touch that block of P
+		uint8_t indices[State::size];
+		const unsigned non_zeros = nonZeroKalmanGainIndices(K, indices);
+
+		VectorState KHP_diag;
+
+		for (unsigned i = 0; i < non_zeros; i++) {
+			KHP_diag(indices[i]) = KS(indices[i]) * K(indices[i]);
 		}
 
-		const bool is_healthy = checkAndFixCovarianceUpdate(KHP);
+		const bool is_healthy = checkAndFixCovarianceUpdate(KHP_diag);
 
 		if (is_healthy) {
 			// apply the covariance corrections
-			P -= KHP;
+			for (unsigned i = 0; i < non_zeros; i++) {
+				const unsigned row = indices[i];
+
+				for (unsigned j = 0; j < non_zeros; j++) {
+					const unsigned col = indices[j];
+					// Instad of literally computing KHP, use an equvalent
+					// equation involving less mathematical operations
+					P(row, col) -= KS(row) * K(col);
+				}
+			}
 
 			fixCovarianceErrors(true);
 
@@ -945,9 +956,24 @@ private:
 #endif // CONFIG_EKF2_WIND
 	}
 
+	// store the indices of the non-zero Kalman gains, returns the number of indices
+	unsigned nonZeroKalmanGainIndices(const VectorState &K, uint8_t (&indices)[State::size]) const
+	{
+		unsigned non_zeros = 0;
+
+		for (unsigned i = 0; i < State::size; i++) {
+			if (K(i) != 0.f) {
+				indices[non_zeros++] = i;
+			}
+		}
+
+		return non_zeros;
+	}
+
 	// if the covariance correction will result in a negative variance, then
 	// the covariance matrix is unhealthy and must be corrected
-	bool checkAndFixCovarianceUpdate(const SquareMatrixState &KHP);
+	// only the diagonal of the KHP correction is required for the check
+	bool checkAndFixCovarianceUpdate(const VectorState &KHP_diag);
 
 	// limit the diagonal of the covariance matrix
 	// force symmetry when the argument is true
@@ -332,9 +332,10 @@ bool Ekf::setEkfGlobalOrigin(const double latitude, const double longitude, cons
 		_gps_alt_ref = altitude;
 
 #if defined(CONFIG_EKF2_MAGNETOMETER)
-		const float mag_declination_gps = get_mag_declination_radians(latitude, longitude);
-		const float mag_inclination_gps = get_mag_inclination_radians(latitude, longitude);
-		const float mag_strength_gps = get_mag_strength_gauss(latitude, longitude);
+		float mag_declination_gps;
+		float mag_inclination_gps;
+		float mag_strength_gps;
+		get_mag_field(latitude, longitude, mag_declination_gps, mag_inclination_gps, mag_strength_gps);
 
 		if (PX4_ISFINITE(mag_declination_gps) && PX4_ISFINITE(mag_inclination_gps) && PX4_ISFINITE(mag_strength_gps)) {
 			_mag_declination_gps = mag_declination_gps;
@@ -88,26 +88,56 @@ void EstimatorInterface::setIMUData(const imuSample &imu_sample)
 	// the output observer always runs
 	_output_predictor.calculateOutputStates(imu_sample.time_us, imu_sample.delta_ang, imu_sample.delta_ang_dt, imu_sample.delta_vel, imu_sample.delta_vel_dt);
 
-	// accumulate and down-sample imu data and push to the buffer when new downsampled data becomes available
-	if (_imu_down_sampler.update(imu_sample)) {
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
 
-		_imu_updated = true;
+	if (_shared_imu_down_sampler.attached()) {
+		// the down-sampling is done once for all instances using this IMU
+		imuSample imu_down_sampled[SharedImuDownSampler::kQueueLength];
+		const int count = _shared_imu_down_sampler.update(imu_sample, _params.filter_update_interval_us, imu_down_sampled);
 
-		_imu_buffer.push(_imu_down_sampler.getDownSampledImuAndTriggerReset());
+		for (int i = 0; i < count; i++) {
+			pushDownSampledImu(imu_down_sampled[i], imu_sample.time_us);
+		}
 
-		// get the oldest data from the buffer
-		_time_delayed_us = _imu_buffer.get_oldest().time_us;
+	} else
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
 
-		// calculate the minimum interval between observations required to guarantee no loss of data
-		// this will occur if data is overwritten before its time stamp falls behind the fusion time horizon
-		_min_obs_interval_us = (imu_sample.time_us - _time_delayed_us) / (_obs_buffer_length - 1);
-	}
+		// accumulate and down-sample imu data and push to the buffer when new downsampled data becomes available
+		if (_imu_down_sampler.update(imu_sample)) {
+			pushDownSampledImu(_imu_down_sampler.getDownSampledImuAndTriggerReset(), imu_sample.time_us);
+		}
 
 #if defined(CONFIG_EKF2_DRAG_FUSION)
 	setDragData(imu_sample);
 #endif // CONFIG_EKF2_DRAG_FUSION
 }
 
+void EstimatorInterface::pushDownSampledImu(const imuSample &imu_down_sampled, uint64_t time_latest_us)
+{
+	_imu_updated = true;
+
+	_imu_buffer.push(imu_down_sampled);
+
+	// get the oldest data from the buffer
+	_time_delayed_us = _imu_buffer.get_oldest().time_us;
+
+	// calculate the minimum interval between observations required to guarantee no loss of data
+	// this will occur if data is overwritten before its time stamp falls behind the fusion time horizon
+	_min_obs_interval_us = (time_latest_us - _time_delayed_us) / (_obs_buffer_length - 1);
+}
+
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+bool EstimatorInterface::setSharedImuDownSampling(int slot)
+{
+	if (slot < 0) {
+		_shared_imu_down_sampler.detach();
+		return true;
+	}
+
+	return _shared_imu_down_sampler.attach(slot);
+}
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
+
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 void EstimatorInterface::setMagData(const magSample &mag_sample)
 {
@@ -66,6 +66,10 @@
 #include "imu_down_sampler.hpp"
 #include "output_predictor.h"
 
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+# include "shared_imu_down_sampler.hpp"
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
+
 #if defined(CONFIG_EKF2_RANGE_FINDER)
 # include "range_finder_consistency_check.hpp"
 # include "sensor_range_finder.hpp"
@@ -83,6 +87,14 @@ class EstimatorInterface
 public:
 	void setIMUData(const imuSample &imu_sample);
 
+	// delay the filter updates by a number of IMU samples relative to other instances
+	void setImuPhaseOffset(int imu_samples) { _imu_down_sampler.setPhaseOffset(imu_samples); }
+
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+	// share the IMU down-sampling with the other instances using the same IMU (slot), -1 to disable
+	bool setSharedImuDownSampling(int slot);
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
+
 #if defined(CONFIG_EKF2_GNSS)
 	void setGpsData(const gnssSample &gnss_sample);
 
@@ -489,6 +501,12 @@ protected:
 
 	void printBufferAllocationFailed(const char *buffer_name);
 
+	void pushDownSampledImu(const imuSample &imu_down_sampled, uint64_t time_latest_us);
+
 	ImuDownSampler _imu_down_sampler{_params.filter_update_interval_us};
+
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+	SharedImuDownSampler _shared_imu_down_sampler {};
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
 };
 #endif // !EKF_ESTIMATOR_INTERFACE_H
@@ -106,7 +106,10 @@ void Ekf::controlGravityFusion(const imuSample &imu)
 			_aid_src_gravity.innovation[index] = _state.quat_nominal.rotateVectorInverse(Vector3f(0.f, 0.f, -1.f))(index) - measurement(index);
 		}
 
-		VectorState K = P * H / _aid_src_gravity.innovation_variance[index];
+		// the Jacobians of all axes are only non-zero for the orientation states, don't multiply with the rest of P
+		const matrix::SparseVectorf<State::size, State::quat_nominal.idx, State::quat_nominal.idx + 1, State::quat_nominal.idx + 2>
+		H_sparse(H);
+		VectorState K = P * H_sparse / _aid_src_gravity.innovation_variance[index];
 
 		const bool accel_clipping = imu.delta_vel_clipping[0] || imu.delta_vel_clipping[1] || imu.delta_vel_clipping[2];
 
@@ -60,7 +60,22 @@ void ImuDownSampler::reset()
 	// target dt in seconds safely constrained
 	float target_dt_s = math::constrain(_target_dt_us, (int32_t)1000, (int32_t)100000) * 1e-6f;
 
-	_required_samples = math::max((int)roundf(target_dt_s / _delta_ang_dt_avg), 1);
+	const int required_samples = math::max((int)roundf(target_dt_s / _delta_ang_dt_avg), 1);
+
+	// count the periods with an unchanged number of samples to know when the IMU rate estimate has settled
+	_stable_periods = (required_samples == _required_samples) ? _stable_periods + 1 : 0;
+
+	if ((_phase_offset > 0) && (_stable_periods >= 5) && (_phase_offset % required_samples != 0)) {
+		// shift the phase once by shortening this period
+		_required_samples = required_samples - (_phase_offset % required_samples);
+		_target_dt_s = required_samples * _delta_ang_dt_avg;
+		_min_dt_s = 0.f;
+		_phase_offset = 0;
+		_stable_periods = 0;
+		return;
+	}
+
+	_required_samples = required_samples;
 
 	_target_dt_s = _required_samples * _delta_ang_dt_avg;
 
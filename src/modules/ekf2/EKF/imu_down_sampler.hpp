@@ -53,6 +53,10 @@ public:
 
 	bool update(const imuSample &imu_sample_new);
 
+	// shorten one down-sampling period by a number of IMU samples once the IMU rate estimate has settled,
+	// used to interleave the filter updates of several instances running on the same thread
+	void setPhaseOffset(int samples) { _phase_offset = samples; }
+
 	imuSample getDownSampledImuAndTriggerReset()
 	{
 		imuSample imu{_imu_down_sampled};
@@ -68,6 +72,8 @@ private:
 
 	int _accumulated_samples{0};
 	int _required_samples{1};
+	int _phase_offset{0};
+	int _stable_periods{0};
 
 	int32_t &_target_dt_us;
 
@@ -176,7 +176,13 @@ bool Ekf::fuseMag(const Vector3f &mag, estimator_aid_source3d_s &aid_src_mag, bo
 			}
 		}
 
-		VectorState Kfusion = P * H / aid_src_mag.innovation_variance[index];
+		// the Jacobians of all axes are only non-zero for the orientation, earth and body field states,
+		// don't multiply with the rest of P
+		const matrix::SparseVectorf<State::size,
+		      State::quat_nominal.idx, State::quat_nominal.idx + 1, State::quat_nominal.idx + 2,
+		      State::mag_I.idx, State::mag_I.idx + 1, State::mag_I.idx + 2,
+		      State::mag_B.idx, State::mag_B.idx + 1, State::mag_B.idx + 2> H_sparse(H);
+		VectorState Kfusion = P * H_sparse / aid_src_mag.innovation_variance[index];
 
 		if (!update_all_states) {
 			// zero non-mag Kalman gains if not updating all states
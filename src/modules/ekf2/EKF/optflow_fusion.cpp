@@ -144,7 +144,10 @@ void Ekf::fuseOptFlow()
 			}
 		}
 
-		VectorState Kfusion = P * H / _aid_src_optical_flow.innovation_variance[index];
+		// the Jacobians of both axes are only non-zero for the orientation and velocity states, don't multiply with the rest of P
+		const matrix::SparseVectorf<State::size, State::quat_nominal.idx, State::quat_nominal.idx + 1, State::quat_nominal.idx + 2,
+		      State::vel.idx, State::vel.idx + 1, State::vel.idx + 2> H_sparse(H);
+		VectorState Kfusion = P * H_sparse / _aid_src_optical_flow.innovation_variance[index];
 
 		if (measurementUpdate(Kfusion, _aid_src_optical_flow.innovation_variance[index], _aid_src_optical_flow.innovation[index])) {
 			fused[index] = true;
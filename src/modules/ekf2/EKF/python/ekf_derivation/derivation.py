@@ -199,6 +199,7 @@ def predict_covariance(
     zero_noise = {noise[key]: noise[key].zero() for key in noise.keys()}
 
     # State propagation jacobian
+    # NOTE: covariance_prediction.hpp implements the same A and G by hand, keep both in sync
     A = VTangent(state_error_pred.to_storage()).jacobian(state_error).subs(zero_state_error).subs(zero_noise)
     G = VTangent(state_error_pred.to_storage()).jacobian(noise).subs(zero_state_error).subs(zero_noise)
 
@@ -0,0 +1,213 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ring_buffer_pool.cpp
+ */
+
+#include "ring_buffer_pool.hpp"
+
+#include <new>
+#include <pthread.h>
+#include <stdio.h>
+
+namespace
+{
+
+static constexpr size_t kGranularity = 64;
+static constexpr size_t kSlabSize = 4096;
+static constexpr size_t kMaxPooledSize = 2048;
+static constexpr size_t kNumClasses = kMaxPooledSize / kGranularity;
+
+static_assert(kGranularity % RingBufferPool::kAlignment == 0, "blocks must stay aligned");
+
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+struct alignas(RingBufferPool::kAlignment) Slab {
+	Slab *next;
+	size_t used;
+};
+
+static constexpr size_t kSlabHeaderSize = (sizeof(Slab) + kGranularity - 1) / kGranularity * kGranularity;
+
+pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+FreeBlock *free_lists[kNumClasses] {};
+Slab *slabs{nullptr};
+
+size_t slab_count{0};
+size_t blocks_in_use{0};
+size_t bytes_in_use{0};
+size_t bytes_in_use_peak{0};
+
+size_t sizeClass(size_t bytes)
+{
+	return (bytes + kGranularity - 1) / kGranularity - 1;
+}
+
+size_t classSize(size_t size_class)
+{
+	return (size_class + 1) * kGranularity;
+}
+
+void pushFree(void *block, size_t size_class)
+{
+	FreeBlock *free_block = static_cast<FreeBlock *>(block);
+	free_block->next = free_lists[size_class];
+	free_lists[size_class] = free_block;
+}
+
+void *carve(size_t size_class)
+{
+	const size_t block_size = classSize(size_class);
+
+	if ((slabs == nullptr) || (slabs->used + block_size > kSlabSize)) {
+		if (slabs != nullptr) {
+			// hand the remainder of the full slab to the largest class fitting into it
+			const size_t remainder = kSlabSize - slabs->used;
+
+			if (remainder >= kGranularity) {
+				pushFree(reinterpret_cast<uint8_t *>(slabs) + slabs->used, remainder / kGranularity - 1);
+				slabs->used = kSlabSize;
+			}
+		}
+
+		uint8_t *memory = new (std::nothrow) uint8_t[kSlabSize];
+
+		if (memory == nullptr) {
+			return nullptr;
+		}
+
+		Slab *slab = reinterpret_cast<Slab *>(memory);
+		slab->next = slabs;
+		slab->used = kSlabHeaderSize;
+		slabs = slab;
+		slab_count++;
+	}
+
+	void *block = reinterpret_cast<uint8_t *>(slabs) + slabs->used;
+	slabs->used += block_size;
+	return block;
+}
+
+void releaseSlabs()
+{
+	while (slabs != nullptr) {
+		Slab *next = slabs->next;
+		delete[] reinterpret_cast<uint8_t *>(slabs);
+		slabs = next;
+	}
+
+	for (size_t i = 0; i < kNumClasses; i++) {
+		free_lists[i] = nullptr;
+	}
+
+	slab_count = 0;
+}
+
+} // namespace
+
+void *RingBufferPool::allocate(size_t bytes)
+{
+	if (bytes == 0) {
+		return nullptr;
+	}
+
+	if (bytes > kMaxPooledSize) {
+		return new (std::nothrow) uint8_t[bytes];
+	}
+
+	const size_t size_class = sizeClass(bytes);
+
+	pthread_mutex_lock(&pool_mutex);
+
+	void *block = free_lists[size_class];
+
+	if (block != nullptr) {
+		free_lists[size_class] = free_lists[size_class]->next;
+
+	} else {
+		block = carve(size_class);
+	}
+
+	if (block != nullptr) {
+		blocks_in_use++;
+		bytes_in_use += classSize(size_class);
+
+		if (bytes_in_use > bytes_in_use_peak) {
+			bytes_in_use_peak = bytes_in_use;
+		}
+	}
+
+	pthread_mutex_unlock(&pool_mutex);
+
+	return block;
+}
+
+void RingBufferPool::release(void *block, size_t bytes)
+{
+	if (block == nullptr) {
+		return;
+	}
+
+	if (bytes > kMaxPooledSize) {
+		delete[] static_cast<uint8_t *>(block);
+		return;
+	}
+
+	const size_t size_class = sizeClass(bytes);
+
+	pthread_mutex_lock(&pool_mutex);
+
+	pushFree(block, size_class);
+	blocks_in_use--;
+	bytes_in_use -= classSize(size_class);
+
+	if (blocks_in_use == 0) {
+		releaseSlabs();
+	}
+
+	pthread_mutex_unlock(&pool_mutex);
+}
+
+void RingBufferPool::print_status()
+{
+	pthread_mutex_lock(&pool_mutex);
+
+	printf("buffer pool: %zu slabs (%zu Bytes), %zu blocks in use (%zu Bytes, peak %zu Bytes)\n",
+	       slab_count, slab_count * kSlabSize, blocks_in_use, bytes_in_use, bytes_in_use_peak);
+
+	pthread_mutex_unlock(&pool_mutex);
+}
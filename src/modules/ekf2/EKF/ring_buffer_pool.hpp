@@ -0,0 +1,67 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ring_buffer_pool.hpp
+ * Shared storage pool for the delayed horizon ring buffers of all EKF instances.
+ *
+ * Buffer storage is carved from fixed size slabs and recycled through size class free lists,
+ * so that instances (re)allocating their observation buffers at runtime don't fragment the heap.
+ * The slabs are reference counted by the number of blocks in use and handed back to the heap
+ * once the last block has been released.
+ */
+
+#ifndef EKF_RING_BUFFER_POOL_HPP
+#define EKF_RING_BUFFER_POOL_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+class RingBufferPool
+{
+public:
+	static constexpr size_t kAlignment = 8;
+
+	// returns nullptr if the heap is exhausted
+	static void *allocate(size_t bytes);
+
+	// bytes must be the size passed to allocate()
+	static void release(void *block, size_t bytes);
+
+	static void print_status();
+
+private:
+	RingBufferPool() = delete;
+};
+
+#endif // !EKF_RING_BUFFER_POOL_HPP
@@ -0,0 +1,212 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file shared_imu_down_sampler.cpp
+ */
+
+#include "shared_imu_down_sampler.hpp"
+
+#include "imu_down_sampler.hpp"
+
+#include <pthread.h>
+#include <stdio.h>
+
+namespace
+{
+
+struct Slot {
+	const SharedImuDownSampler *owner{nullptr};
+	int users{0};
+
+	int32_t target_dt_us{10000};
+	ImuDownSampler down_sampler{target_dt_us};
+
+	uint64_t time_input_last_us{0};
+	uint64_t time_dropped_last_us{0}; // time of the last down-sampled sample pushed out of the queue
+
+	imuSample queue[SharedImuDownSampler::kQueueLength] {};
+	int queue_head{0}; // index of the next sample to write
+	int queue_count{0};
+
+	uint32_t samples_in{0};
+	uint32_t samples_out{0};
+	uint32_t samples_missed{0};
+};
+
+pthread_mutex_t slots_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+Slot slots[SharedImuDownSampler::kMaxSlots] {};
+
+uint64_t newestTime(const Slot &slot)
+{
+	if (slot.queue_count == 0) {
+		return 0;
+	}
+
+	const int newest = (slot.queue_head + SharedImuDownSampler::kQueueLength - 1) % SharedImuDownSampler::kQueueLength;
+	return slot.queue[newest].time_us;
+}
+
+} // namespace
+
+bool SharedImuDownSampler::attach(int slot)
+{
+	if ((slot < 0) || (slot >= kMaxSlots)) {
+		return false;
+	}
+
+	detach();
+
+	pthread_mutex_lock(&slots_mutex);
+
+	Slot &s = slots[slot];
+	s.users++;
+
+	if (s.owner == nullptr) {
+		s.owner = this;
+	}
+
+	// join at the current time, older down-sampled samples are of no use for a new instance
+	_slot = slot;
+	_time_last_us = newestTime(s);
+
+	pthread_mutex_unlock(&slots_mutex);
+
+	return true;
+}
+
+void SharedImuDownSampler::detach()
+{
+	if (_slot < 0) {
+		return;
+	}
+
+	pthread_mutex_lock(&slots_mutex);
+
+	Slot &s = slots[_slot];
+	s.users--;
+
+	if (s.owner == this) {
+		// the next instance to update takes over, continuing the same down-sampling
+		s.owner = nullptr;
+	}
+
+	if (s.users <= 0) {
+		s.down_sampler.getDownSampledImuAndTriggerReset();
+		s.users = 0;
+		s.time_input_last_us = 0;
+		s.time_dropped_last_us = 0;
+		s.queue_head = 0;
+		s.queue_count = 0;
+	}
+
+	pthread_mutex_unlock(&slots_mutex);
+
+	_slot = -1;
+	_time_last_us = 0;
+}
+
+int SharedImuDownSampler::update(const imuSample &imu_sample, int32_t target_dt_us,
+				 imuSample imu_down_sampled[kQueueLength])
+{
+	if (_slot < 0) {
+		return 0;
+	}
+
+	pthread_mutex_lock(&slots_mutex);
+
+	Slot &s = slots[_slot];
+
+	if (s.owner == nullptr) {
+		s.owner = this;
+	}
+
+	if ((s.owner == this) && (imu_sample.time_us > s.time_input_last_us)) {
+		s.time_input_last_us = imu_sample.time_us;
+		s.target_dt_us = target_dt_us;
+		s.samples_in++;
+
+		if (s.down_sampler.update(imu_sample)) {
+			if (s.queue_count == kQueueLength) {
+				s.time_dropped_last_us = s.queue[s.queue_head].time_us;
+
+			} else {
+				s.queue_count++;
+			}
+
+			s.queue[s.queue_head] = s.down_sampler.getDownSampledImuAndTriggerReset();
+			s.queue_head = (s.queue_head + 1) % kQueueLength;
+			s.samples_out++;
+		}
+	}
+
+	if (s.time_dropped_last_us > _time_last_us) {
+		// this instance fell behind by more than the queue length
+		s.samples_missed++;
+		_time_last_us = s.time_dropped_last_us;
+	}
+
+	int count = 0;
+
+	for (int i = 0; i < s.queue_count; i++) {
+		const imuSample &sample = s.queue[(s.queue_head + kQueueLength - s.queue_count + i) % kQueueLength];
+
+		// never take samples newer than the IMU data this instance has already seen
+		if ((sample.time_us > _time_last_us) && (sample.time_us <= imu_sample.time_us)) {
+			imu_down_sampled[count++] = sample;
+			_time_last_us = sample.time_us;
+		}
+	}
+
+	pthread_mutex_unlock(&slots_mutex);
+
+	return count;
+}
+
+void SharedImuDownSampler::print_status()
+{
+	pthread_mutex_lock(&slots_mutex);
+
+	for (int i = 0; i < kMaxSlots; i++) {
+		const Slot &s = slots[i];
+
+		if (s.users > 0) {
+			printf("shared IMU down-sampling %d: %d instances, %u samples in, %u out, %u missed\n",
+			       i, s.users, (unsigned)s.samples_in, (unsigned)s.samples_out, (unsigned)s.samples_missed);
+		}
+	}
+
+	pthread_mutex_unlock(&slots_mutex);
+}
@@ -0,0 +1,92 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file shared_imu_down_sampler.hpp
+ * IMU down-sampling shared by the EKF instances using the same IMU.
+ *
+ * In multi-EKF mode there is one instance per IMU and magnetometer. The instances of an IMU
+ * receive the same samples, so only the first one attached to a slot accumulates them and the
+ * resulting down-sampled samples are queued for all instances of that slot.
+ * An instance only takes samples up to the time of its latest IMU sample, so the instances
+ * can be updated in any order and on different threads.
+ */
+
+#ifndef EKF_SHARED_IMU_DOWN_SAMPLER_HPP
+#define EKF_SHARED_IMU_DOWN_SAMPLER_HPP
+
+#include <stdint.h>
+
+#include "common.h"
+
+class SharedImuDownSampler
+{
+public:
+	static constexpr int kMaxSlots = 4;
+	static constexpr int kQueueLength = 4;
+
+	SharedImuDownSampler() = default;
+	~SharedImuDownSampler() { detach(); }
+
+	// no copy, assignment, move, move assignment
+	SharedImuDownSampler(const SharedImuDownSampler &) = delete;
+	SharedImuDownSampler &operator=(const SharedImuDownSampler &) = delete;
+	SharedImuDownSampler(SharedImuDownSampler &&) = delete;
+	SharedImuDownSampler &operator=(SharedImuDownSampler &&) = delete;
+
+	// slot: index of the IMU shared by the attached instances, returns false if out of range
+	bool attach(int slot);
+	void detach();
+
+	bool attached() const { return _slot >= 0; }
+
+	/**
+	 * Add a new IMU sample and get the down-sampled samples that became available since the last call.
+	 * @param imu_sample The new IMU sample, only accumulated if this is the first instance attached to the slot.
+	 * @param target_dt_us The down-sampling period.
+	 * @param imu_down_sampled Returns up to kQueueLength down-sampled samples, oldest first.
+	 * @return Number of down-sampled samples returned.
+	 */
+	int update(const estimator::imuSample &imu_sample, int32_t target_dt_us,
+		   estimator::imuSample imu_down_sampled[kQueueLength]);
+
+	static void print_status();
+
+private:
+	int _slot{-1};
+
+	uint64_t _time_last_us{0}; // time of the last down-sampled sample taken from the queue
+};
+
+#endif // !EKF_SHARED_IMU_DOWN_SAMPLER_HPP
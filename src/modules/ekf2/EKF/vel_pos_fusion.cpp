@@ -204,21 +204,36 @@ bool Ekf::fuseVelPosHeight(const float innov, const float innov_var, const int s
 
 	clearInhibitedStateKalmanGains(Kfusion);
 
-	SquareMatrixState KHP;
+	// H only selects state_index, so KHP = K * P(state_index, :) and the rows of
+	// inhibited states stay zero. Keep a copy of the row as P is updated in place.
+	VectorState HP;
 
-	for (unsigned row = 0; row < State::size; row++) {
-		for (unsigned column = 0; column < State::size; column++) {
-			KHP(row, column) = Kfusion(row) * P(state_index, column);
-		}
+	for (unsigned column = 0; column < State::size; column++) {
+		HP(column) = P(state_index, column);
 	}
 
-	const bool healthy = checkAndFixCovarianceUpdate(KHP);
+	uint8_t indices[State::size];
+	const unsigned non_zeros = nonZeroKalmanGainIndices(Kfusion, indices);
+
+	VectorState KHP_diag;
+
+	for (unsigned i = 0; i < non_zeros; i++) {
+		KHP_diag(indices[i]) = Kfusion(indices[i]) * HP(indices[i]);
+	}
+
+	const bool healthy = checkAndFixCovarianceUpdate(KHP_diag);
 
 	setVelPosStatus(state_index, healthy);
 
 	if (healthy) {
 		// apply the covariance corrections
-		P -= KHP;
+		for (unsigned i = 0; i < non_zeros; i++) {
+			const unsigned row = indices[i];
+
+			for (unsigned column = 0; column < State::size; column++) {
+				P(row, column) -= Kfusion(row) * HP(column);
+			}
+		}
 
 		fixCovarianceErrors(true);
 
@@ -49,18 +49,20 @@ static px4::atomic<EKF2 *> _objects[EKF2_MAX_INSTANCES] {};
 static px4::atomic<EKF2Selector *> _ekf2_selector {nullptr};
 #endif // CONFIG_EKF2_MULTI_INSTANCE
 
-EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode):
+EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode, bool monitor_mode):
 	ModuleParams(nullptr),
 	ScheduledWorkItem(MODULE_NAME, config),
 	_replay_mode(replay_mode && !multi_mode),
 	_multi_mode(multi_mode),
+	_monitor_mode(monitor_mode && !multi_mode),
 	_instance(multi_mode ? -1 : 0),
-	_attitude_pub(multi_mode ? ORB_ID(estimator_attitude) : ORB_ID(vehicle_attitude)),
-	_local_position_pub(multi_mode ? ORB_ID(estimator_local_position) : ORB_ID(vehicle_local_position)),
-	_global_position_pub(multi_mode ? ORB_ID(estimator_global_position) : ORB_ID(vehicle_global_position)),
-	_odometry_pub(multi_mode ? ORB_ID(estimator_odometry) : ORB_ID(vehicle_odometry)),
+	_attitude_pub((multi_mode || monitor_mode) ? ORB_ID(estimator_attitude) : ORB_ID(vehicle_attitude)),
+	_local_position_pub((multi_mode || monitor_mode) ? ORB_ID(estimator_local_position) : ORB_ID(vehicle_local_position)),
+	_global_position_pub((multi_mode || monitor_mode) ? ORB_ID(estimator_global_position) : ORB_ID(
+				     vehicle_global_position)),
+	_odometry_pub((multi_mode || monitor_mode) ? ORB_ID(estimator_odometry) : ORB_ID(vehicle_odometry)),
 #if defined(CONFIG_EKF2_WIND)
-	_wind_pub(multi_mode ? ORB_ID(estimator_wind) : ORB_ID(wind)),
+	_wind_pub((multi_mode || monitor_mode) ? ORB_ID(estimator_wind) : ORB_ID(wind)),
 #endif // CONFIG_EKF2_WIND
 	_params(_ekf.getParamHandle()),
 	_param_ekf2_predict_us(_params->filter_update_interval_us),
@@ -370,6 +372,16 @@ bool EKF2::multi_init(int imu, int mag)
 
 		_instance = status_instance;
 
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+		// instances of the same IMU down-sample its data only once
+		static_assert(SharedImuDownSampler::kMaxSlots >= MAX_NUM_IMUS, "not enough shared IMU down-sampling slots");
+		_ekf.setSharedImuDownSampling(imu);
+#else
+		// instances of the same IMU share a work queue, interleave their filter updates
+		// so that the queue latency doesn't grow with the number of instances
+		_ekf.setImuPhaseOffset(mag);
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
+
 		ScheduleNow();
 		return true;
 	}
@@ -387,6 +399,10 @@ int EKF2::print_status()
 		     _instance, (double)_ekf.get_dt_ekf_avg(), _ekf.attitude_valid(),
 		     _ekf.local_position_is_valid(), _ekf.global_position_is_valid());
 
+	if (_monitor_mode) {
+		PX4_INFO_RAW("ekf2:%d monitor mode, publishing estimator topics only\n", _instance);
+	}
+
 	perf_print_counter(_ekf_update_perf);
 	perf_print_counter(_msg_missed_imu_perf);
 
@@ -417,6 +433,11 @@ void EKF2::Run()
 
 		VerifyParams();
 
+		if (_monitor_mode) {
+			// the external navigation system is primary, a slower filter update is sufficient to monitor it
+			_params->filter_update_interval_us = math::max(_params->filter_update_interval_us, MONITOR_FILTER_UPDATE_INTERVAL_US);
+		}
+
 #if defined(CONFIG_EKF2_GNSS)
 		_ekf.set_min_required_gps_health_time(_param_ekf2_req_gps_h.get() * 1_s);
 #endif // CONFIG_EKF2_GNSS
@@ -690,7 +711,10 @@ void EKF2::Run()
 
 		// push imu data into estimator
 		_ekf.setIMUData(imu_sample_new);
-		PublishAttitude(now); // publish attitude immediately (uses quaternion from output predictor)
+
+		if (!_monitor_mode) {
+			PublishAttitude(now); // publish attitude immediately (uses quaternion from output predictor)
+		}
 
 		// integrate time to monitor time slippage
 		if (_start_time_us > 0) {
@@ -745,6 +769,10 @@ void EKF2::Run()
 		if (_ekf.update()) {
 			perf_set_elapsed(_ekf_update_perf, hrt_elapsed_time(&ekf_update_start));
 
+			if (_monitor_mode) {
+				PublishAttitude(now);
+			}
+
 			PublishLocalPosition(now);
 			PublishOdometry(now, imu_sample_new);
 			PublishGlobalPosition(now);
@@ -791,6 +819,11 @@ void EKF2::Run()
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 			UpdateMagCalibration(now);
 #endif // CONFIG_EKF2_MAGNETOMETER
+
+		} else if (_param_ekf2_out_hr.get() && !_monitor_mode && _ekf.attitude_valid()) {
+			// high rate output: the output predictor is propagated with every IMU sample
+			PublishLocalPosition(now);
+			PublishOdometry(now, imu_sample_new);
 		}
 
 		// publish ekf2_timestamps
@@ -2676,6 +2709,9 @@ int EKF2::task_spawn(int argc, char *argv[])
 		replay_mode = true;
 	}
 
+	int32_t monitor_mode = 0;
+	param_get(param_find("EKF2_MONITOR"), &monitor_mode);
+
 #if defined(CONFIG_EKF2_MULTI_INSTANCE)
 	bool multi_mode = false;
 	int32_t imu_instances = 0;
@@ -2684,7 +2720,7 @@ int EKF2::task_spawn(int argc, char *argv[])
 	int32_t sens_imu_mode = 1;
 	param_get(param_find("SENS_IMU_MODE"), &sens_imu_mode);
 
-	if (sens_imu_mode == 0) {
+	if ((sens_imu_mode == 0) && (monitor_mode == 0)) {
 		// ekf selector requires SENS_IMU_MODE = 0
 		multi_mode = true;
 
@@ -2824,7 +2860,7 @@ int EKF2::task_spawn(int argc, char *argv[])
 
 	{
 		// otherwise launch regular
-		EKF2 *ekf2_inst = new EKF2(false, px4::wq_configurations::INS0, replay_mode);
+		EKF2 *ekf2_inst = new EKF2(false, px4::wq_configurations::INS0, replay_mode, (monitor_mode != 0) && !replay_mode);
 
 		if (ekf2_inst) {
 			_objects[0].store(ekf2_inst);
@@ -127,7 +127,7 @@ class EKF2 final : public ModuleParams, public px4::ScheduledWorkItem
 {
 public:
 	EKF2() = delete;
-	EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode);
+	EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode, bool monitor_mode = false);
 	~EKF2() override;
 
 	/** @see ModuleBase */
@@ -267,8 +267,11 @@ private:
 
 	const bool _replay_mode{false};			///< true when we use replay data from a log
 	const bool _multi_mode;
+	const bool _monitor_mode{false};		///< monitoring an external navigation system, see EKF2_MONITOR
 	int _instance{0};
 
+	static constexpr int32_t MONITOR_FILTER_UPDATE_INTERVAL_US{20000}; ///< minimum filter update period in monitor mode
+
 	px4::atomic_bool _task_should_exit{false};
 
 	// time slip monitoring
@@ -733,7 +736,8 @@ private:
 
 		// output predictor filter time constants
 		(ParamFloat<px4::params::EKF2_TAU_VEL>) _param_ekf2_tau_vel,
-		(ParamFloat<px4::params::EKF2_TAU_POS>) _param_ekf2_tau_pos
+		(ParamFloat<px4::params::EKF2_TAU_POS>) _param_ekf2_tau_pos,
+		(ParamBool<px4::params::EKF2_OUT_HR>) _param_ekf2_out_hr ///< publish the output predictor states at the IMU rate
 	)
 };
 #endif // !EKF2_HPP
@@ -1098,6 +1098,31 @@ PARAM_DEFINE_FLOAT(EKF2_TAU_VEL, 0.25f);
  */
 PARAM_DEFINE_FLOAT(EKF2_TAU_POS, 0.25f);
 
+/**
+ * High rate output
+ *
+ * If enabled, the local position and odometry are published for every IMU sample using the states of the output
+ * predictor, instead of only after a filter update (EKF2_PREDICT_US). This reduces the latency of the velocity and
+ * position estimates used by the controllers. The attitude is always published for every IMU sample.
+ *
+ * @group EKF2
+ * @boolean
+ */
+PARAM_DEFINE_INT32(EKF2_OUT_HR, 0);
+
+/**
+ * Monitor mode
+ *
+ * Run a single EKF2 instance as a monitor of an external navigation system that publishes the vehicle attitude
+ * and position itself (e.g. VN_MODE 2). The estimates are only published on the estimator topics, no estimator
+ * selector is started and the filter update period is at least 20 ms.
+ *
+ * @group EKF2
+ * @boolean
+ * @reboot_required true
+ */
+PARAM_DEFINE_INT32(EKF2_MONITOR, 0);
+
 /**
  * 1-sigma IMU gyro switch-on bias
  *
@@ -0,0 +1,290 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file benchmark_EKF_replay.cpp
+ * Replay throughput benchmark of the EKF.
+ *
+ * Replays the sensor data csv files (see test/replay_data) through the filter
+ * and prints one JSON object per file and fusion configuration:
+ * - time per filter update (mean and max, wall clock of Ekf::update())
+ * - peak stack usage of the thread running the filter
+ * - heap allocations (number and peak bytes) during the replay
+ * The cost of a fusion type is the difference to the "baseline" configuration
+ * (IMU, baro and mag only) and is reported as "delta_ns_per_update".
+ *
+ * Usage: ekf2_replay_benchmark [repetitions] [replay csv files ...]
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <pthread.h>
+
+#include "EKF/ekf.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+
+static std::atomic<bool> heap_tracking{false};
+static std::atomic<uint64_t> heap_allocations{0};
+static std::atomic<int64_t> heap_bytes{0};
+static std::atomic<int64_t> heap_peak_bytes{0};
+
+struct alignas(max_align_t) AllocationHeader {
+	size_t size;
+};
+
+void *operator new (size_t size)
+{
+	AllocationHeader *header = static_cast<AllocationHeader *>(malloc(sizeof(AllocationHeader) + size));
+
+	if (header == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	header->size = size;
+
+	if (heap_tracking) {
+		heap_allocations++;
+		const int64_t bytes = heap_bytes += size;
+		int64_t peak = heap_peak_bytes;
+
+		while (bytes > peak && !heap_peak_bytes.compare_exchange_weak(peak, bytes)) {}
+	}
+
+	return header + 1;
+}
+
+void operator delete (void *ptr) noexcept
+{
+	if (ptr != nullptr) {
+		AllocationHeader *header = static_cast<AllocationHeader *>(ptr) - 1;
+
+		if (heap_tracking) {
+			heap_bytes -= header->size;
+		}
+
+		free(header);
+	}
+}
+
+void *operator new[](size_t size) { return operator new (size); }
+void operator delete[](void *ptr) noexcept { operator delete (ptr); }
+void operator delete (void *ptr, size_t) noexcept { operator delete (ptr); }
+void operator delete[](void *ptr, size_t) noexcept { operator delete (ptr); }
+
+enum class FusionConfig {
+	BASELINE,
+	GPS,
+};
+
+static const char *fusionConfigName(FusionConfig config)
+{
+	switch (config) {
+	case FusionConfig::BASELINE: return "baseline";
+
+	case FusionConfig::GPS: return "gps";
+	}
+
+	return "unknown";
+}
+
+struct BenchmarkCase {
+	const char *file;
+	FusionConfig config;
+	int repetitions;
+
+	// results
+	SensorSimulator::UpdateStatistics stats;
+	uint64_t heap_allocations;
+	int64_t heap_peak_bytes;
+	size_t stack_peak_bytes;
+};
+
+static constexpr size_t BENCHMARK_STACK_SIZE = 256 * 1024;
+static constexpr uint8_t STACK_PAINT = 0xA5;
+
+static void runReplay(BenchmarkCase &run)
+{
+	std::shared_ptr<Ekf> ekf = std::make_shared<Ekf>();
+	SensorSimulator sensor_simulator(ekf);
+	EkfWrapper ekf_wrapper(ekf);
+
+	sensor_simulator.loadSensorDataFromFile(run.file);
+
+	// By default the IMU, Baro and Mag sensor simulators are already running
+	if (run.config == FusionConfig::GPS) {
+		sensor_simulator.startGps();
+		ekf_wrapper.enableGpsFusion();
+	}
+
+	sensor_simulator.enableUpdateTiming(true);
+
+	// the heap is only tracked during the replay, not while loading the data
+	heap_bytes = 0;
+	heap_peak_bytes = 0;
+	heap_allocations = 0;
+	heap_tracking = true;
+
+	const uint64_t end_time = sensor_simulator.getReplayEndTime();
+
+	if (end_time > sensor_simulator.getTime()) {
+		sensor_simulator.runReplayMicroseconds(end_time - sensor_simulator.getTime());
+	}
+
+	heap_tracking = false;
+
+	run.stats = sensor_simulator.getUpdateStatistics();
+	run.heap_allocations = heap_allocations;
+	run.heap_peak_bytes = heap_peak_bytes;
+}
+
+static void *benchmarkThread(void *arg)
+{
+	BenchmarkCase &run = *static_cast<BenchmarkCase *>(arg);
+
+	SensorSimulator::UpdateStatistics total{};
+	uint64_t allocations = 0;
+	int64_t peak_bytes = 0;
+
+	for (int i = 0; i < run.repetitions; i++) {
+		runReplay(run);
+		total.updates += run.stats.updates;
+		total.total_ns += run.stats.total_ns;
+		total.max_ns = std::max(total.max_ns, run.stats.max_ns);
+		allocations = std::max(allocations, run.heap_allocations);
+		peak_bytes = std::max(peak_bytes, run.heap_peak_bytes);
+	}
+
+	run.stats = total;
+	run.heap_allocations = allocations;
+	run.heap_peak_bytes = peak_bytes;
+
+	return nullptr;
+}
+
+static bool runOnPaintedStack(BenchmarkCase &run)
+{
+	// run on an own stack painted with a known pattern, the untouched part
+	// gives the peak stack usage (the stack grows downwards)
+	uint8_t *stack = static_cast<uint8_t *>(aligned_alloc(4096, BENCHMARK_STACK_SIZE));
+
+	if (stack == nullptr) {
+		return false;
+	}
+
+	memset(stack, STACK_PAINT, BENCHMARK_STACK_SIZE);
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstack(&attr, stack, BENCHMARK_STACK_SIZE);
+
+	pthread_t thread;
+	bool success = (pthread_create(&thread, &attr, benchmarkThread, &run) == 0);
+
+	if (success) {
+		pthread_join(thread, nullptr);
+
+		size_t unused = 0;
+
+		while (unused < BENCHMARK_STACK_SIZE && stack[unused] == STACK_PAINT) {
+			unused++;
+		}
+
+		run.stack_peak_bytes = BENCHMARK_STACK_SIZE - unused;
+	}
+
+	pthread_attr_destroy(&attr);
+	free(stack);
+
+	return success;
+}
+
+static double nsPerUpdate(const SensorSimulator::UpdateStatistics &stats)
+{
+	return (stats.updates > 0) ? (double)stats.total_ns / (double)stats.updates : 0.0;
+}
+
+int main(int argc, char **argv)
+{
+	int repetitions = 3;
+	std::vector<const char *> files;
+
+	if (argc > 1) {
+		repetitions = std::max(atoi(argv[1]), 1);
+	}
+
+	for (int i = 2; i < argc; i++) {
+		files.push_back(argv[i]);
+	}
+
+	if (files.empty()) {
+		files.push_back(TEST_DATA_PATH"/replay_data/iris_gps.csv");
+		files.push_back(TEST_DATA_PATH"/replay_data/ekf_gsf_reset.csv");
+	}
+
+	printf("{\"benchmark\": \"ekf2_replay\", \"sizeof_ekf\": %zu, \"state_size\": %u, \"repetitions\": %d}\n",
+	       sizeof(Ekf), (unsigned)State::size, repetitions);
+
+	for (const char *file : files) {
+		double baseline_ns_per_update = 0.0;
+
+		for (FusionConfig config : {FusionConfig::BASELINE, FusionConfig::GPS}) {
+			BenchmarkCase run{};
+			run.file = file;
+			run.config = config;
+			run.repetitions = repetitions;
+
+			if (!runOnPaintedStack(run)) {
+				fprintf(stderr, "failed to run benchmark for %s\n", file);
+				return 1;
+			}
+
+			const double ns_per_update = nsPerUpdate(run.stats);
+
+			if (config == FusionConfig::BASELINE) {
+				baseline_ns_per_update = ns_per_update;
+			}
+
+			printf("{\"benchmark\": \"ekf2_replay\", \"file\": \"%s\", \"fusion\": \"%s\", \"updates\": %llu, \"ns_per_update\": %.1f, "
+			       "\"max_ns_per_update\": %llu, \"delta_ns_per_update\": %.1f, \"stack_peak_bytes\": %zu, "
+			       "\"heap_allocations\": %llu, \"heap_peak_bytes\": %lld}\n",
+			       file, fusionConfigName(config), (unsigned long long)run.stats.updates, ns_per_update,
+			       (unsigned long long)run.stats.max_ns, ns_per_update - baseline_ns_per_update, run.stack_peak_bytes,
+			       (unsigned long long)run.heap_allocations, (long long)run.heap_peak_bytes);
+		}
+	}
+
+	return 0;
+}
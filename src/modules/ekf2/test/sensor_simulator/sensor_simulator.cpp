@@ -164,11 +164,28 @@ void SensorSimulator::runMicroseconds(uint32_t duration)
 			}
 
 			// Update at IMU rate
-			_ekf->update();
+			updateEkf();
 		}
 	}
 }
 
+void SensorSimulator::updateEkf()
+{
+	if (!_measure_update_time) {
+		_ekf->update();
+		return;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	_ekf->update();
+	const uint64_t duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+				     start).count();
+
+	_update_statistics.updates++;
+	_update_statistics.total_ns += duration_ns;
+	_update_statistics.max_ns = std::max(_update_statistics.max_ns, duration_ns);
+}
+
 void SensorSimulator::updateSensors()
 {
 	_imu.update(_time);
@@ -207,7 +224,7 @@ void SensorSimulator::runReplayMicroseconds(uint32_t duration)
 				_ekf->set_vehicle_at_rest(false);
 			}
 
-			_ekf->update();
+			updateEkf();
 		}
 	}
 }
@@ -334,7 +351,7 @@ void SensorSimulator::runTrajectoryMicroseconds(uint32_t duration)
 				_ekf->set_vehicle_at_rest(false);
 			}
 
-			_ekf->update();
+			updateEkf();
 		}
 	}
 }
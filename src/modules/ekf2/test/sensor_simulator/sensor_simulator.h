@@ -49,6 +49,8 @@
 #include <sstream>
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <chrono>
 #include <motion_planning/VelocitySmoothing.hpp>
 
 #include "imu.h"
@@ -118,6 +120,18 @@ public:
 	void setOrientation(const Dcmf &orientation) { _R_body_to_world = orientation; }
 
 	void loadSensorDataFromFile(std::string filename);
+	// timestamp of the last replay sample, do not replay beyond it
+	uint64_t getReplayEndTime() const { return _replay_data.empty() ? 0 : _replay_data.back().timestamp; }
+
+	struct UpdateStatistics {
+		uint64_t updates{0};
+		uint64_t total_ns{0};
+		uint64_t max_ns{0};
+	};
+
+	// measure the duration of every filter update (off by default)
+	void enableUpdateTiming(bool enable) { _measure_update_time = enable; }
+	const UpdateStatistics &getUpdateStatistics() const { return _update_statistics; }
 
 	Airspeed    _airspeed;
 	Baro        _baro;
@@ -138,9 +152,13 @@ private:
 	void setSensorDataFromTrajectory();
 	void startBasicSensor();
 	void updateSensors();
+	void updateEkf();
 
 	std::shared_ptr<Ekf> _ekf{nullptr};
 
+	bool _measure_update_time{false};
+	UpdateStatistics _update_statistics{};
+
 	std::vector<sensor_info> _replay_data{};
 
 	bool _has_replay_data{false};
@@ -0,0 +1,71 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include "EKF/ekf.h"
+#include "EKF/covariance_prediction.hpp"
+#include "test_helper/comparison_helper.h"
+
+#include "../EKF/python/ekf_derivation/generated/predict_covariance.h"
+
+using namespace matrix;
+
+TEST(CovariancePredictionGenerated, vectorizedEquivalence)
+{
+	for (int i = 0; i < 100; i++) {
+		// GIVEN: a random state, covariance and IMU sample
+		StateSample state{};
+		state.quat_nominal = Eulerf(2.f * M_PI_F * (randf() - 0.5f), M_PI_F * (randf() - 0.5f), 2.f * M_PI_F * randf());
+		state.gyro_bias = 0.01f * Vector3f(randf() - 0.5f, randf() - 0.5f, randf() - 0.5f);
+		state.accel_bias = 0.1f * Vector3f(randf() - 0.5f, randf() - 0.5f, randf() - 0.5f);
+
+		const SquareMatrixState P = createRandomCovarianceMatrix();
+		const Vector3f accel(randf() - 0.5f, randf() - 0.5f, -CONSTANTS_ONE_G + randf() - 0.5f);
+		const Vector3f accel_var = 0.1f * Vector3f(randf(), randf(), randf());
+		const Vector3f gyro(randf() - 0.5f, randf() - 0.5f, randf() - 0.5f);
+		const float gyro_var = 0.01f * randf();
+		const float dt = 0.01f;
+
+		// WHEN: predicting the covariance with the generated and the vectorized kernel
+		const SquareMatrixState P_generated = sym::PredictCovariance(state.vector(), P, accel, accel_var, gyro, gyro_var, dt);
+		const SquareMatrixState P_vectorized = predictCovarianceVectorized(state, P, accel, accel_var, gyro, gyro_var, dt);
+
+		// THEN: the upper triangles are equal up to floating point rounding
+		for (int row = 0; row < State::size; row++) {
+			for (int col = row; col < State::size; col++) {
+				EXPECT_NEAR(P_generated(row, col), P_vectorized(row, col), 1e-5f * (1.f + fabsf(P_generated(row, col))))
+						<< "row = " << row << " col = " << col;
+			}
+		}
+	}
+}
@@ -217,3 +217,100 @@ TEST_F(EkfImuSamplingTest, gyroDownSampling)
 	EXPECT_TRUE(matrix::isEqual(ang_vel * 0.008f, output_sample.delta_ang, 1e-10f));
 	EXPECT_TRUE(matrix::isEqual(accel * 0.008f, output_sample.delta_vel, 1e-10f));
 }
+
+TEST(ImuDownSamplerTest, phaseOffsetInterleavesUpdates)
+{
+	// GIVEN: two down samplers fed with the same 400 Hz IMU data, one of them phase shifted
+	int32_t target_dt_us = 10000;
+	ImuDownSampler sampler{target_dt_us};
+	ImuDownSampler sampler_shifted{target_dt_us};
+	sampler_shifted.setPhaseOffset(2);
+
+	imuSample imu_sample{};
+	imu_sample.delta_ang_dt = 0.0025f;
+	imu_sample.delta_vel_dt = 0.0025f;
+
+	int outputs = 0;
+	int outputs_shifted = 0;
+	int outputs_simultaneous = 0;
+
+	for (int i = 0; i < 400; i++) {
+		imu_sample.time_us += 2500;
+
+		const bool output = sampler.update(imu_sample);
+		const bool output_shifted = sampler_shifted.update(imu_sample);
+
+		if (output) {
+			sampler.getDownSampledImuAndTriggerReset();
+		}
+
+		if (output_shifted) {
+			sampler_shifted.getDownSampledImuAndTriggerReset();
+		}
+
+		// WHEN: the IMU rate estimate has settled
+		if (i >= 200) {
+			outputs += output;
+			outputs_shifted += output_shifted;
+			outputs_simultaneous += output && output_shifted;
+		}
+	}
+
+	// THEN: both run at the same rate, but never on the same IMU sample
+	EXPECT_EQ(outputs, 50);
+	EXPECT_EQ(outputs_shifted, 50);
+	EXPECT_EQ(outputs_simultaneous, 0);
+}
+
+#if defined(CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING)
+TEST(SharedImuDownSamplerTest, instancesTakeTheSameSamples)
+{
+	// GIVEN: two instances sharing the down-sampling of an IMU and one down-sampling on its own
+	Ekf *ekf_first = new Ekf{};
+	Ekf *ekf_second = new Ekf{};
+	Ekf *ekf_private = new Ekf{};
+
+	EXPECT_TRUE(ekf_first->setSharedImuDownSampling(0));
+	EXPECT_TRUE(ekf_second->setSharedImuDownSampling(0));
+
+	imuSample imu_sample{};
+	imu_sample.delta_ang_dt = 0.0025f;
+	imu_sample.delta_vel_dt = 0.0025f;
+
+	for (int i = 0; i < 400; i++) {
+		imu_sample.time_us += 2500;
+		imu_sample.delta_ang = Vector3f(0.1f, -0.2f, 0.3f) * sinf(i * 0.05f) * imu_sample.delta_ang_dt;
+		imu_sample.delta_vel = Vector3f(0.5f, 0.f, -9.81f) * imu_sample.delta_vel_dt;
+
+		// WHEN: the instance doing the down-sampling goes away halfway through
+		if (i == 200) {
+			delete ekf_first;
+			ekf_first = nullptr;
+		}
+
+		if (ekf_first != nullptr) {
+			ekf_first->setIMUData(imu_sample);
+		}
+
+		ekf_second->setIMUData(imu_sample);
+
+		ekf_private->setIMUData(imu_sample);
+
+		// THEN: the delayed horizon is the same as with the private down-sampling, the second instance taking over
+		const imuSample &expected = ekf_private->get_imu_sample_delayed();
+
+		for (const Ekf *ekf : {ekf_first, ekf_second}) {
+			if (ekf != nullptr) {
+				const imuSample &imu_delayed = ekf->get_imu_sample_delayed();
+				EXPECT_EQ(imu_delayed.time_us, expected.time_us);
+				EXPECT_TRUE(matrix::isEqual(imu_delayed.delta_ang, expected.delta_ang, 1e-10f));
+				EXPECT_TRUE(matrix::isEqual(imu_delayed.delta_vel, expected.delta_vel, 1e-10f));
+			}
+		}
+	}
+
+	delete ekf_first;
+	delete ekf_second;
+	delete ekf_private;
+}
+#endif // CONFIG_EKF2_SHARED_IMU_DOWN_SAMPLING
@@ -158,3 +158,25 @@ TEST_F(EkfRingBufferTest, reallocateBuffer)
 	EXPECT_EQ(3, _buffer->get_length());
 
 }
+
+#if defined(CONFIG_EKF2_BUFFER_POOL)
+TEST_F(EkfRingBufferTest, pooledStorageReused)
+{
+	// GIVEN: a second buffer of the same size class which gets released again
+	RingBuffer<sample> *other = new RingBuffer<sample>(3);
+	const sample *released = &(*other)[0];
+	delete other;
+
+	// WHEN: another buffer of the same size is allocated
+	RingBuffer<sample> reused(3);
+
+	// THEN: it should get the released storage, zero initialised
+	EXPECT_EQ(released, &reused[0]);
+	EXPECT_EQ(0, reused.entries());
+
+	reused.push(_x);
+	sample pop = {};
+	EXPECT_EQ(true, reused.pop_first_older_than(_x.time_us, &pop));
+	EXPECT_EQ(_x.data[0], pop.data[0]);
+}
+#endif // CONFIG_EKF2_BUFFER_POOL
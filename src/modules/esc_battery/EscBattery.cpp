@@ -80,6 +80,22 @@ EscBattery::Run()
 		parameters_updated();
 	}
 
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+	esc_telemetry_s esc_telemetry;
+
+	if (_esc_status_sub.copy(&esc_telemetry)) {
+
+		if (esc_telemetry.esc_count == 0) {
+			return;
+		}
+
+		_battery.setConnected(true);
+		_battery.updateVoltage(esc_telemetry.average_voltage);
+		_battery.updateCurrent(esc_telemetry.total_current);
+		_battery.updateAndPublishBatteryStatus(esc_telemetry.timestamp_sample);
+	}
+
+#else
 	esc_status_s esc_status;
 
 	if (_esc_status_sub.copy(&esc_status)) {
@@ -106,6 +122,8 @@ EscBattery::Run()
 		_battery.updateCurrent(total_current_a);
 		_battery.updateAndPublishBatteryStatus(esc_status.timestamp);
 	}
+
+#endif
 }
 
 int EscBattery::task_spawn(int argc, char *argv[])
@@ -43,6 +43,7 @@
 #include <uORB/SubscriptionInterval.hpp>
 #include <uORB/SubscriptionCallback.hpp>
 #include <uORB/topics/esc_status.h>
+#include <uORB/topics/esc_telemetry.h>
 #include <uORB/topics/parameter_update.h>
 #include <battery/battery.h>
 
@@ -71,7 +72,12 @@ private:
 	void parameters_updated();
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+	// voltage and current already aggregated by the sensors module
+	uORB::SubscriptionCallbackWorkItem _esc_status_sub{this, ORB_ID(esc_telemetry)};
+#else
 	uORB::SubscriptionCallbackWorkItem _esc_status_sub{this, ORB_ID(esc_status)};
+#endif
 
 	static constexpr uint32_t ESC_BATTERY_INTERVAL_US = 20_ms; // assume higher frequency esc feedback than 50Hz
 	Battery _battery;
@@ -56,11 +56,21 @@ FlightModeManager::FlightModeManager() :
 
 FlightModeManager::~FlightModeManager()
 {
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+
+	if (residentTask(_current_task.index) != nullptr) {
+		_current_task.task = nullptr;
+	}
+
+	perf_free(_switch_resident_perf);
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
+
 	if (_current_task.task) {
 		_current_task.task->~FlightTask();
 	}
 
 	perf_free(_loop_perf);
+	perf_free(_switch_perf);
 }
 
 bool FlightModeManager::init()
@@ -73,6 +83,13 @@ bool FlightModeManager::init()
 	// limit to every other vehicle_local_position update (50 Hz)
 	_vehicle_local_position_sub.set_interval_us(20_ms);
 	_time_stamp_last_loop = hrt_absolute_time();
+
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+	// subscribe the resident tasks once
+	_resident_descend.updateInitialize();
+	_resident_failsafe.updateInitialize();
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
+
 	return true;
 }
 
@@ -131,6 +148,18 @@ void FlightModeManager::updateParams()
 	if (isAnyTaskActive()) {
 		_current_task.task->handleParameterUpdate();
 	}
+
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+
+	if (_current_task.task != &_resident_descend) {
+		_resident_descend.handleParameterUpdate();
+	}
+
+	if (_current_task.task != &_resident_failsafe) {
+		_resident_failsafe.handleParameterUpdate();
+	}
+
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
 }
 
 void FlightModeManager::start_flight_task()
@@ -376,6 +405,25 @@ FlightTaskError FlightModeManager::switchTask(FlightTaskIndex new_task_index)
 		return FlightTaskError::NoError;
 	}
 
+	perf_counter_t perf = _switch_perf;
+
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+
+	if (residentTask(new_task_index) != nullptr) {
+		perf = _switch_resident_perf;
+	}
+
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
+
+	perf_begin(perf);
+	const FlightTaskError error = activateTask(new_task_index);
+	perf_end(perf);
+
+	return error;
+}
+
+FlightTaskError FlightModeManager::activateTask(FlightTaskIndex new_task_index)
+{
 	// Save current setpoints for the next FlightTask
 	trajectory_setpoint_s last_setpoint = FlightTask::empty_trajectory_setpoint;
 	ekf_reset_counters_s last_reset_counters{};
@@ -385,7 +433,26 @@ FlightTaskError FlightModeManager::switchTask(FlightTaskIndex new_task_index)
 		last_reset_counters = _current_task.task->getResetCounters();
 	}
 
-	if (_initTask(new_task_index)) {
+	FlightTask *resident_task = nullptr;
+
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+
+	// a resident task is only detached, never destroyed
+	if (residentTask(_current_task.index) != nullptr) {
+		_current_task.task = nullptr;
+		_current_task.index = FlightTaskIndex::None;
+	}
+
+	resident_task = residentTask(new_task_index);
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
+
+	if (resident_task != nullptr) {
+		// destroy the task in _task_union, if any
+		_initTask(FlightTaskIndex::None);
+		_current_task.task = resident_task;
+		_current_task.index = new_task_index;
+
+	} else if (_initTask(new_task_index)) {
 		// invalid task
 		return FlightTaskError::InvalidTask;
 	}
@@ -397,7 +464,10 @@ FlightTaskError FlightModeManager::switchTask(FlightTaskIndex new_task_index)
 
 	// activation failed
 	if (!_current_task.task->updateInitialize() || !_current_task.task->activate(last_setpoint)) {
-		_current_task.task->~FlightTask();
+		if (resident_task == nullptr) {
+			_current_task.task->~FlightTask();
+		}
+
 		_current_task.task = nullptr;
 		_current_task.index = FlightTaskIndex::None;
 		return FlightTaskError::ActivationFailed;
@@ -409,6 +479,19 @@ FlightTaskError FlightModeManager::switchTask(FlightTaskIndex new_task_index)
 	return FlightTaskError::NoError;
 }
 
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+FlightTask *FlightModeManager::residentTask(FlightTaskIndex task_index)
+{
+	switch (task_index) {
+	case FlightTaskIndex::Descend: return &_resident_descend;
+
+	case FlightTaskIndex::Failsafe: return &_resident_failsafe;
+
+	default: return nullptr;
+	}
+}
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
+
 FlightTaskError FlightModeManager::switchTask(int new_task_index)
 {
 	// make sure we are in range of the enumeration before casting
@@ -472,6 +555,10 @@ int FlightModeManager::print_status()
 	}
 
 	perf_print_counter(_loop_perf);
+	perf_print_counter(_switch_perf);
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+	perf_print_counter(_switch_resident_perf);
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
 	return 0;
 }
 
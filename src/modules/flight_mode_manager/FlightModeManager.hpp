@@ -113,9 +113,26 @@ private:
 
 	void tryApplyCommandIfAny();
 
+	FlightTaskError activateTask(FlightTaskIndex new_task_index);
+
 	// generated
 	int _initTask(FlightTaskIndex task_index);
 
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+	/**
+	 * The task kept constructed outside of _task_union for a given index
+	 * @return nullptr if the task is constructed on demand
+	 */
+	FlightTask *residentTask(FlightTaskIndex task_index);
+
+	/**
+	 * Failsafe tasks constructed once and kept subscribed (not part of _task_union), switching to
+	 * them only activates them with the state of the previous task.
+	 */
+	FlightTaskDescend _resident_descend;
+	FlightTaskFailsafe _resident_failsafe;
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
+
 	/**
 	 * Union with all existing tasks: we use it to make sure that only the memory of the largest existing
 	 * task is needed, and to avoid using dynamic memory allocations.
@@ -133,6 +150,10 @@ private:
 	bool _no_matching_task_error_printed{false};
 
 	perf_counter_t _loop_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")}; ///< loop duration performance counter
+	perf_counter_t _switch_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": task switch")}; ///< task switch latency
+#if defined(CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS)
+	perf_counter_t _switch_resident_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": resident task switch")};
+#endif // CONFIG_FLIGHT_MODE_MANAGER_RESIDENT_FAILSAFE_TASKS
 	hrt_abstime _time_stamp_last_loop{0}; ///< time stamp of last loop iteration
 
 	vehicle_command_s _current_command{};
@@ -62,6 +62,9 @@ FixedwingAttitudeControl::init()
 		return false;
 	}
 
+	// count an attitude loop run finishing later than this after the new sample (CONFIG_WORK_QUEUE_DEADLINE)
+	SetDeadline(4_ms);
+
 	return true;
 }
 
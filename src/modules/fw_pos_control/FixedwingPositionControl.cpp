@@ -2895,20 +2895,18 @@ void FixedwingPositionControl::navigateWaypoint(const Vector2f &waypoint_pos, co
 void FixedwingPositionControl::navigateLine(const Vector2f &point_on_line_1, const Vector2f &point_on_line_2,
 		const Vector2f &vehicle_pos, const Vector2f &ground_vel, const Vector2f &wind_vel)
 {
-	const Vector2f line_segment = point_on_line_2 - point_on_line_1;
+	// the segment only changes with the setpoints
+	if (!_path_segment.isLine(point_on_line_1, point_on_line_2)) {
+		_path_segment = PathSegment::line(point_on_line_1, point_on_line_2);
+	}
 
-	if (line_segment.norm() <= FLT_EPSILON) {
+	if (!_path_segment.valid()) {
 		// degenerate case: line segment has zero length. maintain the last npfg command.
 		return;
 	}
 
-	const Vector2f unit_path_tangent = line_segment.normalized();
-
-	const Vector2f point_1_to_vehicle = vehicle_pos - point_on_line_1;
-	_closest_point_on_path = point_on_line_1 + point_1_to_vehicle.dot(unit_path_tangent) * unit_path_tangent;
-
-	const float path_curvature = 0.f;
-	_npfg.guideToPath(vehicle_pos, ground_vel, wind_vel, unit_path_tangent, _closest_point_on_path, path_curvature);
+	Vector2f unit_path_tangent;
+	_npfg.guideToPath(vehicle_pos, ground_vel, wind_vel, _path_segment, _closest_point_on_path, unit_path_tangent);
 
 	// for logging - note we are abusing path tangent vs bearing definitions here. npfg interfaces need to be refined.
 	_target_bearing = atan2f(unit_path_tangent(1), unit_path_tangent(0));
@@ -2917,13 +2915,12 @@ void FixedwingPositionControl::navigateLine(const Vector2f &point_on_line_1, con
 void FixedwingPositionControl::navigateLine(const Vector2f &point_on_line, const float line_bearing,
 		const Vector2f &vehicle_pos, const Vector2f &ground_vel, const Vector2f &wind_vel)
 {
-	const Vector2f unit_path_tangent{cosf(line_bearing), sinf(line_bearing)};
+	if (!_path_segment.isLine(point_on_line, line_bearing)) {
+		_path_segment = PathSegment::line(point_on_line, line_bearing);
+	}
 
-	const Vector2f point_on_line_to_vehicle = vehicle_pos - point_on_line;
-	_closest_point_on_path = point_on_line + point_on_line_to_vehicle.dot(unit_path_tangent) * unit_path_tangent;
-
-	const float path_curvature = 0.f;
-	_npfg.guideToPath(vehicle_pos, ground_vel, wind_vel, unit_path_tangent, _closest_point_on_path, path_curvature);
+	Vector2f unit_path_tangent;
+	_npfg.guideToPath(vehicle_pos, ground_vel, wind_vel, _path_segment, _closest_point_on_path, unit_path_tangent);
 
 	// for logging - note we are abusing path tangent vs bearing definitions here. npfg interfaces need to be refined.
 	_target_bearing = line_bearing;
@@ -2932,40 +2929,18 @@ void FixedwingPositionControl::navigateLine(const Vector2f &point_on_line, const
 void FixedwingPositionControl::navigateLoiter(const Vector2f &loiter_center, const Vector2f &vehicle_pos,
 		float radius, bool loiter_direction_counter_clockwise, const Vector2f &ground_vel, const Vector2f &wind_vel)
 {
-	const float loiter_direction_multiplier = loiter_direction_counter_clockwise ? -1.f : 1.f;
-
-	Vector2f vector_center_to_vehicle = vehicle_pos - loiter_center;
-	const float dist_to_center = vector_center_to_vehicle.norm();
-
-	// find the direction from the circle center to the closest point on its perimeter
-	// from the vehicle position
-	Vector2f unit_vec_center_to_closest_pt;
-
-	if (dist_to_center < 0.1f) {
-		// the logic breaks down at the circle center, employ some mitigation strategies
-		// until we exit this region
-		if (ground_vel.norm() < 0.1f) {
-			// arbitrarily set the point in the northern top of the circle
-			unit_vec_center_to_closest_pt = Vector2f{1.0f, 0.0f};
-
-		} else {
-			// set the point in the direction we are moving
-			unit_vec_center_to_closest_pt = ground_vel.normalized();
-		}
-
-	} else {
-		// set the point in the direction of the aircraft
-		unit_vec_center_to_closest_pt = vector_center_to_vehicle.normalized();
+	if (!_path_segment.isCircle(loiter_center, radius, loiter_direction_counter_clockwise)) {
+		_path_segment = PathSegment::circle(loiter_center, radius, loiter_direction_counter_clockwise);
 	}
 
-	// 90 deg clockwise rotation * loiter direction
-	const Vector2f unit_path_tangent = loiter_direction_multiplier * Vector2f{-unit_vec_center_to_closest_pt(1), unit_vec_center_to_closest_pt(0)};
+	if (!_path_segment.valid()) {
+		// degenerate case: zero radius. maintain the last npfg command.
+		return;
+	}
 
-	float path_curvature = loiter_direction_multiplier / radius;
+	Vector2f unit_path_tangent;
+	_npfg.guideToPath(vehicle_pos, ground_vel, wind_vel, _path_segment, _closest_point_on_path, unit_path_tangent);
 	_target_bearing = atan2f(unit_path_tangent(1), unit_path_tangent(0));
-	_closest_point_on_path = unit_vec_center_to_closest_pt * radius + loiter_center;
-	_npfg.guideToPath(vehicle_pos, ground_vel, wind_vel, unit_path_tangent,
-			  loiter_center + unit_vec_center_to_closest_pt * radius, path_curvature);
 }
 
 void FixedwingPositionControl::navigatePathTangent(const matrix::Vector2f &vehicle_pos,
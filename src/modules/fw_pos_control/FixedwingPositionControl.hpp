@@ -401,6 +401,9 @@ private:
 	// CLosest point on path to track
 	matrix::Vector2f _closest_point_on_path;
 
+	// line or loiter circle currently followed, rebuilt when the path changes
+	PathSegment _path_segment{};
+
 	// nonlinear path following guidance - lateral-directional position control
 	NPFG _npfg;
 	bool _need_report_npfg_uncertain_condition{false}; ///< boolean if reporting of uncertain npfg output condition is needed
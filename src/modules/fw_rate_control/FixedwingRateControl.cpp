@@ -69,6 +69,9 @@ FixedwingRateControl::init()
 		return false;
 	}
 
+	// count a rate loop run finishing later than this after the new sample (CONFIG_WORK_QUEUE_DEADLINE)
+	SetDeadline(2_ms);
+
 	return true;
 }
 
@@ -92,6 +95,18 @@ FixedwingRateControl::parameters_update()
 		param_get(_handle_param_vt_fw_difthr_en, &_param_vt_fw_difthr_en);
 	}
 
+	// only the airspeed dependent part of the trim is computed at runtime
+	const Vector3f trim(_param_trim_roll.get(), _param_trim_pitch.get(), _param_trim_yaw.get());
+
+	_trim_schedule_airspeed[0] = _param_fw_airspd_min.get();
+	_trim_schedule_airspeed[1] = _param_fw_airspd_trim.get();
+	_trim_schedule_airspeed[2] = _param_fw_airspd_max.get();
+
+	_trim_schedule[0] = trim + Vector3f(_param_fw_dtrim_r_vmin.get(), _param_fw_dtrim_p_vmin.get(),
+					    _param_fw_dtrim_y_vmin.get());
+	_trim_schedule[1] = trim;
+	_trim_schedule[2] = trim + Vector3f(_param_fw_dtrim_r_vmax.get(), _param_fw_dtrim_p_vmax.get(),
+					    _param_fw_dtrim_y_vmax.get());
 
 	return PX4_OK;
 }
@@ -191,6 +206,16 @@ float FixedwingRateControl::get_airspeed_and_update_scaling()
 	return airspeed;
 }
 
+Vector3f FixedwingRateControl::get_scheduled_trim(float airspeed) const
+{
+	/* bi-linear interpolation over airspeed for actuator trim scheduling */
+	const int segment = (airspeed < _trim_schedule_airspeed[1]) ? 0 : 1;
+	const float fraction = interpolate(airspeed, _trim_schedule_airspeed[segment], _trim_schedule_airspeed[segment + 1],
+					   0.f, 1.f);
+
+	return _trim_schedule[segment] + (_trim_schedule[segment + 1] - _trim_schedule[segment]) * fraction;
+}
+
 void FixedwingRateControl::Run()
 {
 	if (should_exit()) {
@@ -321,28 +346,7 @@ void FixedwingRateControl::Run()
 				}
 			}
 
-			/* bi-linear interpolation over airspeed for actuator trim scheduling */
-			Vector3f trim(_param_trim_roll.get(), _param_trim_pitch.get(), _param_trim_yaw.get());
-
-			if (airspeed < _param_fw_airspd_trim.get()) {
-				trim(0) += interpolate(airspeed, _param_fw_airspd_min.get(), _param_fw_airspd_trim.get(),
-						       _param_fw_dtrim_r_vmin.get(),
-						       0.0f);
-				trim(1) += interpolate(airspeed, _param_fw_airspd_min.get(), _param_fw_airspd_trim.get(),
-						       _param_fw_dtrim_p_vmin.get(),
-						       0.0f);
-				trim(2) += interpolate(airspeed, _param_fw_airspd_min.get(), _param_fw_airspd_trim.get(),
-						       _param_fw_dtrim_y_vmin.get(),
-						       0.0f);
-
-			} else {
-				trim(0) += interpolate(airspeed, _param_fw_airspd_trim.get(), _param_fw_airspd_max.get(), 0.0f,
-						       _param_fw_dtrim_r_vmax.get());
-				trim(1) += interpolate(airspeed, _param_fw_airspd_trim.get(), _param_fw_airspd_max.get(), 0.0f,
-						       _param_fw_dtrim_p_vmax.get());
-				trim(2) += interpolate(airspeed, _param_fw_airspd_trim.get(), _param_fw_airspd_max.get(), 0.0f,
-						       _param_fw_dtrim_y_vmax.get());
-			}
+			const Vector3f trim = get_scheduled_trim(airspeed);
 
 			if (_vcontrol_mode.flag_control_rates_enabled) {
 				_rates_sp_sub.update(&_rates_sp);
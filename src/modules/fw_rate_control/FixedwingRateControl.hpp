@@ -134,6 +134,10 @@ private:
 
 	float _airspeed_scaling{1.0f};
 
+	// actuator trim schedule over airspeed, breakpoints at FW_AIRSPD_MIN, FW_AIRSPD_TRIM and FW_AIRSPD_MAX
+	float _trim_schedule_airspeed[3] {};
+	matrix::Vector3f _trim_schedule[3] {};
+
 	bool _landed{true};
 
 	float _battery_scale{1.0f};
@@ -220,4 +224,9 @@ private:
 	void		vehicle_land_detected_poll();
 
 	float 		get_airspeed_and_update_scaling();
+
+	/**
+	 * Actuator trim at the given airspeed, interpolated within the schedule precomputed in parameters_update()
+	 */
+	matrix::Vector3f	get_scheduled_trim(float airspeed) const;
 };
@@ -58,11 +58,14 @@
 #include "output_mavlink.h"
 
 #include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 #include <uORB/SubscriptionInterval.hpp>
 #include <uORB/topics/parameter_update.h>
+#include <uORB/topics/vehicle_attitude.h>
 
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 
 using namespace time_literals;
 using namespace gimbal;
@@ -87,9 +90,79 @@ static void usage();
 static void update_params(ParameterHandles &param_handles, Parameters &params);
 static bool initialize_params(ParameterHandles &param_handles, Parameters &params);
 
+static bool gimbal_initialize(ThreadData &thread_data, Parameters &params);
+static bool gimbal_update(ThreadData &thread_data, ParameterHandles &param_handles, Parameters &params,
+			  uORB::SubscriptionInterval &parameter_update_sub, unsigned int poll_timeout_ms);
+static void gimbal_deinitialize(ThreadData &thread_data);
+
 static int gimbal_thread_main(int argc, char *argv[]);
+static int gimbal_start_attitude_triggered();
 extern "C" __EXPORT int gimbal_main(int argc, char *argv[]);
 
+/**
+ * Alternative to the gimbal task (MNT_ATT_TRIG): runs the inputs and the output
+ * on the work queue for every vehicle attitude update, so that stabilization
+ * uses the latest attitude without a polling task.
+ */
+class GimbalAttitudeTriggered : public px4::ScheduledWorkItem
+{
+public:
+	GimbalAttitudeTriggered() :
+		ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers)
+	{}
+
+	~GimbalAttitudeTriggered() override = default;
+
+	bool init()
+	{
+		if (!initialize_params(_param_handles, _params)) {
+			PX4_ERR("could not get mount parameters!");
+			return false;
+		}
+
+		g_thread_data = &_thread_data;
+
+		if (!gimbal_initialize(_thread_data, _params) || !_vehicle_attitude_sub.registerCallback()) {
+			g_thread_data = nullptr;
+			gimbal_deinitialize(_thread_data);
+			return false;
+		}
+
+		thread_running.store(true);
+		ScheduleNow();
+		return true;
+	}
+
+private:
+	void Run() override
+	{
+		if (thread_should_exit.load()) {
+			_vehicle_attitude_sub.unregisterCallback();
+			ScheduleClear();
+
+			g_thread_data = nullptr;
+			gimbal_deinitialize(_thread_data);
+
+			thread_running.store(false);
+			delete this;
+			return;
+		}
+
+		// keep updating the output at a low rate if there is no attitude (e.g. no estimator running)
+		ScheduleDelayed(20_ms);
+
+		// inputs are only checked, never waited for
+		gimbal_update(_thread_data, _param_handles, _params, _parameter_update_sub, 0);
+	}
+
+	ParameterHandles _param_handles{};
+	Parameters _params{};
+	ThreadData _thread_data{};
+
+	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
+	uORB::SubscriptionCallbackWorkItem _vehicle_attitude_sub{this, ORB_ID(vehicle_attitude)};
+};
+
 static int gimbal_thread_main(int argc, char *argv[])
 {
 	ParameterHandles param_handles;
@@ -106,6 +179,48 @@ static int gimbal_thread_main(int argc, char *argv[])
 	thread_running.store(true);
 	g_thread_data = &thread_data;
 
+	if (!gimbal_initialize(thread_data, params)) {
+		thread_should_exit.store(true);
+	}
+
+	while (!thread_should_exit.load()) {
+
+		if (!gimbal_update(thread_data, param_handles, params, parameter_update_sub, 20)) {
+			// We still need to wake up regularly to check for thread exit requests
+			px4_usleep(1e6);
+		}
+	}
+
+	g_thread_data = nullptr;
+
+	gimbal_deinitialize(thread_data);
+
+	thread_running.store(false);
+	return 0;
+}
+
+static int gimbal_start_attitude_triggered()
+{
+	GimbalAttitudeTriggered *instance = new GimbalAttitudeTriggered();
+
+	if (instance == nullptr) {
+		PX4_ERR("alloc failed");
+		return -1;
+	}
+
+	if (!instance->init()) {
+		delete instance;
+		PX4_ERR("failed to start");
+		return -1;
+	}
+
+	return 0;
+}
+
+static bool gimbal_initialize(ThreadData &thread_data, Parameters &params)
+{
+	bool success = true;
+
 	thread_data.test_input = new InputTest(params);
 
 	bool alloc_failed = false;
@@ -152,14 +267,14 @@ static int gimbal_thread_main(int argc, char *argv[])
 
 	if (alloc_failed) {
 		PX4_ERR("input objs memory allocation failed");
-		thread_should_exit.store(true);
+		success = false;
 	}
 
 	if (!alloc_failed) {
 		for (int i = 0; i < thread_data.input_objs_len; ++i) {
 			if (thread_data.input_objs[i]->initialize() != 0) {
 				PX4_ERR("Input %d failed", i);
-				thread_should_exit.store(true);
+				success = false;
 			}
 		}
 	}
@@ -188,108 +303,111 @@ static int gimbal_thread_main(int argc, char *argv[])
 
 	default:
 		PX4_ERR("invalid output mode %" PRId32, params.mnt_mode_out);
-		thread_should_exit.store(true);
+		success = false;
 		break;
 	}
 
 	if (alloc_failed) {
 		PX4_ERR("output memory allocation failed");
-		thread_should_exit.store(true);
+		success = false;
 	}
 
-	while (!thread_should_exit.load()) {
-
-		const bool updated = parameter_update_sub.updated();
+	return success;
+}
 
-		if (updated) {
-			parameter_update_s pupdate;
-			parameter_update_sub.copy(&pupdate);
-			update_params(param_handles, params);
-		}
+static bool gimbal_update(ThreadData &thread_data, ParameterHandles &param_handles, Parameters &params,
+			  uORB::SubscriptionInterval &parameter_update_sub, unsigned int poll_timeout_ms)
+{
+	const bool updated = parameter_update_sub.updated();
 
-		if (thread_data.last_input_active == -1) {
-			// Reset control as no one is active anymore, or yet.
-			thread_data.control_data.sysid_primary_control = 0;
-			thread_data.control_data.compid_primary_control = 0;
-			thread_data.control_data.device_compid = 0;
-		}
+	if (updated) {
+		parameter_update_s pupdate;
+		parameter_update_sub.copy(&pupdate);
+		update_params(param_handles, params);
+	}
 
-		InputBase::UpdateResult update_result = InputBase::UpdateResult::NoUpdate;
+	if (thread_data.last_input_active == -1) {
+		// Reset control as no one is active anymore, or yet.
+		thread_data.control_data.sysid_primary_control = 0;
+		thread_data.control_data.compid_primary_control = 0;
+		thread_data.control_data.device_compid = 0;
+	}
 
-		if (thread_data.input_objs_len > 0) {
+	InputBase::UpdateResult update_result = InputBase::UpdateResult::NoUpdate;
 
-			// get input: we cannot make the timeout too large, because the output needs to update
-			// periodically for stabilization and angle updates.
+	if (thread_data.input_objs_len == 0) {
+		return false;
+	}
 
-			for (int i = 0; i < thread_data.input_objs_len; ++i) {
+	// get input: we cannot make the timeout too large, because the output needs to update
+	// periodically for stabilization and angle updates.
 
-				const bool already_active = (thread_data.last_input_active == i);
-				// poll only on active input to reduce latency, or on all if none is active
-				const unsigned int poll_timeout =
-					(already_active || thread_data.last_input_active == -1) ? 20 : 0;
+	for (int i = 0; i < thread_data.input_objs_len; ++i) {
 
-				update_result = thread_data.input_objs[i]->update(poll_timeout, thread_data.control_data, already_active);
+		const bool already_active = (thread_data.last_input_active == i);
+		// poll only on active input to reduce latency, or on all if none is active
+		const unsigned int poll_timeout =
+			(already_active || thread_data.last_input_active == -1) ? poll_timeout_ms : 0;
 
-				bool break_loop = false;
+		update_result = thread_data.input_objs[i]->update(poll_timeout, thread_data.control_data, already_active);
 
-				switch (update_result) {
-				case InputBase::UpdateResult::NoUpdate:
-					if (already_active) {
-						// No longer active.
-						thread_data.last_input_active = -1;
-					}
+		bool break_loop = false;
 
-					break;
+		switch (update_result) {
+		case InputBase::UpdateResult::NoUpdate:
+			if (already_active) {
+				// No longer active.
+				thread_data.last_input_active = -1;
+			}
 
-				case InputBase::UpdateResult::UpdatedActive:
-					thread_data.last_input_active = i;
-					break_loop = true;
-					break;
+			break;
 
-				case InputBase::UpdateResult::UpdatedActiveOnce:
-					thread_data.last_input_active = -1;
-					break_loop = true;
-					break;
+		case InputBase::UpdateResult::UpdatedActive:
+			thread_data.last_input_active = i;
+			break_loop = true;
+			break;
 
-				case InputBase::UpdateResult::UpdatedNotActive:
-					// Ignore, input not active
-					break;
-				}
+		case InputBase::UpdateResult::UpdatedActiveOnce:
+			thread_data.last_input_active = -1;
+			break_loop = true;
+			break;
 
-				if (break_loop) {
-					break;
-				}
-			}
+		case InputBase::UpdateResult::UpdatedNotActive:
+			// Ignore, input not active
+			break;
+		}
 
-			if (params.mnt_do_stab == 1) {
-				thread_data.output_obj->set_stabilize(true, true, true);
+		if (break_loop) {
+			break;
+		}
+	}
 
-			} else if (params.mnt_do_stab == 2) {
-				thread_data.output_obj->set_stabilize(false, false, true);
+	if (params.mnt_do_stab == 1) {
+		thread_data.output_obj->set_stabilize(true, true, true);
 
-			} else {
-				thread_data.output_obj->set_stabilize(false, false, false);
-			}
+	} else if (params.mnt_do_stab == 2) {
+		thread_data.output_obj->set_stabilize(false, false, true);
 
-			// Update output
-			thread_data.output_obj->update(
-				thread_data.control_data,
-				update_result != InputBase::UpdateResult::NoUpdate, thread_data.control_data.device_compid);
+	} else {
+		thread_data.output_obj->set_stabilize(false, false, false);
+	}
 
-			// Only publish the mount orientation if the mode is not mavlink v1 or v2
-			// If the gimbal speaks mavlink it publishes its own orientation.
-			if (params.mnt_mode_out != 1 && params.mnt_mode_out != 2) { // 1 = MAVLink v1, 2 = MAVLink v2
-				thread_data.output_obj->publish();
-			}
+	// Update output
+	thread_data.output_obj->update(
+		thread_data.control_data,
+		update_result != InputBase::UpdateResult::NoUpdate, thread_data.control_data.device_compid);
 
-		} else {
-			// We still need to wake up regularly to check for thread exit requests
-			px4_usleep(1e6);
-		}
+	// Only publish the mount orientation if the mode is not mavlink v1 or v2
+	// If the gimbal speaks mavlink it publishes its own orientation.
+	if (params.mnt_mode_out != 1 && params.mnt_mode_out != 2) { // 1 = MAVLink v1, 2 = MAVLink v2
+		thread_data.output_obj->publish();
 	}
 
-	g_thread_data = nullptr;
+	return true;
+}
 
+static void gimbal_deinitialize(ThreadData &thread_data)
+{
 	for (int i = 0; i < input_objs_len_max; ++i) {
 		if (thread_data.input_objs[i]) {
 			delete (thread_data.input_objs[i]);
@@ -303,9 +421,6 @@ static int gimbal_thread_main(int argc, char *argv[])
 		delete (thread_data.output_obj);
 		thread_data.output_obj = nullptr;
 	}
-
-	thread_running.store(false);
-	return 0;
 }
 
 int gimbal_main(int argc, char *argv[])
@@ -325,6 +440,13 @@ int gimbal_main(int argc, char *argv[])
 
 		thread_should_exit.store(false);
 
+		int32_t mnt_att_trig = 0;
+		param_get(param_find("MNT_ATT_TRIG"), &mnt_att_trig);
+
+		if (mnt_att_trig == 1) {
+			return gimbal_start_attitude_triggered();
+		}
+
 		int gimbal_task = px4_task_spawn_cmd("gimbal",
 						     SCHED_DEFAULT,
 						     SCHED_PRIORITY_DEFAULT,
@@ -498,6 +620,8 @@ void update_params(ParameterHandles &param_handles, Parameters &params)
 	param_get(param_handles.mnt_rc_in_mode, &params.mnt_rc_in_mode);
 	param_get(param_handles.mnt_lnd_p_min, &params.mnt_lnd_p_min);
 	param_get(param_handles.mnt_lnd_p_max, &params.mnt_lnd_p_max);
+	param_get(param_handles.mnt_ff_time, &params.mnt_ff_time);
+	param_get(param_handles.mnt_out_rate, &params.mnt_out_rate);
 }
 
 bool initialize_params(ParameterHandles &param_handles, Parameters &params)
@@ -523,6 +647,8 @@ bool initialize_params(ParameterHandles &param_handles, Parameters &params)
 	param_handles.mnt_rc_in_mode = param_find("MNT_RC_IN_MODE");
 	param_handles.mnt_lnd_p_min = param_find("MNT_LND_P_MIN");
 	param_handles.mnt_lnd_p_max = param_find("MNT_LND_P_MAX");
+	param_handles.mnt_ff_time = param_find("MNT_FF_TIME");
+	param_handles.mnt_out_rate = param_find("MNT_OUT_RATE");
 
 	if (param_handles.mnt_mode_in == PARAM_INVALID ||
 	    param_handles.mnt_mode_out == PARAM_INVALID ||
@@ -544,7 +670,9 @@ bool initialize_params(ParameterHandles &param_handles, Parameters &params)
 	    param_handles.mnt_rate_yaw == PARAM_INVALID ||
 	    param_handles.mnt_rc_in_mode == PARAM_INVALID ||
 	    param_handles.mnt_lnd_p_min == PARAM_INVALID ||
-	    param_handles.mnt_lnd_p_max == PARAM_INVALID
+	    param_handles.mnt_lnd_p_max == PARAM_INVALID ||
+	    param_handles.mnt_ff_time == PARAM_INVALID ||
+	    param_handles.mnt_out_rate == PARAM_INVALID
 	   ) {
 		return false;
 	}
@@ -274,3 +274,45 @@ PARAM_DEFINE_FLOAT(MNT_LND_P_MIN, -90.0f);
 * @group Mount
 */
 PARAM_DEFINE_FLOAT(MNT_LND_P_MAX, 90.0f);
+
+/**
+* Run the gimbal on vehicle attitude updates
+*
+* If enabled the gimbal runs on a work queue triggered by every vehicle_attitude
+* update instead of polling its inputs in its own task.
+*
+* @boolean
+* @reboot_required true
+* @group Mount
+*/
+PARAM_DEFINE_INT32(MNT_ATT_TRIG, 0);
+
+/**
+* Stabilization feed-forward time
+*
+* The vehicle attitude used to stabilize the mount is predicted this far ahead
+* using the vehicle angular velocity, to compensate for the output latency.
+* Only used if the mount is stabilized by the autopilot (MNT_DO_STAB).
+* Set to 0 to disable.
+*
+* @min 0.0
+* @max 0.1
+* @unit s
+* @decimal 3
+* @group Mount
+*/
+PARAM_DEFINE_FLOAT(MNT_FF_TIME, 0.0f);
+
+/**
+* Maximum output rate to MAVLink gimbals
+*
+* Setpoints calculated faster than this are merged into the next message
+* to the gimbal device. Set to 0 to disable the limit.
+*
+* @min 0.0
+* @max 400.0
+* @unit Hz
+* @decimal 1
+* @group Mount
+*/
+PARAM_DEFINE_FLOAT(MNT_OUT_RATE, 50.0f);
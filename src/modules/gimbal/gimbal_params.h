@@ -62,6 +62,8 @@ struct Parameters {
 	int32_t mnt_rc_in_mode;
 	float mnt_lnd_p_min;
 	float mnt_lnd_p_max;
+	float mnt_ff_time;
+	float mnt_out_rate;
 };
 
 struct ParameterHandles {
@@ -86,6 +88,8 @@ struct ParameterHandles {
 	param_t mnt_rc_in_mode;
 	param_t mnt_lnd_p_min;
 	param_t mnt_lnd_p_max;
+	param_t mnt_ff_time;
+	param_t mnt_out_rate;
 };
 
 } /* namespace gimbal */
@@ -207,7 +207,20 @@ void OutputBase::_calculate_angle_output(const hrt_abstime &t)
 		vehicle_attitude_s vehicle_attitude;
 
 		if (_vehicle_attitude_sub.copy(&vehicle_attitude)) {
-			euler_vehicle = matrix::Quatf(vehicle_attitude.q);
+			matrix::Quatf q_vehicle(vehicle_attitude.q);
+
+			// feed-forward: predict where the vehicle is rotating to by the time the output takes effect
+			vehicle_angular_velocity_s vehicle_angular_velocity;
+
+			if ((_parameters.mnt_ff_time > 0.f) && _vehicle_angular_velocity_sub.copy(&vehicle_angular_velocity)) {
+				const matrix::Vector3f rotation = matrix::Vector3f(vehicle_angular_velocity.xyz) * _parameters.mnt_ff_time;
+
+				if (rotation.isAllFinite()) {
+					q_vehicle = q_vehicle * matrix::Quatf(matrix::AxisAnglef(rotation));
+				}
+			}
+
+			euler_vehicle = q_vehicle;
 		}
 	}
 
@@ -252,6 +265,17 @@ void OutputBase::_calculate_angle_output(const hrt_abstime &t)
 	}
 }
 
+bool OutputBase::_output_rate_limit(const hrt_abstime &t)
+{
+	if ((_parameters.mnt_out_rate > 0.f) && (_last_output != 0)
+	    && (t < _last_output + static_cast<hrt_abstime>(1e6f / _parameters.mnt_out_rate))) {
+		return false;
+	}
+
+	_last_output = t;
+	return true;
+}
+
 void OutputBase::set_stabilize(bool roll_stabilize, bool pitch_stabilize, bool yaw_stabilize)
 {
 	_stabilize[0] = roll_stabilize;
@@ -94,19 +94,21 @@ void OutputMavlinkV1::update(const ControlData &control_data, bool new_setpoints
 	hrt_abstime t = hrt_absolute_time();
 	_calculate_angle_output(t);
 
-	vehicle_command.timestamp = t;
-	vehicle_command.command = vehicle_command_s::VEHICLE_CMD_DO_MOUNT_CONTROL;
+	if (_output_rate_limit(t)) {
+		vehicle_command.timestamp = t;
+		vehicle_command.command = vehicle_command_s::VEHICLE_CMD_DO_MOUNT_CONTROL;
 
-	// gimbal spec has roll, pitch on channels 0, 1, respectively; MAVLink spec has roll, pitch on channels 1, 0, respectively
-	// gimbal uses radians, MAVLink uses degrees
-	vehicle_command.param1 = math::degrees(_angle_outputs[1] + math::radians(_parameters.mnt_off_pitch));
-	vehicle_command.param2 = math::degrees(_angle_outputs[0] + math::radians(_parameters.mnt_off_roll));
-	vehicle_command.param3 = math::degrees(_angle_outputs[2] + math::radians(_parameters.mnt_off_yaw));
-	vehicle_command.param7 = 2.0f; // MAV_MOUNT_MODE_MAVLINK_TARGETING;
+		// gimbal spec has roll, pitch on channels 0, 1, respectively; MAVLink spec has roll, pitch on channels 1, 0, respectively
+		// gimbal uses radians, MAVLink uses degrees
+		vehicle_command.param1 = math::degrees(_angle_outputs[1] + math::radians(_parameters.mnt_off_pitch));
+		vehicle_command.param2 = math::degrees(_angle_outputs[0] + math::radians(_parameters.mnt_off_roll));
+		vehicle_command.param3 = math::degrees(_angle_outputs[2] + math::radians(_parameters.mnt_off_yaw));
+		vehicle_command.param7 = 2.0f; // MAV_MOUNT_MODE_MAVLINK_TARGETING;
 
-	_gimbal_v1_command_pub.publish(vehicle_command);
+		_gimbal_v1_command_pub.publish(vehicle_command);
 
-	_stream_device_attitude_status();
+		_stream_device_attitude_status();
+	}
 
 	_last_update = t;
 }
@@ -164,7 +166,9 @@ void OutputMavlinkV2::update(const ControlData &control_data, bool new_setpoints
 
 		gimbal_device_id = _gimbal_device_found ? _gimbal_device_compid : 0;
 
-		_publish_gimbal_device_set_attitude();
+		if (_output_rate_limit(t)) {
+			_publish_gimbal_device_set_attitude();
+		}
 	}
 }
 
@@ -67,6 +67,7 @@ GyroFFT::~GyroFFT()
 	delete[] _fft_input_buffer;
 	delete[] _fft_outupt_buffer;
 	delete[] _peak_magnitudes_all;
+	delete[] _sdft_history;
 }
 
 bool GyroFFT::init()
@@ -147,6 +148,8 @@ bool GyroFFT::init()
 			arm_float_to_q15(&hanning_value, &_hanning_window[n], 1);
 		}
 
+		_sdft_damping_n = powf(SDFT_DAMPING, _imu_gyro_fft_len);
+
 		if (!SensorSelectionUpdate(true)) {
 			ScheduleDelayed(500_ms);
 		}
@@ -161,6 +164,8 @@ bool GyroFFT::init()
 	delete[] _hanning_window;
 	delete[] _fft_input_buffer;
 	delete[] _fft_outupt_buffer;
+	delete[] _sdft_history;
+	_sdft_history = nullptr;
 
 	return false;
 }
@@ -269,34 +274,37 @@ static inline float tau(float x)
 float GyroFFT::EstimatePeakFrequencyBin(q15_t fft[], int peak_index)
 {
 	if (peak_index >= 2) {
-		// find peak location using Quinn's Second Estimator (2020-06-14: http://dspguru.com/dsp/howtos/how-to-interpolate-fft-peak/)
 		float real[3] { (float)fft[peak_index - 2], (float)fft[peak_index], (float)fft[peak_index + 2]     };
 		float imag[3] { (float)fft[peak_index - 2 + 1], (float)fft[peak_index + 1], (float)fft[peak_index + 2 + 1] };
 
-		static constexpr int k = 1;
+		// k’ = k + d
+		return peak_index + 2.f * EstimatePeakFrequencyOffset(real, imag);
+	}
 
-		const float divider = (real[k] * real[k] + imag[k] * imag[k]);
+	return NAN;
+}
 
-		// ap = (X[k + 1].r * X[k].r + X[k+1].i * X[k].i) / (X[k].r * X[k].r + X[k].i * X[k].i)
-		float ap = (real[k + 1] * real[k] + imag[k + 1] * imag[k]) / divider;
+float GyroFFT::EstimatePeakFrequencyOffset(const float real[3], const float imag[3])
+{
+	// find peak location using Quinn's Second Estimator (2020-06-14: http://dspguru.com/dsp/howtos/how-to-interpolate-fft-peak/)
+	static constexpr int k = 1;
 
-		// dp = -ap / (1 – ap)
-		float dp = -ap  / (1.f - ap);
+	const float divider = (real[k] * real[k] + imag[k] * imag[k]);
 
-		// am = (X[k - 1].r * X[k].r + X[k – 1].i * X[k].i) / (X[k].r * X[k].r + X[k].i * X[k].i)
-		float am = (real[k - 1] * real[k] + imag[k - 1] * imag[k]) / divider;
+	// ap = (X[k + 1].r * X[k].r + X[k+1].i * X[k].i) / (X[k].r * X[k].r + X[k].i * X[k].i)
+	float ap = (real[k + 1] * real[k] + imag[k + 1] * imag[k]) / divider;
 
-		// dm = am / (1 – am)
-		float dm = am / (1.f - am);
+	// dp = -ap / (1 – ap)
+	float dp = -ap  / (1.f - ap);
 
-		// d = (dp + dm) / 2 + tau(dp * dp) – tau(dm * dm)
-		float d = (dp + dm) / 2.f + tau(dp * dp) - tau(dm * dm);
+	// am = (X[k - 1].r * X[k].r + X[k – 1].i * X[k].i) / (X[k].r * X[k].r + X[k].i * X[k].i)
+	float am = (real[k - 1] * real[k] + imag[k - 1] * imag[k]) / divider;
 
-		// k’ = k + d
-		return peak_index + 2.f * d;
-	}
+	// dm = am / (1 – am)
+	float dm = am / (1.f - am);
 
-	return NAN;
+	// d = (dp + dm) / 2 + tau(dp * dp) – tau(dm * dm)
+	return (dp + dm) / 2.f + tau(dp * dp) - tau(dm * dm);
 }
 
 void GyroFFT::Run()
@@ -339,6 +347,7 @@ void GyroFFT::Run()
 				_fft_buffer_index[0] = 0;
 				_fft_buffer_index[1] = 0;
 				_fft_buffer_index[2] = 0;
+				SlidingDftReset();
 
 				perf_count(_gyro_fifo_generation_gap_perf);
 			}
@@ -350,6 +359,7 @@ void GyroFFT::Run()
 				_fft_buffer_index[0] = 0;
 				_fft_buffer_index[1] = 0;
 				_fft_buffer_index[2] = 0;
+				SlidingDftReset();
 
 				_fifo_last_scale = sensor_gyro_fifo.scale;
 			}
@@ -368,6 +378,7 @@ void GyroFFT::Run()
 				_fft_buffer_index[0] = 0;
 				_fft_buffer_index[1] = 0;
 				_fft_buffer_index[2] = 0;
+				SlidingDftReset();
 
 				perf_count(_gyro_generation_gap_perf);
 			}
@@ -406,6 +417,14 @@ void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint
 				buffer_index++;
 			}
 
+			if (_sdft_history) {
+				q15_t &sample_old = _sdft_history[axis * _imu_gyro_fft_len + (_sdft_history_index + n) % _imu_gyro_fft_len];
+				const q15_t sample = input[axis][n] / 2;
+
+				SlidingDftUpdate(axis, sample, sample_old);
+				sample_old = sample;
+			}
+
 			// if we have enough samples begin processing, but only one FFT per cycle
 			if ((buffer_index >= _imu_gyro_fft_len) && !_fft_updated) {
 				perf_begin(_fft_perf);
@@ -427,6 +446,20 @@ void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint
 			}
 		}
 	}
+
+	if (_sdft_history) {
+		_sdft_history_index = (_sdft_history_index + N) % _imu_gyro_fft_len;
+		_sdft_output_samples += N;
+
+		// update the tracked peaks several times per FFT period
+		if (_sdft_output_samples >= _imu_gyro_fft_len / 16) {
+			_sdft_output_samples = 0;
+
+			for (int axis = 0; axis < 3; axis++) {
+				SlidingDftFindPeaks(timestamp_sample, axis);
+			}
+		}
+	}
 }
 
 void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer)
@@ -492,6 +525,7 @@ void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *ff
 	int num_peaks_found = 0;
 	float peak_frequencies[MAX_NUM_PEAKS] {};
 	float peak_snr[MAX_NUM_PEAKS] {};
+	int peak_bins[MAX_NUM_PEAKS] {};
 
 	float *peak_frequencies_publish[] { _sensor_gyro_fft.peak_frequencies_x, _sensor_gyro_fft.peak_frequencies_y, _sensor_gyro_fft.peak_frequencies_z };
 
@@ -526,6 +560,7 @@ void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *ff
 							// keep
 							peak_frequencies[num_peaks_found] = freq_adjusted;
 							peak_snr[num_peaks_found] = snr;
+							peak_bins[num_peaks_found] = raw_peak_index[peak_new];
 
 							// remove
 							if (peak_close) {
@@ -541,6 +576,148 @@ void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *ff
 		}
 	}
 
+	if (_sdft_history) {
+		SlidingDftSeed(axis, peak_bins, peak_snr, num_peaks_found);
+	}
+
+	if (num_peaks_found > 0) {
+		UpdateOutput(timestamp_sample, axis, peak_frequencies, peak_snr, num_peaks_found);
+	}
+}
+
+void GyroFFT::SlidingDftReset()
+{
+	for (int axis = 0; axis < 3; axis++) {
+		for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+			_sdft_peaks[axis][peak].bin = 0;
+		}
+	}
+}
+
+void GyroFFT::SlidingDftSeed(int axis, const int peak_bins[MAX_NUM_PEAKS], const float peak_snr[MAX_NUM_PEAKS],
+			     int num_peaks_found)
+{
+	SlidingDftPeak *peaks = _sdft_peaks[axis];
+	bool peak_kept[MAX_NUM_PEAKS] {};
+	bool bin_tracked[MAX_NUM_PEAKS] {};
+
+	// keep tracking bins the FFT still reports
+	for (int peak_new = 0; peak_new < num_peaks_found; peak_new++) {
+		for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+			if (!peak_kept[peak] && (peaks[peak].bin == peak_bins[peak_new])) {
+				peaks[peak].snr = peak_snr[peak_new];
+				peak_kept[peak] = true;
+				bin_tracked[peak_new] = true;
+				break;
+			}
+		}
+	}
+
+	for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+		if (!peak_kept[peak]) {
+			peaks[peak].bin = 0;
+		}
+	}
+
+	// start tracking new bins, valid once a full FFT length of samples has been accumulated
+	for (int peak_new = 0; peak_new < num_peaks_found; peak_new++) {
+		const int bin = peak_bins[peak_new];
+
+		if (bin_tracked[peak_new] || (bin < SDFT_BINS / 2) || (bin + SDFT_BINS / 2 >= _imu_gyro_fft_len / 2)) {
+			continue;
+		}
+
+		for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+			if (peaks[peak].bin == 0) {
+				peaks[peak] = {};
+				peaks[peak].bin = bin;
+				peaks[peak].snr = peak_snr[peak_new];
+
+				for (int b = 0; b < SDFT_BINS; b++) {
+					const float omega = 2.f * M_PI_F * (bin - SDFT_BINS / 2 + b) / _imu_gyro_fft_len;
+					peaks[peak].twiddle_real[b] = cosf(omega);
+					peaks[peak].twiddle_imag[b] = sinf(omega);
+				}
+
+				break;
+			}
+		}
+	}
+}
+
+void GyroFFT::SlidingDftUpdate(int axis, float sample, float sample_old)
+{
+	for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+		SlidingDftPeak &p = _sdft_peaks[axis][peak];
+
+		if (p.bin == 0) {
+			continue;
+		}
+
+		// X_k[n] = (r X_k[n-1] + x[n] - r^N x[n-N]) e^(j 2 pi k / N), damped for numerical stability
+		float delta = sample;
+
+		if (p.samples >= _imu_gyro_fft_len) {
+			delta -= _sdft_damping_n * sample_old;
+
+		} else {
+			p.samples++;
+		}
+
+		for (int b = 0; b < SDFT_BINS; b++) {
+			const float real = SDFT_DAMPING * p.real[b] + delta;
+			const float imag = SDFT_DAMPING * p.imag[b];
+
+			p.real[b] = real * p.twiddle_real[b] - imag * p.twiddle_imag[b];
+			p.imag[b] = real * p.twiddle_imag[b] + imag * p.twiddle_real[b];
+		}
+	}
+}
+
+void GyroFFT::SlidingDftFindPeaks(const hrt_abstime &timestamp_sample, int axis)
+{
+	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+
+	int num_peaks_found = 0;
+	float peak_frequencies[MAX_NUM_PEAKS] {};
+	float peak_snr[MAX_NUM_PEAKS] {};
+
+	for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+		const SlidingDftPeak &p = _sdft_peaks[axis][peak];
+
+		if ((p.bin == 0) || (p.samples < _imu_gyro_fft_len)) {
+			continue;
+		}
+
+		// apply the Hanning window in the frequency domain: X_w[k] = 0.5 X[k] - 0.25 (X[k-1] + X[k+1])
+		float real[3];
+		float imag[3];
+		float magnitude_squared[3];
+
+		for (int i = 0; i < 3; i++) {
+			const int b = i + 1;
+			real[i] = 0.5f * p.real[b] - 0.25f * (p.real[b - 1] + p.real[b + 1]);
+			imag[i] = 0.5f * p.imag[b] - 0.25f * (p.imag[b - 1] + p.imag[b + 1]);
+			magnitude_squared[i] = real[i] * real[i] + imag[i] * imag[i];
+		}
+
+		// the peak moved out of the tracked bin, leave it to the next FFT
+		if ((magnitude_squared[1] < magnitude_squared[0]) || (magnitude_squared[1] < magnitude_squared[2])) {
+			continue;
+		}
+
+		const float freq_adjusted = resolution_hz * (p.bin + EstimatePeakFrequencyOffset(real, imag));
+
+		if (PX4_ISFINITE(freq_adjusted)
+		    && (freq_adjusted >= _param_imu_gyro_fft_min.get())
+		    && (freq_adjusted <= _param_imu_gyro_fft_max.get())) {
+
+			peak_frequencies[num_peaks_found] = freq_adjusted;
+			peak_snr[num_peaks_found] = p.snr;
+			num_peaks_found++;
+		}
+	}
+
 	if (num_peaks_found > 0) {
 		UpdateOutput(timestamp_sample, axis, peak_frequencies, peak_snr, num_peaks_found);
 	}
@@ -703,6 +880,7 @@ int GyroFFT::task_spawn(int argc, char *argv[])
 int GyroFFT::print_status()
 {
 	PX4_INFO("gyro sample rate: %.3f Hz", (double)_gyro_sample_rate_hz);
+	PX4_INFO("peak tracking: %s", _sdft_history ? "enabled" : "disabled");
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_cycle_interval_perf);
 	perf_print_counter(_fft_perf);
@@ -87,6 +87,7 @@ private:
 	void Run() override;
 	inline void FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer);
 	inline float EstimatePeakFrequencyBin(q15_t fft[], int peak_index);
+	inline float EstimatePeakFrequencyOffset(const float real[3], const float imag[3]);
 	inline void Publish();
 	bool SensorSelectionUpdate(bool force = false);
 	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
@@ -94,6 +95,12 @@ private:
 				 float peak_snr[MAX_NUM_PEAKS], int num_peaks_found);
 	void VehicleIMUStatusUpdate(bool force = false);
 
+	void SlidingDftReset();
+	inline void SlidingDftSeed(int axis, const int peak_bins[MAX_NUM_PEAKS], const float peak_snr[MAX_NUM_PEAKS],
+				   int num_peaks_found);
+	inline void SlidingDftUpdate(int axis, float sample, float sample_old);
+	inline void SlidingDftFindPeaks(const hrt_abstime &timestamp_sample, int axis);
+
 	template<size_t N>
 	bool AllocateBuffers()
 	{
@@ -106,10 +113,15 @@ private:
 
 		_peak_magnitudes_all = new float[N];
 
+		if (_param_imu_gyro_fft_trk.get()) {
+			_sdft_history = new q15_t[N * 3];
+		}
+
 		return (_gyro_data_buffer_x && _gyro_data_buffer_y && _gyro_data_buffer_z
 			&& _hanning_window
 			&& _fft_input_buffer
-			&& _fft_outupt_buffer);
+			&& _fft_outupt_buffer
+			&& (_sdft_history || !_param_imu_gyro_fft_trk.get()));
 	}
 
 	uORB::Publication<sensor_gyro_fft_s> _sensor_gyro_fft_pub{ORB_ID(sensor_gyro_fft)};
@@ -143,6 +155,26 @@ private:
 
 	float *_peak_magnitudes_all{nullptr};
 
+	// sliding DFT peak tracking (IMU_GYRO_FFT_TRK)
+	static constexpr int SDFT_BINS = 5; // tracked peak bin and two neighbours on each side for the Hanning window
+	static constexpr float SDFT_DAMPING = 0.9999f;
+
+	struct SlidingDftPeak {
+		int bin{0}; // center bin, 0 if inactive
+		int samples{0};
+		float snr{0.f};
+		float real[SDFT_BINS] {};
+		float imag[SDFT_BINS] {};
+		float twiddle_real[SDFT_BINS] {};
+		float twiddle_imag[SDFT_BINS] {};
+	};
+
+	SlidingDftPeak _sdft_peaks[3][MAX_NUM_PEAKS] {};
+	q15_t *_sdft_history{nullptr}; // last FFT length samples of each axis
+	int _sdft_history_index{0};
+	int _sdft_output_samples{0};
+	float _sdft_damping_n{0.f};
+
 	float _gyro_sample_rate_hz{8000}; // 8 kHz default
 
 	float _fifo_last_scale{0};
@@ -166,7 +198,8 @@ private:
 		(ParamInt<px4::params::IMU_GYRO_FFT_LEN>) _param_imu_gyro_fft_len,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MIN>) _param_imu_gyro_fft_min,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MAX>) _param_imu_gyro_fft_max,
-		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr
+		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr,
+		(ParamBool<px4::params::IMU_GYRO_FFT_TRK>) _param_imu_gyro_fft_trk
 	)
 };
 
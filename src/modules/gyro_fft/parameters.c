@@ -83,3 +83,15 @@ PARAM_DEFINE_INT32(IMU_GYRO_FFT_LEN, 512);
 * @group Sensors
 */
 PARAM_DEFINE_FLOAT(IMU_GYRO_FFT_SNR, 10.f);
+
+/**
+* IMU gyro FFT peak tracking.
+*
+* Track the detected peaks between full FFTs with a sliding DFT of the bins around each peak.
+* Peak frequency updates are published several times per FFT period at an evenly spread CPU cost.
+*
+* @boolean
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_TRK, 0);
@@ -63,6 +63,7 @@ LandingTargetEstimator::LandingTargetEstimator()
 	_paramHandle.offset_x = param_find("LTEST_SENS_POS_X");
 	_paramHandle.offset_y = param_find("LTEST_SENS_POS_Y");
 	_paramHandle.offset_z = param_find("LTEST_SENS_POS_Z");
+	_paramHandle.multi_target = param_find("LTEST_MULTI");
 	_check_params(true);
 }
 
@@ -72,6 +73,11 @@ void LandingTargetEstimator::update()
 
 	_update_topics();
 
+	if (_params.multi_target) {
+		_update_multi_target();
+		return;
+	}
+
 	/* predict */
 	if (_estimator_initialized) {
 		if (hrt_absolute_time() - _last_update > landing_target_estimator_TIMEOUT_US) {
@@ -82,16 +88,7 @@ void LandingTargetEstimator::update()
 			float dt = (hrt_absolute_time() - _last_predict) / SEC2USEC;
 
 			// predict target position with the help of accel data
-			matrix::Vector3f a{_vehicle_acceleration.xyz};
-
-			if (_vehicleAttitude_valid && _vehicle_acceleration_valid) {
-				matrix::Quaternion<float> q_att(&_vehicleAttitude.q[0]);
-				_R_att = matrix::Dcm<float>(q_att);
-				a = _R_att * a;
-
-			} else {
-				a.zero();
-			}
+			const matrix::Vector3f a = _acceleration_ned();
 
 			_kalman_filter_x.predict(dt, -a(0), _params.acc_unc);
 			_kalman_filter_y.predict(dt, -a(1), _params.acc_unc);
@@ -138,9 +135,6 @@ void LandingTargetEstimator::update()
 
 		if (!_faulty) {
 			// only publish if both measurements were good
-
-			_target_pose.timestamp = _target_position_report.timestamp;
-
 			float x, xvel, y, yvel, covx, covx_v, covy, covy_v;
 			_kalman_filter_x.getState(x, xvel);
 			_kalman_filter_x.getCovariance(covx, covx_v);
@@ -148,33 +142,7 @@ void LandingTargetEstimator::update()
 			_kalman_filter_y.getState(y, yvel);
 			_kalman_filter_y.getCovariance(covy, covy_v);
 
-			_target_pose.is_static = (_params.mode == TargetMode::Stationary);
-
-			_target_pose.rel_pos_valid = true;
-			_target_pose.rel_vel_valid = true;
-			_target_pose.x_rel = x;
-			_target_pose.y_rel = y;
-			_target_pose.z_rel = _target_position_report.rel_pos_z ;
-			_target_pose.vx_rel = xvel;
-			_target_pose.vy_rel = yvel;
-
-			_target_pose.cov_x_rel = covx;
-			_target_pose.cov_y_rel = covy;
-
-			_target_pose.cov_vx_rel = covx_v;
-			_target_pose.cov_vy_rel = covy_v;
-
-			if (_vehicleLocalPosition_valid && _vehicleLocalPosition.xy_valid) {
-				_target_pose.x_abs = x + _vehicleLocalPosition.x;
-				_target_pose.y_abs = y + _vehicleLocalPosition.y;
-				_target_pose.z_abs = _target_position_report.rel_pos_z  + _vehicleLocalPosition.z;
-				_target_pose.abs_pos_valid = true;
-
-			} else {
-				_target_pose.abs_pos_valid = false;
-			}
-
-			_targetPosePub.publish(_target_pose);
+			_publish_target_pose(_target_position_report.timestamp, x, xvel, y, yvel, covx, covx_v, covy, covy_v);
 
 			_last_update = hrt_absolute_time();
 			_last_predict = _last_update;
@@ -194,6 +162,102 @@ void LandingTargetEstimator::update()
 	}
 }
 
+void LandingTargetEstimator::_publish_target_pose(hrt_abstime timestamp, float x, float xvel, float y, float yvel,
+		float covx, float covx_v, float covy, float covy_v)
+{
+	_target_pose.timestamp = timestamp;
+
+	_target_pose.is_static = (_params.mode == TargetMode::Stationary);
+
+	_target_pose.rel_pos_valid = true;
+	_target_pose.rel_vel_valid = true;
+	_target_pose.x_rel = x;
+	_target_pose.y_rel = y;
+	_target_pose.z_rel = _target_position_report.rel_pos_z;
+	_target_pose.vx_rel = xvel;
+	_target_pose.vy_rel = yvel;
+
+	_target_pose.cov_x_rel = covx;
+	_target_pose.cov_y_rel = covy;
+
+	_target_pose.cov_vx_rel = covx_v;
+	_target_pose.cov_vy_rel = covy_v;
+
+	if (_vehicleLocalPosition_valid && _vehicleLocalPosition.xy_valid) {
+		_target_pose.x_abs = x + _vehicleLocalPosition.x;
+		_target_pose.y_abs = y + _vehicleLocalPosition.y;
+		_target_pose.z_abs = _target_position_report.rel_pos_z  + _vehicleLocalPosition.z;
+		_target_pose.abs_pos_valid = true;
+
+	} else {
+		_target_pose.abs_pos_valid = false;
+	}
+
+	_targetPosePub.publish(_target_pose);
+}
+
+matrix::Vector3f LandingTargetEstimator::_acceleration_ned()
+{
+	matrix::Vector3f a{_vehicle_acceleration.xyz};
+
+	if (_vehicleAttitude_valid && _vehicle_acceleration_valid) {
+		matrix::Quaternion<float> q_att(&_vehicleAttitude.q[0]);
+		_R_att = matrix::Dcm<float>(q_att);
+		a = _R_att * a;
+
+	} else {
+		a.zero();
+	}
+
+	return a;
+}
+
+void LandingTargetEstimator::_update_multi_target()
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	if (_tracker_running) {
+		const float dt = (now - _last_predict) / SEC2USEC;
+		const matrix::Vector3f a = _acceleration_ned();
+		_tracker.predict(dt, -a(0), -a(1), _params.acc_unc);
+		_tracker.removeStale(now, landing_target_estimator_TIMEOUT_US);
+
+	} else {
+		_tracker.reset();
+		_tracker_running = true;
+	}
+
+	_last_predict = now;
+
+	if (_num_detections == 0) {
+		return;
+	}
+
+	const float vx_init = _vehicleLocalPosition.v_xy_valid ? -_vehicleLocalPosition.vx : 0.f;
+	const float vy_init = _vehicleLocalPosition.v_xy_valid ? -_vehicleLocalPosition.vy : 0.f;
+	const float measurement_uncertainty = _params.meas_unc * _dist_z * _dist_z;
+
+	_tracker.update(_detections, _num_detections, measurement_uncertainty, _params.pos_unc_init, _params.vel_unc_init,
+			vx_init, vy_init, now);
+	_num_detections = 0;
+
+	const int target = _tracker.selectTarget();
+
+	if (target < 0 || !_tracker.updated(target, now)) {
+		return;
+	}
+
+	float x, xvel, y, yvel, covx, covx_v, covy, covy_v;
+	_tracker.getState(target, x, xvel, y, yvel);
+	_tracker.getCovariance(target, covx, covx_v, covy, covy_v);
+	_publish_target_pose(_target_position_report.timestamp, x, xvel, y, yvel, covx, covx_v, covy, covy_v);
+
+	_tracker.getInnovations(target, _target_innovations.innov_x, _target_innovations.innov_cov_x,
+				_target_innovations.innov_y, _target_innovations.innov_cov_y);
+	_target_innovations.timestamp = _target_position_report.timestamp;
+	_targetInnovationsPub.publish(_target_innovations);
+}
+
 void LandingTargetEstimator::_check_params(const bool force)
 {
 	if (_parameter_update_sub.updated() || force) {
@@ -211,51 +275,82 @@ void LandingTargetEstimator::_update_topics()
 	_vehicle_acceleration_valid = _vehicle_acceleration_sub.update(&_vehicle_acceleration);
 
 
-	if (_irlockReportSub.update(&_irlockReport)) { //
-		_new_irlockReport = true;
+	if (_params.multi_target) {
+		// several targets can be reported per cycle, use them all
+		_num_detections = 0;
 
-		if (!_vehicleAttitude_valid || !_vehicleLocalPosition_valid || !_vehicleLocalPosition.dist_bottom_valid) {
-			// don't have the data needed for an update
-			return;
-		}
+		while (_irlockReportSub.update(&_irlockReport)) {
+			TargetPositionReport target;
+
+			if ((_num_detections < MultiTargetTracker::MAX_DETECTIONS) && _compute_target_position(_irlockReport, target)) {
+				_detections[_num_detections].x = target.rel_pos_x;
+				_detections[_num_detections].y = target.rel_pos_y;
+				_detections[_num_detections].signature = _irlockReport.signature;
+				_num_detections++;
 
-		if (!PX4_ISFINITE(_irlockReport.pos_y) || !PX4_ISFINITE(_irlockReport.pos_x)) {
-			return;
+				_target_position_report = target;
+			}
 		}
 
-		matrix::Vector<float, 3> sensor_ray; // ray pointing towards target in body frame
-		sensor_ray(0) = _irlockReport.pos_x * _params.scale_x; // forward
-		sensor_ray(1) = _irlockReport.pos_y * _params.scale_y; // right
-		sensor_ray(2) = 1.0f;
+		return;
+	}
 
-		// rotate unit ray according to sensor orientation
-		_S_att = get_rot_matrix(_params.sensor_yaw);
-		sensor_ray = _S_att * sensor_ray;
+	bool irlock_report_updated = false;
 
-		// rotate the unit ray into the navigation frame
-		matrix::Quaternion<float> q_att(&_vehicleAttitude.q[0]);
-		_R_att = matrix::Dcm<float>(q_att);
-		sensor_ray = _R_att * sensor_ray;
+	// only the latest report is used
+	while (_irlockReportSub.update(&_irlockReport)) {
+		irlock_report_updated = true;
+	}
 
-		if (fabsf(sensor_ray(2)) < 1e-6f) {
-			// z component of measurement unsafe, don't use this measurement
-			return;
-		}
+	if (irlock_report_updated) {
+		_new_irlockReport = true;
+		_compute_target_position(_irlockReport, _target_position_report);
+	}
+}
+
+bool LandingTargetEstimator::_compute_target_position(const irlock_report_s &report, TargetPositionReport &target)
+{
+	if (!_vehicleAttitude_valid || !_vehicleLocalPosition_valid || !_vehicleLocalPosition.dist_bottom_valid) {
+		// don't have the data needed for an update
+		return false;
+	}
 
-		_dist_z = _vehicleLocalPosition.dist_bottom - _params.offset_z;
+	if (!PX4_ISFINITE(report.pos_y) || !PX4_ISFINITE(report.pos_x)) {
+		return false;
+	}
 
-		// scale the ray s.t. the z component has length of _uncertainty_scale
-		_target_position_report.timestamp = _irlockReport.timestamp;
-		_target_position_report.rel_pos_x = sensor_ray(0) / sensor_ray(2) * _dist_z;
-		_target_position_report.rel_pos_y = sensor_ray(1) / sensor_ray(2) * _dist_z;
-		_target_position_report.rel_pos_z = _dist_z;
+	matrix::Vector<float, 3> sensor_ray; // ray pointing towards target in body frame
+	sensor_ray(0) = report.pos_x * _params.scale_x; // forward
+	sensor_ray(1) = report.pos_y * _params.scale_y; // right
+	sensor_ray(2) = 1.0f;
 
-		// Adjust relative position according to sensor offset
-		_target_position_report.rel_pos_x += _params.offset_x;
-		_target_position_report.rel_pos_y += _params.offset_y;
+	// rotate unit ray according to sensor orientation
+	_S_att = get_rot_matrix(_params.sensor_yaw);
+	sensor_ray = _S_att * sensor_ray;
 
-		_new_irlockReport = true;
+	// rotate the unit ray into the navigation frame
+	matrix::Quaternion<float> q_att(&_vehicleAttitude.q[0]);
+	_R_att = matrix::Dcm<float>(q_att);
+	sensor_ray = _R_att * sensor_ray;
+
+	if (fabsf(sensor_ray(2)) < 1e-6f) {
+		// z component of measurement unsafe, don't use this measurement
+		return false;
 	}
+
+	_dist_z = _vehicleLocalPosition.dist_bottom - _params.offset_z;
+
+	// scale the ray s.t. the z component has length of _uncertainty_scale
+	target.timestamp = report.timestamp;
+	target.rel_pos_x = sensor_ray(0) / sensor_ray(2) * _dist_z;
+	target.rel_pos_y = sensor_ray(1) / sensor_ray(2) * _dist_z;
+	target.rel_pos_z = _dist_z;
+
+	// Adjust relative position according to sensor offset
+	target.rel_pos_x += _params.offset_x;
+	target.rel_pos_y += _params.offset_y;
+
+	return true;
 }
 
 void LandingTargetEstimator::_update_params()
@@ -279,6 +374,16 @@ void LandingTargetEstimator::_update_params()
 	param_get(_paramHandle.offset_x, &_params.offset_x);
 	param_get(_paramHandle.offset_y, &_params.offset_y);
 	param_get(_paramHandle.offset_z, &_params.offset_z);
+
+	int32_t multi_target = 0;
+	param_get(_paramHandle.multi_target, &multi_target);
+
+	if ((multi_target != 0) != _params.multi_target) {
+		// start over with the newly selected estimator
+		_params.multi_target = (multi_target != 0);
+		_estimator_initialized = false;
+		_tracker_running = false;
+	}
 }
 
 
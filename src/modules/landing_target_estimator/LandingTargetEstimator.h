@@ -60,6 +60,7 @@
 #include <matrix/Matrix.hpp>
 #include <lib/conversion/rotation.h>
 #include "KalmanFilter.h"
+#include "MultiTargetTracker.h"
 
 using namespace time_literals;
 
@@ -123,6 +124,7 @@ private:
 		param_t offset_y;
 		param_t offset_z;
 		param_t sensor_yaw;
+		param_t multi_target;
 	} _paramHandle;
 
 	struct {
@@ -137,9 +139,10 @@ private:
 		float offset_y;
 		float offset_z;
 		enum Rotation sensor_yaw;
-	} _params;
+		bool multi_target;
+	} _params{};
 
-	struct {
+	struct TargetPositionReport {
 		hrt_abstime timestamp;
 		float rel_pos_x;
 		float rel_pos_y;
@@ -175,8 +178,32 @@ private:
 	hrt_abstime _last_update{0}; // timestamp of last filter update (used to check timeout)
 	float _dist_z{1.0f};
 
+	MultiTargetTracker _tracker;
+	MultiTargetTracker::Detection _detections[MultiTargetTracker::MAX_DETECTIONS] {};
+	int _num_detections{0};
+	bool _tracker_running{false};
+
 	void _check_params(const bool force);
 
 	void _update_state();
+
+	/*
+	 * Compute the target position relative to the vehicle from a sensor report.
+	 * @return false if the report can't be used.
+	 */
+	bool _compute_target_position(const irlock_report_s &report, TargetPositionReport &target);
+
+	/*
+	 * Acceleration in the navigation frame used for the prediction, zero if unavailable.
+	 */
+	matrix::Vector3f _acceleration_ned();
+
+	/*
+	 * Predict and update the multi target tracker and publish the selected target (LTEST_MULTI).
+	 */
+	void _update_multi_target();
+
+	void _publish_target_pose(hrt_abstime timestamp, float x, float xvel, float y, float yvel, float covx,
+				  float covx_v, float covy, float covy_v);
 };
 } // namespace landing_target_estimator
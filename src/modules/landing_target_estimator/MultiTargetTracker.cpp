@@ -0,0 +1,321 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/*
+ * @file MultiTargetTracker.cpp
+ *
+ */
+
+#include "MultiTargetTracker.h"
+
+#include <float.h>
+#include <math.h>
+
+namespace landing_target_estimator
+{
+
+void MultiTargetTracker::reset()
+{
+	for (int i = 0; i < MAX_TRACKS; i++) {
+		_active[i] = false;
+	}
+
+	_selected = -1;
+}
+
+void MultiTargetTracker::predict(float dt, float acc_x, float acc_y, float acc_unc)
+{
+	const float acc[NUM_AXES] {acc_x, acc_y};
+	const float q00 = dt * dt * dt * dt / 4.f * acc_unc;
+	const float q01 = dt * dt * dt / 2.f * acc_unc;
+	const float q11 = dt * dt * acc_unc;
+
+	// inactive tracks are propagated too, which keeps the loops free of branches
+	for (int axis = 0; axis < NUM_AXES; axis++) {
+		for (int i = 0; i < MAX_TRACKS; i++) {
+			_pos[axis][i] += _vel[axis][i] * dt + dt * dt / 2.f * acc[axis];
+			_vel[axis][i] += acc[axis] * dt;
+
+			// P = A * P * A^T + G * G^T * acc_unc, A = [1 dt; 0 1], G = [dt^2/2; dt]
+			_p00[axis][i] += 2.f * dt * _p01[axis][i] + dt * dt * _p11[axis][i] + q00;
+			_p01[axis][i] += dt * _p11[axis][i] + q01;
+			_p11[axis][i] += q11;
+		}
+	}
+}
+
+void MultiTargetTracker::update(const Detection *detections, int num, float meas_unc, float pos_unc_init,
+				float vel_unc_init, float vx_init, float vy_init, hrt_abstime now)
+{
+	if (num > MAX_DETECTIONS) {
+		num = MAX_DETECTIONS;
+	}
+
+	// squared Mahalanobis distance of every detection to every track
+	float dist[MAX_DETECTIONS][MAX_TRACKS];
+	float closest[MAX_DETECTIONS];
+
+	for (int d = 0; d < num; d++) {
+		closest[d] = FLT_MAX;
+
+		for (int i = 0; i < MAX_TRACKS; i++) {
+			const float rx = detections[d].x - _pos[X][i];
+			const float ry = detections[d].y - _pos[Y][i];
+			dist[d][i] = rx * rx / (_p00[X][i] + meas_unc) + ry * ry / (_p00[Y][i] + meas_unc);
+
+			const bool signature_mismatch = (detections[d].signature != 0) && (_signature[i] != 0)
+							&& (detections[d].signature != _signature[i]);
+
+			if (!_active[i] || signature_mismatch) {
+				dist[d][i] = FLT_MAX;
+			}
+
+			closest[d] = fminf(closest[d], dist[d][i]);
+
+			if (!(dist[d][i] <= GATE)) {
+				dist[d][i] = FLT_MAX;
+			}
+		}
+	}
+
+	// gated nearest neighbour: assign the closest pairs first
+	int track_of[MAX_DETECTIONS];
+	float meas[NUM_AXES][MAX_TRACKS] {};
+	float has_meas[MAX_TRACKS] {};
+
+	for (int d = 0; d < num; d++) {
+		track_of[d] = -1;
+	}
+
+	for (int n = 0; n < num; n++) {
+		float best = FLT_MAX;
+		int best_d = -1;
+		int best_i = -1;
+
+		for (int d = 0; d < num; d++) {
+			for (int i = 0; i < MAX_TRACKS; i++) {
+				if (dist[d][i] < best) {
+					best = dist[d][i];
+					best_d = d;
+					best_i = i;
+				}
+			}
+		}
+
+		if (best_d < 0) {
+			break;
+		}
+
+		track_of[best_d] = best_i;
+		meas[X][best_i] = detections[best_d].x;
+		meas[Y][best_i] = detections[best_d].y;
+		has_meas[best_i] = 1.f;
+
+		for (int i = 0; i < MAX_TRACKS; i++) {
+			dist[best_d][i] = FLT_MAX;
+		}
+
+		for (int d = 0; d < num; d++) {
+			dist[d][best_i] = FLT_MAX;
+		}
+	}
+
+	// Kalman update of all tracks at once, tracks without a measurement get a zero gain
+	for (int axis = 0; axis < NUM_AXES; axis++) {
+		for (int i = 0; i < MAX_TRACKS; i++) {
+			// H = [1, 0]
+			const float residual = meas[axis][i] - _pos[axis][i];
+			const float innov_cov = _p00[axis][i] + meas_unc;
+			const float k0 = has_meas[i] * _p00[axis][i] / innov_cov;
+			const float k1 = has_meas[i] * _p01[axis][i] / innov_cov;
+
+			_pos[axis][i] += k0 * residual;
+			_vel[axis][i] += k1 * residual;
+
+			// P = (I - K * H) * P
+			_p11[axis][i] -= k1 * _p01[axis][i];
+			_p01[axis][i] -= k0 * _p01[axis][i];
+			_p00[axis][i] -= k0 * _p00[axis][i];
+
+			if (has_meas[i] > 0.f) {
+				_residual[axis][i] = residual;
+				_innov_cov[axis][i] = innov_cov;
+			}
+		}
+	}
+
+	for (int i = 0; i < MAX_TRACKS; i++) {
+		if (has_meas[i] > 0.f) {
+			_last_update[i] = now;
+
+			if (_hits[i] < UINT8_MAX) {
+				_hits[i]++;
+			}
+		}
+	}
+
+	// start new tracks from the unassigned detections that are not outliers of an existing track
+	for (int d = 0; d < num; d++) {
+		if (track_of[d] >= 0 || closest[d] < NEW_TRACK_GATE) {
+			continue;
+		}
+
+		int slot = -1;
+
+		for (int i = 0; i < MAX_TRACKS; i++) {
+			if (!_active[i]) {
+				slot = i;
+				break;
+			}
+		}
+
+		if (slot < 0) {
+			// table full, replace the tentative track with the fewest updates, never a confirmed one
+			uint8_t fewest_hits = CONFIRM_HITS;
+
+			for (int i = 0; i < MAX_TRACKS; i++) {
+				if (_hits[i] < fewest_hits && _last_update[i] != now) {
+					fewest_hits = _hits[i];
+					slot = i;
+				}
+			}
+		}
+
+		if (slot >= 0) {
+			startTrack(slot, detections[d], pos_unc_init, vel_unc_init, vx_init, vy_init, now);
+		}
+	}
+}
+
+void MultiTargetTracker::startTrack(int i, const Detection &detection, float pos_unc_init, float vel_unc_init,
+				    float vx_init, float vy_init, hrt_abstime now)
+{
+	const float pos[NUM_AXES] {detection.x, detection.y};
+	const float vel[NUM_AXES] {vx_init, vy_init};
+
+	for (int axis = 0; axis < NUM_AXES; axis++) {
+		_pos[axis][i] = pos[axis];
+		_vel[axis][i] = vel[axis];
+		_p00[axis][i] = pos_unc_init;
+		_p01[axis][i] = 0.f;
+		_p11[axis][i] = vel_unc_init;
+		_residual[axis][i] = 0.f;
+		_innov_cov[axis][i] = 0.f;
+	}
+
+	_signature[i] = detection.signature;
+	_last_update[i] = now;
+	_hits[i] = 1;
+	_active[i] = true;
+
+	if (_selected == i) {
+		_selected = -1;
+	}
+}
+
+void MultiTargetTracker::removeStale(hrt_abstime now, hrt_abstime timeout)
+{
+	for (int i = 0; i < MAX_TRACKS; i++) {
+		if (_active[i] && (now - _last_update[i] > timeout)) {
+			_active[i] = false;
+
+			if (_selected == i) {
+				_selected = -1;
+			}
+		}
+	}
+}
+
+int MultiTargetTracker::selectTarget()
+{
+	if (_selected >= 0 && _active[_selected]) {
+		return _selected;
+	}
+
+	_selected = -1;
+	float closest = FLT_MAX;
+
+	for (int i = 0; i < MAX_TRACKS; i++) {
+		if (_active[i] && _hits[i] >= CONFIRM_HITS) {
+			const float dist_sq = _pos[X][i] * _pos[X][i] + _pos[Y][i] * _pos[Y][i];
+
+			if (dist_sq < closest) {
+				closest = dist_sq;
+				_selected = i;
+			}
+		}
+	}
+
+	return _selected;
+}
+
+int MultiTargetTracker::numTracks() const
+{
+	int num = 0;
+
+	for (int i = 0; i < MAX_TRACKS; i++) {
+		if (_active[i]) {
+			num++;
+		}
+	}
+
+	return num;
+}
+
+void MultiTargetTracker::getState(int i, float &x, float &vx, float &y, float &vy) const
+{
+	x = _pos[X][i];
+	vx = _vel[X][i];
+	y = _pos[Y][i];
+	vy = _vel[Y][i];
+}
+
+void MultiTargetTracker::getCovariance(int i, float &cov_x, float &cov_vx, float &cov_y, float &cov_vy) const
+{
+	cov_x = _p00[X][i];
+	cov_vx = _p11[X][i];
+	cov_y = _p00[Y][i];
+	cov_vy = _p11[Y][i];
+}
+
+void MultiTargetTracker::getInnovations(int i, float &innov_x, float &innov_cov_x, float &innov_y,
+					float &innov_cov_y) const
+{
+	innov_x = _residual[X][i];
+	innov_cov_x = _innov_cov[X][i];
+	innov_y = _residual[Y][i];
+	innov_cov_y = _innov_cov[Y][i];
+}
+
+} // namespace landing_target_estimator
@@ -0,0 +1,153 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/*
+ * @file MultiTargetTracker.h
+ * Tracker for several landing targets seen at the same time, e.g. multiple fiducials.
+ *
+ * Each track uses the same constant velocity model per axis as KalmanFilter.
+ * The tracks are kept in a fixed-capacity table stored per state element, so that
+ * predict and update run as one loop over all tracks with a bounded cost.
+ * Detections are associated to tracks by gated nearest neighbour.
+ *
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <stdint.h>
+
+namespace landing_target_estimator
+{
+
+class MultiTargetTracker
+{
+public:
+	static constexpr int MAX_TRACKS = 8;
+	static constexpr int MAX_DETECTIONS = 8;
+
+	struct Detection {
+		float x;		// relative position of the target in the navigation frame
+		float y;
+		uint16_t signature;	// target id from the sensor, 0 if unknown
+	};
+
+	MultiTargetTracker() = default;
+	~MultiTargetTracker() = default;
+
+	/**
+	 * Remove all tracks
+	 */
+	void reset();
+
+	/**
+	 * Predict all tracks with an external acceleration estimate
+	 * @param dt            Time delta in seconds since last prediction
+	 * @param acc_x         Acceleration estimate, x axis
+	 * @param acc_y         Acceleration estimate, y axis
+	 * @param acc_unc       Variance of acceleration estimate
+	 */
+	void predict(float dt, float acc_x, float acc_y, float acc_unc);
+
+	/**
+	 * Associate detections to tracks and update them, start new tracks for the others
+	 * @param detections    Detections of the current cycle
+	 * @param num           Number of detections, at most MAX_DETECTIONS are used
+	 * @param meas_unc      Measurement variance
+	 * @param pos_unc_init  Initial position variance of new tracks
+	 * @param vel_unc_init  Initial velocity variance of new tracks
+	 * @param vx_init       Initial x velocity of new tracks
+	 * @param vy_init       Initial y velocity of new tracks
+	 * @param now           Current time
+	 */
+	void update(const Detection *detections, int num, float meas_unc, float pos_unc_init, float vel_unc_init,
+		    float vx_init, float vy_init, hrt_abstime now);
+
+	/**
+	 * Drop tracks that have not been updated within the timeout
+	 */
+	void removeStale(hrt_abstime now, hrt_abstime timeout);
+
+	/**
+	 * Select the track to land on: keep the current one while it is tracked,
+	 * otherwise take the closest confirmed track.
+	 * @return track index, -1 if there is no confirmed track
+	 */
+	int selectTarget();
+
+	int numTracks() const;
+
+	bool updated(int i, hrt_abstime now) const { return _active[i] && _last_update[i] == now; }
+
+	void getState(int i, float &x, float &vx, float &y, float &vy) const;
+	void getCovariance(int i, float &cov_x, float &cov_vx, float &cov_y, float &cov_vy) const;
+	void getInnovations(int i, float &innov_x, float &innov_cov_x, float &innov_y, float &innov_cov_y) const;
+
+private:
+	enum Axis { X = 0, Y, NUM_AXES };
+
+	// updates needed before a track can be selected
+	static constexpr uint8_t CONFIRM_HITS = 3;
+
+	// association gate on the squared Mahalanobis distance,
+	// 5% false alarm probability with 2 degrees of freedom
+	static constexpr float GATE = 5.99f;
+
+	// detections closer than this to a track are rejected as outliers instead of
+	// starting a new track, 0.1% false alarm probability with 2 degrees of freedom
+	static constexpr float NEW_TRACK_GATE = 13.8f;
+
+	void startTrack(int i, const Detection &detection, float pos_unc_init, float vel_unc_init,
+			float vx_init, float vy_init, hrt_abstime now);
+
+	// state and covariance per axis and track
+	float _pos[NUM_AXES][MAX_TRACKS] {};
+	float _vel[NUM_AXES][MAX_TRACKS] {};
+	float _p00[NUM_AXES][MAX_TRACKS] {};
+	float _p01[NUM_AXES][MAX_TRACKS] {};
+	float _p11[NUM_AXES][MAX_TRACKS] {};
+
+	// residual and residual variance of the last update
+	float _residual[NUM_AXES][MAX_TRACKS] {};
+	float _innov_cov[NUM_AXES][MAX_TRACKS] {};
+
+	hrt_abstime _last_update[MAX_TRACKS] {};
+	uint16_t _signature[MAX_TRACKS] {};
+	uint8_t _hits[MAX_TRACKS] {};
+	bool _active[MAX_TRACKS] {};
+
+	int _selected{-1};
+};
+
+} // namespace landing_target_estimator
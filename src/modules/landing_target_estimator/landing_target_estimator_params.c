@@ -187,3 +187,16 @@ PARAM_DEFINE_FLOAT(LTEST_SENS_POS_Y, 0.0f);
  *
  */
 PARAM_DEFINE_FLOAT(LTEST_SENS_POS_Z, 0.0f);
+
+/**
+ * Track multiple landing targets
+ *
+ * Track all targets reported by the sensor in parallel (e.g. several fiducials)
+ * instead of filtering the latest report only. Reports are associated to tracks by
+ * gated nearest neighbour, using the sensor signature (target id) if provided.
+ * The current target is kept while it is tracked, otherwise the closest one is selected.
+ *
+ * @boolean
+ * @group Landing Target Estimator
+ */
+PARAM_DEFINE_INT32(LTEST_MULTI, 0);
@@ -109,6 +109,22 @@ void LoadMon::Run()
 
 #endif
 
+#if defined(CONFIG_ORB_STATS)
+	orb_statistics();
+#endif // CONFIG_ORB_STATS
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+	work_item_profile();
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+	work_item_deadline();
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+	heap_usage();
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
+
 	if (should_exit()) {
 		ScheduleClear();
 #if defined (__PX4_LINUX)
@@ -248,6 +264,7 @@ void LoadMon::cpuload()
 void LoadMon::stack_usage()
 {
 	unsigned stack_free = 0;
+	unsigned stack_size = 0;
 
 	bool checked_task = false;
 
@@ -260,6 +277,7 @@ void LoadMon::stack_usage()
 	if (system_load.tasks[_stack_task_index].valid && (system_load.tasks[_stack_task_index].tcb->pid > 0)) {
 
 		stack_free = up_check_tcbstack_remain(system_load.tasks[_stack_task_index].tcb);
+		stack_size = system_load.tasks[_stack_task_index].tcb->adj_stack_size;
 
 		strncpy((char *)task_stack_info.task_name, system_load.tasks[_stack_task_index].tcb->name, CONFIG_TASK_NAME_SIZE - 1);
 		task_stack_info.task_name[CONFIG_TASK_NAME_SIZE - 1] = '\0';
@@ -289,6 +307,17 @@ void LoadMon::stack_usage()
 
 		_task_stack_info_pub.publish(task_stack_info);
 
+		// the painted stack gives the high-water mark, for work queues the task name is the queue name
+		memory_usage_s memory_usage{};
+		memory_usage.type = memory_usage_s::TYPE_STACK;
+		static_assert(sizeof(memory_usage.name) == sizeof(task_stack_info.task_name), "name size mismatch");
+		memcpy(memory_usage.name, task_stack_info.task_name, sizeof(memory_usage.name));
+		memory_usage.size = stack_size;
+		memory_usage.used = (stack_size > stack_free) ? stack_size - stack_free : 0;
+		memory_usage.peak = memory_usage.used;
+		memory_usage.timestamp = task_stack_info.timestamp;
+		_memory_usage_pub.publish(memory_usage);
+
 		// Found task low on stack, report and exit. Continue here in next cycle.
 		if (stack_free < STACK_LOW_WARNING_THRESHOLD) {
 			PX4_WARN("%s low on stack! (%i bytes left)", task_stack_info.task_name, stack_free);
@@ -300,6 +329,94 @@ void LoadMon::stack_usage()
 }
 #endif
 
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+void LoadMon::heap_usage()
+{
+	// a few owners per cycle, limited by the queue length (one entry is left for the stack usage)
+	int published = 0;
+
+	for (int i = 0; (i < px4::heap_tracking::MAX_OWNERS) && (published < memory_usage_s::ORB_QUEUE_LENGTH - 1); i++) {
+		px4::heap_tracking::OwnerUsage usage;
+		const int index = _heap_owner_index;
+		_heap_owner_index = (_heap_owner_index + 1) % px4::heap_tracking::MAX_OWNERS;
+
+		if (!px4::heap_tracking::get_usage(index, usage)) {
+			continue;
+		}
+
+		memory_usage_s memory_usage{};
+		memory_usage.type = memory_usage_s::TYPE_HEAP;
+		strncpy(memory_usage.name, usage.name, sizeof(memory_usage.name) - 1);
+		memory_usage.used = math::max(usage.allocated, (int32_t)0);
+		memory_usage.peak = math::max(usage.peak, (int32_t)0);
+		memory_usage.count = math::max(usage.count, (int32_t)0);
+		memory_usage.timestamp = hrt_absolute_time();
+		_memory_usage_pub.publish(memory_usage);
+		published++;
+	}
+}
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
+
+#if defined(CONFIG_ORB_STATS)
+void LoadMon::orb_statistics()
+{
+	// a few instances per cycle, limited by the queue length
+	for (int i = 0; i < orb_statistics_s::ORB_QUEUE_LENGTH; i++) {
+		orb_statistics_s orb_statistics{};
+
+		if (!uORB::Manager::orb_get_next_statistics(_orb_statistics_node, orb_statistics)) {
+			// start over in the next cycle
+			break;
+		}
+
+		orb_statistics.timestamp = hrt_absolute_time();
+		_orb_statistics_pub.publish(orb_statistics);
+	}
+}
+#endif // CONFIG_ORB_STATS
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+void LoadMon::work_item_profile()
+{
+	// a few WorkItems per cycle, limited by the queue length
+	for (int i = 0; i < work_item_profile_s::ORB_QUEUE_LENGTH; i++) {
+		work_item_profile_s work_item_profile{};
+
+		if (!px4::WorkQueueManagerGetNextProfile(_work_item_profile_index, work_item_profile)) {
+			// start over in the next cycle
+			break;
+		}
+
+		work_item_profile.timestamp = hrt_absolute_time();
+		_work_item_profile_pub.publish(work_item_profile);
+	}
+}
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+void LoadMon::work_item_deadline()
+{
+	// a few WorkItems per cycle, limited by the queue length
+	int published = 0;
+
+	while (published < work_item_deadline_s::ORB_QUEUE_LENGTH) {
+		work_item_deadline_s work_item_deadline{};
+
+		if (!px4::WorkQueueManagerGetNextDeadlineStatus(_work_item_deadline_index, work_item_deadline)) {
+			// start over in the next cycle
+			break;
+		}
+
+		// skip WorkItems without a deadline
+		if (work_item_deadline.deadline_us != 0) {
+			work_item_deadline.timestamp = hrt_absolute_time();
+			_work_item_deadline_pub.publish(work_item_deadline);
+			published++;
+		}
+	}
+}
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
 int LoadMon::print_usage(const char *reason)
 {
 	if (reason) {
@@ -314,6 +431,15 @@ usage and publish the `cpuload` topic.
 
 On NuttX it also checks the stack usage of each process and if it falls below 300 bytes, a warning is output,
 which will also appear in the log file.
+
+With CONFIG_ORB_STATS it also publishes the `orb_statistics` of all topic instances, a few per cycle.
+
+On NuttX the stack high-water mark and size of each task (including the work queue threads) is also published
+as `memory_usage`, and with CONFIG_SYSTEM_HEAP_TRACKING the C++ heap usage of each module and WorkItem.
+
+With CONFIG_WORK_QUEUE_PROFILER it also publishes the `work_item_profile` of all WorkItems, a few per cycle.
+
+With CONFIG_WORK_QUEUE_DEADLINE it also publishes the `work_item_deadline` of all WorkItems with a deadline, a few per cycle.
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("load_mon", "system");
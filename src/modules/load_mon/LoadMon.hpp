@@ -46,8 +46,25 @@
 #include <px4_platform/cpuload.h>
 #include <uORB/Publication.hpp>
 #include <uORB/topics/cpuload.h>
+#include <uORB/topics/memory_usage.h>
 #include <uORB/topics/task_stack_info.h>
 
+#if defined(CONFIG_ORB_STATS)
+#include <uORB/topics/orb_statistics.h>
+#endif // CONFIG_ORB_STATS
+
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+#include <px4_platform_common/heap_tracking.h>
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+#include <uORB/topics/work_item_profile.h>
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+#include <uORB/topics/work_item_deadline.h>
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+
 #if defined(__PX4_LINUX)
 #include <sys/times.h>
 #endif
@@ -91,6 +108,41 @@ private:
 	uORB::Publication<task_stack_info_s> _task_stack_info_pub{ORB_ID(task_stack_info)};
 #endif
 	uORB::Publication<cpuload_s> _cpuload_pub {ORB_ID(cpuload)};
+	uORB::Publication<memory_usage_s> _memory_usage_pub{ORB_ID(memory_usage)};
+
+#if defined(CONFIG_SYSTEM_HEAP_TRACKING)
+	/* Publish the heap usage of the next owners */
+	void heap_usage();
+
+	int _heap_owner_index{0};
+#endif // CONFIG_SYSTEM_HEAP_TRACKING
+
+#if defined(CONFIG_ORB_STATS)
+	/* Publish the uORB statistics of the next topic instances */
+	void orb_statistics();
+
+	void *_orb_statistics_node{nullptr};
+
+	uORB::Publication<orb_statistics_s> _orb_statistics_pub{ORB_ID(orb_statistics)};
+#endif // CONFIG_ORB_STATS
+
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+	/* Publish the profiles of the next WorkItems */
+	void work_item_profile();
+
+	unsigned _work_item_profile_index{0};
+
+	uORB::Publication<work_item_profile_s> _work_item_profile_pub{ORB_ID(work_item_profile)};
+#endif // CONFIG_WORK_QUEUE_PROFILER
+
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+	/* Publish the deadline statistics of the next WorkItems with a deadline */
+	void work_item_deadline();
+
+	unsigned _work_item_deadline_index{0};
+
+	uORB::Publication<work_item_deadline_s> _work_item_deadline_pub{ORB_ID(work_item_deadline)};
+#endif // CONFIG_WORK_QUEUE_DEADLINE
 
 #if defined(__PX4_LINUX)
 	FILE *_proc_fd = nullptr;
@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <matrix/Matrix.hpp>
+
+#include <assert.h>
+#include <stdint.h>
+
+/**
+ * Measurement matrix C with a fixed, sparse structure
+ *
+ * Each measurement is the sum of at most two states scaled by a
+ * coefficient, which covers all the LPE measurement models. The
+ * products used by the correct steps only touch the non-zero
+ * entries instead of going through a dense M x N matrix.
+ */
+template<size_t M, size_t N>
+class SparseMeasurementMatrix
+{
+public:
+	static constexpr size_t MAX_TERMS = 2;
+
+	/**
+	 * Add a state to a measurement, in increasing state order
+	 */
+	void set(size_t row, size_t state, float coef)
+	{
+		assert(row < M && state < N && _terms[row] < MAX_TERMS);
+		_state[row][_terms[row]] = static_cast<uint8_t>(state);
+		_coef[row][_terms[row]] = coef;
+		_terms[row]++;
+	}
+
+	/**
+	 * @return C * A
+	 */
+	template<size_t P>
+	matrix::Matrix<float, M, P> operator*(const matrix::Matrix<float, N, P> &A) const
+	{
+		matrix::Matrix<float, M, P> res;
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t p = 0; p < P; p++) {
+				float sum = 0.f;
+
+				for (size_t t = 0; t < _terms[i]; t++) {
+					sum += _coef[i][t] * A(_state[i][t], p);
+				}
+
+				res(i, p) = sum;
+			}
+		}
+
+		return res;
+	}
+
+	/**
+	 * @return A * C^T
+	 */
+	template<size_t P>
+	matrix::Matrix<float, P, M> multiplyByTranspose(const matrix::Matrix<float, P, N> &A) const
+	{
+		matrix::Matrix<float, P, M> res;
+
+		for (size_t p = 0; p < P; p++) {
+			for (size_t i = 0; i < M; i++) {
+				float sum = 0.f;
+
+				for (size_t t = 0; t < _terms[i]; t++) {
+					sum += A(p, _state[i][t]) * _coef[i][t];
+				}
+
+				res(p, i) = sum;
+			}
+		}
+
+		return res;
+	}
+
+private:
+	uint8_t _state[M][MAX_TERMS] {};
+	float _coef[M][MAX_TERMS] {};
+	uint8_t _terms[M] {};
+};
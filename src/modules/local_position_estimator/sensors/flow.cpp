@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurementMatrix.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -111,10 +112,9 @@ void BlockLocalPositionEstimator::flowCorrect()
 	if (flowMeasure(y) != OK) { return; }
 
 	// flow measurement matrix and noise matrix
-	Matrix<float, n_y_flow, n_x> C;
-	C.setZero();
-	C(Y_flow_vx, X_vx) = 1;
-	C(Y_flow_vy, X_vy) = 1;
+	SparseMeasurementMatrix<n_y_flow, n_x> C;
+	C.set(Y_flow_vx, X_vx, 1);
+	C.set(Y_flow_vy, X_vy, 1);
 
 	SquareMatrix<float, n_y_flow> R;
 	R.setZero();
@@ -166,8 +166,11 @@ void BlockLocalPositionEstimator::flowCorrect()
 	// residual
 	Vector<float, 2> r = y - C * _x;
 
+	// P * C^T, shared by the residual covariance and the gain
+	const Matrix<float, n_x, n_y_flow> PCt = C.multiplyByTranspose(m_P);
+
 	// residual covariance
-	Matrix<float, n_y_flow, n_y_flow> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_flow, n_y_flow> S = C * PCt + R;
 
 	// publish innovations
 	_pub_innov.get().flow[0] = r(0);
@@ -194,10 +197,10 @@ void BlockLocalPositionEstimator::flowCorrect()
 
 	if (!(_sensorFault & SENSOR_FLOW)) {
 		Matrix<float, n_x, n_y_flow> K =
-			m_P * C.transpose() * S_I;
+			PCt * S_I;
 		Vector<float, n_x> dx = K * r;
 		_x += dx;
-		m_P -= K * C * m_P;
+		m_P -= K * (C * m_P);
 	}
 }
 
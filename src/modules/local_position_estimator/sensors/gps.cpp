@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurementMatrix.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -130,14 +131,13 @@ void BlockLocalPositionEstimator::gpsCorrect()
 	y(Y_gps_vz) = y_global(Y_gps_vz);
 
 	// gps measurement matrix, measures position and velocity
-	Matrix<float, n_y_gps, n_x> C;
-	C.setZero();
-	C(Y_gps_x, X_x) = 1;
-	C(Y_gps_y, X_y) = 1;
-	C(Y_gps_z, X_z) = 1;
-	C(Y_gps_vx, X_vx) = 1;
-	C(Y_gps_vy, X_vy) = 1;
-	C(Y_gps_vz, X_vz) = 1;
+	SparseMeasurementMatrix<n_y_gps, n_x> C;
+	C.set(Y_gps_x, X_x, 1);
+	C.set(Y_gps_y, X_y, 1);
+	C.set(Y_gps_z, X_z, 1);
+	C.set(Y_gps_vx, X_vx, 1);
+	C.set(Y_gps_vy, X_vy, 1);
+	C.set(Y_gps_vz, X_vz, 1);
 
 	// gps covariance matrix
 	SquareMatrix<float, n_y_gps> R;
@@ -185,8 +185,11 @@ void BlockLocalPositionEstimator::gpsCorrect()
 	// residual
 	Vector<float, n_y_gps> r = y - C * x0;
 
+	// P * C^T, shared by the residual covariance and the gain
+	const Matrix<float, n_x, n_y_gps> PCt = C.multiplyByTranspose(m_P);
+
 	// residual covariance
-	Matrix<float, n_y_gps, n_y_gps> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_gps, n_y_gps> S = C * PCt + R;
 
 	// publish innovations
 	_pub_innov.get().gps_hpos[0] = r(0);
@@ -227,10 +230,10 @@ void BlockLocalPositionEstimator::gpsCorrect()
 	}
 
 	// kalman filter correction always for GPS
-	Matrix<float, n_x, n_y_gps> K = m_P * C.transpose() * S_I;
+	Matrix<float, n_x, n_y_gps> K = PCt * S_I;
 	Vector<float, n_x> dx = K * r;
 	_x += dx;
-	m_P -= K * C * m_P;
+	m_P -= K * (C * m_P);
 }
 
 void BlockLocalPositionEstimator::gpsCheckTimeout()
@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurementMatrix.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -109,11 +110,10 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	}
 
 	// mocap measurement matrix, measures position
-	Matrix<float, n_y_mocap, n_x> C;
-	C.setZero();
-	C(Y_mocap_x, X_x) = 1;
-	C(Y_mocap_y, X_y) = 1;
-	C(Y_mocap_z, X_z) = 1;
+	SparseMeasurementMatrix<n_y_mocap, n_x> C;
+	C.set(Y_mocap_x, X_x, 1);
+	C.set(Y_mocap_y, X_y, 1);
+	C.set(Y_mocap_z, X_z, 1);
 
 	// noise matrix
 	Matrix<float, n_y_mocap, n_y_mocap> R;
@@ -136,10 +136,13 @@ void BlockLocalPositionEstimator::mocapCorrect()
 		R(Y_mocap_z, Y_mocap_z) = _param_lpe_vic_p.get() * _param_lpe_vic_p.get();
 	}
 
+	// P * C^T, shared by the residual covariance and the gain
+	const Matrix<float, n_x, n_y_mocap> PCt = C.multiplyByTranspose(m_P);
+
 	// residual
 	Vector<float, n_y_mocap> r = y - C * _x;
 	// residual covariance
-	Matrix<float, n_y_mocap, n_y_mocap> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_mocap, n_y_mocap> S = C * PCt + R;
 
 	// publish innovations
 	_pub_innov.get().ev_hpos[0] = r(0);
@@ -175,10 +178,10 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	}
 
 	// kalman filter correction always
-	Matrix<float, n_x, n_y_mocap> K = m_P * C.transpose() * S_I;
+	Matrix<float, n_x, n_y_mocap> K = PCt * S_I;
 	Vector<float, n_x> dx = K * r;
 	_x += dx;
-	m_P -= K * C * m_P;
+	m_P -= K * (C * m_P);
 }
 
 void BlockLocalPositionEstimator::mocapCheckTimeout()
@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurementMatrix.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -94,22 +95,24 @@ void BlockLocalPositionEstimator::sonarCorrect()
 	}
 
 	// sonar measurement matrix and noise matrix
-	Matrix<float, n_y_sonar, n_x> C;
-	C.setZero();
+	SparseMeasurementMatrix<n_y_sonar, n_x> C;
 	// y = -(z - tz)
 	// TODO could add trig to make this an EKF correction
-	C(Y_sonar_z, X_z) = -1;	// measured altitude, negative down dir.
-	C(Y_sonar_z, X_tz) = 1;	// measured altitude, negative down dir.
+	C.set(Y_sonar_z, X_z, -1);	// measured altitude, negative down dir.
+	C.set(Y_sonar_z, X_tz, 1);	// measured altitude, negative down dir.
 
 	// covariance matrix
 	SquareMatrix<float, n_y_sonar> R;
 	R.setZero();
 	R(0, 0) = cov;
 
+	// P * C^T, shared by the residual covariance and the gain
+	const Matrix<float, n_x, n_y_sonar> PCt = C.multiplyByTranspose(m_P);
+
 	// residual
 	Vector<float, n_y_sonar> r = y - C * _x;
 	// residual covariance
-	Matrix<float, n_y_sonar, n_y_sonar> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_sonar, n_y_sonar> S = C * PCt + R;
 
 	// publish innovations
 	_pub_innov.get().hagl = r(0);
@@ -138,10 +141,10 @@ void BlockLocalPositionEstimator::sonarCorrect()
 	// kalman filter correction if no fault
 	if (!(_sensorFault & SENSOR_SONAR)) {
 		Matrix<float, n_x, n_y_sonar> K =
-			m_P * C.transpose() * S_I;
+			PCt * S_I;
 		Vector<float, n_x> dx = K * r;
 		_x += dx;
-		m_P -= K * C * m_P;
+		m_P -= K * (C * m_P);
 	}
 }
 
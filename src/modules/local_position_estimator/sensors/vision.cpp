@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurementMatrix.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -114,11 +115,10 @@ void BlockLocalPositionEstimator::visionCorrect()
 	}
 
 	// vision measurement matrix, measures position
-	Matrix<float, n_y_vision, n_x> C;
-	C.setZero();
-	C(Y_vision_x, X_x) = 1;
-	C(Y_vision_y, X_y) = 1;
-	C(Y_vision_z, X_z) = 1;
+	SparseMeasurementMatrix<n_y_vision, n_x> C;
+	C.set(Y_vision_x, X_x, 1);
+	C.set(Y_vision_y, X_y, 1);
+	C.set(Y_vision_z, X_z, 1);
 
 	// noise matrix
 	Matrix<float, n_y_vision, n_y_vision> R;
@@ -153,10 +153,13 @@ void BlockLocalPositionEstimator::visionCorrect()
 
 	Vector<float, n_x> x0 = _xDelay.get(i_hist);
 
+	// P * C^T, shared by the residual covariance and the gain
+	const Matrix<float, n_x, n_y_vision> PCt = C.multiplyByTranspose(m_P);
+
 	// residual
 	Matrix<float, n_y_vision, 1> r = y - C * x0;
 	// residual covariance
-	Matrix<float, n_y_vision, n_y_vision> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_vision, n_y_vision> S = C * PCt + R;
 
 	// publish innovations
 	_pub_innov.get().ev_hpos[0] = r(0, 0);
@@ -193,10 +196,10 @@ void BlockLocalPositionEstimator::visionCorrect()
 
 	// kalman filter correction if no fault
 	if (!(_sensorFault & SENSOR_VISION)) {
-		Matrix<float, n_x, n_y_vision> K = m_P * C.transpose() * S_I;
+		Matrix<float, n_x, n_y_vision> K = PCt * S_I;
 		Vector<float, n_x> dx = K * r;
 		_x += dx;
-		m_P -= K * C * m_P;
+		m_P -= K * (C * m_P);
 	}
 }
 
@@ -0,0 +1,119 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "flight_recorder.h"
+#include "messages.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <mathlib/mathlib.h>
+
+namespace px4
+{
+namespace logger
+{
+
+FlightRecorder::~FlightRecorder()
+{
+	free(_buffer);
+}
+
+bool FlightRecorder::allocate(size_t buffer_size, hrt_abstime window)
+{
+	free(_buffer);
+	_buffer = (uint8_t *)malloc(buffer_size);
+	_buffer_size = _buffer ? buffer_size : 0;
+	_window = window;
+	clear();
+	return _buffer != nullptr;
+}
+
+void FlightRecorder::clear()
+{
+	_head = 0;
+	_tail = 0;
+	_count = 0;
+}
+
+void FlightRecorder::push(const uint8_t *msg, size_t size)
+{
+	if (size > _buffer_size || size < sizeof(ulog_message_data_s) + sizeof(uint64_t)) {
+		return;
+	}
+
+	hrt_abstime timestamp;
+	memcpy(&timestamp, msg + sizeof(ulog_message_data_s), sizeof(timestamp));
+
+	// make space and drop messages outside of the time window
+	while (_count > 0 && (_buffer_size - _count < size || message_timestamp(_tail) + _window < timestamp)) {
+		drop_oldest();
+	}
+
+	const size_t n = math::min(size, _buffer_size - _head);
+	memcpy(&_buffer[_head], msg, n);
+	memcpy(&_buffer[0], msg + n, size - n);
+	_head = (_head + size) % _buffer_size;
+	_count += size;
+}
+
+size_t FlightRecorder::message_size(size_t pos) const
+{
+	uint8_t header[ULOG_MSG_HEADER_LEN];
+	read(pos, header, sizeof(header));
+	return (header[0] | (header[1] << 8)) + ULOG_MSG_HEADER_LEN;
+}
+
+hrt_abstime FlightRecorder::message_timestamp(size_t pos) const
+{
+	hrt_abstime timestamp;
+	read((pos + sizeof(ulog_message_data_s)) % _buffer_size, (uint8_t *)&timestamp, sizeof(timestamp));
+	return timestamp;
+}
+
+void FlightRecorder::read(size_t pos, uint8_t *dst, size_t size) const
+{
+	const size_t n = math::min(size, _buffer_size - pos);
+	memcpy(dst, &_buffer[pos], n);
+	memcpy(dst + n, &_buffer[0], size - n);
+}
+
+void FlightRecorder::drop_oldest()
+{
+	const size_t size = message_size(_tail);
+	_tail = (_tail + size) % _buffer_size;
+	_count -= size;
+}
+
+} // namespace logger
+} // namespace px4
@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <drivers/drv_hrt.h>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class FlightRecorder
+ * RAM ring buffer of complete ULog data messages (the ULog header contains the size, so no extra framing is
+ * needed). When full, or when the oldest message is older than the configured window, the oldest messages are dropped.
+ * Not thread-safe (only used from the logger thread).
+ * Also used for the telemetry history (low-rate copy of the main telemetry topics).
+ */
+class FlightRecorder
+{
+public:
+	FlightRecorder() = default;
+	~FlightRecorder();
+
+	/**
+	 * @param buffer_size [bytes]
+	 * @param window keep messages for this long [us]
+	 * @return false if allocation fails
+	 */
+	bool allocate(size_t buffer_size, hrt_abstime window);
+
+	bool allocated() const { return _buffer != nullptr; }
+
+	/**
+	 * Add a ULog data message (header + topic data, starting with the timestamp)
+	 */
+	void push(const uint8_t *msg, size_t size);
+
+	/**
+	 * Pass all messages (oldest first) to sink(uint8_t *msg, size_t size) and empty the buffer.
+	 * @param scratch buffer to reassemble messages wrapping around the buffer end, must fit every pushed message
+	 */
+	template<typename Sink>
+	void flush(uint8_t *scratch, size_t scratch_size, Sink &&sink)
+	{
+		while (_count > 0) {
+			const size_t size = message_size(_tail);
+
+			if (size <= scratch_size) {
+				read(_tail, scratch, size);
+				sink(scratch, size);
+			}
+
+			drop_oldest();
+		}
+	}
+
+	/**
+	 * Pass all messages (oldest first) to sink(uint8_t *msg, size_t size) and keep them in the buffer.
+	 * @param scratch see flush()
+	 */
+	template<typename Sink>
+	void for_each(uint8_t *scratch, size_t scratch_size, Sink &&sink) const
+	{
+		size_t pos = _tail;
+
+		for (size_t remaining = _count; remaining > 0;) {
+			const size_t size = message_size(pos);
+
+			if (size <= scratch_size) {
+				read(pos, scratch, size);
+				sink(scratch, size);
+			}
+
+			pos = (pos + size) % _buffer_size;
+			remaining -= size;
+		}
+	}
+
+	void clear();
+
+	size_t count() const { return _count; }
+	size_t buffer_size() const { return _buffer_size; }
+
+private:
+	size_t message_size(size_t pos) const;
+	hrt_abstime message_timestamp(size_t pos) const;
+	void read(size_t pos, uint8_t *dst, size_t size) const;
+	void drop_oldest();
+
+	uint8_t *_buffer{nullptr};
+	size_t _buffer_size{0};
+	size_t _head{0}; ///< next position to write to
+	size_t _tail{0}; ///< oldest message
+	size_t _count{0}; ///< bytes used
+	hrt_abstime _window{0};
+};
+
+} // namespace logger
+} // namespace px4
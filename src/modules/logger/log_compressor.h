@@ -0,0 +1,145 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HEATSHRINK_DYNAMIC_ALLOC 0
+#include <lib/heatshrink/heatshrink/heatshrink_encoder.h>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class LogCompressor
+ * Streaming heatshrink (LZSS) compression of a ULog file.
+ * A compressed log (.ulgz) consists of an uncompressed header (see header()), followed by the heatshrink
+ * stream of the ULog file (decode with Tools/decompress_ulog.py).
+ */
+class LogCompressor
+{
+public:
+	static constexpr size_t HEADER_SIZE = 8;
+
+	/** the encoder buffers up to this many input bytes before they are compressed */
+	static constexpr size_t INPUT_BUFFER_SIZE = 1 << HEATSHRINK_STATIC_WINDOW_BITS;
+
+	/**
+	 * Upper bound of the output of a compress() call with size bytes
+	 * (incompressible data expands by 1 bit/byte, plus data buffered from previous calls)
+	 */
+	static constexpr size_t max_output_size(size_t size) { return (size + INPUT_BUFFER_SIZE) * 9 / 8 + 2; }
+
+	/**
+	 * Largest input size for which max_output_size() fits into size bytes
+	 */
+	static constexpr size_t max_input_size(size_t size)
+	{
+		return size * 8 / 9 > INPUT_BUFFER_SIZE + 2 ? size * 8 / 9 - INPUT_BUFFER_SIZE - 2 : 0;
+	}
+
+	/**
+	 * File header: magic, version, window & lookahead bits
+	 */
+	static void header(uint8_t buf[HEADER_SIZE])
+	{
+		buf[0] = 'U';
+		buf[1] = 'L';
+		buf[2] = 'o';
+		buf[3] = 'g';
+		buf[4] = 'Z';
+		buf[5] = 1;
+		buf[6] = HEATSHRINK_STATIC_WINDOW_BITS;
+		buf[7] = HEATSHRINK_STATIC_LOOKAHEAD_BITS;
+	}
+
+	/**
+	 * Start a new stream
+	 */
+	void reset() { heatshrink_encoder_reset(&_hse); }
+
+	/**
+	 * Compress data and pass the output on to sink(const uint8_t *data, size_t size).
+	 * The output can be delayed (up to INPUT_BUFFER_SIZE bytes are kept until more data arrives or finish()).
+	 */
+	template<typename Sink>
+	void compress(const uint8_t *data, size_t size, Sink &&sink)
+	{
+		size_t offset = 0;
+
+		while (offset < size) {
+			size_t sunk = 0;
+			heatshrink_encoder_sink(&_hse, const_cast<uint8_t *>(data + offset), size - offset, &sunk);
+			offset += sunk;
+			poll(sink);
+		}
+	}
+
+	/**
+	 * Flush all remaining data at the end of the stream (output is at most max_output_size(0))
+	 */
+	template<typename Sink>
+	void finish(Sink &&sink)
+	{
+		while (heatshrink_encoder_finish(&_hse) == HSER_FINISH_MORE) {
+			poll(sink);
+		}
+	}
+
+private:
+	template<typename Sink>
+	void poll(Sink &sink)
+	{
+		uint8_t out[64];
+		size_t out_size;
+		HSE_poll_res res;
+
+		do {
+			out_size = 0;
+			res = heatshrink_encoder_poll(&_hse, out, sizeof(out), &out_size);
+
+			if (out_size > 0) {
+				sink(out, out_size);
+			}
+		} while (res == HSER_POLL_MORE);
+	}
+
+	heatshrink_encoder _hse;
+};
+
+}
+}
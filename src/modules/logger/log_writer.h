@@ -94,6 +94,20 @@ public:
 	 */
 	int write_message(LogType type, void *ptr, size_t size, uint64_t dropout_start = 0);
 
+	/**
+	 * Reserve space to write a single ulog message directly into the file buffer, avoiding a copy.
+	 * Only possible if the file backend is the only one that is written to and there's no reliable
+	 * transfer. The caller must hold the lock until commit_file() is called.
+	 * @return pointer to size bytes, or nullptr (use write_message() instead)
+	 */
+	void *reserve_file(LogType type, size_t size);
+
+	/**
+	 * Finish a message written to the space returned by reserve_file().
+	 * @param size message size (including header), can be less than reserved
+	 */
+	void commit_file(LogType type, size_t size);
+
 	/**
 	 * Select a backend, so that future calls to write_message() only write to the selected
 	 * sel_backend, until unselect_write_backend() is called.
@@ -159,6 +173,16 @@ public:
 		if (_log_writer_mavlink) { _log_writer_mavlink->set_need_reliable_transfer(need_reliable && mavlink_backed_too); }
 	}
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	/**
+	 * Enable/disable compression of the file log of a type, applies to the next start_log_file()
+	 */
+	void set_compression(LogType type, bool enable)
+	{
+		if (_log_writer_file) { _log_writer_file->set_compression(type, enable); }
+	}
+#endif
+
 	bool need_reliable_transfer() const
 	{
 		if (_log_writer_file) { return _log_writer_file->need_reliable_transfer(); }
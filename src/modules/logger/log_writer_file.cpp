@@ -53,18 +53,26 @@ namespace px4
 {
 namespace logger
 {
-constexpr size_t LogWriterFile::_min_write_chunk;
+constexpr size_t LogWriterFile::_min_write_chunk[];
 
 LogWriterFile::LogWriterFile(size_t buffer_size)
 	: _buffers{
 	//We always write larger chunks (orb messages) to the buffer, so the buffer
 	//needs to be larger than the minimum write chunk (300 is somewhat arbitrary)
 	{
-		math::max(buffer_size, _min_write_chunk + 300),
-		perf_alloc(PC_ELAPSED, "logger_sd_write"), perf_alloc(PC_ELAPSED, "logger_sd_fsync")},
+		math::max(buffer_size, _min_write_chunk[(int)LogType::Full] + 300),
+		perf_alloc(PC_ELAPSED, "logger_sd_write"), perf_alloc(PC_ELAPSED, "logger_sd_fsync"),
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+		true
+#endif
+	},
 
 	{
+#if defined(CONFIG_LOGGER_COMPRESSION)
+		1024, // buffer size for the mission log (needs to fit the worst case compressed output)
+#else
 		300, // buffer size for the mission log (can be kept fairly small)
+#endif
 		perf_alloc(PC_ELAPSED, "logger_sd_write_mission"), perf_alloc(PC_ELAPSED, "logger_sd_fsync_mission")}
 }
 {
@@ -79,6 +87,14 @@ bool LogWriterFile::init()
 
 LogWriterFile::~LogWriterFile()
 {
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	for (int i = 0; i < (int)LogType::Count; ++i) {
+		delete _compressor[i];
+	}
+
+#endif
+
 	pthread_mutex_destroy(&_mtx);
 	pthread_cond_destroy(&_cv);
 }
@@ -225,7 +241,14 @@ bool LogWriterFile::start_log(LogType type, const char *filename)
 
 	unlock();
 
-	if (type == LogType::Full) {
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	// appending the crash log to a compressed file would corrupt the stream
+	const bool register_hardfault = type == LogType::Full && !_compression_enabled[(int)type];
+#else
+	const bool register_hardfault = type == LogType::Full;
+#endif
+
+	if (register_hardfault) {
 		// register the current file with the hardfault handler: if the system crashes,
 		// the hardfault handler will append the crash log to that file on the next reboot.
 		// Note that we don't deregister it when closing the log, so that crashes after disarming
@@ -246,9 +269,41 @@ bool LogWriterFile::start_log(LogType type, const char *filename)
 		return false;
 	}
 
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	_buffers[(int)type].set_encrypted(_algorithm != CRYPTO_NONE);
+#endif
+#endif
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	_compressing[(int)type] = false;
+
+	if (_compression_enabled[(int)type] && !_compressor[(int)type]) {
+		_compressor[(int)type] = new LogCompressor();
+
+		if (!_compressor[(int)type]) {
+			PX4_ERR("alloc failed");
+			return false;
+		}
+	}
+
 #endif
 
 	if (_buffers[(int)type].start_log(filename)) {
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+		if (_compression_enabled[(int)type]) {
+			// the header is not compressed, the rest of the file is one heatshrink stream
+			uint8_t header[LogCompressor::HEADER_SIZE];
+			LogCompressor::header(header);
+
+			lock();
+			_compressor[(int)type]->reset();
+			_buffers[(int)type].write_no_check(header, sizeof(header));
+			_compressing[(int)type] = true;
+			unlock();
+		}
+
+#endif
 		PX4_INFO("Opened %s log file: %s", log_type_str(type), filename);
 		notify();
 		return true;
@@ -292,7 +347,31 @@ int LogWriterFile::hardfault_store_filename(const char *log_file)
 void LogWriterFile::stop_log(LogType type)
 {
 	lock();
-	_buffers[(int)type]._should_run = false;
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (_compressing[(int)type] && is_started(type)) {
+		LogFileBuffer &buffer = _buffers[(int)type];
+
+		// wait for space to flush the end of the stream
+		while (buffer.available() < LogCompressor::max_output_size(0) && is_started(type)) {
+			unlock();
+			notify();
+			px4_usleep(3000);
+			lock();
+		}
+
+		if (is_started(type)) {
+			_compressor[(int)type]->finish([&buffer](const uint8_t *data, size_t size) {
+				buffer.write_no_check((void *)data, size);
+			});
+		}
+	}
+
+	_compressing[(int)type] = false;
+#endif
+
+	_buffers[(int)type]._should_run.store(false);
 	unlock();
 	notify();
 }
@@ -310,6 +389,16 @@ int LogWriterFile::thread_start()
 	pthread_attr_setstacksize(&thr_attr, PX4_STACK_ADJUSTED(1170));
 
 	int ret = pthread_create(&_thread, &thr_attr, &LogWriterFile::run_helper, this);
+
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+
+	if (ret == 0) {
+		// same priority as the writer, so they alternate between encrypting and waiting for the SD card
+		ret = pthread_create(&_encryption_thread, &thr_attr, &LogWriterFile::run_encryption_helper, this);
+	}
+
+#endif
+
 	pthread_attr_destroy(&thr_attr);
 
 	return ret;
@@ -320,7 +409,8 @@ void LogWriterFile::thread_stop()
 	// this will terminate the main loop of the writer thread
 	lock();
 	_exit_thread.store(true);
-	_buffers[0]._should_run = _buffers[1]._should_run = false;
+	_buffers[0]._should_run.store(false);
+	_buffers[1]._should_run.store(false);
 	unlock();
 
 	notify();
@@ -331,6 +421,15 @@ void LogWriterFile::thread_stop()
 	if (ret) {
 		PX4_WARN("join failed: %d", ret);
 	}
+
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	ret = pthread_join(_encryption_thread, nullptr);
+
+	if (ret) {
+		PX4_WARN("join failed: %d", ret);
+	}
+
+#endif
 }
 
 void *LogWriterFile::run_helper(void *context)
@@ -341,6 +440,79 @@ void *LogWriterFile::run_helper(void *context)
 	return nullptr;
 }
 
+bool LogWriterFile::encryption_done(const LogFileBuffer &buffer) const
+{
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	// a remainder smaller than a block is never encrypted (same as without the pipeline)
+	return buffer.pending_encryption() < (size_t)_min_blocksize;
+#else
+	return true;
+#endif
+}
+
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+bool LogWriterFile::encryption_pending() const
+{
+	return !encryption_done(_buffers[0]) || !encryption_done(_buffers[1]);
+}
+
+void *LogWriterFile::run_encryption_helper(void *context)
+{
+	px4_prctl(PR_SET_NAME, "log_writer_crypt", px4_getpid());
+
+	static_cast<LogWriterFile *>(context)->run_encryption();
+	return nullptr;
+}
+
+void LogWriterFile::run_encryption()
+{
+	while (!_exit_thread.load()) {
+		bool encrypted = false;
+
+		/* Mission log is first to avoid drops */
+		for (int i = (int)LogType::Count - 1; i >= 0; --i) {
+			LogFileBuffer &buffer = _buffers[i];
+			void *ptr;
+
+			buffer.lock_encryption();
+			size_t size = buffer.get_encrypt_ptr(&ptr);
+
+			// Split into min blocksize chunks, so it is good for encrypting in pieces
+			size = (size / _min_blocksize) * _min_blocksize;
+
+			if (size > 0) {
+				/* Same assumptions as the in place encryption of the writer thread: the cipher size is
+				 * the same as the input size and the crypto backend encrypts in place. Hardware backends
+				 * can block here for the DMA transfer, the writer thread keeps writing meanwhile. */
+				size_t out = size;
+				_crypto.encrypt_data(_key_idx, (uint8_t *)ptr, size, (uint8_t *)ptr, &out);
+
+				if (out != size) {
+					PX4_ERR("Encryption output size mismatch, logfile corrupted");
+				}
+
+				buffer.mark_encrypted(size);
+				encrypted = true;
+			}
+
+			buffer.unlock_encryption();
+		}
+
+		pthread_mutex_lock(&_mtx);
+
+		if (encrypted) {
+			// wake up the writer thread
+			pthread_cond_broadcast(&_cv);
+
+		} else if (!_exit_thread.load() && !encryption_pending()) {
+			pthread_cond_wait(&_cv, &_mtx);
+		}
+
+		pthread_mutex_unlock(&_mtx);
+	}
+}
+#endif // CONFIG_LOGGER_CRYPTO_PIPELINE
+
 void LogWriterFile::run()
 {
 	while (!_exit_thread.load()) {
@@ -350,7 +522,7 @@ void LogWriterFile::run()
 			bool start = false;
 			pthread_mutex_lock(&_mtx);
 			pthread_cond_wait(&_cv, &_mtx);
-			start = _buffers[0]._should_run || _buffers[1]._should_run;
+			start = _buffers[0]._should_run.load() || _buffers[1]._should_run.load();
 			pthread_mutex_unlock(&_mtx);
 
 			if (start) {
@@ -365,8 +537,6 @@ void LogWriterFile::run()
 		int poll_count = 0;
 		hrt_abstime last_fsync = hrt_absolute_time();
 
-		pthread_mutex_lock(&_mtx);
-
 		while (true) {
 
 			const hrt_abstime now = hrt_absolute_time();
@@ -380,11 +550,6 @@ void LogWriterFile::run()
 				poll_count = 0;
 			}
 
-			constexpr size_t min_available[(int)LogType::Count] = {
-				_min_write_chunk,
-				1 // For the mission log, write as soon as there is data available
-			};
-
 			/* Check all buffers for available data. Mission log is first to avoid drops */
 			int i = (int)LogType::Count - 1;
 
@@ -392,6 +557,10 @@ void LogWriterFile::run()
 				void *read_ptr;
 				bool is_part;
 				LogFileBuffer &buffer = _buffers[i];
+
+				// The buffer is single producer (logger thread), single consumer (this thread), so reading
+				// does not need the lock. Check _should_run first: once it is cleared nothing is added anymore.
+				const bool should_run = buffer._should_run.load();
 				size_t available = buffer.get_read_ptr(&read_ptr, &is_part);
 
 #if defined(PX4_CRYPTO)
@@ -399,11 +568,25 @@ void LogWriterFile::run()
 				available = (available / _min_blocksize) * _min_blocksize;
 #endif
 
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+
+				if (buffer.direct_io()) {
+					if (should_run) {
+						// only whole blocks (buffer start and size are block aligned, so the tail stays aligned)
+						available = (available / _direct_io_block) * _direct_io_block;
+
+					} else if (available % _direct_io_block != 0) {
+						// unaligned remainder at the end of the log
+						buffer.disable_direct_io();
+					}
+				}
+
+#endif
+
 				/* if sufficient data available or partial read or terminating, write data */
-				if (available >= min_available[i] || is_part || (!buffer._should_run && available > 0)) {
-					pthread_mutex_unlock(&_mtx);
+				if (available >= _min_write_chunk[i] || is_part || (!should_run && available > 0)) {
 
-#if defined(PX4_CRYPTO)
+#if defined(PX4_CRYPTO) && !defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
 					/* This makes the following assumptions:
 					 * - the chipher size is always the
 					     same as the input size
@@ -438,41 +621,50 @@ void LogWriterFile::run()
 						written = buffer.write_to_file(read_ptr, available, call_fsync);
 					}
 
-					/* buffer.mark_read() requires _mtx to be locked */
-					pthread_mutex_lock(&_mtx);
-
 					if (written >= 0) {
 						/* subtract bytes written from number in buffer (count -= written) */
 						buffer.mark_read(written);
 
-						if (!buffer._should_run && written == static_cast<int>(available) && !is_part) {
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+
+						if (buffer.direct_io() && written % _direct_io_block != 0) {
+							// short write, the buffer is not aligned to the file offset anymore
+							buffer.disable_direct_io();
+						}
+
+#endif
+
+						if (!should_run && written == static_cast<int>(available) && !is_part
+						    && encryption_done(buffer)) {
 							/* Stop only when all data written */
-							pthread_mutex_unlock(&_mtx);
 							buffer.close_file();
 							pthread_mutex_lock(&_mtx);
 							buffer.reset();
+							pthread_mutex_unlock(&_mtx);
 						}
 
 					} else {
 						PX4_ERR("write failed (%i)", errno);
 						buffer._had_write_error.store(true);
-						buffer._should_run = false;
+
+						// the producer only writes with the lock held, stop it before resetting
+						pthread_mutex_lock(&_mtx);
+						buffer._should_run.store(false);
 						pthread_mutex_unlock(&_mtx);
 						buffer.close_file();
 						pthread_mutex_lock(&_mtx);
 						buffer.reset();
+						pthread_mutex_unlock(&_mtx);
 					}
 
-				} else if (call_fsync && buffer._should_run) {
-					pthread_mutex_unlock(&_mtx);
+				} else if (call_fsync && should_run) {
 					buffer.fsync();
-					pthread_mutex_lock(&_mtx);
 
-				} else if (available == 0 && !buffer._should_run) {
-					pthread_mutex_unlock(&_mtx);
+				} else if (available == 0 && !should_run && encryption_done(buffer)) {
 					buffer.close_file();
 					pthread_mutex_lock(&_mtx);
 					buffer.reset();
+					pthread_mutex_unlock(&_mtx);
 				}
 
 				/* if split into 2 parts, write the second part immediately as well */
@@ -499,13 +691,22 @@ void LogWriterFile::run()
 			 * not an issue because notify() is called regularly.
 			 * If the logger was switched off in the meantime, do not wait for data, instead run this loop
 			 * once more to write remaining data and close the file. */
-			if (_buffers[0]._should_run || _buffers[1]._should_run) {
+			pthread_mutex_lock(&_mtx);
+
+			if (_buffers[0]._should_run.load() || _buffers[1]._should_run.load()) {
 				pthread_cond_wait(&_cv, &_mtx);
 			}
-		}
 
-		// go back to idle
-		pthread_mutex_unlock(&_mtx);
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+			else if (encryption_pending()) {
+				// the remaining data is still being encrypted, the encryption thread notifies when done
+				pthread_cond_wait(&_cv, &_mtx);
+			}
+
+#endif
+
+			pthread_mutex_unlock(&_mtx);
+		}
 	}
 }
 
@@ -528,7 +729,7 @@ int LogWriterFile::write_message(LogType type, void *ptr, size_t size, uint64_t
 
 		do {
 			// Split into several blocks if the data is longer than the write buffer
-			size_t write_size = math::min(size, _buffers[(int)type].buffer_size());
+			size_t write_size = math::min(size, max_write_size(type));
 
 			while ((ret = write(type, uptr, write_size, 0)) == -1) {
 				unlock();
@@ -561,6 +762,29 @@ int LogWriterFile::write(LogType type, void *ptr, size_t size, uint64_t dropout_
 		dropout_size = sizeof(ulog_message_dropout_s);
 	}
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (_compressing[(int)type]) {
+		if (LogCompressor::max_output_size(size + dropout_size) > available) {
+			// buffer overflow
+			return -1;
+		}
+
+		LogFileBuffer &buffer = _buffers[(int)type];
+		auto sink = [&buffer](const uint8_t *data, size_t len) { buffer.write_no_check((void *)data, len); };
+
+		if (dropout_start) {
+			ulog_message_dropout_s dropout_msg;
+			dropout_msg.duration = (uint16_t)(hrt_elapsed_time(&dropout_start) / 1000);
+			_compressor[(int)type]->compress((const uint8_t *)&dropout_msg, sizeof(dropout_msg), sink);
+		}
+
+		_compressor[(int)type]->compress((const uint8_t *)ptr, size, sink);
+		return 0;
+	}
+
+#endif
+
 	if (size + dropout_size > available) {
 		// buffer overflow
 		return -1;
@@ -577,6 +801,40 @@ int LogWriterFile::write(LogType type, void *ptr, size_t size, uint64_t dropout_
 	return 0;
 }
 
+size_t LogWriterFile::max_write_size(LogType type) const
+{
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (_compressing[(int)type]) {
+		return LogCompressor::max_input_size(_buffers[(int)type].buffer_size());
+	}
+
+#endif
+	return _buffers[(int)type].buffer_size();
+}
+
+void *LogWriterFile::reserve(LogType type, size_t size)
+{
+	if (!is_started(type) || _need_reliable_transfer) {
+		return nullptr;
+	}
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (_compressing[(int)type]) {
+		return nullptr;
+	}
+
+#endif
+
+	return _buffers[(int)type].reserve(size);
+}
+
+void LogWriterFile::commit(LogType type, size_t size)
+{
+	_buffers[(int)type].commit(size);
+}
+
 const char *log_type_str(LogType type)
 {
 	switch (type) {
@@ -591,9 +849,18 @@ const char *log_type_str(LogType type)
 }
 
 LogWriterFile::LogFileBuffer::LogFileBuffer(size_t log_buffer_size, perf_counter_t perf_write,
-		perf_counter_t perf_fsync)
+		perf_counter_t perf_fsync, bool direct_io)
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+	: _buffer_size(direct_io ? (log_buffer_size + _direct_io_block - 1) / _direct_io_block * _direct_io_block :
+		       log_buffer_size),
+	  _perf_write(perf_write), _perf_fsync(perf_fsync), _use_direct_io(direct_io)
+#else
 	: _buffer_size(log_buffer_size), _perf_write(perf_write), _perf_fsync(perf_fsync)
+#endif
 {
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	pthread_mutex_init(&_encrypt_mtx, nullptr);
+#endif
 }
 
 LogWriterFile::LogFileBuffer::~LogFileBuffer()
@@ -606,6 +873,10 @@ LogWriterFile::LogFileBuffer::~LogFileBuffer()
 
 	perf_free(_perf_write);
 	perf_free(_perf_fsync);
+
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	pthread_mutex_destroy(&_encrypt_mtx);
+#endif
 }
 
 void LogWriterFile::LogFileBuffer::write_no_check(void *ptr, size_t size)
@@ -628,30 +899,108 @@ void LogWriterFile::LogFileBuffer::write_no_check(void *ptr, size_t size)
 
 	memcpy(&(_buffer[_head]), &(buffer_c[n]), p);
 	_head = (_head + p) % _buffer_size;
-	_count += size;
+
+	// publish the data to the writer thread
+	_count.fetch_add(size);
+}
+
+void *LogWriterFile::LogFileBuffer::reserve(size_t size)
+{
+	// only contiguous space, the caller falls back to write_message() otherwise
+	if (size > available() || _head + size > _buffer_size) {
+		return nullptr;
+	}
+
+	return &_buffer[_head];
+}
+
+void LogWriterFile::LogFileBuffer::commit(size_t size)
+{
+	_head = (_head + size) % _buffer_size;
+	_count.fetch_add(size);
 }
 
 size_t LogWriterFile::LogFileBuffer::get_read_ptr(void **ptr, bool *is_part)
 {
 	// bytes available to read
-	int read_ptr = _head - _count;
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	// only the encrypted part
+	const size_t count = _encrypt.load() ? _encrypted.load() : _count.load();
+#else
+	const size_t count = _count.load();
+#endif
+
+	*ptr = &_buffer[_tail];
 
-	if (read_ptr < 0) {
-		read_ptr += _buffer_size;
-		*ptr = &_buffer[read_ptr];
+	if (_tail + count > _buffer_size) {
 		*is_part = true;
-		return _buffer_size - read_ptr;
+		return _buffer_size - _tail;
 
 	} else {
-		*ptr = &_buffer[read_ptr];
 		*is_part = false;
-		return _count;
+		return count;
 	}
 }
 
+void LogWriterFile::LogFileBuffer::mark_read(size_t n)
+{
+	_tail = (_tail + n) % _buffer_size;
+	_total_written += n;
+
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+
+	if (_encrypt.load()) {
+		_encrypted.fetch_sub(n);
+	}
+
+#endif
+
+	// release the space to the producer
+	_count.fetch_sub(n);
+}
+
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+size_t LogWriterFile::LogFileBuffer::get_encrypt_ptr(void **ptr)
+{
+	if (!_encrypt.load() || _buffer == nullptr) {
+		return 0;
+	}
+
+	// bytes that are not encrypted yet, starting directly after the encrypted ones
+	const size_t count = _count.load() - _encrypted.load();
+
+	*ptr = &_buffer[_encrypt_pos];
+
+	return math::min(count, _buffer_size - _encrypt_pos);
+}
+
+void LogWriterFile::LogFileBuffer::mark_encrypted(size_t n)
+{
+	_encrypt_pos = (_encrypt_pos + n) % _buffer_size;
+	_encrypted.fetch_add(n);
+}
+#endif // CONFIG_LOGGER_CRYPTO_PIPELINE
+
 bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 {
-	_fd = ::open(filename, O_CREAT | O_WRONLY, PX4_O_MODE_666);
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+	_direct_io = _use_direct_io;
+
+	if (_direct_io) {
+		_fd = ::open(filename, O_CREAT | O_WRONLY | O_DIRECT, PX4_O_MODE_666);
+
+		if (_fd < 0 && errno == EINVAL) {
+			PX4_WARN("O_DIRECT not supported, using buffered writes");
+			_direct_io = false;
+		}
+	}
+
+	if (!_direct_io)
+#endif
+	{
+		_fd = ::open(filename, O_CREAT | O_WRONLY, PX4_O_MODE_666);
+	}
+
 	_had_write_error.store(false);
 
 	if (_fd < 0) {
@@ -660,7 +1009,20 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 	}
 
 	if (_buffer == nullptr) {
-		_buffer = (uint8_t *) px4_cache_aligned_alloc(_buffer_size);
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+
+		if (_use_direct_io) {
+			void *buffer = nullptr;
+
+			if (posix_memalign(&buffer, _direct_io_block, _buffer_size) == 0) {
+				_buffer = (uint8_t *)buffer;
+			}
+
+		} else
+#endif
+		{
+			_buffer = (uint8_t *) px4_cache_aligned_alloc(_buffer_size);
+		}
 
 		if (_buffer == nullptr) {
 			PX4_ERR("Can't create log buffer");
@@ -671,15 +1033,38 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 	}
 
 	// Clear buffer and counters
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	// waits for an ongoing encryption of the old data
+	lock_encryption();
+	_encrypt_pos = 0;
+	_encrypted.store(0);
+#endif
 	_head = 0;
-	_count = 0;
+	_tail = 0;
+	_count.store(0);
 	_total_written = 0;
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	unlock_encryption();
+#endif
 
-	_should_run = true;
+	_should_run.store(true);
 
 	return true;
 }
 
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+void LogWriterFile::LogFileBuffer::disable_direct_io()
+{
+	const int flags = fcntl(_fd, F_GETFL);
+
+	if (flags == -1 || fcntl(_fd, F_SETFL, flags & ~O_DIRECT) == -1) {
+		PX4_ERR("failed to disable O_DIRECT (%i)", errno);
+	}
+
+	_direct_io = false;
+}
+#endif
+
 void LogWriterFile::LogFileBuffer::fsync() const
 {
 	perf_begin(_perf_fsync);
@@ -716,9 +1101,19 @@ void LogWriterFile::LogFileBuffer::close_file()
 
 void LogWriterFile::LogFileBuffer::reset()
 {
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	// waits for an ongoing encryption of the old data
+	lock_encryption();
+	_encrypt_pos = 0;
+	_encrypted.store(0);
+#endif
 	_head = 0;
-	_count = 0;
+	_tail = 0;
+	_count.store(0);
 	_fd = -1;
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	unlock_encryption();
+#endif
 }
 
 }
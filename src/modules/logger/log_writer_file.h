@@ -41,6 +41,10 @@
 #include <perf/perf_counter.h>
 #include <px4_platform_common/crypto.h>
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+#include "log_compressor.h"
+#endif
+
 namespace px4
 {
 namespace logger
@@ -83,11 +87,23 @@ public:
 
 	void stop_log(LogType type);
 
-	bool is_started(LogType type) const { return _buffers[(int)type]._should_run; }
+	bool is_started(LogType type) const { return _buffers[(int)type]._should_run.load(); }
 
 	/** @see LogWriter::write_message() */
 	int write_message(LogType type, void *ptr, size_t size, uint64_t dropout_start = 0);
 
+	/**
+	 * Reserve contiguous space in the buffer to write a message in place. The caller must hold the lock
+	 * until commit() is called (or the reservation is dropped).
+	 * @return pointer to size bytes, or nullptr if not enough contiguous space (use write_message())
+	 */
+	void *reserve(LogType type, size_t size);
+
+	/**
+	 * Hand over size bytes written to the space returned by reserve() to the writer thread.
+	 */
+	void commit(LogType type, size_t size);
+
 	void lock()
 	{
 		pthread_mutex_lock(&_mtx);
@@ -134,6 +150,13 @@ public:
 
 	bool had_write_error() const { return _buffers[(int)LogType::Full]._had_write_error.load(); }
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	/**
+	 * Enable/disable compression for a log type, applies to the next start_log()
+	 */
+	void set_compression(LogType type, bool enable) { _compression_enabled[(int)type] = enable; }
+#endif
+
 	pthread_t thread_id() const { return _thread; }
 
 #if defined(PX4_CRYPTO)
@@ -163,13 +186,31 @@ private:
 	 */
 	int write(LogType type, void *ptr, size_t size, uint64_t dropout_start);
 
+	/**
+	 * maximum message size that write() can accept for the buffer size
+	 */
+	size_t max_write_size(LogType type) const;
+
 	/* 512 didn't seem to work properly, 4096 should match the FAT cluster size */
-	static constexpr size_t	_min_write_chunk = 4096;
+	static constexpr size_t	_min_write_chunk[(int)LogType::Count] = {
+		CONFIG_LOGGER_WRITE_CHUNK_FULL,
+		CONFIG_LOGGER_WRITE_CHUNK_MISSION // For the mission log, write as soon as there is data available
+	};
+
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+	/* O_DIRECT needs block aligned buffers, sizes and file offsets. 4096 covers the logical block size of common devices */
+	static constexpr size_t _direct_io_block = 4096;
+#endif
 
+	/**
+	 * Single producer (logger thread, with the lock held), single consumer (writer thread) ring buffer.
+	 * The data path is lock-free: the producer owns _head, the consumer owns _tail and _count hands over
+	 * the bytes between them. The lock is only needed to start, stop and reset the buffer.
+	 */
 	class LogFileBuffer
 	{
 	public:
-		LogFileBuffer(size_t log_buffer_size, perf_counter_t perf_write, perf_counter_t perf_fsync);
+		LogFileBuffer(size_t log_buffer_size, perf_counter_t perf_write, perf_counter_t perf_fsync, bool direct_io = false);
 
 		~LogFileBuffer();
 
@@ -186,7 +227,10 @@ private:
 		 */
 		inline void write_no_check(void *ptr, size_t size);
 
-		size_t available() const { return _buffer_size - _count; }
+		void *reserve(size_t size);
+		void commit(size_t size);
+
+		size_t available() const { return _buffer_size - _count.load(); }
 
 		int fd() const { return _fd; }
 
@@ -194,37 +238,111 @@ private:
 
 		inline void fsync() const;
 
-		void mark_read(size_t n) { _count -= n; _total_written += n; }
+		void mark_read(size_t n);
+
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+		/**
+		 * Enable the encryption stage for the next file: the writer thread then only gets encrypted data
+		 */
+		void set_encrypted(bool encrypted) { _encrypt.store(encrypted); }
+
+		/**
+		 * Lock the data handed out by get_encrypt_ptr() against a concurrent reset of the buffer,
+		 * while it is encrypted in place (encryption thread)
+		 */
+		void lock_encryption() { pthread_mutex_lock(&_encrypt_mtx); }
+		void unlock_encryption() { pthread_mutex_unlock(&_encrypt_mtx); }
+
+		/**
+		 * Get the contiguous data that is not encrypted yet. Call with lock_encryption() held.
+		 */
+		size_t get_encrypt_ptr(void **ptr);
+
+		/**
+		 * Hand over n bytes encrypted in place to the writer thread. Call with lock_encryption() held.
+		 */
+		void mark_encrypted(size_t n);
+
+		/** number of bytes that still need to be encrypted */
+		size_t pending_encryption() const { return _encrypt.load() ? _count.load() - _encrypted.load() : 0; }
+#endif
 
 		size_t total_written() const { return _total_written; }
 		size_t buffer_size() const { return _buffer_size; }
-		size_t count() const { return _count; }
+		size_t count() const { return _count.load(); }
+
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+		bool direct_io() const { return _direct_io; }
+
+		/**
+		 * Switch the open file to buffered writes, e.g. to write the unaligned remainder at the end of the log
+		 */
+		void disable_direct_io();
+#endif
 
-		bool _should_run = false;
+		px4::atomic_bool _should_run{false};
 		px4::atomic_bool _had_write_error{false};
 	private:
 		const size_t _buffer_size;
 		int	_fd = -1;
 		uint8_t *_buffer = nullptr;
-		size_t _head = 0; ///< next position to write to
-		size_t _count = 0; ///< number of bytes in _buffer to be written
+		size_t _head = 0; ///< next position to write to (producer)
+		size_t _tail = 0; ///< next position to read from (consumer)
+		px4::atomic<size_t> _count{0}; ///< number of bytes in _buffer to be written
 		size_t _total_written = 0;
 		perf_counter_t _perf_write;
 		perf_counter_t _perf_fsync;
+#if defined(CONFIG_LOGGER_DIRECT_IO)
+		const bool _use_direct_io; ///< configured mode
+		bool _direct_io{false}; ///< mode of the currently open file
+#endif
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+		px4::atomic_bool _encrypt{false}; ///< the current file is encrypted by the encryption thread
+		px4::atomic<size_t> _encrypted{0}; ///< number of bytes from _tail that are encrypted and can be written
+		size_t _encrypt_pos = 0; ///< next position to encrypt (encryption thread)
+		pthread_mutex_t _encrypt_mtx; ///< held while encrypting, protects _encrypt_pos
+#endif
 	};
 
 	LogFileBuffer _buffers[(int)LogType::Count];
 
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	static void *run_encryption_helper(void *);
+
+	/**
+	 * Encryption thread: encrypts the buffered data in place ahead of the writer thread,
+	 * so that encryption and file writes run in parallel.
+	 */
+	void run_encryption();
+
+	/** true if a buffer holds at least one block that still needs to be encrypted */
+	bool encryption_pending() const;
+#endif
+
+	/**
+	 * All data of the buffer that can be encrypted was handed over to the writer thread
+	 * (always true without CONFIG_LOGGER_CRYPTO_PIPELINE)
+	 */
+	bool encryption_done(const LogFileBuffer &buffer) const;
+
 	px4::atomic_bool	_exit_thread{false};
 	bool			_need_reliable_transfer{false};
 	px4::atomic_bool	_want_fsync{false};
 	pthread_mutex_t		_mtx;
 	pthread_cond_t		_cv;
 	pthread_t _thread = 0;
+#if defined(CONFIG_LOGGER_CRYPTO_PIPELINE)
+	pthread_t _encryption_thread = 0;
+#endif
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	bool			_compression_enabled[(int)LogType::Count] {};
+	LogCompressor		*_compressor[(int)LogType::Count] {}; ///< allocated on first use
+	bool			_compressing[(int)LogType::Count] {}; ///< current file is compressed
+#endif
 #if defined(PX4_CRYPTO)
 	bool init_logfile_encryption(const char *filename);
 	PX4Crypto _crypto;
-	int _min_blocksize;
+	int _min_blocksize{1};
 	px4_crypto_algorithm_t _algorithm;
 	uint8_t _key_idx;
 	uint8_t _exchange_key_idx;
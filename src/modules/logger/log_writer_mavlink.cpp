@@ -68,10 +68,15 @@ void LogWriterMavlink::start_log()
 		_ulog_stream_ack_sub = orb_subscribe(ORB_ID(ulog_stream_ack));
 	}
 
-	// make sure we don't get any stale ack's by doing an orb_copy
+	// make sure we don't get any stale ack's by doing an orb_copy (the topic is queued)
 	ulog_stream_ack_s ack;
-	orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+	bool updated = true;
 
+	while (orb_check(_ulog_stream_ack_sub, &updated) == 0 && updated) {
+		orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+	}
+
+	_num_unacked = 0;
 	_ulog_stream_data.msg_sequence = 0;
 	_ulog_stream_data.length = 0;
 	_ulog_stream_data.first_message_offset = 0;
@@ -122,6 +127,11 @@ void LogWriterMavlink::set_need_reliable_transfer(bool need_reliable)
 			// make sure to send previous data using reliable transfer
 			publish_message();
 		}
+
+		// the receiver reorders acked messages, so all of them need to arrive before switching
+		if (_num_unacked > 0 && wait_for_acks(0)) {
+			stop_log();
+		}
 	}
 
 	_need_reliable_transfer = need_reliable;
@@ -139,48 +149,63 @@ int LogWriterMavlink::publish_message()
 	_ulog_stream_pub.publish(_ulog_stream_data);
 
 	if (_need_reliable_transfer) {
-		// we need to wait for an ack. Note that this blocks the main logger thread, so if a file logging
-		// is already running, it will miss samples.
-		px4_pollfd_struct_t fds[1];
-		fds[0].fd = _ulog_stream_ack_sub;
-		fds[0].events = POLLIN;
-		bool got_ack = false;
-		const int timeout_ms = ulog_stream_ack_s::ACK_TIMEOUT * ulog_stream_ack_s::ACK_MAX_TRIES;
+		// we need to wait for an ack, unless there's still room in the window. Note that this blocks the
+		// main logger thread, so if a file logging is already running, it will miss samples.
+		++_num_unacked;
+		_unacked_end = _ulog_stream_data.msg_sequence + 1;
 
-		hrt_abstime started = hrt_absolute_time();
+		if (wait_for_acks(ACK_WINDOW - 1)) {
+			stop_log();
+			return -2;
+		}
+	}
 
-		do {
-			int ret = px4_poll(fds, sizeof(fds) / sizeof(fds[0]), timeout_ms);
+	_ulog_stream_data.msg_sequence++;
+	_ulog_stream_data.length = 0;
+	_ulog_stream_data.first_message_offset = 255;
+	return 0;
+}
 
-			if (ret <= 0) {
-				break;
-			}
+int LogWriterMavlink::wait_for_acks(int max_unacked)
+{
+	if (_num_unacked <= max_unacked) {
+		return 0;
+	}
 
-			if (fds[0].revents & POLLIN) {
-				ulog_stream_ack_s ack;
-				orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+	px4_pollfd_struct_t fds[1];
+	fds[0].fd = _ulog_stream_ack_sub;
+	fds[0].events = POLLIN;
+	const int timeout_ms = ulog_stream_ack_s::ACK_TIMEOUT * ulog_stream_ack_s::ACK_MAX_TRIES;
 
-				if (ack.msg_sequence == _ulog_stream_data.msg_sequence) {
-					got_ack = true;
-				}
+	hrt_abstime started = hrt_absolute_time();
+
+	do {
+		int ret = px4_poll(fds, sizeof(fds) / sizeof(fds[0]), timeout_ms);
+
+		if (ret <= 0) {
+			break;
+		}
 
-			} else {
-				break;
+		if (fds[0].revents & POLLIN) {
+			ulog_stream_ack_s ack;
+			orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+
+			// each message is acked once, in any order within the window
+			if ((uint16_t)(_unacked_end - 1 - ack.msg_sequence) < ACK_WINDOW) {
+				--_num_unacked;
 			}
-		} while (!got_ack && hrt_elapsed_time(&started) / 1000 < timeout_ms);
 
-		if (!got_ack) {
-			PX4_ERR("Ack timeout. Stopping mavlink log");
-			stop_log();
-			return -2;
+		} else {
+			break;
 		}
+	} while (_num_unacked > max_unacked && hrt_elapsed_time(&started) / 1000 < timeout_ms);
 
-		PX4_DEBUG("got ack in %i ms", (int)(hrt_elapsed_time(&started) / 1000));
+	if (_num_unacked > max_unacked) {
+		PX4_ERR("Ack timeout. Stopping mavlink log");
+		return -2;
 	}
 
-	_ulog_stream_data.msg_sequence++;
-	_ulog_stream_data.length = 0;
-	_ulog_stream_data.first_message_offset = 255;
+	PX4_DEBUG("got ack in %i ms", (int)(hrt_elapsed_time(&started) / 1000));
 	return 0;
 }
 
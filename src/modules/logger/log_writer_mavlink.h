@@ -76,9 +76,23 @@ private:
 	/** publish message, wait for ack if needed & reset message */
 	int publish_message();
 
+	/**
+	 * wait until at most max_unacked published messages are still waiting for an ack
+	 * @return 0 on success, -2 on timeout
+	 */
+	int wait_for_acks(int max_unacked);
+
+#if defined(CONFIG_MAVLINK_ULOG_ACK_WINDOW)
+	static constexpr int ACK_WINDOW = ulog_stream_ack_s::ACK_WINDOW; ///< acked messages that can be in flight
+#else
+	static constexpr int ACK_WINDOW = 1;
+#endif // CONFIG_MAVLINK_ULOG_ACK_WINDOW
+
 	ulog_stream_s _ulog_stream_data{};
 	uORB::Publication<ulog_stream_s> _ulog_stream_pub{ORB_ID(ulog_stream)};
 	int _ulog_stream_ack_sub{-1};
+	int _num_unacked{0}; ///< number of published messages still waiting for an ack
+	uint16_t _unacked_end{0}; ///< sequence following the last published message that needs an ack
 	bool _need_reliable_transfer{false};
 	bool _is_started{false};
 };
@@ -56,6 +56,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("cellular_status", 200);
 	add_topic("commander_state");
 	add_topic("config_overrides");
+	add_optional_topic("control_latency", 100);
 	add_topic("cpuload");
 	add_optional_topic("differential_drive_setpoint", 100);
 	add_optional_topic("external_ins_attitude");
@@ -87,16 +88,23 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("magnetometer_bias_estimate", 200);
 	add_topic("manual_control_setpoint", 200);
 	add_topic("manual_control_switches");
+	add_optional_topic("memory_usage");
 	add_topic("mission_result");
 	add_topic("navigator_mission_item");
 	add_topic("npfg_status", 100);
 	add_topic("offboard_control_mode", 100);
 	add_topic("onboard_computer_status", 10);
+#if defined(CONFIG_ORB_STATS)
+	add_topic("orb_statistics");
+#endif // CONFIG_ORB_STATS
 	add_topic("parameter_update");
 	add_topic("position_controller_status", 500);
 	add_topic("position_controller_landing_status", 100);
 	add_topic("goto_setpoint", 200);
 	add_topic("position_setpoint_triplet", 200);
+#if defined(CONFIG_MODULES_SAMPLING_PROFILER)
+	add_topic("profiler_samples");
+#endif // CONFIG_MODULES_SAMPLING_PROFILER
 	add_optional_topic("px4io_status");
 	add_topic("radio_status");
 	add_topic("rtl_time_estimate", 1000);
@@ -116,6 +124,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("vehicle_air_data", 200);
 	add_topic("vehicle_angular_velocity", 20);
 	add_topic("vehicle_attitude", 50);
+	add_optional_topic("vehicle_attitude_backup", 50);
 	add_topic("vehicle_attitude_setpoint", 50);
 	add_topic("vehicle_command");
 	add_topic("vehicle_command_ack");
@@ -132,6 +141,12 @@ void LoggedTopics::add_default_topics()
 	add_topic("vehicle_status");
 	add_optional_topic("vtol_vehicle_status", 200);
 	add_topic("wind", 1000);
+#if defined(CONFIG_WORK_QUEUE_DEADLINE)
+	add_topic("work_item_deadline");
+#endif // CONFIG_WORK_QUEUE_DEADLINE
+#if defined(CONFIG_WORK_QUEUE_PROFILER)
+	add_topic("work_item_profile");
+#endif // CONFIG_WORK_QUEUE_PROFILER
 
 	// multi topics
 	add_optional_topic_multi("actuator_outputs", 100, 3);
@@ -538,6 +553,69 @@ bool LoggedTopics::add_topic(const char *name, uint16_t interval_ms, uint8_t ins
 	return success;
 }
 
+void LoggedTopics::add_flight_recorder_topics()
+{
+	const char *topics[] = {"sensor_gyro_fifo", "sensor_accel_fifo"};
+
+	for (const char *name : topics) {
+		bool already_added = false;
+
+		for (int i = 0; i < _subscriptions.count; ++i) {
+			if (strcmp(name, get_orb_meta(_subscriptions.sub[i].id)->o_name) == 0) {
+				already_added = true;
+				break;
+			}
+		}
+
+		if (!already_added && add_optional_topic(name)) {
+			_subscriptions.sub[_subscriptions.count - 1].flight_recorder = true;
+		}
+	}
+}
+
+void LoggedTopics::add_telemetry_history_topics()
+{
+	struct HistoryTopic {
+		const char *name;
+		uint16_t interval_ms;
+	};
+
+	static constexpr HistoryTopic topics[] = {
+		{"vehicle_status", 1000},
+		{"vehicle_land_detected", 1000},
+		{"vehicle_attitude", 500},
+		{"vehicle_local_position", 500},
+		{"vehicle_global_position", 500},
+		{"vehicle_gps_position", 1000},
+		{"battery_status", 1000},
+		{"airspeed_validated", 1000},
+	};
+
+	for (const HistoryTopic &topic : topics) {
+		bool already_added = false;
+
+		for (int i = 0; i < _subscriptions.count; ++i) {
+			if (strcmp(topic.name, get_orb_meta(_subscriptions.sub[i].id)->o_name) == 0) {
+				_subscriptions.sub[i].history_interval_ms = topic.interval_ms;
+				already_added = true;
+			}
+		}
+
+		if (!already_added && add_optional_topic(topic.name, topic.interval_ms)) {
+			_subscriptions.sub[_subscriptions.count - 1].history_interval_ms = topic.interval_ms;
+		}
+	}
+}
+
+void LoggedTopics::set_on_change(const char *name)
+{
+	for (int i = 0; i < _subscriptions.count; ++i) {
+		if (strcmp(name, get_orb_meta(_subscriptions.sub[i].id)->o_name) == 0) {
+			_subscriptions.sub[i].on_change = true;
+		}
+	}
+}
+
 bool LoggedTopics::add_topic_multi(const char *name, uint16_t interval_ms, uint8_t max_num_instances, bool optional)
 {
 	// add all possible instances
@@ -609,4 +687,9 @@ void LoggedTopics::initialize_configured_topics(SDLogProfileMask profile)
 	if (profile & SDLogProfileMask::MAVLINK_TUNNEL) {
 		add_mavlink_tunnel();
 	}
+
+	// status topics that are published regularly but rarely change
+	set_on_change("vehicle_status");
+	set_on_change("battery_status");
+	set_on_change("estimator_status_flags");
 }
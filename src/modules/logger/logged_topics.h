@@ -82,6 +82,9 @@ public:
 	struct RequestedSubscription {
 		uint16_t interval_ms;
 		uint8_t instance;
+		bool on_change{false}; ///< only log samples that differ from the previous one (plus periodic full samples)
+		bool flight_recorder{false}; ///< only log around flight recorder triggers
+		uint16_t history_interval_ms{0}; ///< also keep in the telemetry history at this interval if >0
 		ORB_ID id{ORB_ID::INVALID};
 	};
 	struct RequestedSubscriptionArray {
@@ -108,6 +111,20 @@ public:
 
 	void set_rate_factor(float rate_factor) { _rate_factor = rate_factor; }
 
+	/**
+	 * Add the high-rate topics of the flight recorder (only written to the log around triggers).
+	 * Topics already logged by a profile are not changed.
+	 * Must be called after initialize_logged_topics().
+	 */
+	void add_flight_recorder_topics();
+
+	/**
+	 * Add the topics of the telemetry history (kept in RAM at low rate, in addition to the log).
+	 * Topics already logged by a profile keep their logging interval.
+	 * Must be called after initialize_logged_topics().
+	 */
+	void add_telemetry_history_topics();
+
 private:
 
 	/**
@@ -143,6 +160,13 @@ private:
 		return add_topic_multi(name, interval_ms, max_num_instances, true);
 	}
 
+	/**
+	 * Mark all added instances of a topic to be logged on change only
+	 * (used by the logger if built with LOGGER_ON_CHANGE)
+	 * @param name topic name
+	 */
+	void set_on_change(const char *name);
+
 	/**
 	 * Parse a file containing a list of uORB topics to log, calling add_topic for each
 	 * @param fname name of file
@@ -168,6 +168,15 @@ int Logger::custom_command(int argc, char *argv[])
 		return 0;
 	}
 
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+
+	if (!strcmp(argv[0], "trigger")) {
+		get_instance()->trigger_flight_recorder();
+		return 0;
+	}
+
+#endif
+
 	return print_usage("unknown command");
 }
 
@@ -217,6 +226,18 @@ int Logger::print_status()
 		PX4_INFO("Not logging");
 	}
 
+	if (_events_lost > 0) {
+		PX4_INFO("Events lost (queue overflow): %" PRIu32, _events_lost);
+	}
+
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+
+	if (_telemetry_history.allocated()) {
+		PX4_INFO("Telemetry history: %zu of %zu bytes used", _telemetry_history.count(), _telemetry_history.buffer_size());
+	}
+
+#endif
+
 	return 0;
 }
 
@@ -530,6 +551,21 @@ bool Logger::initialize_topics()
 		return false;
 	}
 
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+
+	if (_param_sdlog_rec_pre.get() > 0.f) {
+		logged_topics.add_flight_recorder_topics();
+	}
+
+#endif
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+
+	if (_param_sdlog_hist_win.get() > 0.f) {
+		logged_topics.add_telemetry_history_topics();
+	}
+
+#endif
+
 	if ((sdlog_profile & SDLogProfileMask::RAW_IMU_ACCEL_FIFO) || (sdlog_profile & SDLogProfileMask::RAW_IMU_GYRO_FIFO)) {
 		// if we are logging high-rate FIFO, reduce the logging interval & increase process priority to avoid missing samples
 		PX4_INFO("Logging FIFO data: increasing task prio and logging rate");
@@ -558,10 +594,50 @@ bool Logger::initialize_topics()
 			return false;
 		}
 
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+		_num_on_change_subs = 0;
+#endif
+
 		for (int i = 0; i < logged_topics.subscriptions().count; ++i) {
 			const LoggedTopics::RequestedSubscription &sub = logged_topics.subscriptions().sub[i];
 			_subscriptions[i] = LoggerSubscription(sub.id, sub.interval_ms, sub.instance);
 			_subscriptions[i].subscribe();
+
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+
+			if (sub.on_change && _param_sdlog_keyframe.get() > 0) {
+				if (_num_on_change_subs < MAX_ON_CHANGE_TOPICS_NUM) {
+					_subscriptions[i].on_change_idx = _num_on_change_subs;
+					_on_change_subscriptions[_num_on_change_subs++] = OnChangeSubscription{};
+
+				} else {
+					PX4_WARN("Max num on change topics exceeded");
+				}
+			}
+
+#endif
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+			_subscriptions[i].flight_recorder = sub.flight_recorder;
+
+			if (sub.flight_recorder && !_flight_recorder.allocated()) {
+				if (!_flight_recorder.allocate(CONFIG_LOGGER_FLIGHT_RECORDER_SIZE * 1024,
+							       (hrt_abstime)(_param_sdlog_rec_pre.get() * 1e6f))) {
+					PX4_ERR("flight recorder alloc failed");
+				}
+			}
+
+#endif
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+			_subscriptions[i].history_interval_ms = sub.history_interval_ms;
+
+			if (sub.history_interval_ms > 0 && !_telemetry_history.allocated()) {
+				if (!_telemetry_history.allocate(CONFIG_LOGGER_TELEMETRY_HISTORY_SIZE * 1024,
+								 (hrt_abstime)(_param_sdlog_hist_win.get() * 1e6f))) {
+					PX4_ERR("telemetry history alloc failed");
+				}
+			}
+
+#endif
 		}
 	}
 
@@ -749,6 +825,10 @@ void Logger::run()
 			/* wait for lock on log buffer */
 			_writer.lock();
 
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+			handle_flight_recorder_triggers(loop_time);
+#endif
+
 			for (int sub_idx = 0; sub_idx < _num_subscriptions; ++sub_idx) {
 				LoggerSubscription &sub = _subscriptions[sub_idx];
 				/* if this topic has been updated, copy the new data into the message buffer
@@ -756,30 +836,64 @@ void Logger::run()
 				 */
 				const bool try_to_subscribe = (sub_idx == next_subscribe_topic_index);
 
-				if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
+				// skip topics without new data due before reserving buffer space
+				if (!try_to_subscribe && !sub.due(loop_time)) {
+					continue;
+				}
+
+				// if possible copy the topic directly into the file buffer, otherwise use _msg_buffer
+				uint8_t *msg_buffer = nullptr;
+
+				if (!_statistics[(int)LogType::Full].dropout_start) {
+					msg_buffer = (uint8_t *)_writer.reserve_file(LogType::Full, sizeof(ulog_message_data_s) + sub.get_topic()->o_size);
+				}
+
+				const bool in_place = msg_buffer != nullptr;
+
+				if (!in_place) {
+					msg_buffer = _msg_buffer;
+				}
+
+				if (copy_if_updated(sub_idx, msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+
+					if (skip_unchanged(sub, msg_buffer + sizeof(ulog_message_data_s), loop_time)) {
+						continue;
+					}
+
+#endif
 					// each message consists of a header followed by an orb data object
 					const size_t msg_size = sizeof(ulog_message_data_s) + sub.get_topic()->o_size_no_padding;
 					const uint16_t write_msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
 					const uint16_t write_msg_id = sub.msg_id;
 
 					//write one byte after another (necessary because of alignment)
-					_msg_buffer[0] = (uint8_t)write_msg_size;
-					_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
-					_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
-					_msg_buffer[3] = (uint8_t)write_msg_id;
-					_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
+					msg_buffer[0] = (uint8_t)write_msg_size;
+					msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
+					msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
+					msg_buffer[3] = (uint8_t)write_msg_id;
+					msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
 
-					// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
 
-					// full log
-					if (write_message(LogType::Full, _msg_buffer, msg_size)) {
+					if (sub.history_interval_ms > 0 && loop_time >= sub.next_history_time) {
+						sub.next_history_time = loop_time + sub.history_interval_ms * 1000;
+						_telemetry_history.push(msg_buffer, msg_size);
+					}
 
-#ifdef DBGPRINT
-						total_bytes += msg_size;
-#endif /* DBGPRINT */
+#endif
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+
+					if (sub.flight_recorder && loop_time > _flight_recorder_until) {
+						_flight_recorder.push(msg_buffer, msg_size);
+						continue;
 					}
 
-					// mission log
+#endif
+
+					// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+
+					// mission log (first, the full log data is only valid until it is committed)
 					if (sub_idx < _num_mission_subs) {
 						if (_writer.is_started(LogType::Mission)) {
 							if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
@@ -789,10 +903,24 @@ void Logger::run()
 									_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
 								}
 
-								write_message(LogType::Mission, _msg_buffer, msg_size);
+								write_message(LogType::Mission, msg_buffer, msg_size);
 							}
 						}
 					}
+
+					// full log
+					if (in_place) {
+						_writer.commit_file(LogType::Full, msg_size);
+#ifdef DBGPRINT
+						total_bytes += msg_size;
+#endif /* DBGPRINT */
+
+					} else if (write_message(LogType::Full, msg_buffer, msg_size)) {
+
+#ifdef DBGPRINT
+						total_bytes += msg_size;
+#endif /* DBGPRINT */
+					}
 				}
 			}
 
@@ -981,6 +1109,15 @@ bool Logger::handle_event_updates(uint32_t &total_bytes)
 		_event_subscription.copy(orb_event);
 
 		// Important: we can only access single-byte values in orb_event (it's not necessarily aligned)
+		uint16_t event_sequence;
+		memcpy(&event_sequence, &orb_event->event_sequence, sizeof(event_sequence));
+
+		if (_last_event_sequence >= 0) {
+			_events_lost += (uint16_t)(event_sequence - (uint16_t)_last_event_sequence - 1);
+		}
+
+		_last_event_sequence = event_sequence;
+
 		if (events::internalLogLevel(orb_event->log_levels) == events::LogLevelInternal::Disabled) {
 			++_event_sequence_offset; // skip this event
 
@@ -1068,13 +1205,16 @@ void Logger::publish_logger_status()
 void Logger::adjust_subscription_updates()
 {
 	// we want subscriptions to update evenly distributed over time to avoid
-	// data bursts. This is particularly important for low-rate topics
+	// data bursts. Every topic with an interval spanning several logger cycles gets
+	// a different phase, so topics with the same interval don't come due in the same cycle
 	hrt_abstime now = hrt_absolute_time();
 	int j = 0;
 
 	for (int i = 0; i < _num_subscriptions; ++i) {
-		if (_subscriptions[i].get_interval_us() >= 500_ms) {
-			hrt_abstime adjustment = (_log_interval * j) % 500_ms;
+		const uint32_t interval_us = _subscriptions[i].get_interval_us();
+
+		if (interval_us > _log_interval) {
+			hrt_abstime adjustment = ((hrt_abstime)_log_interval * j) % interval_us;
 
 			if (adjustment < now) {
 				_subscriptions[i].set_last_update(now - adjustment);
@@ -1180,10 +1320,26 @@ void Logger::handle_vehicle_command_update()
 				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED);
 				start_log_mavlink();
 
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+
+				// param2: replay this many seconds of telemetry history first
+				if (command.param2 > 0.f) {
+					write_telemetry_history(command.param2);
+				}
+
+#endif
+
 			} else {
 				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_TEMPORARILY_REJECTED);
 			}
 
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+
+		} else if (command.command == vehicle_command_s::VEHICLE_CMD_LOGGING_FLIGHT_RECORDER_TRIGGER) {
+			trigger_flight_recorder();
+			ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED);
+#endif
+
 		} else if (command.command == vehicle_command_s::VEHICLE_CMD_LOGGING_STOP) {
 			if (_writer.is_started(LogType::Full, LogWriter::BackendMavlink)) {
 				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_IN_PROGRESS);
@@ -1195,6 +1351,146 @@ void Logger::handle_vehicle_command_update()
 	}
 }
 
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+void Logger::handle_flight_recorder_triggers(hrt_abstime now)
+{
+	const char *reason = nullptr;
+
+	failure_detector_status_s failure_detector_status;
+
+	if (_failure_detector_status_sub.update(&failure_detector_status)) {
+		const bool failure = failure_detector_status.fd_roll || failure_detector_status.fd_pitch
+				     || failure_detector_status.fd_alt || failure_detector_status.fd_ext
+				     || failure_detector_status.fd_arm_escs || failure_detector_status.fd_battery
+				     || failure_detector_status.fd_imbalanced_prop || failure_detector_status.fd_motor;
+
+		if (failure && !_flight_recorder_failure) {
+			reason = "failure detector";
+		}
+
+		_flight_recorder_failure = failure;
+	}
+
+	for (int i = 0; i < _estimator_status_subs.size(); ++i) {
+		estimator_status_s estimator_status;
+
+		if (_estimator_status_subs[i].update(&estimator_status)) {
+			if (estimator_status.filter_fault_flags != 0 && _flight_recorder_filter_fault_flags[i] == 0) {
+				reason = "estimator fault";
+			}
+
+			_flight_recorder_filter_fault_flags[i] = estimator_status.filter_fault_flags;
+		}
+	}
+
+	if (_flight_recorder_manual_trigger) {
+		_flight_recorder_manual_trigger = false;
+		reason = "command";
+	}
+
+	if (!reason || !_flight_recorder.allocated() || !_writer.is_started(LogType::Full)) {
+		return;
+	}
+
+	PX4_WARN("flight recorder triggered (%s)", reason);
+
+	// the recorded data is lost if it cannot be written, so wait for the writer if needed
+	_writer.set_need_reliable_transfer(true);
+	_flight_recorder.flush(_msg_buffer, _msg_buffer_len, [this](uint8_t *msg, size_t size) {
+		write_message(LogType::Full, msg, size);
+	});
+	_writer.set_need_reliable_transfer(false);
+
+	_flight_recorder_until = now + (hrt_abstime)(_param_sdlog_rec_post.get() * 1e6f);
+}
+#endif
+
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+void Logger::write_telemetry_history(float duration)
+{
+	if (!_telemetry_history.allocated() || !_writer.is_started(LogType::Full, LogWriter::BackendMavlink)) {
+		return;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+	const hrt_abstime window = (hrt_abstime)(duration * 1e6f);
+	const hrt_abstime start = now > window ? now - window : 0;
+	int num_messages = 0;
+
+	_writer.lock();
+	_writer.select_write_backend(LogWriter::BackendMavlink);
+	_writer.set_need_reliable_transfer(true);
+
+	_telemetry_history.for_each(_msg_buffer, _msg_buffer_len, [&](uint8_t *msg, size_t size) {
+		hrt_abstime timestamp;
+		memcpy(&timestamp, msg + sizeof(ulog_message_data_s), sizeof(timestamp));
+
+		if (timestamp >= start) {
+			write_message(LogType::Full, msg, size);
+			++num_messages;
+		}
+	});
+
+	_writer.set_need_reliable_transfer(false);
+	_writer.unselect_write_backend();
+	_writer.unlock();
+	_writer.notify();
+
+	PX4_INFO("telemetry history: sent %i messages (%.0f s)", num_messages, (double)duration);
+}
+#endif
+
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+bool Logger::skip_unchanged(const LoggerSubscription &sub, const uint8_t *data, hrt_abstime now)
+{
+	if (sub.on_change_idx < 0) {
+		return false;
+	}
+
+	OnChangeSubscription &state = _on_change_subscriptions[sub.on_change_idx];
+	const size_t size = sub.get_topic()->o_size_no_padding;
+	// FNV-1a hash (a collision only delays a change until the next keyframe)
+	uint32_t checksum = 2166136261u;
+
+	for (size_t i = state.compare_offset; i < size; ++i) {
+		checksum = (checksum ^ data[i]) * 16777619u;
+	}
+
+	if (state.valid && checksum == state.checksum
+	    && now - state.last_full_write < (hrt_abstime)_param_sdlog_keyframe.get() * 1000) {
+		return true;
+	}
+
+	state.checksum = checksum;
+	state.valid = true;
+	state.last_full_write = now;
+	return false;
+}
+
+void Logger::reset_on_change(const orb_metadata &meta, const char *format)
+{
+	// format is "name:type field;type field;...". Skip all leading timestamp fields when comparing samples,
+	// so that only the content is considered (e.g. timestamp and timestamp_sample)
+	uint16_t compare_offset = 0;
+	const char *field = strchr(format, ':');
+
+	while (field && strncmp(field + 1, "uint64_t timestamp", strlen("uint64_t timestamp")) == 0) {
+		compare_offset += sizeof(uint64_t);
+		field = strchr(field + 1, ';');
+	}
+
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		const LoggerSubscription &sub = _subscriptions[i];
+
+		if (sub.on_change_idx >= 0 && sub.get_topic() == &meta) {
+			OnChangeSubscription &state = _on_change_subscriptions[sub.on_change_idx];
+			state.compare_offset = math::max(compare_offset, (uint16_t)sizeof(uint64_t));
+			state.valid = false;
+		}
+	}
+}
+#endif
+
 bool Logger::write_message(LogType type, void *ptr, size_t size)
 {
 	Statistics &stats = _statistics[(int)type];
@@ -1300,6 +1596,15 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 		replay_suffix = "_replayed";
 	}
 
+	const char *compression_suffix = "";
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (_param_sdlog_compress.get() & (1 << (int)type)) {
+		compression_suffix = "z";
+	}
+
+#endif
+
 	const char *crypto_suffix = "";
 #if defined(PX4_CRYPTO)
 
@@ -1320,8 +1625,8 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 
 		char log_file_name_time[16] = "";
 		strftime(log_file_name_time, sizeof(log_file_name_time), "%H_%M_%S", &tt);
-		snprintf(log_file_name, sizeof(LogFileName::log_file_name), "%s%s.ulg%s", log_file_name_time, replay_suffix,
-			 crypto_suffix);
+		snprintf(log_file_name, sizeof(LogFileName::log_file_name), "%s%s.ulg%s%s", log_file_name_time, replay_suffix,
+			 compression_suffix, crypto_suffix);
 		snprintf(file_name + n, file_name_size - n, "/%s", log_file_name);
 
 		if (notify) {
@@ -1351,8 +1656,8 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 		/* look for the next file that does not exist */
 		while (file_number <= MAX_NO_LOGFILE) {
 			/* format log file path: e.g. /fs/microsd/log/sess001/log001.ulg */
-			snprintf(log_file_name, sizeof(LogFileName::log_file_name), "log%03" PRIu16 "%s.ulg%s", file_number, replay_suffix,
-				 crypto_suffix);
+			snprintf(log_file_name, sizeof(LogFileName::log_file_name), "log%03" PRIu16 "%s.ulg%s%s", file_number, replay_suffix,
+				 compression_suffix, crypto_suffix);
 			snprintf(file_name + n, file_name_size - n, "/%s", log_file_name);
 
 			if (!util::file_exist(file_name)) {
@@ -1399,6 +1704,11 @@ void Logger::start_log_file(LogType type)
 	if (type == LogType::Full) {
 		// initialize cpu load as early as possible to get more data
 		initialize_load_output(PrintLoadReason::Preflight);
+
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+		// do not flush data from a previous log into this one
+		_flight_recorder.clear();
+#endif
 	}
 
 	PX4_INFO("Start file log (type: %s)", log_type_str(type));
@@ -1411,6 +1721,10 @@ void Logger::start_log_file(LogType type)
 		return;
 	}
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	_writer.set_compression(type, _param_sdlog_compress.get() & (1 << (int)type));
+#endif
+
 #if defined(PX4_CRYPTO)
 	_writer.set_encryption_parameters(
 		(px4_crypto_algorithm_t)_param_sdlog_crypto_algorithm.get(),
@@ -1767,6 +2081,14 @@ void Logger::write_formats(LogType type)
 					size_t msg_size = sizeof(msg) - sizeof(msg.format) + format_length;
 					msg.msg_size = msg_size - ULOG_MSG_HEADER_LEN;
 					write_message(type, &msg, msg_size);
+
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+
+					if (type == LogType::Full) {
+						reset_on_change(meta, msg.format);
+					}
+
+#endif
 				}
 
 				// Move left-over back
@@ -2434,6 +2756,9 @@ $ logger on
 	PRINT_MODULE_USAGE_PARAM_FLOAT('c', 1.0, 0.2, 2.0, "Log rate factor (higher is faster)", true);
 	PRINT_MODULE_USAGE_COMMAND_DESCR("on", "start logging now, override arming (logger must be running)");
 	PRINT_MODULE_USAGE_COMMAND_DESCR("off", "stop logging now, override arming (logger must be running)");
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+	PRINT_MODULE_USAGE_COMMAND_DESCR("trigger", "write the flight recorder data to the log now (logger must be running)");
+#endif
 #ifdef __PX4_NUTTX
 	PRINT_MODULE_USAGE_COMMAND_DESCR("trigger_watchdog", "manually trigger the watchdog now");
 #endif
@@ -57,6 +57,15 @@
 #include <uORB/topics/vehicle_status.h>
 #include <uORB/topics/parameter_update.h>
 
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER) || defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+#include "flight_recorder.h"
+#endif
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+#include <uORB/SubscriptionMultiArray.hpp>
+#include <uORB/topics/estimator_status.h>
+#include <uORB/topics/failure_detector_status.h>
+#endif
+
 extern "C" __EXPORT int logger_main(int argc, char *argv[]);
 
 using namespace time_literals;
@@ -78,7 +87,26 @@ struct LoggerSubscription : public uORB::SubscriptionInterval {
 		uORB::SubscriptionInterval(id, interval_ms * 1000, instance)
 	{}
 
+	/**
+	 * Check if update() can return new data in this logger cycle: the interval elapsed (against the loop time,
+	 * no time read per topic) and a new generation was published. Does not try to subscribe.
+	 */
+	bool due(hrt_abstime loop_time)
+	{
+		return valid() && (loop_time >= _last_update + _interval_us) && _subscription.updated();
+	}
+
 	uint8_t msg_id{MSG_ID_INVALID};
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+	int8_t on_change_idx{-1}; ///< index into Logger::_on_change_subscriptions, -1 if logged on every update
+#endif
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+	bool flight_recorder{false}; ///< data goes to the flight recorder, except around triggers
+#endif
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+	uint16_t history_interval_ms{0}; ///< data also goes to the telemetry history at this interval if >0
+	hrt_abstime next_history_time{0};
+#endif
 };
 
 class Logger : public ModuleBase<Logger>, public ModuleParams
@@ -146,6 +174,10 @@ public:
 
 	void set_arm_override(bool override) { _manually_logging_override = override; }
 
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+	void trigger_flight_recorder() { _flight_recorder_manual_trigger = true; }
+#endif
+
 	void trigger_watchdog_now()
 	{
 #ifdef __PX4_NUTTX
@@ -156,6 +188,9 @@ public:
 private:
 
 	static constexpr int		MAX_MISSION_TOPICS_NUM = 5; /**< Maximum number of mission topics */
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+	static constexpr int		MAX_ON_CHANGE_TOPICS_NUM = 16; /**< Maximum number of topics logged on change */
+#endif
 	static constexpr unsigned	MAX_NO_LOGFILE = 999;	/**< Maximum number of log files */
 	static constexpr const char	*LOG_ROOT[(int)LogType::Count] = {
 		PX4_STORAGEDIR "/log",
@@ -165,7 +200,7 @@ private:
 	struct LogFileName {
 		char log_dir[12];           ///< e.g. "2018-01-01" or "sess001"
 		int sess_dir_index{1};      ///< search starting index for 'sess<i>' directory name
-		char log_file_name[31];     ///< e.g. "log001.ulg" or "12_09_00_replayed.ulg"
+		char log_file_name[31];     ///< e.g. "log001.ulg", "12_09_00_replayed.ulg" or "12_09_00.ulgzc"
 		bool has_log_dir{false};
 	};
 
@@ -182,6 +217,42 @@ private:
 		unsigned next_write_time{0};     ///< next time to write in 0.1 seconds
 	};
 
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+	/**
+	 * Check the flight recorder triggers and on a trigger write the recorded data to the log.
+	 * _writer.lock() must be held when calling this.
+	 */
+	void handle_flight_recorder_triggers(hrt_abstime now);
+#endif
+
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+	/**
+	 * Write the telemetry history of the last duration [s] to the mavlink log (just started).
+	 */
+	void write_telemetry_history(float duration);
+#endif
+
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+	struct OnChangeSubscription {
+		hrt_abstime last_full_write{0};  ///< last time a sample was written
+		uint32_t checksum{0};            ///< checksum of the last written sample (excluding the timestamps)
+		uint16_t compare_offset{sizeof(uint64_t)}; ///< size of the leading timestamp fields
+		bool valid{false};               ///< checksum is set
+	};
+
+	/**
+	 * Check if a topic sample is unchanged from the last written one and can be skipped
+	 * (a sample is written at least every SDLOG_KEYFRAME ms).
+	 */
+	bool skip_unchanged(const LoggerSubscription &sub, const uint8_t *data, hrt_abstime now);
+
+	/**
+	 * Reset the on-change state, so that the next sample of every topic is written, and set the compare
+	 * offset from a topic format.
+	 */
+	void reset_on_change(const orb_metadata &meta, const char *format);
+#endif
+
 	/**
 	 * @brief Updates and checks for updated uORB parameters.
 	 */
@@ -355,10 +426,28 @@ private:
 	LoggerSubscription	 			*_subscriptions{nullptr}; ///< all subscriptions for full & mission log (in front)
 	int						_num_subscriptions{0};
 	MissionSubscription 				_mission_subscriptions[MAX_MISSION_TOPICS_NUM] {}; ///< additional data for mission subscriptions
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+	FlightRecorder					_flight_recorder;
+	hrt_abstime					_flight_recorder_until{0}; ///< log the flight recorder topics directly until then
+	bool						_flight_recorder_manual_trigger{false};
+	bool						_flight_recorder_failure{false};
+	uint32_t					_flight_recorder_filter_fault_flags[ORB_MULTI_MAX_INSTANCES] {};
+	uORB::Subscription				_failure_detector_status_sub{ORB_ID(failure_detector_status)};
+	uORB::SubscriptionMultiArray<estimator_status_s>	_estimator_status_subs{ORB_ID::estimator_status};
+#endif
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+	FlightRecorder					_telemetry_history;
+#endif
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+	OnChangeSubscription				_on_change_subscriptions[MAX_ON_CHANGE_TOPICS_NUM] {}; ///< additional data for on change subscriptions
+	int						_num_on_change_subs{0};
+#endif
 	int						_num_mission_subs{0};
 	LoggerSubscription				_event_subscription; ///< Subscription for the event topic (handled separately)
 	uint16_t 					_event_sequence_offset{0}; ///< event sequence offset to account for skipped (not logged) messages
 	uint16_t 					_event_sequence_offset_mission{0};
+	int32_t						_last_event_sequence{-1}; ///< to count the events lost in the uORB queue
+	uint32_t					_events_lost{0};
 
 	orb_id_size_t  					_excluded_optional_topic_ids[LoggedTopics::MAX_EXCLUDED_OPTIONAL_TOPICS_NUM];
 	int						_num_excluded_optional_topic_ids{0};
@@ -402,6 +491,19 @@ private:
 		, (ParamInt<px4::params::SDLOG_ALGORITHM>) _param_sdlog_crypto_algorithm,
 		(ParamInt<px4::params::SDLOG_KEY>) _param_sdlog_crypto_key,
 		(ParamInt<px4::params::SDLOG_EXCH_KEY>) _param_sdlog_crypto_exchange_key
+#endif
+#if defined(CONFIG_LOGGER_COMPRESSION)
+		, (ParamInt<px4::params::SDLOG_COMPRESS>) _param_sdlog_compress
+#endif
+#if defined(CONFIG_LOGGER_ON_CHANGE)
+		, (ParamInt<px4::params::SDLOG_KEYFRAME>) _param_sdlog_keyframe
+#endif
+#if defined(CONFIG_LOGGER_FLIGHT_RECORDER)
+		, (ParamFloat<px4::params::SDLOG_REC_PRE>) _param_sdlog_rec_pre,
+		(ParamFloat<px4::params::SDLOG_REC_POST>) _param_sdlog_rec_post
+#endif
+#if defined(CONFIG_LOGGER_TELEMETRY_HISTORY)
+		, (ParamFloat<px4::params::SDLOG_HIST_WIN>) _param_sdlog_hist_win
 #endif
 	)
 };
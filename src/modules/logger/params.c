@@ -105,6 +105,96 @@ PARAM_DEFINE_INT32(SDLOG_BOOT_BAT, 0);
  */
 PARAM_DEFINE_INT32(SDLOG_MISSION, 0);
 
+/**
+ * Log compression
+ *
+ * Compress the selected log files on the fly (heatshrink). Compressed logs
+ * are stored as .ulgz and can be converted back with Tools/decompress_ulog.py.
+ * This reduces the amount of data written and transferred at a small CPU cost.
+ *
+ * Only available if the logger is built with LOGGER_COMPRESSION.
+ *
+ * @min 0
+ * @max 3
+ * @bit 0 Full log
+ * @bit 1 Mission log
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_COMPRESS, 0);
+
+/**
+ * Keyframe interval of topics logged on change
+ *
+ * Some regularly published status topics (e.g. vehicle_status, battery_status)
+ * are only logged when their content changes (ignoring the timestamps), and in
+ * addition at least once per this interval.
+ *
+ * Set to 0 to log every sample of these topics.
+ * Only available if the logger is built with LOGGER_ON_CHANGE.
+ *
+ * @unit ms
+ * @min 0
+ * @max 60000
+ * @reboot_required true
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_KEYFRAME, 1000);
+
+/**
+ * Flight recorder pre-trigger time
+ *
+ * High-rate IMU data (sensor_gyro_fifo, sensor_accel_fifo) is kept in RAM
+ * for this long and only written to the log when a trigger fires
+ * (failure detector, estimator fault or the logger trigger command).
+ * The actual time can be shorter, depending on the flight recorder buffer size.
+ *
+ * Set to 0 to disable the flight recorder.
+ * Only available if the logger is built with LOGGER_FLIGHT_RECORDER.
+ *
+ * @unit s
+ * @min 0
+ * @max 30
+ * @decimal 1
+ * @reboot_required true
+ * @group SD Logging
+ */
+PARAM_DEFINE_FLOAT(SDLOG_REC_PRE, 2.f);
+
+/**
+ * Flight recorder post-trigger time
+ *
+ * After a flight recorder trigger, the high-rate topics are logged
+ * directly for this long.
+ *
+ * @unit s
+ * @min 0
+ * @max 300
+ * @decimal 1
+ * @group SD Logging
+ */
+PARAM_DEFINE_FLOAT(SDLOG_REC_POST, 5.f);
+
+/**
+ * Telemetry history window
+ *
+ * The main telemetry topics (vehicle status, attitude, position, GPS, battery,
+ * airspeed and land detector) are additionally kept in RAM at a reduced rate
+ * for this long while logging. A ground station can request the recorded window
+ * after a link dropout by starting the mavlink log stream with param2 set to the
+ * requested duration. The actual time can be shorter, depending on the history buffer size.
+ *
+ * Set to 0 to disable the telemetry history.
+ * Only available if the logger is built with LOGGER_TELEMETRY_HISTORY.
+ *
+ * @unit s
+ * @min 0
+ * @max 600
+ * @decimal 0
+ * @reboot_required true
+ * @group SD Logging
+ */
+PARAM_DEFINE_FLOAT(SDLOG_HIST_WIN, 0.f);
+
 /**
  * Logging topic profile (integer bitmask).
  *
@@ -0,0 +1,224 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include "mavlink_rtcm.h"
+
+// RTCM3 frame of the given total length (header, payload, dummy CRC)
+static size_t rtcm3_frame(uint8_t *buf, size_t len, uint8_t fill)
+{
+	const size_t payload_len = len - 6;
+	buf[0] = 0xD3;
+	buf[1] = (payload_len >> 8) & 0x03;
+	buf[2] = payload_len & 0xFF;
+	memset(&buf[3], fill, len - 3);
+	return len;
+}
+
+static uint8_t fragment_flags(uint8_t sequence_id, uint8_t fragment_id)
+{
+	return 0x1 | (fragment_id << 1) | (sequence_id << 3);
+}
+
+class MavlinkRtcmReassemblerTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		ASSERT_TRUE(reassembler.init(2048));
+	}
+
+	// send a message as GPS_RTCM_DATA, fragmented if needed
+	void send(uint8_t sequence_id, const uint8_t *data, size_t len, int skip_fragment = -1)
+	{
+		if (len <= MavlinkRtcmReassembler::FRAGMENT_SIZE) {
+			reassembler.add_fragment(0, data, len);
+			return;
+		}
+
+		for (uint8_t fragment_id = 0; len > 0; fragment_id++) {
+			const size_t n = len < MavlinkRtcmReassembler::FRAGMENT_SIZE ? len : MavlinkRtcmReassembler::FRAGMENT_SIZE;
+
+			if (fragment_id != skip_fragment) {
+				reassembler.add_fragment(fragment_flags(sequence_id, fragment_id), data, n);
+			}
+
+			data += n;
+			len -= n;
+		}
+	}
+
+	// all published bytes
+	size_t drain(uint8_t *buf, size_t max_len, unsigned &num_messages)
+	{
+		size_t len = 0;
+		num_messages = 0;
+		gps_inject_data_s msg{};
+
+		while (reassembler.pop(msg)) {
+			EXPECT_LE(len + msg.len, max_len);
+			memcpy(&buf[len], msg.data, msg.len);
+			len += msg.len;
+			num_messages++;
+		}
+
+		return len;
+	}
+
+	MavlinkRtcmReassembler reassembler;
+	uint8_t out[4096] {};
+};
+
+TEST_F(MavlinkRtcmReassemblerTest, Empty)
+{
+	gps_inject_data_s msg{};
+	EXPECT_FALSE(reassembler.pop(msg));
+}
+
+TEST_F(MavlinkRtcmReassemblerTest, SmallMessagesArePacked)
+{
+	uint8_t frame[100];
+	rtcm3_frame(frame, sizeof(frame), 1);
+
+	for (int i = 0; i < 5; i++) {
+		send(0, frame, sizeof(frame));
+	}
+
+	unsigned num_messages = 0;
+	EXPECT_EQ(drain(out, sizeof(out), num_messages), 5 * sizeof(frame));
+
+	// 3 whole frames fit into a gps_inject_data message
+	EXPECT_EQ(num_messages, 2u);
+	EXPECT_EQ(reassembler.statistics().bytes_published, 5 * sizeof(frame));
+}
+
+TEST_F(MavlinkRtcmReassemblerTest, FragmentedMessageIsReassembled)
+{
+	uint8_t frame[500];
+	rtcm3_frame(frame, sizeof(frame), 2);
+	send(3, frame, sizeof(frame));
+
+	unsigned num_messages = 0;
+	ASSERT_EQ(drain(out, sizeof(out), num_messages), sizeof(frame));
+	EXPECT_EQ(memcmp(out, frame, sizeof(frame)), 0);
+	EXPECT_EQ(num_messages, 2u);
+	EXPECT_EQ(reassembler.statistics().messages_completed, 1u);
+}
+
+TEST_F(MavlinkRtcmReassemblerTest, ExactMultipleOfTheFragmentSize)
+{
+	uint8_t frame[2 * MavlinkRtcmReassembler::FRAGMENT_SIZE];
+	rtcm3_frame(frame, sizeof(frame), 3);
+	send(1, frame, sizeof(frame));
+
+	// completed by the next sequence
+	uint8_t next[50];
+	rtcm3_frame(next, sizeof(next), 4);
+	send(2, next, sizeof(next));
+
+	unsigned num_messages = 0;
+	ASSERT_EQ(drain(out, sizeof(out), num_messages), sizeof(frame) + sizeof(next));
+	EXPECT_EQ(memcmp(out, frame, sizeof(frame)), 0);
+	EXPECT_EQ(memcmp(&out[sizeof(frame)], next, sizeof(next)), 0);
+	EXPECT_EQ(reassembler.statistics().sequences_dropped, 0u);
+}
+
+TEST_F(MavlinkRtcmReassemblerTest, IncompleteSequenceIsDropped)
+{
+	uint8_t frame[500];
+	rtcm3_frame(frame, sizeof(frame), 5);
+
+	send(4, frame, sizeof(frame), 1);  // middle fragment lost
+	send(5, frame, sizeof(frame), 2);  // last fragment lost
+	send(6, frame, sizeof(frame));
+
+	unsigned num_messages = 0;
+	ASSERT_EQ(drain(out, sizeof(out), num_messages), sizeof(frame));
+	EXPECT_EQ(memcmp(out, frame, sizeof(frame)), 0);
+	EXPECT_EQ(reassembler.statistics().sequences_dropped, 2u);
+}
+
+TEST_F(MavlinkRtcmReassemblerTest, OldestMessagesAreDroppedFirst)
+{
+	uint8_t frame[200];
+
+	// more than the ring holds
+	for (uint8_t i = 0; i < 20; i++) {
+		rtcm3_frame(frame, sizeof(frame), i);
+		send(i, frame, sizeof(frame));
+	}
+
+	unsigned num_messages = 0;
+	const size_t len = drain(out, sizeof(out), num_messages);
+	ASSERT_GT(len, 0u);
+	ASSERT_EQ(len % sizeof(frame), 0u);
+
+	const unsigned kept = len / sizeof(frame);
+	EXPECT_EQ(reassembler.statistics().messages_dropped, 20u - kept);
+
+	// the newest ones are kept, in order
+	for (unsigned i = 0; i < kept; i++) {
+		EXPECT_EQ(out[i * sizeof(frame) + 10], 20 - kept + i);
+	}
+}
+
+TEST_F(MavlinkRtcmReassemblerTest, PartiallyPublishedMessageIsKept)
+{
+	uint8_t frame[700];
+	rtcm3_frame(frame, sizeof(frame), 7);
+	send(0, frame, sizeof(frame));
+
+	gps_inject_data_s msg{};
+	ASSERT_TRUE(reassembler.pop(msg));
+	EXPECT_EQ(msg.flags, 1);
+
+	// fill the ring while the first message is handed out
+	for (uint8_t i = 1; i < 10; i++) {
+		send(i, frame, sizeof(frame));
+	}
+
+	size_t len = msg.len;
+	memcpy(out, msg.data, msg.len);
+
+	while (reassembler.pop(msg)) {
+		memcpy(&out[len], msg.data, msg.len);
+		len += msg.len;
+	}
+
+	ASSERT_EQ(len % sizeof(frame), 0u);
+	EXPECT_EQ(memcmp(out, frame, sizeof(frame)), 0);
+}
@@ -61,11 +61,24 @@
 # define MAVLINK_COMM_5 static_cast<mavlink_channel_t>(5)
 #endif
 
+#include <px4_platform_common/px4_config.h>
 #include <mavlink_types.h>
 #include <unistd.h>
 
 __BEGIN_DECLS
 
+#if defined(CONFIG_MAVLINK_CRC_TABLE)
+#include <lib/crc/crc.h>
+
+/* replace the bit wise checksum of the MAVLink library (checksum.h) with the table driven one */
+#define HAVE_CRC_ACCUMULATE
+
+static inline void crc_accumulate(uint8_t data, uint16_t *crcAccum)
+{
+	*crcAccum = crc16_mcrf4xx_add(*crcAccum, data);
+}
+#endif // CONFIG_MAVLINK_CRC_TABLE
+
 /* Struct that stores the communication settings of this system.
    you can also define / alter these settings elsewhere, as long
    as they're included BEFORE mavlink.h.
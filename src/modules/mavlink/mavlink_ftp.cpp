@@ -42,11 +42,14 @@
 #include <errno.h>
 #include <cstring>
 
+#include <lib/mathlib/mathlib.h>
+
 #include "mavlink_ftp.h"
 #include "mavlink_tests/mavlink_ftp_test.h"
 
 #ifndef MAVLINK_FTP_UNIT_TEST
 #include "mavlink_main.h"
+#include "mavlink_param_snapshot.h"
 #else
 #include <mavlink.h>
 #endif
@@ -66,6 +69,7 @@ MavlinkFTP::~MavlinkFTP()
 {
 	delete[] _work_buffer1;
 	delete[] _work_buffer2;
+	delete[] _read_ahead_buffer;
 }
 
 unsigned
@@ -506,8 +510,21 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 		return kErrNoSessionsAvailable;
 	}
 
-	strncpy(_work_buffer1, _root_dir, _work_buffer1_len);
-	strncpy(_work_buffer1 + _root_dir_len, _data_as_cstring(payload), _work_buffer1_len - _root_dir_len);
+#if !defined(MAVLINK_FTP_UNIT_TEST) && !defined(CONSTRAINED_FLASH)
+
+	if (MavlinkParamSnapshot::is_snapshot_path(_data_as_cstring(payload))) {
+		// virtual parameter snapshot files are generated on open, read only
+		if (((oflag & O_ACCMODE) != O_RDONLY)
+		    || (MavlinkParamSnapshot::generate(_data_as_cstring(payload), _work_buffer1, _work_buffer1_len) != PX4_OK)) {
+			return kErrFileNotFound;
+		}
+
+	} else
+#endif // !MAVLINK_FTP_UNIT_TEST && !CONSTRAINED_FLASH
+	{
+		strncpy(_work_buffer1, _root_dir, _work_buffer1_len);
+		strncpy(_work_buffer1 + _root_dir_len, _data_as_cstring(payload), _work_buffer1_len - _root_dir_len);
+	}
 
 	PX4_DEBUG("FTP: open '%s'", _work_buffer1);
 
@@ -543,6 +560,7 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 	_session_info.fd = fd;
 	_session_info.file_size = fileSize;
 	_session_info.stream_download = false;
+	_read_ahead_len = 0;
 
 	payload->session = 0;
 	payload->size = sizeof(uint32_t);
@@ -599,6 +617,33 @@ MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t
 	}
 
 	PX4_DEBUG("FTP: burst offset:%" PRIu32, payload->offset);
+	// An optional length in the request data limits the burst to a range, e.g. to
+	// retransmit data missed in a previous burst. The whole file is sent otherwise.
+	uint32_t range = 0;
+
+	if (payload->size == sizeof(range)) {
+		memcpy(&range, payload->data, sizeof(range));
+	}
+
+	if ((range > 0) && (payload->offset < _session_info.file_size) && (range < _session_info.file_size - payload->offset)) {
+		_session_info.stream_end = payload->offset + range;
+
+	} else {
+		_session_info.stream_end = _session_info.file_size;
+	}
+
+#ifndef MAVLINK_FTP_UNIT_TEST
+	// complete a burst after ~0.5s of link data, so the GCS round trip to request the next one is small in comparison
+	_session_info.stream_window = math::max(35000, _mavlink->get_data_rate() / 2);
+#else
+	_session_info.stream_window = 35000;
+#endif
+
+	if (_read_ahead_buffer == nullptr) {
+		_read_ahead_buffer = new uint8_t[_read_ahead_buffer_len];
+		_read_ahead_len = 0;
+	}
+
 	// Setup for streaming sends
 	_session_info.stream_download = true;
 	_session_info.stream_offset = payload->offset;
@@ -1044,6 +1089,12 @@ void MavlinkFTP::send()
 				delete[] _work_buffer2;
 				_work_buffer2 = nullptr;
 			}
+
+			if (_read_ahead_buffer && !_session_info.stream_download) {
+				delete[] _read_ahead_buffer;
+				_read_ahead_buffer = nullptr;
+				_read_ahead_len = 0;
+			}
 		}
 
 	} else if (_session_info.fd != -1) {
@@ -1067,7 +1118,7 @@ void MavlinkFTP::send()
 	unsigned max_bytes_to_send = _mavlink->get_free_tx_buf();
 	PX4_DEBUG("MavlinkFTP::send max_bytes_to_send(%u) get_free_tx_buf(%u)", max_bytes_to_send, _mavlink->get_free_tx_buf());
 
-	if (max_bytes_to_send < get_size()) {
+	if (max_bytes_to_send < get_size() || !_mavlink->tx_allowed(MavlinkStream::Priority::Bulk, get_size())) {
 		return;
 	}
 
@@ -1100,7 +1151,9 @@ void MavlinkFTP::send()
 			PX4_DEBUG("stream download: sending Nak EOF");
 		}
 
-		if (error_code == kErrNone) {
+		const size_t chunk = math::min((uint32_t)kMaxDataLength, _session_info.stream_end - _session_info.stream_offset);
+
+		if (error_code == kErrNone && _read_ahead_buffer == nullptr) {
 			if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
 				error_code = kErrFailErrno;
 				PX4_WARN("stream download: seek fail");
@@ -1108,7 +1161,8 @@ void MavlinkFTP::send()
 		}
 
 		if (error_code == kErrNone) {
-			int bytes_read = ::read(_session_info.fd, &payload->data[0], kMaxDataLength);
+			int bytes_read = (_read_ahead_buffer != nullptr) ? _readAhead(payload->offset, &payload->data[0], chunk)
+					 : ::read(_session_info.fd, &payload->data[0], chunk);
 
 			if (bytes_read < 0) {
 				// Negative return indicates error other than eof
@@ -1135,14 +1189,20 @@ void MavlinkFTP::send()
 
 			_session_info.stream_download = false;
 
+		} else if (_session_info.stream_offset >= _session_info.stream_end && _session_info.stream_end < _session_info.file_size) {
+			// requested range sent
+			payload->burst_complete = true;
+			_session_info.stream_download = false;
+			_session_info.stream_chunk_transmitted = 0;
+
 		} else {
 #ifndef MAVLINK_FTP_UNIT_TEST
 
 			if (max_bytes_to_send < (get_size() * 2)) {
 				more_data = false;
 
-				/* perform transfers in 35K chunks - this is determined empirical */
-				if (_session_info.stream_chunk_transmitted > 35000) {
+				/* perform transfers in chunks (at least 35K - this is determined empirical) */
+				if (_session_info.stream_chunk_transmitted > _session_info.stream_window) {
 					payload->burst_complete = true;
 					_session_info.stream_download = false;
 					_session_info.stream_chunk_transmitted = 0;
@@ -1166,6 +1226,33 @@ void MavlinkFTP::send()
 	} while (more_data);
 }
 
+int MavlinkFTP::_readAhead(uint32_t offset, uint8_t *dst, size_t size)
+{
+	if ((offset < _read_ahead_offset) || (offset >= _read_ahead_offset + _read_ahead_len)) {
+		if (lseek(_session_info.fd, offset, SEEK_SET) < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		int bytes_read = ::read(_session_info.fd, _read_ahead_buffer, _read_ahead_buffer_len);
+
+		if (bytes_read < 0) {
+			_our_errno = errno;
+			_read_ahead_len = 0;
+			return -1;
+		}
+
+		_read_ahead_offset = offset;
+		_read_ahead_len = bytes_read;
+	}
+
+	// the buffer is a multiple of the packet size, so packets are only split at EOF or by a seek
+	const size_t len = math::min(size, (size_t)(_read_ahead_offset + _read_ahead_len - offset));
+	memcpy(dst, &_read_ahead_buffer[offset - _read_ahead_offset], len);
+
+	return len;
+}
+
 bool MavlinkFTP::_validatePathIsWritable(const char *path)
 {
 #ifdef __PX4_NUTTX
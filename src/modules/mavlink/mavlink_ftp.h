@@ -130,6 +130,9 @@ public:
 
 	unsigned get_size();
 
+	/// @brief true while a burst download is streaming, send() should then be called as often as possible
+	bool stream_download_active() const { return _session_info.stream_download; }
+
 private:
 	char		*_data_as_cstring(PayloadHeader *payload);
 
@@ -151,6 +154,10 @@ private:
 	ErrorCode	_workRename(PayloadHeader *payload);
 	ErrorCode	_workCalcFileCRC32(PayloadHeader *payload);
 
+	/// @brief Copy up to size bytes at offset of the session file, refilling the read-ahead buffer when needed
+	///	@return number of bytes copied, 0 at EOF, -1 on error
+	int		_readAhead(uint32_t offset, uint8_t *dst, size_t size);
+
 	uint8_t _getServerSystemId(void);
 	uint8_t _getServerComponentId(void);
 	uint8_t _getServerChannel(void);
@@ -175,6 +182,8 @@ private:
 		uint32_t	file_size;
 		bool		stream_download;
 		uint32_t	stream_offset;
+		uint32_t	stream_end;		///< end of the requested burst range, file_size for the whole file
+		uint32_t	stream_window;		///< bytes to send before completing a burst
 		uint16_t	stream_seq_number;
 		uint8_t		stream_target_system_id;
 		uint8_t         stream_target_component_id;
@@ -198,6 +207,16 @@ private:
 	static constexpr int _work_buffer2_len = 256;
 	hrt_abstime _last_work_buffer_access{0}; ///< timestamp when the buffers were last accessed
 
+	/* read-ahead buffer for burst downloads: one file read per several packets */
+#ifdef __PX4_NUTTX
+	static constexpr int _read_ahead_buffer_len = 8 * kMaxDataLength;
+#else
+	static constexpr int _read_ahead_buffer_len = 32 * kMaxDataLength;
+#endif
+	uint8_t *_read_ahead_buffer{nullptr};
+	uint32_t _read_ahead_offset{0};	///< file offset of _read_ahead_buffer[0]
+	uint32_t _read_ahead_len{0};	///< valid bytes in _read_ahead_buffer, 0 if invalid
+
 	// prepend a root directory to each file/dir access to avoid enumerating the full FS tree (e.g. on Linux).
 	// Note that requests can still fall outside of the root dir by using ../..
 #ifdef MAVLINK_FTP_UNIT_TEST
@@ -124,6 +124,7 @@ MavlinkLogHandler::send()
 	//-- Log Entries
 	while (_current_status == LogHandlerState::Listing
 	       && _mavlink->get_free_tx_buf() > MAVLINK_MSG_ID_LOG_ENTRY_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES
+	       && _mavlink->tx_allowed(MavlinkStream::Priority::Bulk, MAVLINK_MSG_ID_LOG_ENTRY_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES)
 	       && count < MAX_BYTES_SEND) {
 		count += _log_send_listing();
 	}
@@ -131,6 +132,7 @@ MavlinkLogHandler::send()
 	//-- Log Data
 	while (_current_status == LogHandlerState::SendingData
 	       && _mavlink->get_free_tx_buf() > MAVLINK_MSG_ID_LOG_DATA_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES
+	       && _mavlink->tx_allowed(MavlinkStream::Priority::Bulk, MAVLINK_MSG_ID_LOG_DATA_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES)
 	       && count < MAX_BYTES_SEND) {
 		count += _log_send_data();
 	}
@@ -59,6 +59,7 @@
 #include <uORB/topics/event.h>
 #include "mavlink_receiver.h"
 #include "mavlink_main.h"
+#include "mavlink_message_cache.h"
 
 // Guard against MAVLink misconfiguration
 #ifndef MAVLINK_CRC_EXTRA
@@ -130,7 +131,7 @@ Mavlink::Mavlink() :
 	_vehicle_command_sub.subscribe();
 
 	if (orb_exists(ORB_ID(event), 0) == PX4_ERROR) {
-		orb_advertise_queue(ORB_ID(event), nullptr, event_s::ORB_QUEUE_LENGTH);
+		orb_advertise_queue(ORB_ID(event), nullptr, events::queue_length);
 	}
 
 	_event_sub.subscribe();
@@ -180,6 +181,7 @@ Mavlink::~Mavlink()
 	perf_free(_loop_interval_perf);
 	perf_free(_send_byte_error_perf);
 	perf_free(_forwarding_error_perf);
+	perf_free(_events_lost_perf);
 }
 
 void
@@ -337,6 +339,22 @@ Mavlink::get_instance_for_network_port(unsigned long port)
 }
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_SHM)
+Mavlink *
+Mavlink::get_instance_for_shm(const char *shm_name)
+{
+	LockGuard lg{mavlink_module_mutex};
+
+	for (Mavlink *inst : mavlink_module_instances) {
+		if (inst && (inst->_protocol == Protocol::SHM) && (strcmp(inst->_shm_name, shm_name) == 0)) {
+			return inst;
+		}
+	}
+
+	return nullptr;
+}
+#endif // MAVLINK_SHM
+
 int
 Mavlink::destroy_all_instances()
 {
@@ -418,6 +436,15 @@ Mavlink::get_status_all_instances(bool show_streams_status)
 		}
 	}
 
+#if defined(CONFIG_MAVLINK_SHARED_MESSAGE_CACHE)
+
+	if (iterations > 0) {
+		printf("\n");
+		MavlinkMessageCache::print_status();
+	}
+
+#endif // CONFIG_MAVLINK_SHARED_MESSAGE_CACHE
+
 	/* return an error if there are no instances */
 	return (iterations == 0);
 }
@@ -708,6 +735,12 @@ Mavlink::get_free_tx_buf()
 
 	} else
 #endif // MAVLINK_UDP
+#if defined(MAVLINK_SHM)
+	if (get_protocol() == Protocol::SHM) {
+		return _shm.free_space();
+
+	} else
+#endif // MAVLINK_SHM
 	{
 
 #if defined(__PX4_NUTTX)
@@ -762,6 +795,31 @@ void Mavlink::send_finish()
 		return;
 	}
 
+#if defined(MAVLINK_UDP_BATCHING)
+
+	if (get_protocol() == Protocol::UDP) {
+		udp_batch_add(_src_addr, false);
+
+		if ((_mode != MAVLINK_MODE_ONBOARD) && broadcast_enabled() &&
+		    (!get_client_source_initialized() || !is_gcs_connected())) {
+
+			if (!_broadcast_address_found) {
+				find_broadcast_address();
+			}
+
+			if (_broadcast_address_found) {
+				udp_batch_add(_bcast_addr, true);
+			}
+		}
+
+		_buf_fill = 0;
+
+		pthread_mutex_unlock(&_send_mutex);
+		return;
+	}
+
+#endif // MAVLINK_UDP_BATCHING
+
 	int ret = -1;
 
 	// send message to UART
@@ -809,9 +867,20 @@ void Mavlink::send_finish()
 
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_SHM)
+
+	else if (get_protocol() == Protocol::SHM) {
+		ret = _shm.write(_buf, _buf_fill);
+	}
+
+#endif // MAVLINK_SHM
+
 	if (ret == (int)_buf_fill) {
 		_tstatus.tx_message_count++;
 		count_txbytes(_buf_fill);
+#if defined(CONFIG_MAVLINK_STREAM_SCHEDULER)
+		_stream_scheduler.consume(_buf_fill);
+#endif // CONFIG_MAVLINK_STREAM_SCHEDULER
 		_last_write_success_time = _last_write_try_time;
 
 	} else {
@@ -836,6 +905,82 @@ void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
 	}
 }
 
+void Mavlink::flush_tx()
+{
+#if defined(MAVLINK_UDP_BATCHING)
+	pthread_mutex_lock(&_send_mutex);
+	udp_batch_flush();
+	pthread_mutex_unlock(&_send_mutex);
+#endif // MAVLINK_UDP_BATCHING
+}
+
+#if defined(MAVLINK_UDP_BATCHING)
+void Mavlink::udp_batch_add(const sockaddr_in &addr, bool broadcast)
+{
+	const int i = _udp_batch_count;
+
+	memcpy(_udp_batch_buf[i], _buf, _buf_fill);
+	_udp_batch_addr[i] = addr;
+	_udp_batch_broadcast[i] = broadcast;
+
+	_udp_batch_iov[i].iov_base = _udp_batch_buf[i];
+	_udp_batch_iov[i].iov_len = _buf_fill;
+
+	msghdr &hdr = _udp_batch_msgs[i].msg_hdr;
+	hdr = {};
+	hdr.msg_name = &_udp_batch_addr[i];
+	hdr.msg_namelen = sizeof(_udp_batch_addr[i]);
+	hdr.msg_iov = &_udp_batch_iov[i];
+	hdr.msg_iovlen = 1;
+
+	if (++_udp_batch_count == UDP_BATCH_SIZE) {
+		udp_batch_flush();
+	}
+}
+
+void Mavlink::udp_batch_flush()
+{
+	int sent = 0;
+
+	while (sent < _udp_batch_count) {
+		int ret = sendmmsg(_socket_fd, &_udp_batch_msgs[sent], _udp_batch_count - sent, 0);
+
+		// sendmmsg() stops at the first failing datagram: account and skip it
+		const int count = (ret > 0) ? ret : 1;
+
+		for (int i = sent; i < sent + count; i++) {
+			const unsigned len = _udp_batch_iov[i].iov_len;
+			const bool success = (ret > 0) && (_udp_batch_msgs[i].msg_len == len);
+
+			if (_udp_batch_broadcast[i]) {
+				if (!success && !_broadcast_failed_warned) {
+					PX4_ERR("sending broadcast failed, errno: %d: %s", errno, strerror(errno));
+					_broadcast_failed_warned = true;
+
+				} else if (success) {
+					_broadcast_failed_warned = false;
+				}
+
+			} else if (success) {
+				_tstatus.tx_message_count++;
+				count_txbytes(len);
+				_last_write_success_time = _last_write_try_time;
+#if defined(CONFIG_MAVLINK_STREAM_SCHEDULER)
+				_stream_scheduler.consume(len);
+#endif // CONFIG_MAVLINK_STREAM_SCHEDULER
+
+			} else {
+				count_txerrbytes(len);
+			}
+		}
+
+		sent += count;
+	}
+
+	_udp_batch_count = 0;
+}
+#endif // MAVLINK_UDP_BATCHING
+
 #ifdef MAVLINK_UDP
 void Mavlink::find_broadcast_address()
 {
@@ -1266,6 +1411,71 @@ Mavlink::get_shell()
 	return _mavlink_shell;
 }
 
+void
+Mavlink::send_shell_output(const hrt_abstime &t)
+{
+	const unsigned msg_size = MAVLINK_MSG_ID_SERIAL_CONTROL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
+
+#if defined(CONFIG_MAVLINK_SHELL_BATCHING)
+	const size_t available = _mavlink_shell->available();
+
+	if (available == 0) {
+		_shell_pending_since = 0;
+		return;
+	}
+
+	if (_shell_pending_since == 0) {
+		_shell_pending_since = t;
+	}
+
+	// refill the byte budget of the shell output
+	const int32_t rate = _param_mav_shell_rate.get();
+	const float burst = SHELL_MAX_MESSAGES * msg_size;
+
+	if (rate > 0) {
+		const float dt = math::min((t - _shell_last_update) * 1e-6f, 1.f);
+		_shell_tokens = math::min(_shell_tokens + rate * dt, burst);
+
+	} else {
+		_shell_tokens = burst;
+	}
+
+	_shell_last_update = t;
+
+	// wait for a full message, unless the output is pending for a while already (e.g. a prompt)
+	if (available < sizeof(mavlink_serial_control_t::data) && t - _shell_pending_since < SHELL_BATCH_TIMEOUT) {
+		return;
+	}
+
+	// Send as many messages as the budget allows. The rest stays in the pipe, which blocks
+	// the shell once it is full, so no output is dropped and the shell is throttled.
+	for (int i = 0; i < SHELL_MAX_MESSAGES && _mavlink_shell->available() > 0; ++i) {
+		if (_shell_tokens < msg_size || get_free_tx_buf() < msg_size
+		    || !tx_allowed(MavlinkStream::Priority::Normal, msg_size)) {
+			break;
+		}
+
+#else
+
+	if (_mavlink_shell->available() > 0 && get_free_tx_buf() >= msg_size) {
+#endif // CONFIG_MAVLINK_SHELL_BATCHING
+		mavlink_serial_control_t msg;
+		msg.baudrate = 0;
+		msg.flags = SERIAL_CONTROL_FLAG_REPLY;
+		msg.timeout = 0;
+		msg.device = SERIAL_CONTROL_DEV_SHELL;
+		msg.count = _mavlink_shell->read(msg.data, sizeof(msg.data));
+		msg.target_system = _mavlink_shell->targetSysid();
+		msg.target_component = _mavlink_shell->targetCompid();
+		mavlink_msg_serial_control_send_struct(get_channel(), &msg);
+
+#if defined(CONFIG_MAVLINK_SHELL_BATCHING)
+		_shell_tokens -= msg_size;
+		_shell_pending_since = t;
+#endif // CONFIG_MAVLINK_SHELL_BATCHING
+	}
+}
+
 void
 Mavlink::close_shell()
 {
@@ -1341,6 +1551,32 @@ Mavlink::update_rate_mult()
 
 	/* ensure the rate multiplier never drops below 5% so that something is always sent */
 	_rate_mult = math::constrain(_rate_mult, 0.05f, 1.0f);
+
+	_link_rate = _datarate * math::constrain(hardware_mult, 0.05f, 1.0f);
+
+#if defined(CONFIG_MAVLINK_STREAM_SCHEDULER)
+	/* the byte budget follows what the link can actually carry right now */
+	_stream_scheduler.update(hrt_absolute_time(), _link_rate);
+#endif // CONFIG_MAVLINK_STREAM_SCHEDULER
+}
+
+void
+Mavlink::update_stream(MavlinkStream *stream, const hrt_abstime &t)
+{
+	stream->update(t);
+
+	if (!_first_heartbeat_sent) {
+		if (_mode == MAVLINK_MODE_IRIDIUM) {
+			if (stream->get_id() == MAVLINK_MSG_ID_HIGH_LATENCY2) {
+				_first_heartbeat_sent = stream->first_message_sent();
+			}
+
+		} else {
+			if (stream->get_id() == MAVLINK_MSG_ID_HEARTBEAT) {
+				_first_heartbeat_sent = stream->first_message_sent();
+			}
+		}
+	}
 }
 
 void
@@ -1439,6 +1675,7 @@ Mavlink::configure_streams_to_default(const char *configure_single_stream)
 		configure_stream_local("SCALED_PRESSURE", 1.0f);
 		configure_stream_local("SERVO_OUTPUT_RAW_0", 1.0f);
 		configure_stream_local("SYS_STATUS", 1.0f);
+		configure_stream_local("TERRAIN_REQUEST", 2.0f);
 		configure_stream_local("TIME_ESTIMATE_TO_TARGET", 1.0f);
 		configure_stream_local("UTM_GLOBAL_POSITION", 0.5f);
 		configure_stream_local("VFR_HUD", 4.0f);
@@ -1849,7 +2086,7 @@ Mavlink::task_main(int argc, char *argv[])
 	int temp_int_arg;
 #endif
 
-	while ((ch = px4_getopt(argc, argv, "b:r:d:n:u:o:m:t:c:fswxzZp", &myoptind, &myoptarg)) != EOF) {
+	while ((ch = px4_getopt(argc, argv, "b:r:d:n:u:o:m:t:c:k:fswxzZp", &myoptind, &myoptarg)) != EOF) {
 		switch (ch) {
 		case 'b':
 			if (px4_get_parameter_value(myoptarg, _baudrate) != 0) {
@@ -1969,6 +2206,20 @@ Mavlink::task_main(int argc, char *argv[])
 			break;
 #endif
 
+#if defined(MAVLINK_SHM)
+
+		case 'k':
+			_shm_name = myoptarg;
+			set_protocol(Protocol::SHM);
+			break;
+#else
+
+		case 'k':
+			PX4_ERR("shared memory transport not supported on this platform");
+			err_flag = true;
+			break;
+#endif // MAVLINK_SHM
+
 //		case 'e':
 //			_mavlink_link_termination_allowed = true;
 //			break;
@@ -2134,6 +2385,19 @@ Mavlink::task_main(int argc, char *argv[])
 
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_SHM)
+
+	else if (get_protocol() == Protocol::SHM) {
+		if (Mavlink::get_instance_for_shm(_shm_name) != nullptr) {
+			PX4_ERR("shared memory %s already in use", _shm_name);
+			return PX4_ERROR;
+		}
+
+		PX4_INFO("mode: %s, data rate: %d B/s on shared memory %s", mavlink_mode_str(_mode), _datarate, _shm_name);
+	}
+
+#endif // MAVLINK_SHM
+
 	if (set_instance_id()) {
 		if (!set_channel()) {
 			PX4_ERR("set channel failed");
@@ -2226,6 +2490,14 @@ Mavlink::task_main(int argc, char *argv[])
 
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_SHM)
+
+	if ((get_protocol() == Protocol::SHM) && (_shm.open(_shm_name) != PX4_OK)) {
+		return PX4_ERROR;
+	}
+
+#endif // MAVLINK_SHM
+
 	_task_id = px4_getpid();
 
 	/* if the protocol is serial, we send the system version blindly */
@@ -2236,6 +2508,7 @@ Mavlink::task_main(int argc, char *argv[])
 	_receiver.start();
 
 	uint16_t event_sequence_offset = 0; // offset to account for skipped events, not sent via MAVLink
+	int32_t last_event_sequence = -1; // to count the events lost in the uORB queue
 
 	_mavlink_start_time = hrt_absolute_time();
 
@@ -2422,40 +2695,32 @@ Mavlink::task_main(int argc, char *argv[])
 		}
 
 		/* check for shell output */
-		if (_mavlink_shell && _mavlink_shell->available() > 0) {
-			if (get_free_tx_buf() >= MAVLINK_MSG_ID_SERIAL_CONTROL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES) {
-				mavlink_serial_control_t msg;
-				msg.baudrate = 0;
-				msg.flags = SERIAL_CONTROL_FLAG_REPLY;
-				msg.timeout = 0;
-				msg.device = SERIAL_CONTROL_DEV_SHELL;
-				msg.count = _mavlink_shell->read(msg.data, sizeof(msg.data));
-				msg.target_system = _mavlink_shell->targetSysid();
-				msg.target_component = _mavlink_shell->targetCompid();
-				mavlink_msg_serial_control_send_struct(get_channel(), &msg);
-			}
+		if (_mavlink_shell) {
+			send_shell_output(t);
 		}
 
 		check_requested_subscriptions();
 
 		/* update streams */
-		for (const auto &stream : _streams) {
-			stream->update(t);
-
-			if (!_first_heartbeat_sent) {
-				if (_mode == MAVLINK_MODE_IRIDIUM) {
-					if (stream->get_id() == MAVLINK_MSG_ID_HIGH_LATENCY2) {
-						_first_heartbeat_sent = stream->first_message_sent();
-					}
+#if defined(CONFIG_MAVLINK_STREAM_SCHEDULER)
 
-				} else {
-					if (stream->get_id() == MAVLINK_MSG_ID_HEARTBEAT) {
-						_first_heartbeat_sent = stream->first_message_sent();
-					}
+		// highest priority first, so that it gets the link budget of this iteration
+		for (int p = (int)MavlinkStream::Priority::Critical; p <= (int)MavlinkStream::Priority::Bulk; p++) {
+			for (const auto &stream : _streams) {
+				if ((int)stream->priority() == p) {
+					update_stream(stream, t);
 				}
 			}
 		}
 
+#else
+
+		for (const auto &stream : _streams) {
+			update_stream(stream, t);
+		}
+
+#endif // CONFIG_MAVLINK_STREAM_SCHEDULER
+
 		/* check for ulog streaming messages */
 		if (_mavlink_ulog) {
 			if (cmd_logging_stop_acknowledgement) {
@@ -2488,6 +2753,16 @@ Mavlink::task_main(int argc, char *argv[])
 				event_s orb_event;
 
 				while (_event_sub.update(&orb_event)) {
+					if (last_event_sequence >= 0) {
+						const uint16_t lost = orb_event.event_sequence - (uint16_t)last_event_sequence - 1;
+
+						if (lost > 0) {
+							perf_set_count(_events_lost_perf, perf_event_count(_events_lost_perf) + lost);
+						}
+					}
+
+					last_event_sequence = orb_event.event_sequence;
+
 					if (events::externalLogLevel(orb_event.log_levels) == events::LogLevel::Disabled) {
 						++event_sequence_offset; // skip this event
 
@@ -2549,6 +2824,8 @@ Mavlink::task_main(int argc, char *argv[])
 			publish_telemetry_status();
 		}
 
+		flush_tx();
+
 		perf_end(_loop_perf);
 	}
 
@@ -2572,6 +2849,10 @@ Mavlink::task_main(int argc, char *argv[])
 		_socket_fd = -1;
 	}
 
+#if defined(MAVLINK_SHM)
+	_shm.close();
+#endif // MAVLINK_SHM
+
 	if (_mavlink_ulog) {
 		_mavlink_ulog->stop();
 		_mavlink_ulog = nullptr;
@@ -2872,6 +3153,10 @@ Mavlink::display_status()
 	printf("\t  txerr: %.1f B/s\n", (double)_tstatus.tx_error_rate_avg);
 	printf("\t  tx rate mult: %.3f\n", (double)_rate_mult);
 	printf("\t  tx rate max: %i B/s\n", _datarate);
+#if defined(CONFIG_MAVLINK_STREAM_SCHEDULER)
+	printf("\t  tx link rate: %.1f B/s, budget: %" PRId32 "/%" PRId32 " B\n", (double)_stream_scheduler.link_rate(),
+	       _stream_scheduler.budget(), _stream_scheduler.burst());
+#endif // CONFIG_MAVLINK_STREAM_SCHEDULER
 	printf("\t  rx: %.1f B/s\n", (double)_tstatus.rx_rate_avg);
 	printf("\t  rx loss: %.1f%%\n", (double)_tstatus.rx_message_lost_rate);
 
@@ -2917,6 +3202,13 @@ Mavlink::display_status()
 	case Protocol::SERIAL:
 		printf("serial (%s @%i)\n", _device_name, _baudrate);
 		break;
+
+#if defined(MAVLINK_SHM)
+
+	case Protocol::SHM:
+		printf("shared memory (%s, %zu B free)\n", _shm_name, _shm.free_space());
+		break;
+#endif // MAVLINK_SHM
 	}
 
 	if (_ping_stats.last_ping_time > 0) {
@@ -3261,6 +3553,9 @@ $ mavlink stream -u 14556 -s HIGHRES_IMU -r 50
 	PRINT_MODULE_USAGE_PARAM_INT('u', 14556, 0, 65536, "Select UDP Network Port (local)", true);
 	PRINT_MODULE_USAGE_PARAM_INT('o', 14550, 0, 65536, "Select UDP Network Port (remote)", true);
 	PRINT_MODULE_USAGE_PARAM_STRING('t', "127.0.0.1", nullptr, "Partner IP (broadcasting can be enabled via -p flag)", true);
+#endif
+#if defined(MAVLINK_SHM)
+	PRINT_MODULE_USAGE_PARAM_STRING('k', nullptr, "/px4_mavlink0", "Use a shared memory segment instead of serial/UDP", true);
 #endif
 	PRINT_MODULE_USAGE_PARAM_STRING('m', "normal", "custom|camera|onboard|osd|magic|config|iridium|minimal|extvision|extvisionmin|gimbal|uavionix",
 					"Mode: sets default streams and rates", true);
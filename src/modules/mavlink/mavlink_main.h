@@ -84,6 +84,9 @@
 #include "mavlink_messages.h"
 #include "mavlink_receiver.h"
 #include "mavlink_shell.h"
+#if defined(CONFIG_MAVLINK_STREAM_SCHEDULER)
+#include "mavlink_stream_scheduler.h"
+#endif // CONFIG_MAVLINK_STREAM_SCHEDULER
 #include "mavlink_ulog.h"
 
 #define DEFAULT_BAUD_RATE       57600
@@ -96,11 +99,23 @@
 # define DEFAULT_REMOTE_PORT_UDP 14550 ///< GCS port per MAVLink spec
 #endif // CONFIG_NET || __PX4_POSIX
 
+#if defined(CONFIG_MAVLINK_SHM) && defined(__PX4_POSIX)
+# define MAVLINK_SHM
+# include "mavlink_shm.h"
+#endif // CONFIG_MAVLINK_SHM && __PX4_POSIX
+
+#if defined(MAVLINK_UDP) && defined(CONFIG_MAVLINK_UDP_BATCHING) && defined(__PX4_LINUX)
+# define MAVLINK_UDP_BATCHING
+#endif // MAVLINK_UDP && CONFIG_MAVLINK_UDP_BATCHING && __PX4_LINUX
+
 enum class Protocol {
 	SERIAL = 0,
 #if defined(MAVLINK_UDP)
 	UDP,
 #endif // MAVLINK_UDP
+#if defined(MAVLINK_SHM)
+	SHM,
+#endif // MAVLINK_SHM
 };
 
 using namespace time_literals;
@@ -296,6 +311,12 @@ public:
 	bool			multicast_enabled() { return _mav_broadcast == BROADCAST_MODE_MULTICAST; }
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_SHM)
+	static Mavlink 		*get_instance_for_shm(const char *shm_name);
+
+	MavlinkShm		&get_shm() { return _shm; }
+#endif // MAVLINK_SHM
+
 	/**
 	 * Set the boot complete flag on all instances
 	 *
@@ -411,6 +432,32 @@ public:
 
 	float			get_rate_mult() const { return _rate_mult; }
 
+	/**
+	 * Usable link bandwidth: the data rate scaled by RADIO_STATUS and TX error rate feedback [B/s]
+	 */
+	float			get_link_rate() const { return _link_rate; }
+
+	/**
+	 * Write out UDP packets queued in the current batch, no-op without batching.
+	 * Called at the end of every main and receiver loop iteration.
+	 */
+	void			flush_tx();
+
+	/**
+	 * Check the link budget before sending, always true without the stream scheduler.
+	 *
+	 * @param priority link scheduling priority of the message(s)
+	 * @param size total size of the message(s) in bytes
+	 */
+	bool			tx_allowed(MavlinkStream::Priority priority, unsigned size) const
+	{
+#if defined(CONFIG_MAVLINK_STREAM_SCHEDULER)
+		return _stream_scheduler.allowed(priority, size);
+#else
+		return true;
+#endif // CONFIG_MAVLINK_STREAM_SCHEDULER
+	}
+
 	float			get_baudrate() { return _baudrate; }
 
 	/* Functions for waiting to start transmission until message received. */
@@ -484,6 +531,9 @@ public:
 	/** close the Mavlink shell if it is open */
 	void			close_shell();
 
+	/** send pending output of the Mavlink shell */
+	void			send_shell_output(const hrt_abstime &t);
+
 	/** get ulog streaming if active, nullptr otherwise */
 	MavlinkULog		*get_ulog_streaming() { return _mavlink_ulog; }
 	void			try_start_ulog_streaming(uint8_t target_system, uint8_t target_component)
@@ -567,6 +617,14 @@ private:
 	List<MavlinkStream *>		_streams;
 
 	MavlinkShell		*_mavlink_shell{nullptr};
+#if defined(CONFIG_MAVLINK_SHELL_BATCHING)
+	static constexpr int SHELL_MAX_MESSAGES = 4; ///< max. number of shell output messages per iteration
+	static constexpr hrt_abstime SHELL_BATCH_TIMEOUT = 20_ms; ///< max. time to wait for a full message
+
+	hrt_abstime		_shell_pending_since{0};
+	hrt_abstime		_shell_last_update{0};
+	float			_shell_tokens{0.f};
+#endif // CONFIG_MAVLINK_SHELL_BATCHING
 	MavlinkULog		*_mavlink_ulog{nullptr};
 	static events::EventBuffer	*_event_buffer;
 	events::SendProtocol		_events{*_event_buffer, *this};
@@ -584,11 +642,16 @@ private:
 	int			_baudrate{57600};
 	int			_datarate{1000};		///< data rate for normal streams (attitude, position, etc.)
 	float			_rate_mult{1.0f};
+	float			_link_rate{1000.f};
 
 	bool			_radio_status_available{false};
 	bool			_radio_status_critical{false};
 	float			_radio_status_mult{1.0f};
 
+#if defined(CONFIG_MAVLINK_STREAM_SCHEDULER)
+	MavlinkStreamScheduler	_stream_scheduler {};
+#endif // CONFIG_MAVLINK_STREAM_SCHEDULER
+
 	/**
 	 * If the queue index is not at 0, the queue sending
 	 * logic will send parameters from the current index
@@ -631,9 +694,25 @@ private:
 	unsigned short		_remote_port{DEFAULT_REMOTE_PORT_UDP};
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_SHM)
+	MavlinkShm		_shm {};
+	const char		*_shm_name{nullptr};
+#endif // MAVLINK_SHM
+
 	uint8_t			_buf[MAVLINK_MAX_PACKET_LEN] {};
 	unsigned		_buf_fill{0};
 
+#if defined(MAVLINK_UDP_BATCHING)
+	static constexpr int	UDP_BATCH_SIZE{16};	///< max. number of datagrams per sendmmsg()
+
+	uint8_t			_udp_batch_buf[UDP_BATCH_SIZE][MAVLINK_MAX_PACKET_LEN] {};
+	sockaddr_in		_udp_batch_addr[UDP_BATCH_SIZE] {};
+	iovec			_udp_batch_iov[UDP_BATCH_SIZE] {};
+	mmsghdr			_udp_batch_msgs[UDP_BATCH_SIZE] {};
+	bool			_udp_batch_broadcast[UDP_BATCH_SIZE] {};	///< broadcast copies are not accounted in the tx stats
+	int			_udp_batch_count{0};
+#endif // MAVLINK_UDP_BATCHING
+
 	bool			_tx_buffer_low{false};
 
 	const char 		*_interface_name{nullptr};
@@ -665,6 +744,7 @@ private:
 		(ParamBool<px4::params::MAV_HB_FORW_EN>) _param_mav_hb_forw_en,
 		(ParamInt<px4::params::MAV_RADIO_TOUT>)      _param_mav_radio_timeout,
 		(ParamInt<px4::params::SYS_HITL>) _param_sys_hitl,
+		(ParamInt<px4::params::MAV_SHELL_RATE>) _param_mav_shell_rate,
 		(ParamBool<px4::params::SYS_FAILURE_EN>) _param_sys_failure_injection_enabled
 	)
 
@@ -672,6 +752,7 @@ private:
 	perf_counter_t _loop_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": tx run interval")};           /**< loop interval performance counter */
 	perf_counter_t _send_byte_error_perf{perf_alloc(PC_COUNT, MODULE_NAME": send_bytes error")};           /**< send bytes error count */
 	perf_counter_t _forwarding_error_perf{perf_alloc(PC_COUNT, MODULE_NAME": forwarding error")};           /**< forwarding messages error count */
+	perf_counter_t _events_lost_perf{perf_alloc(PC_COUNT, MODULE_NAME": events lost")};                    /**< events overwritten in the uORB queue */
 
 	void			mavlink_update_parameters();
 
@@ -720,9 +801,27 @@ private:
 	 */
 	void update_rate_mult();
 
+	/**
+	 * Update a single stream and track the first heartbeat.
+	 */
+	void update_stream(MavlinkStream *stream, const hrt_abstime &t);
+
 #if defined(MAVLINK_UDP)
 	void find_broadcast_address();
 
+# if defined(MAVLINK_UDP_BATCHING)
+	/**
+	 * Queue the packet in _buf for addr, flushes when the batch is full.
+	 * Must be called with _send_mutex held.
+	 */
+	void udp_batch_add(const sockaddr_in &addr, bool broadcast);
+
+	/**
+	 * Send all queued packets with sendmmsg(). Must be called with _send_mutex held.
+	 */
+	void udp_batch_flush();
+# endif // MAVLINK_UDP_BATCHING
+
 	void init_udp();
 #endif // MAVLINK_UDP
 
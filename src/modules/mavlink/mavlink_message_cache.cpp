@@ -0,0 +1,124 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file mavlink_message_cache.cpp
+ */
+
+#include "mavlink_message_cache.h"
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <containers/LockGuard.hpp>
+
+namespace
+{
+pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+struct {
+	uint32_t msgid;
+	ORB_ID orb_id;
+	uint8_t instance;
+	unsigned generation;
+	uint8_t len;
+	uint8_t payload[MavlinkMessageCache::MAX_PAYLOAD_LEN];
+} cache_entries[MavlinkMessageCache::NUM_ENTRIES] {};
+
+int cache_next_entry{0};
+uint32_t cache_hits{0};
+uint32_t cache_misses{0};
+}
+
+bool MavlinkMessageCache::get(uint32_t msgid, const uORB::Subscription &sub, unsigned generation, void *payload,
+			      size_t len)
+{
+	LockGuard lg{cache_mutex};
+
+	for (auto &entry : cache_entries) {
+		if ((entry.len == len) && (entry.msgid == msgid) && (entry.orb_id == sub.orb_id())
+		    && (entry.instance == sub.get_instance())) {
+
+			if (entry.generation == generation) {
+				memcpy(payload, entry.payload, len);
+				cache_hits++;
+				return true;
+			}
+
+			break;
+		}
+	}
+
+	cache_misses++;
+	return false;
+}
+
+void MavlinkMessageCache::put(uint32_t msgid, const uORB::Subscription &sub, unsigned generation, const void *payload,
+			      size_t len)
+{
+	LockGuard lg{cache_mutex};
+
+	int index = -1;
+
+	// one entry per message and topic instance, holding the latest sample
+	for (int i = 0; i < NUM_ENTRIES; i++) {
+		const auto &entry = cache_entries[i];
+
+		if ((entry.len == len) && (entry.msgid == msgid) && (entry.orb_id == sub.orb_id())
+		    && (entry.instance == sub.get_instance())) {
+			index = i;
+			break;
+		}
+	}
+
+	if (index < 0) {
+		index = cache_next_entry;
+		cache_next_entry = (cache_next_entry + 1) % NUM_ENTRIES;
+	}
+
+	auto &entry = cache_entries[index];
+	entry.msgid = msgid;
+	entry.orb_id = sub.orb_id();
+	entry.instance = sub.get_instance();
+	entry.generation = generation;
+	entry.len = len;
+	memcpy(entry.payload, payload, len);
+}
+
+void MavlinkMessageCache::print_status()
+{
+	LockGuard lg{cache_mutex};
+	printf("shared message cache: %" PRIu32 " hits, %" PRIu32 " misses\n", cache_hits, cache_misses);
+}
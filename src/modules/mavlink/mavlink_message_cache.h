@@ -0,0 +1,121 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file mavlink_message_cache.h
+ * Messages built from uORB samples, shared between all MAVLink instances.
+ *
+ * Streams like ATTITUDE are instantiated by every MAVLink instance, and each of them
+ * copied the same uORB sample and built the same message. With the cache the first
+ * instance seeing a sample builds the message payload, the others reuse it. Only the
+ * framing (sequence number, CRC, signing) is done per instance when sending.
+ *
+ * Entries are keyed by message id, topic instance and uORB generation of the sample,
+ * the sample is loaned instead of copied to find the generation.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <uORB/Subscription.hpp>
+
+class MavlinkMessageCache
+{
+public:
+	static constexpr size_t MAX_PAYLOAD_LEN{64};
+	static constexpr int NUM_ENTRIES{8};
+
+	/**
+	 * Get the message built from the next sample of a subscription.
+	 *
+	 * @param sub subscription of the sample the message is built from
+	 * @param msgid MAVLink message id of msg
+	 * @param msg the message, built with build(sample, msg) unless another instance already did
+	 * @param build callable building msg from a sample of type T
+	 * @return true if there was a new sample
+	 */
+	template<typename T, typename M, typename F>
+	static bool update(uORB::Subscription &sub, uint32_t msgid, M &msg, F build)
+	{
+		static_assert(sizeof(M) <= MAX_PAYLOAD_LEN, "message too large for the cache");
+
+		T sample;
+
+#if defined(CONFIG_MAVLINK_SHARED_MESSAGE_CACHE)
+
+		if (!sub.updated()) {
+			return false;
+		}
+
+		unsigned generation = 0;
+		const void *loaned = sub.loan(generation);
+
+		if (loaned != nullptr) {
+			if (get(msgid, sub, generation, &msg, sizeof(M))) {
+				return true;
+			}
+
+			memcpy(&sample, loaned, sizeof(T));
+
+			if (!sub.loan_valid(generation)) {
+				// overwritten while copying, build from the latest sample without sharing it
+				sub.copy(&sample);
+				build(sample, msg);
+				return true;
+			}
+
+			build(sample, msg);
+			put(msgid, sub, generation, &msg, sizeof(M));
+			return true;
+		}
+
+		// loans are not available (protected build)
+#endif // CONFIG_MAVLINK_SHARED_MESSAGE_CACHE
+
+		if (sub.update(&sample)) {
+			build(sample, msg);
+			return true;
+		}
+
+		return false;
+	}
+
+	static void print_status();
+
+private:
+	static bool get(uint32_t msgid, const uORB::Subscription &sub, unsigned generation, void *payload, size_t len);
+	static void put(uint32_t msgid, const uORB::Subscription &sub, unsigned generation, const void *payload, size_t len);
+};
@@ -42,6 +42,7 @@
 #include "mavlink_main.h"
 #include "mavlink_messages.h"
 #include "mavlink_command_sender.h"
+#include "mavlink_message_cache.h"
 #include "mavlink_simple_analyzer.h"
 
 #include <drivers/drv_pwm_output.h>
@@ -114,6 +115,7 @@
 #include "streams/STORAGE_INFORMATION.hpp"
 #include "streams/SYS_STATUS.hpp"
 #include "streams/SYSTEM_TIME.hpp"
+#include "streams/TERRAIN_REQUEST.hpp"
 #include "streams/TIME_ESTIMATE_TO_TARGET.hpp"
 #include "streams/TIMESYNC.hpp"
 #include "streams/TRAJECTORY_REPRESENTATION_WAYPOINTS.hpp"
@@ -313,6 +315,9 @@ static const StreamListItem streams_list[] = {
 #if defined(TIMESYNC_HPP)
 	create_stream_list_item<MavlinkStreamTimesync>(),
 #endif // TIMESYNC_HPP
+#if defined(TERRAIN_REQUEST_HPP)
+	create_stream_list_item<MavlinkStreamTerrainRequest>(),
+#endif // TERRAIN_REQUEST_HPP
 #if defined(GLOBAL_POSITION_INT_HPP)
 	create_stream_list_item<MavlinkStreamGlobalPositionInt>(),
 #endif // GLOBAL_POSITION_INT_HPP
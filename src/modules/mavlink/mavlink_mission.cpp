@@ -533,7 +533,19 @@ MavlinkMissionManager::send()
 	    && hrt_elapsed_time(&_time_last_sent) > MAVLINK_MISSION_RETRY_TIMEOUT_DEFAULT) {
 
 		// try to request item again after timeout
-		send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+
+		// no progress since the last retry: the partner does not answer queued requests,
+		// fall back to one request at a time
+		if (_transfer_pipelined && _transfer_retry_seq == _transfer_seq) {
+			PX4_DEBUG("WPM: no progress with pipelined requests, falling back to single requests");
+			_transfer_pipelined = false;
+		}
+
+		_transfer_retry_seq = _transfer_seq;
+		_transfer_requested = _transfer_seq;
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
+		request_next_items();
 
 	} else if (_state != MAVLINK_WPM_STATE_IDLE && (_time_last_recv > 0)
 		   && hrt_elapsed_time(&_time_last_recv) > MAVLINK_MISSION_PROTOCOL_TIMEOUT_DEFAULT) {
@@ -554,6 +566,23 @@ MavlinkMissionManager::send()
 		_time_last_sent = 0;
 		_time_last_recv = 0;
 	}
+
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+
+	// write the received items in the background
+	if (_state == MAVLINK_WPM_STATE_GETLIST && !flush_write_queue(PIPELINE_WINDOW)) {
+		PX4_DEBUG("WPM: MISSION_ITEM ERROR: error writing to dataman ID %i", _transfer_dataman_id);
+
+		send_mission_ack(_transfer_partner_sysid, _transfer_partner_compid, MAV_MISSION_ERROR);
+		_mavlink->send_statustext_critical("Unable to write on micro SD\t");
+		events::send(events::ID("mavlink_mission_storage_failure_async"), events::Log::Error,
+			     "Mission: unable to write to storage");
+
+		switch_to_idle_state();
+		_transfer_in_progress = false;
+	}
+
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
 }
 
 void
@@ -943,6 +972,10 @@ MavlinkMissionManager::handle_mission_count(const mavlink_message_t *msg)
 			_transfer_current_seq = -1;
 			_transfer_land_start_marker = -1;
 			_transfer_land_marker = -1;
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+			_transfer_retry_seq = -1;
+			_transfer_pipelined = true;
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
 
 		} else if (_state == MAVLINK_WPM_STATE_GETLIST) {
 			_time_last_recv = hrt_absolute_time();
@@ -972,14 +1005,123 @@ MavlinkMissionManager::handle_mission_count(const mavlink_message_t *msg)
 			return;
 		}
 
-		send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+		// (re)start the requests from the first item
+		_transfer_requested = _transfer_seq;
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
+		request_next_items();
 	}
 }
 
+void
+MavlinkMissionManager::request_next_items()
+{
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+	const uint16_t window = _transfer_pipelined ? PIPELINE_WINDOW : 1;
+
+	// requests for items before _transfer_requested are still in flight
+	_transfer_requested = math::max(_transfer_requested, _transfer_seq);
+
+	while (_transfer_requested < _transfer_count && _transfer_requested < _transfer_seq + window) {
+		send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_requested++);
+	}
+
+#else
+	send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
+}
+
+bool
+MavlinkMissionManager::write_transfer_item(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length,
+		hrt_abstime timeout)
+{
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+
+	if (length > sizeof(PendingWrite::data) || !flush_write_queue(PIPELINE_WINDOW - 1)) {
+		return false;
+	}
+
+	PendingWrite &write = _write_queue[(_write_queue_first + _write_queue_count) % PIPELINE_WINDOW];
+	write.item = item;
+	write.index = index;
+	write.length = length;
+	memcpy(write.data, buffer, length);
+	_write_queue_count++;
+
+	// start the write right away if dataman is idle
+	return flush_write_queue(PIPELINE_WINDOW);
+#else
+	return _dataman_client.writeSync(item, index, buffer, length, timeout);
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
+}
+
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+bool
+MavlinkMissionManager::flush_write_queue(uint16_t max_pending)
+{
+	while (!_write_failed) {
+		if (_write_active) {
+			_dataman_client.update();
+
+			bool success = false;
+
+			if (_dataman_client.lastOperationCompleted(success)) {
+				_write_active = false;
+				_write_queue_first = (_write_queue_first + 1) % PIPELINE_WINDOW;
+				_write_queue_count--;
+
+				if (!success) {
+					_write_failed = true;
+					break;
+				}
+
+			} else if (hrt_elapsed_time(&_write_start) > WRITE_TIMEOUT) {
+				_dataman_client.abortCurrentOperation();
+				_write_active = false;
+				_write_failed = true;
+				break;
+			}
+		}
+
+		if (!_write_active && _write_queue_count > 0) {
+			PendingWrite &write = _write_queue[_write_queue_first];
+			_write_active = _dataman_client.writeAsync(write.item, write.index, write.data, write.length);
+			_write_start = hrt_absolute_time();
+
+			if (!_write_active) {
+				_write_failed = true;
+				break;
+			}
+		}
+
+		if (_write_queue_count <= max_pending) {
+			break;
+		}
+
+		px4_usleep(1000);
+	}
+
+	return !_write_failed;
+}
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
+
 void
 MavlinkMissionManager::switch_to_idle_state()
 {
 	_state = MAVLINK_WPM_STATE_IDLE;
+
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+
+	// drop the writes of an aborted transfer
+	if (_write_active) {
+		_dataman_client.abortCurrentOperation();
+	}
+
+	_write_queue_first = 0;
+	_write_queue_count = 0;
+	_write_active = false;
+	_write_failed = false;
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
 }
 
 
@@ -1096,8 +1238,8 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 
 				} else {
 
-					write_failed = !_dataman_client.writeSync(_transfer_dataman_id, wp.seq, reinterpret_cast<uint8_t *>(&mission_item),
-							sizeof(struct mission_item_s));
+					write_failed = !write_transfer_item(_transfer_dataman_id, wp.seq, reinterpret_cast<uint8_t *>(&mission_item),
+									    sizeof(struct mission_item_s));
 
 					// Check for land start marker
 					if ((mission_item.nav_cmd == MAV_CMD_DO_LAND_START) && (_transfer_land_start_marker == -1)) {
@@ -1148,16 +1290,16 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 				mission_fence_point.frame = mission_item.frame;
 
 				if (!check_failed) {
-					write_failed = !_dataman_client.writeSync(DM_KEY_FENCE_POINTS, wp.seq + 1,
-							reinterpret_cast<uint8_t *>(&mission_fence_point), sizeof(mission_fence_point_s));
+					write_failed = !write_transfer_item(DM_KEY_FENCE_POINTS, wp.seq + 1,
+									    reinterpret_cast<uint8_t *>(&mission_fence_point), sizeof(mission_fence_point_s));
 				}
 
 			}
 			break;
 
 		case MAV_MISSION_TYPE_RALLY: { // Write a safe point / rally point
-				write_failed = !_dataman_client.writeSync(DM_KEY_SAFE_POINTS, wp.seq + 1,
-						reinterpret_cast<uint8_t *>(&mission_item), sizeof(mission_item_s), 2_s);
+				write_failed = !write_transfer_item(DM_KEY_SAFE_POINTS, wp.seq + 1,
+								    reinterpret_cast<uint8_t *>(&mission_item), sizeof(mission_item_s), 2_s);
 			}
 			break;
 
@@ -1168,6 +1310,15 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 			break;
 		}
 
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+
+		// all items have to be stored before the transfer completes
+		if (!write_failed && !check_failed && wp.seq + 1 == _transfer_count) {
+			write_failed = !flush_write_queue(0);
+		}
+
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
+
 		if (write_failed || check_failed) {
 			PX4_DEBUG("WPM: MISSION_ITEM ERROR: error writing seq %u to dataman ID %i", wp.seq, _transfer_dataman_id);
 
@@ -1234,8 +1385,8 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 			_transfer_in_progress = false;
 
 		} else {
-			/* request next item */
-			send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
+			/* request next item(s) */
+			request_next_items();
 		}
 	}
 }
@@ -132,6 +132,29 @@ private:
 
 	static bool		_transfer_in_progress;			///< Global variable checking for current transmission
 
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+	static constexpr uint16_t PIPELINE_WINDOW = CONFIG_MAVLINK_MISSION_PIPELINE_WINDOW; ///< item requests in flight
+	static constexpr hrt_abstime WRITE_TIMEOUT = 2_s; ///< max. time for a queued dataman write
+
+	uint16_t		_transfer_requested{0};			///< Next item sequence to request in current transmission
+	int32_t			_transfer_retry_seq{-1};		///< Item sequence of the last retry (-1 means none)
+	bool			_transfer_pipelined{false};		///< Several requests in flight for current transmission
+
+	struct PendingWrite {
+		dm_item_t item;
+		uint32_t index;
+		uint32_t length;
+		uint8_t data[sizeof(mission_item_s)];
+	};
+
+	PendingWrite		_write_queue[PIPELINE_WINDOW] {};	///< Received items waiting to be written to dataman
+	uint16_t		_write_queue_first{0};
+	uint16_t		_write_queue_count{0};
+	bool			_write_active{false};			///< First queued item is being written
+	bool			_write_failed{false};
+	hrt_abstime		_write_start{0};
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
+
 	uORB::Subscription	_mission_result_sub{ORB_ID(mission_result)};
 	uORB::SubscriptionData<mission_s> 	_mission_sub{ORB_ID(mission)};
 
@@ -206,6 +229,29 @@ private:
 
 	void send_mission_request(uint8_t sysid, uint8_t compid, uint16_t seq);
 
+	/**
+	 * Request the next items from the transfer partner. With CONFIG_MAVLINK_MISSION_PIPELINE
+	 * up to PIPELINE_WINDOW requests are kept in flight, otherwise only the next item is requested.
+	 */
+	void request_next_items();
+
+	/**
+	 * Store a received item of the current transmission in dataman. With CONFIG_MAVLINK_MISSION_PIPELINE
+	 * the item is queued and written asynchronously.
+	 * @return false if the write (or an earlier queued write) failed
+	 */
+	bool write_transfer_item(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length,
+				 hrt_abstime timeout = 1000_ms);
+
+#if defined(CONFIG_MAVLINK_MISSION_PIPELINE)
+	/**
+	 * Advance the queued dataman writes.
+	 * @param max_pending wait until at most this many writes are queued
+	 * @return false if a write failed or timed out
+	 */
+	bool flush_write_queue(uint16_t max_pending);
+#endif // CONFIG_MAVLINK_MISSION_PIPELINE
+
 	/**
 	 *  @brief emits a message that a waypoint reached
 	 *
@@ -0,0 +1,176 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_param_snapshot.cpp
+ * Parameter snapshot files served over MAVLink FTP.
+ */
+
+#include "mavlink_param_snapshot.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <parameters/param.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/posix.h>
+
+constexpr const char MavlinkParamSnapshot::FTP_DIR[];
+constexpr const char MavlinkParamSnapshot::FTP_PARAMS_FILE[];
+constexpr const char MavlinkParamSnapshot::FTP_GROUP_HASHES_FILE[];
+
+static constexpr uint32_t FNV1A_OFFSET = 2166136261u;
+static constexpr uint32_t FNV1A_PRIME = 16777619u;
+
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *bytes = static_cast<const uint8_t *>(data);
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ bytes[i]) * FNV1A_PRIME;
+	}
+
+	return hash;
+}
+
+bool
+MavlinkParamSnapshot::is_snapshot_path(const char *ftp_path)
+{
+	return strncmp(ftp_path, FTP_DIR, sizeof(FTP_DIR) - 1) == 0;
+}
+
+int
+MavlinkParamSnapshot::generate(const char *ftp_path, char *path, size_t path_len)
+{
+	const char *name = ftp_path + sizeof(FTP_DIR) - 1;
+
+	if (strcmp(name, FTP_PARAMS_FILE) == 0) {
+		snprintf(path, path_len, PX4_STORAGEDIR "/.mavlink_%s", FTP_PARAMS_FILE);
+		return write_params(path);
+
+	} else if (strcmp(name, FTP_GROUP_HASHES_FILE) == 0) {
+		snprintf(path, path_len, PX4_STORAGEDIR "/.mavlink_%s", FTP_GROUP_HASHES_FILE);
+		return write_group_hashes(path);
+	}
+
+	return PX4_ERROR;
+}
+
+int
+MavlinkParamSnapshot::write_params(const char *path)
+{
+	// create and truncate the file first: param_export() falls back to
+	// saving to flash if it cannot open the file
+	int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		PX4_ERR("param snapshot open failed (%i)", errno);
+		return PX4_ERROR;
+	}
+
+	::close(fd);
+
+	return param_export(path, nullptr) == 0 ? PX4_OK : PX4_ERROR;
+}
+
+int
+MavlinkParamSnapshot::write_group_hashes(const char *path)
+{
+	FILE *file = fopen(path, "w");
+
+	if (file == nullptr) {
+		PX4_ERR("param snapshot open failed (%i)", errno);
+		return PX4_ERROR;
+	}
+
+	const unsigned count = param_count_used();
+	fprintf(file, "_HASH_CHECK,%u,%08" PRIx32 "\n", count, param_hash_check());
+
+	// used parameters are sorted by name, so each group is a contiguous range
+	char group[17] {};
+	unsigned group_count = 0;
+	uint32_t group_hash = FNV1A_OFFSET;
+
+	for (unsigned i = 0; i < count; i++) {
+		const param_t param = param_for_used_index(i);
+		const char *name = param_name(param);
+
+		if (name == nullptr) {
+			continue;
+		}
+
+		const char *separator = strchr(name, '_');
+		const size_t prefix_len = (separator != nullptr) ? (size_t)(separator - name) : strlen(name);
+
+		if ((group_count > 0) && ((strlen(group) != prefix_len) || (strncmp(name, group, prefix_len) != 0))) {
+			fprintf(file, "%s,%u,%08" PRIx32 "\n", group, group_count, group_hash);
+			group_count = 0;
+			group_hash = FNV1A_OFFSET;
+		}
+
+		if (group_count == 0) {
+			const size_t len = (prefix_len < sizeof(group) - 1) ? prefix_len : sizeof(group) - 1;
+			memcpy(group, name, len);
+			group[len] = '\0';
+		}
+
+		// hash the raw 4 byte value of either type
+		int32_t value = 0;
+
+		if (param_type(param) == PARAM_TYPE_FLOAT) {
+			float value_float = 0.f;
+			param_get(param, &value_float);
+			memcpy(&value, &value_float, sizeof(value));
+
+		} else {
+			param_get(param, &value);
+		}
+
+		group_hash = fnv1a(group_hash, name, strlen(name));
+		group_hash = fnv1a(group_hash, &value, sizeof(value));
+		group_count++;
+	}
+
+	if (group_count > 0) {
+		fprintf(file, "%s,%u,%08" PRIx32 "\n", group, group_count, group_hash);
+	}
+
+	const bool failed = ferror(file);
+	fclose(file);
+
+	return failed ? PX4_ERROR : PX4_OK;
+}
@@ -0,0 +1,81 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_param_snapshot.h
+ * Parameter snapshot files served over MAVLink FTP for fast GCS parameter sync.
+ *
+ * A GCS downloads the small group hash file on connect and compares it against
+ * its cache. Only if a group changed it needs the BSON file with all non-default
+ * values (or the individual groups via PARAM_REQUEST_READ), instead of a full
+ * PARAM_REQUEST_LIST.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+class MavlinkParamSnapshot
+{
+public:
+	static constexpr const char FTP_DIR[] = "@PARAM/";
+
+	/** BSON document of all parameters not at their default value (same format as the parameter file) */
+	static constexpr const char FTP_PARAMS_FILE[] = "params.bson";
+
+	/**
+	 * One line "<group>,<used params>,<hash>" (hash as 8 hex digits) per parameter group, groups
+	 * are the name prefix up to the first '_'. The hash covers the names and current values of all
+	 * used parameters of the group. The first line holds the overall _HASH_CHECK value.
+	 */
+	static constexpr const char FTP_GROUP_HASHES_FILE[] = "hashes.csv";
+
+	/**
+	 * @return true if the FTP path refers to a virtual parameter snapshot file
+	 */
+	static bool is_snapshot_path(const char *ftp_path);
+
+	/**
+	 * Generate the snapshot file requested by ftp_path.
+	 *
+	 * @param ftp_path FTP path starting with FTP_DIR
+	 * @param path buffer for the path of the generated file
+	 * @param path_len size of path
+	 * @return PX4_OK on success, PX4_ERROR otherwise
+	 */
+	static int generate(const char *ftp_path, char *path, size_t path_len);
+
+private:
+	static int write_params(const char *path);
+	static int write_group_hashes(const char *path);
+};
@@ -331,7 +331,7 @@ MavlinkParametersManager::send()
 
 	// Send while burst is not exceeded, we still have buffer space and still something to send
 	while ((i++ < max_num_to_send) && (_mavlink->get_free_tx_buf() >= get_size()) && !_mavlink->radio_status_critical()
-	       && send_params()) {}
+	       && _mavlink->tx_allowed(MavlinkStream::Priority::Bulk, get_size()) && send_params()) {}
 }
 
 bool
@@ -155,3 +155,48 @@ PARAM_DEFINE_INT32(MAV_HB_FORW_EN, 1);
  * @max 250
  */
 PARAM_DEFINE_INT32(MAV_RADIO_TOUT, 5);
+
+/**
+ * HIGH_LATENCY2 link share
+ *
+ * Fraction of the usable link bandwidth (data rate scaled by RADIO_STATUS and
+ * TX error feedback) HIGH_LATENCY2 may use. If the configured stream rate does
+ * not fit, the message is downsampled further and the averages, minima and maxima
+ * cover the longer interval. Only used with CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY,
+ * 0 to disable.
+ *
+ * @group MAVLink
+ * @min 0
+ * @max 1
+ * @decimal 2
+ */
+PARAM_DEFINE_FLOAT(MAV_HL_SHARE, 0.f);
+
+/**
+ * HIGH_LATENCY2 keepalive interval
+ *
+ * A HIGH_LATENCY2 message that did not change since the last transmission
+ * (apart from its timestamp) is not sent, until this time passed. Only used
+ * with CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY, 0 to always send.
+ *
+ * @group MAVLink
+ * @unit s
+ * @min 0
+ * @max 3600
+ */
+PARAM_DEFINE_INT32(MAV_HL_KEEPALIVE, 0);
+
+/**
+ * MAVLink shell output rate
+ *
+ * Maximum data rate of the MAVLink shell output (SERIAL_CONTROL). Output
+ * exceeding it stays in the shell pipe and throttles the shell, so e.g. top
+ * cannot take the bandwidth of the telemetry streams. Only used with
+ * CONFIG_MAVLINK_SHELL_BATCHING, 0 for no limit.
+ *
+ * @group MAVLink
+ * @unit B/s
+ * @min 0
+ * @max 100000
+ */
+PARAM_DEFINE_INT32(MAV_SHELL_RATE, 0);
@@ -72,6 +72,9 @@
 MavlinkReceiver::~MavlinkReceiver()
 {
 	delete _tune_publisher;
+#if defined(CONFIG_MAVLINK_RTCM_REASSEMBLY)
+	delete _rtcm_reassembler;
+#endif // CONFIG_MAVLINK_RTCM_REASSEMBLY
 	delete _px4_accel;
 	delete _px4_gyro;
 	delete _px4_mag;
@@ -132,210 +135,114 @@ MavlinkReceiver::acknowledge(uint8_t sysid, uint8_t compid, uint16_t command, ui
 	_cmd_ack_pub.publish(command_ack);
 }
 
-void
-MavlinkReceiver::handle_message(mavlink_message_t *msg)
+namespace
 {
-	switch (msg->msgid) {
-	case MAVLINK_MSG_ID_COMMAND_LONG:
-		handle_message_command_long(msg);
-		break;
-
-	case MAVLINK_MSG_ID_COMMAND_INT:
-		handle_message_command_int(msg);
-		break;
-
-	case MAVLINK_MSG_ID_COMMAND_ACK:
-		handle_message_command_ack(msg);
-		break;
-
-	case MAVLINK_MSG_ID_OPTICAL_FLOW_RAD:
-		handle_message_optical_flow_rad(msg);
-		break;
-
-	case MAVLINK_MSG_ID_PING:
-		handle_message_ping(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_MODE:
-		handle_message_set_mode(msg);
-		break;
-
-	case MAVLINK_MSG_ID_ATT_POS_MOCAP:
-		handle_message_att_pos_mocap(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED:
-		handle_message_set_position_target_local_ned(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT:
-		handle_message_set_position_target_global_int(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_ATTITUDE_TARGET:
-		handle_message_set_attitude_target(msg);
-		break;
-
-	case MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE:
-		handle_message_vision_position_estimate(msg);
-		break;
-
-	case MAVLINK_MSG_ID_ODOMETRY:
-		handle_message_odometry(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SET_GPS_GLOBAL_ORIGIN:
-		handle_message_set_gps_global_origin(msg);
-		break;
-
-	case MAVLINK_MSG_ID_RADIO_STATUS:
-		handle_message_radio_status(msg);
-		break;
-
-	case MAVLINK_MSG_ID_MANUAL_CONTROL:
-		handle_message_manual_control(msg);
-		break;
-
-	case MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE:
-		handle_message_rc_channels_override(msg);
-		break;
-
-	case MAVLINK_MSG_ID_HEARTBEAT:
-		handle_message_heartbeat(msg);
-		break;
-
-	case MAVLINK_MSG_ID_DISTANCE_SENSOR:
-		handle_message_distance_sensor(msg);
-		break;
-
-	case MAVLINK_MSG_ID_FOLLOW_TARGET:
-		handle_message_follow_target(msg);
-		break;
-
-	case MAVLINK_MSG_ID_LANDING_TARGET:
-		handle_message_landing_target(msg);
-		break;
-
-	case MAVLINK_MSG_ID_CELLULAR_STATUS:
-		handle_message_cellular_status(msg);
-		break;
-
-	case MAVLINK_MSG_ID_ADSB_VEHICLE:
-		handle_message_adsb_vehicle(msg);
-		break;
-
-	case MAVLINK_MSG_ID_UTM_GLOBAL_POSITION:
-		handle_message_utm_global_position(msg);
-		break;
-
-	case MAVLINK_MSG_ID_COLLISION:
-		handle_message_collision(msg);
-		break;
-
-	case MAVLINK_MSG_ID_GPS_RTCM_DATA:
-		handle_message_gps_rtcm_data(msg);
-		break;
-
-	case MAVLINK_MSG_ID_BATTERY_STATUS:
-		handle_message_battery_status(msg);
-		break;
-
-	case MAVLINK_MSG_ID_SERIAL_CONTROL:
-		handle_message_serial_control(msg);
-		break;
-
-	case MAVLINK_MSG_ID_LOGGING_ACK:
-		handle_message_logging_ack(msg);
-		break;
-
-	case MAVLINK_MSG_ID_PLAY_TUNE:
-		handle_message_play_tune(msg);
-		break;
+template<uint32_t MAX_ID>
+struct MessageIndex {
+	uint8_t handler[MAX_ID + 1]; ///< index into the handler table, UINT8_MAX if there is none
+};
 
-	case MAVLINK_MSG_ID_PLAY_TUNE_V2:
-		handle_message_play_tune_v2(msg);
-		break;
+template<typename T, size_t N>
+constexpr uint32_t max_message_id(const T(&handlers)[N])
+{
+	uint32_t max_id = 0;
 
-	case MAVLINK_MSG_ID_OBSTACLE_DISTANCE:
-		handle_message_obstacle_distance(msg);
-		break;
+	for (size_t i = 0; i < N; i++) {
+		if (handlers[i].msgid > max_id) {
+			max_id = handlers[i].msgid;
+		}
+	}
 
-	case MAVLINK_MSG_ID_TUNNEL:
-		handle_message_tunnel(msg);
-		break;
+	return max_id;
+}
 
-	case MAVLINK_MSG_ID_TRAJECTORY_REPRESENTATION_BEZIER:
-		handle_message_trajectory_representation_bezier(msg);
-		break;
+template<uint32_t MAX_ID, typename T, size_t N>
+constexpr MessageIndex<MAX_ID> build_message_index(const T(&handlers)[N])
+{
+	static_assert(N < UINT8_MAX, "too many message handlers");
 
-	case MAVLINK_MSG_ID_TRAJECTORY_REPRESENTATION_WAYPOINTS:
-		handle_message_trajectory_representation_waypoints(msg);
-		break;
+	MessageIndex<MAX_ID> index{};
 
-	case MAVLINK_MSG_ID_ONBOARD_COMPUTER_STATUS:
-		handle_message_onboard_computer_status(msg);
-		break;
+	for (auto &handler : index.handler) {
+		handler = UINT8_MAX;
+	}
 
-	case MAVLINK_MSG_ID_GENERATOR_STATUS:
-		handle_message_generator_status(msg);
-		break;
+	for (size_t i = 0; i < N; i++) {
+		index.handler[handlers[i].msgid] = static_cast<uint8_t>(i);
+	}
 
-	case MAVLINK_MSG_ID_STATUSTEXT:
-		handle_message_statustext(msg);
-		break;
+	return index;
+}
+} // namespace
 
+void
+MavlinkReceiver::handle_message(mavlink_message_t *msg)
+{
+	// message id -> handler, resolved at compile time into a flat lookup table
+	static constexpr MessageHandler handlers[] {
+		{MAVLINK_MSG_ID_COMMAND_LONG, &MavlinkReceiver::handle_message_command_long},
+		{MAVLINK_MSG_ID_COMMAND_INT, &MavlinkReceiver::handle_message_command_int},
+		{MAVLINK_MSG_ID_COMMAND_ACK, &MavlinkReceiver::handle_message_command_ack},
+		{MAVLINK_MSG_ID_OPTICAL_FLOW_RAD, &MavlinkReceiver::handle_message_optical_flow_rad},
+		{MAVLINK_MSG_ID_PING, &MavlinkReceiver::handle_message_ping},
+		{MAVLINK_MSG_ID_SET_MODE, &MavlinkReceiver::handle_message_set_mode},
+		{MAVLINK_MSG_ID_ATT_POS_MOCAP, &MavlinkReceiver::handle_message_att_pos_mocap},
+		{MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED, &MavlinkReceiver::handle_message_set_position_target_local_ned},
+		{MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT, &MavlinkReceiver::handle_message_set_position_target_global_int},
+		{MAVLINK_MSG_ID_SET_ATTITUDE_TARGET, &MavlinkReceiver::handle_message_set_attitude_target},
+		{MAVLINK_MSG_ID_VISION_POSITION_ESTIMATE, &MavlinkReceiver::handle_message_vision_position_estimate},
+		{MAVLINK_MSG_ID_ODOMETRY, &MavlinkReceiver::handle_message_odometry},
+		{MAVLINK_MSG_ID_SET_GPS_GLOBAL_ORIGIN, &MavlinkReceiver::handle_message_set_gps_global_origin},
+		{MAVLINK_MSG_ID_RADIO_STATUS, &MavlinkReceiver::handle_message_radio_status},
+		{MAVLINK_MSG_ID_MANUAL_CONTROL, &MavlinkReceiver::handle_message_manual_control},
+		{MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE, &MavlinkReceiver::handle_message_rc_channels_override},
+		{MAVLINK_MSG_ID_HEARTBEAT, &MavlinkReceiver::handle_message_heartbeat},
+		{MAVLINK_MSG_ID_DISTANCE_SENSOR, &MavlinkReceiver::handle_message_distance_sensor},
+		{MAVLINK_MSG_ID_FOLLOW_TARGET, &MavlinkReceiver::handle_message_follow_target},
+		{MAVLINK_MSG_ID_LANDING_TARGET, &MavlinkReceiver::handle_message_landing_target},
+		{MAVLINK_MSG_ID_CELLULAR_STATUS, &MavlinkReceiver::handle_message_cellular_status},
+		{MAVLINK_MSG_ID_ADSB_VEHICLE, &MavlinkReceiver::handle_message_adsb_vehicle},
+		{MAVLINK_MSG_ID_UTM_GLOBAL_POSITION, &MavlinkReceiver::handle_message_utm_global_position},
+		{MAVLINK_MSG_ID_COLLISION, &MavlinkReceiver::handle_message_collision},
+		{MAVLINK_MSG_ID_GPS_RTCM_DATA, &MavlinkReceiver::handle_message_gps_rtcm_data},
+		{MAVLINK_MSG_ID_TERRAIN_DATA, &MavlinkReceiver::handle_message_terrain_data},
+		{MAVLINK_MSG_ID_BATTERY_STATUS, &MavlinkReceiver::handle_message_battery_status},
+		{MAVLINK_MSG_ID_SERIAL_CONTROL, &MavlinkReceiver::handle_message_serial_control},
+		{MAVLINK_MSG_ID_LOGGING_ACK, &MavlinkReceiver::handle_message_logging_ack},
+		{MAVLINK_MSG_ID_PLAY_TUNE, &MavlinkReceiver::handle_message_play_tune},
+		{MAVLINK_MSG_ID_PLAY_TUNE_V2, &MavlinkReceiver::handle_message_play_tune_v2},
+		{MAVLINK_MSG_ID_OBSTACLE_DISTANCE, &MavlinkReceiver::handle_message_obstacle_distance},
+		{MAVLINK_MSG_ID_TUNNEL, &MavlinkReceiver::handle_message_tunnel},
+		{MAVLINK_MSG_ID_TRAJECTORY_REPRESENTATION_BEZIER, &MavlinkReceiver::handle_message_trajectory_representation_bezier},
+		{MAVLINK_MSG_ID_TRAJECTORY_REPRESENTATION_WAYPOINTS, &MavlinkReceiver::handle_message_trajectory_representation_waypoints},
+		{MAVLINK_MSG_ID_ONBOARD_COMPUTER_STATUS, &MavlinkReceiver::handle_message_onboard_computer_status},
+		{MAVLINK_MSG_ID_GENERATOR_STATUS, &MavlinkReceiver::handle_message_generator_status},
+		{MAVLINK_MSG_ID_STATUSTEXT, &MavlinkReceiver::handle_message_statustext},
 #if !defined(CONSTRAINED_FLASH)
-
-	case MAVLINK_MSG_ID_NAMED_VALUE_FLOAT:
-		handle_message_named_value_float(msg);
-		break;
-
-	case MAVLINK_MSG_ID_NAMED_VALUE_INT:
-		handle_message_named_value_int(msg);
-		break;
-
-	case MAVLINK_MSG_ID_DEBUG:
-		handle_message_debug(msg);
-		break;
-
-	case MAVLINK_MSG_ID_DEBUG_VECT:
-		handle_message_debug_vect(msg);
-		break;
-
-	case MAVLINK_MSG_ID_DEBUG_FLOAT_ARRAY:
-		handle_message_debug_float_array(msg);
-		break;
+		{MAVLINK_MSG_ID_NAMED_VALUE_FLOAT, &MavlinkReceiver::handle_message_named_value_float},
+		{MAVLINK_MSG_ID_NAMED_VALUE_INT, &MavlinkReceiver::handle_message_named_value_int},
+		{MAVLINK_MSG_ID_DEBUG, &MavlinkReceiver::handle_message_debug},
+		{MAVLINK_MSG_ID_DEBUG_VECT, &MavlinkReceiver::handle_message_debug_vect},
+		{MAVLINK_MSG_ID_DEBUG_FLOAT_ARRAY, &MavlinkReceiver::handle_message_debug_float_array},
 #endif // !CONSTRAINED_FLASH
-
-	case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE:
-		handle_message_gimbal_manager_set_attitude(msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL:
-		handle_message_gimbal_manager_set_manual_control(msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_DEVICE_INFORMATION:
-		handle_message_gimbal_device_information(msg);
-		break;
-
-	case MAVLINK_MSG_ID_REQUEST_EVENT:
-		handle_message_request_event(msg);
-		break;
-
-	case MAVLINK_MSG_ID_GIMBAL_DEVICE_ATTITUDE_STATUS:
-		handle_message_gimbal_device_attitude_status(msg);
-		break;
-
+		{MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_ATTITUDE, &MavlinkReceiver::handle_message_gimbal_manager_set_attitude},
+		{MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL, &MavlinkReceiver::handle_message_gimbal_manager_set_manual_control},
+		{MAVLINK_MSG_ID_GIMBAL_DEVICE_INFORMATION, &MavlinkReceiver::handle_message_gimbal_device_information},
+		{MAVLINK_MSG_ID_REQUEST_EVENT, &MavlinkReceiver::handle_message_request_event},
+		{MAVLINK_MSG_ID_GIMBAL_DEVICE_ATTITUDE_STATUS, &MavlinkReceiver::handle_message_gimbal_device_attitude_status},
 #if defined(MAVLINK_MSG_ID_SET_VELOCITY_LIMITS) // For now only defined if development.xml is used
-
-	case MAVLINK_MSG_ID_SET_VELOCITY_LIMITS:
-		handle_message_set_velocity_limits(msg);
-		break;
+		{MAVLINK_MSG_ID_SET_VELOCITY_LIMITS, &MavlinkReceiver::handle_message_set_velocity_limits},
 #endif
+	};
 
-	default:
-		break;
+	static constexpr auto index = build_message_index<max_message_id(handlers)>(handlers);
+
+	if (msg->msgid < sizeof(index.handler)) {
+		const uint8_t i = index.handler[msg->msgid];
+
+		if (i != UINT8_MAX) {
+			(this->*handlers[i].handle)(msg);
+		}
 	}
 
 	/*
@@ -1069,6 +976,7 @@ MavlinkReceiver::handle_message_set_position_target_local_ned(mavlink_message_t
 			if (vehicle_status.nav_state == vehicle_status_s::NAVIGATION_STATE_OFFBOARD) {
 				// only publish setpoint once in OFFBOARD
 				setpoint.timestamp = hrt_absolute_time();
+				setpoint.timestamp_sample = sync_setpoint_stamp(target_local_ned.time_boot_ms, setpoint.timestamp);
 				_trajectory_setpoint_pub.publish(setpoint);
 			}
 
@@ -1191,6 +1099,7 @@ MavlinkReceiver::handle_message_set_position_target_global_int(mavlink_message_t
 			if (vehicle_status.nav_state == vehicle_status_s::NAVIGATION_STATE_OFFBOARD) {
 				// only publish setpoint once in OFFBOARD
 				setpoint.timestamp = hrt_absolute_time();
+				setpoint.timestamp_sample = sync_setpoint_stamp(target_global_int.time_boot_ms, setpoint.timestamp);
 				_trajectory_setpoint_pub.publish(setpoint);
 			}
 		}
@@ -1489,6 +1398,16 @@ MavlinkReceiver::handle_message_odometry(mavlink_message_t *msg)
 	}
 }
 
+hrt_abstime MavlinkReceiver::sync_setpoint_stamp(uint32_t time_boot_ms, hrt_abstime now)
+{
+	if (time_boot_ms == 0) {
+		return now;
+	}
+
+	// sync_stamp() returns the current time until timesync has converged
+	return math::min(_mavlink_timesync.sync_stamp(time_boot_ms * 1000ULL), now);
+}
+
 void MavlinkReceiver::fill_thrust(float *thrust_body_array, uint8_t vehicle_type, float thrust)
 {
 	// Fill correct field by checking frametype
@@ -2643,12 +2562,53 @@ MavlinkReceiver::handle_message_collision(mavlink_message_t *msg)
 	_collision_report_pub.publish(collision_report);
 }
 
+void
+MavlinkReceiver::handle_message_terrain_data(mavlink_message_t *msg)
+{
+	mavlink_terrain_data_t terrain_data_msg;
+	mavlink_msg_terrain_data_decode(msg, &terrain_data_msg);
+
+	terrain_data_s terrain_data{};
+
+	terrain_data.timestamp = hrt_absolute_time();
+	terrain_data.lat = terrain_data_msg.lat;
+	terrain_data.lon = terrain_data_msg.lon;
+	terrain_data.grid_spacing = terrain_data_msg.grid_spacing;
+	terrain_data.gridbit = terrain_data_msg.gridbit;
+	static_assert(sizeof(terrain_data.data) == sizeof(terrain_data_msg.data), "TERRAIN_DATA size");
+	memcpy(terrain_data.data, terrain_data_msg.data, sizeof(terrain_data.data));
+
+	_terrain_data_pub.publish(terrain_data);
+}
+
 void
 MavlinkReceiver::handle_message_gps_rtcm_data(mavlink_message_t *msg)
 {
 	mavlink_gps_rtcm_data_t gps_rtcm_data_msg;
 	mavlink_msg_gps_rtcm_data_decode(msg, &gps_rtcm_data_msg);
 
+#if defined(CONFIG_MAVLINK_RTCM_REASSEMBLY)
+
+	if (_rtcm_reassembler == nullptr) {
+		_rtcm_reassembler = new MavlinkRtcmReassembler();
+
+		if ((_rtcm_reassembler != nullptr) && !_rtcm_reassembler->init(CONFIG_MAVLINK_RTCM_BUFFER_SIZE)) {
+			PX4_ERR("RTCM buffer allocation failed");
+			delete _rtcm_reassembler;
+			_rtcm_reassembler = nullptr;
+		}
+	}
+
+	if (_rtcm_reassembler != nullptr) {
+		static_assert(sizeof(gps_rtcm_data_msg.data) == MavlinkRtcmReassembler::FRAGMENT_SIZE, "GPS_RTCM_DATA size");
+		_rtcm_reassembler->add_fragment(gps_rtcm_data_msg.flags, gps_rtcm_data_msg.data,
+						math::min((size_t)gps_rtcm_data_msg.len, sizeof(gps_rtcm_data_msg.data)));
+		publish_rtcm_corrections(hrt_absolute_time());
+		return;
+	}
+
+#endif // CONFIG_MAVLINK_RTCM_REASSEMBLY
+
 	gps_inject_data_s gps_inject_data_topic{};
 
 	gps_inject_data_topic.timestamp = hrt_absolute_time();
@@ -2663,6 +2623,31 @@ MavlinkReceiver::handle_message_gps_rtcm_data(mavlink_message_t *msg)
 	_gps_inject_data_pub.publish(gps_inject_data_topic);
 }
 
+#if defined(CONFIG_MAVLINK_RTCM_REASSEMBLY)
+void
+MavlinkReceiver::publish_rtcm_corrections(const hrt_abstime &t)
+{
+	if (_rtcm_reassembler == nullptr) {
+		return;
+	}
+
+	// The gps driver injects up to a full gps_inject_data queue at least every 50 ms,
+	// publishing no more than that keeps the queue from overflowing. The rest stays in the ring.
+	if (t - _rtcm_window_start > 50_ms) {
+		_rtcm_window_start = t;
+		_rtcm_window_published = 0;
+	}
+
+	gps_inject_data_s gps_inject_data_topic{};
+
+	while ((_rtcm_window_published < gps_inject_data_s::ORB_QUEUE_LENGTH) && _rtcm_reassembler->pop(gps_inject_data_topic)) {
+		gps_inject_data_topic.timestamp = hrt_absolute_time();
+		_gps_inject_data_pub.publish(gps_inject_data_topic);
+		_rtcm_window_published++;
+	}
+}
+#endif // CONFIG_MAVLINK_RTCM_REASSEMBLY
+
 void
 MavlinkReceiver::handle_message_hil_state_quaternion(mavlink_message_t *msg)
 {
@@ -3114,6 +3099,154 @@ MavlinkReceiver::handle_message_gimbal_device_attitude_status(mavlink_message_t
 	_gimbal_device_attitude_status_pub.publish(gimbal_attitude_status);
 }
 
+#if defined(CONFIG_MAVLINK_FRAME_PARSER)
+size_t
+MavlinkReceiver::parse_frame(const uint8_t *buf, size_t len, mavlink_message_t *msg)
+{
+	mavlink_status_t *status = _mavlink->get_status();
+
+	// only take over between frames, anything unusual is left to the byte wise parser
+	if ((status->parse_state > MAVLINK_PARSE_STATE_IDLE) || (status->signing != nullptr)) {
+		return 0;
+	}
+
+	const bool mavlink1 = (buf[0] == MAVLINK_STX_MAVLINK1);
+
+	if (!mavlink1 && (buf[0] != MAVLINK_STX)) {
+		return 0;
+	}
+
+	const size_t header_len = mavlink1 ? MAVLINK_CORE_HEADER_MAVLINK1_LEN : MAVLINK_CORE_HEADER_LEN;
+
+	if (len < header_len + 1) {
+		return 0;
+	}
+
+	const uint8_t payload_len = buf[1];
+	const size_t frame_len = 1 + header_len + payload_len + MAVLINK_NUM_CHECKSUM_BYTES;
+
+	// incompat flags are only set for signed frames
+	if ((len < frame_len) || (!mavlink1 && (buf[2] != 0))) {
+		return 0;
+	}
+
+	const uint32_t msgid = mavlink1 ? buf[5] : (buf[7] | (buf[8] << 8) | ((uint32_t)buf[9] << 16));
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgid);
+
+	if ((entry == nullptr) || (payload_len > entry->max_msg_len)) {
+		return 0;
+	}
+
+	uint16_t checksum;
+	crc_init(&checksum);
+	crc_accumulate_buffer(&checksum, (const char *)&buf[1], header_len + payload_len);
+	crc_accumulate(entry->crc_extra, &checksum);
+
+	const uint8_t *ck = &buf[1 + header_len + payload_len];
+
+	if ((ck[0] != (checksum & 0xFF)) || (ck[1] != (checksum >> 8))) {
+		return 0;
+	}
+
+	msg->magic = buf[0];
+	msg->len = payload_len;
+
+	if (mavlink1) {
+		msg->incompat_flags = 0;
+		msg->compat_flags = 0;
+		msg->seq = buf[2];
+		msg->sysid = buf[3];
+		msg->compid = buf[4];
+
+	} else {
+		msg->incompat_flags = buf[2];
+		msg->compat_flags = buf[3];
+		msg->seq = buf[4];
+		msg->sysid = buf[5];
+		msg->compid = buf[6];
+	}
+
+	msg->msgid = msgid;
+	msg->checksum = checksum;
+	msg->ck[0] = ck[0];
+	msg->ck[1] = ck[1];
+
+	// zero-fill truncated payloads, as mavlink_parse_char() does
+	uint8_t *payload = (uint8_t *)_MAV_PAYLOAD_NON_CONST(msg);
+	memcpy(payload, &buf[1 + header_len], payload_len);
+
+	if (payload_len < entry->max_msg_len) {
+		memset(&payload[payload_len], 0, entry->max_msg_len - payload_len);
+	}
+
+	// keep the channel status consistent with the byte wise parser
+	if (mavlink1) {
+		status->flags |= MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+
+	} else {
+		status->flags &= ~MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+	}
+
+	if (status->packet_rx_success_count == 0) {
+		status->packet_rx_drop_count = 0;
+	}
+
+	status->current_rx_seq = msg->seq;
+	status->packet_rx_success_count++;
+	status->msg_received = MAVLINK_FRAMING_OK;
+
+	return frame_len;
+}
+#endif // CONFIG_MAVLINK_FRAME_PARSER
+
+void
+MavlinkReceiver::dispatch_message(mavlink_message_t *msg)
+{
+	/* check if we received version 2 and request a switch. */
+	if (!(_mavlink->get_status()->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)) {
+		/* this will only switch to proto version 2 if allowed in settings */
+		_mavlink->set_proto_version(2);
+	}
+
+	/* handle generic messages and commands */
+	handle_message(msg);
+
+	/* handle packet with mission manager */
+	_mission_manager.handle_message(msg);
+
+	/* handle packet with parameter component */
+	if (_mavlink->boot_complete()) {
+		// make sure mavlink app has booted before we start processing parameter sync
+		_parameters_manager.handle_message(msg);
+
+	} else {
+		if (hrt_elapsed_time(&_mavlink->get_first_start_time()) > 20_s) {
+			PX4_ERR("system boot did not complete in 20 seconds");
+			_mavlink->set_boot_complete();
+		}
+	}
+
+	if (_mavlink->ftp_enabled()) {
+		/* handle packet with ftp component */
+		_mavlink_ftp.handle_message(msg);
+	}
+
+	/* handle packet with log component */
+	_mavlink_log_handler.handle_message(msg);
+
+	/* handle packet with timesync component */
+	_mavlink_timesync.handle_message(msg);
+
+	/* handle packet with parent object */
+	_mavlink->handle_message(msg);
+
+	update_rx_stats(*msg);
+
+	if (_message_statistics_enabled) {
+		update_message_statistics(*msg);
+	}
+}
+
 void
 MavlinkReceiver::run()
 {
@@ -3148,13 +3281,29 @@ MavlinkReceiver::run()
 
 #if defined(MAVLINK_UDP)
 	struct sockaddr_in srcaddr = {};
+# if !defined(MAVLINK_UDP_BATCHING)
 	socklen_t addrlen = sizeof(srcaddr);
+# endif // !MAVLINK_UDP_BATCHING
 
 	if (_mavlink->get_protocol() == Protocol::UDP) {
 		fds[0].fd = _mavlink->get_socket_fd();
 		fds[0].events = POLLIN;
 	}
 
+# if defined(MAVLINK_UDP_BATCHING)
+	// receive up to one MTU sized datagram per slot of buf with a single recvmmsg()
+	static constexpr int RECV_BATCH_SIZE = 5;
+	static constexpr size_t RECV_SLOT_SIZE = sizeof(buf) / RECV_BATCH_SIZE;
+	struct sockaddr_in recv_addr[RECV_BATCH_SIZE] {};
+	struct iovec recv_iov[RECV_BATCH_SIZE] {};
+	struct mmsghdr recv_msgs[RECV_BATCH_SIZE] {};
+
+	for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+		recv_iov[i].iov_base = &buf[i * RECV_SLOT_SIZE];
+		recv_iov[i].iov_len = RECV_SLOT_SIZE;
+	}
+
+# endif // MAVLINK_UDP_BATCHING
 #endif // MAVLINK_UDP
 
 	ssize_t nread = 0;
@@ -3172,7 +3321,23 @@ MavlinkReceiver::run()
 			updateParams();
 		}
 
-		int ret = poll(&fds[0], 1, timeout);
+		// keep burst downloads going at link speed instead of one tx buffer per poll timeout
+		const bool ftp_streaming = _mavlink->ftp_enabled() && _mavlink_ftp.stream_download_active();
+
+		int ret = 0;
+
+#if defined(MAVLINK_SHM)
+
+		if (_mavlink->get_protocol() == Protocol::SHM) {
+			// the shared memory ring has no fd to poll, it blocks itself until data or timeout
+			nread = _mavlink->get_shm().read(buf, sizeof(buf), ftp_streaming ? 1 : timeout);
+			ret = (nread > 0) ? 1 : 0;
+
+		} else
+#endif // MAVLINK_SHM
+		{
+			ret = poll(&fds[0], 1, ftp_streaming ? 1 : timeout);
+		}
 
 		if (ret > 0) {
 			if (_mavlink->get_protocol() == Protocol::SERIAL) {
@@ -3188,7 +3353,28 @@ MavlinkReceiver::run()
 
 			else if (_mavlink->get_protocol() == Protocol::UDP) {
 				if (fds[0].revents & POLLIN) {
+#if defined(MAVLINK_UDP_BATCHING)
+
+					for (int i = 0; i < RECV_BATCH_SIZE; i++) {
+						recv_msgs[i].msg_hdr.msg_name = &recv_addr[i];
+						recv_msgs[i].msg_hdr.msg_namelen = sizeof(recv_addr[i]);
+						recv_msgs[i].msg_hdr.msg_iov = &recv_iov[i];
+						recv_msgs[i].msg_hdr.msg_iovlen = 1;
+					}
+
+					const int received = recvmmsg(_mavlink->get_socket_fd(), recv_msgs, RECV_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+					nread = (received > 0) ? 0 : -1;
+
+					// compact the datagrams so the parser sees one contiguous byte stream
+					for (int i = 0; i < received; i++) {
+						memmove(&buf[nread], recv_iov[i].iov_base, recv_msgs[i].msg_len);
+						nread += recv_msgs[i].msg_len;
+						srcaddr = recv_addr[i];
+					}
+
+#else
 					nread = recvfrom(_mavlink->get_socket_fd(), buf, sizeof(buf), 0, (struct sockaddr *)&srcaddr, &addrlen);
+#endif // MAVLINK_UDP_BATCHING
 				}
 
 				struct sockaddr_in &srcaddr_last = _mavlink->get_client_source_address();
@@ -3221,51 +3407,19 @@ MavlinkReceiver::run()
 
 				/* if read failed, this loop won't execute */
 				for (ssize_t i = 0; i < nread; i++) {
-					if (mavlink_parse_char(_mavlink->get_channel(), buf[i], &msg, &_status)) {
-
-						/* check if we received version 2 and request a switch. */
-						if (!(_mavlink->get_status()->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)) {
-							/* this will only switch to proto version 2 if allowed in settings */
-							_mavlink->set_proto_version(2);
-						}
-
-						/* handle generic messages and commands */
-						handle_message(&msg);
-
-						/* handle packet with mission manager */
-						_mission_manager.handle_message(&msg);
-
-						/* handle packet with parameter component */
-						if (_mavlink->boot_complete()) {
-							// make sure mavlink app has booted before we start processing parameter sync
-							_parameters_manager.handle_message(&msg);
-
-						} else {
-							if (hrt_elapsed_time(&_mavlink->get_first_start_time()) > 20_s) {
-								PX4_ERR("system boot did not complete in 20 seconds");
-								_mavlink->set_boot_complete();
-							}
-						}
+#if defined(CONFIG_MAVLINK_FRAME_PARSER)
+					const size_t frame_len = parse_frame(&buf[i], nread - i, &msg);
 
-						if (_mavlink->ftp_enabled()) {
-							/* handle packet with ftp component */
-							_mavlink_ftp.handle_message(&msg);
-						}
-
-						/* handle packet with log component */
-						_mavlink_log_handler.handle_message(&msg);
-
-						/* handle packet with timesync component */
-						_mavlink_timesync.handle_message(&msg);
-
-						/* handle packet with parent object */
-						_mavlink->handle_message(&msg);
+					if (frame_len > 0) {
+						dispatch_message(&msg);
+						i += frame_len - 1;
+						continue;
+					}
 
-						update_rx_stats(msg);
+#endif // CONFIG_MAVLINK_FRAME_PARSER
 
-						if (_message_statistics_enabled) {
-							update_message_statistics(msg);
-						}
+					if (mavlink_parse_char(_mavlink->get_channel(), buf[i], &msg, &_status)) {
+						dispatch_message(&msg);
 					}
 				}
 
@@ -3307,6 +3461,10 @@ MavlinkReceiver::run()
 
 		CheckHeartbeats(t);
 
+#if defined(CONFIG_MAVLINK_RTCM_REASSEMBLY)
+		publish_rtcm_corrections(t);
+#endif // CONFIG_MAVLINK_RTCM_REASSEMBLY
+
 		if (t - last_send_update > timeout * 1000) {
 			_mission_manager.check_active_mission();
 			_mission_manager.send();
@@ -3321,11 +3479,16 @@ MavlinkReceiver::run()
 
 			_mavlink_log_handler.send();
 			last_send_update = t;
+
+		} else if (ftp_streaming) {
+			_mavlink_ftp.send();
 		}
 
 		if (_tune_publisher != nullptr) {
 			_tune_publisher->publish_next_tune(t);
 		}
+
+		_mavlink->flush_tx();
 	}
 }
 
@@ -3508,6 +3671,14 @@ void MavlinkReceiver::print_detailed_rx_stats() const
 			}
 		}
 	}
+
+#if defined(CONFIG_MAVLINK_RTCM_REASSEMBLY)
+
+	if (_rtcm_reassembler != nullptr) {
+		_rtcm_reassembler->print_status();
+	}
+
+#endif // CONFIG_MAVLINK_RTCM_REASSEMBLY
 }
 
 void MavlinkReceiver::start()
@@ -47,6 +47,9 @@
 #include "mavlink_log_handler.h"
 #include "mavlink_mission.h"
 #include "mavlink_parameters.h"
+#if defined(CONFIG_MAVLINK_RTCM_REASSEMBLY)
+#include "mavlink_rtcm.h"
+#endif // CONFIG_MAVLINK_RTCM_REASSEMBLY
 #include "MavlinkStatustextHandler.hpp"
 #include "mavlink_timesync.h"
 #include "tune_publisher.h"
@@ -95,6 +98,7 @@
 #include <uORB/topics/sensor_gps.h>
 #include <uORB/topics/sensor_optical_flow.h>
 #include <uORB/topics/telemetry_status.h>
+#include <uORB/topics/terrain_data.h>
 #include <uORB/topics/transponder_report.h>
 #include <uORB/topics/trajectory_setpoint.h>
 #include <uORB/topics/tune_control.h>
@@ -154,6 +158,27 @@ private:
 	uint8_t handle_request_message_command(uint16_t message_id, float param2 = 0.0f, float param3 = 0.0f,
 					       float param4 = 0.0f, float param5 = 0.0f, float param6 = 0.0f, float param7 = 0.0f);
 
+	struct MessageHandler {
+		uint32_t msgid;
+		void (MavlinkReceiver::*handle)(mavlink_message_t *msg);
+	};
+
+	/**
+	 * Pass a received message to the receiver, the protocol components and the parent instance.
+	 */
+	void dispatch_message(mavlink_message_t *msg);
+
+#if defined(CONFIG_MAVLINK_FRAME_PARSER)
+	/**
+	 * Frame a complete unsigned MAVLink frame at the start of buf in a single pass
+	 * instead of feeding it byte by byte through mavlink_parse_char().
+	 *
+	 * @return length of the frame, 0 if the bytes have to go through mavlink_parse_char()
+	 * (parser in the middle of a frame, partial, signed or corrupted frame)
+	 */
+	size_t parse_frame(const uint8_t *buf, size_t len, mavlink_message_t *msg);
+#endif // CONFIG_MAVLINK_FRAME_PARSER
+
 	void handle_message(mavlink_message_t *msg);
 
 	void handle_message_adsb_vehicle(mavlink_message_t *msg);
@@ -169,6 +194,9 @@ private:
 	void handle_message_generator_status(mavlink_message_t *msg);
 	void handle_message_set_gps_global_origin(mavlink_message_t *msg);
 	void handle_message_gps_rtcm_data(mavlink_message_t *msg);
+#if defined(CONFIG_MAVLINK_RTCM_REASSEMBLY)
+	void publish_rtcm_corrections(const hrt_abstime &t);
+#endif // CONFIG_MAVLINK_RTCM_REASSEMBLY
 	void handle_message_heartbeat(mavlink_message_t *msg);
 	void handle_message_hil_gps(mavlink_message_t *msg);
 	void handle_message_hil_optical_flow(mavlink_message_t *msg);
@@ -194,6 +222,7 @@ private:
 	void handle_message_set_position_target_global_int(mavlink_message_t *msg);
 	void handle_message_set_position_target_local_ned(mavlink_message_t *msg);
 	void handle_message_statustext(mavlink_message_t *msg);
+	void handle_message_terrain_data(mavlink_message_t *msg);
 	void handle_message_tunnel(mavlink_message_t *msg);
 	void handle_message_trajectory_representation_bezier(mavlink_message_t *msg);
 	void handle_message_trajectory_representation_waypoints(mavlink_message_t *msg);
@@ -234,6 +263,13 @@ private:
 
 	void fill_thrust(float *thrust_body_array, uint8_t vehicle_type, float thrust);
 
+	/**
+	 * Local time of a setpoint generated by the sender at time_boot_ms (timesync corrected if available)
+	 * @param time_boot_ms sender time of the setpoint, 0 if unknown
+	 * @param now local receive time, upper bound of the result
+	 */
+	hrt_abstime sync_setpoint_stamp(uint32_t time_boot_ms, hrt_abstime now);
+
 	void schedule_tune(const char *tune);
 
 	void update_message_statistics(const mavlink_message_t &message);
@@ -344,6 +380,7 @@ private:
 	uORB::PublicationMulti<sensor_optical_flow_s>           _sensor_optical_flow_pub{ORB_ID(sensor_optical_flow)};
 
 	// ORB publications (queue length > 1)
+	uORB::Publication<terrain_data_s>        _terrain_data_pub{ORB_ID(terrain_data)};
 	uORB::Publication<transponder_report_s>  _transponder_report_pub{ORB_ID(transponder_report)};
 	uORB::Publication<vehicle_command_s>     _cmd_pub{ORB_ID(vehicle_command)};
 	uORB::Publication<vehicle_command_ack_s> _cmd_ack_pub{ORB_ID(vehicle_command_ack)};
@@ -379,6 +416,12 @@ private:
 	// Allocated if needed.
 	TunePublisher *_tune_publisher{nullptr};
 
+#if defined(CONFIG_MAVLINK_RTCM_REASSEMBLY)
+	MavlinkRtcmReassembler *_rtcm_reassembler{nullptr}; ///< allocated on the first GPS_RTCM_DATA
+	hrt_abstime _rtcm_window_start{0};
+	unsigned _rtcm_window_published{0};
+#endif // CONFIG_MAVLINK_RTCM_REASSEMBLY
+
 	hrt_abstime _last_heartbeat_check{0};
 
 	hrt_abstime _heartbeat_type_antenna_tracker{0};
@@ -0,0 +1,233 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file mavlink_rtcm.cpp
+ * Reassembly of the RTCM corrections received as GPS_RTCM_DATA.
+ */
+
+#include "mavlink_rtcm.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <px4_platform_common/log.h>
+
+static constexpr uint8_t RTCM3_PREAMBLE = 0xD3;
+static constexpr size_t RTCM3_HEADER_LEN = 3;
+static constexpr size_t RTCM3_CRC_LEN = 3;
+
+bool MavlinkRtcmReassembler::init(size_t buffer_size)
+{
+	_ring_allocated = _ring.allocate(buffer_size);
+	return _ring_allocated;
+}
+
+void MavlinkRtcmReassembler::add_fragment(uint8_t flags, const uint8_t *data, size_t len)
+{
+	if (len > FRAGMENT_SIZE) {
+		len = FRAGMENT_SIZE;
+	}
+
+	_statistics.bytes_received += len;
+
+	if ((flags & 0x1) == 0) {
+		// not fragmented, a pending sequence is either complete or lost its last fragment
+		finish_sequence();
+		_discarding = false;
+		push_message(data, len);
+		return;
+	}
+
+	const uint8_t fragment_id = (flags >> 1) & 0x3;
+	const uint8_t sequence_id = (flags >> 3) & 0x1F;
+
+	if ((_fragments_len > 0) && (sequence_id != _sequence_id)) {
+		finish_sequence();
+	}
+
+	if (fragment_id != _next_fragment_id) {
+		// lost a fragment, the whole sequence is unusable
+		if (_fragments_len > 0) {
+			drop_sequence();
+
+		} else if ((fragment_id != 0) && (!_discarding || (sequence_id != _sequence_id))) {
+			// first fragment lost
+			_statistics.sequences_dropped++;
+		}
+
+		if (fragment_id != 0) {
+			// ignore the rest of the sequence
+			_sequence_id = sequence_id;
+			_discarding = true;
+			return;
+		}
+	}
+
+	_discarding = false;
+
+	memcpy(&_fragments[_fragments_len], data, len);
+	_fragments_len += len;
+	_sequence_id = sequence_id;
+	_next_fragment_id = fragment_id + 1;
+
+	// a short fragment or the last possible one terminates the sequence
+	if ((len < FRAGMENT_SIZE) || (_next_fragment_id == MAX_FRAGMENTS)) {
+		push_message(_fragments, _fragments_len);
+		_fragments_len = 0;
+		_next_fragment_id = 0;
+	}
+}
+
+void MavlinkRtcmReassembler::finish_sequence()
+{
+	if (_fragments_len == 0) {
+		return;
+	}
+
+	// Only full fragments so far: either the message is a multiple of the fragment size
+	// or the last fragment got lost. Pass on what is not RTCM3 as before.
+	if ((_fragments[0] != RTCM3_PREAMBLE) || complete_rtcm3_frames(_fragments, _fragments_len)) {
+		push_message(_fragments, _fragments_len);
+		_fragments_len = 0;
+		_next_fragment_id = 0;
+
+	} else {
+		drop_sequence();
+	}
+}
+
+void MavlinkRtcmReassembler::drop_sequence()
+{
+	_statistics.sequences_dropped++;
+	_fragments_len = 0;
+	_next_fragment_id = 0;
+}
+
+void MavlinkRtcmReassembler::push_message(const uint8_t *data, size_t len)
+{
+	if (!_ring_allocated || (len == 0)) {
+		return;
+	}
+
+	while (!_ring.push_back(data, len)) {
+		if (!drop_oldest()) {
+			_statistics.messages_dropped++;
+			return;
+		}
+	}
+
+	_statistics.messages_completed++;
+}
+
+bool MavlinkRtcmReassembler::drop_oldest()
+{
+	if ((_staging_offset == 0) && (_staging_len > 0)) {
+		// popped but nothing handed out yet
+		_staging_len = 0;
+		_statistics.messages_dropped++;
+		return true;
+	}
+
+	// a partially handed out message is kept, its rest is still older than anything in the ring
+	if (_ring.pop_front(_discard, sizeof(_discard)) == 0) {
+		return false;
+	}
+
+	_statistics.messages_dropped++;
+	return true;
+}
+
+bool MavlinkRtcmReassembler::pop(gps_inject_data_s &msg)
+{
+	static constexpr size_t capacity = sizeof(gps_inject_data_s::data);
+	size_t len = 0;
+
+	while (len < capacity) {
+		if (_staging_offset >= _staging_len) {
+			_staging_offset = 0;
+			_staging_len = _ring.pop_front(_staging, sizeof(_staging));
+
+			if (_staging_len == 0) {
+				break;
+			}
+		}
+
+		const size_t remaining = _staging_len - _staging_offset;
+
+		// start a new message in the next gps_inject_data message if it does not fit anymore
+		if ((_staging_offset == 0) && (len > 0) && (remaining > capacity - len)) {
+			break;
+		}
+
+		const size_t n = (remaining < capacity - len) ? remaining : capacity - len;
+		memcpy(&msg.data[len], &_staging[_staging_offset], n);
+		_staging_offset += n;
+		len += n;
+	}
+
+	if (len == 0) {
+		return false;
+	}
+
+	msg.len = len;
+	msg.flags = (_staging_offset < _staging_len) ? 1 : 0; // LSB: 1=fragmented, continued in the next message
+	_statistics.bytes_published += len;
+	return true;
+}
+
+bool MavlinkRtcmReassembler::complete_rtcm3_frames(const uint8_t *data, size_t len)
+{
+	size_t offset = 0;
+
+	while (offset + RTCM3_HEADER_LEN <= len) {
+		if (data[offset] != RTCM3_PREAMBLE) {
+			return false;
+		}
+
+		const size_t payload_len = ((data[offset + 1] & 0x03) << 8) | data[offset + 2];
+		offset += RTCM3_HEADER_LEN + payload_len + RTCM3_CRC_LEN;
+	}
+
+	return offset == len;
+}
+
+void MavlinkRtcmReassembler::print_status() const
+{
+	printf("\t  RTCM: rx %" PRIu32 " B, published %" PRIu32 " B, messages %" PRIu32 ", dropped %" PRIu32
+	       " (incomplete %" PRIu32 ")\n",
+	       _statistics.bytes_received, _statistics.bytes_published, _statistics.messages_completed,
+	       _statistics.messages_dropped, _statistics.sequences_dropped);
+}
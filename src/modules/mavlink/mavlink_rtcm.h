@@ -0,0 +1,132 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file mavlink_rtcm.h
+ * Reassembly and rate matching of the RTCM corrections received as GPS_RTCM_DATA.
+ *
+ * Fragmented GPS_RTCM_DATA messages (flags: bit 0 fragmented, bits 1-2 fragment id,
+ * bits 3-7 sequence id) are reassembled into the original correction message, which
+ * is then queued in a byte ring. Incomplete sequences (a lost fragment) are dropped
+ * as a whole instead of passing a broken RTCM frame on to the receiver, and if the
+ * ring runs full the oldest queued messages are dropped first.
+ *
+ * pop() packs the queued messages into gps_inject_data messages without splitting
+ * a correction message unless it is larger than a gps_inject_data message, so that
+ * a gps_inject_data queue overflow downstream also only loses whole messages.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/variable_length_ringbuffer/VariableLengthRingbuffer.hpp>
+#include <uORB/topics/gps_inject_data.h>
+
+class MavlinkRtcmReassembler
+{
+public:
+	static constexpr size_t FRAGMENT_SIZE{180};                         ///< GPS_RTCM_DATA data field length
+	static constexpr size_t MAX_FRAGMENTS{4};
+	static constexpr size_t MAX_MESSAGE_SIZE{FRAGMENT_SIZE * MAX_FRAGMENTS};
+
+	MavlinkRtcmReassembler() = default;
+	~MavlinkRtcmReassembler() = default;
+
+	/**
+	 * Allocate the message ring.
+	 * @param buffer_size ring size in bytes, at least MAX_MESSAGE_SIZE plus the per message overhead
+	 * @return false if the allocation failed
+	 */
+	bool init(size_t buffer_size);
+
+	/**
+	 * Add a received GPS_RTCM_DATA message.
+	 * @param flags GPS_RTCM_DATA flags
+	 * @param data GPS_RTCM_DATA data
+	 * @param len number of valid bytes in data
+	 */
+	void add_fragment(uint8_t flags, const uint8_t *data, size_t len);
+
+	/**
+	 * Fill the next gps_inject_data message with queued corrections. Sets len, flags and data,
+	 * the timestamp and device_id are left to the caller.
+	 * @return false if nothing is queued
+	 */
+	bool pop(gps_inject_data_s &msg);
+
+	struct Statistics {
+		uint32_t bytes_received;      ///< correction bytes received
+		uint32_t bytes_published;     ///< correction bytes handed out by pop()
+		uint32_t messages_completed;  ///< correction messages queued
+		uint32_t messages_dropped;    ///< queued correction messages dropped because the ring ran full
+		uint32_t sequences_dropped;   ///< incomplete fragment sequences dropped
+	};
+
+	const Statistics &statistics() const { return _statistics; }
+
+	void print_status() const;
+
+private:
+	void finish_sequence();
+	void drop_sequence();
+	void push_message(const uint8_t *data, size_t len);
+	bool drop_oldest();
+
+	/**
+	 * Check if data holds a sequence of complete RTCM3 frames.
+	 * Only used to decide on sequences of full fragments that were not terminated by a short one.
+	 */
+	static bool complete_rtcm3_frames(const uint8_t *data, size_t len);
+
+	VariableLengthRingbuffer _ring{};
+	bool _ring_allocated{false};
+
+	// reassembly of the current fragment sequence
+	uint8_t _fragments[MAX_MESSAGE_SIZE];
+	size_t _fragments_len{0};
+	uint8_t _sequence_id{0};
+	uint8_t _next_fragment_id{0};
+	bool _discarding{false}; // ignoring the rest of sequence _sequence_id
+
+	// message popped from the ring, handed out by pop()
+	uint8_t _staging[MAX_MESSAGE_SIZE];
+	size_t _staging_len{0};
+	size_t _staging_offset{0};
+
+	uint8_t _discard[MAX_MESSAGE_SIZE];
+
+	Statistics _statistics{};
+};
@@ -0,0 +1,205 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_shm.cpp
+ * Shared memory transport for MAVLink.
+ */
+
+#include "mavlink_shm.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__PX4_LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include <lib/mathlib/mathlib.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/posix.h>
+
+static uint32_t ring_load(const uint32_t *value)
+{
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+static void ring_store(uint32_t *value, uint32_t new_value)
+{
+	__atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+}
+
+int
+MavlinkShm::open(const char *name)
+{
+	int fd = shm_open(name, O_RDWR | O_CREAT, 0666);
+
+	if (fd < 0) {
+		PX4_ERR("shm_open %s failed (%i)", name, errno);
+		return PX4_ERROR;
+	}
+
+	struct stat st {};
+	const bool created = (fstat(fd, &st) == 0) && (st.st_size == 0);
+
+	if (created && (ftruncate(fd, sizeof(Segment)) != 0)) {
+		PX4_ERR("shm resize failed (%i)", errno);
+		::close(fd);
+		return PX4_ERROR;
+	}
+
+	void *mem = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+
+	if (mem == MAP_FAILED) {
+		PX4_ERR("shm mmap failed (%i)", errno);
+		return PX4_ERROR;
+	}
+
+	_segment = static_cast<Segment *>(mem);
+
+	if (created || (_segment->magic != MAGIC) || (_segment->version != VERSION)) {
+		// (re)initialize, a companion attaching later sees empty rings
+		memset(_segment, 0, sizeof(Segment));
+		_segment->version = VERSION;
+		__atomic_store_n(&_segment->magic, MAGIC, __ATOMIC_RELEASE);
+
+	} else {
+		// drop whatever is left from a previous run
+		ring_store(&_segment->to_px4.tail, ring_load(&_segment->to_px4.head));
+	}
+
+	return PX4_OK;
+}
+
+void
+MavlinkShm::close()
+{
+	if (_segment != nullptr) {
+		munmap(_segment, sizeof(Segment));
+		_segment = nullptr;
+	}
+}
+
+size_t
+MavlinkShm::free_space() const
+{
+	if (_segment == nullptr) {
+		return 0;
+	}
+
+	const Ring &ring = _segment->to_companion;
+	return RING_SIZE - (ring_load(&ring.head) - ring_load(&ring.tail));
+}
+
+ssize_t
+MavlinkShm::write(const uint8_t *buf, size_t len)
+{
+	if ((_segment == nullptr) || (len > free_space())) {
+		return -1;
+	}
+
+	Ring &ring = _segment->to_companion;
+	const uint32_t head = ring.head; // only written by us
+	const uint32_t index = head & (RING_SIZE - 1);
+	const size_t first = math::min(len, (size_t)(RING_SIZE - index));
+
+	memcpy(&ring.data[index], buf, first);
+	memcpy(&ring.data[0], buf + first, len - first);
+
+	ring_store(&ring.head, head + len);
+
+#if defined(__PX4_LINUX)
+
+	if (ring_load(&ring.consumer_waiting)) {
+		syscall(SYS_futex, &ring.head, FUTEX_WAKE, 1, nullptr, nullptr, 0);
+	}
+
+#endif // __PX4_LINUX
+
+	return len;
+}
+
+ssize_t
+MavlinkShm::read(uint8_t *buf, size_t len, int timeout_ms)
+{
+	if (_segment == nullptr) {
+		return -1;
+	}
+
+	Ring &ring = _segment->to_px4;
+	const uint32_t tail = ring.tail; // only written by us
+	uint32_t head = ring_load(&ring.head);
+
+	if (head == tail) {
+#if defined(__PX4_LINUX)
+		ring_store(&ring.consumer_waiting, 1);
+
+		// recheck after announcing, the producer might have written in between
+		head = ring_load(&ring.head);
+
+		if (head == tail) {
+			const struct timespec timeout {timeout_ms / 1000, (timeout_ms % 1000) * 1000000L};
+			syscall(SYS_futex, &ring.head, FUTEX_WAIT, tail, &timeout, nullptr, 0);
+			head = ring_load(&ring.head);
+		}
+
+		ring_store(&ring.consumer_waiting, 0);
+#else
+		px4_usleep(1000);
+		head = ring_load(&ring.head);
+#endif // __PX4_LINUX
+
+		if (head == tail) {
+			return 0;
+		}
+	}
+
+	const size_t available = math::min((size_t)(head - tail), len);
+	const uint32_t index = tail & (RING_SIZE - 1);
+	const size_t first = math::min(available, (size_t)(RING_SIZE - index));
+
+	memcpy(buf, &ring.data[index], first);
+	memcpy(buf + first, &ring.data[0], available - first);
+
+	ring_store(&ring.tail, tail + available);
+
+	return available;
+}
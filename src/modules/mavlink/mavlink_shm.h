@@ -0,0 +1,129 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_shm.h
+ * Shared memory transport for MAVLink instances talking to a process on the same host.
+ *
+ * The segment (shm_open() name given on the command line) holds two single producer,
+ * single consumer byte rings carrying regular MAVLink frames:
+ *
+ *   struct {
+ *       uint32_t magic;            // MAGIC
+ *       uint32_t version;          // VERSION
+ *       Ring     to_companion;     // written by PX4
+ *       Ring     to_px4;           // written by the companion
+ *   };
+ *
+ *   struct Ring {
+ *       uint32_t head;             // total bytes written, only modified by the producer
+ *       uint32_t tail;             // total bytes read, only modified by the consumer
+ *       uint32_t consumer_waiting; // non-zero while the consumer sleeps on head (futex)
+ *       uint32_t reserved;
+ *       uint8_t  data[RING_SIZE];
+ *   };
+ *
+ * head and tail are accessed atomically and wrap at 2^32, the ring index is the value
+ * modulo RING_SIZE. On Linux a waiting consumer sleeps on the head word with a futex,
+ * a producer that sees consumer_waiting set wakes it after writing.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+class MavlinkShm
+{
+public:
+	static constexpr uint32_t MAGIC = 0x4d41564c; // "MAVL"
+	static constexpr uint32_t VERSION = 1;
+	static constexpr uint32_t RING_SIZE = 64 * 1024; // must be a power of 2
+
+	MavlinkShm() = default;
+	~MavlinkShm() { close(); }
+
+	// no copy, assignment, move, move assignment
+	MavlinkShm(const MavlinkShm &) = delete;
+	MavlinkShm &operator=(const MavlinkShm &) = delete;
+	MavlinkShm(MavlinkShm &&) = delete;
+	MavlinkShm &operator=(MavlinkShm &&) = delete;
+
+	/**
+	 * Create (or attach to) and map the segment.
+	 * @param name shm_open() name, e.g. "/px4_mavlink0"
+	 * @return PX4_OK on success, PX4_ERROR otherwise
+	 */
+	int open(const char *name);
+	void close();
+
+	bool is_open() const { return _segment != nullptr; }
+
+	/**
+	 * @return free space in bytes of the ring to the companion
+	 */
+	size_t free_space() const;
+
+	/**
+	 * Write a complete buffer to the companion, nothing is written if it does not fit.
+	 * @return len on success, -1 if the ring is full
+	 */
+	ssize_t write(const uint8_t *buf, size_t len);
+
+	/**
+	 * Read available bytes from the companion, block up to timeout_ms if there are none.
+	 * @return number of bytes read, 0 on timeout
+	 */
+	ssize_t read(uint8_t *buf, size_t len, int timeout_ms);
+
+private:
+	struct Ring {
+		uint32_t head;
+		uint32_t tail;
+		uint32_t consumer_waiting;
+		uint32_t reserved;
+		uint8_t data[RING_SIZE];
+	};
+
+	struct Segment {
+		uint32_t magic;
+		uint32_t version;
+		Ring to_companion;
+		Ring to_px4;
+	};
+
+	static_assert((RING_SIZE & (RING_SIZE - 1)) == 0, "RING_SIZE must be a power of 2");
+
+	Segment *_segment{nullptr};
+};
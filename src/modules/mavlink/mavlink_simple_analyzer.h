@@ -83,6 +83,13 @@ public:
 	 */
 	void reset();
 
+	/**
+	 * Change the window size of the averaging mode.
+	 *
+	 * @param[in] window: The window size in seconds.
+	 */
+	void set_window(float window) { _window = window; }
+
 	/**
 	 * Add a new value to the analyzer and update the result according to the mode.
 	 *
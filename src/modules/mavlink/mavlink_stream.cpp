@@ -64,7 +64,7 @@ MavlinkStream::update(const hrt_abstime &t)
 		// this will give different messages on the same run a different
 		// initial timestamp which will help spacing them out
 		// on the link scheduling
-		if (send()) {
+		if (_mavlink->tx_allowed(priority(), get_size()) && send()) {
 			_last_sent = hrt_absolute_time();
 
 			if (!_first_message_sent) {
@@ -112,6 +112,11 @@ MavlinkStream::update(const hrt_abstime &t)
 		// do not use the actual time but increment at a fixed rate, so that processing delays do not
 		// distort the average rate. The check of the maximum interval is done to ensure that after a
 		// long time not sending anything, sending multiple messages in a short time is avoided.
+		// Leave the message due if the link budget is used up by higher priority traffic.
+		if (!_mavlink->tx_allowed(priority(), get_size())) {
+			return -1;
+		}
+
 		if (send()) {
 			_last_sent = ((interval > 0) && ((int64_t)(1.5f * interval) > dt)) ? _last_sent + interval : t;
 
@@ -52,6 +52,16 @@ class MavlinkStream : public ListNode<MavlinkStream *>
 
 public:
 
+	/**
+	 * Link scheduling priority, see MavlinkStreamScheduler
+	 */
+	enum class Priority : uint8_t {
+		Critical, ///< always sent, e.g. HEARTBEAT
+		High,     ///< sent while there is any link budget left
+		Normal,
+		Bulk,     ///< only sent with plenty of link budget, e.g. parameter or log transfers
+	};
+
 	MavlinkStream(Mavlink *mavlink);
 	virtual ~MavlinkStream() = default;
 
@@ -87,6 +97,11 @@ public:
 	 */
 	virtual bool const_rate() { return false; }
 
+	/**
+	 * @return link scheduling priority of the stream
+	 */
+	virtual Priority priority() const { return Priority::Normal; }
+
 	/**
 	 * Get maximal total messages size on update
 	 */
@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_stream_scheduler.cpp
+ * Priority based link byte budget implementation.
+ */
+
+#include "mavlink_stream_scheduler.h"
+
+#include <mathlib/mathlib.h>
+
+void
+MavlinkStreamScheduler::update(const hrt_abstime &now, float link_rate)
+{
+	_link_rate = link_rate;
+
+	const int32_t burst = math::max(static_cast<int32_t>(link_rate * BURST_TIME), BURST_MIN);
+	_burst.store(burst);
+
+	if (_last_update == 0) {
+		_last_update = now;
+		_budget.store(burst);
+		return;
+	}
+
+	const float dt = math::min((now - _last_update) * 1e-6f, BURST_TIME);
+	_last_update = now;
+
+	// the receiver thread consumes concurrently, so only add and clip the excess
+	const int32_t budget = _budget.fetch_add(static_cast<int32_t>(link_rate * dt)) + static_cast<int32_t>(link_rate * dt);
+
+	if (budget > burst) {
+		_budget.fetch_sub(budget - burst);
+	}
+}
+
+bool
+MavlinkStreamScheduler::allowed(Priority priority, unsigned size) const
+{
+	const int32_t budget = _budget.load();
+	const int32_t burst = _burst.load();
+
+	switch (priority) {
+	case Priority::Critical:
+		// may overdraw the budget, the debt is paid back by everything else
+		return true;
+
+	case Priority::High:
+		return budget >= static_cast<int32_t>(size);
+
+	case Priority::Normal:
+		return budget >= static_cast<int32_t>(size) + burst / 4;
+
+	case Priority::Bulk:
+		return budget >= static_cast<int32_t>(size) + burst / 2;
+	}
+
+	return false;
+}
@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file mavlink_stream_scheduler.h
+ * Priority based link byte budget shared by all senders of a mavlink instance.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/atomic.h>
+
+#include "mavlink_stream.h"
+
+/**
+ * Token bucket sized from the usable link bandwidth (configured data rate scaled
+ * by radio status feedback and TX error rate). Every byte written to the link is
+ * accounted, independent of the thread sending it. Lower priorities keep a
+ * headroom in the bucket free for higher priorities, so on a saturated link
+ * bulk transfers (parameters, FTP, log download) back off first and critical
+ * messages never have to wait for them.
+ */
+class MavlinkStreamScheduler
+{
+public:
+	using Priority = MavlinkStream::Priority;
+
+	/**
+	 * Refill the budget, called once per iteration of the main loop.
+	 *
+	 * @param now current time
+	 * @param link_rate usable link bandwidth [B/s]
+	 */
+	void update(const hrt_abstime &now, float link_rate);
+
+	/**
+	 * @return true if size bytes at the given priority fit into the current budget
+	 */
+	bool allowed(Priority priority, unsigned size) const;
+
+	/**
+	 * Account bytes written to the link.
+	 */
+	void consume(unsigned size) { _budget.fetch_sub(static_cast<int32_t>(size)); }
+
+	int32_t budget() const { return _budget.load(); }
+	int32_t burst() const { return _burst.load(); }
+	float link_rate() const { return _link_rate; }
+
+private:
+	static constexpr float BURST_TIME = 0.1f; ///< bucket capacity [s of link bandwidth]
+	static constexpr int32_t BURST_MIN = 2 * 280; ///< room for at least two max. size packets
+
+	px4::atomic<int32_t> _budget{0};
+	px4::atomic<int32_t> _burst{BURST_MIN};
+
+	hrt_abstime _last_update{0};
+	float _link_rate{0.f};
+};
@@ -56,13 +56,13 @@ MavlinkULog::MavlinkULog(int datarate, float max_rate_factor, uint8_t target_sys
 	  _current_rate_factor(max_rate_factor)
 {
 	// make sure we won't read any old messages
-	while (_ulog_stream_sub.update()) {
+	while (_ulog_stream_sub.update(&_in_flight[0].data)) {
 
 	}
 
 	_waiting_for_initial_ack = true;
-	_last_sent_time = hrt_absolute_time(); //(ab)use this timestamp during initialization
-	_next_rate_check = _last_sent_time + _rate_calculation_delta_t;
+	_start_time = hrt_absolute_time();
+	_next_rate_check = _start_time + _rate_calculation_delta_t;
 }
 
 MavlinkULog::~MavlinkULog()
@@ -73,7 +73,6 @@ MavlinkULog::~MavlinkULog()
 void MavlinkULog::start_ack_received()
 {
 	if (_waiting_for_initial_ack) {
-		_last_sent_time = 0;
 		_waiting_for_initial_ack = false;
 		PX4_DEBUG("got logger ack");
 	}
@@ -85,9 +84,10 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 		      "Invalid uorb ulog_stream.data length");
 	static_assert(sizeof(ulog_stream_s::data) == MAVLINK_MSG_LOGGING_DATA_ACKED_FIELD_DATA_LEN,
 		      "Invalid uorb ulog_stream.data length");
+	static_assert(ACK_WINDOW <= ulog_stream_ack_s::ORB_QUEUE_LENGTH, "ulog_stream_ack queue too short");
 
 	if (_waiting_for_initial_ack) {
-		if (hrt_elapsed_time(&_last_sent_time) > 3e5) {
+		if (hrt_elapsed_time(&_start_time) > 3e5) {
 			PX4_WARN("no ack from logger (is it running?)");
 			return -1;
 		}
@@ -95,71 +95,55 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 		return 0;
 	}
 
-	// check if we're waiting for an ACK
-	if (_last_sent_time) {
-		bool check_for_updates = false;
+	// remove acked messages from the front of the window. Messages acked out of order stay until
+	// all the previous ones are acked as well.
+	lock();
 
-		if (_ack_received) {
-			_last_sent_time = 0;
-			check_for_updates = true;
+	while (_num_in_flight > 0 && _in_flight[_in_flight_first].acked) {
+		_in_flight_first = (_in_flight_first + 1) % ACK_WINDOW;
+		--_num_in_flight;
+	}
 
-		} else {
+	unlock();
+
+	// re-send the messages of the window that timed out. Only this thread modifies the data of
+	// the window, so it can be sent without holding the lock.
+	for (int i = 0; i < _num_in_flight; ++i) {
+		InFlightMessage &in_flight = _in_flight[(_in_flight_first + i) % ACK_WINDOW];
 
-			if (hrt_elapsed_time(&_last_sent_time) > ulog_stream_ack_s::ACK_TIMEOUT * 1000) {
-				if (++_sent_tries > ulog_stream_ack_s::ACK_MAX_TRIES) {
-					return -ETIMEDOUT;
-
-				} else {
-					PX4_DEBUG("re-sending ulog mavlink message (try=%i)", _sent_tries);
-					_last_sent_time = hrt_absolute_time();
-
-					const ulog_stream_s &ulog_data = _ulog_stream_sub.get();
-
-					mavlink_logging_data_acked_t msg;
-					msg.sequence = ulog_data.msg_sequence;
-					msg.length = ulog_data.length;
-					msg.first_message_offset = ulog_data.first_message_offset;
-					msg.target_system = _target_system;
-					msg.target_component = _target_component;
-					memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-					mavlink_msg_logging_data_acked_send_struct(channel, &msg);
-				}
+		if (!in_flight.acked && hrt_elapsed_time(&in_flight.last_sent_time) > ulog_stream_ack_s::ACK_TIMEOUT * 1000) {
+			if (++in_flight.sent_tries > ulog_stream_ack_s::ACK_MAX_TRIES) {
+				return -ETIMEDOUT;
 			}
-		}
 
-		if (!check_for_updates) {
-			return 0;
+			PX4_DEBUG("re-sending ulog mavlink message %i (try=%i)", in_flight.data.msg_sequence, in_flight.sent_tries);
+			in_flight.last_sent_time = hrt_absolute_time();
+			send_acked(channel, in_flight.data);
 		}
 	}
 
-
-	while ((_current_num_msgs < _max_num_messages) && _ulog_stream_sub.updated()) {
+	while ((_num_in_flight < ACK_WINDOW) && (_current_num_msgs < _max_num_messages) && _ulog_stream_sub.updated()) {
+		// read directly into the next free slot of the window, it's only kept if it needs an ack
+		InFlightMessage &next = _in_flight[(_in_flight_first + _num_in_flight) % ACK_WINDOW];
 		const unsigned last_generation = _ulog_stream_sub.get_last_generation();
-		_ulog_stream_sub.update();
+		_ulog_stream_sub.copy(&next.data);
 
 		if (_ulog_stream_sub.get_last_generation() != last_generation + 1) {
 			perf_count(_msg_missed_ulog_stream_perf);
 		}
 
-		const ulog_stream_s &ulog_data = _ulog_stream_sub.get();
+		const ulog_stream_s &ulog_data = next.data;
 
 		if (ulog_data.timestamp > 0) {
 			if (ulog_data.flags & ulog_stream_s::FLAGS_NEED_ACK) {
-				_sent_tries = 1;
-				_last_sent_time = hrt_absolute_time();
+				next.sent_tries = 1;
+				next.last_sent_time = hrt_absolute_time();
+				next.acked = false;
 				lock();
-				_wait_for_ack_sequence = ulog_data.msg_sequence;
-				_ack_received = false;
+				++_num_in_flight;
 				unlock();
 
-				mavlink_logging_data_acked_t msg;
-				msg.sequence = ulog_data.msg_sequence;
-				msg.length = ulog_data.length;
-				msg.first_message_offset = ulog_data.first_message_offset;
-				msg.target_system = _target_system;
-				msg.target_component = _target_component;
-				memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-				mavlink_msg_logging_data_acked_send_struct(channel, &msg);
+				send_acked(channel, ulog_data);
 
 			} else {
 				mavlink_logging_data_t msg;
@@ -196,6 +180,18 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 	return 0;
 }
 
+void MavlinkULog::send_acked(mavlink_channel_t channel, const ulog_stream_s &ulog_data)
+{
+	mavlink_logging_data_acked_t msg;
+	msg.sequence = ulog_data.msg_sequence;
+	msg.length = ulog_data.length;
+	msg.first_message_offset = ulog_data.first_message_offset;
+	msg.target_system = _target_system;
+	msg.target_component = _target_component;
+	memcpy(msg.data, ulog_data.data, sizeof(msg.data));
+	mavlink_msg_logging_data_acked_send_struct(channel, &msg);
+}
+
 void MavlinkULog::initialize()
 {
 	if (_init) {
@@ -247,9 +243,15 @@ void MavlinkULog::handle_ack(mavlink_logging_ack_t ack)
 	lock();
 
 	if (_instance) { // make sure stop() was not called right before
-		if (_wait_for_ack_sequence == ack.sequence) {
-			_ack_received = true;
-			publish_ack(ack.sequence);
+		// each message of the window is acked on its own (selective ack)
+		for (int i = 0; i < _num_in_flight; ++i) {
+			InFlightMessage &in_flight = _in_flight[(_in_flight_first + i) % ACK_WINDOW];
+
+			if (!in_flight.acked && in_flight.data.msg_sequence == ack.sequence) {
+				in_flight.acked = true;
+				publish_ack(ack.sequence);
+				break;
+			}
 		}
 	}
 
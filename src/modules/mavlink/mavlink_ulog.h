@@ -119,17 +119,33 @@ private:
 
 	void publish_ack(uint16_t sequence);
 
+	void send_acked(mavlink_channel_t channel, const ulog_stream_s &ulog_data);
+
+	/** message that requires an ack, kept until it is acked (the window is a ring buffer) */
+	struct InFlightMessage {
+		ulog_stream_s data;
+		hrt_abstime last_sent_time; ///< last time we (re-)sent the message
+		uint8_t sent_tries;
+		volatile bool acked; ///< set to true if a matching ack received
+	};
+
+#if defined(CONFIG_MAVLINK_ULOG_ACK_WINDOW)
+	static constexpr int ACK_WINDOW = ulog_stream_ack_s::ACK_WINDOW;
+#else
+	static constexpr int ACK_WINDOW = 1;
+#endif // CONFIG_MAVLINK_ULOG_ACK_WINDOW
+
 	static px4_sem_t _lock;
 	static bool _init;
 	static MavlinkULog *_instance;
 	static constexpr hrt_abstime _rate_calculation_delta_t = 100_ms; ///< rate update interval
 
-	uORB::SubscriptionData<ulog_stream_s> _ulog_stream_sub{ORB_ID(ulog_stream)};
+	uORB::Subscription _ulog_stream_sub{ORB_ID(ulog_stream)};
 	uORB::Publication<ulog_stream_ack_s> _ulog_stream_ack_pub{ORB_ID(ulog_stream_ack)};
-	uint16_t _wait_for_ack_sequence;
-	uint8_t _sent_tries = 0;
-	volatile bool _ack_received = false; ///< set to true if a matching ack received
-	hrt_abstime _last_sent_time = 0; ///< last time we sent a message that requires an ack
+	InFlightMessage _in_flight[ACK_WINDOW] {};
+	int _in_flight_first = 0; ///< index of the oldest message in the window
+	int _num_in_flight = 0; ///< number of messages in the window (acked ones are removed from the front)
+	hrt_abstime _start_time = 0; ///< time we started waiting for the initial ack
 	bool _waiting_for_initial_ack = false;
 	const uint8_t _target_system;
 	const uint8_t _target_component;
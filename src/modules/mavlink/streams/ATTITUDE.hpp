@@ -48,6 +48,8 @@ public:
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
 
+	Priority priority() const override { return Priority::High; }
+
 	unsigned get_size() override
 	{
 		return _att_sub.advertised() ? MAVLINK_MSG_ID_ATTITUDE_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES : 0;
@@ -61,31 +63,32 @@ private:
 
 	bool send() override
 	{
-		vehicle_attitude_s att;
-
-		if (_att_sub.update(&att)) {
-			vehicle_angular_velocity_s angular_velocity{};
-			_angular_velocity_sub.copy(&angular_velocity);
-
-			mavlink_attitude_t msg{};
-
-			const matrix::Eulerf euler = matrix::Quatf(att.q);
-			msg.time_boot_ms = att.timestamp / 1000;
-			msg.roll = euler.phi();
-			msg.pitch = euler.theta();
-			msg.yaw = euler.psi();
-
-			msg.rollspeed = angular_velocity.xyz[0];
-			msg.pitchspeed = angular_velocity.xyz[1];
-			msg.yawspeed = angular_velocity.xyz[2];
+		mavlink_attitude_t msg{};
 
+		if (MavlinkMessageCache::update<vehicle_attitude_s>(_att_sub, MAVLINK_MSG_ID_ATTITUDE, msg,
+		[this](const vehicle_attitude_s & sample, mavlink_attitude_t & m) { build(sample, m); })) {
 			mavlink_msg_attitude_send_struct(_mavlink->get_channel(), &msg);
-
 			return true;
 		}
 
 		return false;
 	}
+
+	void build(const vehicle_attitude_s &att, mavlink_attitude_t &msg)
+	{
+		vehicle_angular_velocity_s angular_velocity{};
+		_angular_velocity_sub.copy(&angular_velocity);
+
+		const matrix::Eulerf euler = matrix::Quatf(att.q);
+		msg.time_boot_ms = att.timestamp / 1000;
+		msg.roll = euler.phi();
+		msg.pitch = euler.theta();
+		msg.yaw = euler.psi();
+
+		msg.rollspeed = angular_velocity.xyz[0];
+		msg.pitchspeed = angular_velocity.xyz[1];
+		msg.yawspeed = angular_velocity.xyz[2];
+	}
 };
 
 #endif // ATTITUDE_HPP
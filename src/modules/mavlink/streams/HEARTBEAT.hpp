@@ -49,6 +49,8 @@ public:
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
 
+	Priority priority() const override { return Priority::Critical; }
+
 	bool const_rate() override { return true; }
 
 	unsigned get_size() override
@@ -70,6 +70,8 @@ public:
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
 
+	Priority priority() const override { return Priority::Critical; }
+
 	unsigned get_size() override
 	{
 		return MAVLINK_MSG_ID_HIGH_LATENCY2_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
@@ -108,6 +110,16 @@ private:
 		// only send the struct if transmitting is allowed
 		// this assures that the stream timer is only reset when actually a message is transmitted
 		if (_mavlink->should_transmit()) {
+#if defined(CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY)
+
+			// downsample further if the configured rate does not fit into the link share,
+			// the analysers keep accumulating until the message is actually sent
+			if (!adaptive_interval_elapsed(t)) {
+				return false;
+			}
+
+#endif // CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY
+
 			mavlink_high_latency2_t msg{};
 			set_default_values(msg);
 
@@ -203,6 +215,14 @@ private:
 
 				reset_analysers(t);
 
+#if defined(CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY)
+
+				if (!changed_or_keepalive(msg, t)) {
+					return true;
+				}
+
+#endif // CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY
+
 				mavlink_msg_high_latency2_send_struct(_mavlink->get_channel(), &msg);
 			}
 
@@ -240,6 +260,61 @@ private:
 		_last_reset_time = t;
 	}
 
+#if defined(CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY)
+	bool adaptive_interval_elapsed(const hrt_abstime t)
+	{
+		float link_share = 0.f;
+		param_get(_param_mav_hl_share, &link_share);
+
+		const float link_rate = link_share * _mavlink->get_link_rate();
+		hrt_abstime interval = math::max(get_interval(), 0);
+
+		if (link_rate > FLT_EPSILON) {
+			interval = math::max(interval, static_cast<hrt_abstime>(get_size() / link_rate * 1e6f));
+		}
+
+		// average over the whole downsampled interval (60 s window by default)
+		const float window = math::max(60.f, interval * 1e-6f);
+
+		if (fabsf(window - _analyser_window) > FLT_EPSILON) {
+			_airspeed.set_window(window);
+			_airspeed_sp.set_window(window);
+			_groundspeed.set_window(window);
+			_temperature.set_window(window);
+			_throttle.set_window(window);
+			_windspeed.set_window(window);
+
+			for (int i = 0; i < battery_status_s::MAX_INSTANCES; i++) {
+				_batteries[i].analyzer.set_window(window);
+			}
+
+			_analyser_window = window;
+		}
+
+		return (_last_transmit_time == 0) || (t >= _last_transmit_time + interval);
+	}
+
+	bool changed_or_keepalive(const mavlink_high_latency2_t &msg, const hrt_abstime t)
+	{
+		int32_t keepalive_s = 0;
+		param_get(_param_mav_hl_keepalive, &keepalive_s);
+
+		if ((keepalive_s > 0) && (_last_transmit_time != 0) && (t < _last_transmit_time + keepalive_s * 1_s)) {
+			// compare everything but the timestamp (the mavlink struct is packed)
+			mavlink_high_latency2_t last = _last_transmitted;
+			last.timestamp = msg.timestamp;
+
+			if (memcmp(&last, &msg, sizeof(msg)) == 0) {
+				return false;
+			}
+		}
+
+		_last_transmitted = msg;
+		_last_transmit_time = t;
+		return true;
+	}
+#endif // CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY
+
 	bool write_airspeed(mavlink_high_latency2_t *msg)
 	{
 		airspeed_s airspeed;
@@ -650,6 +725,14 @@ private:
 	SimpleAnalyzer _throttle;
 	SimpleAnalyzer _windspeed;
 
+#if defined(CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY)
+	param_t _param_mav_hl_share{param_find("MAV_HL_SHARE")};
+	param_t _param_mav_hl_keepalive{param_find("MAV_HL_KEEPALIVE")};
+	mavlink_high_latency2_t _last_transmitted{};
+	hrt_abstime _last_transmit_time{0};
+	float _analyser_window{60.f};
+#endif // CONFIG_MAVLINK_ADAPTIVE_HIGH_LATENCY
+
 	hrt_abstime _last_reset_time{0};
 	hrt_abstime _last_update_time{0};
 	float _update_rate_filtered{0};
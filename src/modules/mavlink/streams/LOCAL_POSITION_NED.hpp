@@ -59,27 +59,27 @@ private:
 
 	bool send() override
 	{
-		vehicle_local_position_s lpos;
-
-		if (_lpos_sub.update(&lpos)) {
-			mavlink_local_position_ned_t msg{};
-
-			msg.time_boot_ms = lpos.timestamp / 1000;
-			msg.x = lpos.x;
-			msg.y = lpos.y;
-			msg.z = lpos.z;
-			msg.vx = lpos.vx;
-			msg.vy = lpos.vy;
-			msg.vz = lpos.vz;
+		mavlink_local_position_ned_t msg{};
 
+		if (MavlinkMessageCache::update<vehicle_local_position_s>(_lpos_sub, MAVLINK_MSG_ID_LOCAL_POSITION_NED, msg,
+		[this](const vehicle_local_position_s & sample, mavlink_local_position_ned_t & m) { build(sample, m); })) {
 			mavlink_msg_local_position_ned_send_struct(_mavlink->get_channel(), &msg);
-
 			return true;
-
 		}
 
 		return false;
 	}
+
+	void build(const vehicle_local_position_s &lpos, mavlink_local_position_ned_t &msg)
+	{
+		msg.time_boot_ms = lpos.timestamp / 1000;
+		msg.x = lpos.x;
+		msg.y = lpos.y;
+		msg.z = lpos.z;
+		msg.vx = lpos.vx;
+		msg.vy = lpos.vy;
+		msg.vz = lpos.vz;
+	}
 };
 
 #endif // LOCAL_POSITION_NED_HPP
@@ -0,0 +1,81 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef TERRAIN_REQUEST_HPP
+#define TERRAIN_REQUEST_HPP
+
+#include <uORB/topics/terrain_request.h>
+
+class MavlinkStreamTerrainRequest : public MavlinkStream
+{
+public:
+	static MavlinkStream *new_instance(Mavlink *mavlink) { return new MavlinkStreamTerrainRequest(mavlink); }
+
+	static constexpr const char *get_name_static() { return "TERRAIN_REQUEST"; }
+	static constexpr uint16_t get_id_static() { return MAVLINK_MSG_ID_TERRAIN_REQUEST; }
+
+	const char *get_name() const override { return get_name_static(); }
+	uint16_t get_id() override { return get_id_static(); }
+
+	unsigned get_size() override
+	{
+		return _terrain_request_sub.advertised() ? (MAVLINK_MSG_ID_TERRAIN_REQUEST_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES) : 0;
+	}
+
+private:
+	explicit MavlinkStreamTerrainRequest(Mavlink *mavlink) : MavlinkStream(mavlink) {}
+
+	uORB::Subscription _terrain_request_sub{ORB_ID(terrain_request)};
+
+	bool send() override
+	{
+		terrain_request_s terrain_request;
+
+		if (_terrain_request_sub.update(&terrain_request)) {
+			mavlink_terrain_request_t msg{};
+
+			msg.lat = terrain_request.lat;
+			msg.lon = terrain_request.lon;
+			msg.grid_spacing = terrain_request.grid_spacing;
+			msg.mask = terrain_request.mask;
+
+			mavlink_msg_terrain_request_send_struct(_mavlink->get_channel(), &msg);
+
+			return true;
+		}
+
+		return false;
+	}
+};
+
+#endif // TERRAIN_REQUEST_HPP
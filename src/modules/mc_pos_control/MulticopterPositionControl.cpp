@@ -58,17 +58,43 @@ MulticopterPositionControl::MulticopterPositionControl(bool vtol) :
 MulticopterPositionControl::~MulticopterPositionControl()
 {
 	perf_free(_cycle_perf);
+	perf_free(_setpoint_age_perf);
 }
 
 bool MulticopterPositionControl::init()
 {
-	if (!_local_pos_sub.registerCallback()) {
-		PX4_ERR("callback registration failed");
-		return false;
+	_time_stamp_last_loop = hrt_absolute_time();
+
+	return updateScheduling();
+}
+
+bool MulticopterPositionControl::updateScheduling()
+{
+	const int32_t loop_rate = _param_mpc_loop_rate.get();
+	const int32_t loop_interval_us = (loop_rate > 0) ? (1000000 / math::min(loop_rate, (int32_t)500)) : 0;
+
+	if (loop_interval_us == _loop_interval_us) {
+		return true;
 	}
 
-	_time_stamp_last_loop = hrt_absolute_time();
-	ScheduleNow();
+	_loop_interval_us = loop_interval_us;
+
+	if (_loop_interval_us > 0) {
+		// fixed rate, from the latest estimate predicted to the current time
+		_local_pos_sub.unregisterCallback();
+		ScheduleOnInterval(_loop_interval_us);
+
+	} else {
+		// run on every vehicle_local_position publication
+		ScheduleClear();
+
+		if (!_local_pos_sub.registerCallback()) {
+			PX4_ERR("callback registration failed");
+			return false;
+		}
+
+		ScheduleNow();
+	}
 
 	return true;
 }
@@ -271,6 +297,11 @@ void MulticopterPositionControl::parameters_update(bool force)
 		_takeoff.setSpoolupTime(_param_com_spoolup_time.get());
 		_takeoff.setTakeoffRampTime(_param_mpc_tko_ramp_t.get());
 		_takeoff.generateInitialRampValue(_param_mpc_z_vel_p_acc.get());
+
+		if (_loop_interval_us >= 0) {
+			// already scheduled by init()
+			updateScheduling();
+		}
 	}
 }
 
@@ -337,15 +368,17 @@ void MulticopterPositionControl::Run()
 		return;
 	}
 
-	// reschedule backup
-	ScheduleDelayed(100_ms);
+	if (_loop_interval_us == 0) {
+		// reschedule backup
+		ScheduleDelayed(100_ms);
+	}
 
 	parameters_update(false);
 
 	perf_begin(_cycle_perf);
 	vehicle_local_position_s vehicle_local_position;
 
-	if (_local_pos_sub.update(&vehicle_local_position)) {
+	if (updateLocalPosition(vehicle_local_position)) {
 		const float dt =
 			math::constrain(((vehicle_local_position.timestamp_sample - _time_stamp_last_loop) * 1e-6f), 0.002f, 0.04f);
 		_time_stamp_last_loop = vehicle_local_position.timestamp_sample;
@@ -387,7 +420,10 @@ void MulticopterPositionControl::Run()
 			_goto_control.update(dt, states.position, states.yaw);
 		}
 
-		_trajectory_setpoint_sub.update(&_setpoint);
+		if (_trajectory_setpoint_sub.update(&_setpoint) && (_setpoint.timestamp_sample != 0)) {
+			// time from the generation of an external setpoint by the sender until it is used by the controller
+			perf_set_elapsed(_setpoint_age_perf, hrt_elapsed_time(&_setpoint.timestamp_sample));
+		}
 
 		adjustSetpointForEKFResets(vehicle_local_position, _setpoint);
 
@@ -496,7 +532,12 @@ void MulticopterPositionControl::Run()
 				math::min(speed_up, _param_mpc_z_vel_max_up.get()), // takeoff ramp starts with negative velocity limit
 				math::max(speed_down, 0.f));
 
-			_control.setInputSetpoint(_setpoint);
+			if (_param_mpc_sp_pred_max.get() > FLT_EPSILON) {
+				_control.setInputSetpoint(predictSetpoint(_setpoint, vehicle_local_position.timestamp_sample));
+
+			} else {
+				_control.setInputSetpoint(_setpoint);
+			}
 
 			// update states
 			if (!PX4_ISFINITE(_setpoint.position[2])
@@ -558,6 +599,92 @@ void MulticopterPositionControl::Run()
 	perf_end(_cycle_perf);
 }
 
+bool MulticopterPositionControl::updateLocalPosition(vehicle_local_position_s &local_pos)
+{
+	if (_loop_interval_us <= 0) {
+		return _local_pos_sub.update(&local_pos);
+	}
+
+	if (!_local_pos_sub.copy(&local_pos) || (local_pos.timestamp_sample == 0)) {
+		return false;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	if ((now < local_pos.timestamp_sample) || (now - local_pos.timestamp_sample > LOCAL_POSITION_PREDICTION_MAX_AGE_US)) {
+		// no recent estimate, don't control on a stale state
+		return false;
+	}
+
+	const float dt = (now - local_pos.timestamp_sample) * 1e-6f;
+
+	const bool acc_xy_valid = PX4_ISFINITE(local_pos.ax) && PX4_ISFINITE(local_pos.ay);
+	const bool acc_z_valid = PX4_ISFINITE(local_pos.az);
+
+	if (local_pos.xy_valid && local_pos.v_xy_valid) {
+		local_pos.x += local_pos.vx * dt;
+		local_pos.y += local_pos.vy * dt;
+
+		if (acc_xy_valid) {
+			local_pos.x += 0.5f * local_pos.ax * dt * dt;
+			local_pos.y += 0.5f * local_pos.ay * dt * dt;
+		}
+	}
+
+	if (local_pos.v_xy_valid && acc_xy_valid) {
+		local_pos.vx += local_pos.ax * dt;
+		local_pos.vy += local_pos.ay * dt;
+	}
+
+	if (local_pos.z_valid && local_pos.v_z_valid) {
+		local_pos.z += local_pos.vz * dt;
+
+		if (acc_z_valid) {
+			local_pos.z += 0.5f * local_pos.az * dt * dt;
+		}
+	}
+
+	if (local_pos.v_z_valid && acc_z_valid) {
+		local_pos.vz += local_pos.az * dt;
+	}
+
+	local_pos.timestamp_sample = now;
+	return true;
+}
+
+trajectory_setpoint_s MulticopterPositionControl::predictSetpoint(const trajectory_setpoint_s &setpoint,
+		const hrt_abstime &now) const
+{
+	if ((setpoint.timestamp_sample == 0) || (now <= setpoint.timestamp_sample)) {
+		return setpoint;
+	}
+
+	const float dt = math::min((now - setpoint.timestamp_sample) * 1e-6f, _param_mpc_sp_pred_max.get());
+	trajectory_setpoint_s predicted{setpoint};
+
+	for (int i = 0; i < 3; i++) {
+		const bool acceleration_valid = PX4_ISFINITE(setpoint.acceleration[i]);
+
+		if (PX4_ISFINITE(setpoint.position[i]) && PX4_ISFINITE(setpoint.velocity[i])) {
+			predicted.position[i] += setpoint.velocity[i] * dt;
+
+			if (acceleration_valid) {
+				predicted.position[i] += 0.5f * setpoint.acceleration[i] * dt * dt;
+			}
+		}
+
+		if (PX4_ISFINITE(setpoint.velocity[i]) && acceleration_valid) {
+			predicted.velocity[i] += setpoint.acceleration[i] * dt;
+		}
+	}
+
+	if (PX4_ISFINITE(setpoint.yaw) && PX4_ISFINITE(setpoint.yawspeed)) {
+		predicted.yaw = wrap_pi(setpoint.yaw + setpoint.yawspeed * dt);
+	}
+
+	return predicted;
+}
+
 trajectory_setpoint_s MulticopterPositionControl::generateFailsafeSetpoint(const hrt_abstime &now,
 		const PositionControlStates &states, bool warn)
 {
@@ -181,7 +181,9 @@ private:
 
 		(ParamFloat<px4::params::MPC_XY_ERR_MAX>) _param_mpc_xy_err_max,
 		(ParamFloat<px4::params::MPC_YAWRAUTO_MAX>) _param_mpc_yawrauto_max,
-		(ParamFloat<px4::params::MPC_YAWRAUTO_ACC>) _param_mpc_yawrauto_acc
+		(ParamFloat<px4::params::MPC_YAWRAUTO_ACC>) _param_mpc_yawrauto_acc,
+		(ParamFloat<px4::params::MPC_SP_PRED_MAX>)  _param_mpc_sp_pred_max,
+		(ParamInt<px4::params::MPC_LOOP_RATE>)      _param_mpc_loop_rate
 	);
 
 	control::BlockDerivative _vel_x_deriv; /**< velocity derivative in x */
@@ -203,6 +205,11 @@ private:
 
 	static constexpr float MAX_SAFE_TILT_DEG = 89.f; // Numerical issues above this value due to tanf
 
+	/** Maximum age in us of the estimate predicted to the current time in fixed rate mode */
+	static constexpr uint64_t LOCAL_POSITION_PREDICTION_MAX_AGE_US = 50_ms;
+
+	int32_t _loop_interval_us{-1}; ///< fixed loop interval (MPC_LOOP_RATE), 0 when run by vehicle_local_position, -1 before init()
+
 	SlewRate<float> _tilt_limit_slew_rate;
 
 	uint8_t _vxy_reset_counter{0};
@@ -212,6 +219,7 @@ private:
 	uint8_t _heading_reset_counter{0};
 
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle time")};
+	perf_counter_t _setpoint_age_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": setpoint age")};
 
 	/**
 	 * Update our local parameter cache.
@@ -220,6 +228,20 @@ private:
 	 */
 	void parameters_update(bool force);
 
+	/**
+	 * Run on every vehicle_local_position publication or at the fixed rate MPC_LOOP_RATE.
+	 * @return true on success
+	 */
+	bool updateScheduling();
+
+	/**
+	 * Get the state estimate of this cycle. At a fixed loop rate the latest estimate is predicted
+	 * to the current time with its velocity and acceleration.
+	 * @param local_pos estimate to run the controller on
+	 * @return true if there is a new (or, at a fixed rate, a recent) estimate
+	 */
+	bool updateLocalPosition(vehicle_local_position_s &local_pos);
+
 	/**
 	 * Check for validity of positon/velocity states.
 	 */
@@ -232,6 +254,14 @@ private:
 	 */
 	trajectory_setpoint_s generateFailsafeSetpoint(const hrt_abstime &now, const PositionControlStates &states, bool warn);
 
+	/**
+	 * Predict an external setpoint from the sender time (timestamp_sample) to the given time
+	 * using its velocity, acceleration and yaw rate feed-forward, limited to MPC_SP_PRED_MAX.
+	 * @param setpoint trajectory setpoint, returned unchanged without sender time
+	 * @param now time to predict the setpoint to
+	 */
+	trajectory_setpoint_s predictSetpoint(const trajectory_setpoint_s &setpoint, const hrt_abstime &now) const;
+
 	/**
 	 * @brief adjust existing (or older) setpoint with any EKF reset deltas and update the local counters
 	 *
@@ -121,19 +121,24 @@ void bodyzToAttitude(Vector3f body_z, const float yaw_sp, vehicle_attitude_setpo
 
 Vector2f constrainXY(const Vector2f &v0, const Vector2f &v1, const float &max)
 {
-	if (Vector2f(v0 + v1).norm() <= max) {
+	// magnitudes are compared squared, only the saturated cases need a square root
+	const Vector2f sum = v0 + v1;
+	const float max_squared = max * max;
+	const float v0_norm_squared = v0.norm_squared();
+
+	if (sum.norm_squared() <= max_squared) {
 		// vector does not exceed maximum magnitude
-		return v0 + v1;
+		return sum;
 
-	} else if (v0.length() >= max) {
+	} else if (v0_norm_squared >= max_squared) {
 		// the magnitude along v0, which has priority, already exceeds maximum.
 		return v0.normalized() * max;
 
-	} else if (fabsf(Vector2f(v1 - v0).norm()) < 0.001f) {
+	} else if (Vector2f(v1 - v0).norm_squared() < 0.001f * 0.001f) {
 		// the two vectors are equal
 		return v0.normalized() * max;
 
-	} else if (v0.length() < 0.001f) {
+	} else if (v0_norm_squared < 0.001f * 0.001f) {
 		// the first vector is 0.
 		return v1.normalized() * max;
 
@@ -177,7 +182,7 @@ Vector2f constrainXY(const Vector2f &v0, const Vector2f &v1, const float &max)
 		// 	- (max - ||v||) always larger than zero, otherwise it never entered this if-statement
 		Vector2f u1 = v1.normalized();
 		float m = u1.dot(v0);
-		float c = v0.dot(v0) - max * max;
+		float c = v0_norm_squared - max_squared;
 		float s = -m + sqrtf(m * m - c);
 		return v0 + u1 * s;
 	}
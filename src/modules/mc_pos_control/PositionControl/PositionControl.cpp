@@ -44,7 +44,7 @@
 
 using namespace matrix;
 
-const trajectory_setpoint_s PositionControl::empty_trajectory_setpoint = {0, {NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}, NAN, NAN};
+const trajectory_setpoint_s PositionControl::empty_trajectory_setpoint = {0, 0, {NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}, NAN, NAN};
 
 void PositionControl::setVelocityGains(const Vector3f &P, const Vector3f &I, const Vector3f &D)
 {
@@ -158,28 +158,27 @@ void PositionControl::_velocityControl(const float dt)
 	}
 
 	// Prioritize vertical control while keeping a horizontal margin
-	const Vector2f thrust_sp_xy(_thr_sp);
-	const float thrust_sp_xy_norm = thrust_sp_xy.norm();
+	// (in squared norms, a square root is only needed for the saturations)
+	const float thrust_sp_xy_norm_squared = Vector2f(_thr_sp).norm_squared();
 	const float thrust_max_squared = math::sq(_lim_thr_max);
 
 	// Determine how much vertical thrust is left keeping horizontal margin
-	const float allocated_horizontal_thrust = math::min(thrust_sp_xy_norm, _lim_thr_xy_margin);
-	const float thrust_z_max_squared = thrust_max_squared - math::sq(allocated_horizontal_thrust);
+	const float allocated_horizontal_thrust_squared = math::min(thrust_sp_xy_norm_squared, math::sq(_lim_thr_xy_margin));
+	const float thrust_z_max_squared = thrust_max_squared - allocated_horizontal_thrust_squared;
 
 	// Saturate maximal vertical thrust
-	_thr_sp(2) = math::max(_thr_sp(2), -sqrtf(thrust_z_max_squared));
+	if (math::sq(_thr_sp(2)) > thrust_z_max_squared && _thr_sp(2) < 0.f) {
+		_thr_sp(2) = -sqrtf(thrust_z_max_squared);
+	}
 
 	// Determine how much horizontal thrust is left after prioritizing vertical control
-	const float thrust_max_xy_squared = thrust_max_squared - math::sq(_thr_sp(2));
-	float thrust_max_xy = 0.f;
-
-	if (thrust_max_xy_squared > 0.f) {
-		thrust_max_xy = sqrtf(thrust_max_xy_squared);
-	}
+	const float thrust_max_xy_squared = math::max(thrust_max_squared - math::sq(_thr_sp(2)), 0.f);
 
 	// Saturate thrust in horizontal direction
-	if (thrust_sp_xy_norm > thrust_max_xy) {
-		_thr_sp.xy() = thrust_sp_xy / thrust_sp_xy_norm * thrust_max_xy;
+	if (thrust_sp_xy_norm_squared > thrust_max_xy_squared) {
+		const float scale = sqrtf(thrust_max_xy_squared / thrust_sp_xy_norm_squared);
+		_thr_sp(0) *= scale;
+		_thr_sp(1) *= scale;
 	}
 
 	// Use tracking Anti-Windup for horizontal direction: during saturation, the integrator is used to unsaturate the output
@@ -204,12 +203,24 @@ void PositionControl::_velocityControl(const float dt)
 void PositionControl::_accelerationControl()
 {
 	// Assume standard acceleration due to gravity in vertical direction for attitude generation
-	Vector3f body_z = Vector3f(-_acc_sp(0), -_acc_sp(1), CONSTANTS_ONE_G).normalized();
-	ControlMath::limitTilt(body_z, Vector3f(0, 0, 1), _lim_tilt);
+	// body_z = (-acc_x, -acc_y, g) / ||(-acc_x, -acc_y, g)||
+	const float acc_xy_norm_squared = math::sq(_acc_sp(0)) + math::sq(_acc_sp(1));
+	const float inverse_norm = 1.f / sqrtf(acc_xy_norm_squared + CONSTANTS_ONE_G * CONSTANTS_ONE_G);
+	Vector3f body_z(-_acc_sp(0) * inverse_norm, -_acc_sp(1) * inverse_norm, CONSTANTS_ONE_G * inverse_norm);
+
+	// Limit the tilt, same result as ControlMath::limitTilt() around the vertical:
+	// the tilt exceeds the limit if body_z(2) = cos(tilt) < cos(limit)
+	if ((body_z(2) < _lim_tilt_cos) && (acc_xy_norm_squared > FLT_EPSILON)) {
+		const float horizontal_scale = _lim_tilt_sin / sqrtf(acc_xy_norm_squared);
+		body_z(0) = -_acc_sp(0) * horizontal_scale;
+		body_z(1) = -_acc_sp(1) * horizontal_scale;
+		body_z(2) = _lim_tilt_cos;
+	}
+
 	// Scale thrust assuming hover thrust produces standard gravity
 	float collective_thrust = _acc_sp(2) * (_hover_thrust / CONSTANTS_ONE_G) - _hover_thrust;
 	// Project thrust to planned body attitude
-	collective_thrust /= (Vector3f(0, 0, 1).dot(body_z));
+	collective_thrust /= body_z(2);
 	collective_thrust = math::min(collective_thrust, -_lim_thr_min);
 	_thr_sp = body_z * collective_thrust;
 }
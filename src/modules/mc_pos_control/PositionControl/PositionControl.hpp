@@ -118,7 +118,13 @@ public:
 	 * Set the maximum tilt angle in radians the output attitude is allowed to have
 	 * @param tilt angle in radians from level orientation
 	 */
-	void setTiltLimit(const float tilt) { _lim_tilt = tilt; }
+	void setTiltLimit(const float tilt)
+	{
+		_lim_tilt = tilt;
+		// the tilt limit is applied without trigonometry in the loop
+		_lim_tilt_cos = cosf(tilt);
+		_lim_tilt_sin = sinf(tilt);
+	}
 
 	/**
 	 * Set the normalized hover thrust
@@ -209,6 +215,8 @@ private:
 	float _lim_thr_max{}; ///< Maximum collective thrust allowed as output [-1,0] e.g. -0.1
 	float _lim_thr_xy_margin{}; ///< Margin to keep for horizontal control when saturating prioritized vertical thrust
 	float _lim_tilt{}; ///< Maximum tilt from level the output attitude is allowed to have
+	float _lim_tilt_cos{1.f}; ///< cos(_lim_tilt)
+	float _lim_tilt_sin{0.f}; ///< sin(_lim_tilt)
 
 	float _hover_thrust{}; ///< Thrust [HOVER_THRUST_MIN, HOVER_THRUST_MAX] with which the vehicle hovers not accelerating down or up with level orientation
 
@@ -33,6 +33,8 @@
 
 #include <gtest/gtest.h>
 #include <PositionControl.hpp>
+#include <ControlMath.hpp>
+#include <geo/geo.h>
 #include <px4_defines.h>
 
 using namespace matrix;
@@ -380,3 +382,32 @@ TEST_F(PositionControlBasicTest, IntegratorWindupWithInvalidSetpoint)
 	EXPECT_FLOAT_EQ(_attitude.roll_body, 0.f);
 	EXPECT_FLOAT_EQ(_attitude.pitch_body, 0.f);
 }
+
+TEST_F(PositionControlBasicTest, TiltLimitMatchesControlMath)
+{
+	// GIVEN: a tilt limit that is often reached and thrust limits that are not
+	const float tilt_limit = .3f;
+	const float hover_thrust = .5f;
+	_position_control.setTiltLimit(tilt_limit);
+	_position_control.setThrustLimits(0.1f, 1.f);
+	_position_control.setHoverThrust(hover_thrust);
+
+	for (int i = 0; i < 100; i++) {
+		// WHEN: we only command an acceleration
+		const Vector3f acceleration(-3.f + .06f * i, 2.f - .05f * (i % 17), -2.f + .04f * (i % 23));
+		_input_setpoint = PositionControl::empty_trajectory_setpoint;
+		acceleration.copyTo(_input_setpoint.acceleration);
+		EXPECT_TRUE(runController());
+
+		// THEN: the thrust is the one of the generic tilt limitation
+		Vector3f body_z = Vector3f(-acceleration(0), -acceleration(1), CONSTANTS_ONE_G).normalized();
+		ControlMath::limitTilt(body_z, Vector3f(0.f, 0.f, 1.f), tilt_limit);
+		const float collective_thrust = math::min((acceleration(2) * (hover_thrust / CONSTANTS_ONE_G) - hover_thrust) / body_z(2),
+						-.1f);
+		const Vector3f thrust_expected = body_z * collective_thrust;
+
+		for (int axis = 0; axis < 3; axis++) {
+			EXPECT_NEAR(_output_setpoint.thrust[axis], thrust_expected(axis), 1e-5f) << "sample " << i << " axis " << axis;
+		}
+	}
+}
@@ -85,3 +85,37 @@ PARAM_DEFINE_FLOAT(MPC_THR_XY_MARG, 0.3f);
  * @group Multicopter Position Control
  */
 PARAM_DEFINE_FLOAT(MPC_VELD_LP, 5.0f);
+
+/**
+ * Maximum prediction time of external setpoints
+ *
+ * Offboard setpoints that carry the time they were generated by the sender
+ * (MAVLink time_boot_ms or trajectory_setpoint.timestamp_sample over DDS) are
+ * predicted forward with their velocity, acceleration and yaw rate to the time
+ * of the state estimate used by the controller. This compensates the link latency.
+ * The prediction time is limited to this value, 0 disables the prediction.
+ *
+ * @unit s
+ * @min 0
+ * @max 0.5
+ * @decimal 3
+ * @increment 0.005
+ * @group Multicopter Position Control
+ */
+PARAM_DEFINE_FLOAT(MPC_SP_PRED_MAX, 0.f);
+
+/**
+ * Position control loop rate
+ *
+ * By default (0) the position controller runs on every vehicle_local_position
+ * update of the estimator. Otherwise it runs at this fixed rate on the latest
+ * estimate, predicted to the current time with the estimated velocity and
+ * acceleration. Use together with EKF2_OUT_HR for a higher position loop bandwidth.
+ * The trajectory setpoint generation is not affected.
+ *
+ * @unit Hz
+ * @min 0
+ * @max 500
+ * @group Multicopter Position Control
+ */
+PARAM_DEFINE_INT32(MPC_LOOP_RATE, 0);
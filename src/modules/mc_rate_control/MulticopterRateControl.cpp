@@ -64,6 +64,9 @@ MulticopterRateControl::~MulticopterRateControl()
 bool
 MulticopterRateControl::init()
 {
+	// run right after vehicle_angular_velocity is published on wq:rate_ctrl (CONFIG_WORK_QUEUE_CHAINING)
+	_vehicle_angular_velocity_sub.set_chained(true);
+
 	if (!_vehicle_angular_velocity_sub.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
@@ -36,37 +36,116 @@
 
 const bool mUORB::Aggregator::debugFlag = false;
 
-bool mUORB::Aggregator::NewRecordOverflows(const char *messageName, int32_t length)
+#if defined(CONFIG_MUORB_SLPI_PRIORITY_LANES)
+// high-rate sensor topics (prefix match, e.g. also sensor_gyro_fifo) sent in the high priority lane
+static const char *const highPriorityTopics[] = {
+	"sensor_accel",
+	"sensor_gyro",
+	"vehicle_imu",
+	"vehicle_angular_velocity",
+	"vehicle_attitude",
+};
+#endif
+
+mUORB::Aggregator::LaneId mUORB::Aggregator::GetLane(const char *messageName) const
+{
+#if defined(CONFIG_MUORB_SLPI_PRIORITY_LANES)
+
+	for (const char *prefix : highPriorityTopics) {
+		if (strncmp(messageName, prefix, strlen(prefix)) == 0) {
+			return LANE_HIGH_PRIORITY;
+		}
+	}
+
+#endif
+	return LANE_LOW_PRIORITY;
+}
+
+hrt_abstime mUORB::Aggregator::FlushAge(LaneId lane) const
+{
+#if defined(CONFIG_MUORB_SLPI_PRIORITY_LANES)
+
+	if (lane == LANE_HIGH_PRIORITY) {
+		// flush as often as possible while keeping the RPC duty cycle at 1 / rpcCostToFlushAge
+		const hrt_abstime age = static_cast<hrt_abstime>(rpcCostUs * rpcCostToFlushAge);
+		return (age < highPriorityMaxAgeUs) ? age : highPriorityMaxAgeUs;
+	}
+
+	return lowPriorityMaxAgeUs;
+#else
+	// single lane: flushed on every poll
+	(void)lane;
+	return 0;
+#endif
+}
+
+bool mUORB::Aggregator::NewRecordOverflows(const Lane &lane, const char *messageName, int32_t length)
 {
 	if (! messageName) { return false; }
 
 	uint32_t messageNameLength = strlen(messageName);
 	uint32_t newMessageRecordTotalLength = headerSize + messageNameLength + length;
-	return ((bufferWriteIndex + newMessageRecordTotalLength) > bufferSize);
+	return ((lane.bufferWriteIndex + newMessageRecordTotalLength) > bufferSize);
 }
 
-void mUORB::Aggregator::MoveToNextBuffer()
+void mUORB::Aggregator::MoveToNextBuffer(Lane &lane)
 {
-	bufferWriteIndex = 0;
-	bufferId++;
-	bufferId %= numBuffers;
+	lane.bufferWriteIndex = 0;
+	lane.bufferId++;
+	lane.bufferId %= numBuffers;
 }
 
-void mUORB::Aggregator::AddRecordToBuffer(const char *messageName, int32_t length, const uint8_t *data)
+void mUORB::Aggregator::AddRecordToBuffer(Lane &lane, const char *messageName, int32_t length, const uint8_t *data)
 {
 	if (! messageName) { return; }
 
+	if (lane.bufferWriteIndex == 0) {
+		lane.oldestRecordTime = hrt_absolute_time();
+	}
+
+	uint8_t *buffer = lane.buffer[lane.bufferId];
+	uint32_t &bufferWriteIndex = lane.bufferWriteIndex;
+
 	uint32_t messageNameLength = strlen(messageName);
-	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) &syncFlag, syncFlagSize);
+	memcpy(&buffer[bufferWriteIndex], (uint8_t *) &syncFlag, syncFlagSize);
 	bufferWriteIndex += syncFlagSize;
-	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) &messageNameLength, topicNameLengthSize);
+	memcpy(&buffer[bufferWriteIndex], (uint8_t *) &messageNameLength, topicNameLengthSize);
 	bufferWriteIndex += topicNameLengthSize;
-	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) &length, dataLengthSize);
+	memcpy(&buffer[bufferWriteIndex], (uint8_t *) &length, dataLengthSize);
 	bufferWriteIndex += dataLengthSize;
-	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) messageName, messageNameLength);
+	memcpy(&buffer[bufferWriteIndex], (uint8_t *) messageName, messageNameLength);
 	bufferWriteIndex += messageNameLength;
-	memcpy(&buffer[bufferId][bufferWriteIndex], data, length);
+	memcpy(&buffer[bufferWriteIndex], data, length);
 	bufferWriteIndex += length;
+
+	lane.stats.messages++;
+}
+
+int16_t mUORB::Aggregator::SendLane(Lane &lane)
+{
+	int16_t rc = 0;
+
+	if (lane.bufferWriteIndex) {
+		const hrt_abstime send_start = hrt_absolute_time();
+		rc = sendFunc(topicName.c_str(), lane.buffer[lane.bufferId], lane.bufferWriteIndex);
+		const hrt_abstime now = hrt_absolute_time();
+
+		// low-pass filter the RPC cost, it drives the flush age of the high priority lane
+		rpcCostUs += 0.1f * (static_cast<float>(now - send_start) - rpcCostUs);
+
+		const uint32_t latency = static_cast<uint32_t>(now - lane.oldestRecordTime);
+		lane.stats.bytes += lane.bufferWriteIndex;
+		lane.stats.flushes++;
+		lane.stats.latencySumUs += latency;
+
+		if (latency > lane.stats.latencyMaxUs) {
+			lane.stats.latencyMaxUs = latency;
+		}
+
+		MoveToNextBuffer(lane);
+	}
+
+	return rc;
 }
 
 int16_t mUORB::Aggregator::SendData()
@@ -75,9 +154,33 @@ int16_t mUORB::Aggregator::SendData()
 
 	if (sendFunc) {
 		if (aggregationEnabled) {
-			if (bufferWriteIndex) {
-				rc = sendFunc(topicName.c_str(), buffer[bufferId], bufferWriteIndex);
-				MoveToNextBuffer();
+			for (Lane &lane : lanes) {
+				int16_t lane_rc = SendLane(lane);
+
+				if (lane_rc) { rc = lane_rc; }
+			}
+		}
+	}
+
+	return rc;
+}
+
+int16_t mUORB::Aggregator::SendTimedOutData()
+{
+	int16_t rc = 0;
+
+	if (sendFunc) {
+		if (aggregationEnabled) {
+			const hrt_abstime now = hrt_absolute_time();
+
+			for (uint32_t i = 0; i < numLanes; i++) {
+				Lane &lane = lanes[i];
+
+				if (lane.bufferWriteIndex && (now - lane.oldestRecordTime >= FlushAge(static_cast<LaneId>(i)))) {
+					int16_t lane_rc = SendLane(lane);
+
+					if (lane_rc) { rc = lane_rc; }
+				}
 			}
 		}
 	}
@@ -91,11 +194,26 @@ int16_t mUORB::Aggregator::ProcessTransmitTopic(const char *topic, const uint8_t
 
 	if (sendFunc) {
 		if (aggregationEnabled) {
-			if (NewRecordOverflows(topic, length_in_bytes)) {
-				rc = SendData();
+			if (! topic) { return rc; }
+
+			const LaneId lane_id = GetLane(topic);
+			Lane &lane = lanes[lane_id];
+
+			if (NewRecordOverflows(lane, topic, length_in_bytes)) {
+				rc = SendLane(lane);
+			}
+
+			AddRecordToBuffer(lane, topic, length_in_bytes, data);
+
+#if defined(CONFIG_MUORB_SLPI_PRIORITY_LANES)
+
+			// don't wait for the next poll if the high priority lane is already due
+			if ((lane_id == LANE_HIGH_PRIORITY)
+			    && (hrt_absolute_time() - lane.oldestRecordTime >= FlushAge(LANE_HIGH_PRIORITY))) {
+				rc = SendLane(lane);
 			}
 
-			AddRecordToBuffer(topic, length_in_bytes, data);
+#endif
 
 		} else if (topic) {
 			rc = sendFunc(topic, data, length_in_bytes);
@@ -105,6 +223,24 @@ int16_t mUORB::Aggregator::ProcessTransmitTopic(const char *topic, const uint8_t
 	return rc;
 }
 
+void mUORB::Aggregator::PrintStatus()
+{
+	static const char *const laneNames[] = {"high priority", "low priority"};
+
+	for (uint32_t i = 0; i < numLanes; i++) {
+		const LaneStats &stats = lanes[i].stats;
+		const char *name = (numLanes == 1) ? "aggregation" : laneNames[i];
+
+		PX4_INFO("%s: %u msgs, %u bytes, %u flushes (%.0f bytes/flush), latency avg %.0f us, max %u us, flush age %u us",
+			 name, stats.messages, stats.bytes, stats.flushes,
+			 (double)(stats.flushes ? (float)stats.bytes / stats.flushes : 0.f),
+			 (double)(stats.flushes ? (float)stats.latencySumUs / stats.flushes : 0.f),
+			 stats.latencyMaxUs, (unsigned)FlushAge(static_cast<LaneId>(i)));
+	}
+
+	PX4_INFO("RPC cost: %.0f us", (double)rpcCostUs);
+}
+
 void mUORB::Aggregator::ProcessReceivedTopic(const char *topic, const uint8_t *data, uint32_t length_in_bytes)
 {
 	if (isAggregate(topic)) {
@@ -35,6 +35,8 @@
 
 #include <string>
 #include <string.h>
+#include <px4_platform_common/px4_config.h>
+#include <drivers/drv_hrt.h>
 #include "uORB/uORBCommunicator.hpp"
 
 namespace mUORB
@@ -53,8 +55,24 @@ public:
 
 	void ProcessReceivedTopic(const char *topic, const uint8_t *data, uint32_t length_in_bytes);
 
+	/**
+	 * Send the data of all lanes.
+	 */
 	int16_t SendData();
 
+	/**
+	 * Send the data of the lanes whose oldest record exceeds the lane's flush age (called periodically).
+	 */
+	int16_t SendTimedOutData();
+
+	void PrintStatus();
+
+#if defined(CONFIG_MUORB_SLPI_PRIORITY_LANES)
+	static constexpr uint32_t pollIntervalUs = 1000;
+#else
+	static constexpr uint32_t pollIntervalUs = 2000;
+#endif
+
 private:
 	static const bool debugFlag;
 
@@ -71,9 +89,45 @@ private:
 	static const uint32_t numBuffers = 2;
 	static const uint32_t bufferSize = 2048;
 
-	uint32_t bufferId;
-	uint32_t bufferWriteIndex;
-	uint8_t  buffer[numBuffers][bufferSize];
+#if defined(CONFIG_MUORB_SLPI_PRIORITY_LANES)
+	/**
+	 * High-rate sensor data (high priority lane) is batched separately from the remaining topics, so it does not
+	 * wait for low priority traffic to fill a buffer. The high priority lane is flushed once its oldest record is
+	 * older than a multiple of the measured RPC cost (so the time spent in the RPC stays bounded), limited by
+	 * highPriorityMaxAgeUs. The low priority lane is flushed when full or after lowPriorityMaxAgeUs.
+	 */
+	static const uint32_t numLanes = 2;
+	static constexpr hrt_abstime highPriorityMaxAgeUs = 2000;
+	static constexpr hrt_abstime lowPriorityMaxAgeUs = 10000;
+	static constexpr float rpcCostToFlushAge = 10.f;
+#else
+	static const uint32_t numLanes = 1;
+#endif
+
+	enum LaneId : uint8_t {
+		LANE_HIGH_PRIORITY = 0,
+		LANE_LOW_PRIORITY = numLanes - 1,
+	};
+
+	struct LaneStats {
+		uint32_t messages{0};
+		uint32_t bytes{0};
+		uint32_t flushes{0};
+		uint64_t latencySumUs{0};  ///< age of the oldest record when its buffer was sent (including the RPC)
+		uint32_t latencyMaxUs{0};
+	};
+
+	struct Lane {
+		uint32_t bufferId{0};
+		uint32_t bufferWriteIndex{0};
+		uint8_t  buffer[numBuffers][bufferSize];
+		hrt_abstime oldestRecordTime{0};
+		LaneStats stats;
+	};
+
+	Lane lanes[numLanes];
+
+	float rpcCostUs{0.f}; ///< filtered duration of the send RPC
 
 	uORBCommunicator::IChannelRxHandler *_RxHandler;
 
@@ -81,11 +135,17 @@ private:
 
 	bool isAggregate(const char *name) { return (strcmp(name, topicName.c_str()) == 0); }
 
-	bool NewRecordOverflows(const char *messageName, int32_t length);
+	LaneId GetLane(const char *messageName) const;
+
+	hrt_abstime FlushAge(LaneId lane) const;
+
+	bool NewRecordOverflows(const Lane &lane, const char *messageName, int32_t length);
+
+	void MoveToNextBuffer(Lane &lane);
 
-	void MoveToNextBuffer();
+	void AddRecordToBuffer(Lane &lane, const char *messageName, int32_t length, const uint8_t *data);
 
-	void AddRecordToBuffer(const char *messageName, int32_t length, const uint8_t *data);
+	int16_t SendLane(Lane &lane);
 };
 
 }
@@ -0,0 +1,238 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "uORBShmChannel.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <px4_platform_common/log.h>
+#include <uORB/topics/uORBTopics.hpp>
+
+using namespace uORB;
+
+ShmChannel *ShmChannel::_instance{nullptr};
+
+ShmChannel *ShmChannel::create(const char *segment_name, const char *topics, uint8_t queue_size)
+{
+	if (_instance != nullptr) {
+		return _instance;
+	}
+
+	ShmChannel *channel = new ShmChannel();
+
+	if (channel == nullptr) {
+		return nullptr;
+	}
+
+	if (!channel->init(segment_name, topics, queue_size)) {
+		delete channel;
+		return nullptr;
+	}
+
+	_instance = channel;
+	return channel;
+}
+
+ShmChannel::~ShmChannel()
+{
+	if (_header != nullptr) {
+		for (int i = 0; i < _topic_count; i++) {
+			pthread_mutex_destroy(&_topics[i].mutex);
+		}
+
+		munmap(_header, _size);
+		shm_unlink(_segment_name);
+	}
+}
+
+bool ShmChannel::init(const char *segment_name, const char *topics, uint8_t queue_size)
+{
+	// round up to a power of 2, same as uORB queues
+	uint8_t queue = 1;
+
+	while (queue < queue_size && queue < 128) {
+		queue <<= 1;
+	}
+
+	// resolve the topic names
+	const orb_metadata *const *topic_list = orb_get_topics();
+	const char *name = topics;
+
+	while (name != nullptr && *name != '\0') {
+		const char *end = strchr(name, ',');
+		const size_t len = (end != nullptr) ? (size_t)(end - name) : strlen(name);
+		const orb_metadata *meta = nullptr;
+
+		for (size_t i = 0; i < ORB_TOPICS_COUNT; i++) {
+			if (strlen(topic_list[i]->o_name) == len && strncmp(topic_list[i]->o_name, name, len) == 0) {
+				meta = topic_list[i];
+				break;
+			}
+		}
+
+		if (meta == nullptr) {
+			PX4_ERR("unknown topic '%.*s'", (int)len, name);
+			return false;
+		}
+
+		if (_topic_count >= MAX_TOPICS) {
+			PX4_ERR("too many topics (max %d)", MAX_TOPICS);
+			return false;
+		}
+
+		_topics[_topic_count++].meta = meta;
+		name = (end != nullptr) ? end + 1 : nullptr;
+	}
+
+	if (_topic_count == 0) {
+		PX4_ERR("no topics");
+		return false;
+	}
+
+	// layout: header, topic table, queues (8 byte aligned)
+	size_t offset = sizeof(uorb_shm_header_s) + _topic_count * sizeof(uorb_shm_topic_s);
+
+	for (int i = 0; i < _topic_count; i++) {
+		offset = (offset + 7) & ~(size_t)7;
+		offset += (size_t)_topics[i].meta->o_size * queue;
+	}
+
+	_size = offset;
+	strncpy(_segment_name, segment_name, sizeof(_segment_name) - 1);
+
+	int fd = shm_open(_segment_name, O_CREAT | O_RDWR | O_TRUNC, 0644);
+
+	if (fd < 0) {
+		PX4_ERR("shm_open %s failed (%i)", _segment_name, errno);
+		return false;
+	}
+
+	if (ftruncate(fd, _size) != 0) {
+		PX4_ERR("ftruncate failed (%i)", errno);
+		close(fd);
+		shm_unlink(_segment_name);
+		return false;
+	}
+
+	void *addr = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (addr == MAP_FAILED) {
+		PX4_ERR("mmap failed (%i)", errno);
+		shm_unlink(_segment_name);
+		return false;
+	}
+
+	_header = (uorb_shm_header_s *)addr;
+	memset(_header, 0, _size);
+
+	uorb_shm_topic_s *table = (uorb_shm_topic_s *)(_header + 1);
+	offset = sizeof(uorb_shm_header_s) + _topic_count * sizeof(uorb_shm_topic_s);
+
+	for (int i = 0; i < _topic_count; i++) {
+		Topic &topic = _topics[i];
+		offset = (offset + 7) & ~(size_t)7;
+
+		topic.shm = &table[i];
+		topic.queue = (uint8_t *)_header + offset;
+		pthread_mutex_init(&topic.mutex, nullptr);
+
+		strncpy(topic.shm->name, topic.meta->o_name, sizeof(topic.shm->name) - 1);
+		topic.shm->message_hash = topic.meta->message_hash;
+		topic.shm->data_offset = offset;
+		topic.shm->o_size = topic.meta->o_size;
+		topic.shm->queue_size = queue;
+
+		offset += (size_t)topic.meta->o_size * queue;
+	}
+
+	_header->topic_count = _topic_count;
+	_header->size = _size;
+	_header->version = UORB_SHM_VERSION;
+
+	// readers check the magic last
+	__atomic_store_n(&_header->magic, UORB_SHM_MAGIC, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+int16_t ShmChannel::send_message(const char *messageName, int32_t length, uint8_t *data)
+{
+	// uORB passes orb_metadata::o_name, so comparing the pointers is enough
+	for (int i = 0; i < _topic_count; i++) {
+		Topic &topic = _topics[i];
+
+		if (topic.meta->o_name != messageName) {
+			continue;
+		}
+
+		if (length != topic.shm->o_size) {
+			return 0;
+		}
+
+		// several instances of a topic can be published concurrently
+		pthread_mutex_lock(&topic.mutex);
+
+		const uint32_t generation = topic.shm->generation;
+		const uint32_t index = generation % topic.shm->queue_size;
+
+		// announce the write before touching the slot, readers discard copies of slots being written
+		__atomic_store_n(&topic.shm->write_generation, generation + 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+
+		memcpy(topic.queue + (size_t)topic.shm->o_size * index, data, topic.shm->o_size);
+
+		__atomic_store_n(&topic.shm->generation, generation + 1, __ATOMIC_RELEASE);
+
+		pthread_mutex_unlock(&topic.mutex);
+
+		return 0;
+	}
+
+	return 0;
+}
+
+void ShmChannel::print_status() const
+{
+	PX4_INFO("segment: %s (%zu bytes)", _segment_name, _size);
+
+	for (int i = 0; i < _topic_count; i++) {
+		const Topic &topic = _topics[i];
+		PX4_INFO_RAW("  %-32s size: %3u queue: %3u published: %" PRIu32 "\n", topic.meta->o_name,
+			     topic.shm->o_size, topic.shm->queue_size, __atomic_load_n(&topic.shm->generation, __ATOMIC_RELAXED));
+	}
+}
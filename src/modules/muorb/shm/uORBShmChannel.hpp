@@ -0,0 +1,108 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file uORBShmChannel.hpp
+ *
+ * uORB communicator channel mirroring selected topics into a POSIX shared-memory
+ * segment, so that other processes on the same host can read them without any
+ * serialization. See uorb_shm.h for the segment layout and the reader side.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include <uORB/uORB.h>
+#include <uORB/uORBCommunicator.hpp>
+
+#include "uorb_shm.h"
+
+namespace uORB
+{
+
+class ShmChannel : public uORBCommunicator::IChannel
+{
+public:
+	static constexpr int MAX_TOPICS = 32;
+
+	static ShmChannel *instance() { return _instance; }
+
+	/**
+	 * Create the shared-memory segment and the channel.
+	 * @param segment_name name passed to shm_open(), e.g. "/px4_uorb"
+	 * @param topics comma-separated list of topic names
+	 * @param queue_size number of messages kept per topic (rounded up to a power of 2)
+	 * @return the channel or nullptr on error
+	 */
+	static ShmChannel *create(const char *segment_name, const char *topics, uint8_t queue_size);
+
+	void print_status() const;
+
+	// uORBCommunicator::IChannel
+	int16_t topic_advertised(const char *messageName) override { return 0; }
+	int16_t add_subscription(const char *messageName, int32_t msgRateInHz) override { return 0; }
+	int16_t remove_subscription(const char *messageName) override { return 0; }
+	int16_t register_handler(uORBCommunicator::IChannelRxHandler *handler) override { return 0; }
+
+	/**
+	 * Called by uORB after each publication. Copies the message into the segment if the
+	 * topic is exported, all other topics are ignored.
+	 */
+	int16_t send_message(const char *messageName, int32_t length, uint8_t *data) override;
+
+private:
+	ShmChannel() = default;
+	virtual ~ShmChannel();
+
+	bool init(const char *segment_name, const char *topics, uint8_t queue_size);
+
+	struct Topic {
+		const orb_metadata *meta{nullptr};
+		uorb_shm_topic_s *shm{nullptr};
+		uint8_t *queue{nullptr};
+		pthread_mutex_t mutex;
+	};
+
+	static ShmChannel *_instance;
+
+	Topic _topics[MAX_TOPICS] {};
+	int _topic_count{0};
+
+	uorb_shm_header_s *_header{nullptr};
+	size_t _size{0};
+	char _segment_name[64] {};
+};
+
+} // namespace uORB
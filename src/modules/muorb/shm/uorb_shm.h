@@ -0,0 +1,147 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file uorb_shm.h
+ *
+ * Layout of the uORB shared-memory segment exported by the uorb_shm module,
+ * and a lock-free reader for external processes. This header only depends on
+ * the C standard library so it can be used outside of PX4.
+ *
+ * The segment consists of a uorb_shm_header_s, followed by topic_count
+ * uorb_shm_topic_s entries and the message queues. Every queue follows the
+ * uORB generation semantics: a message with generation g is stored in slot
+ * (g % queue_size), and the writer advances write_generation before and
+ * generation after writing a slot.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define UORB_SHM_MAGIC 0x5342524fu // "ORBS" in little endian
+#define UORB_SHM_VERSION 1
+#define UORB_SHM_TOPIC_NAME_LEN 40
+
+struct uorb_shm_header_s {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t topic_count;
+	uint32_t size;                  /**< total size of the segment in bytes */
+};
+
+struct uorb_shm_topic_s {
+	char name[UORB_SHM_TOPIC_NAME_LEN];
+	uint32_t message_hash;          /**< orb_metadata::message_hash for compatibility checks */
+	uint32_t data_offset;           /**< offset of the queue from the start of the segment */
+	uint16_t o_size;                /**< message size */
+	uint8_t queue_size;             /**< number of slots, power of two */
+	uint8_t reserved;
+	uint32_t generation;            /**< number of published messages */
+	uint32_t write_generation;      /**< number of started writes, ahead of generation while writing */
+};
+
+/**
+ * Find a topic in a mapped segment.
+ * @return the topic or NULL if not exported
+ */
+static inline const struct uorb_shm_topic_s *uorb_shm_find_topic(const struct uorb_shm_header_s *header,
+		const char *name)
+{
+	if (header->magic != UORB_SHM_MAGIC || header->version != UORB_SHM_VERSION) {
+		return NULL;
+	}
+
+	const struct uorb_shm_topic_s *topics = (const struct uorb_shm_topic_s *)(header + 1);
+
+	for (uint32_t i = 0; i < header->topic_count; i++) {
+		if (strncmp(topics[i].name, name, UORB_SHM_TOPIC_NAME_LEN) == 0) {
+			return &topics[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Number of messages published since generation.
+ */
+static inline uint32_t uorb_shm_updates_available(const struct uorb_shm_topic_s *topic, uint32_t generation)
+{
+	return __atomic_load_n(&topic->generation, __ATOMIC_ACQUIRE) - generation;
+}
+
+/**
+ * Copy the next message of a topic, lock-free.
+ * Same semantics as uORB::Subscription::update(): returns the oldest unread message, or skips ahead
+ * if the reader fell behind by more than the queue size.
+ *
+ * @param header the mapped segment
+ * @param topic topic returned by uorb_shm_find_topic()
+ * @param dst buffer of at least topic->o_size bytes
+ * @param generation generation of the reader, initialize with 0 to get the oldest queued message
+ * @return true if a new message was copied
+ */
+static inline bool uorb_shm_update(const struct uorb_shm_header_s *header, const struct uorb_shm_topic_s *topic,
+				   void *dst, uint32_t *generation)
+{
+	const uint8_t *queue = (const uint8_t *)header + topic->data_offset;
+
+	for (;;) {
+		const uint32_t current = __atomic_load_n(&topic->generation, __ATOMIC_ACQUIRE);
+
+		if (current == *generation) {
+			return false;
+		}
+
+		uint32_t read = *generation;
+		const uint32_t write_generation = __atomic_load_n(&topic->write_generation, __ATOMIC_ACQUIRE);
+
+		if ((uint32_t)(write_generation - read) > topic->queue_size) {
+			// reader is too far behind, some messages are lost
+			read = write_generation - topic->queue_size;
+		}
+
+		memcpy(dst, queue + (size_t)topic->o_size * (read % topic->queue_size), topic->o_size);
+
+		// the slot is intact as long as the writer did not start to overwrite it
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+		if ((uint32_t)(__atomic_load_n(&topic->write_generation, __ATOMIC_RELAXED) - read) <= topic->queue_size) {
+			*generation = read + 1;
+			return true;
+		}
+	}
+}
@@ -0,0 +1,145 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <px4_platform_common/getopt.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module.h>
+#include <uORB/uORBManager.hpp>
+
+#include "uORBShmChannel.hpp"
+
+extern "C" __EXPORT int uorb_shm_main(int argc, char *argv[]);
+
+static void usage()
+{
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Exports selected uORB topics into a POSIX shared-memory segment, so that other processes
+on the same host (e.g. a companion application) can read them without any serialization.
+
+Every publication of an exported topic is copied into a per-topic ring buffer in the segment.
+Readers are lock-free and never block the publisher, see `src/modules/muorb/shm/uorb_shm.h`
+for the layout and a reader implementation.
+
+The module registers itself as uORB communicator and can therefore not be combined with
+other muorb channels. Multiple instances of a topic are mirrored into the same queue.
+
+### Example
+$ uorb_shm start -n /px4_uorb -t vehicle_attitude,vehicle_local_position -q 8
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("uorb_shm", "communication");
+	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_PARAM_STRING('n', "/px4_uorb", nullptr, "Name of the shared-memory segment", true);
+	PRINT_MODULE_USAGE_PARAM_STRING('t', nullptr, "<topic1,topic2>", "Comma-separated list of topics", false);
+	PRINT_MODULE_USAGE_PARAM_INT('q', 4, 1, 128, "Queue length per topic", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "Print exported topics");
+}
+
+int uorb_shm_main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		usage();
+		return 1;
+	}
+
+	if (!strcmp(argv[1], "start")) {
+		if (uORB::ShmChannel::instance() != nullptr) {
+			PX4_WARN("already running");
+			return 0;
+		}
+
+		const char *segment_name = "/px4_uorb";
+		const char *topics = nullptr;
+		int queue_size = 4;
+
+		int myoptind = 1;
+		int ch;
+		const char *myoptarg = nullptr;
+
+		while ((ch = px4_getopt(argc, argv, "n:t:q:", &myoptind, &myoptarg)) != EOF) {
+			switch (ch) {
+			case 'n':
+				segment_name = myoptarg;
+				break;
+
+			case 't':
+				topics = myoptarg;
+				break;
+
+			case 'q':
+				queue_size = atoi(myoptarg);
+				break;
+
+			default:
+				usage();
+				return 1;
+			}
+		}
+
+		if (topics == nullptr || queue_size < 1 || queue_size > 128) {
+			usage();
+			return 1;
+		}
+
+		if (uORB::Manager::get_instance()->get_uorb_communicator() != nullptr) {
+			PX4_ERR("another uORB communicator is already active");
+			return 1;
+		}
+
+		uORB::ShmChannel *channel = uORB::ShmChannel::create(segment_name, topics, queue_size);
+
+		if (channel == nullptr) {
+			return 1;
+		}
+
+		uORB::Manager::get_instance()->set_uorb_communicator(channel);
+		return 0;
+
+	} else if (!strcmp(argv[1], "status")) {
+		if (uORB::ShmChannel::instance() == nullptr) {
+			PX4_INFO("not running");
+			return 1;
+		}
+
+		uORB::ShmChannel::instance()->print_status();
+		return 0;
+	}
+
+	usage();
+	return 1;
+}
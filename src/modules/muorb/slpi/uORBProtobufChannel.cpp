@@ -80,11 +80,18 @@ static void aggregator_thread_func(void *ptr)
 
 	uORB::ProtobufChannel *muorb = uORB::ProtobufChannel::GetInstance();
 
+	hrt_abstime last_status_print = hrt_absolute_time();
+
 	while (true) {
 		// Check for timeout. Send buffer if timeout happened.
-		muorb->SendAggregateData();
+		muorb->SendTimedOutAggregateData();
+
+		if (muorb->DebugEnabled() && (hrt_elapsed_time(&last_status_print) > 10000000)) {
+			muorb->PrintStatus();
+			last_status_print = hrt_absolute_time();
+		}
 
-		qurt_timer_sleep(2000);
+		qurt_timer_sleep(mUORB::Aggregator::pollIntervalUs);
 	}
 
 	qurt_thread_exit(QURT_EOK);
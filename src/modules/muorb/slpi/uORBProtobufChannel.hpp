@@ -161,6 +161,23 @@ public:
 		pthread_mutex_unlock(&_tx_mutex);
 	}
 
+	/**
+	 * Send the aggregated data that has been waiting longer than its lane's flush age.
+	 */
+	void SendTimedOutAggregateData()
+	{
+		pthread_mutex_lock(&_tx_mutex);
+		_Aggregator.SendTimedOutData();
+		pthread_mutex_unlock(&_tx_mutex);
+	}
+
+	void PrintStatus()
+	{
+		pthread_mutex_lock(&_tx_mutex);
+		_Aggregator.PrintStatus();
+		pthread_mutex_unlock(&_tx_mutex);
+	}
+
 private:
 	/**
 	 * Data Members
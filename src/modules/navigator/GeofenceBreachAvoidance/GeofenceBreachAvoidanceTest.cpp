@@ -80,6 +80,37 @@ TEST_F(GeofenceBreachAvoidanceTest, waypointFromBearingAndDistance)
 	EXPECT_LT(Vector2d(home_global - same_as_home_global).norm(), 1e-4);
 }
 
+TEST_F(GeofenceBreachAvoidanceTest, fenceViolationTestPath)
+{
+	GeofenceBreachAvoidance gf_avoidance(nullptr);
+	Vector2d home_global(42.1, 8.2);
+
+	MapProjection ref{home_global(0), home_global(1)};
+
+	gf_avoidance.setCurrentPosition(home_global(0), home_global(1), 100.f);
+	gf_avoidance.setTestPointBearing(M_PI_F * 0.5f);
+	gf_avoidance.setHorizontalTestPointDistance(20.f);
+	gf_avoidance.setVerticalTestPointDistance(4.f);
+
+	static constexpr int num_points = 4;
+	double lat[num_points];
+	double lon[num_points];
+	float alt[num_points];
+	gf_avoidance.getFenceViolationTestPath(lat, lon, alt, num_points);
+
+	// evenly spaced towards the east, the last point is the test point
+	for (int k = 0; k < num_points; k++) {
+		Vector2f path_point_local = ref.project(lat[k], lon[k]);
+		EXPECT_NEAR(path_point_local(0), 0.f, 1e-3f);
+		EXPECT_NEAR(path_point_local(1), 5.f * (k + 1), 1e-3f);
+		EXPECT_FLOAT_EQ(alt[k], 100.f + (k + 1));
+	}
+
+	Vector2d test_point = gf_avoidance.getFenceViolationTestPoint();
+	EXPECT_DOUBLE_EQ(test_point(0), lat[num_points - 1]);
+	EXPECT_DOUBLE_EQ(test_point(1), lon[num_points - 1]);
+}
+
 TEST_F(GeofenceBreachAvoidanceTest, generateLoiterPointForFixedWing)
 {
 	GeofenceBreachAvoidance gf_avoidance(nullptr);
@@ -99,6 +99,18 @@ GeofenceBreachAvoidance::getFenceViolationTestPoint()
 	return waypointFromBearingAndDistance(_current_pos_lat_lon, _test_point_bearing, _test_point_distance);
 }
 
+void GeofenceBreachAvoidance::getFenceViolationTestPath(double lat[], double lon[], float alt[], int num_points)
+{
+	for (int k = 0; k < num_points; k++) {
+		const float fraction = static_cast<float>(k + 1) / num_points;
+		const Vector2d path_point = waypointFromBearingAndDistance(_current_pos_lat_lon, _test_point_bearing,
+					    fraction * _test_point_distance);
+		lat[k] = path_point(0);
+		lon[k] = path_point(1);
+		alt[k] = _current_alt_amsl + fraction * _vertical_test_point_distance;
+	}
+}
+
 Vector2d
 GeofenceBreachAvoidance::generateLoiterPointForFixedWing(geofence_violation_type_u violation_type, Geofence *geofence)
 {
@@ -59,6 +59,12 @@ public:
 
 	matrix::Vector2<double> getFenceViolationTestPoint();
 
+	/**
+	 * Sample the braking path towards the fence violation test point
+	 * @param num_points number of points, evenly spaced, the last one is the test point
+	 */
+	void getFenceViolationTestPath(double lat[], double lon[], float alt[], int num_points);
+
 	matrix::Vector2<double> waypointFromBearingAndDistance(matrix::Vector2<double> current_pos_lat_lon,
 			float test_point_bearing, float test_point_distance);
 
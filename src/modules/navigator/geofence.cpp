@@ -250,6 +250,7 @@ void Geofence::_updateFence()
 				} else {
 					polygon.vertex_count = mission_fence_point.vertex_count;
 					current_seq += mission_fence_point.vertex_count;
+					updatePolygonBounds(polygon);
 				}
 
 				// check if requiremetns for Home location are met
@@ -275,6 +276,29 @@ void Geofence::_updateFence()
 	}
 }
 
+void Geofence::updatePolygonBounds(PolygonInfo &polygon)
+{
+	polygon.lat_min = polygon.lon_min = INFINITY;
+	polygon.lat_max = polygon.lon_max = -INFINITY;
+
+	for (unsigned i = 0; i < polygon.vertex_count; i++) {
+		mission_fence_point_s vertex{};
+
+		if (!_dataman_cache.loadWait(DM_KEY_FENCE_POINTS, polygon.dataman_index + i,
+					     reinterpret_cast<uint8_t *>(&vertex), sizeof(mission_fence_point_s))) {
+			// unknown extent, always run the full test
+			polygon.lat_min = polygon.lon_min = -INFINITY;
+			polygon.lat_max = polygon.lon_max = INFINITY;
+			return;
+		}
+
+		polygon.lat_min = math::min(polygon.lat_min, vertex.lat);
+		polygon.lat_max = math::max(polygon.lat_max, vertex.lat);
+		polygon.lon_min = math::min(polygon.lon_min, vertex.lon);
+		polygon.lon_max = math::max(polygon.lon_max, vertex.lon);
+	}
+}
+
 bool Geofence::checkHomeRequirementsForGeofence(const PolygonInfo &polygon)
 {
 	bool checks_pass = true;
@@ -377,6 +401,61 @@ bool Geofence::isInsidePolygonOrCircle(double lat, double lon, float altitude)
 	return checksPass;
 }
 
+int Geofence::firstPathPointOutsidePolygonOrCircle(const double lat[], const double lon[], const float altitude[],
+		int num_points)
+{
+	if (isEmpty()) {
+		/* Empty fence -> accept all points */
+		return -1;
+	}
+
+	num_points = math::min(num_points, MAX_PATH_POINTS);
+
+	bool checks_pass[MAX_PATH_POINTS];
+	bool inside[MAX_PATH_POINTS];
+
+	for (int k = 0; k < num_points; k++) {
+		checks_pass[k] = true;
+
+		/* Vertical check */
+		if (_altitude_max > _altitude_min) { // only enable vertical check if configured properly
+			checks_pass[k] = (altitude[k] <= _altitude_max) && (altitude[k] >= _altitude_min);
+		}
+	}
+
+	/* Horizontal check: iterate all polygons & circles once for all points */
+	for (int polygon_index = 0; polygon_index < _num_polygons; ++polygon_index) {
+		const PolygonInfo &polygon = _polygons[polygon_index];
+
+		if (polygon.fence_type == NAV_CMD_FENCE_POLYGON_VERTEX_INCLUSION
+		    || polygon.fence_type == NAV_CMD_FENCE_POLYGON_VERTEX_EXCLUSION) {
+
+			insidePolygon(polygon, lat, lon, num_points, inside);
+
+			for (int k = 0; k < num_points; k++) {
+				checks_pass[k] &= (polygon.fence_type == NAV_CMD_FENCE_POLYGON_VERTEX_INCLUSION) ? inside[k] : !inside[k];
+			}
+
+		} else if (polygon.fence_type == NAV_CMD_FENCE_CIRCLE_INCLUSION
+			   || polygon.fence_type == NAV_CMD_FENCE_CIRCLE_EXCLUSION) {
+
+			insideCircle(polygon, lat, lon, num_points, inside);
+
+			for (int k = 0; k < num_points; k++) {
+				checks_pass[k] &= (polygon.fence_type == NAV_CMD_FENCE_CIRCLE_INCLUSION) ? inside[k] : !inside[k];
+			}
+		}
+	}
+
+	for (int k = 0; k < num_points; k++) {
+		if (!checks_pass[k]) {
+			return k;
+		}
+	}
+
+	return -1;
+}
+
 bool Geofence::checkPointAgainstPolygonCircle(const PolygonInfo &polygon, double lat, double lon, float altitude)
 {
 	bool checksPass = true;
@@ -398,6 +477,14 @@ bool Geofence::checkPointAgainstPolygonCircle(const PolygonInfo &polygon, double
 }
 
 bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon, float altitude)
+{
+	bool inside = false;
+	insidePolygon(polygon, &lat, &lon, 1, &inside);
+	return inside;
+}
+
+void Geofence::insidePolygon(const PolygonInfo &polygon, const double lat[], const double lon[], int num_points,
+			     bool inside[])
 {
 	/**
 	 * Adaptation of algorithm originally presented as
@@ -406,21 +493,39 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 	 * Only supports non-complex polygons (not self intersecting)
 	 */
 
+	bool in_bounds[MAX_PATH_POINTS];
+	bool any_in_bounds = false;
+
+	for (int k = 0; k < num_points; k++) {
+		inside[k] = false;
+
+		// a point outside of the bounding box can't be inside of the polygon
+		in_bounds[k] = (lat[k] >= polygon.lat_min) && (lat[k] <= polygon.lat_max)
+			       && (lon[k] >= polygon.lon_min) && (lon[k] <= polygon.lon_max);
+		any_in_bounds |= in_bounds[k];
+	}
+
+	if (!any_in_bounds) {
+		return;
+	}
+
 	mission_fence_point_s temp_vertex_i{};
 	mission_fence_point_s temp_vertex_j{};
-	bool c = false;
 
-	for (unsigned i = 0, j = polygon.vertex_count - 1; i < polygon.vertex_count; j = i++) {
+	// every vertex is loaded once, the previous vertex is kept for the next edge
+	if (!_dataman_cache.loadWait(DM_KEY_FENCE_POINTS, polygon.dataman_index + polygon.vertex_count - 1,
+				     reinterpret_cast<uint8_t *>(&temp_vertex_j), sizeof(mission_fence_point_s))) {
+		return;
+	}
 
-		bool success = _dataman_cache.loadWait(DM_KEY_FENCE_POINTS, polygon.dataman_index + i,
-						       reinterpret_cast<uint8_t *>(&temp_vertex_i), sizeof(mission_fence_point_s));
+	for (unsigned i = 0; i < polygon.vertex_count; i++) {
 
-		if (!success) {
-			break;
+		if (i > 0) {
+			temp_vertex_j = temp_vertex_i;
 		}
 
-		success = _dataman_cache.loadWait(DM_KEY_FENCE_POINTS, polygon.dataman_index + j,
-						  reinterpret_cast<uint8_t *>(&temp_vertex_j), sizeof(mission_fence_point_s));
+		bool success = _dataman_cache.loadWait(DM_KEY_FENCE_POINTS, polygon.dataman_index + i,
+						       reinterpret_cast<uint8_t *>(&temp_vertex_i), sizeof(mission_fence_point_s));
 
 		if (!success) {
 			break;
@@ -434,18 +539,33 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 			break;
 		}
 
-		if (((double)temp_vertex_i.lon >= lon) != ((double)temp_vertex_j.lon >= lon) &&
-		    (lat <= (double)(temp_vertex_j.lat - temp_vertex_i.lat) * (lon - (double)temp_vertex_i.lon) /
-		     (double)(temp_vertex_j.lon - temp_vertex_i.lon) + (double)temp_vertex_i.lat)) {
-			c = !c;
+		for (int k = 0; k < num_points; k++) {
+			if (in_bounds[k] && (((double)temp_vertex_i.lon >= lon[k]) != ((double)temp_vertex_j.lon >= lon[k])) &&
+			    (lat[k] <= (double)(temp_vertex_j.lat - temp_vertex_i.lat) * (lon[k] - (double)temp_vertex_i.lon) /
+			     (double)(temp_vertex_j.lon - temp_vertex_i.lon) + (double)temp_vertex_i.lat)) {
+				inside[k] = !inside[k];
+			}
 		}
 	}
-
-	return c;
 }
 
 bool Geofence::insideCircle(const PolygonInfo &polygon, double lat, double lon, float altitude)
 {
+	bool inside = false;
+	insideCircle(polygon, &lat, &lon, 1, &inside);
+	return inside;
+}
+
+void Geofence::insideCircle(const PolygonInfo &polygon, const double lat[], const double lon[], int num_points,
+			    bool inside[])
+{
+	for (int k = 0; k < num_points; k++) {
+		inside[k] = false;
+	}
+
+	if (num_points <= 0) {
+		return;
+	}
 
 	mission_fence_point_s circle_point{};
 	bool success = _dataman_cache.loadWait(DM_KEY_FENCE_POINTS, polygon.dataman_index,
@@ -453,7 +573,7 @@ bool Geofence::insideCircle(const PolygonInfo &polygon, double lat, double lon,
 
 	if (!success) {
 		PX4_ERR("dm_read failed");
-		return false;
+		return;
 	}
 
 	if (circle_point.frame != NAV_FRAME_GLOBAL && circle_point.frame != NAV_FRAME_GLOBAL_INT
@@ -461,18 +581,27 @@ bool Geofence::insideCircle(const PolygonInfo &polygon, double lat, double lon,
 	    && circle_point.frame != NAV_FRAME_GLOBAL_RELATIVE_ALT_INT) {
 		// TODO: handle different frames
 		PX4_ERR("Frame type %i not supported", (int)circle_point.frame);
-		return false;
+		return;
 	}
 
 	if (!_projection_reference.isInitialized()) {
-		_projection_reference.initReference(lat, lon);
+		_projection_reference.initReference(lat[0], lon[0]);
+
+		// path points close to the reference skip the trigonometric projection (error below 2 cm)
+		_projection_reference.setFastProjectionRadius(10000.f);
 	}
 
-	float x1, y1, x2, y2;
-	_projection_reference.project(lat, lon, x1, y1);
-	_projection_reference.project(circle_point.lat, circle_point.lon, x2, y2);
-	float dx = x1 - x2, dy = y1 - y2;
-	return dx * dx + dy * dy < circle_point.circle_radius * circle_point.circle_radius;
+	float x_center, y_center;
+	_projection_reference.project(circle_point.lat, circle_point.lon, x_center, y_center);
+
+	float x[MAX_PATH_POINTS], y[MAX_PATH_POINTS];
+	num_points = math::min(num_points, MAX_PATH_POINTS);
+	_projection_reference.project(lat, lon, x, y, num_points);
+
+	for (int k = 0; k < num_points; k++) {
+		const float dx = x[k] - x_center, dy = y[k] - y_center;
+		inside[k] = dx * dx + dy * dy < circle_point.circle_radius * circle_point.circle_radius;
+	}
 }
 
 bool
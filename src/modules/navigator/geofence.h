@@ -108,6 +108,17 @@ public:
 
 	virtual bool isInsidePolygonOrCircle(double lat, double lon, float altitude);
 
+	static constexpr int MAX_PATH_POINTS = 8;
+
+	/**
+	 * Check the points of a predicted path against the polygons and circles in one pass over the fence,
+	 * the vertices of each polygon are loaded once for all points (at most MAX_PATH_POINTS).
+	 *
+	 * @return index of the first point that fails isInsidePolygonOrCircle(), -1 if all points pass
+	 */
+	int firstPathPointOutsidePolygonOrCircle(const double lat[], const double lon[], const float altitude[],
+			int num_points);
+
 	int clearDm();
 
 	bool valid();
@@ -165,8 +176,19 @@ private:
 			uint16_t vertex_count;
 			float circle_radius;
 		};
+
+		// bounding box of the polygon vertices, to skip the vertex test for points far away
+		double lat_min;
+		double lat_max;
+		double lon_min;
+		double lon_max;
 	};
 
+	/**
+	 * Compute the bounding box of a polygon from its vertices
+	 */
+	void updatePolygonBounds(PolygonInfo &polygon);
+
 	Navigator   *_navigator{nullptr};
 	PolygonInfo *_polygons{nullptr};
 
@@ -199,6 +221,13 @@ private:
 	 */
 	bool insidePolygon(const PolygonInfo &polygon, double lat, double lon, float altitude);
 
+	/**
+	 * Check several points against a polygon
+	 * @param inside output, true for each point within the polygon
+	 */
+	void insidePolygon(const PolygonInfo &polygon, const double lat[], const double lon[], int num_points,
+			   bool inside[]);
+
 	/**
 	 * Check if a single point is within a circle
 	 * @param polygon must be a circle!
@@ -206,6 +235,14 @@ private:
 	 */
 	bool insideCircle(const PolygonInfo &polygon, double lat, double lon, float altitude);
 
+	/**
+	 * Check several points against a circle
+	 * @param polygon must be a circle!
+	 * @param inside output, true for each point within the circle
+	 */
+	void insideCircle(const PolygonInfo &polygon, const double lat[], const double lon[], int num_points,
+			  bool inside[]);
+
 	/**
 	 * Check if a single point is within a polygon or circle
 	 * @return true if within polygon or circle
@@ -136,6 +136,7 @@ void MissionBase::onMissionUpdate(bool has_mission_items_changed)
 	if (has_mission_items_changed) {
 		_dataman_cache.invalidate();
 		_load_mission_index = -1;
+		invalidateNextPositionItems();
 
 		check_mission_valid();
 
@@ -692,16 +693,29 @@ MissionBase::checkMissionRestart()
 void
 MissionBase::check_mission_valid()
 {
-	if ((_navigator->get_mission_result()->mission_id != _mission.mission_id)
-	    || (_navigator->get_mission_result()->geofence_id != _mission.geofence_id)
-	    || (_navigator->get_mission_result()->home_position_counter != _navigator->get_home_position()->update_count)) {
+	const bool mission_or_home_changed = (_navigator->get_mission_result()->mission_id != _mission.mission_id)
+					     || (_navigator->get_mission_result()->home_position_counter != _navigator->get_home_position()->update_count);
+	const bool geofence_changed = (_navigator->get_mission_result()->geofence_id != _mission.geofence_id);
+
+	if (mission_or_home_changed || geofence_changed) {
 
 		_navigator->get_mission_result()->mission_id = _mission.mission_id;
 		_navigator->get_mission_result()->geofence_id = _mission.geofence_id;
 		_navigator->get_mission_result()->home_position_counter = _navigator->get_home_position()->update_count;
 
 		MissionFeasibilityChecker missionFeasibilityChecker(_navigator, _dataman_client);
-		_navigator->get_mission_result()->valid = missionFeasibilityChecker.checkMissionFeasible(_mission);
+
+		if (!mission_or_home_changed && _mission_items_checked) {
+			// only the mission items against the geofence need to be checked again
+			_navigator->get_mission_result()->valid = missionFeasibilityChecker.checkMissionFeasibleGeofenceChanged(_mission,
+					_mission_items_feasible);
+
+		} else {
+			_navigator->get_mission_result()->valid = missionFeasibilityChecker.checkMissionFeasible(_mission);
+		}
+
+		_mission_items_checked = missionFeasibilityChecker.itemsChecked();
+		_mission_items_feasible = missionFeasibilityChecker.itemsFeasible();
 		_navigator->get_mission_result()->seq_total = _mission.count;
 		_navigator->get_mission_result()->seq_reached = -1;
 		_navigator->get_mission_result()->failure = false;
@@ -925,6 +939,7 @@ int MissionBase::getNonJumpItem(int32_t &mission_index, mission_item_s &mission,
 
 			if ((new_mission.do_jump_current_count < new_mission.do_jump_repeat_count) && execute_jump) {
 				if (write_jumps) {
+					invalidateNextPositionItems();
 					new_mission.do_jump_current_count++;
 					success = _dataman_cache.writeWait(dataman_id, new_mission_index, reinterpret_cast<uint8_t *>(&new_mission),
 									   sizeof(struct mission_item_s));
@@ -1020,6 +1035,24 @@ void MissionBase::getNextPositionItems(int32_t start_index, int32_t items_index[
 	// Make sure vector does not contain any preexisting elements.
 	num_found_items = 0u;
 
+	const bool window_valid = (_next_position_items.num_searched > 0u)
+				  && (_next_position_items.start_index == start_index)
+				  && (_next_position_items.mission_id == _mission.mission_id)
+				  && (_next_position_items.count == _mission.count)
+				  && (_next_position_items.dataman_id == _mission.dataman_id);
+
+	// the cached search covers the request if it searched as many items or already ran out of items
+	if (window_valid && ((max_num_items <= _next_position_items.num_searched)
+			     || (_next_position_items.num_found_items < _next_position_items.num_searched))) {
+		num_found_items = math::min(_next_position_items.num_found_items, static_cast<size_t>(max_num_items));
+
+		for (size_t i = 0u; i < num_found_items; i++) {
+			items_index[i] = _next_position_items.items_index[i];
+		}
+
+		return;
+	}
+
 	int32_t next_mission_index{start_index};
 
 	for (size_t item_idx = 0u; item_idx < max_num_items; item_idx++) {
@@ -1044,6 +1077,19 @@ void MissionBase::getNextPositionItems(int32_t start_index, int32_t items_index[
 			break;
 		}
 	}
+
+	if (max_num_items <= MAX_NEXT_POSITION_ITEMS) {
+		_next_position_items.start_index = start_index;
+		_next_position_items.mission_id = _mission.mission_id;
+		_next_position_items.count = _mission.count;
+		_next_position_items.dataman_id = _mission.dataman_id;
+		_next_position_items.num_searched = max_num_items;
+		_next_position_items.num_found_items = num_found_items;
+
+		for (size_t i = 0u; i < num_found_items; i++) {
+			_next_position_items.items_index[i] = items_index[i];
+		}
+	}
 }
 
 int MissionBase::goToNextItem(bool execute_jump)
@@ -1189,6 +1235,7 @@ void MissionBase::resetMissionJumpCounter()
 		}
 
 		if (mission_item.nav_cmd == NAV_CMD_DO_JUMP) {
+			invalidateNextPositionItems();
 			mission_item.do_jump_current_count = 0u;
 
 			bool write_success = _dataman_cache.writeWait(dataman_id, mission_index, reinterpret_cast<uint8_t *>(&mission_item),
@@ -310,6 +310,8 @@ protected:
 	bool _is_current_planned_mission_item_valid{false};	/**< Flag indicating if the currently loaded mission item is valid*/
 	bool _mission_has_been_activated{false};		/**< Flag indicating if the mission has been activated*/
 	bool _initialized_mission_checked{false};		/**< Flag indicating if the initialized mission has been checked by the mission validator*/
+	bool _mission_items_checked{false};			/**< Flag indicating if _mission_items_feasible is valid for the current mission and home position*/
+	bool _mission_items_feasible{false};			/**< Result of the mission item checks without the geofence*/
 	bool _system_disarmed_while_inactive{false};		/**< Flag indicating if the system has been disarmed while mission is inactive*/
 	mission_s _mission;					/**< Currently active mission*/
 	float _mission_init_climb_altitude_amsl{NAN}; 		/**< altitude AMSL the vehicle will climb to when mission starts */
@@ -444,6 +446,28 @@ private:
 	 */
 	bool checkMissionDataChanged(mission_s new_mission);
 
+	/**
+	 * @brief Invalidate the cached next position items
+	 * Needs to be called whenever mission items or jump counters change.
+	 */
+	void invalidateNextPositionItems() { _next_position_items.num_searched = 0u; }
+
+	static constexpr uint8_t MAX_NEXT_POSITION_ITEMS{4u}; /**< Size of the window of cached next position items */
+
+	/**
+	 * @brief Window of the next position items found by the last getNextPositionItems() search
+	 * The jump and position item scan is only repeated for a new start index, a mission change or a jump counter update.
+	 */
+	struct {
+		int32_t start_index{-1};
+		uint32_t mission_id{0};
+		uint16_t count{0};
+		uint8_t dataman_id{0};
+		uint8_t num_searched{0u}; /**< maximum number of items of the search, 0 if invalid */
+		size_t num_found_items{0u};
+		int32_t items_index[MAX_NEXT_POSITION_ITEMS] {};
+	} _next_position_items;
+
 	int32_t _load_mission_index{-1}; /**< Mission inted of loaded mission items in dataman cache*/
 	int32_t _dataman_cache_size_signed; /**< Size of the dataman cache. A negativ value indicates that previous mission items should be loaded, a positiv value the next mission items*/
 
@@ -54,40 +54,46 @@
 #include <px4_platform_common/events.h>
 
 bool
-MissionFeasibilityChecker::checkMissionFeasible(const mission_s &mission)
+MissionFeasibilityChecker::checkPreconditions(const mission_s &mission)
 {
-	// Reset warning flag
-	_navigator->get_mission_result()->warning = false;
-
-	// first check if we have a valid position
-	const bool home_valid = _navigator->home_global_position_valid();
-	const bool home_alt_valid = _navigator->home_alt_valid();
-
 	// trivial case: A mission with length zero cannot be valid
 	if ((int)mission.count <= 0) {
 		return false;
 	}
 
-	if (!home_alt_valid) {
+	// check if we have a valid position
+	if (!_navigator->home_alt_valid()) {
 		mavlink_log_info(_navigator->get_mavlink_log_pub(), "Not yet ready for mission, no position lock.\t");
 		events::send(events::ID("navigator_mis_no_pos_lock"), events::Log::Info, "Not yet ready for mission, no position lock");
 		return false;
 	}
 
-	bool failed = false;
+	return true;
+}
 
-	for (size_t i = 0; i < mission.count; i++) {
-		struct mission_item_s missionitem = {};
+bool
+MissionFeasibilityChecker::checkMissionFeasible(const mission_s &mission)
+{
+	// Reset warning flag
+	_navigator->get_mission_result()->warning = false;
+	_items_checked = false;
+	_items_feasible = false;
+
+	if (!checkPreconditions(mission)) {
+		return false;
+	}
 
-		bool success = _dataman_client.readSync((dm_item_t)mission.dataman_id, i, reinterpret_cast<uint8_t *>(&missionitem),
-							sizeof(mission_item_s));
+	bool failed = false;
 
-		if (!success) {
+	for (size_t i = 0; i < mission.count; i++) {
+		if (!readMissionItems(mission, i)) {
 			_navigator->get_mission_result()->warning = true;
 			/* not supposed to happen unless the datamanager can't access the SD card, etc. */
 			return false;
 		}
 
+		struct mission_item_s missionitem = _mission_items[i % DatamanClient::READ_RANGE_MAX_ITEMS];
+
 		if (!_feasibility_checker.processNextItem(missionitem, i, mission.count)) {
 			failed = true;
 			break;
@@ -97,13 +103,52 @@ MissionFeasibilityChecker::checkMissionFeasible(const mission_s &mission)
 
 	failed |= _feasibility_checker.someCheckFailed();
 
-	failed |= !checkMissionAgainstGeofence(mission, _navigator->get_home_position()->alt, home_valid);
+	_items_checked = true;
+	_items_feasible = !failed;
+
+	return checkGeofenceFeasible(mission, failed);
+}
+
+bool
+MissionFeasibilityChecker::checkMissionFeasibleGeofenceChanged(const mission_s &mission, bool items_feasible)
+{
+	// Reset warning flag
+	_navigator->get_mission_result()->warning = false;
+	_items_checked = true;
+	_items_feasible = items_feasible;
+
+	if (!checkPreconditions(mission)) {
+		return false;
+	}
+
+	return checkGeofenceFeasible(mission, !items_feasible);
+}
+
+bool
+MissionFeasibilityChecker::checkGeofenceFeasible(const mission_s &mission, bool failed)
+{
+	failed |= !checkMissionAgainstGeofence(mission, _navigator->get_home_position()->alt,
+					       _navigator->home_global_position_valid());
 
 	_navigator->get_mission_result()->warning = failed;
 
 	return !failed;
 }
 
+bool
+MissionFeasibilityChecker::readMissionItems(const mission_s &mission, size_t i)
+{
+	if (i % DatamanClient::READ_RANGE_MAX_ITEMS != 0) {
+		// already read with the first item of the batch
+		return true;
+	}
+
+	const uint32_t count = math::min(static_cast<uint32_t>(mission.count - i), DatamanClient::READ_RANGE_MAX_ITEMS);
+
+	return _dataman_client.readRangeSync((dm_item_t)mission.dataman_id, i, reinterpret_cast<uint8_t *>(_mission_items),
+					     sizeof(mission_item_s), count);
+}
+
 bool
 MissionFeasibilityChecker::checkMissionAgainstGeofence(const mission_s &mission, float home_alt, bool home_valid)
 {
@@ -117,16 +162,13 @@ MissionFeasibilityChecker::checkMissionAgainstGeofence(const mission_s &mission,
 	/* Check if all mission items are inside the geofence (if we have a valid geofence) */
 	if (_navigator->get_geofence().valid()) {
 		for (size_t i = 0; i < mission.count; i++) {
-			struct mission_item_s missionitem = {};
-
-			bool success = _dataman_client.readSync((dm_item_t)mission.dataman_id, i, reinterpret_cast<uint8_t *>(&missionitem),
-								sizeof(mission_item_s));
-
-			if (!success) {
+			if (!readMissionItems(mission, i)) {
 				/* not supposed to happen unless the datamanager can't access the SD card, etc. */
 				return false;
 			}
 
+			struct mission_item_s missionitem = _mission_items[i % DatamanClient::READ_RANGE_MAX_ITEMS];
+
 			if (missionitem.altitude_is_relative && !home_valid) {
 				mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
 				events::send(events::ID("navigator_mis_geofence_no_home2"), {events::Log::Error, events::LogInternal::Info},
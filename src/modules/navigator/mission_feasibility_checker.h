@@ -56,8 +56,21 @@ private:
 	DatamanClient &_dataman_client;
 	FeasibilityChecker _feasibility_checker;
 
+	mission_item_s _mission_items[DatamanClient::READ_RANGE_MAX_ITEMS] {};	///< items read with one dataman request
+
+	bool _items_checked{false};	///< item checks of the last call completed
+	bool _items_feasible{false};	///< result of the item checks of the last call
+
+	bool checkPreconditions(const mission_s &mission);
+	bool checkGeofenceFeasible(const mission_s &mission, bool failed);
 	bool checkMissionAgainstGeofence(const mission_s &mission, float home_alt, bool home_valid);
 
+	/*
+	 * Read the batch of mission items that contains item i into _mission_items, if not yet read
+	 * Returns false if the items could not be read
+	 */
+	bool readMissionItems(const mission_s &mission, size_t i);
+
 public:
 	MissionFeasibilityChecker(Navigator *navigator, DatamanClient &dataman_client) :
 		ModuleParams(nullptr),
@@ -76,4 +89,17 @@ public:
 	 * Returns true if mission is feasible and false otherwise
 	 */
 	bool checkMissionFeasible(const mission_s &mission);
+
+	/*
+	 * Same as checkMissionFeasible(), but only the geofence is checked again, the checks of the items
+	 * themselves are taken from a previous check of the same mission and home position
+	 */
+	bool checkMissionFeasibleGeofenceChanged(const mission_s &mission, bool items_feasible);
+
+	/*
+	 * If the item checks completed in the last call, their result (without the geofence) can be reused
+	 * with checkMissionFeasibleGeofenceChanged() as long as the mission and home position don't change
+	 */
+	bool itemsChecked() const { return _items_checked; }
+	bool itemsFeasible() const { return _items_feasible; }
 };
@@ -965,11 +965,26 @@ void Navigator::geofence_breach_check()
 		double test_point_longitude = current_longitude;
 		float test_point_altitude = current_altitude;
 
+		bool custom_fence_triggered;
+
 		if (_geofence.getPredict()) {
 			matrix::Vector2<double>fence_violation_test_point = _gf_breach_avoidance.getFenceViolationTestPoint();
 			test_point_latitude = fence_violation_test_point(0);
 			test_point_longitude = fence_violation_test_point(1);
 			test_point_altitude = current_altitude + vertical_test_point_distance;
+
+			// check the whole braking path, a narrow zone can lie between the vehicle and the test point
+			static constexpr int NUM_PATH_POINTS = 4;
+			double path_latitude[NUM_PATH_POINTS];
+			double path_longitude[NUM_PATH_POINTS];
+			float path_altitude[NUM_PATH_POINTS];
+			_gf_breach_avoidance.getFenceViolationTestPath(path_latitude, path_longitude, path_altitude, NUM_PATH_POINTS);
+			custom_fence_triggered = _geofence.firstPathPointOutsidePolygonOrCircle(path_latitude, path_longitude,
+						 path_altitude, NUM_PATH_POINTS) >= 0;
+
+		} else {
+			custom_fence_triggered = !_geofence.isInsidePolygonOrCircle(test_point_latitude, test_point_longitude,
+						 test_point_altitude);
 		}
 
 		if (_time_loitering_after_gf_breach > 0) {
@@ -977,15 +992,13 @@ void Navigator::geofence_breach_check()
 			_geofence_result.geofence_max_dist_triggered |= !_geofence.isCloserThanMaxDistToHome(test_point_latitude,
 					test_point_longitude, test_point_altitude);
 			_geofence_result.geofence_max_alt_triggered |= !_geofence.isBelowMaxAltitude(test_point_altitude);
-			_geofence_result.geofence_custom_fence_triggered |= !_geofence.isInsidePolygonOrCircle(test_point_latitude,
-					test_point_longitude, test_point_altitude);
+			_geofence_result.geofence_custom_fence_triggered |= custom_fence_triggered;
 
 		} else {
 			_geofence_result.geofence_max_dist_triggered = !_geofence.isCloserThanMaxDistToHome(test_point_latitude,
 					test_point_longitude, test_point_altitude);
 			_geofence_result.geofence_max_alt_triggered = !_geofence.isBelowMaxAltitude(test_point_altitude);
-			_geofence_result.geofence_custom_fence_triggered = !_geofence.isInsidePolygonOrCircle(test_point_latitude,
-					test_point_longitude, test_point_altitude);
+			_geofence_result.geofence_custom_fence_triggered = custom_fence_triggered;
 		}
 
 		_last_geofence_check = hrt_absolute_time();
@@ -1247,6 +1260,26 @@ void Navigator::run_fake_traffic()
 
 void Navigator::check_traffic()
 {
+#if defined(CONFIG_ADSB_TRAFFIC_TABLE)
+	const uint16_t required_flags = transponder_report_s::PX4_ADSB_FLAGS_VALID_COORDS |
+					transponder_report_s::PX4_ADSB_FLAGS_VALID_HEADING |
+					transponder_report_s::PX4_ADSB_FLAGS_VALID_VELOCITY | transponder_report_s::PX4_ADSB_FLAGS_VALID_ALTITUDE;
+
+	// consume all queued reports, the conflicts are evaluated with bounded work below
+	transponder_report_s transponder_report;
+
+	while (_traffic_sub.update(&transponder_report)) {
+		if ((transponder_report.flags & required_flags) == required_flags) {
+			_adsb_conflict.update_traffic(transponder_report);
+		}
+	}
+
+	if (_adsb_conflict.process_traffic(get_global_position()->lat, get_global_position()->lon,
+					   get_global_position()->alt, _local_pos.vx, _local_pos.vy, _local_pos.vz)) {
+		take_traffic_conflict_action();
+	}
+
+#else
 
 	if (_traffic_sub.updated()) {
 
@@ -1266,6 +1299,8 @@ void Navigator::check_traffic()
 			}
 		}
 	}
+
+#endif // CONFIG_ADSB_TRAFFIC_TABLE
 }
 
 bool Navigator::abort_landing()
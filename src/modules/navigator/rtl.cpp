@@ -130,6 +130,7 @@ void RTL::updateDatamanCache()
 		if (!_dataman_cache_safepoint.isLoading()) {
 			_dataman_state = DatamanState::UpdateRequestWait;
 			_safe_points_updated = true;
+			updateSafePointCandidates();
 		}
 
 		break;
@@ -392,36 +393,40 @@ void RTL::findRtlDestination(DestinationType &destination_type, DestinationPosit
 		}
 	}
 
-	if (_safe_points_updated) {
+	if (_safe_points_updated && (_num_safe_point_candidates > 0)) {
+		// closest allowed rally point in the local frame of the candidates, no dataman access or trigonometry per point
+		const matrix::Vector2f home = _safe_points_ref.project(_home_pos_sub.get().lat, _home_pos_sub.get().lon);
+		const matrix::Vector2f vehicle = _safe_points_ref.project(_global_pos_sub.get().lat, _global_pos_sub.get().lon);
+		const bool approach_required = vtol_in_fw_mode && (_param_rtl_approach_force.get() != 0);
 
-		for (int current_seq = 1; current_seq <= _dataman_cache_safepoint.size(); ++current_seq) {
-			mission_item_s mission_safe_point;
+		int closest_index = -1;
+		float closest_dist_squared = FLT_MAX;
 
-			bool success = _dataman_cache_safepoint.loadWait(DM_KEY_SAFE_POINTS, current_seq,
-					reinterpret_cast<uint8_t *>(&mission_safe_point),
-					sizeof(mission_item_s), 500_ms);
+		for (int i = 0; i < _num_safe_point_candidates; i++) {
+			const SafePointCandidate &candidate = _safe_point_candidates[i];
 
-			if (!success) {
-				PX4_ERR("dm_read failed");
+			// Ignore safepoints which are too close to the homepoint
+			if ((matrix::Vector2f(candidate.position - home).norm_squared() <= sq(MAX_DIST_FROM_HOME_FOR_LAND_APPROACHES))
+			    || (approach_required && !candidate.has_land_approach)) {
 				continue;
 			}
 
-			// Ignore safepoints which are too close to the homepoint
-			const float dist_to_home = get_distance_to_next_waypoint(_home_pos_sub.get().lat, _home_pos_sub.get().lon,
-						   mission_safe_point.lat, mission_safe_point.lon);
+			const float dist_squared = matrix::Vector2f(candidate.position - vehicle).norm_squared();
 
-			if (mission_safe_point.nav_cmd == NAV_CMD_RALLY_POINT && dist_to_home > MAX_DIST_FROM_HOME_FOR_LAND_APPROACHES) {
-				float dist{get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, mission_safe_point.lat, mission_safe_point.lon)};
+			if (dist_squared < closest_dist_squared) {
+				closest_dist_squared = dist_squared;
+				closest_index = i;
+			}
+		}
 
-				DestinationPosition safepoint_position;
-				setSafepointAsDestination(safepoint_position, mission_safe_point);
+		if (closest_index >= 0) {
+			const mission_item_s &mission_safe_point = _safe_point_candidates[closest_index].item;
+			const float dist{get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, mission_safe_point.lat, mission_safe_point.lon)};
 
-				if (((dist + MIN_DIST_THRESHOLD) < min_dist) && (!vtol_in_fw_mode || (_param_rtl_approach_force.get() == 0)
-						|| hasVtolLandApproach(safepoint_position))) {
-					min_dist = dist;
-					rtl_position = safepoint_position;
-					destination_type = DestinationType::DESTINATION_TYPE_SAFE_POINT;
-				}
+			if ((dist + MIN_DIST_THRESHOLD) < min_dist) {
+				min_dist = dist;
+				setSafepointAsDestination(rtl_position, mission_safe_point);
+				destination_type = DestinationType::DESTINATION_TYPE_SAFE_POINT;
 			}
 		}
 	}
@@ -444,6 +449,45 @@ void RTL::setLandPosAsDestination(DestinationPosition &rtl_position, mission_ite
 	rtl_position.yaw = _home_pos_sub.get().yaw;
 }
 
+void RTL::updateSafePointCandidates()
+{
+	_num_safe_point_candidates = 0;
+
+	for (int current_seq = 1; current_seq <= _dataman_cache_safepoint.size(); ++current_seq) {
+		if (_num_safe_point_candidates >= DM_KEY_SAFE_POINTS_MAX) {
+			break;
+		}
+
+		mission_item_s mission_safe_point;
+
+		bool success = _dataman_cache_safepoint.loadWait(DM_KEY_SAFE_POINTS, current_seq,
+				reinterpret_cast<uint8_t *>(&mission_safe_point),
+				sizeof(mission_item_s), 500_ms);
+
+		if (!success) {
+			PX4_ERR("dm_read failed");
+			continue;
+		}
+
+		if (mission_safe_point.nav_cmd != NAV_CMD_RALLY_POINT) {
+			continue;
+		}
+
+		if (_num_safe_point_candidates == 0) {
+			_safe_points_ref.initReference(mission_safe_point.lat, mission_safe_point.lon);
+		}
+
+		SafePointCandidate &candidate = _safe_point_candidates[_num_safe_point_candidates++];
+		candidate.item = mission_safe_point;
+		candidate.position = _safe_points_ref.project(mission_safe_point.lat, mission_safe_point.lon);
+
+		DestinationPosition safepoint_position{};
+		safepoint_position.lat = mission_safe_point.lat;
+		safepoint_position.lon = mission_safe_point.lon;
+		candidate.has_land_approach = hasVtolLandApproach(safepoint_position);
+	}
+}
+
 void RTL::setSafepointAsDestination(DestinationPosition &rtl_position,
 				    const mission_item_s &mission_safe_point) const
 {
@@ -46,6 +46,8 @@
 #include "navigator_mode.h"
 #include "navigation.h"
 #include <dataman_client/DatamanClient.hpp>
+#include <dataman/dataman.h>
+#include <lib/geo/geo.h>
 #include "rtl_base.h"
 #include "rtl_direct.h"
 #include "rtl_direct_mission_land.h"
@@ -117,6 +119,12 @@ private:
 	 */
 	void setLandPosAsDestination(DestinationPosition &rtl_position, mission_item_s &land_mission_item) const;
 
+	/**
+	 * @brief Rebuild the safe point candidates from the loaded safe points.
+	 *
+	 */
+	void updateSafePointCandidates();
+
 	/**
 	 * @brief Set the safepoint as destination.
 	 *
@@ -196,6 +204,20 @@ private:
 	DatamanClient	&_dataman_client_safepoint = _dataman_cache_safepoint.client();
 	bool _initiate_safe_points_updated{true}; ///< flag indicating if safe points update is needed
 	mutable DatamanCache _dataman_cache_landItem{"rtl_dm_cache_miss_land", 2};
+
+	/**
+	 * Rally point as RTL destination candidate, extracted from the safe points once after they are loaded.
+	 */
+	struct SafePointCandidate {
+		mission_item_s item;		///< rally point (position and altitude frame)
+		matrix::Vector2f position;	///< north/east position in the frame of _safe_points_ref [m]
+		bool has_land_approach;		///< VTOL land approaches are defined for this rally point
+	};
+
+	SafePointCandidate _safe_point_candidates[DM_KEY_SAFE_POINTS_MAX] {};
+	int _num_safe_point_candidates{0};
+	MapProjection _safe_points_ref{}; ///< local frame of the candidates, at the first rally point
+
 	uint32_t _mission_id = 0u;
 
 	mission_stats_entry_s _stats;
@@ -61,9 +61,11 @@
 #include <string>
 
 #include <logger/messages.h>
+#include <lib/ulog/ULogFormat.hpp>
 
 #include "Replay.hpp"
 #include "ReplayEkf2.hpp"
+#include "ReplayFile.hpp"
 
 #define PARAMS_OVERRIDE_FILE PX4_ROOTFSDIR "/replay_params.txt"
 #define DYNAMIC_PARAMS_OVERRIDE_FILE PX4_ROOTFSDIR "/replay_params_dynamic.txt"
@@ -237,7 +239,7 @@ Replay::readDynamicParams(const char *filename)
 }
 
 bool
-Replay::readFileHeader(std::ifstream &file)
+Replay::readFileHeader(std::istream &file)
 {
 	file.seekg(0);
 	ulog_file_header_s msg_header;
@@ -261,7 +263,7 @@ Replay::readFileHeader(std::ifstream &file)
 }
 
 bool
-Replay::readFileDefinitions(std::ifstream &file)
+Replay::readFileDefinitions(std::istream &file)
 {
 	PX4_INFO("Applying params from ULog file...");
 
@@ -319,7 +321,7 @@ Replay::readFileDefinitions(std::ifstream &file)
 }
 
 bool
-Replay::readFlagBits(std::ifstream &file, uint16_t msg_size)
+Replay::readFlagBits(std::istream &file, uint16_t msg_size)
 {
 	if (msg_size != 40) {
 		PX4_ERR("unsupported message length for FLAG_BITS message (%i)", msg_size);
@@ -366,7 +368,7 @@ Replay::readFlagBits(std::ifstream &file, uint16_t msg_size)
 }
 
 bool
-Replay::readFormat(std::ifstream &file, uint16_t msg_size)
+Replay::readFormat(std::istream &file, uint16_t msg_size)
 {
 	_read_buffer.reserve(msg_size + 1);
 	char *format = (char *)_read_buffer.data();
@@ -419,7 +421,7 @@ string Replay::getOrbFields(const orb_metadata *meta)
 }
 
 bool
-Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
+Replay::readAndAddSubscription(std::istream &file, uint16_t msg_size)
 {
 	_read_buffer.reserve(msg_size + 1);
 	uint8_t *message = _read_buffer.data();
@@ -578,61 +580,135 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 bool
 Replay::findFieldOffset(const string &format, const string &field_name, int &offset, int &field_size)
 {
-	size_t prev_field_end = 0;
-	size_t field_end = format.find(';');
+	bool found = false;
 	offset = 0;
 	field_size = 0;
 
-	while (field_end != string::npos) {
-		size_t space_pos = format.find(' ', prev_field_end);
+	ulog::forEachField(format, [&](const string & type_name_full, const string & cur_field_name) {
+		if (cur_field_name == field_name) {
+			field_size = sizeOfFullType(type_name_full);
+			found = true;
+			return false;
+		}
+
+		offset += sizeOfFullType(type_name_full);
+		return true;
+	});
 
-		if (space_pos != string::npos) {
-			string type_name_full = format.substr(prev_field_end, space_pos - prev_field_end);
-			string cur_field_name = format.substr(space_pos + 1, field_end - space_pos - 1);
+	return found;
+}
 
-			if (cur_field_name == field_name) {
-				field_size = sizeOfFullType(type_name_full);
-				return true;
+void
+Replay::buildMessageIndex(std::istream &file)
+{
+	_message_index = MessageIndex{};
 
-			} else {
-				offset += sizeOfFullType(type_name_full);
-			}
+	ulog_message_header_s message_header;
+	file.seekg(_data_section_start);
+
+	while (file) {
+		const uint64_t cur_pos = (streamoff)file.tellg();
+		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+
+		if (!file || cur_pos + ULOG_MSG_HEADER_LEN + message_header.msg_size > (uint64_t)_read_until_file_position) {
+			break;
 		}
 
-		prev_field_end = field_end + 1;
-		field_end = format.find(';', prev_field_end);
+		switch (message_header.msg_type) {
+		case (int)ULogMessageType::DATA: {
+				uint16_t file_msg_id;
+				file.read((char *)&file_msg_id, sizeof(file_msg_id));
+
+				if (!file || message_header.msg_size < sizeof(file_msg_id)) {
+					break;
+				}
+
+				if (_message_index.data.size() <= file_msg_id) {
+					_message_index.data.resize(file_msg_id + 1);
+				}
+
+				_message_index.data[file_msg_id].push_back(cur_pos);
+				file.seekg(message_header.msg_size - sizeof(file_msg_id), ios::cur);
+			}
+			break;
+
+		case (int)ULogMessageType::ADD_LOGGED_MSG:
+			_message_index.add_logged_msg.push_back(cur_pos);
+			file.seekg(message_header.msg_size, ios::cur);
+			break;
+
+		case (int)ULogMessageType::PARAMETER:
+		case (int)ULogMessageType::DROPOUT:
+			_message_index.additional.push_back(cur_pos);
+			file.seekg(message_header.msg_size, ios::cur);
+			break;
+
+		case (int)ULogMessageType::REMOVE_LOGGED_MSG: //skip these
+		case (int)ULogMessageType::INFO:
+		case (int)ULogMessageType::INFO_MULTIPLE:
+		case (int)ULogMessageType::SYNC:
+		case (int)ULogMessageType::LOGGING:
+		case (int)ULogMessageType::PARAMETER_DEFAULT:
+			file.seekg(message_header.msg_size, ios::cur);
+			break;
+
+		default:
+			//this really should not happen
+			PX4_ERR("unknown log message type %i, size %i (offset %" PRIu64 ")",
+				(int)message_header.msg_type, (int)message_header.msg_size, cur_pos);
+			file.seekg(message_header.msg_size, ios::cur);
+			break;
+		}
 	}
 
-	return false;
+	file.clear();
+}
+
+void
+Replay::addSubscriptionsUntil(std::istream &file, uint64_t end_position)
+{
+	const std::vector<uint64_t> &offsets = _message_index.add_logged_msg;
+	ulog_message_header_s message_header;
+
+	// messages before _subscription_file_pos are already read
+	for (auto it = std::lower_bound(offsets.begin(), offsets.end(), (uint64_t)(streamoff)_subscription_file_pos);
+	     it != offsets.end() && *it < end_position; ++it) {
+
+		file.seekg(*it);
+		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+
+		if (!file) {
+			file.clear();
+			return;
+		}
+
+		readAndAddSubscription(file, message_header.msg_size);
+	}
 }
 
 bool
-Replay::readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position)
+Replay::readAndHandleAdditionalMessages(std::istream &file, std::streampos end_position)
 {
+	const std::vector<uint64_t> &offsets = _message_index.additional;
 	ulog_message_header_s message_header;
 
-	while (file.tellg() < end_position) {
+	for (auto it = std::lower_bound(offsets.begin(), offsets.end(), (uint64_t)(streamoff)file.tellg());
+	     it != offsets.end() && *it < (uint64_t)(streamoff)end_position; ++it) {
+
+		file.seekg(*it);
 		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
 
 		if (!file) {
 			return false;
 		}
 
-		switch (message_header.msg_type) {
-		case (int)ULogMessageType::PARAMETER:
+		if (message_header.msg_type == (int)ULogMessageType::PARAMETER) {
 			if (!readAndApplyParameter(file, message_header.msg_size)) {
 				return false;
 			}
 
-			break;
-
-		case (int)ULogMessageType::DROPOUT:
+		} else {
 			readDropout(file, message_header.msg_size);
-			break;
-
-		default: //skip all others
-			file.seekg(message_header.msg_size, ios::cur);
-			break;
 		}
 	}
 
@@ -640,7 +716,7 @@ Replay::readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_
 }
 
 bool
-Replay::readAndApplyParameter(std::ifstream &file, uint16_t msg_size)
+Replay::readAndApplyParameter(std::istream &file, uint16_t msg_size)
 {
 	_read_buffer.reserve(msg_size);
 	uint8_t *message = (uint8_t *)_read_buffer.data();
@@ -683,7 +759,7 @@ Replay::readAndApplyParameter(std::ifstream &file, uint16_t msg_size)
 }
 
 bool
-Replay::readDropout(std::ifstream &file, uint16_t msg_size)
+Replay::readDropout(std::istream &file, uint16_t msg_size)
 {
 	uint16_t duration;
 	file.read((char *)&duration, sizeof(duration));
@@ -693,87 +769,45 @@ Replay::readDropout(std::ifstream &file, uint16_t msg_size)
 }
 
 bool
-Replay::nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id)
+Replay::nextDataMessage(std::istream &file, Subscription &subscription, int msg_id)
 {
 	ulog_message_header_s message_header;
-	file.seekg(subscription.next_read_pos);
-	//ignore the first message (it's data we already read)
-	file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
 
-	if (file) {
-		file.seekg(message_header.msg_size, ios::cur);
-	}
+	if ((size_t)msg_id < _message_index.data.size()) {
+		const std::vector<uint64_t> &offsets = _message_index.data[msg_id];
 
-	uint16_t file_msg_id;
-	bool done = false;
+		//ignore the first message (it's data we already read)
+		for (auto it = std::upper_bound(offsets.begin(), offsets.end(), (uint64_t)(streamoff)subscription.next_read_pos);
+		     it != offsets.end(); ++it) {
 
-	while (file && !done) {
-		streampos cur_pos = file.tellg();
-		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+			// new subscriptions logged before this message
+			addSubscriptionsUntil(file, *it);
 
-		if (!file) {
-			break;
-		}
-
-		if (((streamoff)cur_pos) + ULOG_MSG_HEADER_LEN + message_header.msg_size > _read_until_file_position) {
-			file.setstate(std::ios::eofbit);
-			break;
-		}
-
-		switch (message_header.msg_type) {
-		case (int)ULogMessageType::ADD_LOGGED_MSG:
-			readAndAddSubscription(file, message_header.msg_size);
-			break;
-
-		case (int)ULogMessageType::DATA:
-			file.read((char *)&file_msg_id, sizeof(file_msg_id));
-
-			if (file) {
-				if (msg_id == file_msg_id) {
-					if (message_header.msg_size == subscription.orb_meta->o_size_no_padding + 2) {
-						subscription.next_read_pos = cur_pos;
-						file.seekg(subscription.timestamp_offset, ios::cur);
-						file.read((char *)&subscription.next_timestamp, sizeof(subscription.next_timestamp));
-						done = true;
-
-					} else { //sanity check failed!
-						PX4_ERR("data message %s has wrong size %i (expected %i). Skipping",
-							subscription.orb_meta->o_name, message_header.msg_size,
-							subscription.orb_meta->o_size_no_padding + 2);
-						file.seekg(message_header.msg_size - sizeof(file_msg_id), ios::cur);
-					}
+			file.seekg(*it);
+			file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
 
-				} else { //not the one we are looking for
-					file.seekg(message_header.msg_size - sizeof(file_msg_id), ios::cur);
-				}
+			if (!file) {
+				break;
 			}
 
-			break;
+			if (message_header.msg_size == subscription.orb_meta->o_size_no_padding + 2) {
+				subscription.next_read_pos = *it;
+				file.seekg(*it + ULOG_MSG_HEADER_LEN + 2 + subscription.timestamp_offset);
+				file.read((char *)&subscription.next_timestamp, sizeof(subscription.next_timestamp));
+				return file.good();
 
-		case (int)ULogMessageType::REMOVE_LOGGED_MSG: //skip these
-		case (int)ULogMessageType::PARAMETER:
-		case (int)ULogMessageType::DROPOUT:
-		case (int)ULogMessageType::INFO:
-		case (int)ULogMessageType::INFO_MULTIPLE:
-		case (int)ULogMessageType::SYNC:
-		case (int)ULogMessageType::LOGGING:
-		case (int)ULogMessageType::PARAMETER_DEFAULT:
-			file.seekg(message_header.msg_size, ios::cur);
-			break;
-
-		default:
-			//this really should not happen
-			PX4_ERR("unknown log message type %i, size %i (offset %i)",
-				(int)message_header.msg_type, (int)message_header.msg_size, (int)file.tellg());
-			file.seekg(message_header.msg_size, ios::cur);
-			break;
+			} else { //sanity check failed!
+				PX4_ERR("data message %s has wrong size %i (expected %i). Skipping",
+					subscription.orb_meta->o_name, message_header.msg_size,
+					subscription.orb_meta->o_size_no_padding + 2);
+			}
 		}
 	}
 
-	if (file.eof()) { //no more data messages for this subscription
-		subscription.orb_meta = nullptr;
-		file.clear();
-	}
+	//no more data messages for this subscription
+	addSubscriptionsUntil(file, UINT64_MAX);
+	subscription.orb_meta = nullptr;
+	file.clear();
 
 	return file.good();
 }
@@ -795,43 +829,19 @@ Replay::findTopic(const std::string &name)
 std::string
 Replay::extractArraySize(const std::string &type_name_full, int &array_size)
 {
-	size_t start_pos = type_name_full.find('[');
-	size_t end_pos = type_name_full.find(']');
-
-	if (start_pos == string::npos || end_pos == string::npos) {
-		array_size = 1;
-		return type_name_full;
-	}
-
-	array_size = atoi(type_name_full.substr(start_pos + 1, end_pos - start_pos - 1).c_str());
-	return type_name_full.substr(0, start_pos);
+	return ulog::extractArraySize(type_name_full, array_size);
 }
 
 size_t
 Replay::sizeOfType(const std::string &type_name)
 {
-	if (type_name == "int8_t" || type_name == "uint8_t") {
-		return 1;
-
-	} else if (type_name == "int16_t" || type_name == "uint16_t") {
-		return 2;
+	const size_t basic_type_size = ulog::sizeOfBasicType(type_name);
 
-	} else if (type_name == "int32_t" || type_name == "uint32_t") {
-		return 4;
-
-	} else if (type_name == "int64_t" || type_name == "uint64_t") {
-		return 8;
-
-	} else if (type_name == "float") {
-		return 4;
-
-	} else if (type_name == "double") {
-		return 8;
-
-	} else if (type_name == "char" || type_name == "bool") {
-		return 1;
+	if (basic_type_size > 0) {
+		return basic_type_size;
 	}
 
+	// nested types are compared against the internal topic definitions
 	const orb_metadata *orb_meta = findTopic(type_name);
 
 	if (orb_meta) {
@@ -851,7 +861,7 @@ Replay::sizeOfFullType(const std::string &type_name_full)
 }
 
 bool
-Replay::readDefinitionsAndApplyParams(std::ifstream &file)
+Replay::readDefinitionsAndApplyParams(std::istream &file)
 {
 	// log reader currently assumes little endian
 	int num = 1;
@@ -861,7 +871,7 @@ Replay::readDefinitionsAndApplyParams(std::ifstream &file)
 		return false;
 	}
 
-	if (!file.is_open()) {
+	if (!file) {
 		PX4_ERR("Failed to open replay file");
 		return false;
 	}
@@ -885,7 +895,7 @@ Replay::readDefinitionsAndApplyParams(std::ifstream &file)
 void
 Replay::run()
 {
-	ifstream replay_file(_replay_file, ios::in | ios::binary);
+	ReplayFile replay_file(_replay_file);
 
 	if (!readDefinitionsAndApplyParams(replay_file)) {
 		return;
@@ -898,6 +908,8 @@ Replay::run()
 		_speed_factor = atof(speedup);
 	}
 
+	buildMessageIndex(replay_file);
+
 	onEnterMainLoop();
 
 	_replay_start_time = hrt_absolute_time();
@@ -1026,7 +1038,7 @@ Replay::run()
 }
 
 void
-Replay::readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_file)
+Replay::readTopicDataToBuffer(const Subscription &sub, std::istream &replay_file)
 {
 	const size_t msg_read_size = sub.orb_meta->o_size_no_padding;
 	const size_t msg_write_size = sub.orb_meta->o_size;
@@ -1036,7 +1048,7 @@ Replay::readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_fil
 }
 
 bool
-Replay::handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file)
+Replay::handleTopicUpdate(Subscription &sub, void *data, std::istream &replay_file)
 {
 	return publishTopic(sub, data);
 }
@@ -1182,7 +1194,7 @@ Replay::applyParams(bool quiet)
 		return -ENOMEM;
 	}
 
-	ifstream replay_file(_replay_file, ios::in | ios::binary);
+	ReplayFile replay_file(_replay_file);
 
 	if (!r->readDefinitionsAndApplyParams(replay_file)) {
 		ret = -1;
@@ -1231,6 +1243,9 @@ the log file to be replayed. The second is the mode, specified via `replay_mode`
 - Generic otherwise: this can be used to replay any module(s), but the replay will be done with the same speed as the
   log was recorded.
 
+Many logs (and parameter sets) can be replayed in parallel with `Tools/ecl_ekf/batch_replay_ekf2.py`, which runs one
+px4 instance per replay session.
+
 The module is typically used together with uORB publisher rules, to specify which messages should be replayed.
 The replay module will just publish all messages that are found in the log. It also applies the parameters from
 the log.
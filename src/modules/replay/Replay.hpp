@@ -190,22 +190,22 @@ protected:
 	 * handle the publication of a topic update
 	 * @return true if published, false otherwise
 	 */
-	virtual bool handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file);
+	virtual bool handleTopicUpdate(Subscription &sub, void *data, std::istream &replay_file);
 
 	/**
 	 * read a topic from the file (offset given by the subscription) into _read_buffer
 	 */
-	void readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_file);
+	void readTopicDataToBuffer(const Subscription &sub, std::istream &replay_file);
 
 	/**
 	 * Find next data message for this subscription, starting with the stored file offset.
 	 * Skip the first message, and if found, read the timestamp and store the new file offset.
-	 * This also takes care of new subscriptions and parameter updates. When reaching EOF,
-	 * the subscription is set to invalid.
+	 * This also takes care of new subscriptions. When reaching EOF, the subscription is set to invalid.
+	 * Uses the message index, so buildMessageIndex() must be called before.
 	 * File seek position is arbitrary after this call.
 	 * @return false on file error
 	 */
-	bool nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id);
+	bool nextDataMessage(std::istream &file, Subscription &subscription, int msg_id);
 
 	virtual uint64_t getTimestampOffset()
 	{
@@ -249,28 +249,48 @@ private:
 
 	int64_t _read_until_file_position = 1ULL << 60; ///< read limit if log contains appended data
 
+	/** file offsets of the messages in the data section, built once before replaying */
+	struct MessageIndex {
+		std::vector<std::vector<uint64_t>> data; ///< DATA messages, per msg_id
+		std::vector<uint64_t> add_logged_msg; ///< ADD_LOGGED_MSG messages
+		std::vector<uint64_t> additional; ///< PARAMETER and DROPOUT messages
+	};
+
+	MessageIndex _message_index;
+
 	float _accumulated_delay{0.f};
 
-	bool readFileHeader(std::ifstream &file);
+	bool readFileHeader(std::istream &file);
 
 	/**
 	 * Read definitions section: check formats, apply parameters and store
 	 * the start of the data section.
 	 * @return true on success
 	 */
-	bool readFileDefinitions(std::ifstream &file);
+	bool readFileDefinitions(std::istream &file);
 
 	///file parsing methods. They return false, when further parsing should be aborted.
-	bool readFormat(std::ifstream &file, uint16_t msg_size);
-	bool readAndAddSubscription(std::ifstream &file, uint16_t msg_size);
-	bool readFlagBits(std::ifstream &file, uint16_t msg_size);
+	bool readFormat(std::istream &file, uint16_t msg_size);
+	bool readAndAddSubscription(std::istream &file, uint16_t msg_size);
+	bool readFlagBits(std::istream &file, uint16_t msg_size);
 
 	/**
 	 * Read the file header and definitions sections. Apply the parameters from this section
 	 * and apply user-defined overridden parameters.
 	 * @return true on success
 	 */
-	bool readDefinitionsAndApplyParams(std::ifstream &file);
+	bool readDefinitionsAndApplyParams(std::istream &file);
+
+	/**
+	 * Scan the data section once and store the offsets of all messages needed during replay, so that
+	 * finding the next message of a subscription does not require reading through all others.
+	 */
+	void buildMessageIndex(std::istream &file);
+
+	/**
+	 * Add the subscriptions of all ADD_LOGGED_MSG messages before end_position that were not read yet.
+	 */
+	void addSubscriptionsUntil(std::istream &file, uint64_t end_position);
 
 	/**
 	 * Read and handle additional messages starting at current file position, while position < end_position.
@@ -278,9 +298,9 @@ private:
 	 * We need to handle these separately, because they have no timestamp. We look at the file position instead.
 	 * @return false on file error
 	 */
-	bool readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position);
-	bool readDropout(std::ifstream &file, uint16_t msg_size);
-	bool readAndApplyParameter(std::ifstream &file, uint16_t msg_size);
+	bool readAndHandleAdditionalMessages(std::istream &file, std::streampos end_position);
+	bool readDropout(std::istream &file, uint16_t msg_size);
+	bool readAndApplyParameter(std::istream &file, uint16_t msg_size);
 
 	static const orb_metadata *findTopic(const std::string &name);
 
@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ReplayFile.hpp
+ *
+ * Input stream for the replayed ULog file. The file is memory-mapped and all reads
+ * are served directly from the mapping, so the random access pattern of the replay
+ * (every subscription keeps its own read position) does not go through the
+ * buffering and seeking of a std::ifstream. Falls back to a std::filebuf if the file
+ * cannot be mapped.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <istream>
+
+#include <lib/ulog/MappedFile.hpp>
+
+namespace px4
+{
+
+/**
+ * @class ReplayFile
+ * Binary input stream of the replay file, memory-mapped if possible.
+ */
+class ReplayFile : public std::istream
+{
+public:
+	explicit ReplayFile(const char *file_name) : std::istream(nullptr)
+	{
+		if (_mapped_buffer.open(file_name)) {
+			rdbuf(&_mapped_buffer);
+
+		} else if (_file_buffer.open(file_name, std::ios::in | std::ios::binary)) {
+			rdbuf(&_file_buffer);
+
+		} else {
+			setstate(std::ios::failbit);
+		}
+	}
+
+	bool is_open() const { return rdbuf() != nullptr; }
+
+	bool is_mapped() const { return rdbuf() == &_mapped_buffer; }
+
+	void close()
+	{
+		_mapped_buffer.close();
+		_file_buffer.close();
+		rdbuf(nullptr);
+	}
+
+private:
+	ulog::MappedFileBuffer _mapped_buffer;
+	std::filebuf _file_buffer;
+};
+
+} //namespace px4
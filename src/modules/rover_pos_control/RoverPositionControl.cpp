@@ -70,6 +70,8 @@ RoverPositionControl::~RoverPositionControl()
 bool
 RoverPositionControl::init()
 {
+	parameters_update(true);
+
 	if (!_vehicle_angular_velocity_sub.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
@@ -92,6 +94,10 @@ void RoverPositionControl::parameters_update(bool force)
 		_gnd_control.set_l1_damping(_param_l1_damping.get());
 		_gnd_control.set_l1_period(_param_l1_period.get());
 
+		_ackermann_kinematics.setWheelBase(_param_wheel_base.get());
+		_ackermann_kinematics.setMaxSpeed(_param_gndspeed_max.get());
+		_ackermann_kinematics.setMaxSteeringAngle(_param_max_turn_angle.get());
+
 		pid_init(&_speed_ctrl, PID_MODE_DERIVATIV_CALC, 0.01f);
 		pid_set_parameters(&_speed_ctrl,
 				   _param_speed_p.get(),
@@ -268,19 +274,14 @@ RoverPositionControl::control_position(const matrix::Vector2d &current_position,
 
 				} else {
 					Vector2f curr_pos_local{_local_pos.x, _local_pos.y};
-					Vector2f curr_wp_local = _global_local_proj_ref.project(curr_wp(0), curr_wp(1));
-					Vector2f prev_wp_local = _global_local_proj_ref.project(prev_wp(0),
-								 prev_wp(1));
-					_gnd_control.navigate_waypoints(prev_wp_local, curr_wp_local, curr_pos_local, ground_speed_2d);
+					update_path_segment(prev_wp, curr_wp);
+					_gnd_control.navigate_waypoints(_path_segment.prev_wp_local, _path_segment.curr_wp_local, curr_pos_local,
+									ground_speed_2d);
 
 					_throttle_control = mission_throttle;
 
-					float desired_r = ground_speed_2d.norm_squared() / math::abs_t(_gnd_control.nav_lateral_acceleration_demand());
-					float desired_theta = (0.5f * M_PI_F) - atan2f(desired_r, _param_wheel_base.get());
-					float control_effort = (desired_theta / _param_max_turn_angle.get()) * sign(
-								       _gnd_control.nav_lateral_acceleration_demand());
-					control_effort = math::constrain(control_effort, -1.0f, 1.0f);
-					_yaw_control = control_effort;
+					_yaw_control = _ackermann_kinematics.computeSteering(ground_speed_2d.norm(),
+							_gnd_control.nav_lateral_acceleration_demand());
 				}
 			}
 			break;
@@ -314,6 +315,24 @@ RoverPositionControl::control_position(const matrix::Vector2d &current_position,
 	return setpoint;
 }
 
+void
+RoverPositionControl::update_path_segment(const matrix::Vector2d &prev_wp, const matrix::Vector2d &curr_wp)
+{
+	if ((prev_wp(0) != _path_segment.prev_lat) || (prev_wp(1) != _path_segment.prev_lon)
+	    || (curr_wp(0) != _path_segment.curr_lat) || (curr_wp(1) != _path_segment.curr_lon)
+	    || (_global_local_proj_ref.getProjectionReferenceTimestamp() != _path_segment.ref_timestamp)) {
+
+		_path_segment.prev_lat = prev_wp(0);
+		_path_segment.prev_lon = prev_wp(1);
+		_path_segment.curr_lat = curr_wp(0);
+		_path_segment.curr_lon = curr_wp(1);
+		_path_segment.ref_timestamp = _global_local_proj_ref.getProjectionReferenceTimestamp();
+
+		_path_segment.prev_wp_local = _global_local_proj_ref.project(prev_wp(0), prev_wp(1));
+		_path_segment.curr_wp_local = _global_local_proj_ref.project(curr_wp(0), curr_wp(1));
+	}
+}
+
 void
 RoverPositionControl::control_velocity(const matrix::Vector3f &current_velocity)
 {
@@ -379,8 +398,6 @@ RoverPositionControl::control_attitude(const vehicle_attitude_s &att, const vehi
 void
 RoverPositionControl::Run()
 {
-	parameters_update(true);
-
 	/* run controller on gyro changes */
 	vehicle_angular_velocity_s angular_velocity;
 
@@ -46,6 +46,7 @@
 #include <drivers/drv_hrt.h>
 #include <lib/geo/geo.h>
 #include <lib/l1/ECL_L1_Pos_Controller.hpp>
+#include <lib/rover_kinematics/AckermannKinematics.hpp>
 #include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
 #include <lib/pid/pid.h>
@@ -146,6 +147,21 @@ private:
 
 	ECL_L1_Pos_Controller				_gnd_control;
 
+	AckermannKinematics _ackermann_kinematics{};
+
+	/* current path segment, only projected to the local frame again when the waypoints or the reference change */
+	struct PathSegment {
+		double prev_lat{NAN};
+		double prev_lon{NAN};
+		double curr_lat{NAN};
+		double curr_lon{NAN};
+		uint64_t ref_timestamp{0};
+		matrix::Vector2f prev_wp_local{};
+		matrix::Vector2f curr_wp_local{};
+	} _path_segment{};
+
+	void update_path_segment(const matrix::Vector2d &prev_wp, const matrix::Vector2d &curr_wp);
+
 	enum UGV_POSCTRL_MODE {
 		UGV_POSCTRL_MODE_AUTO,
 		UGV_POSCTRL_MODE_OTHER
@@ -0,0 +1,364 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "SamplingProfiler.hpp"
+
+#include <px4_platform_common/getopt.h>
+
+#include <errno.h>
+
+#if defined(__PX4_NUTTX)
+# if defined(CONFIG_ARCH_ARM)
+#  include "arm_internal.h"
+# endif
+#else
+# include <sys/time.h>
+# include <unistd.h>
+# if defined(__PX4_LINUX)
+#  include <link.h>
+#  include <sys/syscall.h>
+#  include <ucontext.h>
+# elif defined(__PX4_DARWIN)
+#  include <mach-o/dyld.h>
+#  include <sys/ucontext.h>
+# endif
+#endif // __PX4_NUTTX
+
+using namespace time_literals;
+
+#if !defined(__PX4_NUTTX)
+px4::atomic<SamplingProfiler *> SamplingProfiler::_signal_instance{nullptr};
+px4::atomic<int> SamplingProfiler::_signal_handlers_active{0};
+
+#if defined(__PX4_LINUX)
+static int first_object_address(struct dl_phdr_info *info, size_t size, void *data)
+{
+	// the first object is the executable itself
+	*static_cast<uint64_t *>(data) = info->dlpi_addr;
+	return 1;
+}
+#endif // __PX4_LINUX
+
+static uint64_t interrupted_pc(void *context)
+{
+	const ucontext_t *uc = static_cast<const ucontext_t *>(context);
+#if defined(__PX4_LINUX) && defined(__x86_64__)
+	return uc->uc_mcontext.gregs[REG_RIP];
+#elif defined(__PX4_LINUX) && defined(__aarch64__)
+	return uc->uc_mcontext.pc;
+#elif defined(__PX4_LINUX) && defined(__arm__)
+	return uc->uc_mcontext.arm_pc;
+#elif defined(__PX4_DARWIN) && defined(__x86_64__)
+	return uc->uc_mcontext->__ss.__rip;
+#elif defined(__PX4_DARWIN) && defined(__aarch64__)
+	return uc->uc_mcontext->__ss.__pc;
+#else
+	(void)uc;
+	return 0;
+#endif
+}
+#endif // !__PX4_NUTTX
+
+SamplingProfiler::SamplingProfiler(uint32_t interval_us) :
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::lp_default),
+	_interval_us(interval_us)
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+	StopSampling();
+}
+
+bool SamplingProfiler::init()
+{
+	if (!StartSampling()) {
+		return false;
+	}
+
+	ScheduleOnInterval(20_ms);
+	return true;
+}
+
+bool SamplingProfiler::StartSampling()
+{
+#if defined(__PX4_NUTTX)
+	hrt_call_every(&_call, _interval_us, _interval_us, &SamplingProfiler::hrt_callback, this);
+	return true;
+#else
+
+#if defined(__PX4_LINUX)
+	dl_iterate_phdr(first_object_address, &_load_address);
+#elif defined(__PX4_DARWIN)
+	_load_address = _dyld_get_image_vmaddr_slide(0);
+#endif
+
+	_signal_instance.store(this);
+
+	struct sigaction action {};
+	action.sa_sigaction = &SamplingProfiler::signal_handler;
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&action.sa_mask);
+
+	if (sigaction(SIGPROF, &action, &_previous_action) != 0) {
+		PX4_ERR("sigaction failed (%i)", errno);
+		_signal_instance.store(nullptr);
+		return false;
+	}
+
+	struct itimerval timer {};
+	timer.it_interval.tv_sec = _interval_us / 1000000;
+	timer.it_interval.tv_usec = _interval_us % 1000000;
+	timer.it_value = timer.it_interval;
+
+	if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+		PX4_ERR("setitimer failed (%i)", errno);
+		sigaction(SIGPROF, &_previous_action, nullptr);
+		_signal_instance.store(nullptr);
+		return false;
+	}
+
+	return true;
+#endif // __PX4_NUTTX
+}
+
+void SamplingProfiler::StopSampling()
+{
+#if defined(__PX4_NUTTX)
+	hrt_cancel(&_call);
+#else
+
+	if (_signal_instance.load() != this) {
+		return;
+	}
+
+	struct itimerval timer {};
+	setitimer(ITIMER_PROF, &timer, nullptr);
+	sigaction(SIGPROF, &_previous_action, nullptr);
+
+	// wait for handlers still running on other threads before the object goes away
+	_signal_instance.store(nullptr);
+
+	while (_signal_handlers_active.load() != 0) {
+		px4_usleep(100);
+	}
+
+#endif // __PX4_NUTTX
+}
+
+#if defined(__PX4_NUTTX)
+void SamplingProfiler::hrt_callback(void *arg)
+{
+	uint64_t pc = 0;
+
+#if defined(CONFIG_ARCH_ARM)
+
+	// the callout runs in the HRT interrupt, CURRENT_REGS is the context it interrupted
+	if (CURRENT_REGS) {
+		pc = CURRENT_REGS[REG_PC];
+	}
+
+#endif // CONFIG_ARCH_ARM
+
+	static_cast<SamplingProfiler *>(arg)->Sample(pc, getpid());
+}
+#else
+void SamplingProfiler::signal_handler(int signo, siginfo_t *info, void *context)
+{
+	_signal_handlers_active.fetch_add(1);
+
+	SamplingProfiler *instance = _signal_instance.load();
+
+	if (instance) {
+#if defined(__PX4_LINUX)
+		const uint32_t tid = syscall(SYS_gettid);
+#else
+		const uint32_t tid = 0;
+#endif
+		instance->Sample(interrupted_pc(context), tid);
+	}
+
+	_signal_handlers_active.fetch_sub(1);
+}
+#endif // __PX4_NUTTX
+
+void SamplingProfiler::Sample(uint64_t pc, uint32_t tid)
+{
+	int not_sampling = 0;
+
+	if (!_sampling.compare_exchange(&not_sampling, 1)) {
+		_dropped.fetch_add(1);
+		return;
+	}
+
+	const uint32_t head = _head.load();
+
+	if (head - _tail.load() < BUFFER_SIZE) {
+		_buffer[head % BUFFER_SIZE] = {pc, tid};
+		_head.store(head + 1);
+
+	} else {
+		_dropped.fetch_add(1);
+	}
+
+	_sampling.store(0);
+}
+
+void SamplingProfiler::Run()
+{
+	if (should_exit()) {
+		ScheduleClear();
+		StopSampling();
+		exit_and_cleanup();
+		return;
+	}
+
+	const uint32_t head = _head.load();
+	uint32_t tail = _tail.load();
+
+	while (tail != head) {
+		profiler_samples_s profiler_samples{};
+		profiler_samples.load_address = _load_address;
+		profiler_samples.sample_interval_us = _interval_us;
+
+		while ((tail != head) && (profiler_samples.count < profiler_samples_s::MAX_SAMPLES)) {
+			const ProfilerSample &sample = _buffer[tail % BUFFER_SIZE];
+			profiler_samples.pc[profiler_samples.count] = sample.pc;
+			profiler_samples.tid[profiler_samples.count] = sample.tid;
+			profiler_samples.count++;
+			tail++;
+		}
+
+		_tail.store(tail);
+
+		profiler_samples.dropped = _dropped.fetch_and(0);
+		profiler_samples.timestamp = hrt_absolute_time();
+		_profiler_samples_pub.publish(profiler_samples);
+
+		_sample_count += profiler_samples.count;
+		_dropped_count += profiler_samples.dropped;
+	}
+}
+
+int SamplingProfiler::task_spawn(int argc, char *argv[])
+{
+	uint32_t rate_hz = DEFAULT_RATE_HZ;
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "r:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'r':
+			rate_hz = strtoul(myoptarg, nullptr, 10);
+			break;
+
+		default:
+			print_usage("unrecognized flag");
+			return PX4_ERROR;
+		}
+	}
+
+	if (rate_hz < 1 || rate_hz > MAX_RATE_HZ) {
+		PX4_ERR("rate must be between 1 and %" PRIu32 " Hz", MAX_RATE_HZ);
+		return PX4_ERROR;
+	}
+
+	SamplingProfiler *instance = new SamplingProfiler(1000000 / rate_hz);
+
+	if (instance) {
+		_object.store(instance);
+		_task_id = task_id_is_work_queue;
+
+		if (instance->init()) {
+			return PX4_OK;
+		}
+
+	} else {
+		PX4_ERR("alloc failed");
+	}
+
+	delete instance;
+	_object.store(nullptr);
+	_task_id = -1;
+
+	return PX4_ERROR;
+}
+
+int SamplingProfiler::print_status()
+{
+	PX4_INFO("sampling at %" PRIu32 " Hz, %" PRIu64 " samples, %" PRIu64 " dropped",
+		 1000000 / _interval_us, _sample_count, _dropped_count);
+	return 0;
+}
+
+int SamplingProfiler::custom_command(int argc, char *argv[])
+{
+	return print_usage("unknown command");
+}
+
+int SamplingProfiler::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_WARN("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Statistical profiler: samples the program counter of whatever is running at a fixed rate and publishes
+the samples as profiler_samples, which the logger records when the module is built in.
+
+On NuttX the samples are taken from a HRT callout (the context interrupted by the timer interrupt),
+on POSIX from SIGPROF of a ITIMER_PROF interval timer, which only fires while the process uses CPU time.
+Note that on POSIX the signal can interrupt blocking calls that are not restarted (EINTR).
+
+Symbolize the log with `Tools/profiler/symbolize_profile.py` and the ELF file of the same build.
+
+### Examples
+Sample at 2 kHz:
+$ sampling_profiler start -r 2000
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("sampling_profiler", "system");
+	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_PARAM_INT('r', 1000, 1, 5000, "Sampling rate in Hz", true);
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+
+	return 0;
+}
+
+extern "C" __EXPORT int sampling_profiler_main(int argc, char *argv[])
+{
+	return SamplingProfiler::main(argc, argv);
+}
@@ -0,0 +1,124 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SamplingProfiler.hpp
+ *
+ * Statistical profiler sampling the interrupted program counter at a fixed rate, from a HRT callout on NuttX
+ * and from SIGPROF (ITIMER_PROF) on POSIX. The samples are buffered lock-free and published in batches as
+ * profiler_samples, to be logged and symbolized offline.
+ */
+
+#pragma once
+
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <drivers/drv_hrt.h>
+#include <uORB/Publication.hpp>
+#include <uORB/topics/profiler_samples.h>
+
+#if !defined(__PX4_NUTTX)
+#include <signal.h>
+#endif // !__PX4_NUTTX
+
+class SamplingProfiler : public ModuleBase<SamplingProfiler>, public px4::ScheduledWorkItem
+{
+public:
+	explicit SamplingProfiler(uint32_t interval_us);
+	~SamplingProfiler() override;
+
+	/** @see ModuleBase */
+	static int task_spawn(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int custom_command(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int print_usage(const char *reason = nullptr);
+
+	bool init();
+
+	int print_status() override;
+
+private:
+	static constexpr uint32_t BUFFER_SIZE = 256; // power of 2, holds 256 ms at 1 kHz
+	static constexpr uint32_t DEFAULT_RATE_HZ = 1000;
+	static constexpr uint32_t MAX_RATE_HZ = 5000;
+
+	void Run() override;
+
+	bool StartSampling();
+	void StopSampling();
+
+	/**
+	 * Record one sample, called from the sampling interrupt (NuttX) or signal handler (POSIX).
+	 * @param pc interrupted program counter
+	 * @param tid interrupted task or thread
+	 */
+	void Sample(uint64_t pc, uint32_t tid);
+
+#if defined(__PX4_NUTTX)
+	static void hrt_callback(void *arg);
+
+	struct hrt_call _call {};
+#else
+	static void signal_handler(int signo, siginfo_t *info, void *context);
+
+	struct sigaction _previous_action {};
+
+	static px4::atomic<SamplingProfiler *> _signal_instance;
+	static px4::atomic<int> _signal_handlers_active;
+#endif // __PX4_NUTTX
+
+	struct ProfilerSample {
+		uint64_t pc;
+		uint32_t tid;
+	};
+
+	// single producer ring buffer, written by Sample() and read by Run()
+	ProfilerSample _buffer[BUFFER_SIZE] {};
+	px4::atomic<uint32_t> _head{0};
+	px4::atomic<uint32_t> _tail{0};
+	px4::atomic<int> _sampling{0}; // drops samples of concurrent signal handlers instead of racing on _head
+	px4::atomic<uint32_t> _dropped{0};
+
+	const uint32_t _interval_us;
+	uint64_t _load_address{0};
+
+	uint64_t _sample_count{0};
+	uint64_t _dropped_count{0};
+
+	uORB::Publication<profiler_samples_s> _profiler_samples_pub{ORB_ID(profiler_samples)};
+};
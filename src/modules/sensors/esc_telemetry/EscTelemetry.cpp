@@ -0,0 +1,142 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "EscTelemetry.hpp"
+
+#include <lib/mathlib/mathlib.h>
+#include <px4_platform_common/px4_work_queue/WorkQueueManager.hpp>
+
+namespace sensors
+{
+
+static_assert(sizeof(esc_telemetry_s::rotor_frequency) / sizeof(esc_telemetry_s::rotor_frequency[0])
+	      == esc_status_s::CONNECTED_ESC_MAX, "esc_telemetry size mismatch");
+
+EscTelemetry::EscTelemetry() :
+	// run in the rate controller queue, so the RPM notch filters get the update without additional delay
+	WorkItem(MODULE_NAME, px4::wq_configurations::rate_ctrl)
+{
+}
+
+EscTelemetry::~EscTelemetry()
+{
+	Stop();
+	perf_free(_cycle_perf);
+}
+
+bool EscTelemetry::Start()
+{
+	return _esc_status_sub.registerCallback();
+}
+
+void EscTelemetry::Stop()
+{
+	_esc_status_sub.unregisterCallback();
+}
+
+void EscTelemetry::derive(const esc_status_s &esc_status, esc_telemetry_s &esc_telemetry)
+{
+	const uint8_t esc_count = math::min(esc_status.esc_count, esc_status_s::CONNECTED_ESC_MAX);
+
+	esc_telemetry.timestamp_sample = esc_status.timestamp;
+	esc_telemetry.esc_count = esc_count;
+	esc_telemetry.online_flags = esc_status.esc_online_flags;
+	esc_telemetry.connected_flags = 0;
+	esc_telemetry.failure_flags = 0;
+	esc_telemetry.online_count = 0;
+
+	float voltage_sum = 0.f;
+	float current_sum = 0.f;
+	float max_temperature = NAN;
+
+	for (int i = 0; i < esc_status_s::CONNECTED_ESC_MAX; i++) {
+		const esc_report_s &esc = esc_status.esc[i];
+
+		if (i >= esc_count) {
+			esc_telemetry.rotor_frequency[i] = 0.f;
+			esc_telemetry.timestamp_esc[i] = 0;
+			continue;
+		}
+
+		const bool online = esc_status.esc_online_flags & (1 << i);
+
+		if (online || (esc.esc_rpm != 0)) {
+			esc_telemetry.connected_flags |= (1 << i);
+		}
+
+		if (esc.failures != 0) {
+			esc_telemetry.failure_flags |= (1 << i);
+		}
+
+		if (online) {
+			esc_telemetry.online_count++;
+			voltage_sum += esc.esc_voltage;
+			current_sum += esc.esc_current;
+			max_temperature = PX4_ISFINITE(max_temperature) ? math::max(max_temperature, esc.esc_temperature) : esc.esc_temperature;
+		}
+
+		esc_telemetry.rotor_frequency[i] = abs(esc.esc_rpm) / 60.f;
+		esc_telemetry.timestamp_esc[i] = esc.timestamp;
+	}
+
+	const unsigned all_escs_armed_mask = (1u << esc_count) - 1;
+	esc_telemetry.all_armed = (esc_count > 0) && ((esc_status.esc_armed_flags & all_escs_armed_mask) == all_escs_armed_mask);
+
+	esc_telemetry.average_voltage = (esc_telemetry.online_count > 0) ? voltage_sum / esc_telemetry.online_count : NAN;
+	esc_telemetry.total_current = current_sum;
+	esc_telemetry.max_temperature = max_temperature;
+}
+
+void EscTelemetry::Run()
+{
+	perf_begin(_cycle_perf);
+
+	esc_status_s esc_status;
+
+	if (_esc_status_sub.update(&esc_status)) {
+		esc_telemetry_s esc_telemetry;
+		derive(esc_status, esc_telemetry);
+		esc_telemetry.timestamp = hrt_absolute_time();
+		_esc_telemetry_pub.publish(esc_telemetry);
+	}
+
+	perf_end(_cycle_perf);
+}
+
+void EscTelemetry::PrintStatus()
+{
+	perf_print_counter(_cycle_perf);
+}
+
+} // namespace sensors
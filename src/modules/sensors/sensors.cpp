@@ -75,6 +75,10 @@ Sensors::Sensors(bool hil_enabled) :
 	_vehicle_angular_velocity.Start();
 #endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
 
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+	_esc_telemetry.Start();
+#endif // CONFIG_SENSORS_ESC_TELEMETRY
+
 	param_find("SYS_FAC_CAL_MODE");
 
 	// Parameters controlling the on-board sensor thermal calibrator
@@ -104,6 +108,10 @@ Sensors::~Sensors()
 	_vehicle_angular_velocity.Stop();
 #endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
 
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+	_esc_telemetry.Stop();
+#endif // CONFIG_SENSORS_ESC_TELEMETRY
+
 #if defined(CONFIG_SENSORS_VEHICLE_AIR_DATA)
 
 	if (_vehicle_air_data) {
@@ -732,6 +740,11 @@ int Sensors::print_status()
 	_vehicle_angular_velocity.PrintStatus();
 #endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
 
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+	PX4_INFO_RAW("\n");
+	_esc_telemetry.PrintStatus();
+#endif // CONFIG_SENSORS_ESC_TELEMETRY
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 
 	if (_vehicle_gps_position) {
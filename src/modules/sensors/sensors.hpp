@@ -74,6 +74,10 @@
 # include "vehicle_angular_velocity/VehicleAngularVelocity.hpp"
 #endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
 
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+# include "esc_telemetry/EscTelemetry.hpp"
+#endif // CONFIG_SENSORS_ESC_TELEMETRY
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 # include "vehicle_gps_position/VehicleGPSPosition.hpp"
 #endif // CONFIG_SENSORS_VEHICLE_GPS_POSITION
@@ -236,6 +240,10 @@ private:
 	VehicleAngularVelocity	_vehicle_angular_velocity;
 #endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
 
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+	EscTelemetry _esc_telemetry;
+#endif // CONFIG_SENSORS_ESC_TELEMETRY
+
 #if defined(CONFIG_SENSORS_VEHICLE_MAGNETOMETER)
 	VehicleMagnetometer *_vehicle_magnetometer {nullptr};
 	uint8_t _n_mag{0};
@@ -214,15 +214,38 @@ void VehicleAngularVelocity::SensorBiasUpdate(bool force)
 		}
 	}
 
+	bool bias_updated = false;
+
 	if (_estimator_sensor_bias_sub.updated() || force) {
 		estimator_sensor_bias_s bias;
 
 		if (_estimator_sensor_bias_sub.copy(&bias) && (bias.gyro_device_id == _selected_sensor_device_id)) {
-			_bias = Vector3f{bias.gyro_bias};
+			_estimator_bias = Vector3f{bias.gyro_bias};
 
 		} else {
-			_bias.zero();
+			_estimator_bias.zero();
 		}
+
+		bias_updated = true;
+	}
+
+	if (_vehicle_imu_status_sub.updated() || force) {
+		vehicle_imu_status_s imu_status;
+
+		if (_vehicle_imu_status_sub.copy(&imu_status) && (imu_status.gyro_device_id == _selected_sensor_device_id)) {
+			_online_bias = Vector3f{imu_status.gyro_online_bias};
+
+		} else {
+			// look for the IMU of the selected gyro in the next instance
+			_online_bias.zero();
+			_vehicle_imu_status_sub.ChangeInstance((_vehicle_imu_status_sub.get_instance() + 1) % MAX_SENSOR_COUNT);
+		}
+
+		bias_updated = true;
+	}
+
+	if (bias_updated) {
+		_bias = _estimator_bias + _online_bias;
 	}
 }
 
@@ -571,6 +594,26 @@ void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_no
 #if !defined(CONSTRAINED_FLASH)
 	const bool enabled = _dynamic_notch_filter_esc_rpm && (_param_imu_gyro_dnf_en.get() & DynamicNotch::EscRpm);
 
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+	// rotor frequencies and connection state derived once by EscTelemetry
+	if (enabled && (_esc_telemetry_sub.updated() || force)) {
+
+		bool axis_init[3] {false, false, false};
+
+		esc_telemetry_s esc_telemetry;
+
+		if (_esc_telemetry_sub.copy(&esc_telemetry)
+		    && (time_now_us < esc_telemetry.timestamp_sample + DYNAMIC_NOTCH_FITLER_TIMEOUT)) {
+
+			const float bandwidth_hz = _param_imu_gyro_dnf_bw.get();
+			const float freq_min = math::max(_param_imu_gyro_dnf_min.get(), bandwidth_hz);
+
+			for (size_t esc = 0; esc < math::min(esc_telemetry.esc_count, (uint8_t)MAX_NUM_ESCS); esc++) {
+				const bool esc_connected = esc_telemetry.connected_flags & (1 << esc);
+				const hrt_abstime esc_timestamp = esc_telemetry.timestamp_esc[esc];
+				const float esc_hz = esc_telemetry.rotor_frequency[esc];
+#else
+
 	if (enabled && (_esc_status_sub.updated() || force)) {
 
 		bool axis_init[3] {false, false, false};
@@ -586,11 +629,12 @@ void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_no
 				const esc_report_s &esc_report = esc_status.esc[esc];
 
 				const bool esc_connected = (esc_status.esc_online_flags & (1 << esc)) || (esc_report.esc_rpm != 0);
+				const hrt_abstime esc_timestamp = esc_report.timestamp;
+				const float esc_hz = abs(esc_report.esc_rpm) / 60.f;
+#endif // CONFIG_SENSORS_ESC_TELEMETRY
 
 				// only update if ESC RPM range seems valid
-				if (esc_connected && (time_now_us < esc_report.timestamp + DYNAMIC_NOTCH_FITLER_TIMEOUT)) {
-
-					const float esc_hz = abs(esc_report.esc_rpm) / 60.f;
+				if (esc_connected && (time_now_us < esc_timestamp + DYNAMIC_NOTCH_FITLER_TIMEOUT)) {
 
 					const bool force_update = force || !_esc_available[esc]; // force parameter update or notch was previously disabled
 
@@ -624,7 +668,7 @@ void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_no
 					}
 
 					_esc_available.set(esc, true);
-					_last_esc_rpm_notch_update[esc] = esc_report.timestamp;
+					_last_esc_rpm_notch_update[esc] = esc_timestamp;
 				}
 			}
 		}
@@ -722,7 +766,24 @@ void VehicleAngularVelocity::UpdateDynamicNotchFFT(const hrt_abstime &time_now_u
 #endif // !CONSTRAINED_FLASH
 }
 
-float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int N)
+static void ApplyNotchFilters(math::NotchFilter<float> *const (&filters)[3], float *const (&data)[3], int N)
+{
+	const bool active[3] {filters[0]->getNotchFreq() > 0.f, filters[1]->getNotchFreq() > 0.f, filters[2]->getNotchFreq() > 0.f};
+
+	if (active[0] && active[1] && active[2]) {
+		// filter all axes in one interleaved pass
+		math::NotchFilter<float>::applyArrays(filters, data, N);
+
+	} else {
+		for (int axis = 0; axis < 3; axis++) {
+			if (active[axis]) {
+				filters[axis]->applyArray(data[axis], N);
+			}
+		}
+	}
+}
+
+Vector3f VehicleAngularVelocity::FilterAngularVelocity(float *const (&data)[3], int N)
 {
 #if !defined(CONSTRAINED_FLASH)
 
@@ -731,9 +792,8 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 		for (int esc = 0; esc < MAX_NUM_ESCS; esc++) {
 			if (_esc_available[esc]) {
 				for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
-					if (_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].getNotchFreq() > 0.f) {
-						_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].applyArray(data, N);
-					}
+					NotchFilterHarmonic &nf = _dynamic_notch_filter_esc_rpm[harmonic];
+					ApplyNotchFilters({&nf[0][esc], &nf[1][esc], &nf[2][esc]}, data, N);
 				}
 			}
 		}
@@ -742,29 +802,25 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 	// Apply dynamic notch filter from FFT
 	if (_dynamic_notch_fft_available) {
 		for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
-			if (_dynamic_notch_filter_fft[axis][peak].getNotchFreq() > 0.f) {
-				_dynamic_notch_filter_fft[axis][peak].applyArray(data, N);
-			}
+			ApplyNotchFilters({&_dynamic_notch_filter_fft[0][peak], &_dynamic_notch_filter_fft[1][peak], &_dynamic_notch_filter_fft[2][peak]},
+					  data, N);
 		}
 	}
 
 #endif // !CONSTRAINED_FLASH
 
 	// Apply general notch filter 0 (IMU_GYRO_NF0_FRQ)
-	if (_notch_filter0_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter0_velocity[axis].applyArray(data, N);
-	}
+	ApplyNotchFilters({&_notch_filter0_velocity[0], &_notch_filter0_velocity[1], &_notch_filter0_velocity[2]}, data, N);
 
 	// Apply general notch filter 1 (IMU_GYRO_NF1_FRQ)
-	if (_notch_filter1_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter1_velocity[axis].applyArray(data, N);
-	}
+	ApplyNotchFilters({&_notch_filter1_velocity[0], &_notch_filter1_velocity[1], &_notch_filter1_velocity[2]}, data, N);
 
 	// Apply general low-pass filter (IMU_GYRO_CUTOFF)
-	_lp_filter_velocity[axis].applyArray(data, N);
+	math::LowPassFilter2p<float>::applyArrays({&_lp_filter_velocity[0], &_lp_filter_velocity[1], &_lp_filter_velocity[2]},
+			data, N);
 
 	// return last filtered sample
-	return data[N - 1];
+	return Vector3f{data[0][N - 1], data[1][N - 1], data[2][N - 1]};
 }
 
 float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N)
@@ -827,25 +883,21 @@ void VehicleAngularVelocity::Run()
 		while (_sensor_gyro_fifo_sub.update(&sensor_fifo_data)) {
 			const float inverse_dt_s = 1e6f / sensor_fifo_data.dt;
 			const int N = sensor_fifo_data.samples;
-			static constexpr int FIFO_SIZE_MAX = sizeof(sensor_fifo_data.x) / sizeof(sensor_fifo_data.x[0]);
+			static constexpr int FIFO_SIZE_MAX = calibration::Gyroscope::FIFO_SIZE_MAX;
 
 			if ((sensor_fifo_data.dt > 0) && (N > 0) && (N <= FIFO_SIZE_MAX)) {
 				Vector3f angular_velocity_uncalibrated;
 				Vector3f angular_acceleration_uncalibrated;
 
-				int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
-
-				for (int axis = 0; axis < 3; axis++) {
-					// copy raw int16 sensor samples to float array for filtering
-					float data[FIFO_SIZE_MAX];
+				// scale raw int16 sensor samples to float arrays for filtering (calibration is applied to the filtered output)
+				float data[3][FIFO_SIZE_MAX];
+				calibration::Gyroscope::ScaleFifo(sensor_fifo_data, data);
 
-					for (int n = 0; n < N; n++) {
-						data[n] = sensor_fifo_data.scale * raw_data_array[axis][n];
-					}
+				// save last filtered sample
+				angular_velocity_uncalibrated = FilterAngularVelocity({data[0], data[1], data[2]}, N);
 
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data, N);
+				for (int axis = 0; axis < 3; axis++) {
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data[axis], N);
 				}
 
 				// Publish
@@ -879,15 +931,14 @@ void VehicleAngularVelocity::Run()
 				Vector3f angular_velocity_uncalibrated;
 				Vector3f angular_acceleration_uncalibrated;
 
-				float raw_data_array[] {sensor_data.x, sensor_data.y, sensor_data.z};
+				// copy sensor sample to float arrays for filtering
+				float data[3][1] {{sensor_data.x}, {sensor_data.y}, {sensor_data.z}};
 
-				for (int axis = 0; axis < 3; axis++) {
-					// copy sensor sample to float array for filtering
-					float data[1] {raw_data_array[axis]};
+				// save last filtered sample
+				angular_velocity_uncalibrated = FilterAngularVelocity({data[0], data[1], data[2]});
 
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data);
+				for (int axis = 0; axis < 3; axis++) {
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data[axis]);
 				}
 
 				// Publish
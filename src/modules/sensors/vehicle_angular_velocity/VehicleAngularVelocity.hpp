@@ -48,6 +48,7 @@
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionCallback.hpp>
 #include <uORB/topics/esc_status.h>
+#include <uORB/topics/esc_telemetry.h>
 #include <uORB/topics/estimator_selector_status.h>
 #include <uORB/topics/estimator_sensor_bias.h>
 #include <uORB/topics/parameter_update.h>
@@ -56,6 +57,7 @@
 #include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_imu_status.h>
 
 using namespace time_literals;
 
@@ -78,7 +80,7 @@ private:
 	bool CalibrateAndPublish(const hrt_abstime &timestamp_sample, const matrix::Vector3f &angular_velocity_uncalibrated,
 				 const matrix::Vector3f &angular_acceleration_uncalibrated);
 
-	inline float FilterAngularVelocity(int axis, float data[], int N = 1);
+	inline matrix::Vector3f FilterAngularVelocity(float *const (&data)[3], int N = 1);
 	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N = 1);
 
 	void DisableDynamicNotchEscRpm();
@@ -102,8 +104,13 @@ private:
 
 	uORB::Subscription _estimator_selector_status_sub{ORB_ID(estimator_selector_status)};
 	uORB::Subscription _estimator_sensor_bias_sub{ORB_ID(estimator_sensor_bias)};
+	uORB::Subscription _vehicle_imu_status_sub{ORB_ID(vehicle_imu_status)};
 #if !defined(CONSTRAINED_FLASH)
+#if defined(CONFIG_SENSORS_ESC_TELEMETRY)
+	uORB::Subscription _esc_telemetry_sub {ORB_ID(esc_telemetry)};
+#else
 	uORB::Subscription _esc_status_sub {ORB_ID(esc_status)};
+#endif // CONFIG_SENSORS_ESC_TELEMETRY
 	uORB::Subscription _sensor_gyro_fft_sub {ORB_ID(sensor_gyro_fft)};
 #endif // !CONSTRAINED_FLASH
 
@@ -116,6 +123,8 @@ private:
 	calibration::Gyroscope _calibration{};
 
 	matrix::Vector3f _bias{};
+	matrix::Vector3f _estimator_bias{};
+	matrix::Vector3f _online_bias{}; ///< in-flight correction applied by VehicleIMU, the estimator bias is relative to it
 
 	matrix::Vector3f _angular_velocity{};
 	matrix::Vector3f _angular_acceleration{};
@@ -94,6 +94,7 @@ void VehicleGPSPosition::ParametersUpdate(bool force)
 		_gps_blending.setBlendingUseSpeedAccuracy(_param_sens_gps_mask.get() & BLEND_MASK_USE_SPD_ACC);
 		_gps_blending.setBlendingUseHPosAccuracy(_param_sens_gps_mask.get() & BLEND_MASK_USE_HPOS_ACC);
 		_gps_blending.setBlendingUseVPosAccuracy(_param_sens_gps_mask.get() & BLEND_MASK_USE_VPOS_ACC);
+		_gps_blending.setBlendingTimeAlignment(_param_sens_gps_mask.get() & BLEND_MASK_TIME_ALIGN);
 		_gps_blending.setBlendingTimeConstant(_param_sens_gps_tau.get());
 		_gps_blending.setPrimaryInstance(_param_sens_gps_prime.get());
 	}
@@ -336,6 +336,11 @@ bool GpsBlending::blend_gps_data(uint64_t hrt_now_us)
 			blend_weights[i] = (hpos_blend_weights[i] + vpos_blend_weights[i] + spd_blend_weights[i]) / sum_of_all_weights;
 		}
 
+		if (_blend_time_align) {
+			const sensor_gps_s &gps_ref = _gps_state[_gps_time_ref_index];
+			align_gps_to_epoch(gps_ref.timestamp_sample > 0 ? gps_ref.timestamp_sample : gps_ref.timestamp);
+		}
+
 		// With updated weights we can calculate a blended GPS solution and
 		// offsets for each physical receiver
 		sensor_gps_s gps_blended_state = gps_blend_states(blend_weights);
@@ -519,6 +524,36 @@ sensor_gps_s GpsBlending::gps_blend_states(float blend_weights[GPS_MAX_RECEIVERS
 	return gps_blended_state;
 }
 
+void GpsBlending::align_gps_to_epoch(uint64_t epoch_us)
+{
+	for (uint8_t i = 0; i < GPS_MAX_RECEIVERS_BLEND; i++) {
+		sensor_gps_s &gps = _gps_state[i];
+		const uint64_t sample_us = (gps.timestamp_sample > 0) ? gps.timestamp_sample : gps.timestamp;
+
+		if ((gps.fix_type < 2) || !gps.vel_ned_valid || (sample_us == 0)) {
+			continue;
+		}
+
+		const float dt = 1e-6f * (float)((int64_t)epoch_us - (int64_t)sample_us);
+
+		if ((fabsf(dt) < FLT_EPSILON) || (fabsf(dt) > GPS_ALIGN_MAX_DT_S)) {
+			continue;
+		}
+
+		// constant velocity propagation over at most one receiver update interval
+		double lat_deg_res = 0;
+		double lon_deg_res = 0;
+		add_vector_to_global_position(gps.latitude_deg, gps.longitude_deg,
+					      gps.vel_n_m_s * dt, gps.vel_e_m_s * dt,
+					      &lat_deg_res, &lon_deg_res);
+		gps.latitude_deg = lat_deg_res;
+		gps.longitude_deg = lon_deg_res;
+		gps.altitude_msl_m -= (double)(gps.vel_d_m_s * dt);
+		gps.altitude_ellipsoid_m -= (double)(gps.vel_d_m_s * dt);
+		gps.timestamp_sample = epoch_us;
+	}
+}
+
 void GpsBlending::update_gps_offsets(const sensor_gps_s &gps_blended_state)
 {
 	// Calculate filter coefficients to be applied to the offsets for each GPS position and height offset
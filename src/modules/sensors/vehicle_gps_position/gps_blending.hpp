@@ -58,6 +58,9 @@ public:
 	static constexpr hrt_abstime GPS_TIMEOUT_US = 2_s;
 	static constexpr float GPS_TIMEOUT_S = (GPS_TIMEOUT_US / 1e6f);
 
+	// Maximum sample time difference that is compensated when aligning the receivers to a common epoch
+	static constexpr float GPS_ALIGN_MAX_DT_S = 0.5f;
+
 
 	GpsBlending() = default;
 	~GpsBlending() = default;
@@ -76,6 +79,7 @@ public:
 	void setBlendingUseHPosAccuracy(bool enabled) { _blend_use_hpos_acc = enabled; }
 	void setBlendingUseVPosAccuracy(bool enabled) { _blend_use_vpos_acc = enabled; }
 	void setBlendingTimeConstant(float tau) { _blending_time_constant = tau; }
+	void setBlendingTimeAlignment(bool enabled) { _blend_time_align = enabled; }
 	void setPrimaryInstance(int primary) { _primary_instance = primary; }
 
 	void update(uint64_t hrt_now_us);
@@ -108,6 +112,12 @@ private:
 	 */
 	sensor_gps_s gps_blend_states(float blend_weights[GPS_MAX_RECEIVERS_BLEND]) const;
 
+	/*
+	 * Shift the position of each receiver to a common sample time (epoch) using its own velocity,
+	 * so that receivers with a sample time difference don't produce a blended position jump when moving.
+	 */
+	void align_gps_to_epoch(uint64_t epoch_us);
+
 	/*
 	 * The location in gps_blended_state will move around as the relative accuracy changes.
 	 * To mitigate this effect a low-pass filtered offset from each GPS location to the blended location is
@@ -142,6 +152,7 @@ private:
 	bool _blend_use_spd_acc{false};
 	bool _blend_use_hpos_acc{false};
 	bool _blend_use_vpos_acc{false};
+	bool _blend_time_align{false};
 
 	float _blending_time_constant{0.f};
 };
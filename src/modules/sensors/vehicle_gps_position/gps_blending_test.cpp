@@ -218,6 +218,50 @@ TEST_F(GpsBlendingTest, dualReceiverBlendingHPos)
 	EXPECT_EQ(gps_blending.getOutputGpsData().altitude_msl_m, gps_data0.altitude_msl_m);
 }
 
+TEST_F(GpsBlendingTest, dualReceiverTimeAlignment)
+{
+	// GIVEN: a vehicle flying north at 10 m/s and two receivers with identical accuracy,
+	// where the sample of gps1 is 40ms older than the one of gps0
+	const float velocity_north = 10.f;
+	const float sample_delay_s = 0.04f;
+
+	sensor_gps_s gps_data0 = getDefaultGpsData();
+	gps_data0.vel_n_m_s = velocity_north;
+	gps_data0.vel_e_m_s = 0.f;
+	gps_data0.vel_d_m_s = 0.f;
+	gps_data0.timestamp_sample = gps_data0.timestamp - 50e3;
+
+	sensor_gps_s gps_data1 = gps_data0;
+	gps_data1.timestamp_sample = gps_data0.timestamp_sample - static_cast<uint64_t>(sample_delay_s * 1e6f);
+	add_vector_to_global_position(gps_data0.latitude_deg, gps_data0.longitude_deg, -velocity_north * sample_delay_s, 0.f,
+				      &gps_data1.latitude_deg, &gps_data1.longitude_deg);
+
+	// WHEN: blending without time alignment
+	GpsBlending gps_blending;
+	gps_blending.setBlendingUseHPosAccuracy(true);
+	gps_blending.setGpsData(gps_data0, 0);
+	gps_blending.setGpsData(gps_data1, 1);
+	gps_blending.update(_time_now_us);
+
+	// THEN: the blended position lags behind the newest sample
+	EXPECT_EQ(gps_blending.getSelectedGps(), 2);
+	EXPECT_LT(gps_blending.getOutputGpsData().latitude_deg, gps_data0.latitude_deg - 1e-6);
+
+	// WHEN: blending with time alignment
+	GpsBlending gps_blending_aligned;
+	gps_blending_aligned.setBlendingUseHPosAccuracy(true);
+	gps_blending_aligned.setBlendingTimeAlignment(true);
+	gps_blending_aligned.setGpsData(gps_data0, 0);
+	gps_blending_aligned.setGpsData(gps_data1, 1);
+	gps_blending_aligned.update(_time_now_us);
+
+	// THEN: both receivers are shifted to the sample time of the reference receiver and agree
+	EXPECT_EQ(gps_blending_aligned.getSelectedGps(), 2);
+	EXPECT_NEAR(gps_blending_aligned.getOutputGpsData().latitude_deg, gps_data0.latitude_deg, 1e-8);
+	EXPECT_NEAR(gps_blending_aligned.getOutputGpsData().longitude_deg, gps_data0.longitude_deg, 1e-8);
+	EXPECT_EQ(gps_blending_aligned.getOutputGpsData().timestamp_sample, gps_data0.timestamp_sample);
+}
+
 TEST_F(GpsBlendingTest, dualReceiverFailover)
 {
 	GpsBlending gps_blending;
@@ -38,13 +38,15 @@
  * 0 : Set to true to use speed accuracy
  * 1 : Set to true to use horizontal position accuracy
  * 2 : Set to true to use vertical position accuracy
+ * 3 : Set to true to shift the receiver positions to a common sample time before blending, using the reported velocity
  *
  * @group Sensors
  * @min 0
- * @max 7
+ * @max 15
  * @bit 0 use speed accuracy
  * @bit 1 use hpos accuracy
  * @bit 2 use vpos accuracy
+ * @bit 3 time align receivers
  */
 PARAM_DEFINE_INT32(SENS_GPS_MASK, 7);
 
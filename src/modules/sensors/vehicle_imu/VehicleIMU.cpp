@@ -265,6 +265,7 @@ void VehicleIMU::Run()
 		} else if (!_armed) {
 			SensorCalibrationSaveAccel();
 			SensorCalibrationSaveGyro();
+			_gyro_online_bias_timestamp_last = 0;
 		}
 	}
 }
@@ -609,6 +610,8 @@ bool VehicleIMU::Publish()
 					const Matrix3f cov = R * _raw_gyro_mean.covariance() * R.transpose();
 					cov.diag().copyTo(_status.var_gyro);
 
+					_gyro_calibration.online_bias().copyTo(_status.gyro_online_bias);
+
 
 					// Gyro delta angle coning metric = length of coning corrections averaged since last status publication
 					_status.delta_angle_coning_metric = _coning_norm_accum / _coning_norm_accum_total_time_s;
@@ -773,6 +776,8 @@ void VehicleIMU::PrintStatus()
 
 void VehicleIMU::SensorCalibrationUpdate()
 {
+	bool gyro_online_bias_updated = false;
+
 	for (int i = 0; i < _estimator_sensor_bias_subs.size(); i++) {
 		estimator_sensor_bias_s estimator_sensor_bias;
 
@@ -803,6 +808,28 @@ void VehicleIMU::SensorCalibrationUpdate()
 				_gyro_learned_calibration[i].bias_variance = Vector3f{estimator_sensor_bias.gyro_bias_variance};
 				_gyro_learned_calibration[i].valid = true;
 				_gyro_cal_available = true;
+
+				// in-flight correction: the estimator bias is relative to the already corrected data,
+				// integrate it into the online bias (using the first estimator of this IMU only)
+				if (_param_sens_imu_ocal.get() && _armed && !gyro_online_bias_updated) {
+					const hrt_abstime now = hrt_absolute_time();
+
+					if (_gyro_online_bias_timestamp_last != 0) {
+						const float dt = math::constrain((now - _gyro_online_bias_timestamp_last) * 1e-6f, 0.f, 2.f);
+						Vector3f online_bias = _gyro_calibration.online_bias() + bias * (dt / GYRO_ONLINE_BIAS_TIME_CONSTANT_S);
+
+						const float limit = estimator_sensor_bias.gyro_bias_limit;
+
+						if ((limit > 0.f) && online_bias.longerThan(limit)) {
+							online_bias = online_bias.normalized() * limit;
+						}
+
+						_gyro_calibration.set_online_bias(online_bias);
+					}
+
+					_gyro_online_bias_timestamp_last = now;
+					gyro_online_bias_updated = true;
+				}
 			}
 		}
 	}
@@ -893,6 +920,9 @@ void VehicleIMU::SensorCalibrationSaveGyro()
 
 		if (initialised && ((cal_orig - offset_estimate).longerThan(0.01f) || !_gyro_calibration.calibrated())) {
 			if (_gyro_calibration.set_offset(offset_estimate)) {
+				// the learned offset includes the in-flight correction
+				_gyro_calibration.set_online_bias(Vector3f{});
+
 				PX4_INFO("%s %d (%" PRIu32 ") offset committed: [%.3f %.3f %.3f]->[%.3f %.3f %.3f])",
 					 _gyro_calibration.SensorString(), _instance, _gyro_calibration.device_id(),
 					 (double)cal_orig(0), (double)cal_orig(1), (double)cal_orig(2),
@@ -193,6 +193,12 @@ private:
 
 	static constexpr hrt_abstime INFLIGHT_CALIBRATION_QUIET_PERIOD_US{30_s};
 
+	// time constant of the in-flight gyro bias correction (SENS_IMU_OCAL), slower than the estimator bias
+	// convergence so that the estimator can follow the correction applied to its input
+	static constexpr float GYRO_ONLINE_BIAS_TIME_CONSTANT_S{60.f};
+
+	hrt_abstime _gyro_online_bias_timestamp_last{0};
+
 	hrt_abstime _in_flight_calibration_check_timestamp_last{0};
 
 	perf_counter_t _accel_generation_gap_perf{perf_alloc(PC_COUNT, MODULE_NAME": accel data gap")};
@@ -201,6 +207,7 @@ private:
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::IMU_INTEG_RATE>) _param_imu_integ_rate,
 		(ParamBool<px4::params::SENS_IMU_AUTOCAL>) _param_sens_imu_autocal,
+		(ParamBool<px4::params::SENS_IMU_OCAL>) _param_sens_imu_ocal,
 		(ParamBool<px4::params::SENS_IMU_CLPNOTI>) _param_sens_imu_notify_clipping
 	)
 };
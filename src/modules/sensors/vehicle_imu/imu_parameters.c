@@ -61,6 +61,22 @@ PARAM_DEFINE_INT32(IMU_INTEG_RATE, 200);
  */
 PARAM_DEFINE_INT32(SENS_IMU_AUTOCAL, 1);
 
+/**
+ * IMU in-flight gyro bias correction
+ *
+ * While armed, continuously correct the gyro data of every IMU with the stable
+ * gyro bias estimated by the EKF for it, instead of only saving it after landing
+ * (SENS_IMU_AUTOCAL). The correction is applied to vehicle_imu and
+ * vehicle_angular_velocity and converges with a time constant of about a minute.
+ * Requires SENS_IMU_AUTOCAL.
+ *
+ * @boolean
+ *
+ * @category system
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(SENS_IMU_OCAL, 0);
+
 /**
  * IMU notify clipping
  *
@@ -42,6 +42,31 @@
 
 #include <iostream>
 #include <string>
+#include <time.h>
+
+namespace
+{
+
+// the hrt time follows the simulation clock in lockstep, the callbacks are measured in wall time
+uint64_t wall_time_us()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * ((uint64_t)1000000) + ts.tv_nsec / 1000;
+}
+
+class CallbackTimer
+{
+public:
+	explicit CallbackTimer(perf_counter_t perf) : _perf(perf), _start_us(wall_time_us()) {}
+	~CallbackTimer() { perf_set_elapsed(_perf, wall_time_us() - _start_us); }
+
+private:
+	perf_counter_t _perf;
+	const uint64_t _start_us;
+};
+
+} // namespace
 
 GZBridge::GZBridge(const char *world, const char *name, const char *model,
 		   const char *pose_str) :
@@ -64,6 +89,12 @@ GZBridge::~GZBridge()
 	for (auto &sub_topic : _node.SubscribedTopics()) {
 		_node.Unsubscribe(sub_topic);
 	}
+
+	perf_free(_clock_callback_perf);
+	perf_free(_baro_callback_perf);
+	perf_free(_imu_callback_perf);
+	perf_free(_pose_callback_perf);
+	perf_free(_odometry_callback_perf);
 }
 
 int GZBridge::init()
@@ -376,6 +407,8 @@ bool GZBridge::updateClock(const uint64_t tv_sec, const uint64_t tv_nsec)
 
 void GZBridge::clockCallback(const gz::msgs::Clock &clock)
 {
+	CallbackTimer timer{_clock_callback_perf};
+
 	pthread_mutex_lock(&_node_mutex);
 
 	const uint64_t time_us = (clock.sim().sec() * 1000000) + (clock.sim().nsec() / 1000);
@@ -393,6 +426,8 @@ void GZBridge::barometerCallback(const gz::msgs::FluidPressure &air_pressure)
 		return;
 	}
 
+	CallbackTimer timer{_baro_callback_perf};
+
 	pthread_mutex_lock(&_node_mutex);
 
 	const uint64_t time_us = (air_pressure.header().stamp().sec() * 1000000)
@@ -444,6 +479,8 @@ void GZBridge::imuCallback(const gz::msgs::IMU &imu)
 		return;
 	}
 
+	CallbackTimer timer{_imu_callback_perf};
+
 	pthread_mutex_lock(&_node_mutex);
 
 	const uint64_t time_us = (imu.header().stamp().sec() * 1000000) + (imu.header().stamp().nsec() / 1000);
@@ -509,6 +546,8 @@ void GZBridge::poseInfoCallback(const gz::msgs::Pose_V &pose)
 		return;
 	}
 
+	CallbackTimer timer{_pose_callback_perf};
+
 	pthread_mutex_lock(&_node_mutex);
 
 	for (int p = 0; p < pose.pose_size(); p++) {
@@ -634,6 +673,8 @@ void GZBridge::odometryCallback(const gz::msgs::OdometryWithCovariance &odometry
 		return;
 	}
 
+	CallbackTimer timer{_odometry_callback_perf};
+
 	pthread_mutex_lock(&_node_mutex);
 
 	const uint64_t time_us = (odometry.header().stamp().sec() * 1000000) + (odometry.header().stamp().nsec() / 1000);
@@ -764,6 +805,12 @@ int GZBridge::print_status()
 	PX4_INFO_RAW("Wheel outputs:\n");
 	_mixing_interface_wheel.mixingOutput().printStatus();
 
+	perf_print_counter(_clock_callback_perf);
+	perf_print_counter(_baro_callback_perf);
+	perf_print_counter(_imu_callback_perf);
+	perf_print_counter(_pose_callback_perf);
+	perf_print_counter(_odometry_callback_perf);
+
 	return 0;
 }
 
@@ -44,6 +44,7 @@
 #include <px4_platform_common/posix.h>
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #include <lib/geo/geo.h>
+#include <lib/perf/perf_counter.h>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionInterval.hpp>
@@ -152,6 +153,13 @@ private:
 
 	float _temperature{288.15};  // 15 degrees
 
+	// wall time spent in the gz-transport callbacks, including waiting for the node mutex
+	perf_counter_t _clock_callback_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": clock callback")};
+	perf_counter_t _baro_callback_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": baro callback")};
+	perf_counter_t _imu_callback_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": imu callback")};
+	perf_counter_t _pose_callback_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": pose callback")};
+	perf_counter_t _odometry_callback_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": odometry callback")};
+
 	gz::transport::Node _node;
 
 	DEFINE_PARAMETERS(
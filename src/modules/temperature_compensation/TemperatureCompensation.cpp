@@ -297,6 +297,7 @@ int TemperatureCompensation::parameters_update()
 	 */
 	_gyro_data.reset_temperature();
 	_accel_data.reset_temperature();
+	_mag_data.reset_temperature();
 	_baro_data.reset_temperature();
 
 	return ret;
@@ -434,10 +435,12 @@ int TemperatureCompensation::update_offsets_accel(int topic_instance, float temp
 	}
 
 	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
+	if (_accel_data.evaluation_needed(topic_instance, temperature)) {
+		calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
+	}
 
 	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) > 1.0f) {
+	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) > TEMPERATURE_PUBLICATION_DELTA) {
 		_accel_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -460,10 +463,12 @@ int TemperatureCompensation::update_offsets_gyro(int topic_instance, float tempe
 	}
 
 	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
+	if (_gyro_data.evaluation_needed(topic_instance, temperature)) {
+		calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
+	}
 
 	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > 1.0f) {
+	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > TEMPERATURE_PUBLICATION_DELTA) {
 		_gyro_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -486,10 +491,12 @@ int TemperatureCompensation::update_offsets_mag(int topic_instance, float temper
 	}
 
 	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
+	if (_mag_data.evaluation_needed(topic_instance, temperature)) {
+		calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
+	}
 
 	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _mag_data.last_temperature[topic_instance]) > 1.0f) {
+	if (fabsf(temperature - _mag_data.last_temperature[topic_instance]) > TEMPERATURE_PUBLICATION_DELTA) {
 		_mag_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -512,10 +519,12 @@ int TemperatureCompensation::update_offsets_baro(int topic_instance, float tempe
 	}
 
 	// Calculate and update the offsets
-	calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
+	if (_baro_data.evaluation_needed(topic_instance, temperature)) {
+		calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
+	}
 
 	// Check if temperature delta is large enough to warrant a new publication
-	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) > 1.0f) {
+	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) > TEMPERATURE_PUBLICATION_DELTA) {
 		_baro_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -86,7 +86,9 @@ public:
 	 * @param topic_instance uORB topic instance
 	 * @param sensor_data input sensor data, output sensor data with applied corrections
 	 * @param temperature measured current temperature
-	 * @param offsets returns offsets that were applied (length = 3, except for baro), depending on return value
+	 * @param offsets returns offsets that were applied (length = 3, except for baro), depending on return value.
+	 *                The offsets are only evaluated again once the temperature changed by more than
+	 *                TEMPERATURE_EVALUATION_DELTA, otherwise the previous values are kept.
 	 * @return -1: error: correction enabled, but no sensor mapping set (@see set_sendor_id_gyro)
 	 *         0: no changes (correction not enabled),
 	 *         1: corrections applied but no changes to offsets,
@@ -260,25 +262,48 @@ private:
 	Parameters _parameters;
 
 
+	// temperature change [deg C] after which the offset polynomials are evaluated again
+	static constexpr float TEMPERATURE_EVALUATION_DELTA = 0.1f;
+
+	// temperature change [deg C] after which new offsets are published
+	static constexpr float TEMPERATURE_PUBLICATION_DELTA = 1.0f;
+
 	struct PerSensorData {
 
 		PerSensorData()
 		{
 			for (int i = 0; i < SENSOR_COUNT_MAX; ++i) {
 				device_mapping[i] = 255;
-				last_temperature[i] = -100.0f;
 			}
+
+			reset_temperature();
 		}
 
 		void reset_temperature()
 		{
 			for (int i = 0; i < SENSOR_COUNT_MAX; ++i) {
 				last_temperature[i] = -100.0f;
+				evaluated_temperature[i] = -100.0f;
 			}
 		}
 
+		/**
+		 * The temperature moves slowly, only evaluate the offsets again if it changed noticeably
+		 * @return true if the offsets have to be calculated for this temperature
+		 */
+		bool evaluation_needed(int topic_instance, float temperature)
+		{
+			if (fabsf(temperature - evaluated_temperature[topic_instance]) > TEMPERATURE_EVALUATION_DELTA) {
+				evaluated_temperature[topic_instance] = temperature;
+				return true;
+			}
+
+			return false;
+		}
+
 		uint8_t device_mapping[SENSOR_COUNT_MAX] {}; /// map a topic instance to the parameters index
-		float last_temperature[SENSOR_COUNT_MAX] {};
+		float last_temperature[SENSOR_COUNT_MAX] {}; /// temperature of the last published offsets
+		float evaluated_temperature[SENSOR_COUNT_MAX] {}; /// temperature the current offsets were calculated for
 	};
 
 	PerSensorData _accel_data;
@@ -0,0 +1,220 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "Terrain.hpp"
+
+#include <lib/geo/geo.h>
+
+using namespace terrain;
+
+Terrain::Terrain() :
+	ModuleParams(nullptr),
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::lp_default)
+{
+	_terrain_request_pub.advertise();
+}
+
+Terrain::~Terrain()
+{
+	perf_free(_cycle_perf);
+}
+
+bool Terrain::init()
+{
+	// the database outlives the module, it's only allocated once
+	if (!_database.initialized()
+	    && !_database.init(CONFIG_TERRAIN_CACHE_GRIDS, _param_ter_spacing.get(), PX4_STORAGEDIR)) {
+		PX4_ERR("terrain database init failed");
+		return false;
+	}
+
+	if (_database.spacing() != _param_ter_spacing.get()) {
+		PX4_WARN("TER_SPACING change requires a reboot");
+	}
+
+	ScheduleOnInterval(INTERVAL_US);
+	return true;
+}
+
+void Terrain::prefetchAround(double lat, double lon)
+{
+	// the grids within half a grid of the vehicle
+	const double half_grid = 0.5 * GRID_SPACING_X * _database.spacing();
+	const double d_lat = math::degrees(half_grid / CONSTANTS_RADIUS_OF_EARTH);
+	const double d_lon = d_lat / math::max(cos(math::radians(lat)), 0.01);
+
+	_database.prefetch(lat, lon);
+	_database.prefetch(lat + d_lat, lon + d_lon);
+	_database.prefetch(lat + d_lat, lon - d_lon);
+	_database.prefetch(lat - d_lat, lon + d_lon);
+	_database.prefetch(lat - d_lat, lon - d_lon);
+}
+
+void Terrain::prefetchPath(double lat_start, double lon_start, double lat_end, double lon_end)
+{
+	// one point every half grid, limited so that a long leg doesn't flush the cache
+	const float distance = get_distance_to_next_waypoint(lat_start, lon_start, lat_end, lon_end);
+	const float step = 0.5f * GRID_SPACING_X * _database.spacing();
+	const int points = math::constrain((int)(distance / step) + 1, 1, PATH_PREFETCH_MAX);
+
+	for (int i = 1; i <= points; i++) {
+		const double t = (double)i / points;
+		_database.prefetch(lat_start + t * (lat_end - lat_start), lon_start + t * (lon_end - lon_start));
+	}
+}
+
+void Terrain::Run()
+{
+	if (should_exit()) {
+		ScheduleClear();
+		exit_and_cleanup();
+		return;
+	}
+
+	perf_begin(_cycle_perf);
+
+	vehicle_global_position_s vehicle_global_position;
+
+	if (_vehicle_global_position_sub.update(&vehicle_global_position)) {
+		_lat = vehicle_global_position.lat;
+		_lon = vehicle_global_position.lon;
+		prefetchAround(_lat, _lon);
+	}
+
+	position_setpoint_triplet_s triplet;
+
+	if (_position_setpoint_triplet_sub.update(&triplet) && PX4_ISFINITE(_lat) && PX4_ISFINITE(_lon)) {
+		if (triplet.current.valid) {
+			prefetchPath(_lat, _lon, triplet.current.lat, triplet.current.lon);
+
+			if (triplet.next.valid) {
+				prefetchPath(triplet.current.lat, triplet.current.lon, triplet.next.lat, triplet.next.lon);
+			}
+		}
+	}
+
+	terrain_data_s terrain_data;
+
+	while (_terrain_data_sub.update(&terrain_data)) {
+		_database.handleBlock(terrain_data.lat, terrain_data.lon, terrain_data.grid_spacing, terrain_data.gridbit,
+				      terrain_data.data);
+	}
+
+	_database.update();
+
+	terrain_request_s terrain_request{};
+
+	if (_database.nextRequest(hrt_absolute_time(), terrain_request.lat, terrain_request.lon, terrain_request.grid_spacing,
+				  terrain_request.mask)) {
+		terrain_request.timestamp = hrt_absolute_time();
+		_terrain_request_pub.publish(terrain_request);
+	}
+
+	perf_end(_cycle_perf);
+}
+
+int Terrain::task_spawn(int argc, char *argv[])
+{
+	Terrain *instance = new Terrain();
+
+	if (instance) {
+		_object.store(instance);
+		_task_id = task_id_is_work_queue;
+
+		if (instance->init()) {
+			return PX4_OK;
+		}
+
+	} else {
+		PX4_ERR("alloc failed");
+	}
+
+	delete instance;
+	_object.store(nullptr);
+	_task_id = -1;
+
+	return PX4_ERROR;
+}
+
+int Terrain::print_status()
+{
+	TerrainDatabase::Status status;
+	_database.getStatus(status);
+
+	PX4_INFO("grid spacing: %u m", _database.spacing());
+	PX4_INFO("grids: %u valid, %u loading, %u waiting for GCS, %u cached max",
+		 status.grids_valid, status.grids_loading, status.grids_waiting, status.num_grids);
+	PX4_INFO("lookups: %" PRIu32 " (%" PRIu32 " misses)", status.lookups, status.misses);
+	PX4_INFO("SD card: %" PRIu32 " grids loaded, %" PRIu32 " stored", status.grids_loaded, status.grids_stored);
+	PX4_INFO("GCS: %" PRIu32 " blocks received", status.blocks_received);
+	perf_print_counter(_cycle_perf);
+	return 0;
+}
+
+int Terrain::custom_command(int argc, char *argv[])
+{
+	return print_usage("unknown command");
+}
+
+int Terrain::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_WARN("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Onboard terrain height database.
+
+Terrain heights are kept in grids of 28x32 samples (TER_SPACING apart) stored on the SD card
+under `terrain/`. Missing grids are requested from the ground station (MAVLink TERRAIN_REQUEST,
+answered with TERRAIN_DATA) and stored once complete.
+
+The grids around the vehicle and along the current mission leg are prefetched, other modules
+look up heights with `terrain::TerrainDatabase::instance()` without blocking.
+
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("terrain", "system");
+	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+
+	return 0;
+}
+
+extern "C" __EXPORT int terrain_main(int argc, char *argv[])
+{
+	return Terrain::main(argc, argv);
+}
@@ -45,6 +45,7 @@ struct SendSubscription {
 	const char* dds_type_name;
 	uint32_t topic_size;
 	UcdrSerializeMethod ucdr_serialize_method;
+	uint32_t interval_ms;
 };
 
 // Subscribers for messages to send
@@ -56,6 +57,7 @@ struct SendTopicsSubs {
 			  "@(pub['dds_type'])",
 			  ucdr_topic_size_@(pub['simple_base_type'])(),
 			  &ucdr_serialize_@(pub['simple_base_type']),
+			  @(pub['interval_ms']),
 			},
 @[    end for]@
 	};
@@ -73,7 +75,7 @@ void SendTopicsSubs::init() {
 	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
 		fds[idx].fd = orb_subscribe(send_subscriptions[idx].orb_meta);
 		fds[idx].events = POLLIN;
-		orb_set_interval(fds[idx].fd, UXRCE_DEFAULT_POLL_RATE);
+		orb_set_interval(fds[idx].fd, send_subscriptions[idx].interval_ms);
 	}
 }
 
@@ -90,6 +92,8 @@ void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream
 
 	alignas(sizeof(uint64_t)) char topic_data[max_topic_size];
 
+	bool stream_pending = false;
+
 	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
 		if (fds[idx].revents & POLLIN) {
 			// Topic updated, copy data and send
@@ -104,10 +108,18 @@ void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream
 
 				ucdrBuffer ub;
 				uint32_t topic_size = send_subscriptions[idx].topic_size;
-				if (uxr_prepare_output_stream(session, best_effort_stream_id, send_subscriptions[idx].data_writer, &ub, topic_size) != UXR_INVALID_REQUEST_ID) {
-					send_subscriptions[idx].ucdr_serialize_method(&topic_data, ub, time_offset_us);
-					// TODO: fill up the MTU and then flush, which reduces the packet overhead
+				uint16_t request_id = uxr_prepare_output_stream(session, best_effort_stream_id, send_subscriptions[idx].data_writer, &ub, topic_size);
+
+				if (request_id == UXR_INVALID_REQUEST_ID && stream_pending) {
+					// the samples of this cycle fill up the MTU: send them and start a new message
 					uxr_flash_output_streams(session);
+					stream_pending = false;
+					request_id = uxr_prepare_output_stream(session, best_effort_stream_id, send_subscriptions[idx].data_writer, &ub, topic_size);
+				}
+
+				if (request_id != UXR_INVALID_REQUEST_ID) {
+					send_subscriptions[idx].ucdr_serialize_method(&topic_data, ub, time_offset_us);
+					stream_pending = true;
 					num_payload_sent += topic_size;
 
 				} else {
@@ -120,6 +132,11 @@ void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream
 
 		}
 	}
+
+	// all samples of a cycle are packed into as few messages as possible, which reduces the packet overhead
+	if (stream_pending) {
+		uxr_flash_output_streams(session);
+	}
 }
 
 // Publishers for received messages
@@ -103,6 +103,11 @@ pubs_not_empty = msg_map['publications'] is not None
 if pubs_not_empty:
     for p in msg_map['publications']:
         process_message_type(p)
+        # rate_limit: optional maximum rate in Hz, otherwise limited by UXRCE_DEFAULT_POLL_RATE
+        if 'rate_limit' in p:
+            p['interval_ms'] = max(1, int(round(1000.0 / float(p['rate_limit']))))
+        else:
+            p['interval_ms'] = 'UXRCE_DEFAULT_POLL_RATE'
 
 merged_em_globals['publications'] = msg_map['publications'] if pubs_not_empty else []
 
@@ -204,23 +204,24 @@ void Standard::update_transition_state()
 						     _param_vt_psher_slew.get() * _dt, _param_vt_f_trans_thr.get());
 		}
 
-		_airspeed_trans_blend_margin = getTransitionAirspeed() - getBlendAirspeed();
-
 		// do blending of mc and fw controls if a blending airspeed has been provided and the minimum transition time has passed
-		if (_airspeed_trans_blend_margin > 0.0f &&
+		if (_transition_profile.inv_blend_airspeed_range > 0.0f &&
 		    PX4_ISFINITE(_airspeed_validated->calibrated_airspeed_m_s) &&
 		    _airspeed_validated->calibrated_airspeed_m_s > 0.0f &&
 		    _airspeed_validated->calibrated_airspeed_m_s >= getBlendAirspeed() &&
 		    _time_since_trans_start > getMinimumFrontTransitionTime()) {
 
-			mc_weight = 1.0f - fabsf(_airspeed_validated->calibrated_airspeed_m_s - getBlendAirspeed()) /
-				    _airspeed_trans_blend_margin;
+			mc_weight = _transition_profile.mcWeightFromAirspeed(_airspeed_validated->calibrated_airspeed_m_s);
 			// time based blending when no airspeed sensor is set
 
 		} else if (!_param_fw_use_airspd.get() || !PX4_ISFINITE(_airspeed_validated->calibrated_airspeed_m_s)) {
-			mc_weight = 1.0f - _time_since_trans_start / getMinimumFrontTransitionTime();
-			mc_weight = math::constrain(2.0f * mc_weight, 0.0f, 1.0f);
+			if (_transition_profile.inv_min_front_transition_time > 0.f) {
+				mc_weight = 1.0f - _time_since_trans_start * _transition_profile.inv_min_front_transition_time;
+				mc_weight = math::constrain(2.0f * mc_weight, 0.0f, 1.0f);
 
+			} else {
+				mc_weight = 0.0f;
+			}
 		}
 
 		// ramp up FW_PSP_OFF
@@ -75,7 +75,6 @@ private:
 	vtol_mode _vtol_mode{vtol_mode::MC_MODE};			/**< vtol flight mode, defined by enum vtol_mode */
 
 	float _pusher_throttle{0.0f};
-	float _airspeed_trans_blend_margin{0.0f};
 
 	void parameters_update() override;
 
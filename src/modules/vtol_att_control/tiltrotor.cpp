@@ -245,8 +245,7 @@ void Tiltrotor::update_transition_state()
 
 		if (_param_fw_use_airspd.get()  && PX4_ISFINITE(_airspeed_validated->calibrated_airspeed_m_s) &&
 		    _airspeed_validated->calibrated_airspeed_m_s >= getBlendAirspeed()) {
-			const float weight = 1.0f - (_airspeed_validated->calibrated_airspeed_m_s - getBlendAirspeed()) /
-					     (getTransitionAirspeed()  - getBlendAirspeed());
+			const float weight = _transition_profile.mcWeightFromAirspeed(_airspeed_validated->calibrated_airspeed_m_s);
 			_mc_roll_weight = weight;
 			_mc_yaw_weight = weight;
 		}
@@ -254,8 +253,7 @@ void Tiltrotor::update_transition_state()
 		// without airspeed do timed weight changes
 		if ((!_param_fw_use_airspd.get() || !PX4_ISFINITE(_airspeed_validated->calibrated_airspeed_m_s)) &&
 		    _time_since_trans_start > getMinimumFrontTransitionTime()) {
-			_mc_roll_weight = 1.0f - (_time_since_trans_start - getMinimumFrontTransitionTime()) /
-					  (getOpenLoopFrontTransitionTime() - getMinimumFrontTransitionTime());
+			_mc_roll_weight = _transition_profile.mcWeightFromOpenLoopTime(_time_since_trans_start);
 			_mc_yaw_weight = _mc_roll_weight;
 		}
 
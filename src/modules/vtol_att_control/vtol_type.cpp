@@ -85,6 +85,7 @@ VtolType::VtolType(VtolAttitudeControl *att_controller) :
 
 bool VtolType::init()
 {
+	updateTransitionProfile();
 	return true;
 }
 
@@ -96,6 +97,8 @@ void VtolType::parameters_update()
 	_param_vt_arsp_trans.set(math::max(_param_vt_arsp_trans.get(), _param_vt_arsp_blend.get()));
 	// make sure that openloop transition time is above minimum time
 	_param_vt_f_tr_ol_tm.set(math::max(_param_vt_f_tr_ol_tm.get(), _param_vt_trans_min_tm.get()));
+
+	updateTransitionProfile();
 }
 
 void VtolType::update_mc_state()
@@ -236,6 +239,9 @@ void VtolType::resetTransitionStates()
 	_transition_start_timestamp = hrt_absolute_time();
 	_time_since_trans_start = 0.f;
 	_local_position_z_start_of_transition = _local_pos->z;
+
+	// keep the air density scaling constant for the whole transition
+	updateTransitionProfile();
 }
 
 bool VtolType::isQuadchuteEnabled()
@@ -591,22 +597,15 @@ float VtolType::getFrontTransitionTimeFactor() const
 	return 1.0f;
 }
 
-float VtolType::getMinimumFrontTransitionTime() const
+void VtolType::updateTransitionProfile()
 {
-	return getFrontTransitionTimeFactor() * _param_vt_trans_min_tm.get();
-}
+	TransitionProfile &profile = _transition_profile;
 
-float VtolType::getFrontTransitionTimeout() const
-{
-	return getFrontTransitionTimeFactor() * _param_vt_trans_timeout.get();
-}
+	const float time_factor = getFrontTransitionTimeFactor();
+	profile.min_front_transition_time = time_factor * _param_vt_trans_min_tm.get();
+	profile.front_transition_timeout = time_factor * _param_vt_trans_timeout.get();
+	profile.open_loop_front_transition_time = time_factor * _param_vt_f_tr_ol_tm.get();
 
-float VtolType::getOpenLoopFrontTransitionTime() const
-{
-	return getFrontTransitionTimeFactor() * _param_vt_f_tr_ol_tm.get();
-}
-float VtolType::getTransitionAirspeed() const
-{
 	// Since the stall airspeed increases with vehicle weight, we increase the transition airspeed
 	// by the same factor.
 
@@ -617,10 +616,15 @@ float VtolType::getTransitionAirspeed() const
 					       _param_weight_base.get(), kMinWeightRatio, kMaxWeightRatio);
 	}
 
-	return sqrtf(weight_ratio) * _param_vt_arsp_trans.get();
-}
+	profile.transition_airspeed = sqrtf(weight_ratio) * _param_vt_arsp_trans.get();
+	profile.blend_airspeed = _param_vt_arsp_blend.get();
 
-float VtolType::getBlendAirspeed() const
-{
-	return _param_vt_arsp_blend.get();
+	const float blend_airspeed_range = profile.transition_airspeed - profile.blend_airspeed;
+	profile.inv_blend_airspeed_range = (blend_airspeed_range > FLT_EPSILON) ? 1.f / blend_airspeed_range : 0.f;
+
+	profile.inv_min_front_transition_time = (profile.min_front_transition_time > FLT_EPSILON) ?
+						1.f / profile.min_front_transition_time : 0.f;
+
+	const float open_loop_blend_time = profile.open_loop_front_transition_time - profile.min_front_transition_time;
+	profile.inv_open_loop_blend_time = (open_loop_blend_time > FLT_EPSILON) ? 1.f / open_loop_blend_time : 0.f;
 }
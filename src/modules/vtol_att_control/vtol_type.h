@@ -225,29 +225,29 @@ public:
 	/**
 	 * @return Minimum front transition time scaled for air density (if available) [s]
 	*/
-	float getMinimumFrontTransitionTime() const;
+	float getMinimumFrontTransitionTime() const { return _transition_profile.min_front_transition_time; }
 
 	/**
 	 * @return Front transition timeout scaled for air density (if available) [s]
 	*/
-	float getFrontTransitionTimeout() const;
+	float getFrontTransitionTimeout() const { return _transition_profile.front_transition_timeout; }
 
 	/**
 	* @return Minimum open-loop front transition time scaled for air density (if available) [s]
 	*/
-	float getOpenLoopFrontTransitionTime() const;
+	float getOpenLoopFrontTransitionTime() const { return _transition_profile.open_loop_front_transition_time; }
 
 	/**
 	 *
 	 * @return The calibrated blending airspeed [m/s]
 	 */
-	float getBlendAirspeed() const;
+	float getBlendAirspeed() const { return _transition_profile.blend_airspeed; }
 
 	/**
 	 *
 	 * @return The calibrated transition airspeed [m/s]
 	 */
-	float getTransitionAirspeed() const;
+	float getTransitionAirspeed() const { return _transition_profile.transition_airspeed; }
 
 	virtual void parameters_update() = 0;
 
@@ -310,6 +310,47 @@ protected:
 	hrt_abstime _transition_start_timestamp{0};
 	float _time_since_trans_start{0};
 
+	/**
+	 * Transition times and airspeeds, evaluated once at the start of a transition (and on parameter changes)
+	 * so that the blending during the transition is only a few multiplications per cycle.
+	 */
+	struct TransitionProfile {
+		float min_front_transition_time{0.f};		///< [s]
+		float open_loop_front_transition_time{0.f};	///< [s]
+		float front_transition_timeout{0.f};		///< [s]
+		float transition_airspeed{0.f};			///< [m/s]
+		float blend_airspeed{0.f};			///< [m/s]
+
+		float inv_blend_airspeed_range{0.f};		///< 1 / (transition - blend airspeed), 0 if there is no blending range
+		float inv_min_front_transition_time{0.f};	///< 1 / minimum front transition time, 0 if not set
+		float inv_open_loop_blend_time{0.f};		///< 1 / (open-loop - minimum front transition time), 0 if not set
+
+		/**
+		 * @return MC weight, 1 at the blending airspeed down to 0 at the transition airspeed (not constrained)
+		 */
+		float mcWeightFromAirspeed(float airspeed) const
+		{
+			return 1.f - (airspeed - blend_airspeed) * inv_blend_airspeed_range;
+		}
+
+		/**
+		 * @return MC weight, 1 at the minimum front transition time down to 0 at the open-loop transition time (not constrained)
+		 */
+		float mcWeightFromOpenLoopTime(float time_since_trans_start) const
+		{
+			if (inv_open_loop_blend_time > 0.f) {
+				return 1.f - (time_since_trans_start - min_front_transition_time) * inv_open_loop_blend_time;
+			}
+
+			return (time_since_trans_start > min_front_transition_time) ? 0.f : 1.f;
+		}
+	} _transition_profile{};
+
+	/**
+	 * Evaluate the transition profile for the current parameters and air density.
+	 */
+	void updateTransitionProfile();
+
 	bool _tecs_running = false;
 	hrt_abstime _tecs_running_ts = 0;
 
@@ -43,6 +43,8 @@
 
 #include "zenoh_publisher.hpp"
 #include <uORB/Subscription.hpp>
+#include <drivers/drv_hrt.h>
+#include <lib/perf/perf_counter.h>
 #include <dds_serializer.h>
 
 #define CDR_SAFETY_MARGIN 12
@@ -58,7 +60,10 @@ public:
 		_uorb_sub = orb_subscribe(meta);
 	};
 
-	~uORB_Zenoh_Publisher() override = default;
+	~uORB_Zenoh_Publisher() override
+	{
+		perf_free(_latency_perf);
+	};
 
 	// Update the uORB Subscription and broadcast a Zenoh ROS2 message
 	virtual int8_t update() override
@@ -79,7 +84,17 @@ public:
 				     &dds_allocator,
 				     (const char *)&data,
 				     _cdr_ops)) {
-			return publish((const uint8_t *)buf, os.m_size);
+			int8_t ret = publish((const uint8_t *)buf, os.m_size);
+
+			// delivery latency: sample timestamp (first field of every uORB message) until handed to the transport
+			uint64_t timestamp;
+			memcpy(&timestamp, data, sizeof(timestamp));
+
+			if (timestamp != 0) {
+				perf_set_elapsed(_latency_perf, hrt_elapsed_time(&timestamp));
+			}
+
+			return ret;
 
 		} else {
 			return _Z_ERR_MESSAGE_SERIALIZATION_FAILED;
@@ -96,10 +111,13 @@ public:
 	{
 		printf("uORB %s -> ", _uorb_meta->o_name);
 		Zenoh_Publisher::print();
+		perf_print_counter(_latency_perf);
 	}
 
 private:
 	const orb_metadata *_uorb_meta;
 	int _uorb_sub;
 	const uint32_t *_cdr_ops;
+
+	perf_counter_t _latency_perf{perf_alloc(PC_ELAPSED, "zenoh: publish latency")};
 };
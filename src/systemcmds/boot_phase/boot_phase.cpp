@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file boot_phase.cpp
+ *
+ * Record the time taken by the phases of the startup script.
+ */
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module.h>
+#include <drivers/drv_hrt.h>
+
+#include <string.h>
+
+struct BootPhase {
+	char name[16];
+	hrt_abstime start;
+};
+
+static constexpr int MAX_PHASES = 16;
+static BootPhase g_phases[MAX_PHASES] {};
+static int g_num_phases = 0;
+
+static void print_usage()
+{
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Record the time taken by the phases of the startup script. Each call ends the previous phase and prints
+its duration. The time is measured since the system start (hrt).
+
+### Examples
+$ boot_phase sensors
+$ boot_phase status
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME_SIMPLE("boot_phase", "command");
+	PRINT_MODULE_USAGE_ARG("<name>", "Start a new phase", false);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "Print all phases");
+}
+
+static void print_status()
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	PX4_INFO_RAW("PHASE            START [ms]  DURATION [ms]\n");
+
+	for (int i = 0; i < g_num_phases; i++) {
+		const hrt_abstime end = (i + 1 < g_num_phases) ? g_phases[i + 1].start : now;
+		PX4_INFO_RAW("%-16s %10.1f %14.1f%s\n", g_phases[i].name, (double)(g_phases[i].start / 1000.f),
+			     (double)((end - g_phases[i].start) / 1000.f), (i + 1 < g_num_phases) ? "" : " (running)");
+	}
+}
+
+extern "C" __EXPORT int boot_phase_main(int argc, char *argv[])
+{
+	if (argc != 2) {
+		print_usage();
+		return 1;
+	}
+
+	if (strcmp(argv[1], "status") == 0) {
+		print_status();
+		return 0;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	if (g_num_phases > 0) {
+		const BootPhase &previous = g_phases[g_num_phases - 1];
+		PX4_INFO("%s: %.1f ms", previous.name, (double)((now - previous.start) / 1000.f));
+	}
+
+	if (g_num_phases == MAX_PHASES) {
+		PX4_ERR("too many phases");
+		return 1;
+	}
+
+	BootPhase &phase = g_phases[g_num_phases++];
+	strncpy(phase.name, argv[1], sizeof(phase.name) - 1);
+	phase.start = now;
+
+	return 0;
+}
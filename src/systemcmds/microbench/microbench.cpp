@@ -0,0 +1,181 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file microbench.cpp
+ */
+
+#include "microbench.hpp"
+
+#include <math.h>
+#include <stdio.h>
+
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/micro_hal.h>
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+namespace microbench
+{
+
+static FILE *report_file{nullptr};
+static const char *benchmark_name{""};
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+bool report_open(const char *path)
+{
+	report_close();
+
+	if (path == nullptr) {
+		return true;
+	}
+
+	report_file = fopen(path, "w");
+
+	if (report_file == nullptr) {
+		PX4_ERR("failed to open %s", path);
+		return false;
+	}
+
+	return true;
+}
+
+void report_close()
+{
+	if (report_file != nullptr) {
+		fclose(report_file);
+		report_file = nullptr;
+	}
+}
+
+void set_benchmark(const char *name)
+{
+	benchmark_name = (name != nullptr) ? name : "";
+}
+
+Measurement::Measurement(const char *name, unsigned ops_per_event) :
+	_name(name),
+	_ops_per_event((ops_per_event > 0) ? ops_per_event : 1)
+{
+#if defined(CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES)
+	// enable the DWT cycle counter (DEMCR.TRCENA, DWT_CTRL.CYCCNTENA)
+	*(volatile uint32_t *)0xe000edfc |= (1 << 24);
+	*(volatile uint32_t *)0xe0001000 |= (1 << 0);
+#endif // CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES
+}
+
+void Measurement::record(hrt_abstime elapsed_us, uint32_t elapsed_cycles)
+{
+	const uint32_t elapsed = (elapsed_us < UINT32_MAX) ? (uint32_t)elapsed_us : UINT32_MAX;
+
+	_events++;
+	_time_total += elapsed;
+
+	if (elapsed < _time_min) {
+		_time_min = elapsed;
+	}
+
+	if (elapsed > _time_max) {
+		_time_max = elapsed;
+	}
+
+	// Welford's online variance, as in the perf counters
+	const float delta = elapsed - _time_mean;
+	_time_mean += delta / _events;
+	_time_m2 += delta * (elapsed - _time_mean);
+
+	_cycles_total += elapsed_cycles;
+
+	if (elapsed_cycles < _cycles_min) {
+		_cycles_min = elapsed_cycles;
+	}
+
+	if (elapsed_cycles > _cycles_max) {
+		_cycles_max = elapsed_cycles;
+	}
+}
+
+Measurement::~Measurement()
+{
+	if (_events == 0) {
+		PX4_INFO_RAW("%s: no events\n", _name);
+		return;
+	}
+
+	const double mean = (double)_time_total / _events;
+	const double rms = (_events > 1) ? sqrt((double)_time_m2 / (_events - 1)) : 0.0;
+
+	PX4_INFO_RAW("%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, min %" PRIu32 "us max %" PRIu32
+		     "us %5.3fus rms\n", _name, _events, _time_total, mean, _time_min, _time_max, rms);
+
+#if defined(CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES)
+	const double cycles_mean = (double)_cycles_total / _events;
+	PX4_INFO_RAW("%s: %.1f cycles avg, min %" PRIu32 " max %" PRIu32 "\n", _name, cycles_mean, _cycles_min, _cycles_max);
+#endif // CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES
+
+	if (report_file != nullptr) {
+		// normalized per operation
+		const double ops = _ops_per_event;
+
+		fprintf(report_file, "{\"benchmark\": \"%s\", \"name\": \"%s\", \"events\": %" PRIu64 ", \"ops_per_event\": %u, "
+			"\"mean_us\": %.4f, \"min_us\": %.4f, \"max_us\": %.4f, \"rms_us\": %.4f",
+			benchmark_name, _name, _events, _ops_per_event, mean / ops, _time_min / ops, _time_max / ops, rms / ops);
+
+#if defined(CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES)
+		fprintf(report_file, ", \"mean_cycles\": %.1f, \"min_cycles\": %.1f, \"max_cycles\": %.1f",
+			cycles_mean / ops, _cycles_min / ops, _cycles_max / ops);
+#endif // CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES
+
+		fprintf(report_file, "}\n");
+		fflush(report_file);
+	}
+}
+
+} // namespace microbench
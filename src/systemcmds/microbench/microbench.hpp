@@ -0,0 +1,139 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file microbench.hpp
+ * Measurement helpers shared by all microbenchmarks.
+ *
+ * Every measurement is printed like a PC_ELAPSED perf counter and, if a report is open
+ * (microbench -o <file>), appended to it as one JSON object per line.
+ * With CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES the CPU cycles are counted as well (ARMv7-M DWT),
+ * which resolves operations well below the 1 us resolution of the hrt.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/time.h>
+
+namespace microbench
+{
+
+// disable interrupts during a measurement (NuttX only)
+void lock();
+void unlock();
+
+// open the JSON report, nullptr closes it
+bool report_open(const char *path);
+void report_close();
+
+// name of the benchmark the following measurements belong to
+void set_benchmark(const char *name);
+
+#if defined(CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES)
+// ARMv7-M Data Watchpoint and Trace unit cycle counter
+static inline uint32_t cycles() { return *(volatile uint32_t *)0xe0001004; }
+#else
+static inline uint32_t cycles() { return 0; }
+#endif // CONFIG_SYSTEMCMDS_MICROBENCH_CYCLES
+
+class Measurement
+{
+public:
+	/**
+	 * @param name Name of the measurement.
+	 * @param ops_per_event Number of operations per begin()/end() pair, the report is per operation.
+	 */
+	explicit Measurement(const char *name, unsigned ops_per_event = 1);
+
+	// prints and reports the measurement
+	~Measurement();
+
+	Measurement(const Measurement &) = delete;
+	Measurement &operator=(const Measurement &) = delete;
+
+	void begin()
+	{
+		_cycles_start = cycles();
+		_time_start = hrt_absolute_time();
+	}
+
+	void end()
+	{
+		const hrt_abstime now = hrt_absolute_time();
+		record(now - _time_start, cycles() - _cycles_start);
+	}
+
+	// add an externally measured event
+	void record(hrt_abstime elapsed_us, uint32_t elapsed_cycles = 0);
+
+private:
+	const char *_name;
+	const unsigned _ops_per_event;
+
+	hrt_abstime _time_start{0};
+	uint32_t _cycles_start{0};
+
+	uint64_t _events{0};
+	uint64_t _time_total{0};
+	uint32_t _time_min{UINT32_MAX};
+	uint32_t _time_max{0};
+	float _time_mean{0.f};
+	float _time_m2{0.f};
+
+	uint64_t _cycles_total{0};
+	uint32_t _cycles_min{UINT32_MAX};
+	uint32_t _cycles_max{0};
+};
+
+} // namespace microbench
+
+// time count executions of op, each with interrupts disabled and followed by a reset() of the test inputs
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		microbench::Measurement m{name}; \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			microbench::lock(); \
+			m.begin(); \
+			op; \
+			m.end(); \
+			microbench::unlock(); \
+			reset(); \
+		} \
+	} while (0)
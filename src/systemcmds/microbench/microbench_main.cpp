@@ -39,13 +39,19 @@
 #include <fcntl.h>
 #include <errno.h>
 
+#include "microbench.hpp"
+
 __BEGIN_DECLS
 
 extern int test_microbench_atomic(int argc, char *argv[]);
+extern int test_microbench_control(int argc, char *argv[]);
+extern int test_microbench_crc(int argc, char *argv[]);
+extern int test_microbench_failsafe(int argc, char *argv[]);
 extern int test_microbench_hrt(int argc, char *argv[]);
 extern int test_microbench_math(int argc, char *argv[]);
 extern int test_microbench_matrix(int argc, char *argv[]);
 extern int test_microbench_uorb(int argc, char *argv[]);
+extern int test_microbench_work_queue(int argc, char *argv[]);
 
 __END_DECLS
 
@@ -64,10 +70,16 @@ const struct {
 	{"all",		microbench_all,		OPT_NOALLTEST},
 
 	{"microbench_atomic",	test_microbench_atomic,	0},
+	{"microbench_control",	test_microbench_control,	0},
+	{"microbench_crc",	test_microbench_crc,	0},
+#if defined(CONFIG_MODULES_COMMANDER)
+	{"microbench_failsafe",	test_microbench_failsafe,	0},
+#endif
 	{"microbench_hrt",	test_microbench_hrt,	0},
 	{"microbench_math",	test_microbench_math,	0},
 	{"microbench_matrix",	test_microbench_matrix,	0},
 	{"microbench_uorb",	test_microbench_uorb,	0},
+	{"microbench_work_queue",	test_microbench_work_queue,	0},
 
 	{nullptr,			nullptr, 		0}
 };
@@ -76,6 +88,8 @@ const struct {
 
 static int microbench_help(int argc, char *argv[])
 {
+	printf("Usage: microbench [-o <report.json>] <test>\n");
+	printf("  -o: append every measurement to a JSON report (one object per line)\n\n");
 	printf("Available tests:\n");
 
 	for (int i = 0; microbenchmarks[i].name; i++) {
@@ -111,6 +125,8 @@ static int microbench_runner(unsigned option)
 			fflush(stdout);
 
 			/* Execute test */
+			microbench::set_benchmark(microbenchmarks[i].name);
+
 			if (microbenchmarks[i].fn(1, args) != 0) {
 				fprintf(stderr, "  [%s] \t\tFAIL\n", microbenchmarks[i].name);
 				fflush(stderr);
@@ -144,6 +160,14 @@ static int microbench_runner(unsigned option)
 
 extern "C" __EXPORT int microbench_main(int argc, char *argv[])
 {
+	const char *report_path = nullptr;
+
+	if ((argc >= 3) && !strcmp(argv[1], "-o")) {
+		report_path = argv[2];
+		argc -= 2;
+		argv += 2;
+	}
+
 	if (argc < 2) {
 		PX4_WARN("missing test name - 'microbench help' for a list of tests");
 		return 1;
@@ -151,7 +175,15 @@ extern "C" __EXPORT int microbench_main(int argc, char *argv[])
 
 	for (size_t i = 0; microbenchmarks[i].name; i++) {
 		if (!strcmp(microbenchmarks[i].name, argv[1])) {
-			if (microbenchmarks[i].fn(argc - 1, argv + 1) == 0) {
+			if (!microbench::report_open(report_path)) {
+				return 1;
+			}
+
+			microbench::set_benchmark(microbenchmarks[i].name);
+			const int ret = microbenchmarks[i].fn(argc - 1, argv + 1);
+			microbench::report_close();
+
+			if (ret == 0) {
 				PX4_INFO("%s PASSED", microbenchmarks[i].name);
 				return 0;
 
@@ -38,40 +38,20 @@
 
 #include <unit_test.h>
 
+#include "microbench.hpp"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
 
 #include <drivers/drv_hrt.h>
-#include <perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
 #include <px4_platform_common/atomic.h>
 
-#ifdef __PX4_NUTTX
-#include <nuttx/irq.h>
-#endif
-
 namespace MicroBenchAtomic
 {
 
-#define PERF(name, op, count) do { \
-		px4_usleep(100); \
-		reset(); \
-		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
-		for (int i = 0; i < count; i++) { \
-			px4_usleep(1); \
-			lock(); \
-			perf_begin(p); \
-			op; \
-			perf_end(p); \
-			unlock(); \
-			reset(); \
-		} \
-		perf_print_counter(p); \
-		perf_free(p); \
-	} while (0)
-
 class MicroBenchAtomic : public UnitTest
 {
 public:
@@ -89,24 +69,6 @@ private:
 
 	void reset();
 
-	void lock()
-	{
-#ifdef __PX4_NUTTX
-		_flags = px4_enter_critical_section();
-#endif
-	}
-
-	void unlock()
-	{
-#ifdef __PX4_NUTTX
-		px4_leave_critical_section(_flags);
-#endif
-	}
-
-#ifdef __PX4_NUTTX
-	irqstate_t _flags {};
-#endif
-
 	px4::atomic<bool> _atomic_bool{false};
 	px4::atomic<bool> _atomic_bool_storage{false};
 	bool _test_load_bool{};
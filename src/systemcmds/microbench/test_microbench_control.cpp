@@ -0,0 +1,440 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_control.cpp
+ * Microbenchmarks of the control chain (position controller, rate controller, control allocation and TECS).
+ */
+
+#include <unit_test.h>
+
+#include "microbench.hpp"
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <lib/rate_control/rate_control.hpp>
+
+#if defined(CONFIG_MODULES_CONTROL_ALLOCATOR)
+#include <ControlAllocationPseudoInverse.hpp>
+#include <ControlAllocationSequentialDesaturation.hpp>
+#include <ControlAllocationWeightedLeastSquares.hpp>
+#endif // CONFIG_MODULES_CONTROL_ALLOCATOR
+
+#if defined(CONFIG_MODULES_MC_POS_CONTROL)
+#include <PositionControl.hpp>
+#endif // CONFIG_MODULES_MC_POS_CONTROL
+
+#if defined(CONFIG_MODULES_FW_POS_CONTROL)
+#include <lib/tecs/TECS.hpp>
+#endif // CONFIG_MODULES_FW_POS_CONTROL
+
+namespace MicroBenchControl
+{
+
+class MicroBenchControl : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+
+	bool time_rate_control();
+	bool rate_control_deterministic();
+
+#if defined(CONFIG_MODULES_MC_POS_CONTROL)
+	bool time_position_control();
+
+	void initPositionControl(PositionControl &position_control);
+	bool runPositionControl(PositionControl &position_control, bool position_setpoint);
+#endif // CONFIG_MODULES_MC_POS_CONTROL
+
+#if defined(CONFIG_MODULES_FW_POS_CONTROL)
+	bool time_tecs();
+
+	void runTecs();
+#endif // CONFIG_MODULES_FW_POS_CONTROL
+
+#if defined(CONFIG_MODULES_CONTROL_ALLOCATOR)
+	bool time_control_allocation();
+	bool control_allocation_deterministic();
+
+	void setQuadXEffectiveness(ControlAllocation &allocation);
+	void setHexXEffectiveness(ControlAllocation &allocation);
+#endif // CONFIG_MODULES_CONTROL_ALLOCATOR
+
+	void reset();
+	void initRateControl(RateControl &rate_control);
+
+	matrix::Vector3f rate;
+	matrix::Vector3f rate_sp;
+	matrix::Vector3f angular_accel;
+	matrix::Vector3f torque;
+
+	matrix::Vector<float, 6> control_sp;
+
+	RateControl _rate_control;
+
+#if defined(CONFIG_MODULES_MC_POS_CONTROL)
+	PositionControlStates position_states {};
+	trajectory_setpoint_s trajectory_setpoint {};
+	vehicle_attitude_setpoint_s attitude_setpoint {};
+
+	PositionControl _position_control;
+#endif // CONFIG_MODULES_MC_POS_CONTROL
+
+#if defined(CONFIG_MODULES_FW_POS_CONTROL)
+	TECSAirspeedFilter::Input airspeed_input {};
+	TECSAltitudeReferenceModel::AltitudeReferenceState altitude_setpoint {};
+	TECSControl::Input tecs_input {};
+	TECSControl::Setpoint tecs_setpoint {};
+
+	// defaults of TECS and fw_pos_control
+	TECSAirspeedFilter::Param airspeed_filter_param{15.f, 0.2f, 0.05f, 0.02f};
+	TECSAltitudeReferenceModel::Param reference_param{3.f, 2.f, 1000.f, 7.f, 5.f, 5.f};
+	TECSControl::Param tecs_control_param{5.f, 2.f, 5.f, 7.f, 15.f, 10.f, 0.5f, -0.5f, 0.5f, 1.f, 0.1f,
+					      0.2f, 0.f, 0.15f, 0.1f, 0.4f, 1.f, 1.f, 0.1f, 0.1f, 0.05f, 0.1f, 0.f, 15.f, 1.f};
+	TECSControl::Flag tecs_flag{true, true};
+
+	TECSAirspeedFilter _airspeed_filter;
+	TECSAltitudeReferenceModel _altitude_reference_model;
+	TECSControl _tecs_control;
+#endif // CONFIG_MODULES_FW_POS_CONTROL
+
+#if defined(CONFIG_MODULES_CONTROL_ALLOCATOR)
+	ControlAllocationPseudoInverse _pseudo_inverse;
+	ControlAllocationSequentialDesaturation _sequential_desaturation;
+	ControlAllocationWeightedLeastSquares _weighted_least_squares;
+	ControlAllocationWeightedLeastSquares _weighted_least_squares_hex;
+#endif // CONFIG_MODULES_CONTROL_ALLOCATOR
+};
+
+bool MicroBenchControl::run_tests()
+{
+	srand(time(nullptr));
+
+	ut_run_test(time_rate_control);
+	ut_run_test(rate_control_deterministic);
+
+#if defined(CONFIG_MODULES_MC_POS_CONTROL)
+	ut_run_test(time_position_control);
+#endif // CONFIG_MODULES_MC_POS_CONTROL
+
+#if defined(CONFIG_MODULES_FW_POS_CONTROL)
+	ut_run_test(time_tecs);
+#endif // CONFIG_MODULES_FW_POS_CONTROL
+
+#if defined(CONFIG_MODULES_CONTROL_ALLOCATOR)
+	ut_run_test(time_control_allocation);
+	ut_run_test(control_allocation_deterministic);
+#endif // CONFIG_MODULES_CONTROL_ALLOCATOR
+
+	return (_tests_failed == 0);
+}
+
+template<typename T>
+T random(T min, T max)
+{
+	const T scale = rand() / (T) RAND_MAX; /* [0, 1.0] */
+	return min + scale * (max - min);      /* [min, max] */
+}
+
+void MicroBenchControl::reset()
+{
+	// initialize with random data, large enough to saturate the actuators from time to time
+	for (int i = 0; i < 3; i++) {
+		rate(i) = random(-3.f, 3.f);
+		rate_sp(i) = random(-3.f, 3.f);
+		angular_accel(i) = random(-30.f, 30.f);
+	}
+
+	for (int i = 0; i < 3; i++) {
+		control_sp(i) = random(-1.f, 1.f);
+	}
+
+	control_sp(3) = 0.f;
+	control_sp(4) = 0.f;
+	control_sp(5) = random(-1.f, 0.f);
+
+#if defined(CONFIG_MODULES_MC_POS_CONTROL)
+	// position and velocity errors of a few meters, large enough to reach the tilt and thrust limits
+	for (int i = 0; i < 3; i++) {
+		position_states.position(i) = random(-5.f, 5.f);
+		position_states.velocity(i) = random(-3.f, 3.f);
+		position_states.acceleration(i) = random(-2.f, 2.f);
+		trajectory_setpoint.position[i] = random(-5.f, 5.f);
+		trajectory_setpoint.velocity[i] = random(-1.f, 1.f);
+		trajectory_setpoint.acceleration[i] = random(-1.f, 1.f);
+	}
+
+	position_states.yaw = random(-3.f, 3.f);
+	trajectory_setpoint.yaw = random(-3.f, 3.f);
+	trajectory_setpoint.yawspeed = 0.f;
+#endif // CONFIG_MODULES_MC_POS_CONTROL
+
+#if defined(CONFIG_MODULES_FW_POS_CONTROL)
+	// altitude and airspeed errors around the trim point, occasionally undersped
+	airspeed_input.equivalent_airspeed = random(8.f, 25.f);
+	airspeed_input.equivalent_airspeed_rate = random(-2.f, 2.f);
+	altitude_setpoint.alt = random(90.f, 110.f);
+	altitude_setpoint.alt_rate = NAN;
+	tecs_input.altitude = random(90.f, 110.f);
+	tecs_input.altitude_rate = random(-3.f, 3.f);
+	tecs_setpoint.tas_setpoint = random(12.f, 20.f);
+#endif // CONFIG_MODULES_FW_POS_CONTROL
+}
+
+void MicroBenchControl::initRateControl(RateControl &rate_control)
+{
+	rate_control.setPidGains(matrix::Vector3f(0.15f, 0.15f, 0.2f), matrix::Vector3f(0.2f, 0.2f, 0.1f),
+				 matrix::Vector3f(0.003f, 0.003f, 0.f));
+	rate_control.setIntegratorLimit(matrix::Vector3f(0.3f, 0.3f, 0.3f));
+	rate_control.setFeedForwardGain(matrix::Vector3f());
+	rate_control.resetIntegral();
+}
+
+bool MicroBenchControl::time_rate_control()
+{
+	initRateControl(_rate_control);
+
+	PERF("RateControl update", torque = _rate_control.update(rate, rate_sp, angular_accel, 0.001f, false), 1000);
+	PERF("RateControl update (landed)", torque = _rate_control.update(rate, rate_sp, angular_accel, 0.001f, true), 1000);
+	return true;
+}
+
+bool MicroBenchControl::rate_control_deterministic()
+{
+	// two controllers fed with the same input sequence must produce bitwise identical outputs
+	RateControl rate_control[2];
+	initRateControl(rate_control[0]);
+	initRateControl(rate_control[1]);
+
+	matrix::Vector3f output[2];
+
+	for (int i = 0; i < 1000; i++) {
+		reset();
+
+		for (int n = 0; n < 2; n++) {
+			output[n] = rate_control[n].update(rate, rate_sp, angular_accel, 0.001f, false);
+		}
+
+		for (int axis = 0; axis < 3; axis++) {
+			ut_assert("rate control output deterministic", memcmp(&output[0](axis), &output[1](axis), sizeof(float)) == 0);
+		}
+	}
+
+	return true;
+}
+
+#if defined(CONFIG_MODULES_MC_POS_CONTROL)
+void MicroBenchControl::initPositionControl(PositionControl &position_control)
+{
+	// parameter defaults of mc_pos_control
+	position_control.setPositionGains(matrix::Vector3f(0.95f, 0.95f, 1.f));
+	position_control.setVelocityGains(matrix::Vector3f(1.8f, 1.8f, 4.f), matrix::Vector3f(0.4f, 0.4f, 2.f),
+					  matrix::Vector3f(0.2f, 0.2f, 0.f));
+	position_control.setVelocityLimits(12.f, 3.f, 1.5f);
+	position_control.setThrustLimits(0.12f, 1.f);
+	position_control.setHorizontalThrustMargin(0.3f);
+	position_control.setTiltLimit(0.785f);
+	position_control.setHoverThrust(0.5f);
+}
+
+bool MicroBenchControl::runPositionControl(PositionControl &position_control, bool position_setpoint)
+{
+	if (!position_setpoint) {
+		// velocity control only, as in the manual modes
+		for (int i = 0; i < 3; i++) {
+			trajectory_setpoint.position[i] = NAN;
+		}
+	}
+
+	// one cycle of mc_pos_control: P-PID cascade, thrust limiting and attitude extraction
+	position_control.setState(position_states);
+	position_control.setInputSetpoint(trajectory_setpoint);
+	const bool valid = position_control.update(0.01f);
+	position_control.getAttitudeSetpoint(attitude_setpoint);
+	return valid;
+}
+
+bool MicroBenchControl::time_position_control()
+{
+	initPositionControl(_position_control);
+	PERF("PositionControl update and attitude", runPositionControl(_position_control, true), 1000);
+
+	initPositionControl(_position_control);
+	PERF("PositionControl update and attitude (velocity)", runPositionControl(_position_control, false), 1000);
+
+	return true;
+}
+#endif // CONFIG_MODULES_MC_POS_CONTROL
+
+#if defined(CONFIG_MODULES_FW_POS_CONTROL)
+void MicroBenchControl::runTecs()
+{
+	// one TECS::update() at 50 Hz: airspeed filter, altitude reference model and energy control
+	static constexpr float dt = 0.02f;
+
+	_airspeed_filter.update(dt, airspeed_input, airspeed_filter_param, tecs_flag.airspeed_enabled);
+	_altitude_reference_model.update(dt, altitude_setpoint, tecs_input.altitude, tecs_input.altitude_rate,
+					 reference_param);
+
+	tecs_setpoint.altitude_reference = _altitude_reference_model.getAltitudeReference();
+	tecs_setpoint.altitude_rate_setpoint_direct = _altitude_reference_model.getHeightRateSetpointDirect();
+	tecs_input.tas = _airspeed_filter.getState().speed;
+	tecs_input.tas_rate = _airspeed_filter.getState().speed_rate;
+
+	_tecs_control.update(dt, tecs_setpoint, tecs_input, tecs_control_param, tecs_flag);
+}
+
+bool MicroBenchControl::time_tecs()
+{
+	_airspeed_filter.initialize(15.f, airspeed_filter_param.equivalent_airspeed_trim, true);
+	_altitude_reference_model.initialize(TECSAltitudeReferenceModel::AltitudeReferenceState{100.f, 0.f});
+	_tecs_control.resetIntegrals();
+
+	PERF("TECSAirspeedFilter update", _airspeed_filter.update(0.02f, airspeed_input, airspeed_filter_param, true), 1000);
+	PERF("TECSAltitudeReferenceModel update", _altitude_reference_model.update(0.02f, altitude_setpoint,
+			tecs_input.altitude, tecs_input.altitude_rate, reference_param), 1000);
+	PERF("TECS update", runTecs(), 1000);
+
+	return true;
+}
+#endif // CONFIG_MODULES_FW_POS_CONTROL
+
+#if defined(CONFIG_MODULES_CONTROL_ALLOCATOR)
+void MicroBenchControl::setQuadXEffectiveness(ControlAllocation &allocation)
+{
+	matrix::Matrix<float, ControlAllocation::NUM_AXES, ControlAllocation::NUM_ACTUATORS> effectiveness;
+	const float roll[4] {-0.5f, 0.5f, 0.5f, -0.5f};
+	const float pitch[4] {0.5f, -0.5f, 0.5f, -0.5f};
+	const float yaw[4] {0.05f, 0.05f, -0.05f, -0.05f};
+
+	for (int i = 0; i < 4; i++) {
+		effectiveness(0, i) = roll[i];
+		effectiveness(1, i) = pitch[i];
+		effectiveness(2, i) = yaw[i];
+		effectiveness(5, i) = -1.f;
+	}
+
+	allocation.setEffectivenessMatrix(effectiveness, {}, {}, 4, true);
+}
+
+void MicroBenchControl::setHexXEffectiveness(ControlAllocation &allocation)
+{
+	matrix::Matrix<float, ControlAllocation::NUM_AXES, ControlAllocation::NUM_ACTUATORS> effectiveness;
+	const float roll[6] {-1.f, 1.f, 0.5f, -0.5f, -0.5f, 0.5f};
+	const float pitch[6] {0.f, 0.f, 0.866f, -0.866f, 0.866f, -0.866f};
+	const float yaw[6] {-0.05f, 0.05f, -0.05f, 0.05f, 0.05f, -0.05f};
+
+	for (int i = 0; i < 6; i++) {
+		effectiveness(0, i) = roll[i];
+		effectiveness(1, i) = pitch[i];
+		effectiveness(2, i) = yaw[i];
+		effectiveness(5, i) = -1.f;
+	}
+
+	allocation.setEffectivenessMatrix(effectiveness, {}, {}, 6, true);
+}
+
+bool MicroBenchControl::time_control_allocation()
+{
+	setQuadXEffectiveness(_pseudo_inverse);
+	setQuadXEffectiveness(_sequential_desaturation);
+	setQuadXEffectiveness(_weighted_least_squares);
+	setHexXEffectiveness(_weighted_least_squares_hex);
+
+	// the first allocation computes the pseudo inverse, only the steady state is measured
+	_pseudo_inverse.allocate();
+	_sequential_desaturation.allocate();
+	_weighted_least_squares.allocate();
+	_weighted_least_squares_hex.allocate();
+
+	PERF("ControlAllocation pseudo inverse allocate (quad)",
+	     _pseudo_inverse.setControlSetpoint(control_sp); _pseudo_inverse.allocate(); _pseudo_inverse.clipActuatorSetpoint(),
+	     1000);
+	PERF("ControlAllocation sequential desaturation allocate (quad)",
+	     _sequential_desaturation.setControlSetpoint(control_sp); _sequential_desaturation.allocate();
+	     _sequential_desaturation.clipActuatorSetpoint(), 1000);
+	PERF("ControlAllocation weighted least squares allocate (quad)",
+	     _weighted_least_squares.setControlSetpoint(control_sp); _weighted_least_squares.allocate();
+	     _weighted_least_squares.clipActuatorSetpoint(), 1000);
+	PERF("ControlAllocation weighted least squares allocate (hex)",
+	     _weighted_least_squares_hex.setControlSetpoint(control_sp); _weighted_least_squares_hex.allocate();
+	     _weighted_least_squares_hex.clipActuatorSetpoint(), 1000);
+
+	// full chain of one rate control cycle
+	initRateControl(_rate_control);
+	PERF("Rate control and allocation (quad)",
+	     torque = _rate_control.update(rate, rate_sp, angular_accel, 0.001f, false);
+	     control_sp(0) = torque(0); control_sp(1) = torque(1); control_sp(2) = torque(2);
+	     _sequential_desaturation.setControlSetpoint(control_sp); _sequential_desaturation.allocate();
+	     _sequential_desaturation.clipActuatorSetpoint(), 1000);
+
+	return true;
+}
+
+bool MicroBenchControl::control_allocation_deterministic()
+{
+	// the same setpoint sequence must yield bitwise identical actuator setpoints, independent of warm starts
+	ControlAllocationWeightedLeastSquares allocation[2];
+	setHexXEffectiveness(allocation[0]);
+	setHexXEffectiveness(allocation[1]);
+
+	for (int i = 0; i < 1000; i++) {
+		reset();
+
+		for (int n = 0; n < 2; n++) {
+			allocation[n].setControlSetpoint(control_sp);
+			allocation[n].allocate();
+			allocation[n].clipActuatorSetpoint();
+		}
+
+		for (int actuator = 0; actuator < ControlAllocation::NUM_ACTUATORS; actuator++) {
+			ut_assert("allocation deterministic", memcmp(&allocation[0].getActuatorSetpoint()(actuator),
+					&allocation[1].getActuatorSetpoint()(actuator), sizeof(float)) == 0);
+		}
+	}
+
+	return true;
+}
+#endif // CONFIG_MODULES_CONTROL_ALLOCATOR
+
+ut_declare_test_c(test_microbench_control, MicroBenchControl)
+
+} // namespace MicroBenchControl
@@ -0,0 +1,149 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_crc.cpp
+ * Microbenchmarks of the checksums, in particular the MAVLink frame checksum (CRC-16/MCRF4XX)
+ * which is computed for every packed and for every parsed MAVLink message.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.hpp"
+
+#include <time.h>
+#include <stdlib.h>
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <lib/crc/crc.h>
+
+namespace MicroBenchCRC
+{
+
+// MAVLink v2 maximum packet length (MAVLINK_MAX_PACKET_LEN)
+static constexpr size_t MAVLINK_FRAME_LENGTH = 280;
+
+// crc_accumulate() of the MAVLink C library (checksum.h)
+static inline uint16_t mavlink_crc_accumulate(uint16_t crc, uint8_t data)
+{
+	uint8_t tmp = data ^ (uint8_t)(crc & 0xff);
+	tmp ^= (tmp << 4);
+	return (crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4);
+}
+
+class MicroBenchCRC : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+
+	bool time_mavlink_checksum();
+	bool time_crc32();
+
+	void reset();
+
+	uint8_t _frame[MAVLINK_FRAME_LENGTH];
+	uint8_t _block[1024];
+
+	uint16_t _crc16_out{0};
+	uint32_t _crc32_out{0};
+};
+
+bool MicroBenchCRC::run_tests()
+{
+	ut_run_test(time_mavlink_checksum);
+	ut_run_test(time_crc32);
+
+	return (_tests_failed == 0);
+}
+
+void MicroBenchCRC::reset()
+{
+	srand(time(nullptr));
+
+	// initialize with random data
+	for (size_t i = 0; i < sizeof(_frame); i++) {
+		_frame[i] = rand();
+	}
+
+	for (size_t i = 0; i < sizeof(_block); i++) {
+		_block[i] = rand();
+	}
+}
+
+ut_declare_test_c(test_microbench_crc, MicroBenchCRC)
+
+bool MicroBenchCRC::time_mavlink_checksum()
+{
+	reset();
+
+	// both implementations must agree
+	uint16_t crc_reference = 0xffff;
+
+	for (size_t i = 0; i < sizeof(_frame); i++) {
+		crc_reference = mavlink_crc_accumulate(crc_reference, _frame[i]);
+	}
+
+	ut_compare("CRC-16/MCRF4XX table", crc16_mcrf4xx_signature(0xffff, sizeof(_frame), _frame), crc_reference);
+
+	PERF("MAVLink crc_accumulate() 280 B", {
+		uint16_t crc = 0xffff;
+
+		for (size_t j = 0; j < sizeof(_frame); j++) {
+			crc = mavlink_crc_accumulate(crc, _frame[j]);
+		}
+
+		_crc16_out = crc;
+	}, 1000);
+
+	PERF("crc16_mcrf4xx_signature() 280 B", _crc16_out = crc16_mcrf4xx_signature(0xffff, sizeof(_frame), _frame), 1000);
+
+	// the typical telemetry message (e.g. ATTITUDE_QUATERNION: 10 B header + 48 B payload)
+	PERF("crc16_mcrf4xx_signature() 58 B", _crc16_out = crc16_mcrf4xx_signature(0xffff, 58, _frame), 1000);
+
+	return true;
+}
+
+bool MicroBenchCRC::time_crc32()
+{
+	PERF("crc32_signature() 1 kB", _crc32_out = crc32_signature(0, sizeof(_block), _block), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchCRC
@@ -0,0 +1,168 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_failsafe.cpp
+ * Microbenchmarks of the commander failsafe state machine evaluation.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.hpp"
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <failsafe.h>
+
+#include <uORB/topics/vehicle_status.h>
+
+using namespace time_literals;
+
+namespace MicroBenchFailsafe
+{
+
+class MicroBenchFailsafe : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+
+	bool time_failsafe_update();
+	bool failsafe_update_deterministic();
+
+	void reset();
+	uint8_t update(Failsafe &failsafe);
+
+	Failsafe _failsafe{nullptr};
+
+	FailsafeBase::State _state{};
+	failsafe_flags_s _failsafe_flags{};
+	hrt_abstime _time{0};
+	bool _random_flags{false};
+	uint8_t _user_intended_mode{0};
+};
+
+bool MicroBenchFailsafe::run_tests()
+{
+	srand(time(nullptr));
+
+	ut_run_test(time_failsafe_update);
+	ut_run_test(failsafe_update_deterministic);
+
+	return (_tests_failed == 0);
+}
+
+void MicroBenchFailsafe::reset()
+{
+	// commander runs the failsafe update at 100 Hz
+	_time += 10_ms;
+
+	if (_random_flags) {
+		// flip one of the most common failsafe conditions at a time
+		switch (rand() % 4) {
+		case 0: _failsafe_flags.manual_control_signal_lost = !_failsafe_flags.manual_control_signal_lost; break;
+
+		case 1: _failsafe_flags.gcs_connection_lost = !_failsafe_flags.gcs_connection_lost; break;
+
+		case 2: _failsafe_flags.battery_warning = rand() % 4; break;
+
+		default: _failsafe_flags.local_position_invalid = !_failsafe_flags.local_position_invalid; break;
+		}
+	}
+}
+
+uint8_t MicroBenchFailsafe::update(Failsafe &failsafe)
+{
+	return failsafe.update(_time, _state, false, false, _failsafe_flags);
+}
+
+bool MicroBenchFailsafe::time_failsafe_update()
+{
+	_state.armed = true;
+	_state.user_intended_mode = vehicle_status_s::NAVIGATION_STATE_POSCTL;
+	_state.vehicle_type = vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
+	_time = 10_s;
+
+	_failsafe_flags = failsafe_flags_s{};
+	_random_flags = false;
+	PERF("Failsafe update (no failsafe)", _user_intended_mode = update(_failsafe), 1000);
+
+	_failsafe_flags.manual_control_signal_lost = true;
+	PERF("Failsafe update (RC loss active)", _user_intended_mode = update(_failsafe), 1000);
+
+	_failsafe_flags = failsafe_flags_s{};
+	_random_flags = true;
+	PERF("Failsafe update (changing flags)", _user_intended_mode = update(_failsafe), 1000);
+
+	_random_flags = false;
+	return true;
+}
+
+bool MicroBenchFailsafe::failsafe_update_deterministic()
+{
+	// two state machines fed with the same input sequence must select the same actions and modes
+	Failsafe failsafe0{nullptr};
+	Failsafe failsafe1{nullptr};
+
+	_state.armed = true;
+	_state.user_intended_mode = vehicle_status_s::NAVIGATION_STATE_POSCTL;
+	_state.vehicle_type = vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
+	_time = 10_s;
+	_failsafe_flags = failsafe_flags_s{};
+	_random_flags = true;
+
+	for (int i = 0; i < 1000; i++) {
+		reset();
+
+		const uint8_t mode0 = update(failsafe0);
+		const uint8_t mode1 = update(failsafe1);
+
+		ut_assert("failsafe mode deterministic", mode0 == mode1);
+		ut_assert("failsafe action deterministic", failsafe0.selectedAction() == failsafe1.selectedAction());
+	}
+
+	_random_flags = false;
+	return true;
+}
+
+ut_declare_test_c(test_microbench_failsafe, MicroBenchFailsafe)
+
+} // namespace MicroBenchFailsafe
@@ -38,54 +38,19 @@
 
 #include <unit_test.h>
 
+#include "microbench.hpp"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
 
 #include <drivers/drv_hrt.h>
-#include <perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
 
 namespace MicroBenchHRT
 {
 
-#ifdef __PX4_NUTTX
-#include <nuttx/irq.h>
-static irqstate_t flags;
-#endif
-
-void lock()
-{
-#ifdef __PX4_NUTTX
-	flags = px4_enter_critical_section();
-#endif
-}
-
-void unlock()
-{
-#ifdef __PX4_NUTTX
-	px4_leave_critical_section(flags);
-#endif
-}
-
-#define PERF(name, op, count) do { \
-		px4_usleep(1000); \
-		reset(); \
-		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
-		for (int i = 0; i < count; i++) { \
-			px4_usleep(1); \
-			lock(); \
-			perf_begin(p); \
-			op; \
-			perf_end(p); \
-			unlock(); \
-			reset(); \
-		} \
-		perf_print_counter(p); \
-		perf_free(p); \
-	} while (0)
-
 class MicroBenchHRT : public UnitTest
 {
 public:
@@ -97,20 +62,6 @@ private:
 
 	void reset();
 
-	void lock()
-	{
-#ifdef __PX4_NUTTX
-		flags = px4_enter_critical_section();
-#endif
-	}
-
-	void unlock()
-	{
-#ifdef __PX4_NUTTX
-		px4_leave_critical_section(flags);
-#endif
-	}
-
 	uint64_t u_64;
 	uint64_t u_64_out;
 };
@@ -145,6 +96,9 @@ bool MicroBenchHRT::time_px4_hrt()
 	PERF("hrt_absolute_time()", u_64_out = hrt_absolute_time(), 1000);
 	PERF("hrt_elapsed_time()", u_64_out = hrt_elapsed_time(&u_64), 1000);
 
+	// back to back calls, hides the perf counter overhead of the single call measurement
+	PERF("hrt_absolute_time() x100", for (int j = 0; j < 100; j++) { u_64_out += hrt_absolute_time(); }, 100);
+
 	return true;
 }
 
@@ -38,45 +38,29 @@
 
 #include <unit_test.h>
 
+#include "microbench.hpp"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <math.h>
 
 #include <drivers/drv_hrt.h>
-#include <perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
 
 namespace MicroBenchMath
 {
 
-#ifdef __PX4_NUTTX
-#include <nuttx/irq.h>
-static irqstate_t flags;
-#endif
-
-void lock()
-{
-#ifdef __PX4_NUTTX
-	flags = px4_enter_critical_section();
-#endif
-}
-
-void unlock()
-{
-#ifdef __PX4_NUTTX
-	px4_leave_critical_section(flags);
-#endif
-}
-
+// the operations are too short to be timed one by one, time 10 batches of count operations instead
+#undef PERF
 #define PERF(name, op, count) do { \
 		reset(); \
-		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		microbench::Measurement m{name, ((count) / 10) * 10}; \
 		for (int rep = 0; rep < 10; rep++) { \
 			px4_usleep(1000); \
-			lock(); \
-			perf_begin(p); \
+			microbench::lock(); \
+			m.begin(); \
 			for (int i = 0; i < (count)/10; i++) { \
 				op; \
 				op; \
@@ -89,12 +73,10 @@ void unlock()
 				op; \
 				op; \
 			} \
-			perf_end(p); \
-			unlock(); \
+			m.end(); \
+			microbench::unlock(); \
 			reset(); \
 		} \
-		perf_print_counter(p); \
-		perf_free(p); \
 	} while (0)
 
 class MicroBenchMath : public UnitTest
@@ -38,12 +38,13 @@
 
 #include <unit_test.h>
 
+#include "microbench.hpp"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
 
 #include <drivers/drv_hrt.h>
-#include <perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
 
@@ -52,42 +53,6 @@
 namespace MicroBenchMatrix
 {
 
-#ifdef __PX4_NUTTX
-#include <nuttx/irq.h>
-static irqstate_t flags;
-#endif
-
-void lock()
-{
-#ifdef __PX4_NUTTX
-	flags = px4_enter_critical_section();
-#endif
-}
-
-void unlock()
-{
-#ifdef __PX4_NUTTX
-	px4_leave_critical_section(flags);
-#endif
-}
-
-#define PERF(name, op, count) do { \
-		px4_usleep(1000); \
-		reset(); \
-		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
-		for (int i = 0; i < count; i++) { \
-			px4_usleep(1); \
-			lock(); \
-			perf_begin(p); \
-			op; \
-			perf_end(p); \
-			unlock(); \
-			reset(); \
-		} \
-		perf_print_counter(p); \
-		perf_free(p); \
-	} while (0)
-
 class MicroBenchMatrix : public UnitTest
 {
 public:
@@ -99,6 +64,7 @@ private:
 	bool time_matrix_quaternion();
 	bool time_matrix_dcm();
 	bool time_matrix_pseduo_inverse();
+	bool time_matrix_multiplication();
 
 	void reset();
 
@@ -108,6 +74,12 @@ private:
 	matrix::Matrix<float, 16, 6> A16;
 	matrix::Matrix<float, 6, 16> B16;
 	matrix::Matrix<float, 6, 16> B16_4;
+
+	matrix::SquareMatrix<float, 3> M3;
+	matrix::SquareMatrix<float, 4> M4;
+	matrix::Vector3f v3;
+	matrix::Vector<float, 6> v6;
+	matrix::Vector<float, 16> v16;
 };
 
 bool MicroBenchMatrix::run_tests()
@@ -116,6 +88,7 @@ bool MicroBenchMatrix::run_tests()
 	ut_run_test(time_matrix_quaternion);
 	ut_run_test(time_matrix_dcm);
 	ut_run_test(time_matrix_pseduo_inverse);
+	ut_run_test(time_matrix_multiplication);
 
 	return (_tests_failed == 0);
 }
@@ -144,7 +117,26 @@ void MicroBenchMatrix::reset()
 		for (size_t i = 0; i < 4; i++) {
 			B16_4(j, i) = random(-10.0, 10.0);
 		}
+
+		v6(j) = random(-1.0, 1.0);
 	}
+
+	for (size_t i = 0; i < 16; i++) {
+		v16(i) = random(-1.0, 1.0);
+
+		for (size_t j = 0; j < 6; j++) {
+			A16(i, j) = random(-10.0, 10.0);
+		}
+	}
+
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < 4; j++) {
+			M4(i, j) = random(-10.0, 10.0);
+		}
+	}
+
+	M3 = M4.slice<3, 3>(0, 0);
+	v3 = v6.slice<3, 1>(0, 0);
 }
 
 bool MicroBenchMatrix::time_matrix_euler()
@@ -175,6 +167,16 @@ bool MicroBenchMatrix::time_matrix_pseduo_inverse()
 	return true;
 }
 
+bool MicroBenchMatrix::time_matrix_multiplication()
+{
+	PERF("matrix 3x3 * 3x3", M3 = M3 * M3, 100);
+	PERF("matrix 3x3 * Vector3", v3 = M3 * v3, 100);
+	PERF("matrix 4x4 * 4x4", M4 = M4 * M4, 100);
+	PERF("matrix 6x16 * Vector16 (allocated control)", v6 = B16 * v16, 100);
+	PERF("matrix 16x6 * Vector6 (control allocation)", v16 = A16 * v6, 100);
+	return true;
+}
+
 ut_declare_test_c(test_microbench_matrix, MicroBenchMatrix)
 
 } // namespace MicroBenchMatrix
@@ -38,12 +38,13 @@
 
 #include <unit_test.h>
 
+#include "microbench.hpp"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
 
 #include <drivers/drv_hrt.h>
-#include <perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
 
@@ -57,42 +58,6 @@
 namespace MicroBenchORB
 {
 
-#ifdef __PX4_NUTTX
-#include <nuttx/irq.h>
-static irqstate_t flags;
-#endif
-
-void lock()
-{
-#ifdef __PX4_NUTTX
-	flags = px4_enter_critical_section();
-#endif
-}
-
-void unlock()
-{
-#ifdef __PX4_NUTTX
-	px4_leave_critical_section(flags);
-#endif
-}
-
-#define PERF(name, op, count) do { \
-		px4_usleep(1000); \
-		reset(); \
-		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
-		for (int i = 0; i < count; i++) { \
-			px4_usleep(1); \
-			lock(); \
-			perf_begin(p); \
-			op; \
-			perf_end(p); \
-			unlock(); \
-			reset(); \
-		} \
-		perf_print_counter(p); \
-		perf_free(p); \
-	} while (0)
-
 class MicroBenchORB : public UnitTest
 {
 public:
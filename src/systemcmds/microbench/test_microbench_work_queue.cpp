@@ -0,0 +1,150 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_work_queue.cpp
+ * Microbenchmarks of the work queue scheduling.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.hpp"
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+
+using namespace time_literals;
+
+namespace MicroBenchWorkQueue
+{
+
+class BenchWorkItem : public px4::WorkItem
+{
+public:
+	BenchWorkItem() : px4::WorkItem("microbench_work_queue", px4::wq_configurations::test1) {}
+	~BenchWorkItem() override { ScheduleClear(); }
+
+	// time and cycle count of the last Run()
+	hrt_abstime run_time() const { return _run_time.load(); }
+	uint32_t run_cycles() const { return _run_cycles.load(); }
+	uint32_t run_count() const { return _run_count_atomic.load(); }
+
+	void clear() { ScheduleClear(); }
+
+private:
+	void Run() override
+	{
+		_run_cycles.store(microbench::cycles());
+		_run_time.store(hrt_absolute_time());
+		_run_count_atomic.fetch_add(1);
+	}
+
+	px4::atomic<hrt_abstime> _run_time{0};
+	px4::atomic<uint32_t> _run_cycles{0};
+	px4::atomic<uint32_t> _run_count_atomic{0};
+};
+
+class MicroBenchWorkQueue : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+
+	bool time_schedule_now();
+	bool time_schedule_latency();
+
+	void reset();
+
+	BenchWorkItem _work_item{};
+};
+
+bool MicroBenchWorkQueue::run_tests()
+{
+	ut_run_test(time_schedule_now);
+	ut_run_test(time_schedule_latency);
+
+	return (_tests_failed == 0);
+}
+
+void MicroBenchWorkQueue::reset()
+{
+	_work_item.clear();
+}
+
+ut_declare_test_c(test_microbench_work_queue, MicroBenchWorkQueue)
+
+bool MicroBenchWorkQueue::time_schedule_now()
+{
+	// the item is removed from the queue (reset()) before every call, so every call wakes the worker thread
+	PERF("WorkItem::ScheduleNow()", _work_item.ScheduleNow(), 1000);
+
+	return true;
+}
+
+bool MicroBenchWorkQueue::time_schedule_latency()
+{
+	px4_usleep(1000);
+
+	microbench::Measurement m{"WorkItem::ScheduleNow() to Run() latency"};
+
+	for (int i = 0; i < 1000; i++) {
+		const uint32_t run_count = _work_item.run_count();
+
+		const uint32_t cycles_start = microbench::cycles();
+		const hrt_abstime time_start = hrt_absolute_time();
+		_work_item.ScheduleNow();
+
+		// wait for the run, the latency is taken from the time recorded in Run()
+		const hrt_abstime timeout = time_start + 100_ms;
+
+		while (_work_item.run_count() == run_count) {
+			if (hrt_absolute_time() > timeout) {
+				PX4_ERR("work item didn't run");
+				return false;
+			}
+
+			px4_usleep(10);
+		}
+
+		m.record(_work_item.run_time() - time_start, _work_item.run_cycles() - cycles_start);
+	}
+
+	return true;
+}
+
+} // namespace MicroBenchWorkQueue
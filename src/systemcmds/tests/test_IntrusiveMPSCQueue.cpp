@@ -0,0 +1,194 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <unit_test.h>
+#include <containers/IntrusiveMPSCQueue.hpp>
+#include <pthread.h>
+
+class testMPSCContainer : public IntrusiveMPSCQueueNode<testMPSCContainer *>
+{
+public:
+	int producer{0};
+	int i{0};
+};
+
+class IntrusiveMPSCQueueTest : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+	bool test_push_pop_all();
+	bool test_repush();
+	bool test_multi_producer();
+
+};
+
+bool IntrusiveMPSCQueueTest::run_tests()
+{
+	ut_run_test(test_push_pop_all);
+	ut_run_test(test_repush);
+	ut_run_test(test_multi_producer);
+
+	return (_tests_failed == 0);
+}
+
+bool IntrusiveMPSCQueueTest::test_push_pop_all()
+{
+	IntrusiveMPSCQueue<testMPSCContainer *> q1;
+	testMPSCContainer nodes[100];
+
+	ut_assert_true(q1.empty());
+
+	for (int i = 0; i < 100; i++) {
+		nodes[i].i = i;
+		q1.push(&nodes[i]);
+		ut_assert_false(q1.empty());
+	}
+
+	// all nodes in push order
+	int next = 0;
+	bool in_order = true;
+	q1.pop_all([&](testMPSCContainer * t) { in_order &= (t->i == next++); });
+
+	ut_assert_true(in_order);
+	ut_compare("popped 100", next, 100);
+	ut_assert_true(q1.empty());
+
+	// nothing left
+	int count = 0;
+	q1.pop_all([&](testMPSCContainer * t) { count++; });
+	ut_compare("popped 0", count, 0);
+
+	return true;
+}
+
+bool IntrusiveMPSCQueueTest::test_repush()
+{
+	IntrusiveMPSCQueue<testMPSCContainer *> q1;
+	testMPSCContainer nodes[10];
+
+	for (int i = 0; i < 10; i++) {
+		nodes[i].i = i;
+		q1.push(&nodes[i]);
+	}
+
+	// nodes pushed again from the consumer are returned by the next pop_all()
+	int count = 0;
+	q1.pop_all([&](testMPSCContainer * t) {
+		count++;
+		q1.push(t);
+	});
+
+	ut_compare("popped 10", count, 10);
+	ut_assert_false(q1.empty());
+
+	int next = 0;
+	bool in_order = true;
+	q1.pop_all([&](testMPSCContainer * t) { in_order &= (t->i == next++); });
+
+	ut_assert_true(in_order);
+	ut_compare("popped 10 again", next, 10);
+
+	return true;
+}
+
+static constexpr int NUM_PRODUCERS = 4;
+static constexpr int NODES_PER_PRODUCER = 1000;
+
+struct ProducerArgs {
+	IntrusiveMPSCQueue<testMPSCContainer *> *queue;
+	testMPSCContainer *nodes;
+};
+
+static void *producer_main(void *arg)
+{
+	ProducerArgs *args = (ProducerArgs *)arg;
+
+	for (int i = 0; i < NODES_PER_PRODUCER; i++) {
+		args->queue->push(&args->nodes[i]);
+	}
+
+	return nullptr;
+}
+
+bool IntrusiveMPSCQueueTest::test_multi_producer()
+{
+	IntrusiveMPSCQueue<testMPSCContainer *> q1;
+
+	testMPSCContainer *nodes = new testMPSCContainer[NUM_PRODUCERS * NODES_PER_PRODUCER];
+	ut_assert_true(nodes != nullptr);
+
+	pthread_t threads[NUM_PRODUCERS];
+	ProducerArgs args[NUM_PRODUCERS];
+
+	for (int p = 0; p < NUM_PRODUCERS; p++) {
+		for (int i = 0; i < NODES_PER_PRODUCER; i++) {
+			nodes[p * NODES_PER_PRODUCER + i].producer = p;
+			nodes[p * NODES_PER_PRODUCER + i].i = i;
+		}
+
+		args[p] = {&q1, &nodes[p * NODES_PER_PRODUCER]};
+		ut_assert_true(pthread_create(&threads[p], nullptr, producer_main, &args[p]) == 0);
+	}
+
+	// consume concurrently with the producers, each node exactly once and in order per producer
+	int next[NUM_PRODUCERS] {};
+	int count = 0;
+	bool in_order = true;
+
+	auto consume = [&](testMPSCContainer * t) {
+		in_order &= (t->i == next[t->producer]++);
+		count++;
+	};
+
+	while (count < NUM_PRODUCERS * NODES_PER_PRODUCER / 2) {
+		q1.pop_all(consume);
+	}
+
+	for (int p = 0; p < NUM_PRODUCERS; p++) {
+		pthread_join(threads[p], nullptr);
+	}
+
+	q1.pop_all(consume);
+
+	delete[] nodes;
+
+	ut_assert_true(in_order);
+	ut_compare("all nodes popped", count, NUM_PRODUCERS * NODES_PER_PRODUCER);
+	ut_assert_true(q1.empty());
+
+	return true;
+}
+
+ut_declare_test_c(test_IntrusiveMPSCQueue, IntrusiveMPSCQueueTest)
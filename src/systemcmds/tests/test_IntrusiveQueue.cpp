@@ -52,6 +52,7 @@ public:
 	bool test_push_duplicate();
 	bool test_remove();
 	bool test_reinsert();
+	bool test_push_sorted();
 
 };
 
@@ -62,6 +63,7 @@ bool IntrusiveQueueTest::run_tests()
 	ut_run_test(test_push_duplicate);
 	ut_run_test(test_remove);
 	ut_run_test(test_reinsert);
+	ut_run_test(test_push_sorted);
 
 	return (_tests_failed == 0);
 }
@@ -383,4 +385,58 @@ bool IntrusiveQueueTest::test_reinsert()
 	return true;
 }
 
+bool IntrusiveQueueTest::test_push_sorted()
+{
+	IntrusiveQueue<testContainer *> q1;
+
+	auto before = [](testContainer * a, testContainer * b) { return a->i < b->i; };
+
+	// insert 100 in an interleaved order: 0, 99, 1, 98, ...
+	for (int i = 0; i < 50; i++) {
+		testContainer *t1 = new testContainer();
+		t1->i = i;
+		q1.push_sorted(t1, before);
+
+		testContainer *t2 = new testContainer();
+		t2->i = 99 - i;
+		q1.push_sorted(t2, before);
+	}
+
+	ut_compare("size 100", q1.size(), 100);
+
+	// inserting a duplicate is rejected
+	testContainer *tail = q1.back();
+	q1.push_sorted(q1.front(), before);
+	q1.push_sorted(tail, before);
+	ut_compare("size still 100", q1.size(), 100);
+	ut_compare("tail 99", q1.back()->i, 99);
+
+	// equal elements keep insertion order
+	testContainer *equal = new testContainer();
+	equal->i = 50;
+	q1.push_sorted(equal, before);
+
+	// pop in sorted order
+	int last = -1;
+	bool equal_after = false;
+
+	while (!q1.empty()) {
+		testContainer *t = q1.pop();
+		ut_assert_true(t->i >= last);
+
+		if (t->i == 50) {
+			// the second 50 is the one inserted last
+			equal_after = (t == equal);
+		}
+
+		last = t->i;
+		delete t;
+	}
+
+	ut_assert_true(equal_after);
+	ut_compare("last 99", last, 99);
+
+	return true;
+}
+
 ut_declare_test_c(test_IntrusiveQueue, IntrusiveQueueTest)
@@ -88,6 +88,7 @@ const struct {
 	{"hrt",			test_hrt,		OPT_NOJIGTEST | OPT_NOALLTEST},
 	{"int",			test_int,		0},
 	{"i2c_spi_cli",		test_i2c_spi_cli,		0},
+	{"IntrusiveMPSCQueue",	test_IntrusiveMPSCQueue,	0},
 	{"IntrusiveQueue",	test_IntrusiveQueue,	0},
 	{"IntrusiveSortedList",	test_IntrusiveSortedList, 0},
 	{"List",		test_List,		0},
@@ -55,6 +55,7 @@ extern int test_hott_telemetry(int argc, char *argv[]);
 extern int test_hrt(int argc, char *argv[]);
 extern int test_int(int argc, char *argv[]);
 extern int test_i2c_spi_cli(int argc, char *argv[]);
+extern int test_IntrusiveMPSCQueue(int argc, char *argv[]);
 extern int test_IntrusiveQueue(int argc, char *argv[]);
 extern int test_led(int argc, char *argv[]);
 extern int test_IntrusiveSortedList(int argc, char *argv[]);
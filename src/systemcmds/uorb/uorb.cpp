@@ -31,6 +31,7 @@
  *
  ****************************************************************************/
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <uORB/uORB.h>
@@ -57,6 +58,21 @@ int uorb_main(int argc, char *argv[])
 
 	} else if (!strcmp(argv[1], "top")) {
 		return uorb_top(argv + 2, argc - 2);
+
+	} else if (!strcmp(argv[1], "stats")) {
+		return uorb_stats(argv + 2, argc - 2);
+
+	} else if (!strcmp(argv[1], "queue")) {
+		if (argc == 4) {
+			char *end;
+			unsigned long queue_size = strtoul(argv[3], &end, 10);
+
+			if (*end == '\0') {
+				return uorb_queue_set(argv[2], queue_size);
+			}
+		}
+
+		return uorb_queue(argv + 2, argc - 2);
 	}
 
 	usage();
@@ -84,6 +100,15 @@ modules are allowed to publish which topics. This is used for system-wide replay
 ### Examples
 Monitor topic publication rates. Besides `top`, this is an important command for general system inspection:
 $ uorb top
+
+Show the copy, lost message and publish to read latency statistics of the IMU topics (needs CONFIG_ORB_STATS):
+$ uorb stats sensor_gyro sensor_accel
+
+Show the recommended queue lengths based on the worst observed subscriber lag (needs CONFIG_ORB_STATS):
+$ uorb queue
+
+Override the queue length of a topic, e.g. from etc/config.txt before the modules start (needs CONFIG_ORB_QUEUE_OVERRIDE):
+$ uorb queue vehicle_command 8
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("uorb", "communication");
@@ -92,4 +117,8 @@ $ uorb top
 	PRINT_MODULE_USAGE_PARAM_FLAG('a', "print all instead of only currently publishing topics with subscribers", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('1', "run only once, then exit", true);
 	PRINT_MODULE_USAGE_ARG("<filter1> [<filter2>]", "topic(s) to match (implies -a)", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("stats", "Print per-topic copy, lost message and latency statistics");
+	PRINT_MODULE_USAGE_ARG("<filter1> [<filter2>]", "topic(s) to match", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("queue", "Print queue length advice, or override the queue length of a topic");
+	PRINT_MODULE_USAGE_ARG("<filter1> [<filter2>] | <topic> <length>", "topic(s) to match, or topic and queue length", true);
 }